@@ -0,0 +1,77 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_REQUESTS_BENCH_BENCH_HPP
+#define BOOST_REQUESTS_BENCH_BENCH_HPP
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace bench
+{
+
+using clock_type = std::chrono::steady_clock;
+
+// counts every allocation that goes through it, so the hot-path allocation
+// numbers can be tracked per release.
+struct counting_resource final : boost::container::pmr::memory_resource
+{
+  std::size_t allocations{0u};
+  std::size_t bytes{0u};
+  boost::container::pmr::memory_resource * upstream{boost::container::pmr::get_default_resource()};
+
+ private:
+  void * do_allocate(std::size_t size, std::size_t align) override
+  {
+    allocations++;
+    bytes += size;
+    return upstream->allocate(size, align);
+  }
+  void do_deallocate(void * p, std::size_t size, std::size_t align) override
+  {
+    upstream->deallocate(p, size, align);
+  }
+  bool do_is_equal(const memory_resource & other) const noexcept override
+  {
+    return this == &other;
+  }
+};
+
+// run f() `iterations` times (plus a tenth as warm-up) and report ns per call.
+template<typename F>
+void run(const char * name, std::size_t iterations, F && f)
+{
+  for (std::size_t i = 0u; i < iterations / 10u + 1u; i++)
+    f();
+
+  const auto t0 = clock_type::now();
+  for (std::size_t i = 0u; i < iterations; i++)
+    f();
+  const auto dt = clock_type::now() - t0;
+
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(dt).count();
+  std::printf("%-52s %9zu x %12.1f ns\n",
+              name, iterations, static_cast<double>(ns) / iterations);
+}
+
+// report throughput for a phase that moved `bytes` in `dt`.
+inline void report_rate(const char * name, std::uint64_t bytes, clock_type::duration dt)
+{
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(dt).count();
+  std::printf("%-52s %9.2f MB %11.1f MB/s\n",
+              name, bytes / 1.e6, (bytes / 1.e6) / (ns / 1.e9));
+}
+
+inline void report_count(const char * name, double value, const char * unit)
+{
+  std::printf("%-52s %14.1f %s\n", name, value, unit);
+}
+
+}
+
+#endif // BOOST_REQUESTS_BENCH_BENCH_HPP
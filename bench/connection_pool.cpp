@@ -0,0 +1,65 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bench.hpp"
+#include "server.hpp"
+
+#include <boost/requests/connection_pool.hpp>
+#include <boost/url/parse.hpp>
+
+#include <cstdio>
+#include <memory>
+
+using namespace boost;
+
+namespace
+{
+
+// one chain keeps re-acquiring a connection; several of them running on the
+// same context model requests contending for the pool.
+struct acquire_chain
+{
+  requests::http_connection_pool & pool;
+  std::size_t remaining;
+
+  void operator()(system::error_code ec = {},
+                  std::shared_ptr<requests::http_connection_pool::connection_type> conn = nullptr)
+  {
+    if (ec)
+    {
+      std::fprintf(stderr, "async_get_connection: %s\n", ec.message().c_str());
+      return;
+    }
+    if (remaining == 0u)
+      return;
+    remaining--;
+    pool.async_get_connection(std::move(*this));
+  }
+};
+
+}
+
+// completions per second of async_get_connection with several chains
+// contending for the pool's mutex and connection list.
+void bench_pool(bench::server & sv)
+{
+  constexpr std::size_t chains     = 16u;
+  constexpr std::size_t per_chain  = 5000u;
+
+  asio::io_context ctx{1};
+  requests::http_connection_pool pool{ctx, 4u};
+  pool.lookup(urls::parse_authority(sv.authority()).value());
+
+  for (std::size_t i = 0u; i < chains; i++)
+    acquire_chain{pool, per_chain}();
+
+  const auto t0 = bench::clock_type::now();
+  ctx.run();
+  const auto dt = bench::clock_type::now() - t0;
+
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(dt).count();
+  bench::report_count("async_get_connection, 16 contending chains",
+                      static_cast<double>(chains * per_chain) * 1.e9 / ns, "ops/s");
+}
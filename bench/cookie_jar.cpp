@@ -0,0 +1,43 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bench.hpp"
+
+#include <boost/requests/cookie_jar.hpp>
+
+#include <cstdio>
+
+using namespace boost;
+
+// cookie_jar::get has to filter the whole jar per request; measure it on a
+// well-filled one.
+void bench_cookie_jar()
+{
+  requests::cookie_jar jar;
+
+  char field[64];
+  for (std::size_t i = 0u; i < 5000u; i++)
+  {
+    std::snprintf(field, sizeof(field), "c%04zu=v%04zu; Path=/; Max-Age=3600",
+                  i, i);
+    auto sc = requests::parse_set_cookie_field(field);
+    if (sc.has_error())
+    {
+      std::fprintf(stderr, "parse_set_cookie_field: %s\n", sc.error().message().c_str());
+      return;
+    }
+    // spread over a few hosts so domain matching does real work
+    char host[32];
+    std::snprintf(host, sizeof(host), "h%02zu.example.test", i % 16u);
+    jar.set(*sc, host);
+  }
+
+  bench::run("cookie_jar::get, 5000 cookies", 2000u,
+      [&]
+      {
+        auto cc = jar.get("h03.example.test", true, "/index.html");
+        (void)cc;
+      });
+}
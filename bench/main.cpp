@@ -0,0 +1,30 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/json/src.hpp>
+#include <boost/url/src.hpp>
+#include <boost/requests/src.hpp>
+
+#include "bench.hpp"
+#include "server.hpp"
+
+#include <cstdio>
+
+void bench_request(bench::server & sv);
+void bench_pool(bench::server & sv);
+void bench_stream(bench::server & sv);
+void bench_cookie_jar();
+
+int main()
+{
+  bench::server sv;
+  std::printf("boost.requests benchmarks against %s\n", sv.authority().c_str());
+
+  bench_request(sv);
+  bench_pool(sv);
+  bench_stream(sv);
+  bench_cookie_jar();
+  return 0;
+}
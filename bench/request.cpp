@@ -0,0 +1,46 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bench.hpp"
+#include "server.hpp"
+
+#include <boost/requests/connection.hpp>
+#include <boost/requests/request.hpp>
+
+using namespace boost;
+
+// latency and allocation count of the synchronous request() hot path over a
+// kept-alive connection.
+void bench_request(bench::server & sv)
+{
+  asio::io_context ctx{1};
+  requests::http_connection conn{ctx};
+  conn.set_host("127.0.0.1");
+  conn.connect(sv.endpoint());
+
+  requests::request_options opts;
+  opts.enforce_tls = false;
+  opts.redirect = requests::redirect_mode::none;
+
+  bench::counting_resource cr;
+  std::size_t calls = 0u;
+
+  const std::size_t iterations = 2000u;
+  bench::run("request() 1 KB body, keep-alive", iterations,
+      [&]
+      {
+        calls++;
+        auto res = requests::request(
+            conn, requests::http::verb::get, urls::url_view("/small"), requests::empty{},
+            requests::request_settings{
+                requests::request_settings::fields_type(
+                    container::pmr::polymorphic_allocator<char>(&cr)),
+                opts, nullptr});
+        (void)res;
+      });
+
+  bench::report_count("request() allocations per call",
+                      static_cast<double>(cr.allocations) / calls, "allocs");
+}
@@ -0,0 +1,99 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_REQUESTS_BENCH_SERVER_HPP
+#define BOOST_REQUESTS_BENCH_SERVER_HPP
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/http/read.hpp>
+#include <boost/beast/http/string_body.hpp>
+#include <boost/beast/http/write.hpp>
+#include <string>
+#include <thread>
+
+namespace bench
+{
+
+constexpr std::size_t small_body_size =       1024u;
+constexpr std::size_t large_body_size = 8u * 1024u * 1024u;
+
+// A minimal in-process echo/latency server on the loopback interface.
+// One blocking thread per connection is plenty here; the benchmarks drive it
+// from a handful of clients and the interesting numbers are on the client side.
+//
+//   GET /small -> 1 KB of 'x'        GET /large -> 8 MB of 'x'
+//   POST /echo -> the request body
+struct server
+{
+  server()
+      : acceptor_(ctx_, boost::asio::ip::tcp::endpoint(
+                            boost::asio::ip::make_address_v4("127.0.0.1"), 0u))
+  {
+    accept_thread_ = std::thread([this]{ accept_loop_(); });
+  }
+
+  ~server()
+  {
+    boost::system::error_code ec;
+    acceptor_.close(ec);
+    accept_thread_.join();
+  }
+
+  boost::asio::ip::tcp::endpoint endpoint() const { return acceptor_.local_endpoint(); }
+  std::string authority() const { return "127.0.0.1:" + std::to_string(endpoint().port()); }
+
+ private:
+  void accept_loop_()
+  {
+    for (;;)
+    {
+      boost::system::error_code ec;
+      boost::asio::ip::tcp::socket sock{ctx_};
+      acceptor_.accept(sock, ec);
+      if (ec)
+        return;
+      std::thread([s = std::move(sock)]() mutable { session_(std::move(s)); }).detach();
+    }
+  }
+
+  static void session_(boost::asio::ip::tcp::socket sock)
+  {
+    namespace http = boost::beast::http;
+    static const std::string small_body(small_body_size, 'x');
+    static const std::string large_body(large_body_size, 'x');
+
+    boost::beast::flat_buffer buffer;
+    boost::system::error_code ec;
+    while (!ec)
+    {
+      http::request<http::string_body> req;
+      http::read(sock, buffer, req, ec);
+      if (ec)
+        break;
+
+      http::response<http::string_body> res{http::status::ok, req.version()};
+      if (req.target() == "/large")
+        res.body() = large_body;
+      else if (req.target() == "/echo")
+        res.body() = std::move(req.body());
+      else
+        res.body() = small_body;
+      res.keep_alive(req.keep_alive());
+      res.prepare_payload();
+      http::write(sock, res, ec);
+    }
+    sock.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+  }
+
+  boost::asio::io_context ctx_{1};
+  boost::asio::ip::tcp::acceptor acceptor_;
+  std::thread accept_thread_;
+};
+
+}
+
+#endif // BOOST_REQUESTS_BENCH_SERVER_HPP
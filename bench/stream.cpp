@@ -0,0 +1,64 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bench.hpp"
+#include "server.hpp"
+
+#include <boost/asio/buffer.hpp>
+#include <boost/requests/connection.hpp>
+
+using namespace boost;
+
+namespace
+{
+
+std::uint64_t drain(requests::http_connection & conn,
+                    core::string_view target,
+                    std::size_t repeats)
+{
+  requests::request_options opts;
+  opts.enforce_tls = false;
+  opts.redirect = requests::redirect_mode::none;
+
+  char chunk[16u * 1024u];
+  std::uint64_t total = 0u;
+
+  for (std::size_t i = 0u; i < repeats; i++)
+  {
+    system::error_code ec;
+    auto str = conn.ropen(requests::http::verb::get, urls::url_view(target),
+                          requests::empty{}, requests::request_settings{{}, opts, nullptr}, ec);
+    while (!ec && !str.done())
+      total += str.read_some(asio::buffer(chunk), ec);
+    if (ec)
+    {
+      std::fprintf(stderr, "read_some %.*s: %s\n",
+                   static_cast<int>(target.size()), target.data(), ec.message().c_str());
+      break;
+    }
+  }
+  return total;
+}
+
+}
+
+// body throughput of basic_stream::read_some for small and large responses.
+void bench_stream(bench::server & sv)
+{
+  asio::io_context ctx{1};
+  requests::http_connection conn{ctx};
+  conn.set_host("127.0.0.1");
+  conn.connect(sv.endpoint());
+
+  drain(conn, "/small", 16u); // warm-up
+
+  auto t0 = bench::clock_type::now();
+  auto total = drain(conn, "/small", 4096u);
+  bench::report_rate("read_some, 1 KB bodies", total, bench::clock_type::now() - t0);
+
+  t0 = bench::clock_type::now();
+  total = drain(conn, "/large", 32u);
+  bench::report_rate("read_some, 8 MB bodies", total, bench::clock_type::now() - t0);
+}
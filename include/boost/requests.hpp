@@ -19,6 +19,7 @@
 #include <boost/requests/keep_alive.hpp>
 #include <boost/requests/method.hpp>
 #include <boost/requests/mime_types.hpp>
+#include <boost/requests/paginator.hpp>
 #include <boost/requests/public_suffix.hpp>
 #include <boost/requests/redirect.hpp>
 #include <boost/requests/request.hpp>
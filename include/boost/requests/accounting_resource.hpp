@@ -0,0 +1,106 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_ACCOUNTING_RESOURCE_HPP
+#define BOOST_REQUESTS_ACCOUNTING_RESOURCE_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+#include <atomic>
+#include <cstddef>
+
+namespace boost
+{
+namespace requests
+{
+
+/// A snapshot of what went through an accounting_resource, see
+/// response_base::memory_report.
+struct memory_report
+{
+  /// calls to allocate / deallocate
+  std::size_t allocations{0u}, deallocations{0u};
+  /// total bytes requested over the lifetime
+  std::size_t bytes_allocated{0u};
+  /// bytes currently live, and the most that ever were at once
+  std::size_t bytes_in_use{0u}, high_water{0u};
+};
+
+/// Counts every allocation passing through on its way to the upstream
+/// resource. The library is allocator-aware end to end - hand the request
+/// an allocator on this resource and the parser, response buffer and
+/// history follow it downstream - so one resource per request yields that
+/// request's allocation count and high-water mark as hard numbers,
+/// comparable across library versions:
+///
+///     requests::accounting_resource mem;
+///     requests::request_settings rs{requests::http::fields(
+///         container::pmr::polymorphic_allocator<char>(&mem)), {}};
+///     auto res = requests::get(conn, url, std::move(rs));
+///     auto rep = res.memory_report(); // rep.allocations per this GET
+///
+/// Counters are relaxed atomics, mirroring the arena: one request's
+/// allocations are sequenced anyway, only stray final deallocations may
+/// come from another thread. The resource adds two or three uncontended
+/// atomic ops per allocation and must outlive everything allocated from
+/// it, including the response.
+struct accounting_resource final : container::pmr::memory_resource
+{
+  explicit accounting_resource(container::pmr::memory_resource * upstream
+                                   = container::pmr::get_default_resource())
+      : upstream_(upstream) {}
+
+  memory_report report() const
+  {
+    memory_report rep;
+    rep.allocations     = allocations_    .load(std::memory_order_relaxed);
+    rep.deallocations   = deallocations_  .load(std::memory_order_relaxed);
+    rep.bytes_allocated = bytes_allocated_.load(std::memory_order_relaxed);
+    rep.bytes_in_use    = bytes_in_use_   .load(std::memory_order_relaxed);
+    rep.high_water      = high_water_     .load(std::memory_order_relaxed);
+    return rep;
+  }
+
+  container::pmr::memory_resource * upstream() const {return upstream_;}
+
+ private:
+  void * do_allocate(std::size_t size, std::size_t align) override
+  {
+    void * p = upstream_->allocate(size, align);
+    allocations_    .fetch_add(1u,   std::memory_order_relaxed);
+    bytes_allocated_.fetch_add(size, std::memory_order_relaxed);
+    const auto in_use = bytes_in_use_.fetch_add(size, std::memory_order_relaxed) + size;
+    auto hw = high_water_.load(std::memory_order_relaxed);
+    while (in_use > hw
+        && !high_water_.compare_exchange_weak(hw, in_use, std::memory_order_relaxed))
+      ;
+    return p;
+  }
+
+  void do_deallocate(void * p, std::size_t size, std::size_t align) override
+  {
+    deallocations_.fetch_add(1u,   std::memory_order_relaxed);
+    bytes_in_use_ .fetch_sub(size, std::memory_order_relaxed);
+    upstream_->deallocate(p, size, align);
+  }
+
+  bool do_is_equal(const memory_resource & other) const noexcept override
+  {
+    return this == &other;
+  }
+
+  container::pmr::memory_resource * upstream_;
+  std::atomic<std::size_t> allocations_{0u}, deallocations_{0u};
+  std::atomic<std::size_t> bytes_allocated_{0u};
+  std::atomic<std::size_t> bytes_in_use_{0u}, high_water_{0u};
+};
+
+}
+}
+
+#endif // BOOST_REQUESTS_ACCOUNTING_RESOURCE_HPP
@@ -15,7 +15,11 @@
 #include <boost/beast/http/empty_body.hpp>
 #include <boost/beast/http/span_body.hpp>
 #include <boost/beast/http/vector_body.hpp>
+#include <boost/requests/detail/executor_with_default.hpp> // detail::void_t
+#include <boost/requests/detail/mmap_body.hpp>
 #include <boost/requests/form.hpp>
+#include <boost/requests/multipart.hpp>
+#include <boost/requests/source.hpp>
 #include <boost/url/params_view.hpp>
 #include <boost/url/params_encoded_view.hpp>
 
@@ -231,27 +235,69 @@ struct request_body_traits<form, void>
 };
 
 
+template<>
+struct request_body_traits<multipart_form, void>
+{
+  // the boundary is part of the content type, so this is a view into the
+  // form, which outlives the header setup.
+  static core::string_view default_content_type( const multipart_form & mf )
+  {
+    return mf.content_type();
+  }
+  using body_type = multipart_body;
+
+  static const multipart_form & make_body(const multipart_form & mf, system::error_code & ec)
+  {
+    return mf;
+  }
+
+  static multipart_form make_body(multipart_form && mf, system::error_code & ec)
+  {
+    return std::move(mf);
+  }
+};
+
+
+template<>
+struct request_body_traits<source, void>
+{
+  // a view into the source, which outlives the header setup
+  static core::string_view default_content_type( const source & src )
+  {
+    return src.content_type;
+  }
+  using body_type = source_body;
+
+  static const source & make_body(const source & src, system::error_code & ec)
+  {
+    return src;
+  }
+
+  static source make_body(source && src, system::error_code & ec)
+  {
+    return std::move(src);
+  }
+};
+
+
 template<>
 struct request_body_traits<boost::filesystem::path, void>
 {
   template<typename Path>
   static core::string_view default_content_type( const Path & pt)
   {
-    const auto & mp = default_mime_type_map();
     const auto ext = pt.extension().string();
-    auto itr = mp.find(ext);
-    if (itr != mp.end())
-      return itr->second;
-    else
-      return "text/plain";
+    const auto mt = mime_type_for(ext);
+    return mt.empty() ? core::string_view("text/plain") : mt;
   }
-  using body_type = beast::http::file_body;
+  // large regular files get memory-mapped, see detail/mmap_body.hpp
+  using body_type = detail::mmap_body;
 
   template<typename Path>
   static typename body_type::value_type make_body(const Path & pt, system::error_code & ec)
   {
     typename body_type::value_type file;
-    file.open(pt.string().c_str(), beast::file_mode::read, ec);
+    file.open(pt.string().c_str(), ec);
     return file;
   }
 };
@@ -262,26 +308,51 @@ struct request_body_traits<std::filesystem::path, void>
 {
   static core::string_view default_content_type( const std::filesystem::path & pt)
   {
-    const auto & mp = default_mime_type_map();
     const auto ext = pt.extension().string();
-    auto itr = mp.find(ext);
-    if (itr != mp.end())
-      return itr->second;
-    else
-      return "text/plain";
+    const auto mt = mime_type_for(ext);
+    return mt.empty() ? core::string_view("text/plain") : mt;
   }
-  using body_type = beast::http::file_body;
+  // large regular files get memory-mapped, see detail/mmap_body.hpp
+  using body_type = detail::mmap_body;
 
   static typename body_type::value_type make_body(const std::filesystem::path & pt, system::error_code & ec)
   {
     typename body_type::value_type file;
-    file.open(pt.string().c_str(), beast::file_mode::read, ec);
+    file.open(pt.string().c_str(), ec);
     return file;
   }
 };
 
 #endif
 
+namespace detail
+{
+
+// Bodies that encode their content on the way out (see compress.hpp)
+// advertise the coding through an optional `content_encoding` member of
+// their traits; everything else defaults to none.
+template<typename Traits, typename Body, typename = void>
+struct body_content_encoding_t
+{
+  static core::string_view apply(const Body &) { return ""; }
+};
+
+template<typename Traits, typename Body>
+struct body_content_encoding_t<Traits, Body,
+    void_t<decltype(Traits::content_encoding(std::declval<const Body &>()))>>
+{
+  static core::string_view apply(const Body & body) { return Traits::content_encoding(body); }
+};
+
+}
+
+/// The Content-Encoding the request should carry for `body`, empty for none.
+template<typename Traits, typename Body>
+core::string_view body_content_encoding(const Body & body)
+{
+  return detail::body_content_encoding_t<Traits, typename std::decay<Body>::type>::apply(body);
+}
+
 }
 }
 
@@ -0,0 +1,178 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_COMPRESS_HPP
+#define BOOST_REQUESTS_COMPRESS_HPP
+
+#include <boost/requests/body_traits.hpp>
+#include <boost/requests/detail/config.hpp>
+#include <boost/requests/detail/deflate.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/beast/http/message.hpp>
+#include <boost/optional.hpp>
+
+#include <utility>
+
+namespace boost
+{
+namespace requests
+{
+
+/// Marks a request body for transparent gzip upload compression, see
+/// gzipped(). Carries the wrapped body by value.
+template<typename RequestBody>
+struct gzipped_t
+{
+  RequestBody body;
+};
+
+/// Wrap any request body so it is gzip-compressed inline with
+/// transmission: the inner body is serialized as usual, fed through a
+/// streaming encoder one staging buffer at a time and the request carries
+/// `Content-Encoding: gzip`. Nothing is buffered whole - compression
+/// overlaps the socket writes. The compressed length is unknowable up
+/// front, so the request goes out chunked.
+///
+/// @code
+/// auto res = requests::post(url, requests::gzipped(big_json_string));
+/// @endcode
+template<typename RequestBody>
+gzipped_t<typename std::decay<RequestBody>::type> gzipped(RequestBody && body)
+{
+  return {std::forward<RequestBody>(body)};
+}
+
+/// The serializer stage for gzipped_t: pulls buffers out of the wrapped
+/// body's writer and compresses them through detail::deflater into a
+/// BOOST_REQUESTS_CHUNK_SIZE staging buffer.
+template<typename InnerBody>
+struct gzip_body
+{
+  using value_type = typename InnerBody::value_type;
+
+  struct writer
+  {
+    using const_buffers_type = asio::const_buffer;
+
+    template<bool IsRequest, typename Fields>
+    writer(const beast::http::header<IsRequest, Fields> & hd, value_type & body)
+        : inner_(hd, body)
+    {
+    }
+
+    void init(system::error_code & ec)
+    {
+      inner_.init(ec);
+    }
+
+    boost::optional<std::pair<const_buffers_type, bool>> get(system::error_code & ec)
+    {
+      ec = {};
+      std::size_t written = 0u;
+      while (!defl_.done() && written < sizeof(buffer_))
+      {
+        if (defl_.needs_input() && !defl_.input_finished() && !feed_(ec))
+        {
+          if (ec)
+            return boost::none;
+          break; // keep what was compressed so far, pull again next call
+        }
+        written += defl_.write_output(asio::mutable_buffer(buffer_ + written, sizeof(buffer_) - written), ec);
+        if (ec)
+          return boost::none;
+      }
+      if (written == 0u)
+        return boost::none; // only reachable once everything was handed out
+      return std::make_pair(const_buffers_type(buffer_, written), !defl_.done());
+    }
+
+   private:
+    using inner_buffers_type = typename InnerBody::writer::const_buffers_type;
+    using inner_iterator =
+        decltype(asio::buffer_sequence_begin(std::declval<const inner_buffers_type &>()));
+
+    // stage the next chunk of the wrapped body into the encoder; false if
+    // the inner writer has nothing ready (it never does mid-sequence).
+    bool feed_(system::error_code & ec)
+    {
+      if (!pending_)
+      {
+        pending_ = inner_.get(ec);
+        if (ec)
+          return false;
+        if (!pending_)
+        {
+          defl_.finish();
+          return true;
+        }
+        itr_ = asio::buffer_sequence_begin(pending_->first);
+      }
+      const auto end = asio::buffer_sequence_end(pending_->first);
+      while (*itr_ != end && asio::const_buffer(**itr_).size() == 0u)
+        ++*itr_;
+      if (*itr_ == end)
+      {
+        const bool last = !pending_->second;
+        pending_ = boost::none;
+        itr_ = boost::none;
+        if (last)
+        {
+          defl_.finish();
+          return true;
+        }
+        return feed_(ec); // sequence drained, pull the next one
+      }
+      defl_.provide(asio::const_buffer(**itr_));
+      ++*itr_;
+      return true;
+    }
+
+    typename InnerBody::writer inner_;
+    detail::deflater defl_;
+    // the wrapped writer's buffers stay valid until its next get(), so the
+    // sequence is held here while the encoder drains it view by view.
+    boost::optional<std::pair<inner_buffers_type, bool>> pending_;
+    boost::optional<inner_iterator> itr_;
+    char buffer_[BOOST_REQUESTS_CHUNK_SIZE];
+  };
+};
+
+template<typename RequestBody>
+struct request_body_traits<gzipped_t<RequestBody>, void>
+{
+  using inner_traits = request_body_traits<typename std::decay<RequestBody>::type>;
+
+  static core::string_view default_content_type(const gzipped_t<RequestBody> & body)
+  {
+    return inner_traits::default_content_type(body.body);
+  }
+
+  // picked up by body_content_encoding at the prepare sites
+  static core::string_view content_encoding(const gzipped_t<RequestBody> &)
+  {
+    return "gzip";
+  }
+
+  using body_type = gzip_body<typename inner_traits::body_type>;
+
+  static auto make_body(const gzipped_t<RequestBody> & body, system::error_code & ec)
+      -> decltype(inner_traits::make_body(std::declval<const RequestBody &>(), ec))
+  {
+    return inner_traits::make_body(body.body, ec);
+  }
+
+  static auto make_body(gzipped_t<RequestBody> && body, system::error_code & ec)
+      -> decltype(inner_traits::make_body(std::declval<RequestBody &&>(), ec))
+  {
+    return inner_traits::make_body(std::move(body.body), ec);
+  }
+};
+
+}
+}
+
+#endif // BOOST_REQUESTS_COMPRESS_HPP
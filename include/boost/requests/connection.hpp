@@ -15,26 +15,57 @@
 #include <boost/asio/ssl/stream.hpp>
 #include <boost/asio/strand.hpp>
 #include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/core/read_size.hpp>
 #include <boost/beast/http/empty_body.hpp>
 #include <boost/beast/http/read.hpp>
 #include <boost/beast/http/string_body.hpp>
 #include <boost/beast/http/write.hpp>
+#include <boost/beast/websocket/ssl.hpp>
 #include <boost/beast/websocket/stream.hpp>
 #include <boost/requests/body_traits.hpp>
+#include <boost/requests/detail/alpn.hpp>
+#include <boost/requests/detail/buffer_pool.hpp>
+#include <boost/requests/detail/metrics.hpp>
 #include <boost/requests/detail/ssl.hpp>
+#include <boost/requests/detail/ssl_session_cache.hpp>
+#include <boost/requests/detail/timer_wheel.hpp>
 #include <boost/requests/detail/tracker.hpp>
 #include <boost/requests/fields/keep_alive.hpp>
+#include <boost/requests/prepared_request.hpp>
 #include <boost/requests/redirect.hpp>
 #include <boost/requests/request_options.hpp>
 #include <boost/requests/request_settings.hpp>
 #include <boost/requests/response.hpp>
+#include <boost/requests/socket_options.hpp>
 #include <boost/requests/stream.hpp>
+#include <boost/requests/trace.hpp>
 #include <boost/smart_ptr/allocate_unique.hpp>
 #include <boost/url/url_view.hpp>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
 
 namespace boost {
 namespace requests {
 
+#if defined(__linux__)
+namespace detail
+{
+
+// splice(2) needs a real socket fd right under the stream, so only the plain
+// tcp instantiation qualifies; ssl streams keep copying through userspace.
+template<typename Stream>
+struct is_spliceable_socket : std::false_type {};
+
+template<typename Protocol, typename Executor>
+struct is_spliceable_socket<asio::basic_stream_socket<Protocol, Executor>> : std::true_type {};
+
+}
+#endif
+
 template<typename Stream>
 struct basic_connection : private detail::stream_base
 {
@@ -99,6 +130,15 @@ struct basic_connection : private detail::stream_base
           , ongoing_requests_(std::move(lhs.ongoing_requests_.load()))
           , keep_alive_set_(std::move(lhs.keep_alive_set_))
           , endpoint_(std::move(lhs.endpoint_))
+          , tls_session_cache_(lhs.tls_session_cache_)
+          , buffer_pool_(lhs.buffer_pool_)
+          , metrics_(lhs.metrics_)
+          , idle_listener_(lhs.idle_listener_)
+          , trace_hook_(lhs.trace_hook_)
+          , use_stamp_(lhs.use_stamp_.load())
+          , socket_options_(lhs.socket_options_)
+          , tunnel_target_(std::move(lhs.tunnel_target_))
+          , handshake_ex_(std::move(lhs.handshake_ex_))
     {}
 
     void connect(endpoint_type ep)
@@ -119,6 +159,28 @@ struct basic_connection : private detail::stream_base
     async_connect(endpoint_type ep,
                   CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
 
+    /// Connect to the first reachable of several endpoints. The async version
+    /// races them happy-eyeballs style (RFC 8305): staggered concurrent dials,
+    /// the winner is kept and the rest are cancelled. The sync version tries
+    /// them in the same interleaved order, one after the other.
+    void connect(std::vector<endpoint_type> eps)
+    {
+      boost::system::error_code ec;
+      connect(std::move(eps), ec);
+      if (ec)
+        urls::detail::throw_system_error(ec);
+    }
+
+    void connect(std::vector<endpoint_type> eps,
+                 system::error_code & ec);
+
+    template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code)) CompletionToken
+                  BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken,
+                                       void (boost::system::error_code))
+    async_connect(std::vector<endpoint_type> eps,
+                  CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
+
     void close()
     {
       boost::system::error_code ec;
@@ -149,7 +211,47 @@ struct basic_connection : private detail::stream_base
       return keep_alive_set_.timeout;
     }
 
-    std::size_t working_requests() const { return ongoing_requests_; }
+    // pairs with the releasing decrement in detail::tracker: a zero seen
+    // here means the request's writes are visible, too.
+    std::size_t working_requests() const { return ongoing_requests_.load(std::memory_order_acquire); }
+
+    /// Requests the server will still accept on this connection, as last
+    /// advertised through `Keep-Alive: max=` (counted down per response).
+    /// Unlimited when the server never advertised a budget.
+    std::size_t requests_remaining() const { return keep_alive_set_.max; }
+
+    /// Whether the connection is one request away from the server's
+    /// advertised limit. The pool retires such connections instead of
+    /// handing them out, so the final request never turns into a
+    /// failed-write-plus-retry on a connection the server is closing.
+    bool near_keep_alive_limit() const
+    {
+      return keep_alive_set_.max <= 1u;
+    }
+
+    /// Cheap liveness check on an idle connection before it is handed out
+    /// again: a peer that closed while we were not looking passes
+    /// is_open() (that only sees the local socket) and fails only after a
+    /// request has been serialized and written into it. Checks the
+    /// server's advertised keep-alive deadline and peeks the socket for a
+    /// pending FIN, so the pool can retire the connection instead of
+    /// burning a doomed write plus a retry on it.
+    bool appears_stale()
+    {
+      if (!is_open())
+        return true;
+      if (keep_alive_set_.timeout <= std::chrono::system_clock::now())
+        return true;
+      return peer_closed_();
+    }
+
+    /// Monotonic hand-out stamp, written by the owning pool each time this
+    /// connection is selected. Free connections are picked most-recently-used
+    /// first, so a half-loaded pool concentrates traffic on few hot sockets
+    /// (warm cwnd, warm TLS state) while the cold tail ages out in the idle
+    /// sweep. See basic_connection_pool::get_connection.
+    std::uint64_t use_stamp() const { return use_stamp_.load(std::memory_order_relaxed); }
+    void mark_used(std::uint64_t stamp) { use_stamp_.store(stamp, std::memory_order_relaxed); }
 
     // Reserve memory for the internal buffer.
     void reserve(std::size_t size)
@@ -169,6 +271,95 @@ struct basic_connection : private detail::stream_base
     core::string_view host() const {return host_;}
     constexpr static redirect_mode supported_redirect_mode() {return redirect_mode::endpoint;}
 
+    /// The application protocol negotiated through ALPN. Empty on plain connections.
+    core::string_view negotiated_protocol()
+    {
+      return detail::alpn_selected(next_layer_);
+    }
+
+    /// Whether concurrent requests share this connection (h2). Always false for
+    /// http/1.1; the pool uses this to prefer multiplexed connections.
+    bool uses_multiplexing()
+    {
+      return negotiated_protocol() == "h2";
+    }
+
+    /// Share a TLS session cache (usually the owning pool's) for resumption.
+    void set_ssl_session_cache(detail::ssl_session_cache * cache)
+    {
+      tls_session_cache_ = cache;
+    }
+
+    /// Run the CPU-bound part of asynchronous TLS handshakes on `ex`
+    /// instead of the io executor, see
+    /// basic_connection_pool::set_handshake_executor. An empty executor
+    /// (the default) keeps the handshake inline; plain connections and the
+    /// blocking connect ignore it.
+    void set_handshake_executor(asio::any_io_executor ex)
+    {
+      handshake_ex_ = std::move(ex);
+    }
+    const asio::any_io_executor & get_handshake_executor() const
+    {
+      return handshake_ex_;
+    }
+
+    /// Share a staging-buffer pool (usually the owning pool's), so the read
+    /// buffer is checked out per response instead of kept for the lifetime.
+    void set_buffer_pool(detail::buffer_pool * pool)
+    {
+      buffer_pool_ = pool;
+    }
+
+    /// Share a counter block (usually the owning pool's) that this connection
+    /// updates with relaxed atomics, see basic_connection_pool::stats.
+    void set_metrics(detail::pool_metrics * metrics)
+    {
+      metrics_ = metrics;
+    }
+
+    /// Gets notified when the last ongoing request of this connection
+    /// finishes; the owning pool uses it to wake one parked waiter, see
+    /// basic_connection_pool::set_queue_discipline.
+    void set_idle_listener(detail::idle_listener * listener)
+    {
+      idle_listener_ = listener;
+    }
+
+    /// Install a span receiver (usually the owning pool's, which got it
+    /// from the session); inert unless compiled with
+    /// BOOST_REQUESTS_ENABLE_TRACE, see trace_hook.
+    void set_trace_hook(trace_hook * hook)
+    {
+      trace_hook_ = hook;
+    }
+
+    /// The profile applied to the socket between open and connect, see
+    /// socket_options. Takes effect from the next dial.
+    void set_socket_options(const socket_options & opts)
+    {
+      socket_options_ = opts;
+    }
+    const socket_options & get_socket_options() const
+    {
+      return socket_options_;
+    }
+
+    /// When set to a "host:port" authority, every dial issues an HTTP CONNECT
+    /// for it on the freshly connected socket before anything else runs on the
+    /// wire -- for https that is before the TLS handshake, so the origin's
+    /// certificate is still what gets verified. The endpoints this connection
+    /// dials are then the proxy's, not the origin's. An empty target
+    /// connects directly. Takes effect from the next dial.
+    void set_connect_tunnel(core::string_view target)
+    {
+      tunnel_target_.assign(target.begin(), target.end());
+    }
+    core::string_view connect_tunnel() const
+    {
+      return tunnel_target_;
+    }
+
     using request_type = request_settings;
 
     using stream = basic_stream<executor_type>;
@@ -267,6 +458,76 @@ struct basic_connection : private detail::stream_base
     auto ropen(http::request<http::file_body>   & req, request_options opt, cookie_jar * jar, system::error_code & ec) -> stream;
     auto ropen(http::request<http::string_body> & req, request_options opt, cookie_jar * jar, system::error_code & ec) -> stream;
 
+    /// Run a prepared request over this connection: the invariant header
+    /// block goes out as-is, only Host, Cookie, Content-Length and (for
+    /// decompress_body) Accept-Encoding are appended per call, see
+    /// prepared_request. `req` and `body` must stay alive until completion.
+    /// Redirects are not followed; a prepared request cannot be rewritten.
+    auto ropen(const prepared_request & req,
+               core::string_view body,
+               request_options opt,
+               cookie_jar * jar,
+               system::error_code & ec) -> stream;
+
+    auto ropen(const prepared_request & req,
+               core::string_view body,
+               request_options opt,
+               cookie_jar * jar = nullptr) -> stream
+    {
+      boost::system::error_code ec;
+      auto res = ropen(req, body, std::move(opt), jar, ec);
+      if (ec)
+        throw_exception(system::system_error(ec, "open"));
+      return res;
+    }
+
+    template<typename CompletionToken
+                 BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken,
+                                       void (boost::system::error_code, typename basic_connection<Stream>::stream))
+    async_ropen(const prepared_request & req,
+                core::string_view body,
+                request_options opt,
+                cookie_jar * jar = nullptr,
+                CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
+
+    /// The stream released by upgrade().
+    using websocket_type = beast::websocket::stream<next_layer_type>;
+
+    /// Upgrade this connection to a WebSocket (RFC 6455) and release the
+    /// stream to the caller. The handshake runs over the established (and
+    /// for https, already handshaken) transport, so none of DNS, connect or
+    /// TLS setup is paid again. `headers` go out on the upgrade request; the
+    /// jar contributes cookies like a regular request and collects the
+    /// response's. Waits for requests in flight to finish, then moves the
+    /// transport out: the connection is spent afterwards, success or not,
+    /// and on failure the returned stream is unusable.
+    websocket_type upgrade(urls::url_view path,
+                           http::fields headers,
+                           cookie_jar * jar,
+                           system::error_code & ec);
+
+    websocket_type upgrade(urls::url_view path,
+                           http::fields headers = http::fields(),
+                           cookie_jar * jar = nullptr)
+    {
+      boost::system::error_code ec;
+      auto res = upgrade(path, std::move(headers), jar, ec);
+      if (ec)
+        throw_exception(system::system_error(ec, "upgrade"));
+      return res;
+    }
+
+    template<typename CompletionToken
+                 BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken,
+                                       void (boost::system::error_code,
+                                             typename basic_connection<Stream>::websocket_type))
+    async_upgrade(urls::url_view path,
+                  http::fields headers = http::fields(),
+                  cookie_jar * jar = nullptr,
+                  CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
+
   private:
     template<typename >
     friend struct basic_connection;
@@ -274,7 +535,13 @@ struct basic_connection : private detail::stream_base
     template<typename Body>
     void write_impl(http::request<Body> & req,
                     asem::lock_guard<detail::basic_mutex<executor_type>> & read_lock,
-                    system::error_code & ec);
+                    system::error_code & ec,
+                    timing * tm = nullptr,
+                    bool pipeline = false,
+                    detail::op_deadline<Stream> * deadline = nullptr,
+                    std::chrono::milliseconds connect_timeout = std::chrono::milliseconds(0),
+                    bool expect_continue = false,
+                    std::chrono::milliseconds continue_timeout = std::chrono::milliseconds(0));
 
     Stream next_layer_;
     detail::basic_mutex<executor_type>
@@ -286,9 +553,114 @@ struct basic_connection : private detail::stream_base
     std::atomic<std::size_t> ongoing_requests_{0u};
     keep_alive keep_alive_set_;
     endpoint_type endpoint_;
+    detail::ssl_session_cache * tls_session_cache_ = nullptr;
+    detail::buffer_pool * buffer_pool_ = nullptr;
+    detail::pool_metrics * metrics_ = nullptr;
+    detail::idle_listener * idle_listener_ = nullptr;
+    trace_hook * trace_hook_ = nullptr;
+    std::atomic<std::uint64_t> use_stamp_{0u};
+    socket_options socket_options_;
+    std::string tunnel_target_;
+
+    // side executor for the handshake crypto, see set_handshake_executor
+    asio::any_io_executor handshake_ex_;
+
+    // The socket-level half of appears_stale: a non-blocking one-byte
+    // MSG_PEEK. Zero means the peer sent its FIN; readable bytes on a
+    // plain idle connection are data no request asked for (typically a
+    // 408 before the close), so the next write is doomed either way. A
+    // TLS peer may legitimately have records pending (session tickets),
+    // so there only the FIN counts.
+    bool peer_closed_()
+    {
+#if defined(__linux__)
+      char b;
+      const auto n = ::recv(beast::get_lowest_layer(next_layer_).native_handle(),
+                            &b, 1, MSG_PEEK | MSG_DONTWAIT);
+      if (n == 0)
+        return true;
+      if (n > 0)
+        return !detail::has_ssl_v<Stream>;
+      return errno != EAGAIN && errno != EWOULDBLOCK;
+#else
+      return false;
+#endif
+    }
+
+    // first buffer_ touch of a response: reuse pooled storage if ours was
+    // handed back after the previous request.
+    void maybe_checkout_buffer_()
+    {
+      if (buffer_pool_ != nullptr && buffer_.capacity() == 0u)
+        buffer_ = buffer_pool_->checkout();
+    }
+
+    // Streaming backpressure, set through the stream that holds the read
+    // lock (see basic_stream::set_read_watermark): socket reads stop
+    // staging bytes once buffer_ holds this much. Per response; reset in
+    // do_release_buffer_. Zero means beast's unclamped reads.
+    std::size_t read_watermark_ = 0u;
+
+    void do_set_read_watermark_(std::size_t bytes) final
+    {
+      read_watermark_ = bytes;
+    }
+
+    // How much one socket read may stage under the watermark. A reached
+    // watermark still allows a little, the parser may need a few more
+    // bytes of framing before it can hand anything out.
+    std::size_t watermark_headroom_() const
+    {
+      return buffer_.size() < read_watermark_
+           ? read_watermark_ - buffer_.size() : std::size_t(512u);
+    }
+
+    std::size_t read_some_limited_(beast::http::basic_parser<false> & parser, system::error_code & ec);
+    struct async_read_some_limited_op;
+
+    // Armed with request_options::body_timeout when a stream is handed out,
+    // disarmed when the response body completes or the connection closes.
+    // Body reads serialize on read_mtx_, so one entry per connection does.
+    // Created lazily (it pins the wheel by address) and not carried across
+    // rebinds; a fired body deadline surfaces as timed_out on the
+    // synchronous read paths and as the plain cancellation on async ones.
+    std::unique_ptr<detail::op_deadline<Stream>> body_deadline_;
+
+    void arm_body_deadline_(std::chrono::milliseconds after)
+    {
+      if (after.count() <= 0)
+        return;
+      if (body_deadline_ == nullptr)
+        body_deadline_.reset(new detail::op_deadline<Stream>(next_layer_));
+      body_deadline_->arm(after, get_executor());
+    }
+
+    void translate_body_timeout_(system::error_code & ec)
+    {
+      if (body_deadline_ != nullptr)
+        body_deadline_->translate(ec);
+    }
+
+    // Whether a redirect target can be replayed on this very connection:
+    // relative targets trivially stay here, absolute ones must name this
+    // host, a compatible scheme and the endpoint we are connected to.
+    // Everything else goes back to the caller, which can re-route it
+    // through the pool.
+    bool redirect_stays_here_(urls::url_view url) const
+    {
+      if (!url.has_authority())
+        return true;
+      if (!urls::grammar::ci_is_equal(host_, url.encoded_host()))
+        return false;
+      if (url.has_scheme() &&
+          ((url.scheme_id() == urls::scheme::https) != detail::has_ssl_v<Stream>))
+        return false;
+      return same_endpoint_on_host(url, endpoint_);
+    }
 
     struct async_close_op;
     struct async_connect_op;
+    struct async_connect_eps_op;
 
     template<typename RequestBody>
     struct async_ropen_op;
@@ -296,6 +668,8 @@ struct basic_connection : private detail::stream_base
     struct async_ropen_file_op;
     struct async_ropen_string_op;
     struct async_ropen_empty_op;
+    struct async_ropen_prepared_op;
+    struct async_upgrade_op;
 
     template<typename Body> async_ropen_op<Body> pick_ropen_op(Body * );
     async_ropen_file_op   pick_ropen_op(http::file_body   *);
@@ -306,9 +680,67 @@ struct basic_connection : private detail::stream_base
     std::size_t do_read_some_(beast::http::basic_parser<false> & parser, system::error_code & ec) final;
     void do_async_read_some_(beast::http::basic_parser<false> & parser, detail::co_token_t<void(system::error_code, std::size_t)>) final;
 
+    std::size_t do_buffered_input_() const final;
+    std::size_t do_read_body_direct_(detail::buffer_span buffers, system::error_code & ec) final;
+    void do_async_read_body_direct_(detail::buffer_span buffers, detail::co_token_t<void(system::error_code, std::size_t)>) final;
+
+    asio::const_buffer do_staged_input_() const final;
+    void do_consume_staged_(std::size_t n) final;
+    std::size_t do_stage_input_(system::error_code & ec) final;
+    void do_async_stage_input_(detail::co_token_t<void(system::error_code, std::size_t)>) final;
+    struct async_stage_input_op;
+
     void do_close_(system::error_code & ec) final;
     void do_async_close_(detail::co_token_t<void(system::error_code)>) final;
 
+    void do_release_buffer_() final;
+
+#if defined(__linux__)
+    bool do_supports_splice_() const final
+    {
+      // splicing bypasses the staging buffer, so any staged body bytes must
+      // be taken out first (possibly in place, see basic_stream::peek_some).
+      return detail::is_spliceable_socket<next_layer_type>::value
+          && buffer_.size() == 0u;
+    }
+    std::size_t do_splice_body_(int fd, std::size_t n, bool block, system::error_code & ec) final
+    {
+      return do_splice_body_impl_(detail::is_spliceable_socket<next_layer_type>{}, fd, n, block, ec);
+    }
+    void do_async_wait_readable_(detail::co_token_t<void(system::error_code)>) final;
+
+    std::size_t do_splice_body_impl_(std::false_type, int, std::size_t, bool, system::error_code & ec);
+    std::size_t do_splice_body_impl_(std::true_type, int fd, std::size_t n, bool block, system::error_code & ec);
+
+    // lazily created by do_splice_body_: the pipe that shuttles socket bytes
+    // into the target fd without surfacing them in userspace.
+    struct splice_pipe_t
+    {
+      int fds[2] = {-1, -1};
+      splice_pipe_t() = default;
+      splice_pipe_t(splice_pipe_t && rhs) noexcept : fds{rhs.fds[0], rhs.fds[1]}
+      {
+        rhs.fds[0] = rhs.fds[1] = -1;
+      }
+      ~splice_pipe_t()
+      {
+        if (fds[0] != -1)
+        {
+          ::close(fds[0]);
+          ::close(fds[1]);
+        }
+      }
+    };
+    splice_pipe_t splice_pipe_;
+#endif
+
+    void do_read_header_(beast::http::basic_parser<false> & parser, system::error_code & ec) final;
+    void do_async_read_header_(beast::http::basic_parser<false> & parser, detail::co_token_t<void(system::error_code, std::size_t)>) final;
+    core::string_view get_host_() const final
+    {
+      return host_;
+    }
+
     keep_alive & get_keep_alive_set_() final
     {
       return keep_alive_set_;
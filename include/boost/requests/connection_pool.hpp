@@ -6,10 +6,26 @@
 #define BOOST_REQUESTS_POOL_HPP
 
 #include <boost/requests/connection.hpp>
+#include <boost/requests/detail/async_coroutine.hpp>
+#include <boost/requests/detail/executor_with_default.hpp>
+#include <boost/requests/resolver_cache.hpp>
+#include <boost/requests/trace.hpp>
 #include <boost/asem/st.hpp>
+#include <boost/asio/append.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/basic_waitable_timer.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
 #include <boost/blank.hpp>
 #include <boost/core/empty_value.hpp>
+#include <boost/core/span.hpp>
 
 namespace boost {
 namespace requests {
@@ -45,6 +61,127 @@ struct endpoint_hash<asio::local::basic_endpoint<Protocol>>
 };
 
 
+// Protocols without a resolver - unix domain sockets - still get pools;
+// lookup() is simply not usable on them, see set_endpoint.
+template<typename Protocol, typename Executor, typename = void>
+struct resolver_of
+{
+  using type = void;
+};
+
+template<typename Protocol, typename Executor>
+struct resolver_of<Protocol, Executor, void_t<typename Protocol::resolver>>
+{
+  using type = typename Protocol::resolver::template rebind_executor<Executor>::other;
+};
+
+// connection-class failures that mean the pooled connection died before the
+// response header arrived, i.e. nothing of the response was consumed yet.
+inline bool is_stale_connection_error(system::error_code ec)
+{
+  return ec == asio::error::eof
+      || ec == asio::error::connection_reset
+      || ec == asio::error::broken_pipe;
+}
+
+inline bool is_idempotent_method(beast::http::verb v)
+{
+  switch (v)
+  {
+    case beast::http::verb::get:
+    case beast::http::verb::head:
+    case beast::http::verb::put:
+    case beast::http::verb::delete_:
+    case beast::http::verb::options:
+    case beast::http::verb::trace:
+      return true;
+    default:
+      return false;
+  }
+}
+
+inline bool may_retry_request(system::error_code ec,
+                              beast::http::verb method,
+                              const request_options & opt,
+                              std::size_t attempt)
+{
+  if (attempt >= opt.retries || !is_stale_connection_error(ec))
+    return false;
+  if (opt.retry_predicate != nullptr)
+    return opt.retry_predicate(method);
+  return is_idempotent_method(method);
+}
+
+inline bool may_hedge_request(beast::http::verb method,
+                              const request_options & opt)
+{
+  if (opt.hedge_after.count() <= 0)
+    return false;
+  if (opt.hedge_predicate != nullptr)
+    return opt.hedge_predicate(method);
+  return is_idempotent_method(method);
+}
+
+// backoff doubles per attempt; the exponent is capped so absurd retry
+// counts cannot overflow the duration arithmetic.
+inline std::chrono::milliseconds retry_delay(const request_options & opt,
+                                             std::size_t attempt)
+{
+  return opt.retry_backoff * (1u << (attempt < 16u ? attempt : 16u));
+}
+
+// A cap on open sockets shared by every pool of a session, see
+// basic_session::set_connection_budget: each pool holds one unit per
+// pooled connection, and a dial that finds the budget exhausted first
+// asks the owner to close idle connections in its least-recently-used
+// pools. That keeps the socket count proportional to actual traffic
+// instead of the number of distinct hosts.
+struct conn_budget
+{
+  std::atomic<std::size_t> limit{0u}; // 0 caps nothing, units still count
+  std::atomic<std::size_t> in_use{0u};
+  // installed by the owner: close idle connections elsewhere, sparing
+  // `requester` (it holds its own mutex while asking); returns the number
+  // of sockets freed.
+  std::function<std::size_t(const void * requester)> reclaim;
+
+  bool try_once()
+  {
+    const auto lim = limit.load(std::memory_order_relaxed);
+    auto cur = in_use.load(std::memory_order_relaxed);
+    do
+    {
+      if (lim != 0u && cur >= lim)
+        return false;
+    }
+    while (!in_use.compare_exchange_weak(cur, cur + 1u, std::memory_order_relaxed));
+    return true;
+  }
+
+  bool try_acquire(const void * requester)
+  {
+    if (try_once())
+      return true;
+    if (reclaim && reclaim(requester) > 0u)
+      return try_once();
+    return false;
+  }
+
+  // unconditional: a pool dialing its very first connection takes a unit
+  // even past the limit, so no pool can be starved outright. Oversubscribes
+  // by at most one socket per otherwise-empty pool.
+  void acquire()
+  {
+    in_use.fetch_add(1u, std::memory_order_relaxed);
+  }
+
+  void release(std::size_t n = 1u)
+  {
+    if (n > 0u)
+      in_use.fetch_sub(n, std::memory_order_relaxed);
+  }
+};
+
 template<bool>
 struct ssl_base
 {
@@ -72,26 +209,131 @@ struct ssl_base<true>
   {
     return context_;
   }
+
+  detail::ssl_session_cache & ssl_sessions()
+  {
+    return shared_sessions_ != nullptr ? *shared_sessions_ : session_cache_;
+  }
+
+  /// Resume TLS from `cache` instead of the pool's own per-origin cache,
+  /// so tickets are shared across pools (and sessions, see
+  /// basic_session::use_tls_sessions). `cache` must outlive the pool and
+  /// be set before connections are dialed; connections already dialed
+  /// keep the cache they were handed. A nullptr goes back to the own one.
+  void share_ssl_sessions(detail::ssl_session_cache * cache)
+  {
+    shared_sessions_ = cache;
+  }
+
+  /// Run the CPU-bound part of every TLS handshake on `ex` - usually a
+  /// small asio::thread_pool - instead of the connection's io executor: a
+  /// burst of pool growth then costs the io thread only the socket reads
+  /// and writes, not twenty rounds of key exchange back to back. The
+  /// connection resumes on its io executor afterwards. An empty executor
+  /// (the default) keeps the handshake inline; connections already dialed
+  /// keep their setting.
+  void set_handshake_executor(asio::any_io_executor ex)
+  {
+    handshake_executor_ = std::move(ex);
+  }
+  const asio::any_io_executor & get_handshake_executor() const
+  {
+    return handshake_executor_;
+  }
 protected:
   ssl_base(asio::ssl::context & context) : context_(context) {}
+  // the own session cache is not carried over on rebind; it refills on
+  // first use. A shared one lives elsewhere and stays.
+  ssl_base(const ssl_base & lhs)
+      : context_(lhs.context_), shared_sessions_(lhs.shared_sessions_),
+        handshake_executor_(lhs.handshake_executor_) {}
 
   template<typename Connection, typename Executor>
   std::shared_ptr<Connection> make_connection_(Executor exec)
   {
-    return std::make_shared<Connection>(std::move(exec), context_);
+    auto conn = std::make_shared<Connection>(std::move(exec), context_);
+    conn->set_ssl_session_cache(&ssl_sessions());
+    conn->set_handshake_executor(handshake_executor_);
+    return conn;
   }
 
   template<typename Connection, typename Allocator, typename Executor>
   std::shared_ptr<Connection> allocate_connection_(Allocator alloc, Executor exec)
   {
-    return std::allocate_shared<Connection>(std::move(alloc), std::move(exec), context_);
+    auto conn = std::allocate_shared<Connection>(std::move(alloc), std::move(exec), context_);
+    conn->set_ssl_session_cache(&ssl_sessions());
+    conn->set_handshake_executor(handshake_executor_);
+    return conn;
   }
 private:
   asio::ssl::context & context_;
+  // one resumable session per host, shared by all connections of the pool.
+  detail::ssl_session_cache session_cache_;
+  // a cache shared beyond the pool, see share_ssl_sessions
+  detail::ssl_session_cache * shared_sessions_ = nullptr;
+  // side executor for the handshake crypto, see set_handshake_executor
+  asio::any_io_executor handshake_executor_;
 };
 
 }
 
+/// Discipline for requests that arrive while every connection of a pool is
+/// busy, see basic_connection_pool::set_queue_discipline.
+enum class queue_discipline
+{
+  /// pipeline onto the least used connection right away (the historic behavior)
+  share,
+  /// park and serve the oldest waiter first, for fairness
+  fifo,
+  /// park and serve the newest waiter first, for latency under saturation
+  lifo
+};
+
+/// A snapshot of one pool's runtime counters, see basic_connection_pool::stats
+/// and basic_session::stats. Sampling is cheap; the monotonic counters are
+/// relaxed atomics maintained on the request path.
+struct pool_stats
+{
+  /// Established connections held by the pool, and how many of those are idle.
+  std::size_t connections_open{0u};
+  std::size_t connections_idle{0u};
+  /// Dials currently in flight.
+  std::size_t connecting{0u};
+  /// Requests parked in get_connection right now; a sustained non-zero value
+  /// means the pool is exhausted.
+  std::size_t requests_waiting{0u};
+
+  std::uint64_t requests_started{0u};
+  std::uint64_t bytes_read{0u};
+  std::uint64_t bytes_written{0u};
+  std::uint64_t handshakes{0u};
+  std::uint64_t keep_alive_closes{0u};
+
+  pool_stats & operator+=(const pool_stats & rhs)
+  {
+    connections_open  += rhs.connections_open;
+    connections_idle  += rhs.connections_idle;
+    connecting        += rhs.connecting;
+    requests_waiting  += rhs.requests_waiting;
+    requests_started  += rhs.requests_started;
+    bytes_read        += rhs.bytes_read;
+    bytes_written     += rhs.bytes_written;
+    handshakes        += rhs.handshakes;
+    keep_alive_closes += rhs.keep_alive_closes;
+    return *this;
+  }
+};
+
+/// One entry of a request batch, see basic_connection_pool::async_request_batch.
+/// The target and body are views; the caller keeps them alive until the batch
+/// completes.
+struct batch_request
+{
+  beast::http::verb method = beast::http::verb::get;
+  urls::url_view target;
+  core::string_view body;
+};
+
 template<typename Stream>
 struct basic_connection_pool : detail::ssl_base<detail::has_ssl_v<Stream>>
 {
@@ -121,8 +363,8 @@ struct basic_connection_pool : detail::ssl_base<detail::has_ssl_v<Stream>>
     /// The endpoint of the lowest lowest layer.
     using endpoint_type = typename connection_type::endpoint_type;
 
-    /// The reolver_type of the lower layer.
-    using resolver_type = typename protocol_type::resolver::template rebind_executor<executor_type>::other;
+    /// The reolver_type of the lower layer; `void` for protocols without one.
+    using resolver_type = typename detail::resolver_of<protocol_type, executor_type>::type;
 
     /// Construct a stream.
     /**
@@ -156,10 +398,45 @@ struct basic_connection_pool : detail::ssl_base<detail::has_ssl_v<Stream>>
         : detail::ssl_base<detail::has_ssl_v<Stream>>(lhs),
           mutex_(std::move(lhs.mutex_)),
           host_(std::move(lhs.host_)),
+          proxy_host_(std::move(lhs.proxy_host_)),
+          proxy_service_(std::move(lhs.proxy_service_)),
+          tunnel_target_(std::move(lhs.tunnel_target_)),
+          alt_host_(std::move(lhs.alt_host_)),
+          alt_service_(std::move(lhs.alt_service_)),
+          alt_authority_(std::move(lhs.alt_authority_)),
           endpoints_(std::move(lhs.endpoints_)),
           limit_(lhs.limit_),
-          conns_(std::move(lhs.conns_))
-    {}
+          conns_(std::move(lhs.conns_)),
+          metrics_(std::move(lhs.metrics_)),
+          idle_hint_(std::move(lhs.idle_hint_)),
+          use_seq_(lhs.use_seq_.load()),
+          dns_cache_(lhs.dns_cache_)
+    {
+      waiters_->discipline = lhs.waiters_->discipline;
+      socket_options_ = lhs.socket_options_;
+      trace_hook_ = lhs.trace_hook_;
+      conn_budget_ = lhs.conn_budget_;
+      last_use_ = lhs.last_use_.load();
+      // the breaker keeps its settings but starts out closed, like the
+      // ssl session cache it refills from actual traffic
+      breaker_threshold_ = lhs.breaker_threshold_;
+      breaker_cooldown_ = lhs.breaker_cooldown_;
+      // the connections moved over must not keep pointing at lhs' buffers
+      for (auto & conn : conns_)
+      {
+        conn.second->set_buffer_pool(&buffer_pool_);
+        conn.second->set_metrics(&metrics_);
+        conn.second->set_idle_listener(waiters_.get());
+        conn.second->set_trace_hook(trace_hook_);
+      }
+    }
+
+    ~basic_connection_pool()
+    {
+      // hand the sockets' budget units back, see set_conn_budget - the
+      // connections themselves close through their own destructors.
+      budget_release_(conns_.size());
+    }
 
     void lookup(urls::authority_view av)
     {
@@ -170,6 +447,16 @@ struct basic_connection_pool : detail::ssl_base<detail::has_ssl_v<Stream>>
     }
     void lookup(urls::authority_view sv, system::error_code & ec);
 
+    /// Pin the pool to a fixed endpoint instead of resolving one - the entry
+    /// point for protocols without a name, i.e. unix domain sockets. `host`
+    /// is what the connections put on the wire as Host. Like the other
+    /// setters this must precede handing out connections.
+    void set_endpoint(endpoint_type ep, core::string_view host = "localhost")
+    {
+      host_.assign(host.begin(), host.end());
+      endpoints_.assign(1u, std::move(ep));
+    }
+
     template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code)) CompletionToken
                   BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
     BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken,
@@ -181,8 +468,225 @@ struct basic_connection_pool : detail::ssl_base<detail::has_ssl_v<Stream>>
     std::size_t limit() const {return limit_;}
     std::size_t active() const {return conns_.size();}
 
+    /// Share a resolver cache (usually the owning session's) with this pool.
+    void set_dns_cache(resolver_cache * cache) {dns_cache_ = cache;}
+
+    /// Route every connection of this pool through an HTTP CONNECT proxy.
+    /// The pool then resolves and dials the proxy and each new connection
+    /// establishes the tunnel once, right after the TCP connect -- so the
+    /// tunnel (and for https the TLS handshake through it) is paid per
+    /// connection, not per request, and tunneled connections are pooled and
+    /// reused like direct ones. Must be set before lookup().
+    void set_proxy(urls::authority_view av)
+    {
+      proxy_host_.assign(av.encoded_host_name().begin(), av.encoded_host_name().end());
+      const core::string_view service = av.has_port()
+          ? core::string_view(av.port()) : core::string_view("http");
+      proxy_service_.assign(service.begin(), service.end());
+    }
+
+    /// Dial an alternative service (RFC 7838 Alt-Svc) instead of the origin:
+    /// lookup() resolves and connects to `av`, while every connection keeps
+    /// carrying the origin, so Host, SNI and the certificate check still
+    /// name it - which is what makes honoring the advertisement safe.
+    /// Ignored while a proxy is set; the proxy dials whatever the CONNECT
+    /// target says. Must be set before lookup().
+    void set_alt_svc(urls::authority_view av)
+    {
+      alt_host_.assign(av.encoded_host_name().begin(), av.encoded_host_name().end());
+      const core::string_view service = av.has_port()
+          ? core::string_view(av.port())
+          : core::string_view(detail::has_ssl_v<Stream> ? "https" : "http");
+      alt_service_.assign(service.begin(), service.end());
+      alt_authority_ = alt_host_;
+      if (av.has_port())
+      {
+        alt_authority_ += ':';
+        alt_authority_.append(service.begin(), service.end());
+      }
+    }
+
+    /// The alternative this pool dials, empty when it dials the origin.
+    core::string_view alt_svc() const {return alt_authority_;}
+
+    /// Share a session-wide socket budget with this pool, see
+    /// detail::conn_budget: every pooled connection holds one unit, and a
+    /// dial that finds the budget exhausted falls back to sharing an
+    /// existing connection after the budget's reclaim had its chance.
+    /// Like the other setters this must precede handing out connections.
+    void set_conn_budget(detail::conn_budget * budget) { conn_budget_ = budget; }
+
+    /// Close up to n idle connections, least recently used first; returns
+    /// how many were closed. The reclamation primitive behind the session's
+    /// connection budget. Uses try_lock - a busy pool reclaims nothing
+    /// rather than deadlocking with a pool that is reclaiming towards us.
+    std::size_t reclaim_idle(std::size_t n)
+    {
+      if (!mutex_.try_lock())
+        return 0u;
+      asem::lock_guard<detail::basic_mutex<executor_type>> lock{mutex_, std::adopt_lock};
+      std::size_t closed = 0u;
+      while (closed < n)
+      {
+        auto victim = conns_.end();
+        for (auto itr = conns_.begin(); itr != conns_.end(); ++itr)
+          if (itr->second->working_requests() == 0u
+              && (victim == conns_.end() || itr->second->use_stamp() < victim->second->use_stamp()))
+            victim = itr;
+        if (victim == conns_.end())
+          break;
+        system::error_code ign;
+        victim->second->close(ign);
+        conns_.erase(victim);
+        budget_release_();
+        closed++;
+      }
+      return closed;
+    }
+
+    /// When this pool last handed out a connection, as a steady_clock tick
+    /// count; how the session orders its pools for reclamation.
+    std::chrono::steady_clock::duration::rep last_use() const
+    {
+      return last_use_.load(std::memory_order_relaxed);
+    }
+
+    /// Pick what happens to requests that arrive while the pool is at its
+    /// limit and every connection is busy. `share` pipelines onto the least
+    /// used connection right away, which is the historic behavior and cannot
+    /// deadlock, but interleaves responses on a shared connection. `fifo`
+    /// and `lifo` instead park the request and hand it the next connection
+    /// that goes idle - fifo oldest-first for fairness, lifo newest-first
+    /// for tail latency. Within the parked queue a higher
+    /// request_options::priority is always served first, and exactly one
+    /// waiter is woken per connection going idle. Only asynchronous requests
+    /// park; the blocking get_connection always shares.
+    void set_queue_discipline(queue_discipline d) { waiters_->discipline = d; }
+    queue_discipline get_queue_discipline() const { return waiters_->discipline; }
+
+    /// The profile applied to every pool socket between open and connect
+    /// (TCP_NODELAY et al, see socket_options). Connections already dialed
+    /// keep their options; set it before the first request.
+    void set_socket_options(const socket_options & opts)
+    {
+      socket_options_ = opts;
+    }
+    const socket_options & get_socket_options() const
+    {
+      return socket_options_;
+    }
+
+    /// Install a span receiver handed down to every connection; inert
+    /// unless compiled with BOOST_REQUESTS_ENABLE_TRACE, see trace_hook.
+    void set_trace_hook(trace_hook * hook)
+    {
+      trace_hook_ = hook;
+      for (auto & conn : conns_)
+        conn.second->set_trace_hook(hook);
+    }
+
+    /// Fail fast while the upstream is down instead of walking resolve,
+    /// connect and timeout for every request: once `threshold` request
+    /// failures accumulate in a row the circuit opens and new requests
+    /// fail immediately with error::circuit_open. After `cooldown` the
+    /// next request is let through as a half-open probe; its success
+    /// closes the circuit again, its failure buys another cooldown. A
+    /// threshold of zero (the default) disables the breaker.
+    void set_circuit_breaker(std::size_t threshold,
+                             std::chrono::milliseconds cooldown = std::chrono::seconds(30))
+    {
+      breaker_threshold_ = threshold;
+      breaker_cooldown_ = cooldown;
+      if (threshold == 0u)
+      {
+        breaker_failures_.store(0u, std::memory_order_relaxed);
+        breaker_state_.store(0, std::memory_order_release);
+      }
+    }
+
+    /// Sample the pool's runtime counters. The connection-list gauges are
+    /// read under the pool mutex, the monotonic counters as relaxed loads.
+    pool_stats stats()
+    {
+      pool_stats st;
+      st.requests_waiting  = metrics_.requests_waiting.load(std::memory_order_relaxed);
+      st.requests_started  = metrics_.requests_started.load(std::memory_order_relaxed);
+      st.bytes_read        = metrics_.bytes_read.load(std::memory_order_relaxed);
+      st.bytes_written     = metrics_.bytes_written.load(std::memory_order_relaxed);
+      st.handshakes        = metrics_.handshakes.load(std::memory_order_relaxed);
+      st.keep_alive_closes = metrics_.keep_alive_closes.load(std::memory_order_relaxed);
+
+      system::error_code ec;
+      auto lock = asem::lock(mutex_, ec);
+      if (ec)
+        return st;
+      st.connections_open = conns_.size();
+      st.connecting       = connecting_;
+      for (const auto & conn : conns_)
+        if (conn.second->working_requests() == 0u)
+          st.connections_idle++;
+      return st;
+    }
+
+    /// The per-endpoint dial quality learned so far - (endpoint, connect
+    /// EWMA in ms, failure EWMA) - read under the pool mutex, for
+    /// basic_session::save_state.
+    std::vector<std::tuple<endpoint_type, double, double>> endpoint_quality()
+    {
+      std::vector<std::tuple<endpoint_type, double, double>> res;
+      system::error_code ec;
+      auto lock = asem::lock(mutex_, ec);
+      if (ec)
+        return res;
+      res.reserve(endpoint_scores_.size());
+      for (const auto & sc : endpoint_scores_)
+        res.emplace_back(sc.first, sc.second.connect_ms, sc.second.failure);
+      return res;
+    }
+
+    /// Seed the adaptive dial order with quality data from a warm-state
+    /// snapshot, see basic_session::restore_state. Meant for a pool that
+    /// has not been handed out yet; the seeded scores then update like
+    /// locally learned ones.
+    void import_endpoint_quality(const endpoint_type & ep, double connect_ms, double failure)
+    {
+      auto & sc = endpoint_scores_[ep];
+      sc.connect_ms = connect_ms;
+      sc.failure = failure;
+    }
+
     using request_type = request_settings;
 
+    /// Close every idle connection right away and report how much work is
+    /// still in flight - busy connections, dials underway and requests
+    /// parked for a connection. The drain primitive behind
+    /// basic_session::async_drain: called repeatedly, it closes connections
+    /// the moment they go idle and reaches zero once the pool is quiet.
+    std::size_t close_idle()
+    {
+      system::error_code ec;
+      auto lock = asem::lock(mutex_, ec);
+      if (ec)
+        return 0u;
+      std::size_t busy = 0u;
+      for (auto itr = conns_.begin(); itr != conns_.end();)
+      {
+        auto & conn = itr->second;
+        if (conn->is_open() && conn->working_requests() > 0u)
+        {
+          busy++;
+          itr++;
+          continue;
+        }
+        system::error_code ign;
+        conn->close(ign);
+        itr = conns_.erase(itr);
+        budget_release_();
+      }
+      return busy + connecting_
+           + metrics_.requests_waiting.load(std::memory_order_relaxed);
+    }
+
     std::shared_ptr<connection_type> get_connection(error_code & ec);
     std::shared_ptr<connection_type> get_connection()
     {
@@ -197,6 +701,41 @@ struct basic_connection_pool : detail::ssl_base<detail::has_ssl_v<Stream>>
     BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code, std::shared_ptr<connection_type>))
       async_get_connection(CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
 
+    /// As above, but with the waiter's priority class should the pool be
+    /// saturated and parking, see set_queue_discipline.
+    template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code, std::shared_ptr<connection_type>)) CompletionToken>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code, std::shared_ptr<connection_type>))
+      async_get_connection(std::uint8_t priority,
+                           CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
+
+    /// Sweep the pool every `interval`: idle connections that would reach
+    /// their keep-alive deadline before the next sweep are closed while it is
+    /// still cheap, and the remaining idle connections are trimmed down to
+    /// `floor`, least recently used first. Runs until stop_reaper is called
+    /// or the pool is destroyed.
+    void start_reaper(std::chrono::milliseconds interval = std::chrono::seconds(15),
+                      std::size_t floor = 1u)
+    {
+      reap_interval_ = interval;
+      reap_floor_ = floor;
+      arm_reaper_();
+    }
+
+    /// Stop the sweep started by start_reaper.
+    void stop_reaper()
+    {
+      reap_interval_ = std::chrono::milliseconds::zero();
+      reap_timer_.cancel();
+    }
+
+    /// Establish connections until `n` (capped by the limit) are held,
+    /// dialing the missing ones concurrently. Requires a preceding lookup.
+    template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code)) CompletionToken
+                  BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code))
+      async_prewarm(std::size_t n,
+                    CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
+
     template<typename RequestBody>
     auto ropen(beast::http::verb method,
                urls::url_view path,
@@ -204,14 +743,28 @@ struct basic_connection_pool : detail::ssl_base<detail::has_ssl_v<Stream>>
                request_settings req,
                system::error_code & ec) -> typename connection_type::stream
     {
+      if (!breaker_admit_())
+      {
+        BOOST_REQUESTS_ASSIGN_EC(ec, error::circuit_open);
+        return typename connection_type::stream{get_executor(), nullptr};
+      }
+      if (req.opts.timings)
+        req.opts.timings->pool_queued = timing::clock_type::now();
       auto conn = get_connection(ec);
+      if (req.opts.timings)
+        req.opts.timings->connection_acquired = timing::clock_type::now();
       if (!ec && conn == nullptr)
         BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
       if (ec)
+      {
+        breaker_report_(false);
         return typename connection_type::stream{get_executor(), nullptr};
+      }
 
       assert(conn != nullptr);
-      return conn->ropen(method, path, std::forward<RequestBody>(body), std::move(req), ec);
+      auto res = conn->ropen(method, path, std::forward<RequestBody>(body), std::move(req), ec);
+      breaker_report_(!ec);
+      return res;
     }
 
     template<typename RequestBody>
@@ -233,14 +786,40 @@ struct basic_connection_pool : detail::ssl_base<detail::has_ssl_v<Stream>>
                cookie_jar * jar,
                system::error_code & ec) -> stream
     {
-      auto conn = get_connection(ec);
-      if (!ec && conn == nullptr)
-        BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
-      if (ec)
+      if (!breaker_admit_())
+      {
+        BOOST_REQUESTS_ASSIGN_EC(ec, error::circuit_open);
         return typename connection_type::stream{get_executor(), nullptr};
+      }
+      for (std::size_t attempt = 0u;; attempt++)
+      {
+        if (opt.timings)
+          opt.timings->pool_queued = timing::clock_type::now();
+        auto conn = get_connection(ec);
+        if (opt.timings)
+          opt.timings->connection_acquired = timing::clock_type::now();
+        if (!ec && conn == nullptr)
+          BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
+        if (ec)
+        {
+          breaker_report_(false);
+          return typename connection_type::stream{get_executor(), nullptr};
+        }
 
-      assert(conn != nullptr);
-      return conn->ropen(req, opt, jar, ec);
+        assert(conn != nullptr);
+        auto res = conn->ropen(req, opt, jar, ec);
+        if (!detail::may_retry_request(ec, req.method(), opt, attempt))
+        {
+          breaker_report_(!ec);
+          return res;
+        }
+
+        // the keep-alive connection was stale; the request is already built,
+        // so a retry only costs acquiring the next pooled connection.
+        if (opt.retry_backoff.count() > 0)
+          std::this_thread::sleep_for(detail::retry_delay(opt, attempt));
+        ec.clear();
+      }
     }
 
     template<typename RequestBody>
@@ -281,20 +860,324 @@ struct basic_connection_pool : detail::ssl_base<detail::has_ssl_v<Stream>>
                 cookie_jar * jar = nullptr,
                 CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
 
+    /// Run every entry of `items` over this pool and complete once with the
+    /// responses in item order. The items get distributed across up to
+    /// limit() connections, each worker holding its connection for the whole
+    /// batch, with the shared state allocated once up front - so pool and
+    /// allocator overhead is paid per batch, not per request. `req` applies
+    /// to every item. A failed item doesn't stop the rest: the first error
+    /// is reported and the failed slots stay default-constructed.
+    template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, std::vector<response>)) CompletionToken
+                  BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code, std::vector<response>))
+    async_request_batch(span<const batch_request> items,
+                        request_settings req,
+                        CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
+
+    /// The stream released by upgrade(), see basic_connection::websocket_type.
+    using websocket_type = typename connection_type::websocket_type;
+
+    /// Open a WebSocket over a pooled connection: the upgrade handshake runs
+    /// on an established (and for https, already handshaken) transport, so
+    /// only the upgrade round trip itself is paid. The connection hands its
+    /// socket to the returned stream and leaves the pool; a replacement is
+    /// dialed in the background.
+    websocket_type upgrade(urls::url_view path,
+                           http::fields headers,
+                           cookie_jar * jar,
+                           system::error_code & ec);
+
+    websocket_type upgrade(urls::url_view path,
+                           http::fields headers = http::fields(),
+                           cookie_jar * jar = nullptr)
+    {
+      boost::system::error_code ec;
+      auto res = upgrade(path, std::move(headers), jar, ec);
+      if (ec)
+        throw_exception(system::system_error(ec, "upgrade"));
+      return res;
+    }
+
+    template<typename CompletionToken
+                 BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken,
+                                       void (boost::system::error_code,
+                                             typename basic_connection_pool<Stream>::websocket_type))
+    async_upgrade(urls::url_view path,
+                  http::fields headers = http::fields(),
+                  cookie_jar * jar = nullptr,
+                  CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
+
     using stream = typename connection_type::stream;
   private:
     detail::basic_mutex<executor_type> mutex_;
     std::string host_;
+    std::string proxy_host_, proxy_service_;
+    // "host:port" handed to every connection; empty without a proxy.
+    std::string tunnel_target_;
+    // the alternative service resolved in place of the origin, see
+    // set_alt_svc; empty when the pool dials the origin itself.
+    std::string alt_host_, alt_service_, alt_authority_;
     std::vector<endpoint_type> endpoints_;
     std::size_t limit_;
     std::size_t connecting_{0u};
 
+    // Adaptive dial order, learned from every dial (see rank_endpoints_):
+    // moving averages of connect time and failure rate per endpoint, so new
+    // connections try the close, healthy records first instead of whatever
+    // order the resolver returned. Entries survive a DNS refresh; addresses
+    // that drop out of the answer just stop being looked up.
+    struct endpoint_score_
+    {
+      double connect_ms{0.};    // EWMA of successful connect time
+      double failure{0.};       // EWMA of 0/1 dial outcomes
+      std::size_t last_dial{0u}; // dial_round_ stamp, for exploration
+    };
+    boost::unordered_map<endpoint_type, endpoint_score_,
+                         detail::endpoint_hash<endpoint_type>> endpoint_scores_;
+    std::size_t dial_round_{0u};
+
+    // an unmeasured endpoint scores best, so it gets dialed and measured;
+    // a failing one is as unattractive as a consistently-slow one.
+    double dial_score_(const endpoint_type & ep) const
+    {
+      const auto itr = endpoint_scores_.find(ep);
+      if (itr == endpoint_scores_.end())
+        return 0.;
+      return itr->second.connect_ms + itr->second.failure * 1000.;
+    }
+
+    void rank_endpoints_();
+    void note_dial_(const std::shared_ptr<connection_type> & conn,
+                    std::chrono::steady_clock::time_point started,
+                    const system::error_code & ec,
+                    bool sequential);
+
     boost::unordered_multimap<endpoint_type,
                               std::shared_ptr<connection_type>,
                               detail::endpoint_hash<endpoint_type>> conns_;
 
+    // Staging buffers are checked out of here per response and returned
+    // after, shared by all connections, so memory follows the working set
+    // instead of each connection's high-water mark.
+    detail::buffer_pool buffer_pool_;
+
+    // shared with every connection of the pool, see stats()
+    detail::pool_metrics metrics_;
+
+    // handed to every connection before its first dial, see set_socket_options
+    socket_options socket_options_;
+
+    // handed to every connection, see set_trace_hook
+    trace_hook * trace_hook_ = nullptr;
+
+    // session-wide socket budget, see set_conn_budget. One unit per conns_
+    // entry: acquired when a new connection is dialed, released when the
+    // entry is erased. A pool without a budget is unconstrained.
+    detail::conn_budget * conn_budget_ = nullptr;
+
+    bool budget_acquire_(bool first)
+    {
+      if (conn_budget_ == nullptr)
+        return true;
+      if (first) // the first socket of a pool is never refused
+      {
+        conn_budget_->acquire();
+        return true;
+      }
+      return conn_budget_->try_acquire(this);
+    }
+    void budget_release_(std::size_t n = 1u)
+    {
+      if (conn_budget_ != nullptr && n > 0u)
+        conn_budget_->release(n);
+    }
+
+    // Circuit breaker, see set_circuit_breaker: 0 closed, 1 open, 2 probing
+    // half-open. All lock-free, so the closed steady state costs one
+    // relaxed load on the request path.
+    std::size_t breaker_threshold_{0u};
+    std::chrono::milliseconds breaker_cooldown_{std::chrono::seconds(30)};
+    std::atomic<int> breaker_state_{0};
+    std::atomic<std::size_t> breaker_failures_{0u};
+    std::atomic<std::chrono::steady_clock::duration::rep> breaker_open_until_{0};
+
+    // whether a request may proceed; a true return while half-open makes
+    // this request the probe, its outcome (breaker_report_) decides.
+    bool breaker_admit_()
+    {
+      if (breaker_threshold_ == 0u)
+        return true;
+      int st = breaker_state_.load(std::memory_order_acquire);
+      if (st == 0)
+        return true;
+      if (st == 1)
+      {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+        if (now < breaker_open_until_.load(std::memory_order_acquire))
+          return false;
+        // the cooldown is over - exactly one request wins the probe slot
+        int expected = 1;
+        if (breaker_state_.compare_exchange_strong(expected, 2, std::memory_order_acq_rel))
+          return true;
+        st = expected;
+      }
+      return st == 0;
+    }
+
+    void breaker_report_(bool success)
+    {
+      if (breaker_threshold_ == 0u)
+        return;
+      if (success)
+      {
+        breaker_failures_.store(0u, std::memory_order_relaxed);
+        breaker_state_.store(0, std::memory_order_release);
+        return;
+      }
+      const auto n = breaker_failures_.fetch_add(1u, std::memory_order_relaxed) + 1u;
+      if (n >= breaker_threshold_
+          || breaker_state_.load(std::memory_order_acquire) == 2)
+      {
+        breaker_open_until_.store(
+            (std::chrono::steady_clock::now() + breaker_cooldown_).time_since_epoch().count(),
+            std::memory_order_release);
+        breaker_state_.store(1, std::memory_order_release);
+      }
+    }
+
+    using waiter_token_ = requests::detail::co_token_t<void(system::error_code)>;
+    struct waiter_
+    {
+      std::uint8_t priority;
+      std::uint64_t seq;
+      waiter_token_ token;
+    };
+
+    // Requests parked by async_get_connection until a connection goes idle,
+    // see set_queue_discipline. Heap-allocated so the connections keep a
+    // stable idle_listener across pool moves; guarded by a plain mutex of
+    // its own because on_idle fires from the stream's destructor, which may
+    // run on any thread and must not take the pool's asem mutex.
+    struct waiter_queue_ final : detail::idle_listener
+    {
+      explicit waiter_queue_(executor_type exec) : exec(std::move(exec)) {}
+
+      executor_type exec;
+      std::mutex mtx;
+      queue_discipline discipline = queue_discipline::share;
+      std::uint64_t seq = 0u;
+      std::vector<waiter_> waiters;
+
+      void park(std::uint8_t priority, waiter_token_ token)
+      {
+        std::lock_guard<std::mutex> lock{mtx};
+        waiters.push_back(waiter_{priority, seq++, std::move(token)});
+      }
+
+      void on_idle() override
+      {
+        waiter_token_ token;
+        {
+          std::lock_guard<std::mutex> lock{mtx};
+          if (waiters.empty())
+            return;
+          // highest priority first; ties broken by age per the discipline.
+          auto itr = waiters.begin();
+          for (auto c = itr + 1; c != waiters.end(); c++)
+          {
+            if (c->priority != itr->priority)
+            {
+              if (c->priority > itr->priority)
+                itr = c;
+              continue;
+            }
+            if (discipline == queue_discipline::lifo ? c->seq > itr->seq
+                                                     : c->seq < itr->seq)
+              itr = c;
+          }
+          token = std::move(itr->token);
+          waiters.erase(itr);
+        }
+        // wake exactly this one waiter; it re-checks the pool under the pool
+        // mutex. Never invoke the token inline - we may be in a destructor.
+        asio::post(exec, asio::append(std::move(token), system::error_code{}));
+      }
+    };
+
+    std::unique_ptr<waiter_queue_> waiters_{new waiter_queue_(mutex_.get_executor())};
+
+    // The connection most recently seen idle, maintained with the std::atomic_*
+    // shared_ptr operations. Steady-state acquisition reads this without taking
+    // mutex_ or scanning conns_; the locked path below remains the slow path.
+    std::shared_ptr<connection_type> idle_hint_;
+
+    std::shared_ptr<connection_type> try_idle_hint_()
+    {
+      auto hint = std::atomic_load_explicit(&idle_hint_, std::memory_order_acquire);
+      // appears_stale covers is_open plus the server side of liveness - a
+      // keep-alive deadline passed or a FIN pending - for one recv's worth
+      // of work; see basic_connection::appears_stale.
+      if (hint && hint->working_requests() == 0u
+          && !hint->near_keep_alive_limit()
+          && !hint->appears_stale())
+        return hint;
+      return nullptr;
+    }
+
+    void set_idle_hint_(const std::shared_ptr<connection_type> & conn)
+    {
+      std::atomic_store_explicit(&idle_hint_, conn, std::memory_order_release);
+    }
+
+    // Hand-out recency for the most-recently-used-first free-connection
+    // order, see basic_connection::use_stamp. Atomic because the lock-free
+    // hint path stamps, too.
+    std::atomic<std::uint64_t> use_seq_{0u};
+
+    void stamp_used_(const std::shared_ptr<connection_type> & conn)
+    {
+      conn->mark_used(use_seq_.fetch_add(1u, std::memory_order_relaxed) + 1u);
+      last_use_.store(std::chrono::steady_clock::now().time_since_epoch().count(),
+                      std::memory_order_relaxed);
+    }
+
+    // When the pool last handed out a connection - unlike use_seq_ this is
+    // wall-time, so the session can order its pools across pool boundaries
+    // for budget reclamation, see reclaim_idle.
+    std::atomic<std::chrono::steady_clock::duration::rep> last_use_{0};
+
+    resolver_cache * dns_cache_ = nullptr;
+
+    void refresh_dns_(std::string host, std::string service);
+
+    // Re-point host_/tunnel_target_ at the origin after a proxy resolution,
+    // see lookup. Requires mutex_.
+    void apply_tunnel_(urls::authority_view sv);
+
+    // Re-point host_ at the origin after resolving an alternative service,
+    // see set_alt_svc. Requires mutex_.
+    void apply_alt_(urls::authority_view sv);
+
+    // idle sweep, see start_reaper. An interval of zero means "not running".
+    asio::basic_waitable_timer<std::chrono::steady_clock,
+                               asio::wait_traits<std::chrono::steady_clock>,
+                               executor_type> reap_timer_{mutex_.get_executor()};
+    std::chrono::milliseconds reap_interval_{0};
+    std::size_t reap_floor_{0u};
+
+    void arm_reaper_();
+    void reap_(std::chrono::system_clock::time_point now); // requires mutex_
+
+    // Close idle connections one request short of their advertised
+    // `Keep-Alive: max=` budget, see get_connection. Returns how many were
+    // retired so the caller can dial replacements. Requires mutex_.
+    std::size_t retire_exhausted_();
+
     struct async_lookup_op;
     struct async_get_connection_op;
+    struct async_prewarm_op;
+    struct async_upgrade_op;
 
     template<typename>
     struct async_ropen_op;
@@ -310,8 +1193,13 @@ template<typename Executor = asio::any_io_executor>
 using basic_https_connection_pool = basic_connection_pool<asio::ssl::stream<asio::basic_stream_socket<asio::ip::tcp, Executor>>>;
 
 
+template<typename Executor = asio::any_io_executor>
+using basic_unix_connection_pool  = basic_connection_pool<asio::basic_stream_socket<asio::local::stream_protocol, Executor>>;
+
+
 using http_connection_pool  = basic_http_connection_pool<>;
 using https_connection_pool = basic_https_connection_pool<>;
+using unix_connection_pool  = basic_unix_connection_pool<>;
 
 
 #if !defined(BOOST_REQUESTS_HEADER_ONLY)
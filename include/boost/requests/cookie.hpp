@@ -121,6 +121,40 @@ auto make_cookie_field(Range && range, StringToken && token = {})
     return token.result();
 }
 
+// Serializes into storage drawn from a caller-provided memory resource.
+// Handed a request's own header allocator, an arena-backed request (see
+// request_options::use_arena) builds its Cookie value without touching
+// the heap, and the scratch is released together with the block.
+struct resource_token : urls::grammar::string_token::arg
+{
+  container::pmr::memory_resource * res;
+
+  char * data = nullptr;
+  std::size_t size = 0u;
+
+  explicit resource_token(container::pmr::memory_resource * res) : res(res) {}
+  resource_token(const resource_token &) = delete;
+  ~resource_token()
+  {
+    if (data != nullptr)
+      res->deallocate(data, size, 1u);
+  }
+
+  using result_type = core::string_view;
+
+  char * prepare(std::size_t size_)
+  {
+    if (size_ == 0u)
+      return nullptr;
+    return data = static_cast<char*>(res->allocate(size = size_, 1u));
+  }
+
+  core::string_view result() const
+  {
+    return core::string_view(data, size);
+  }
+};
+
 struct monotonic_token : urls::grammar::string_token::arg
 {
   unsigned char buf[4096];
@@ -6,8 +6,11 @@
 #define BOOST_REQUESTS_COOKIES_JAR_HPP
 
 #include <boost/container/pmr/polymorphic_allocator.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/range/adaptor/indirected.hpp>
 #include <boost/requests/fields/set_cookie.hpp>
 #include <boost/requests/cookie.hpp>
+#include <boost/requests/http.hpp>
 #include <boost/requests/public_suffix.hpp>
 #include <boost/unordered_map.hpp>
 #include <boost/unordered_set.hpp>
@@ -15,7 +18,9 @@
 #include <boost/url/parse_path.hpp>
 #include <boost/url/parse_path.hpp>
 #include <boost/url/pct_string_view.hpp>
+#include <algorithm>
 #include <chrono>
+#include <vector>
 
 #include <boost/beast/http/message.hpp>
 #include <boost/container/pmr/polymorphic_allocator.hpp>
@@ -55,10 +60,13 @@ struct cookie_equal
 struct cookie_jar final
 {
     using allocator_type = boost::container::pmr::polymorphic_allocator<char>;
+    // Modify through set() & drop_expired(); get() relies on the domain
+    // index below staying in sync with this set.
     boost::unordered_set<cookie, cookie_hash, cookie_equal,
                          typename std::allocator_traits<allocator_type>::template rebind_alloc<cookie>> content;
 
-    cookie_jar(allocator_type allocator = {}) : content(std::move(allocator)) {}
+    cookie_jar(allocator_type allocator = {})
+        : content(allocator), index_(allocator), heap_(std::move(allocator)) {}
 
     BOOST_REQUESTS_DECL bool set(const set_cookie & set,
              core::string_view request_host,
@@ -66,6 +74,19 @@ struct cookie_jar final
              urls::pct_string_view request_uri_path = "/",
              const public_suffix_list & public_suffixes = default_public_suffix_list());
 
+    /// Ingest every Set-Cookie field of a response header in one pass.
+    /// The request host is normalized to lower case once into a
+    /// stack-backed arena and all fields are parsed - into views, nothing
+    /// is copied - before the jar is touched, so a malformed field sets
+    /// `ec` and rejects the whole batch without storing anything.
+    /// Returns the number of cookies stored.
+    BOOST_REQUESTS_DECL std::size_t set_all(const http::fields & fields,
+             core::string_view request_host,
+             system::error_code & ec,
+             bool from_non_http_api = false,
+             urls::pct_string_view request_uri_path = "/",
+             const public_suffix_list & public_suffixes = default_public_suffix_list());
+
     template<typename StringToken = urls::string_token::return_string>
     auto get(core::string_view request_host,
              bool is_secure = false,
@@ -74,26 +95,148 @@ struct cookie_jar final
         -> typename std::decay_t<StringToken>::result_type
     {
         auto nw = std::chrono::system_clock::now();
-        return detail::make_cookie_field(
-                adaptors::filter(
-                    content,
-                    [&](const cookie & ck)
-                    {
-                        return (is_secure || !ck.secure_only_flag) &&
-                               (ck.expiry_time > nw) &&
-                               (ck.host_only_flag ? (request_host == ck.domain) : domain_match(request_host, ck.domain)) &&
-                               path_match(request_uri_path, ck.path);
-                    }), static_cast<StringToken&>(token));
+
+        // only the label suffixes of the request host can hold matching
+        // cookies, so visit those buckets instead of scanning the jar.
+        container::small_vector<const cookie *, 16u> candidates;
+        for (core::string_view dom = request_host;;)
+        {
+          const auto er = index_.equal_range(domain_hash_(dom));
+          for (auto itr = er.first; itr != er.second; itr++)
+          {
+            const cookie & ck = *itr->second;
+            if (core::string_view(ck.domain.data(), ck.domain.size()) == dom && // bucket collision
+                (is_secure || !ck.secure_only_flag) &&
+                (ck.expiry_time > nw) &&
+                (ck.host_only_flag ? (request_host == ck.domain) : domain_match(request_host, ck.domain)) &&
+                path_match(request_uri_path, ck.path))
+              candidates.push_back(&ck);
+          }
+          const auto dot = dom.find('.');
+          if (dot == core::string_view::npos)
+            break;
+          dom.remove_prefix(dot + 1u);
+        }
+
+        // the buckets don't guarantee an order, so fix one: newest cookie
+        // first, which is what the previous head-inserting container produced.
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const cookie * lhs, const cookie * rhs)
+                  {
+                    return lhs->creation_time > rhs->creation_time;
+                  });
+
+        return detail::make_cookie_field(adaptors::indirect(candidates),
+                                         static_cast<StringToken&>(token));
+    }
+
+    /// Set the Cookie field of an outgoing request straight out of the
+    /// jar: the matching cookies are serialized into scratch drawn from
+    /// the request's own header allocator, so an arena-backed request
+    /// (see request_options::use_arena) builds the field without a heap
+    /// allocation or an intermediate string. Returns whether anything
+    /// matched; the field is left untouched otherwise.
+    bool append_to(http::fields & flds,
+                   core::string_view request_host,
+                   bool is_secure = false,
+                   urls::pct_string_view request_uri_path = "/") const
+    {
+      detail::resource_token tk{flds.get_allocator().resource()};
+      const auto cc = get(request_host, is_secure, request_uri_path, tk);
+      if (cc.empty())
+        return false;
+      flds.set(http::field::cookie, cc);
+      return true;
     }
 
     BOOST_REQUESTS_DECL void drop_expired(const std::chrono::system_clock::time_point nw = std::chrono::system_clock::now());
+
+    /// Drop every expired cookie through the expiry heap: pops until the
+    /// soonest expiry lies in the future, without scanning the jar. set()
+    /// already purges a few entries per call, so calling this is only
+    /// needed to reclaim memory eagerly.
+    BOOST_REQUESTS_DECL void purge_expired(const std::chrono::system_clock::time_point nw = std::chrono::system_clock::now());
+
+    /// Serialize the persistent cookies into a compact binary snapshot.
+    /// Session cookies are not written, as per rfc6265 they do not survive
+    /// a restart.
+    BOOST_REQUESTS_DECL std::string save() const;
+
+    /// Restore a snapshot produced by save() into this jar, e.g. from a
+    /// memory-mapped file. Cookies that expired since the snapshot was taken
+    /// are skipped. Returns false without touching the jar if the data is
+    /// not a snapshot of a supported version or is truncated.
+    BOOST_REQUESTS_DECL bool load(core::string_view data);
+
+  private:
+    static std::size_t domain_hash_(core::string_view domain)
+    {
+      return hash_range(domain.begin(), domain.end());
+    }
+
+    void erase_index_(const cookie * ck)
+    {
+      auto er = index_.equal_range(domain_hash_(core::string_view(ck->domain.data(), ck->domain.size())));
+      for (auto itr = er.first; itr != er.second; itr++)
+        if (itr->second == ck)
+        {
+          index_.erase(itr);
+          return;
+        }
+    }
+
+    // cookies bucketed by the hash of their (lowercased) domain. The set's
+    // nodes are stable, so the pointers survive until the cookie is erased.
+    using index_allocator_type = typename std::allocator_traits<allocator_type>::
+        template rebind_alloc<std::pair<const std::size_t, const cookie *>>;
+    boost::unordered_multimap<std::size_t, const cookie *,
+                              boost::hash<std::size_t>, std::equal_to<std::size_t>,
+                              index_allocator_type> index_;
+
+    // cookies with a finite expiry, soonest first, so expired ones are
+    // erased from the top instead of tombstoning the jar. An entry whose
+    // cookie is erased early is nulled in place and dropped when it
+    // surfaces; session cookies (expiry == max) are not tracked.
+    struct heap_entry
+    {
+      std::chrono::system_clock::time_point expiry;
+      const cookie * ck;
+    };
+    static bool expires_later_(const heap_entry & lhs, const heap_entry & rhs)
+    {
+      return lhs.expiry > rhs.expiry;
+    }
+
+    void push_heap_(const cookie * ck)
+    {
+      if (ck->expiry_time == std::chrono::system_clock::time_point::max())
+        return;
+      heap_.push_back(heap_entry{ck->expiry_time, ck});
+      std::push_heap(heap_.begin(), heap_.end(), &cookie_jar::expires_later_);
+    }
+
+    void invalidate_heap_(const cookie * ck)
+    {
+      for (auto & e : heap_)
+        if (e.ck == ck)
+        {
+          e.ck = nullptr;
+          return;
+        }
+    }
+
+    BOOST_REQUESTS_DECL void purge_some_(std::chrono::system_clock::time_point nw, std::size_t limit);
+
+    using heap_allocator_type = typename std::allocator_traits<allocator_type>::
+        template rebind_alloc<heap_entry>;
+    std::vector<heap_entry, heap_allocator_type> heap_;
 };
 
 }
 }
 
 #if defined(BOOST_REQUESTS_HEADER_ONLY)
-#include <boost/requests/cookie_jar.ipp>
+#include <boost/requests/impl/cookie_jar.ipp>
 #endif
 
 
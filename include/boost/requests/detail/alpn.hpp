@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_ALPN_HPP
+#define BOOST_REQUESTS_DETAIL_ALPN_HPP
+
+#include <boost/core/detail/string_view.hpp>
+#include <boost/requests/detail/config.hpp>
+#include <boost/requests/detail/ssl.hpp>
+
+extern "C" { typedef struct ssl_st SSL; }
+
+namespace boost {
+namespace requests {
+namespace detail {
+
+// Offer the application protocols during the TLS handshake, in preference
+// order. h2 is only offered when the caller can actually speak it, i.e. once a
+// multiplexed connection type exists to take over the socket.
+BOOST_REQUESTS_DECL void do_offer_alpn(SSL * ssl, bool offer_h2);
+
+// The protocol the server selected, empty if ALPN wasn't used.
+BOOST_REQUESTS_DECL core::string_view do_get_alpn_selected(SSL * ssl);
+
+template <typename Stream>
+inline void offer_alpn_impl(Stream *stream, bool offer_h2)
+{
+  do_offer_alpn(stream->native_handle(), offer_h2);
+}
+inline void offer_alpn_impl(std::nullptr_t, bool) {}
+
+template<typename Stream>
+void offer_alpn(Stream & str, bool offer_h2 = false)
+{
+  offer_alpn_impl(get_ssl_layer(str), offer_h2);
+}
+
+template <typename Stream>
+inline core::string_view alpn_selected_impl(Stream *stream)
+{
+  return do_get_alpn_selected(stream->native_handle());
+}
+inline core::string_view alpn_selected_impl(std::nullptr_t) {return {};}
+
+template<typename Stream>
+core::string_view alpn_selected(Stream & str)
+{
+  return alpn_selected_impl(get_ssl_layer(str));
+}
+
+}
+}
+}
+
+#if defined(BOOST_REQUESTS_HEADER_ONLY)
+#include <boost/requests/detail/impl/alpn.ipp>
+#endif
+#endif // BOOST_REQUESTS_DETAIL_ALPN_HPP
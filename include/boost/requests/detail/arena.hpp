@@ -0,0 +1,129 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_ARENA_HPP
+#define BOOST_REQUESTS_DETAIL_ARENA_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+#include <boost/core/exchange.hpp>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+struct arena_resource;
+
+// A free-list of arena blocks shared by all requests of a session.
+// acquire() hands out a fresh arena; its blocks come back here once the last
+// allocation made from it was freed, i.e. when the response is destroyed.
+struct arena_pool
+{
+  arena_pool() = default;
+  arena_pool(const arena_pool & ) = delete;
+  BOOST_REQUESTS_DECL ~arena_pool();
+
+  BOOST_REQUESTS_DECL arena_resource * acquire();
+
+ private:
+  friend struct arena_resource;
+
+  BOOST_REQUESTS_DECL void * get_block_();
+  BOOST_REQUESTS_DECL void put_blocks_(std::vector<void*> & blocks);
+
+  // keep at most this many blocks around; the rest goes back to the heap.
+  constexpr static std::size_t max_free_blocks = 64u;
+
+  std::mutex mtx_;
+  std::vector<void*> free_;
+};
+
+// Monotonic allocation over the pool's recycled blocks, counting live
+// allocations: allocate bumps a pointer, deallocate only decrements the
+// counter, and when it drops to zero the whole arena goes back to the pool
+// wholesale. The arena lives in the head of its first block, so a request
+// served entirely from recycled blocks does not touch the heap at all.
+//
+// The allocations of one request are sequenced with each other; only the
+// final deallocations may come from another thread - hence the one atomic.
+struct arena_resource final : container::pmr::memory_resource
+{
+ private:
+  friend struct arena_pool;
+
+  BOOST_REQUESTS_DECL arena_resource(arena_pool * pool, void * first_block);
+  ~arena_resource() = default;
+
+  BOOST_REQUESTS_DECL void * do_allocate  (std::size_t size, std::size_t align) override;
+  BOOST_REQUESTS_DECL void   do_deallocate(void * p, std::size_t size, std::size_t align) override;
+  bool do_is_equal(const memory_resource & other) const noexcept override
+  {
+    return this == &other;
+  }
+
+  struct oversized_t
+  {
+    void * p;
+    std::size_t size, align;
+  };
+
+  arena_pool * pool_;
+  std::vector<void*> blocks_;
+  std::vector<oversized_t> oversized_;
+  unsigned char * p_ = nullptr;
+  std::size_t n_ = 0u;
+  std::atomic<std::size_t> live_{0u};
+};
+
+// Keeps an arena alive over the span of a request, so a transient drop to
+// zero live allocations cannot recycle it while it is still being used.
+struct arena_anchor
+{
+  arena_anchor() = default;
+  explicit arena_anchor(container::pmr::memory_resource * res)
+      : res_(res), p_(res->allocate(1u, 1u)) {}
+
+  arena_anchor(arena_anchor && lhs) noexcept
+      : res_(boost::exchange(lhs.res_, nullptr)), p_(boost::exchange(lhs.p_, nullptr)) {}
+
+  arena_anchor & operator=(arena_anchor && lhs) noexcept
+  {
+    if (p_ != nullptr)
+      res_->deallocate(p_, 1u, 1u);
+    res_ = boost::exchange(lhs.res_, nullptr);
+    p_   = boost::exchange(lhs.p_, nullptr);
+    return *this;
+  }
+
+  ~arena_anchor()
+  {
+    if (p_ != nullptr)
+      res_->deallocate(p_, 1u, 1u);
+  }
+
+  container::pmr::memory_resource * resource() const {return res_;}
+
+ private:
+  container::pmr::memory_resource * res_ = nullptr;
+  void * p_ = nullptr;
+};
+
+}
+}
+}
+
+#if defined(BOOST_REQUESTS_HEADER_ONLY)
+#include <boost/requests/detail/impl/arena.ipp>
+#endif
+
+#endif // BOOST_REQUESTS_DETAIL_ARENA_HPP
@@ -34,6 +34,14 @@ struct co_runner;
 template<typename ... Signatures>
 struct co_token_t;
 
+// The per-step dispatch of a token used to go through a ladder of virtual
+// resume overrides, one hop per dropped argument. The runner now binds plain
+// function pointers - one per arity the op can be resumed at - into the base
+// once at initiation, so every step is a single indirect call that fills the
+// missing arguments itself. Nothing but get_allocator stays virtual; the
+// op state and the shared_ptr control block remain one fused allocation
+// through allocate_shared, recycled by asio's default allocator.
+
 template<>
 struct co_token_t<void()>
 {
@@ -46,12 +54,13 @@ struct co_token_t<void()>
   void operator()()
   {
     auto & base = *impl_;
-    base.resume(std::move(*this));
+    base.resume0(base, std::move(*this));
   }
 
   struct base
   {
-    virtual void resume(co_token_t<void()> impl) = 0;
+    // bound once by co_runner, see above.
+    void (*resume0)(base &, co_token_t<void()>) = nullptr;
     asio::cancellation_slot slot;
     virtual container::pmr::polymorphic_allocator<void> get_allocator() = 0;
   };
@@ -84,7 +93,7 @@ struct co_token_t<void(T1)>
   void operator()(T1 t1 = {})
   {
     auto & base = *impl_;
-    base.resume(std::move(*this), std::move(t1));
+    base.resume1(base, std::move(*this), std::move(t1));
   }
 
   operator co_token_t<void()> () &&
@@ -94,11 +103,7 @@ struct co_token_t<void(T1)>
 
   struct base : co_token_t<void()>::base
   {
-    virtual void resume(co_token_t<void(T1)> tk, T1 t1) = 0;
-    void resume(co_token_t<void()> tk)
-    {
-      resume(co_token_t<void(T1)>{std::static_pointer_cast<base>(std::move(tk.impl_))}, T1{});
-    }
+    void (*resume1)(typename co_token_t<void()>::base &, co_token_t<void(T1)>, T1) = nullptr;
   };
 
   co_token_t(const co_token_t & ) = delete;
@@ -127,20 +132,12 @@ struct co_token_t<void(T1, T2)>
   void operator()(T1 t1 = {}, T2 t2 = {})
   {
     auto & base = *impl_;
-    base.resume(std::move(*this), std::move(t1), std::move(t2));
+    base.resume2(base, std::move(*this), std::move(t1), std::move(t2));
   }
 
   struct base : co_token_t<void(T1)>::base
   {
-    virtual void resume(co_token_t<void(T1, T2)> tk, T1 t1, T2 t2) = 0;
-    void resume(co_token_t<void()> tk) final
-    {
-      resume(co_token_t<void(T1, T2)>{std::static_pointer_cast<base>(std::move(tk.impl_))}, T1{}, T2{});
-    }
-    void resume(co_token_t<void(T1)> tk, T1 t1)
-    {
-      resume(co_token_t<void(T1, T2)>{std::static_pointer_cast<base>(std::move(tk.impl_)) }, std::move(t1), T2{});
-    }
+    void (*resume2)(typename co_token_t<void()>::base &, co_token_t<void(T1, T2)>, T1, T2) = nullptr;
   };
 
   co_token_t(const co_token_t & ) = delete;
@@ -175,7 +172,7 @@ struct co_runner<Implementation, void(system::error_code, Args...)>
   template<typename Handler>
   struct impl_ final : token_type::base
   {
-    void resume(token_type tk, system::error_code ec, Args ... args) override
+    void resume(token_type tk, system::error_code ec, Args ... args)
     {
       using result_type = decltype(impl.resume(std::move(tk), ec, std::move(args)...));
       resume_impl(std::is_void<result_type>{}, std::move(tk), std::move(ec), std::move(args)...);
@@ -295,6 +292,45 @@ struct co_runner<Implementation, void(system::error_code, Args...)>
       return boost::container::pmr::get_default_resource();
     }
 
+    // the bound resumption thunks; missing arguments are filled in right
+    // here instead of hopping through one adapter per dropped argument.
+    using root_base_ = typename co_token_t<void()>::base;
+
+    static impl_ & self_(root_base_ & b)
+    {
+      return static_cast<impl_&>(b);
+    }
+
+    static token_type retoken_(std::shared_ptr<root_base_> p)
+    {
+      return token_type{std::static_pointer_cast<typename token_type::base>(std::move(p))};
+    }
+
+    static void resume0_(root_base_ & b, co_token_t<void()> tk)
+    {
+      self_(b).resume(retoken_(std::move(tk.impl_)), system::error_code{}, Args{}...);
+    }
+
+    static void resume_full_(root_base_ & b, token_type tk, system::error_code ec, Args ... args)
+    {
+      self_(b).resume(std::move(tk), std::move(ec), std::move(args)...);
+    }
+
+    static void resume1_(root_base_ & b, co_token_t<void(system::error_code)> tk, system::error_code ec)
+    {
+      self_(b).resume(retoken_(std::move(tk.impl_)), std::move(ec), Args{}...);
+    }
+
+    void bind_thunks_(std::integral_constant<std::size_t, 0u>)
+    {
+      this->resume1 = &impl_::resume_full_;
+    }
+
+    void bind_thunks_(std::integral_constant<std::size_t, 1u>)
+    {
+      this->resume1 = &impl_::resume1_;
+      this->resume2 = &impl_::resume_full_;
+    }
 
     template<typename Handler_, typename ... Args_>
     impl_(Handler_ && h, Args_ && ... args)
@@ -302,6 +338,8 @@ struct co_runner<Implementation, void(system::error_code, Args...)>
         , impl(std::forward<Args_>(args)...)
     {
       this->token_type::base::slot      = asio::get_associated_cancellation_slot(handler);
+      this->resume0 = &impl_::resume0_;
+      bind_thunks_(std::integral_constant<std::size_t, sizeof...(Args)>{});
     }
   };
 
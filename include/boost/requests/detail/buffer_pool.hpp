@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_BUFFER_POOL_HPP
+#define BOOST_REQUESTS_DETAIL_BUFFER_POOL_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <mutex>
+#include <vector>
+
+namespace boost {
+namespace requests {
+namespace detail {
+
+// Recycles the connections' staging buffers in power-of-two size classes.
+// A connection checks a buffer out when it starts reading a response and
+// hands it back once the response is consumed, so the retained memory
+// tracks the pool's working set instead of every connection's individual
+// high-water mark.
+struct buffer_pool
+{
+  buffer_pool() = default;
+  buffer_pool(const buffer_pool & ) = delete;
+  buffer_pool& operator=(const buffer_pool & ) = delete;
+
+  // the largest recycled buffer, if any, otherwise a fresh empty one.
+  BOOST_REQUESTS_DECL beast::flat_buffer checkout();
+  // cleared and kept for the next checkout; oversized buffers are freed.
+  BOOST_REQUESTS_DECL void checkin(beast::flat_buffer buffer);
+
+ private:
+  // class i holds buffers of capacity up to (4096 << i), so 4 KB to 1 MB.
+  constexpr static std::size_t num_classes_ = 9u;
+  constexpr static std::size_t per_class_   = 16u;
+
+  static std::size_t class_of_(std::size_t capacity);
+
+  std::mutex mtx_;
+  std::vector<beast::flat_buffer> classes_[num_classes_];
+};
+
+}
+}
+}
+
+#if defined(BOOST_REQUESTS_HEADER_ONLY)
+#include <boost/requests/detail/impl/buffer_pool.ipp>
+#endif
+#endif // BOOST_REQUESTS_DETAIL_BUFFER_POOL_HPP
@@ -0,0 +1,87 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_CHUNK_SIZER_HPP
+#define BOOST_REQUESTS_DETAIL_CHUNK_SIZER_HPP
+
+#include <boost/requests/detail/buffer_pool.hpp>
+#include <boost/requests/detail/config.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/optional.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace requests {
+namespace detail {
+
+/* Adaptive read-chunk sizing for the body copy loops. One compile-time
+   BOOST_REQUESTS_CHUNK_SIZE used to serve everything from 200-byte API
+   replies to multi-gigabyte artifacts; this starts small and doubles
+   while reads come back full - the socket evidently had more - up to
+   BOOST_REQUESTS_MAX_CHUNK_SIZE, and stops growing on a short read. A
+   known Content-Length seeds the size directly, so a small response
+   never over-allocates and a large transfer skips the ramp. */
+struct chunk_sizer
+{
+  constexpr static std::size_t min_size = BOOST_REQUESTS_CHUNK_SIZE;
+  constexpr static std::size_t max_size = BOOST_REQUESTS_MAX_CHUNK_SIZE;
+
+  chunk_sizer() = default;
+  chunk_sizer(boost::optional<std::uint64_t> content_length)
+  {
+    if (content_length)
+      size_ = static_cast<std::size_t>(
+          (std::min)((std::max)(*content_length, std::uint64_t(min_size)),
+                     std::uint64_t(max_size)));
+  }
+
+  std::size_t size() const {return size_;}
+
+  /// feed back what a size()-sized read returned
+  void update(std::size_t n)
+  {
+    if (n == size_ && size_ < max_size)
+      size_ <<= 1u;
+  }
+
+ private:
+  std::size_t size_ = min_size;
+};
+
+/* A recycled scratch block for the copy loops, drawn from a shared
+   buffer_pool so repeated transfers reuse the grown storage instead of
+   carrying a fixed-size array per call frame. */
+struct scratch_buffer
+{
+  scratch_buffer() : buffer_(pool_().checkout()) {}
+  ~scratch_buffer() { pool_().checkin(std::move(buffer_)); }
+
+  scratch_buffer(const scratch_buffer &) = delete;
+  scratch_buffer & operator=(const scratch_buffer &) = delete;
+
+  /// writable storage for the next read; grows as the sizer does.
+  /// A later prepare invalidates the previous one's view.
+  asio::mutable_buffer prepare(std::size_t n)
+  {
+    return buffer_.prepare(n);
+  }
+
+ private:
+  static buffer_pool & pool_()
+  {
+    static buffer_pool p;
+    return p;
+  }
+
+  beast::flat_buffer buffer_;
+};
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_CHUNK_SIZER_HPP
@@ -10,7 +10,10 @@
 
 #include <boost/config.hpp>
 
-#if defined(BOOST_REQUESTS_SINGLE_THREADED)
+#if defined(BOOST_REQUESTS_NO_LOCKING)
+#include <boost/requests/detail/null_mutex.hpp>
+#include <boost/asem/st.hpp> // the admission semaphore has no null variant
+#elif defined(BOOST_REQUESTS_SINGLE_THREADED)
 #include <boost/asem/st.hpp>
 #else
 #include <boost/asem/mt.hpp>
@@ -67,7 +70,14 @@ namespace detail
 {
 
 
-#if defined(BOOST_REQUESTS_SINGLE_THREADED)
+// Three locking policies, coarsest to cheapest: the default multi-threaded
+// asem mutex, the single-threaded asem mutex (BOOST_REQUESTS_SINGLE_THREADED,
+// no atomics but waiters still queue), and a null mutex that does nothing at
+// all (BOOST_REQUESTS_NO_LOCKING) for strictly single-io-thread deployments.
+#if defined(BOOST_REQUESTS_NO_LOCKING)
+template<typename Executor>
+using basic_mutex = basic_null_mutex<Executor>;
+#elif defined(BOOST_REQUESTS_SINGLE_THREADED)
 template<typename Executor>
 using basic_mutex = asem::basic_mutex<boost::asem::st, Executor>;
 #else
@@ -75,6 +85,16 @@ template<typename Executor>
 using basic_mutex = asem::basic_mutex<boost::asem::mt, Executor>;
 #endif
 
+// The session's admission semaphore follows the same policy; there is no
+// null semaphore, strictly single-io-thread builds use the st one.
+#if defined(BOOST_REQUESTS_NO_LOCKING) || defined(BOOST_REQUESTS_SINGLE_THREADED)
+template<typename Executor>
+using basic_semaphore = asem::basic_semaphore<boost::asem::st, Executor>;
+#else
+template<typename Executor>
+using basic_semaphore = asem::basic_semaphore<boost::asem::mt, Executor>;
+#endif
+
 }
 }
 }
@@ -87,8 +107,59 @@ using basic_mutex = asem::basic_mutex<boost::asem::mt, Executor>;
 #define BOOST_REQUESTS_CHUNK_SIZE 4096
 #endif
 
+// where the adaptive copy loops stop growing their chunks, see
+// detail::chunk_sizer; BOOST_REQUESTS_CHUNK_SIZE is where they start.
+#if !defined(BOOST_REQUESTS_MAX_CHUNK_SIZE)
+#define BOOST_REQUESTS_MAX_CHUNK_SIZE 262144
+#endif
+
+// seconds after which a warm-state snapshot's endpoint dial scores are
+// considered rotten and not restored, see basic_session::restore_state;
+// DNS entries and TLS tickets carry their own lifetimes.
+#if !defined(BOOST_REQUESTS_WARM_SCORE_MAX_AGE)
+#define BOOST_REQUESTS_WARM_SCORE_MAX_AGE 3600
+#endif
+
+// largest response body a coalesced GET buffers for fan-out, see
+// basic_session::use_single_flight; bigger responses end the flight
+// empty-handed and the waiters dial out themselves.
+#if !defined(BOOST_REQUESTS_SINGLE_FLIGHT_MAX_SIZE)
+#define BOOST_REQUESTS_SINGLE_FLIGHT_MAX_SIZE (1024u * 1024u)
+#endif
+
+#if !defined(BOOST_REQUESTS_ARENA_BLOCK_SIZE)
+#define BOOST_REQUESTS_ARENA_BLOCK_SIZE 16384
+#endif
+
+#if !defined(BOOST_REQUESTS_SBO_BUFFER_SIZE)
+#define BOOST_REQUESTS_SBO_BUFFER_SIZE 1024
+#endif
+
+// block size of the segmented response body storage
+#if !defined(BOOST_REQUESTS_SEGMENT_SIZE)
+#define BOOST_REQUESTS_SEGMENT_SIZE 65536
+#endif
+
 #if !defined(BOOST_REQUESTS_MAX_URL_LENGTH)
 #define BOOST_REQUESTS_MAX_URL_LENGTH 4096
 #endif
 
+// regular files at least this big get memory-mapped for upload
+// instead of read through a staging buffer.
+#if !defined(BOOST_REQUESTS_MMAP_THRESHOLD)
+#define BOOST_REQUESTS_MMAP_THRESHOLD 65536
+#endif
+
+// abandoning a response with at most this many body bytes left drains the
+// rest to keep the connection reusable; more than that closes it instead.
+#if !defined(BOOST_REQUESTS_MAX_DRAIN_SIZE)
+#define BOOST_REQUESTS_MAX_DRAIN_SIZE 65536
+#endif
+
+// regions a scattered body read passes down in one call; a consumer
+// handing in more gets them filled this many at a time.
+#if !defined(BOOST_REQUESTS_MAX_SCATTER_BUFFERS)
+#define BOOST_REQUESTS_MAX_SCATTER_BUFFERS 16
+#endif
+
 #endif // BOOST_REQUESTS_DETAIL_HPP
\ No newline at end of file
@@ -0,0 +1,84 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_DEFLATE_HPP
+#define BOOST_REQUESTS_DETAIL_DEFLATE_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/beast/zlib/deflate_stream.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <cstdint>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+// Incremental encoder for the gzip content-coding, the upload counterpart
+// of inflater: built on beast's raw deflate, with the gzip member framing
+// (header, CRC32 and ISIZE trailer) handled here. Input is taken as views
+// handed in with provide(), so the body bytes are compressed in place of
+// being staged a second time.
+struct deflater
+{
+  BOOST_REQUESTS_DECL deflater();
+
+  deflater(const deflater & ) = delete;
+  deflater& operator=(const deflater & ) = delete;
+
+  /// Everything provided was compressed and the trailer was written out.
+  bool done() const { return state_ == state::complete; }
+
+  /// The staged input view is drained; provide() the next chunk or finish().
+  bool needs_input() const { return in_.size() == 0u; }
+
+  /// finish() was called, no further input is expected.
+  bool input_finished() const { return finish_; }
+
+  /// Hand the next body chunk to the encoder. The view must stay valid
+  /// until needs_input() returns true again; only valid when it is now.
+  void provide(asio::const_buffer in) { in_ = in; }
+
+  /// No more input: write_output flushes the stream and emits the trailer.
+  void finish() { finish_ = true; }
+
+  /// Compress staged input into `out`; returns the number of bytes written.
+  BOOST_REQUESTS_DECL std::size_t write_output(asio::mutable_buffer out, system::error_code & ec);
+
+ private:
+  enum class state
+  {
+    header,
+    body,
+    trailer,
+    complete
+  };
+
+  state state_{state::header};
+  beast::zlib::deflate_stream ds_;
+
+  asio::const_buffer in_;
+  bool finish_{false};
+
+  std::uint32_t crc_{0u};
+  std::uint64_t size_{0u};
+  std::size_t fixed_pos_{0u}; // progress through the header, then the trailer
+};
+
+}
+}
+}
+
+#if defined(BOOST_REQUESTS_HEADER_ONLY)
+#include <boost/requests/detail/impl/deflate.ipp>
+#endif
+
+#endif // BOOST_REQUESTS_DETAIL_DEFLATE_HPP
@@ -0,0 +1,240 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_HEADER_BLOCK_HPP
+#define BOOST_REQUESTS_DETAIL_HEADER_BLOCK_HPP
+
+#include <boost/requests/http.hpp>
+#include <boost/beast/http/basic_parser.hpp>
+#include <boost/container/pmr/polymorphic_allocator.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace boost {
+namespace requests {
+namespace detail {
+
+/* A response header in one block: the parser appends every name and value
+   into a single growable buffer, with a small offset table on the side -
+   no node per field, where materializing beast fields costs an allocation
+   for each of the 20-30 headers a typical response carries. Lookups are
+   case-insensitive; the first one sorts the offset table and they search
+   it binarily from then on. The views handed out live as long as the
+   block, so a caller that keeps the header beyond that (usually the
+   stream's lifetime) converts once via to_fields(). */
+class header_block
+{
+public:
+  using allocator_type = container::pmr::polymorphic_allocator<char>;
+
+  struct value_type
+  {
+    beast::http::field field;
+    core::string_view name, value;
+  };
+
+  header_block(allocator_type alloc = {}) : raw_(alloc), entries_(alloc), order_(alloc) {}
+
+  header_block(header_block &&) = default;
+  header_block& operator=(header_block &&) = default;
+  header_block(const header_block &) = delete;
+  header_block& operator=(const header_block &) = delete;
+
+  int          result_int() const {return result_;}
+  http::status result()     const {return beast::http::int_to_status(static_cast<unsigned>(result_));}
+  int          version()    const {return version_;}
+  core::string_view reason() const {return view_(reason_off_, reason_len_);}
+
+  std::size_t size()  const {return entries_.size();}
+  bool        empty() const {return entries_.empty();}
+
+  /// The i-th field in wire order.
+  value_type at(std::size_t i) const
+  {
+    const auto & e = entries_[i];
+    return {e.field, view_(e.name_off, e.name_len), view_(e.value_off, e.value_len)};
+  }
+
+  /// The first value under `name`, case-insensitive; empty when absent,
+  /// like beast's fields::operator[].
+  core::string_view operator[](core::string_view name) const
+  {
+    const auto i = find_(name);
+    return i == npos_ ? core::string_view() : at(order_[i]).value;
+  }
+  core::string_view operator[](beast::http::field f) const
+  {
+    return (*this)[beast::http::to_string(f)];
+  }
+
+  std::size_t count(core::string_view name) const
+  {
+    const auto first = find_(name);
+    if (first == npos_)
+      return 0u;
+    std::size_t n = 1u;
+    for (auto i = first + 1u; i < order_.size()
+         && urls::grammar::ci_is_equal(at(order_[i]).name, name); i++)
+      n++;
+    return n;
+  }
+  std::size_t count(beast::http::field f) const {return count(beast::http::to_string(f));}
+
+  /// An owning beast header for a caller that keeps it beyond the block.
+  http::response_header to_fields(allocator_type alloc = {}) const
+  {
+    http::response_header h{http::fields(alloc)};
+    h.version(version_);
+    h.result(static_cast<unsigned>(result_));
+    h.reason(reason());
+    for (std::size_t i = 0u; i < entries_.size(); i++)
+    {
+      const auto v = at(i);
+      h.insert(v.field, v.name, v.value);
+    }
+    return h;
+  }
+
+  void clear()
+  {
+    raw_.clear();
+    entries_.clear();
+    order_.clear();
+    result_ = 0;
+    version_ = 11;
+    reason_off_ = reason_len_ = 0u;
+  }
+
+  // the parser side, see header_block_parser
+  void set_start_line_(int code, core::string_view reason, int version)
+  {
+    result_ = code;
+    version_ = version;
+    reason_off_ = append_(reason);
+    reason_len_ = reason.size();
+  }
+  void append_(beast::http::field f, core::string_view name, core::string_view value)
+  {
+    entry e;
+    e.field     = f;
+    e.name_off  = append_(name);
+    e.name_len  = name.size();
+    e.value_off = append_(value);
+    e.value_len = value.size();
+    entries_.push_back(e);
+    order_.clear(); // rebuilt on the next lookup
+  }
+
+private:
+  struct entry
+  {
+    beast::http::field field;
+    std::size_t name_off, name_len, value_off, value_len;
+  };
+
+  static constexpr std::size_t npos_ = std::size_t(-1);
+
+  core::string_view view_(std::size_t off, std::size_t len) const
+  {
+    return core::string_view(raw_.data() + off, len);
+  }
+
+  std::size_t append_(core::string_view sv)
+  {
+    const auto off = raw_.size();
+    raw_.insert(raw_.end(), sv.begin(), sv.end());
+    return off;
+  }
+
+  // index of the first entry named `name` (as a position in order_),
+  // building the sorted offset table on first use
+  std::size_t find_(core::string_view name) const
+  {
+    if (order_.size() != entries_.size())
+    {
+      order_.resize(entries_.size());
+      for (std::size_t i = 0u; i < order_.size(); i++)
+        order_[i] = i;
+      std::sort(order_.begin(), order_.end(),
+                [this](std::size_t lhs, std::size_t rhs)
+                {
+                  const auto c = urls::grammar::ci_compare(at(lhs).name, at(rhs).name);
+                  return c != 0 ? c < 0 : lhs < rhs; // wire order within a name
+                });
+    }
+    const auto itr = std::lower_bound(order_.begin(), order_.end(), name,
+                [this](std::size_t lhs, core::string_view rhs)
+                {
+                  return urls::grammar::ci_compare(at(lhs).name, rhs) < 0;
+                });
+    if (itr == order_.end() || !urls::grammar::ci_is_equal(at(*itr).name, name))
+      return npos_;
+    return static_cast<std::size_t>(itr - order_.begin());
+  }
+
+  std::vector<char, allocator_type> raw_;
+  std::vector<entry, container::pmr::polymorphic_allocator<entry>> entries_;
+  mutable std::vector<std::size_t, container::pmr::polymorphic_allocator<std::size_t>> order_;
+
+  int result_ = 0;
+  int version_ = 11;
+  std::size_t reason_off_ = 0u, reason_len_ = 0u;
+};
+
+/* A beast parser writing straight into a header_block. It is for reads
+   that look at a status code and two or three fields and drop the rest -
+   the interim 100-continue peek, header-only probes; body bytes are
+   consumed and discarded, readers that want the body keep the regular
+   response_parser. */
+struct header_block_parser : beast::http::basic_parser<false>
+{
+  explicit header_block_parser(header_block & hb) : hb_(&hb) {}
+
+        header_block & get()       {return *hb_;}
+  const header_block & get() const {return *hb_;}
+
+protected:
+  void on_request_impl(beast::http::verb, beast::string_view, beast::string_view,
+                       int, system::error_code &) override
+  {
+    // requests never reach a parser instantiated for responses
+  }
+  void on_response_impl(int code, beast::string_view reason, int version,
+                        system::error_code &) override
+  {
+    hb_->set_start_line_(code, reason, version);
+  }
+  void on_field_impl(beast::http::field f, beast::string_view name,
+                     beast::string_view value, system::error_code &) override
+  {
+    hb_->append_(f, name, value);
+  }
+  void on_header_impl(system::error_code &) override {}
+  void on_body_init_impl(const boost::optional<std::uint64_t> &, system::error_code &) override {}
+  std::size_t on_body_impl(beast::string_view body, system::error_code &) override
+  {
+    return body.size();
+  }
+  void on_chunk_header_impl(std::uint64_t, beast::string_view, system::error_code &) override {}
+  std::size_t on_chunk_body_impl(std::uint64_t, beast::string_view body, system::error_code &) override
+  {
+    return body.size();
+  }
+  void on_finish_impl(system::error_code &) override {}
+
+private:
+  header_block * hb_;
+};
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_HEADER_BLOCK_HPP
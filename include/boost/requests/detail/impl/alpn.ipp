@@ -0,0 +1,47 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_IMPL_ALPN_IPP
+#define BOOST_REQUESTS_DETAIL_IMPL_ALPN_IPP
+
+#include <boost/requests/detail/alpn.hpp>
+#include <boost/asio/ssl/context.hpp>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+void do_offer_alpn(SSL * ssl, bool offer_h2)
+{
+  // wire format: length-prefixed protocol names.
+  static const unsigned char h1_only[] = {8, 'h','t','t','p','/','1','.','1'};
+  static const unsigned char h2_h1[]   = {2, 'h','2',
+                                          8, 'h','t','t','p','/','1','.','1'};
+  if (offer_h2)
+    SSL_set_alpn_protos(ssl, h2_h1, sizeof(h2_h1));
+  else
+    SSL_set_alpn_protos(ssl, h1_only, sizeof(h1_only));
+}
+
+core::string_view do_get_alpn_selected(SSL * ssl)
+{
+  const unsigned char * data = nullptr;
+  unsigned int len = 0u;
+  SSL_get0_alpn_selected(ssl, &data, &len);
+  if (data == nullptr || len == 0u)
+    return {};
+  return core::string_view(reinterpret_cast<const char*>(data), len);
+}
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_IMPL_ALPN_IPP
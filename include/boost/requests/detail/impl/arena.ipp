@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_IMPL_ARENA_IPP
+#define BOOST_REQUESTS_DETAIL_IMPL_ARENA_IPP
+
+#include <boost/requests/detail/arena.hpp>
+#include <memory>
+#include <new>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+arena_pool::~arena_pool()
+{
+  for (auto * blk : free_)
+    ::operator delete(blk);
+}
+
+void * arena_pool::get_block_()
+{
+  {
+    std::lock_guard<std::mutex> lock{mtx_};
+    if (!free_.empty())
+    {
+      void * blk = free_.back();
+      free_.pop_back();
+      return blk;
+    }
+  }
+  return ::operator new(BOOST_REQUESTS_ARENA_BLOCK_SIZE);
+}
+
+void arena_pool::put_blocks_(std::vector<void*> & blocks)
+{
+  std::unique_lock<std::mutex> lock{mtx_};
+  while (!blocks.empty() && free_.size() < max_free_blocks)
+  {
+    free_.push_back(blocks.back());
+    blocks.pop_back();
+  }
+  lock.unlock();
+  for (auto * blk : blocks)
+    ::operator delete(blk);
+}
+
+arena_resource * arena_pool::acquire()
+{
+  void * blk = get_block_();
+  auto * res = new (blk) arena_resource(this, blk);
+  return res;
+}
+
+arena_resource::arena_resource(arena_pool * pool, void * first_block)
+    : pool_(pool)
+{
+  blocks_.push_back(first_block);
+  constexpr std::size_t head =
+      (sizeof(arena_resource) + alignof(std::max_align_t) - 1u)
+      / alignof(std::max_align_t) * alignof(std::max_align_t);
+  p_ = static_cast<unsigned char*>(first_block) + head;
+  n_ = BOOST_REQUESTS_ARENA_BLOCK_SIZE - head;
+}
+
+void * arena_resource::do_allocate(std::size_t size, std::size_t align)
+{
+  live_.fetch_add(1u, std::memory_order_relaxed);
+
+  // too big to carve from a block - take it from the heap, free it with the arena
+  if (size + align > BOOST_REQUESTS_ARENA_BLOCK_SIZE / 2u
+      || align > alignof(std::max_align_t))
+  {
+    void * p = ::operator new(size + align);
+    std::size_t space = size + align;
+    void * pv = p;
+    std::align(align, size, pv, space);
+    oversized_.push_back({p, size, align});
+    return pv;
+  }
+
+  std::size_t space = n_;
+  void * pv = p_;
+  if (std::align(align, size, pv, space) == nullptr)
+  {
+    void * blk = pool_->get_block_();
+    blocks_.push_back(blk);
+    pv = p_ = static_cast<unsigned char*>(blk);
+    space = n_ = BOOST_REQUESTS_ARENA_BLOCK_SIZE;
+    std::align(align, size, pv, space);
+  }
+  p_ = static_cast<unsigned char*>(pv) + size;
+  n_ = space - size;
+  return pv;
+}
+
+void arena_resource::do_deallocate(void *, std::size_t, std::size_t)
+{
+  if (live_.fetch_sub(1u, std::memory_order_acq_rel) != 1u)
+    return;
+
+  // last one out: hand everything back at once. The arena itself lives in
+  // blocks_.front(), so move the lists out before destroying it.
+  auto * pool = pool_;
+  auto blocks = std::move(blocks_);
+  auto oversized = std::move(oversized_);
+  this->~arena_resource();
+
+  for (const auto & o : oversized)
+    ::operator delete(o.p);
+  pool->put_blocks_(blocks);
+}
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_IMPL_ARENA_IPP
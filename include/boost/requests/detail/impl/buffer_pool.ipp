@@ -0,0 +1,57 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_IMPL_BUFFER_POOL_IPP
+#define BOOST_REQUESTS_DETAIL_IMPL_BUFFER_POOL_IPP
+
+#include <boost/requests/detail/buffer_pool.hpp>
+
+namespace boost {
+namespace requests {
+namespace detail {
+
+std::size_t buffer_pool::class_of_(std::size_t capacity)
+{
+  std::size_t cl = 0u;
+  while (cl < num_classes_ && (std::size_t(4096u) << cl) < capacity)
+    cl++;
+  return cl;
+}
+
+beast::flat_buffer buffer_pool::checkout()
+{
+  std::lock_guard<std::mutex> lock{mtx_};
+  // prefer the biggest buffer on hand, so grown storage keeps circulating
+  // instead of idling in its class while smaller buffers get regrown.
+  for (auto cl = num_classes_; cl-- > 0u;)
+  {
+    if (classes_[cl].empty())
+      continue;
+    auto b = std::move(classes_[cl].back());
+    classes_[cl].pop_back();
+    return b;
+  }
+  return beast::flat_buffer{};
+}
+
+void buffer_pool::checkin(beast::flat_buffer buffer)
+{
+  buffer.clear();
+  if (buffer.capacity() == 0u || buffer.capacity() > (std::size_t(4096u) << (num_classes_ - 1u)))
+    return; // oversized: let it free, the next user starts small again
+
+  const auto cl = class_of_(buffer.capacity());
+  std::lock_guard<std::mutex> lock{mtx_};
+  if (classes_[cl].size() < per_class_)
+    classes_[cl].emplace_back(std::move(buffer));
+}
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_IMPL_BUFFER_POOL_IPP
@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_IMPL_DEFLATE_IPP
+#define BOOST_REQUESTS_DETAIL_IMPL_DEFLATE_IPP
+
+#include <boost/requests/detail/deflate.hpp>
+#include <boost/beast/zlib/error.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+namespace {
+
+// CRC-32 (IEEE 802.3), as required by the gzip trailer, RFC 1952 8.1
+std::uint32_t crc32_update(std::uint32_t crc, const unsigned char * p, std::size_t n)
+{
+  static const auto tab = []
+  {
+    std::array<std::uint32_t, 256u> t{};
+    for (std::uint32_t i = 0u; i < 256u; i++)
+    {
+      std::uint32_t c = i;
+      for (int k = 0; k < 8; k++)
+        c = (c & 1u) ? 0xedb88320u ^ (c >> 1u) : c >> 1u;
+      t[i] = c;
+    }
+    return t;
+  }();
+
+  crc ^= 0xffffffffu;
+  for (std::size_t i = 0u; i < n; i++)
+    crc = tab[(crc ^ p[i]) & 0xffu] ^ (crc >> 8u);
+  return crc ^ 0xffffffffu;
+}
+
+// no mtime, no flags, unknown OS
+constexpr unsigned char gzip_header[10] = {0x1f, 0x8b, 8u, 0u, 0u, 0u, 0u, 0u, 0u, 0xffu};
+
+}
+
+deflater::deflater()
+{
+  // raw deflate - the gzip wrapper is written by hand below
+  ds_.reset(6, 15, 8, beast::zlib::Strategy::normal);
+}
+
+std::size_t deflater::write_output(asio::mutable_buffer out, system::error_code & ec)
+{
+  std::size_t written = 0u;
+  while (out.size() > 0u && !done() && !ec)
+  {
+    switch (state_)
+    {
+      case state::header:
+      {
+        const auto n = (std::min)(out.size(), sizeof(gzip_header) - fixed_pos_);
+        std::memcpy(out.data(), gzip_header + fixed_pos_, n);
+        fixed_pos_ += n;
+        out += n;
+        written += n;
+        if (fixed_pos_ == sizeof(gzip_header))
+        {
+          fixed_pos_ = 0u;
+          state_ = state::body;
+        }
+        break;
+      }
+      case state::body:
+      {
+        beast::zlib::z_params zs;
+        zs.next_in   = in_.data();
+        zs.avail_in  = in_.size();
+        zs.next_out  = out.data();
+        zs.avail_out = out.size();
+        ds_.write(zs, finish_ ? beast::zlib::Flush::finish : beast::zlib::Flush::none, ec);
+
+        const auto consumed = in_.size() - zs.avail_in;
+        if (consumed > 0u)
+        {
+          crc_ = crc32_update(crc_, static_cast<const unsigned char*>(in_.data()), consumed);
+          size_ += consumed;
+          in_ += consumed;
+        }
+        const auto n = out.size() - zs.avail_out;
+        written += n;
+        out += n;
+
+        if (ec == beast::zlib::error::end_of_stream)
+        {
+          ec = {};
+          state_ = state::trailer;
+        }
+        else if (!ec && n == 0u && consumed == 0u)
+          return written; // made no progress - the window wants more input
+        break;
+      }
+      case state::trailer:
+      {
+        // CRC32 and ISIZE, both little-endian, RFC 1952
+        unsigned char trailer[8];
+        for (std::size_t i = 0u; i < 4u; i++)
+          trailer[i] = static_cast<unsigned char>(crc_ >> (i * 8u));
+        for (std::size_t i = 0u; i < 4u; i++)
+          trailer[4u + i] = static_cast<unsigned char>((size_ & 0xffffffffu) >> (i * 8u));
+
+        const auto n = (std::min)(out.size(), sizeof(trailer) - fixed_pos_);
+        std::memcpy(out.data(), trailer + fixed_pos_, n);
+        fixed_pos_ += n;
+        out += n;
+        written += n;
+        if (fixed_pos_ == sizeof(trailer))
+          state_ = state::complete;
+        break;
+      }
+      case state::complete:
+        break;
+    }
+  }
+  return written;
+}
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_IMPL_DEFLATE_IPP
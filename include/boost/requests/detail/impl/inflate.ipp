@@ -0,0 +1,218 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_IMPL_INFLATE_IPP
+#define BOOST_REQUESTS_DETAIL_IMPL_INFLATE_IPP
+
+#include <boost/requests/detail/inflate.hpp>
+#include <boost/beast/zlib/error.hpp>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+auto inflater::select_coding(core::string_view content_encoding) -> coding
+{
+  if (content_encoding == "gzip" || content_encoding == "x-gzip")
+    return coding::gzip;
+  if (content_encoding == "deflate")
+    return coding::deflate;
+  // anything else, including coding lists, is passed through untouched.
+  return coding::identity;
+}
+
+inflater::inflater(coding cd) : coding_(cd)
+{
+  switch (cd)
+  {
+    case coding::gzip:    trailer_remaining_ = 8u; break; // CRC32 + ISIZE
+    case coding::deflate: trailer_remaining_ = 4u; break; // adler32
+    case coding::identity:
+      state_ = state::complete;
+      break;
+  }
+}
+
+auto inflater::next_hstate_(hstate st) const -> hstate
+{
+  switch (st)
+  {
+    case hstate::fixed:
+    case hstate::extra:
+      if (flags_ & 8u)  return hstate::name;    // FNAME
+      BOOST_FALLTHROUGH;
+    case hstate::name:
+      if (flags_ & 16u) return hstate::comment; // FCOMMENT
+      BOOST_FALLTHROUGH;
+    case hstate::comment:
+      if (flags_ & 2u)  return hstate::hcrc;    // FHCRC
+      BOOST_FALLTHROUGH;
+    default:
+      return hstate::hcrc; // unused once the header is complete
+  }
+}
+
+bool inflater::parse_header_(system::error_code & ec)
+{
+  if (coding_ == coding::deflate)
+  {
+    // Nominally a zlib wrapper, but some servers send the raw deflate
+    // stream; a zlib header has 8 (= deflate) in the low CMF bits.
+    while (in_pos_ < in_len_)
+    {
+      const auto b = static_cast<unsigned char>(in_[in_pos_]);
+      if (header_pos_ == 0u && (b & 0x0fu) != 8u)
+      {
+        trailer_remaining_ = 0u;
+        return true;
+      }
+      if (header_pos_ == 1u && (b & 0x20u) != 0u) // FDICT has no place in http
+      {
+        BOOST_REQUESTS_ASSIGN_EC(ec, beast::zlib::error::stream_error);
+        return false;
+      }
+      in_pos_++;
+      if (++header_pos_ == 2u)
+        return true;
+    }
+    return false;
+  }
+
+  // gzip member header, RFC 1952
+  while (in_pos_ < in_len_)
+  {
+    const auto b = static_cast<unsigned char>(in_[in_pos_]);
+    switch (hstate_)
+    {
+      case hstate::fixed:
+        if ((header_pos_ == 0u && b != 0x1fu) ||
+            (header_pos_ == 1u && b != 0x8bu) ||
+            (header_pos_ == 2u && b != 8u)) // deflate is the only gzip method
+        {
+          BOOST_REQUESTS_ASSIGN_EC(ec, beast::zlib::error::stream_error);
+          return false;
+        }
+        if (header_pos_ == 3u)
+          flags_ = b;
+        in_pos_++;
+        if (++header_pos_ == 10u)
+          hstate_ = (flags_ & 4u) ? hstate::extra_len0 : next_hstate_(hstate::fixed);
+        else
+          continue;
+        break;
+      case hstate::extra_len0:
+        extra_remaining_ = b;
+        in_pos_++;
+        hstate_ = hstate::extra_len1;
+        continue;
+      case hstate::extra_len1:
+        extra_remaining_ |= static_cast<std::size_t>(b) << 8u;
+        in_pos_++;
+        hstate_ = extra_remaining_ > 0u ? hstate::extra : next_hstate_(hstate::extra);
+        break;
+      case hstate::extra:
+      {
+        const auto n = (std::min)(in_len_ - in_pos_, extra_remaining_);
+        in_pos_ += n;
+        extra_remaining_ -= n;
+        if (extra_remaining_ > 0u)
+          continue;
+        hstate_ = next_hstate_(hstate::extra);
+        break;
+      }
+      case hstate::name:
+        in_pos_++;
+        if (b != 0u)
+          continue;
+        hstate_ = next_hstate_(hstate::name);
+        break;
+      case hstate::comment:
+        in_pos_++;
+        if (b != 0u)
+          continue;
+        hstate_ = next_hstate_(hstate::comment);
+        break;
+      case hstate::hcrc:
+        in_pos_++;
+        if (++header_pos_ == 12u) // two crc bytes past the fixed ten
+          return true;
+        continue;
+    }
+
+    // transitions past the optional fields land here
+    if (hstate_ == hstate::hcrc && !(flags_ & 2u))
+      return true;
+    if (hstate_ == hstate::hcrc)
+      header_pos_ = 10u;
+  }
+  return false;
+}
+
+std::size_t inflater::write_output(asio::mutable_buffer out, system::error_code & ec)
+{
+  std::size_t written = 0u;
+  while (in_pos_ < in_len_ && out.size() > 0u && !done() && !ec)
+  {
+    switch (state_)
+    {
+      case state::header:
+        if (parse_header_(ec))
+          state_ = state::body;
+        else if (!ec)
+          return written; // consumed everything staged
+        break;
+      case state::body:
+      {
+        const auto before = in_pos_;
+        beast::zlib::z_params zs;
+        zs.next_in   = in_ + in_pos_;
+        zs.avail_in  = in_len_ - in_pos_;
+        zs.next_out  = out.data();
+        zs.avail_out = out.size();
+        is_.write(zs, beast::zlib::Flush::sync, ec);
+        in_pos_ = in_len_ - zs.avail_in;
+        const auto n = out.size() - zs.avail_out;
+        written += n;
+        out += n;
+        if (ec == beast::zlib::error::end_of_stream)
+        {
+          ec = {};
+          state_ = trailer_remaining_ > 0u ? state::trailer : state::complete;
+        }
+        else if (ec == beast::zlib::error::need_buffers)
+        {
+          ec = {};
+          return written;
+        }
+        else if (!ec && n == 0u && in_pos_ == before)
+          return written; // made no progress, need more input
+        break;
+      }
+      case state::trailer:
+      {
+        const auto n = (std::min)(in_len_ - in_pos_, trailer_remaining_);
+        in_pos_ += n;
+        trailer_remaining_ -= n;
+        if (trailer_remaining_ == 0u)
+          state_ = state::complete;
+        break;
+      }
+      case state::complete:
+        break;
+    }
+  }
+  return written;
+}
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_IMPL_INFLATE_IPP
@@ -0,0 +1,84 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_IMPL_MMAP_BODY_IPP
+#define BOOST_REQUESTS_DETAIL_IMPL_MMAP_BODY_IPP
+
+#include <boost/requests/detail/mmap_body.hpp>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+void mmap_body::value_type::open(const char * path, system::error_code & ec)
+{
+  close_();
+
+#if !defined(_WIN32)
+  const int fd = ::open(path, O_RDONLY);
+  if (fd >= 0)
+  {
+    struct stat st;
+    if (::fstat(fd, &st) == 0
+        && S_ISREG(st.st_mode)
+        && st.st_size >= BOOST_REQUESTS_MMAP_THRESHOLD)
+    {
+      void * const map = ::mmap(nullptr, static_cast<std::size_t>(st.st_size),
+                                PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map != MAP_FAILED)
+      {
+        // the mapping keeps the file alive, the descriptor can go.
+        ::close(fd);
+#if defined(POSIX_MADV_SEQUENTIAL)
+        ::posix_madvise(map, static_cast<std::size_t>(st.st_size), POSIX_MADV_SEQUENTIAL);
+#endif
+        map_  = map;
+        size_ = static_cast<std::uint64_t>(st.st_size);
+        ec = {};
+        return;
+      }
+    }
+    ::close(fd);
+  }
+#endif
+
+  file_.open(path, beast::file_mode::read, ec);
+  if (ec)
+    return;
+  size_ = file_.size(ec);
+}
+
+void mmap_body::value_type::close_()
+{
+#if !defined(_WIN32)
+  if (map_ != nullptr)
+    ::munmap(map_, static_cast<std::size_t>(size_));
+#endif
+  map_  = nullptr;
+  size_ = 0u;
+  if (file_.is_open())
+  {
+    system::error_code ignored;
+    file_.close(ignored);
+  }
+}
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_IMPL_MMAP_BODY_IPP
@@ -0,0 +1,67 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_IMPL_PARSER_POOL_IPP
+#define BOOST_REQUESTS_DETAIL_IMPL_PARSER_POOL_IPP
+
+#include <boost/requests/detail/parser_pool.hpp>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+parser_pool::~parser_pool()
+{
+  for (auto * slot : free_)
+    delete slot;
+}
+
+parser_lease parser_pool::acquire(::boost::json::storage_ptr ptr)
+{
+  slot_t * slot = nullptr;
+  {
+    std::lock_guard<std::mutex> lock{mtx_};
+    if (!free_.empty())
+    {
+      slot = free_.back();
+      free_.pop_back();
+    }
+  }
+  if (slot == nullptr)
+    slot = new slot_t();
+
+  slot->parser.reset(std::move(ptr));
+  return parser_lease{this, slot};
+}
+
+void parser_pool::put_(slot_t * slot)
+{
+  {
+    std::lock_guard<std::mutex> lock{mtx_};
+    if (free_.size() < max_free_parsers)
+    {
+      free_.push_back(slot);
+      return;
+    }
+  }
+  delete slot;
+}
+
+parser_pool & default_parser_pool()
+{
+  static parser_pool pool_;
+  return pool_;
+}
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_IMPL_PARSER_POOL_IPP
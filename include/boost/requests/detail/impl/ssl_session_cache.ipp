@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_IMPL_SSL_SESSION_CACHE_IPP
+#define BOOST_REQUESTS_DETAIL_IMPL_SSL_SESSION_CACHE_IPP
+
+#include <boost/requests/detail/ssl_session_cache.hpp>
+#include <boost/asio/ssl/context.hpp>
+#include <ctime>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+ssl_session_cache::~ssl_session_cache()
+{
+  for (auto & s : sessions_)
+    SSL_SESSION_free(s.second);
+}
+
+void ssl_session_cache::do_apply(SSL * ssl, const std::string & host)
+{
+  std::lock_guard<std::mutex> lock{mtx_};
+  auto itr = sessions_.find(host);
+  if (itr != sessions_.end())
+    SSL_set_session(ssl, itr->second); // ups the refcount itself
+}
+
+void ssl_session_cache::do_store(SSL * ssl, const std::string & host)
+{
+  SSL_SESSION * session = SSL_get1_session(ssl);
+  if (session == nullptr)
+    return;
+
+  std::lock_guard<std::mutex> lock{mtx_};
+  auto & slot = sessions_[host];
+  if (slot != nullptr)
+    SSL_SESSION_free(slot);
+  slot = session;
+}
+
+std::vector<std::pair<std::string, std::string>> ssl_session_cache::export_sessions()
+{
+  std::vector<std::pair<std::string, std::string>> res;
+  std::lock_guard<std::mutex> lock{mtx_};
+  res.reserve(sessions_.size());
+  for (const auto & s : sessions_)
+  {
+    const int len = i2d_SSL_SESSION(s.second, nullptr);
+    if (len <= 0)
+      continue;
+    std::string der;
+    der.resize(static_cast<std::size_t>(len));
+    auto * p = reinterpret_cast<unsigned char*>(&der[0]);
+    if (i2d_SSL_SESSION(s.second, &p) != len)
+      continue;
+    res.emplace_back(s.first, std::move(der));
+  }
+  return res;
+}
+
+void ssl_session_cache::import_session(const std::string & host, core::string_view der)
+{
+  const auto * p = reinterpret_cast<const unsigned char*>(der.data());
+  SSL_SESSION * session = d2i_SSL_SESSION(nullptr, &p, static_cast<long>(der.size()));
+  if (session == nullptr)
+    return;
+  // the ticket knows its own lifetime; one that lapsed while the snapshot
+  // sat on disk would only buy a full handshake after a failed resumption.
+  if (SSL_SESSION_get_time(session) + SSL_SESSION_get_timeout(session)
+      <= static_cast<long>(std::time(nullptr)))
+  {
+    SSL_SESSION_free(session);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock{mtx_};
+  auto & slot = sessions_[host];
+  if (slot != nullptr)
+    SSL_SESSION_free(slot);
+  slot = session;
+}
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_IMPL_SSL_SESSION_CACHE_IPP
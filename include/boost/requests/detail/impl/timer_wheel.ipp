@@ -0,0 +1,161 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_IMPL_TIMER_WHEEL_IPP
+#define BOOST_REQUESTS_DETAIL_IMPL_TIMER_WHEEL_IPP
+
+#include <boost/requests/detail/timer_wheel.hpp>
+
+namespace boost {
+namespace requests {
+namespace detail {
+
+constexpr std::chrono::milliseconds timer_wheel_service::resolution;
+constexpr std::size_t timer_wheel_service::bucket_count;
+
+timer_wheel_service::timer_wheel_service(asio::execution_context & ctx)
+    : asio::detail::execution_context_service_base<timer_wheel_service>(ctx)
+    , last_tick_(clock_type::now())
+{
+  for (auto & head : buckets_)
+    head.next = head.prev = &head;
+}
+
+void timer_wheel_service::shutdown()
+{
+  std::lock_guard<std::mutex> lock{mtx_};
+  // abandon without firing; the owning operations are being torn down too.
+  for (auto & head : buckets_)
+    while (head.next != &head)
+      unlink_(*head.next);
+  armed_ = 0u;
+  running_ = false;
+  timer_.reset();
+}
+
+void timer_wheel_service::arm(timer_wheel_entry & e,
+                              clock_type::time_point deadline,
+                              asio::any_io_executor exec)
+{
+  std::lock_guard<std::mutex> lock{mtx_};
+  if (e.armed())
+  {
+    unlink_(e);
+    if (e.queued) // plucked back off a tick's due list, count it again
+    {
+      e.queued = false;
+      armed_++;
+    }
+  }
+  else
+    armed_++;
+  e.deadline = deadline;
+  link_(buckets_[slot_of_(deadline) % bucket_count], e);
+
+  if (!running_)
+  {
+    running_ = true;
+    if (!timer_)
+      timer_.emplace(std::move(exec));
+    schedule_();
+  }
+}
+
+void timer_wheel_service::cancel(timer_wheel_entry & e)
+{
+  std::unique_lock<std::mutex> lock{mtx_};
+  if (e.armed())
+  {
+    unlink_(e);
+    if (e.queued) // on a tick's due list; armed_ no longer counts it
+      e.queued = false;
+    else
+      armed_--;
+    return;
+  }
+  // not linked anywhere: its fire may be running right now, and the owner
+  // is free to destroy the entry once we return - wait the fire out.
+  while (firing_ == &e)
+    firing_cv_.wait(lock);
+}
+
+void timer_wheel_service::schedule_() // requires mtx_
+{
+  timer_->expires_after(resolution);
+  timer_->async_wait(
+      [this](system::error_code ec)
+      {
+        if (!ec)
+          tick_();
+      });
+}
+
+void timer_wheel_service::tick_()
+{
+  // move everything due onto a local list under the lock, fire outside of
+  // it - firing cancels sockets and may re-enter arm/cancel. Queued
+  // entries stay cancelable: cancel() unlinks them off the due list under
+  // mtx_, and each fire takes the lock to pop its entry, so only entries
+  // that are still due when their turn comes actually fire.
+  timer_wheel_entry due;
+  due.next = due.prev = &due;
+  {
+    std::lock_guard<std::mutex> lock{mtx_};
+    const auto now = clock_type::now();
+    std::size_t from = slot_of_(last_tick_), to = slot_of_(now);
+    if (to - from >= bucket_count) // overslept a full revolution
+      from = to - (bucket_count - 1u);
+    for (std::size_t s = from; s <= to; s++)
+    {
+      auto & head = buckets_[s % bucket_count];
+      for (auto itr = head.next; itr != &head;)
+      {
+        auto & e = *itr;
+        itr = itr->next;
+        if (e.deadline <= now) // else: a later revolution of the wheel
+        {
+          unlink_(e);
+          armed_--;
+          e.queued = true;
+          link_(due, e);
+        }
+      }
+    }
+    last_tick_ = now;
+    if (armed_ > 0u)
+      schedule_();
+    else
+      running_ = false;
+  }
+
+  for (;;)
+  {
+    timer_wheel_entry * e;
+    {
+      std::lock_guard<std::mutex> lock{mtx_};
+      if (due.next == &due)
+        break;
+      e = due.next;
+      unlink_(*e);
+      e->queued = false;
+      firing_ = e;
+    }
+    e->fire(*e);
+    {
+      std::lock_guard<std::mutex> lock{mtx_};
+      firing_ = nullptr;
+    }
+    // a cancel may be parked on this entry, see cancel()
+    firing_cv_.notify_all();
+  }
+}
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_IMPL_TIMER_WHEEL_IPP
@@ -0,0 +1,108 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_INFLATE_HPP
+#define BOOST_REQUESTS_DETAIL_INFLATE_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/beast/zlib/inflate_stream.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/system/error_code.hpp>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+// Incremental decoder for the gzip & deflate content-codings, built on
+// beast's raw inflate. The gzip member/zlib wrapper framing is handled
+// here, since beast only decompresses the raw deflate stream.
+struct inflater
+{
+  enum class coding
+  {
+    identity,
+    deflate,
+    gzip
+  };
+
+  /// Pick the coding for a Content-Encoding header value, identity if unsupported.
+  BOOST_REQUESTS_DECL static coding select_coding(core::string_view content_encoding);
+
+  BOOST_REQUESTS_DECL explicit inflater(coding cd);
+
+  inflater(const inflater & ) = delete;
+  inflater& operator=(const inflater & ) = delete;
+
+  /// The complete encoded stream, including any trailer, was consumed.
+  bool done() const { return state_ == state::complete; }
+
+  /// No staged input is left, more encoded bytes are needed to make progress.
+  bool needs_input() const { return in_pos_ == in_len_ && !done(); }
+
+  /// Space to read encoded bytes into; committed with commit().
+  asio::mutable_buffer input_buffer()
+  {
+    if (in_pos_ == in_len_)
+      in_pos_ = in_len_ = 0u;
+    return asio::buffer(in_ + in_len_, sizeof(in_) - in_len_);
+  }
+  void commit(std::size_t n) { in_len_ += n; }
+
+  /// Decode staged input into `out`; returns the number of bytes written.
+  BOOST_REQUESTS_DECL std::size_t write_output(asio::mutable_buffer out, system::error_code & ec);
+
+ private:
+  enum class state
+  {
+    header,
+    body,
+    trailer,
+    complete
+  };
+
+  // sub-states of the gzip member header
+  enum class hstate
+  {
+    fixed,
+    extra_len0,
+    extra_len1,
+    extra,
+    name,
+    comment,
+    hcrc
+  };
+
+  BOOST_REQUESTS_DECL bool parse_header_(system::error_code & ec);
+  BOOST_REQUESTS_DECL hstate next_hstate_(hstate st) const;
+
+  coding coding_;
+  state state_{state::header};
+  hstate hstate_{hstate::fixed};
+  beast::zlib::inflate_stream is_;
+
+  std::size_t header_pos_{0u};
+  unsigned char flags_{0u};
+  std::size_t extra_remaining_{0u};
+  std::size_t trailer_remaining_{0u};
+
+  char in_[BOOST_REQUESTS_CHUNK_SIZE];
+  std::size_t in_pos_{0u}, in_len_{0u};
+};
+
+}
+}
+}
+
+#if defined(BOOST_REQUESTS_HEADER_ONLY)
+#include <boost/requests/detail/impl/inflate.ipp>
+#endif
+
+#endif // BOOST_REQUESTS_DETAIL_INFLATE_HPP
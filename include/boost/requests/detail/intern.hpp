@@ -0,0 +1,114 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_INTERN_HPP
+#define BOOST_REQUESTS_DETAIL_INTERN_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/unordered_set.hpp>
+#include <algorithm>
+#include <mutex>
+#include <string>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+// An interning table for header values: intern() hands back a view that
+// stays valid for the table's lifetime, so a value repeated across many
+// requests is stored once instead of once per use. The handful of values
+// dominating real traffic comes out of a static table, costing neither a
+// lock nor storage; everything else lands in a bounded dynamic table
+// under a mutex. Oversized values, and new ones once the table is full,
+// come back unchanged - a caller needing owned storage checks interned()
+// and copies like before. Header *names* don't need this, beast's field
+// enum already covers the known ones.
+struct intern_table
+{
+  // generous for a per-session table; past these, interning repeating
+  // values would start paying for one-off ones
+  static constexpr std::size_t max_entries = 4096u;
+  static constexpr std::size_t max_length  = 128u;
+
+  core::string_view intern(core::string_view value)
+  {
+    const auto cm = common_(value);
+    if (cm.data() != nullptr)
+      return cm;
+    if (value.empty() || value.size() > max_length)
+      return value;
+    std::string key{value.begin(), value.end()};
+    std::lock_guard<std::mutex> lock{mtx_};
+    auto itr = entries_.find(key);
+    if (itr == entries_.end())
+    {
+      if (entries_.size() >= max_entries)
+        return value;
+      itr = entries_.insert(std::move(key)).first;
+    }
+    return core::string_view(itr->data(), itr->size());
+  }
+
+  /// whether intern() deduplicated `value` into stable storage, rather
+  /// than passing it through
+  static bool interned(core::string_view value, core::string_view result)
+  {
+    return result.data() != value.data();
+  }
+
+private:
+  // the values that dominate wire traffic; must stay sorted
+  static core::string_view common_(core::string_view value)
+  {
+    static const core::string_view table[] = {
+      "*/*",
+      "Accept-Encoding",
+      "application/json",
+      "application/json; charset=utf-8",
+      "application/octet-stream",
+      "application/x-www-form-urlencoded",
+      "br",
+      "bytes",
+      "chunked",
+      "close",
+      "deflate",
+      "gzip",
+      "gzip, deflate",
+      "gzip, deflate, br",
+      "identity",
+      "keep-alive",
+      "max-age=0",
+      "no-cache",
+      "no-cache, no-store, must-revalidate",
+      "no-store",
+      "private",
+      "public, max-age=31536000",
+      "text/html",
+      "text/html; charset=UTF-8",
+      "text/html; charset=utf-8",
+      "text/plain",
+      "text/plain; charset=utf-8",
+    };
+    const auto itr = std::lower_bound(std::begin(table), std::end(table), value);
+    if (itr != std::end(table) && *itr == value)
+      return *itr;
+    return core::string_view();
+  }
+
+  std::mutex mtx_;
+  boost::unordered_set<std::string> entries_;
+};
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_INTERN_HPP
@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_METRICS_HPP
+#define BOOST_REQUESTS_DETAIL_METRICS_HPP
+
+#include <boost/asio/associated_allocator.hpp>
+#include <boost/asio/associated_cancellation_slot.hpp>
+#include <boost/system/error_code.hpp>
+#include <atomic>
+#include <cstdint>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+// Counter block shared between a pool and its connections, all updated with
+// relaxed atomics so the per-request cost is a handful of uncontended adds.
+// Snapshots of it surface through basic_connection_pool::stats.
+struct pool_metrics
+{
+  std::atomic<std::uint64_t> requests_started{0u};
+  std::atomic<std::uint64_t> bytes_read{0u};
+  std::atomic<std::uint64_t> bytes_written{0u};
+  std::atomic<std::uint64_t> handshakes{0u};
+  std::atomic<std::uint64_t> keep_alive_closes{0u};
+  // a gauge: requests currently parked in async_get_connection
+  std::atomic<std::size_t>   requests_waiting{0u};
+
+  pool_metrics() = default;
+  // moved like connection's ongoing_requests_: the values carry over, any
+  // concurrent updates to the source are lost.
+  pool_metrics(pool_metrics && lhs) noexcept
+      : requests_started(lhs.requests_started.load()),
+        bytes_read(lhs.bytes_read.load()),
+        bytes_written(lhs.bytes_written.load()),
+        handshakes(lhs.handshakes.load()),
+        keep_alive_closes(lhs.keep_alive_closes.load()),
+        requests_waiting(lhs.requests_waiting.load())
+  {
+  }
+};
+
+inline void count_metric(std::atomic<std::uint64_t> & counter, std::uint64_t n = 1u)
+{
+  counter.fetch_add(n, std::memory_order_relaxed);
+}
+
+inline void count_metric(pool_metrics * metrics,
+                         std::atomic<std::uint64_t> pool_metrics::* counter,
+                         std::uint64_t n = 1u)
+{
+  if (metrics != nullptr)
+    (metrics->*counter).fetch_add(n, std::memory_order_relaxed);
+}
+
+// Forwards a (error_code, std::size_t) completion while adding the size to a
+// counter; the token's associated allocator and cancellation slot carry over.
+template<typename Token>
+struct counted_token
+{
+  std::atomic<std::uint64_t> * counter;
+  Token token;
+
+  using allocator_type = asio::associated_allocator_t<Token>;
+  allocator_type get_allocator() const {return asio::get_associated_allocator(token);}
+
+  using cancellation_slot_type = asio::associated_cancellation_slot_t<Token>;
+  cancellation_slot_type get_cancellation_slot() const {return asio::get_associated_cancellation_slot(token);}
+
+  void operator()(system::error_code ec, std::size_t n)
+  {
+    counter->fetch_add(n, std::memory_order_relaxed);
+    std::move(token)(ec, n);
+  }
+};
+
+template<typename Token>
+counted_token<typename std::decay<Token>::type>
+count_bytes(std::atomic<std::uint64_t> & counter, Token && token)
+{
+  return counted_token<typename std::decay<Token>::type>{&counter, std::forward<Token>(token)};
+}
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_METRICS_HPP
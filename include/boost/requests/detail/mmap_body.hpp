@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_MMAP_BODY_HPP
+#define BOOST_REQUESTS_DETAIL_MMAP_BODY_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/beast/core/file.hpp>
+#include <boost/beast/http/message.hpp>
+#include <boost/core/exchange.hpp>
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <utility>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+// An upload body for files. Regular files of at least
+// BOOST_REQUESTS_MMAP_THRESHOLD bytes get memory-mapped (advised for
+// sequential access) and serialized as a single span straight out of the
+// page cache. Smaller files, files that fail to map and every file on
+// windows are read chunk by chunk through a staging buffer, like
+// beast::http::file_body.
+struct mmap_body
+{
+  struct value_type
+  {
+    value_type() = default;
+    value_type(value_type && lhs) noexcept
+        : map_(boost::exchange(lhs.map_, nullptr)),
+          size_(boost::exchange(lhs.size_, 0u)),
+          file_(std::move(lhs.file_))
+    {
+    }
+
+    value_type & operator=(value_type && lhs) noexcept
+    {
+      close_();
+      map_  = boost::exchange(lhs.map_, nullptr);
+      size_ = boost::exchange(lhs.size_, 0u);
+      file_ = std::move(lhs.file_);
+      return *this;
+    }
+
+    ~value_type()
+    {
+      close_();
+    }
+
+    BOOST_REQUESTS_DECL void open(const char * path, system::error_code & ec);
+
+    bool is_mapped()     const {return map_ != nullptr;}
+    std::uint64_t size() const {return size_;}
+
+   private:
+    friend struct mmap_body;
+
+    BOOST_REQUESTS_DECL void close_();
+
+    void * map_ = nullptr;
+    std::uint64_t size_ = 0u;
+    beast::file file_;
+  };
+
+  static std::uint64_t size(const value_type & v)
+  {
+    return v.size();
+  }
+
+  struct writer
+  {
+    using const_buffers_type = asio::const_buffer;
+
+    template<bool IsRequest, typename Fields>
+    writer(const beast::http::header<IsRequest, Fields> &, value_type & body)
+        : body_(body)
+    {
+    }
+
+    void init(system::error_code & ec)
+    {
+      ec = {};
+      remain_ = body_.size_;
+    }
+
+    boost::optional<std::pair<const_buffers_type, bool>> get(system::error_code & ec)
+    {
+      ec = {};
+      if (remain_ == 0u)
+        return boost::none;
+
+      if (body_.is_mapped())
+      {
+        // the whole file in one buffer - the transport reads it out of
+        // the page cache without a copy on our side.
+        const auto n = static_cast<std::size_t>(remain_);
+        remain_ = 0u;
+        return std::make_pair(const_buffers_type(body_.map_, n), false);
+      }
+
+      const auto n = body_.file_.read(
+          buffer_, (std::min)(remain_, static_cast<std::uint64_t>(sizeof(buffer_))), ec);
+      if (ec)
+        return boost::none;
+      remain_ -= n;
+      return std::make_pair(const_buffers_type(buffer_, n), remain_ > 0u);
+    }
+
+   private:
+    value_type & body_;
+    std::uint64_t remain_{0u};
+    char buffer_[BOOST_REQUESTS_CHUNK_SIZE];
+  };
+};
+
+}
+}
+}
+
+#if defined(BOOST_REQUESTS_HEADER_ONLY)
+#include <boost/requests/detail/impl/mmap_body.ipp>
+#endif
+
+#endif // BOOST_REQUESTS_DETAIL_MMAP_BODY_HPP
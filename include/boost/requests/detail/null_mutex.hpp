@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_NULL_MUTEX_HPP
+#define BOOST_REQUESTS_DETAIL_NULL_MUTEX_HPP
+
+#if defined(BOOST_REQUESTS_SINGLE_THREADED)
+#include <boost/asem/st.hpp>
+#else
+#include <boost/asem/mt.hpp>
+#endif
+
+#include <boost/asio/append.hpp>
+#include <boost/asio/associated_executor.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <mutex>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+// A mutex that doesn't lock, for single-io-thread deployments where no
+// contention is possible (selected through BOOST_REQUESTS_NO_LOCKING, see
+// config.hpp). It models just enough of asem's mutex to satisfy this
+// library's call sites; async_lock still completes through a post, as the
+// real mutexes do.
+template<typename Executor>
+struct basic_null_mutex
+{
+  using executor_type = Executor;
+
+  explicit basic_null_mutex(executor_type exec) : exec_(std::move(exec)) {}
+
+  template<typename ExecutionContext>
+  explicit basic_null_mutex(ExecutionContext & context,
+                            typename asio::constraint<
+                                asio::is_convertible<ExecutionContext &, asio::execution_context &>::value
+                            >::type = 0)
+      : exec_(context.get_executor()) {}
+
+  executor_type get_executor() {return exec_;}
+
+  void lock() {}
+  void lock(system::error_code & ) {}
+  bool try_lock() {return true;}
+  void unlock() {}
+
+  template<typename CompletionToken>
+  auto async_lock(CompletionToken && token)
+  {
+    return asio::async_initiate<CompletionToken, void(system::error_code)>(
+        [this](auto handler)
+        {
+          auto exec = asio::get_associated_executor(handler, exec_);
+          asio::post(std::move(exec),
+                     asio::append(std::move(handler), system::error_code{}));
+        }, token);
+  }
+
+ private:
+  executor_type exec_;
+};
+
+}
+}
+
+// the locking call sites spell asem::lock / asem::async_lock with qualified
+// names, so the null mutex hooks in through overloads in that namespace.
+namespace asem
+{
+
+template<typename Executor>
+lock_guard<requests::detail::basic_null_mutex<Executor>>
+lock(requests::detail::basic_null_mutex<Executor> & mtx, system::error_code & )
+{
+  return lock_guard<requests::detail::basic_null_mutex<Executor>>{mtx, std::adopt_lock};
+}
+
+template<typename Executor, typename CompletionToken>
+auto async_lock(requests::detail::basic_null_mutex<Executor> & mtx,
+                CompletionToken && token)
+{
+  using guard_type = lock_guard<requests::detail::basic_null_mutex<Executor>>;
+  return asio::async_initiate<CompletionToken, void(system::error_code, guard_type)>(
+      [&mtx](auto handler)
+      {
+        auto exec = asio::get_associated_executor(handler, mtx.get_executor());
+        asio::post(std::move(exec),
+                   asio::append(std::move(handler), system::error_code{},
+                                guard_type{mtx, std::adopt_lock}));
+      }, token);
+}
+
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_NULL_MUTEX_HPP
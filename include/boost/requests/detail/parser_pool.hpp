@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_PARSER_POOL_HPP
+#define BOOST_REQUESTS_DETAIL_PARSER_POOL_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/core/exchange.hpp>
+#include <boost/json/stream_parser.hpp>
+#include <mutex>
+#include <vector>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+struct parser_lease;
+
+// A free-list of json::stream_parsers, each constructed once over a
+// fixed temporary-storage buffer. Reuse keeps the parser's internally
+// grown temporary storage warm, so steady-state parses stop paying
+// parser construction and arena growth per document. The DOM storage is
+// whatever the caller passes to acquire() - it outlives the lease.
+struct parser_pool
+{
+  parser_pool() = default;
+  parser_pool(const parser_pool & ) = delete;
+  BOOST_REQUESTS_DECL ~parser_pool();
+
+  // hands out a parser reset to parse into `ptr`.
+  BOOST_REQUESTS_DECL parser_lease acquire(::boost::json::storage_ptr ptr);
+
+ private:
+  friend struct parser_lease;
+
+  struct slot_t
+  {
+    unsigned char temp_buffer[BOOST_REQUESTS_CHUNK_SIZE];
+    ::boost::json::stream_parser parser{::boost::json::storage_ptr(),
+                                        ::boost::json::parse_options(),
+                                        temp_buffer, sizeof(temp_buffer)};
+  };
+
+  BOOST_REQUESTS_DECL void put_(slot_t * slot);
+
+  // keep at most this many parsers around; the rest goes back to the heap.
+  constexpr static std::size_t max_free_parsers = 16u;
+
+  std::mutex mtx_;
+  std::vector<slot_t*> free_;
+};
+
+// Owns one checked out parser; the slot goes back to the pool on
+// destruction. The value released from the parser is not tied to the
+// lease in any way.
+struct parser_lease
+{
+  parser_lease() = default;
+  parser_lease(parser_lease && lhs) noexcept
+      : pool_(boost::exchange(lhs.pool_, nullptr)),
+        slot_(boost::exchange(lhs.slot_, nullptr)) {}
+
+  parser_lease & operator=(parser_lease && lhs) noexcept
+  {
+    if (slot_ != nullptr)
+      pool_->put_(slot_);
+    pool_ = boost::exchange(lhs.pool_, nullptr);
+    slot_ = boost::exchange(lhs.slot_, nullptr);
+    return *this;
+  }
+
+  ~parser_lease()
+  {
+    if (slot_ != nullptr)
+      pool_->put_(slot_);
+  }
+
+  ::boost::json::stream_parser & parser() {return slot_->parser;}
+
+ private:
+  friend struct parser_pool;
+  parser_lease(parser_pool * pool, parser_pool::slot_t * slot)
+      : pool_(pool), slot_(slot) {}
+
+  parser_pool * pool_ = nullptr;
+  parser_pool::slot_t * slot_ = nullptr;
+};
+
+// The pool shared by as_json and the json read functions.
+BOOST_REQUESTS_DECL parser_pool & default_parser_pool();
+
+}
+}
+}
+
+#if defined(BOOST_REQUESTS_HEADER_ONLY)
+#include <boost/requests/detail/impl/parser_pool.ipp>
+#endif
+
+#endif // BOOST_REQUESTS_DETAIL_PARSER_POOL_HPP
@@ -0,0 +1,57 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_PCTENCODE_HPP
+#define BOOST_REQUESTS_DETAIL_PCTENCODE_HPP
+
+#include <boost/core/detail/string_view.hpp>
+#include <boost/url/grammar/charset.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
+#include <string>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+// the unreserved set of rfc 3986. Escaping everything else can only
+// over-escape compared to boost.url's per-component rules, never
+// under-escape, so the result always decodes to the same bytes.
+constexpr urls::grammar::lut_chars pct_unreserved =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz"
+    "0123456789-._~";
+
+// Append `in` percent-encoded to `out`, classify-and-copy style: runs of
+// unreserved characters are found with boost.url's vectorized charset
+// scan and appended in one block; only escapes branch per byte.
+inline void pctencode(core::string_view in, std::string & out)
+{
+  static constexpr char hex[] = "0123456789ABCDEF";
+  const char * it = in.data();
+  const char * const end = it + in.size();
+  while (it != end)
+  {
+    const char * run = urls::grammar::find_if_not(it, end, pct_unreserved);
+    out.append(it, run);
+    it = run;
+    while (it != end && !pct_unreserved(*it))
+    {
+      const unsigned char c = static_cast<unsigned char>(*it++);
+      const char esc[3] = {'%', hex[c >> 4u], hex[c & 0xFu]};
+      out.append(esc, 3u);
+    }
+  }
+}
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_PCTENCODE_HPP
@@ -0,0 +1,336 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_SBO_BUFFER_HPP
+#define BOOST_REQUESTS_DETAIL_SBO_BUFFER_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/container/pmr/polymorphic_allocator.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace boost {
+namespace requests {
+namespace detail {
+
+/* A contiguous DynamicBuffer with BOOST_REQUESTS_SBO_BUFFER_SIZE bytes of
+   inline storage, used as the body buffer of a response: most responses fit
+   and never touch the allocator. Larger bodies spill into a single block
+   obtained from the allocator's resource. A move steals the spilled block
+   or memcpys the inline bytes, so moved-to buffers never dangle into the
+   source.
+
+   With set_spill_threshold armed (see request_options::spill_threshold), a
+   body growing past the threshold spills once more - into an anonymous,
+   already-unlinked temp file, with the memory block demoted to a staging
+   area that is flushed on every commit. cdata() then hands the body out as
+   a read-only mapping of that file, so readers (string_view, as_json, ...)
+   see one contiguous range as usual while the pages stay evictable and
+   peak RSS stays bounded. POSIX only; elsewhere the threshold is ignored. */
+class sbo_buffer
+{
+public:
+  using allocator_type       = container::pmr::polymorphic_allocator<char>;
+  using const_buffers_type   = asio::const_buffer;
+  using mutable_buffers_type = asio::mutable_buffer;
+
+  sbo_buffer(allocator_type allocator = {}) noexcept : allocator_(allocator) {}
+
+  sbo_buffer(const sbo_buffer & rhs) : allocator_(rhs.allocator_)
+  {
+    const auto cd = rhs.cdata();
+    std::memcpy(prepare(cd.size()).data(), cd.data(), cd.size());
+    commit(cd.size());
+  }
+
+  sbo_buffer(sbo_buffer && rhs) noexcept : allocator_(rhs.allocator_)
+  {
+    take_(rhs);
+  }
+
+  sbo_buffer & operator=(const sbo_buffer & rhs)
+  {
+    if (this != &rhs)
+    {
+      clear_();
+      const auto cd = rhs.cdata();
+      std::memcpy(prepare(cd.size()).data(), cd.data(), cd.size());
+      commit(cd.size());
+    }
+    return *this;
+  }
+
+  sbo_buffer & operator=(sbo_buffer && rhs) noexcept
+  {
+    if (this != &rhs)
+    {
+      clear_();
+      take_(rhs);
+    }
+    return *this;
+  }
+
+  ~sbo_buffer()
+  {
+    clear_();
+  }
+
+  std::size_t size()     const noexcept
+  {
+#if !defined(_WIN32)
+    if (fd_ >= 0)
+      return (file_size_ - file_pos_) + (size_ - pos_);
+#endif
+    return size_ - pos_;
+  }
+  std::size_t max_size() const noexcept { return (std::numeric_limits<std::size_t>::max)(); }
+  std::size_t capacity() const noexcept { return capacity_ - pos_; }
+
+  const_buffers_type data()  const noexcept { return cdata(); }
+  const_buffers_type cdata() const noexcept
+  {
+#if !defined(_WIN32)
+    if (fd_ >= 0)
+    {
+      if (map_size_ != file_size_)
+      {
+        if (map_ != nullptr)
+          ::munmap(map_, map_size_);
+        map_ = nullptr;
+        map_size_ = 0u;
+        if (file_size_ > 0u)
+        {
+          const auto m = ::mmap(nullptr, file_size_, PROT_READ, MAP_SHARED, fd_, 0);
+          if (m != MAP_FAILED)
+          {
+            map_ = m;
+            map_size_ = file_size_;
+          }
+        }
+      }
+      return {static_cast<const char*>(map_) + file_pos_, map_ ? file_size_ - file_pos_ : 0u};
+    }
+#endif
+    return {begin_ + pos_, size_ - pos_};
+  }
+
+  mutable_buffers_type prepare(std::size_t n)
+  {
+#if !defined(_WIN32)
+    if (fd_ < 0 && spill_threshold_ > 0u && (size_ - pos_) + n > spill_threshold_)
+      spill_();
+    // once spilled the staging area turns over every commit, so a
+    // Content-Length preallocation must not re-balloon the heap: hand out
+    // at most a chunk and let the read loop re-prepare.
+    if (fd_ >= 0)
+      n = (std::min)(n, std::size_t(BOOST_REQUESTS_CHUNK_SIZE));
+#endif
+    if (capacity_ - size_ < n)
+      grow_(n);
+    return {begin_ + size_, n};
+  }
+
+  void commit(std::size_t n) noexcept
+  {
+    size_ += (std::min)(n, capacity_ - size_);
+#if !defined(_WIN32)
+    if (fd_ >= 0)
+      flush_();
+#endif
+  }
+
+  void consume(std::size_t n) noexcept
+  {
+#if !defined(_WIN32)
+    if (fd_ >= 0)
+    {
+      const auto f = (std::min)(n, file_size_ - file_pos_);
+      file_pos_ += f;
+      n -= f;
+    }
+#endif
+    pos_ += (std::min)(n, size_ - pos_);
+    if (pos_ == size_)
+      pos_ = size_ = 0u;
+  }
+
+  allocator_type get_allocator() const noexcept { return allocator_; }
+
+  /// Spill the body to an anonymous temp file once it grows past n bytes.
+  /// Zero (the default) never spills; ignored on non-POSIX platforms.
+  void set_spill_threshold(std::size_t n) noexcept { spill_threshold_ = n; }
+
+  /// The body lives in a temp file and cdata() hands out a mapped view.
+  bool spilled() const noexcept
+  {
+#if !defined(_WIN32)
+    return fd_ >= 0;
+#else
+    return false;
+#endif
+  }
+
+  /// errno of a failed write to the spill file - the bytes that did not fit
+  /// stay staged in memory, so the view is truncated until space frees up.
+  int spill_errno() const noexcept
+  {
+#if !defined(_WIN32)
+    return spill_errno_;
+#else
+    return 0;
+#endif
+  }
+
+private:
+  void grow_(std::size_t n)
+  {
+    auto next_cap = capacity_ * 2u;
+    if (next_cap - size_ < n)
+      next_cap = size_ + n;
+    const auto next = static_cast<char*>(allocator_.resource()->allocate(next_cap));
+    std::memcpy(next, begin_, size_);
+    if (begin_ != sbo_)
+      allocator_.resource()->deallocate(begin_, capacity_);
+    begin_ = next;
+    capacity_ = next_cap;
+  }
+
+  void clear_()
+  {
+    if (begin_ != sbo_)
+      allocator_.resource()->deallocate(begin_, capacity_);
+    begin_ = sbo_;
+    capacity_ = sizeof(sbo_);
+    pos_ = size_ = 0u;
+#if !defined(_WIN32)
+    if (map_ != nullptr)
+      ::munmap(map_, map_size_);
+    map_ = nullptr;
+    map_size_ = 0u;
+    if (fd_ >= 0)
+      ::close(fd_);
+    fd_ = -1;
+    file_pos_ = file_size_ = 0u;
+    spill_errno_ = 0;
+#endif
+  }
+
+  void take_(sbo_buffer & rhs) noexcept
+  {
+    if (rhs.begin_ != rhs.sbo_)
+    {
+      begin_ = rhs.begin_;
+      capacity_ = rhs.capacity_;
+      rhs.begin_ = rhs.sbo_;
+      rhs.capacity_ = sizeof(rhs.sbo_);
+    }
+    else
+      std::memcpy(sbo_, rhs.sbo_, rhs.size_);
+    pos_  = rhs.pos_;
+    size_ = rhs.size_;
+    rhs.pos_ = rhs.size_ = 0u;
+    spill_threshold_ = rhs.spill_threshold_;
+#if !defined(_WIN32)
+    fd_          = rhs.fd_;
+    file_pos_    = rhs.file_pos_;
+    file_size_   = rhs.file_size_;
+    map_         = rhs.map_;
+    map_size_    = rhs.map_size_;
+    spill_errno_ = rhs.spill_errno_;
+    rhs.fd_ = -1;
+    rhs.file_pos_ = rhs.file_size_ = 0u;
+    rhs.map_ = nullptr;
+    rhs.map_size_ = 0u;
+    rhs.spill_errno_ = 0;
+#endif
+  }
+
+#if !defined(_WIN32)
+  /* Open the (already unlinked) spill file and move the buffered bytes out.
+     If no temp file can be had the threshold is dropped and the body simply
+     keeps growing in memory - spilling is an optimization, not a contract. */
+  void spill_()
+  {
+    int fd = -1;
+#if defined(O_TMPFILE)
+    fd = ::open(P_tmpdir, O_TMPFILE | O_RDWR | O_CLOEXEC, S_IRUSR | S_IWUSR);
+#endif
+    if (fd < 0)
+    {
+      char tmpl[] = P_tmpdir "/boost-requests-spill-XXXXXX";
+      fd = ::mkstemp(tmpl);
+      if (fd >= 0)
+        ::unlink(tmpl);
+    }
+    if (fd < 0)
+    {
+      spill_threshold_ = 0u;
+      return;
+    }
+    fd_ = fd;
+    std::memmove(begin_, begin_ + pos_, size_ - pos_);
+    size_ -= pos_;
+    pos_ = 0u;
+    flush_();
+  }
+
+  /* Append the staged bytes to the spill file. A short or failed write
+     leaves the remainder staged (retried on the next commit) and records
+     errno so the stream can surface it. */
+  void flush_() noexcept
+  {
+    std::size_t off = 0u;
+    while (off < size_)
+    {
+      const auto n = ::write(fd_, begin_ + off, size_ - off);
+      if (n < 0)
+      {
+        spill_errno_ = errno;
+        break;
+      }
+      off += static_cast<std::size_t>(n);
+    }
+    if (off == size_)
+      spill_errno_ = 0;
+    std::memmove(begin_, begin_ + off, size_ - off);
+    file_size_ += off;
+    size_ -= off;
+  }
+#endif
+
+  allocator_type allocator_;
+  char sbo_[BOOST_REQUESTS_SBO_BUFFER_SIZE];
+  char * begin_ = sbo_;
+  std::size_t capacity_ = sizeof(sbo_);
+  std::size_t pos_  = 0u;
+  std::size_t size_ = 0u;
+  std::size_t spill_threshold_ = 0u;
+#if !defined(_WIN32)
+  int fd_ = -1;
+  std::size_t file_pos_  = 0u;
+  std::size_t file_size_ = 0u;
+  mutable void * map_ = nullptr;
+  mutable std::size_t map_size_ = 0u;
+  int spill_errno_ = 0;
+#endif
+};
+
+} // detail
+} // requests
+} // boost
+
+#endif // BOOST_REQUESTS_DETAIL_SBO_BUFFER_HPP
@@ -0,0 +1,253 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_SEGMENTED_BUFFER_HPP
+#define BOOST_REQUESTS_DETAIL_SEGMENTED_BUFFER_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/container/pmr/polymorphic_allocator.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace boost {
+namespace requests {
+namespace detail {
+
+/* A segmented (rope) DynamicBuffer: the body grows by appending fixed
+   BOOST_REQUESTS_SEGMENT_SIZE blocks from the allocator's resource, so a
+   large download never reallocates-and-copies what is already received.
+   data() is therefore a buffer *sequence*; coalesce() flattens into one
+   contiguous block when the caller actually needs contiguity. Move-only:
+   a body measured in blocks is nothing to copy by accident. */
+class segmented_buffer
+{
+  struct block
+  {
+    char * data;
+    std::size_t size;
+  };
+
+public:
+  using allocator_type = container::pmr::polymorphic_allocator<char>;
+
+  constexpr static std::size_t segment_size = BOOST_REQUESTS_SEGMENT_SIZE;
+
+  // a readable or writable window of the block chain. Forward range of
+  // asio buffers; blocks may differ in size after a coalesce.
+  template<typename Buffer>
+  class buffers_type
+  {
+  public:
+    using value_type = Buffer;
+
+    class const_iterator
+    {
+    public:
+      using value_type        = Buffer;
+      using reference         = Buffer;
+      using pointer           = const Buffer*;
+      using difference_type   = std::ptrdiff_t;
+      using iterator_category = std::forward_iterator_tag;
+
+      const_iterator() = default;
+
+      Buffer operator*() const
+      {
+        // clamped both ways so blocks fully outside the window come out
+        // as empty buffers instead of wrapping around.
+        const auto bend = start_ + blocks_[idx_].size;
+        const auto lo = (std::min)((std::max)(start_, from_), bend);
+        const auto hi = (std::max)((std::min)(bend, to_), lo);
+        return Buffer(blocks_[idx_].data + (lo - start_), hi - lo);
+      }
+
+      const_iterator & operator++()
+      {
+        start_ += blocks_[idx_].size;
+        idx_++;
+        return *this;
+      }
+      const_iterator operator++(int) { auto tmp = *this; ++*this; return tmp; }
+
+      bool operator==(const const_iterator & rhs) const { return idx_ == rhs.idx_; }
+      bool operator!=(const const_iterator & rhs) const { return idx_ != rhs.idx_; }
+
+    private:
+      friend class buffers_type;
+      const_iterator(const block * blocks, std::size_t idx,
+                     std::size_t start, std::size_t from, std::size_t to)
+          : blocks_(blocks), idx_(idx), start_(start), from_(from), to_(to) {}
+
+      const block * blocks_ = nullptr;
+      std::size_t idx_ = 0u, start_ = 0u, from_ = 0u, to_ = 0u;
+    };
+
+    const_iterator begin() const { return {blocks_, first_, first_start_, from_, to_}; }
+    const_iterator end()   const { return {blocks_, last_,  0u,           from_, to_}; }
+
+  private:
+    friend class segmented_buffer;
+    buffers_type(const block * blocks, std::size_t n,
+                 std::size_t from, std::size_t to)
+        : blocks_(blocks), from_(from), to_(to)
+    {
+      std::size_t start = 0u;
+      for (std::size_t i = 0u; i < n; i++)
+      {
+        const auto next = start + blocks[i].size;
+        if (next <= from)
+        {
+          first_ = i + 1u;
+          first_start_ = next;
+        }
+        if (start < to)
+          last_ = i + 1u;
+        start = next;
+      }
+      if (last_ < first_)
+        last_ = first_;
+    }
+
+    const block * blocks_;
+    std::size_t from_, to_;
+    std::size_t first_ = 0u, first_start_ = 0u, last_ = 0u;
+  };
+
+  using const_buffers_type   = buffers_type<asio::const_buffer>;
+  using mutable_buffers_type = buffers_type<asio::mutable_buffer>;
+
+  segmented_buffer(allocator_type allocator = {}) noexcept : allocator_(allocator) {}
+
+  segmented_buffer(segmented_buffer && rhs) noexcept
+      : allocator_(rhs.allocator_), blocks_(std::move(rhs.blocks_)),
+        begin_(rhs.begin_), size_(rhs.size_), prepared_(rhs.prepared_)
+  {
+    rhs.blocks_.clear();
+    rhs.begin_ = rhs.size_ = rhs.prepared_ = 0u;
+  }
+
+  segmented_buffer & operator=(segmented_buffer && rhs) noexcept
+  {
+    if (this != &rhs)
+    {
+      release_();
+      allocator_ = rhs.allocator_;
+      blocks_    = std::move(rhs.blocks_);
+      begin_     = rhs.begin_;
+      size_      = rhs.size_;
+      prepared_  = rhs.prepared_;
+      rhs.blocks_.clear();
+      rhs.begin_ = rhs.size_ = rhs.prepared_ = 0u;
+    }
+    return *this;
+  }
+
+  segmented_buffer(const segmented_buffer &) = delete;
+  segmented_buffer & operator=(const segmented_buffer &) = delete;
+
+  ~segmented_buffer() { release_(); }
+
+  std::size_t size()     const noexcept { return size_; }
+  std::size_t max_size() const noexcept { return (std::numeric_limits<std::size_t>::max)(); }
+  std::size_t capacity() const noexcept { return total_() - begin_; }
+
+  const_buffers_type data() const noexcept
+  {
+    return {blocks_.data(), blocks_.size(), begin_, begin_ + size_};
+  }
+  const_buffers_type cdata() const noexcept { return data(); }
+
+  mutable_buffers_type prepare(std::size_t n)
+  {
+    while (total_() - begin_ - size_ < n)
+    {
+      const auto p = static_cast<char*>(allocator_.resource()->allocate(segment_size));
+      blocks_.push_back(block{p, segment_size});
+    }
+    prepared_ = n;
+    return {blocks_.data(), blocks_.size(), begin_ + size_, begin_ + size_ + n};
+  }
+
+  void commit(std::size_t n) noexcept
+  {
+    size_ += (std::min)(n, prepared_);
+    prepared_ = 0u;
+  }
+
+  void consume(std::size_t n) noexcept
+  {
+    n = (std::min)(n, size_);
+    begin_ += n;
+    size_  -= n;
+    while (!blocks_.empty() && begin_ >= blocks_.front().size)
+    {
+      begin_ -= blocks_.front().size;
+      allocator_.resource()->deallocate(blocks_.front().data, blocks_.front().size);
+      blocks_.erase(blocks_.begin());
+    }
+  }
+
+  /// Flatten the readable bytes into one contiguous block and view them.
+  /// Only this pays the memcpy the segmented growth avoided; repeated
+  /// calls on an already-flat buffer are free.
+  core::string_view coalesce()
+  {
+    if (blocks_.empty())
+      return {};
+    if (begin_ == 0u && size_ <= blocks_.front().size)
+      return {blocks_.front().data, size_};
+
+    const auto cap  = size_ > 0u ? size_ : std::size_t(1u);
+    const auto flat = static_cast<char*>(allocator_.resource()->allocate(cap));
+    std::size_t off = 0u;
+    for (auto cb : data())
+    {
+      std::memcpy(flat + off, cb.data(), cb.size());
+      off += cb.size();
+    }
+    release_();
+    blocks_.push_back(block{flat, cap});
+    begin_ = 0u;
+    size_  = off;
+    return {flat, size_};
+  }
+
+  allocator_type get_allocator() const noexcept { return allocator_; }
+
+private:
+  std::size_t total_() const noexcept
+  {
+    std::size_t n = 0u;
+    for (const auto & b : blocks_)
+      n += b.size;
+    return n;
+  }
+
+  void release_() noexcept
+  {
+    for (const auto & b : blocks_)
+      allocator_.resource()->deallocate(b.data, b.size);
+    blocks_.clear();
+    begin_ = size_ = prepared_ = 0u;
+  }
+
+  allocator_type allocator_;
+  container::small_vector<block, 8u> blocks_;
+  std::size_t begin_    = 0u;
+  std::size_t size_     = 0u;
+  std::size_t prepared_ = 0u;
+};
+
+} // detail
+} // requests
+} // boost
+
+#endif // BOOST_REQUESTS_DETAIL_SEGMENTED_BUFFER_HPP
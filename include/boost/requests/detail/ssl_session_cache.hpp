@@ -0,0 +1,79 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_SSL_SESSION_CACHE_HPP
+#define BOOST_REQUESTS_DETAIL_SSL_SESSION_CACHE_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/unordered_map.hpp>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+extern "C"
+{
+typedef struct ssl_st SSL;
+typedef struct ssl_session_st SSL_SESSION;
+}
+
+namespace boost {
+namespace requests {
+namespace detail {
+
+// Caches one TLS session per host so new connections of a pool resume via
+// session tickets instead of running a full handshake.
+struct ssl_session_cache
+{
+  ssl_session_cache() = default;
+  ssl_session_cache(const ssl_session_cache & ) = delete;
+  ssl_session_cache& operator=(const ssl_session_cache & ) = delete;
+  BOOST_REQUESTS_DECL ~ssl_session_cache();
+
+  // attach a cached session to the handle before the handshake.
+  BOOST_REQUESTS_DECL void do_apply(SSL * ssl, const std::string & host);
+  // remember the (possibly freshly issued) session after the handshake.
+  BOOST_REQUESTS_DECL void do_store(SSL * ssl, const std::string & host);
+
+  // the cached sessions in DER form, host by host, for a warm-state
+  // snapshot - see basic_session::save_state.
+  BOOST_REQUESTS_DECL std::vector<std::pair<std::string, std::string>> export_sessions();
+  // restore a session serialized by export_sessions(). A blob that does
+  // not decode or whose own lifetime ran out is dropped silently - the
+  // ticket carries its expiry, so no external TTL is needed.
+  BOOST_REQUESTS_DECL void import_session(const std::string & host, core::string_view der);
+
+ private:
+  std::mutex mtx_;
+  boost::unordered_map<std::string, SSL_SESSION*> sessions_;
+};
+
+template <typename Stream>
+inline void apply_session(ssl_session_cache * cache, Stream * stream, const std::string & host)
+{
+  if (cache != nullptr)
+    cache->do_apply(stream->native_handle(), host);
+}
+inline void apply_session(ssl_session_cache *, std::nullptr_t, const std::string &) {}
+
+template <typename Stream>
+inline void store_session(ssl_session_cache * cache, Stream * stream, const std::string & host)
+{
+  if (cache != nullptr)
+    cache->do_store(stream->native_handle(), host);
+}
+inline void store_session(ssl_session_cache *, std::nullptr_t, const std::string &) {}
+
+}
+}
+}
+
+#if defined(BOOST_REQUESTS_HEADER_ONLY)
+#include <boost/requests/detail/impl/ssl_session_cache.ipp>
+#endif
+#endif // BOOST_REQUESTS_DETAIL_SSL_SESSION_CACHE_HPP
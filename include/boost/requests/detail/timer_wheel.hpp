@@ -0,0 +1,175 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DETAIL_TIMER_WHEEL_HPP
+#define BOOST_REQUESTS_DETAIL_TIMER_WHEEL_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/basic_waitable_timer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/execution_context.hpp>
+#include <boost/asio/query.hpp>
+#include <boost/beast/core/stream_traits.hpp>
+#include <boost/optional.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+namespace boost {
+namespace requests {
+namespace detail {
+
+// One deadline, intrusively linked into the wheel below. Owned by the
+// operation it guards; unlinked means disarmed. `fire` runs on whichever
+// thread drives the wheel's tick, so it must only do thread-safe work -
+// the request ops use it to cancel the socket and note the expiry.
+struct timer_wheel_entry
+{
+  timer_wheel_entry * next = nullptr;
+  timer_wheel_entry * prev = nullptr;
+  std::chrono::steady_clock::time_point deadline{};
+  void (*fire)(timer_wheel_entry &) = nullptr;
+  // collected by a tick but not fired yet, guarded by the service's
+  // mutex; lets cancel() pluck the entry back off the due list
+  bool queued = false;
+
+  bool armed() const { return next != nullptr; }
+};
+
+// A hashed timer wheel shared by everything on one execution context:
+// arming a request deadline is an O(1) bucket insert and disarming an O(1)
+// unlink, instead of a heap-allocated asio timer per request. One tick
+// timer per context drives all deadlines at `resolution` granularity -
+// coarse on purpose, request timeouts are liveness bounds, not stopwatches.
+// Deadlines beyond one revolution stay parked in their bucket and get
+// re-checked when the cursor comes around again.
+struct timer_wheel_service final
+    : asio::detail::execution_context_service_base<timer_wheel_service>
+{
+  using clock_type = std::chrono::steady_clock;
+
+  constexpr static std::chrono::milliseconds resolution{100};
+  constexpr static std::size_t bucket_count = 512u;
+
+  BOOST_REQUESTS_DECL explicit timer_wheel_service(asio::execution_context & ctx);
+  BOOST_REQUESTS_DECL void shutdown() override;
+
+  /// Arm `e` to fire at `deadline`. Re-arming an armed entry moves it.
+  /// The executor is used to start the tick timer the first time around.
+  BOOST_REQUESTS_DECL void arm(timer_wheel_entry & e,
+                               clock_type::time_point deadline,
+                               asio::any_io_executor exec);
+
+  /// Disarm `e`; a no-op if it is not armed or already fired. Blocks out
+  /// a fire of `e` running concurrently on the tick thread, so the owner
+  /// is free to destroy `e` once this returns.
+  BOOST_REQUESTS_DECL void cancel(timer_wheel_entry & e);
+
+ private:
+  void schedule_();
+  void tick_();
+
+  static std::size_t slot_of_(clock_type::time_point tp)
+  {
+    return static_cast<std::size_t>(tp.time_since_epoch() / resolution);
+  }
+
+  static void link_(timer_wheel_entry & head, timer_wheel_entry & e)
+  {
+    e.prev = head.prev;
+    e.next = &head;
+    head.prev->next = &e;
+    head.prev = &e;
+  }
+
+  static void unlink_(timer_wheel_entry & e)
+  {
+    e.prev->next = e.next;
+    e.next->prev = e.prev;
+    e.next = e.prev = nullptr;
+  }
+
+  std::mutex mtx_;
+  std::vector<timer_wheel_entry> buckets_{bucket_count}; // sentinel heads
+  std::size_t armed_ = 0u;
+  bool running_ = false;
+  // the entry whose fire is running right now; cancel waits it out
+  timer_wheel_entry * firing_ = nullptr;
+  std::condition_variable firing_cv_;
+  clock_type::time_point last_tick_;
+  // created lazily from the first arming executor; absent while idle, so
+  // an unused wheel never keeps the context's run() from returning.
+  optional<asio::basic_waitable_timer<clock_type,
+                                      asio::wait_traits<clock_type>,
+                                      asio::any_io_executor>> timer_;
+};
+
+// One request-phase deadline over a stream. Firing closes the socket,
+// which aborts pending async operations and unblocks synchronous reads;
+// the cancelled operation then maps the failure to timed_out via
+// translate(). Not movable - it is linked into the wheel by address.
+template<typename Stream>
+struct op_deadline : timer_wheel_entry
+{
+  explicit op_deadline(Stream & stream) : stream_(stream)
+  {
+    fire = &fire_;
+  }
+  ~op_deadline()
+  {
+    disarm();
+  }
+  op_deadline(const op_deadline &) = delete;
+
+  void arm(std::chrono::milliseconds after, asio::any_io_executor exec)
+  {
+    if (after.count() <= 0)
+      return;
+    if (wheel_ == nullptr)
+      wheel_ = &asio::use_service<timer_wheel_service>(
+          asio::query(exec, asio::execution::context));
+    expired_.store(false, std::memory_order_relaxed);
+    wheel_->arm(*this, timer_wheel_service::clock_type::now() + after, std::move(exec));
+  }
+
+  void disarm()
+  {
+    if (wheel_ != nullptr)
+      wheel_->cancel(*this);
+  }
+
+  bool expired() const { return expired_.load(std::memory_order_relaxed); }
+
+  /// The fired deadline surfaces as a cancellation; report it as a timeout.
+  void translate(system::error_code & ec) const
+  {
+    if (ec && expired())
+      BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::timed_out);
+  }
+
+ private:
+  static void fire_(timer_wheel_entry & e)
+  {
+    auto & self = static_cast<op_deadline&>(e);
+    self.expired_.store(true, std::memory_order_relaxed);
+    system::error_code ign;
+    beast::get_lowest_layer(self.stream_).close(ign);
+  }
+
+  Stream & stream_;
+  timer_wheel_service * wheel_ = nullptr;
+  std::atomic<bool> expired_{false};
+};
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_DETAIL_TIMER_WHEEL_HPP
@@ -15,24 +15,51 @@ namespace boost {
 namespace requests {
 namespace detail {
 
+// Gets told when a tracked count drops to zero, i.e. when the tracked
+// object goes idle; implemented by the connection pool's waiter queue.
+struct idle_listener
+{
+  virtual void on_idle() = 0;
+ protected:
+  ~idle_listener() = default;
+};
+
+// Ordering: the increment is relaxed - starting a request publishes
+// nothing by itself, the connection's mutexes order the request data. The
+// decrement releases, and whoever observes the count at zero acquires
+// (the fence below before on_idle, an acquire load in working_requests),
+// so the observer also sees every write made while the request ran. The
+// counters sit per connection, so uncontended requests never RMW a
+// shared cache line with full sequential consistency.
 struct tracker
 {
   std::atomic<std::size_t> *cnt = nullptr;
+  idle_listener *listener = nullptr;
   tracker() = default;
-  tracker(std::atomic<std::size_t> &cnt) : cnt(&cnt) {++cnt;}
+  tracker(std::atomic<std::size_t> &cnt, idle_listener * listener = nullptr)
+      : cnt(&cnt), listener(listener)
+  {
+    cnt.fetch_add(1u, std::memory_order_relaxed);
+  }
   ~tracker()
   {
-    if (cnt) --(*cnt);
+    if (cnt && (cnt->fetch_sub(1u, std::memory_order_release) == 1u) && listener)
+    {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      listener->on_idle();
+    }
   }
 
   tracker(const tracker &) = delete;
-  tracker(tracker && lhs) noexcept : cnt(boost::exchange(lhs.cnt, nullptr))
+  tracker(tracker && lhs) noexcept : cnt(boost::exchange(lhs.cnt, nullptr)),
+                                     listener(boost::exchange(lhs.listener, nullptr))
   {
   }
 
   tracker& operator=(tracker && lhs) noexcept
   {
     std::swap(cnt, lhs.cnt);
+    std::swap(listener, lhs.listener);
     return *this;
   }
 };
@@ -0,0 +1,79 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_DIGEST_HPP
+#define BOOST_REQUESTS_DIGEST_HPP
+
+#include <boost/requests/detail/config.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace boost
+{
+namespace requests
+{
+
+/// Incremental SHA-256 (FIPS 180-4), self-contained so verified downloads
+/// need no extra dependency. Feed it chunks with update() as they arrive
+/// and call finish() once - combined with basic_stream::set_read_tap the
+/// hash rides the download's read loop, so verifying a file costs no
+/// second pass over it:
+///
+/// @code
+/// requests::sha256 hash;
+/// requests::hash_body(str, hash);
+/// requests::write_to_file(str, path, ec);
+/// if (requests::sha256::hex(hash.finish()) != expected)
+///   ...
+/// @endcode
+struct sha256
+{
+  /// The raw 32-byte digest.
+  using digest_type = std::array<std::uint8_t, 32u>;
+
+  BOOST_REQUESTS_DECL sha256();
+
+  /// Absorb the next `size` bytes of the message.
+  BOOST_REQUESTS_DECL void update(const void * data, std::size_t size);
+
+  /// Pad & finalize. The hasher is spent afterwards; reset() starts over.
+  BOOST_REQUESTS_DECL digest_type finish();
+
+  /// Back to the empty-message state, ready for the next download.
+  BOOST_REQUESTS_DECL void reset();
+
+  /// Lower-case hex rendering, the form checksum files usually carry.
+  BOOST_REQUESTS_DECL static std::string hex(const digest_type & digest);
+
+ private:
+  BOOST_REQUESTS_DECL void compress_(const std::uint8_t * block);
+
+  std::uint32_t state_[8];
+  std::uint64_t size_{0u};
+  std::uint8_t  block_[64];
+  std::size_t   used_{0u};
+};
+
+/// Install a read tap on `str` that feeds every byte handed to the consumer
+/// into `hash`; the hasher must outlive the stream's read loop.
+template<typename Stream>
+void hash_body(Stream & str, sha256 & hash)
+{
+  str.set_read_tap([&hash](const void * data, std::size_t size) { hash.update(data, size); });
+}
+
+}
+}
+
+#if defined(BOOST_REQUESTS_HEADER_ONLY)
+#include <boost/requests/impl/digest.ipp>
+#endif
+
+#endif // BOOST_REQUESTS_DIGEST_HPP
@@ -9,6 +9,7 @@
 #define BOOST_REQUESTS_DOWNLOAD_HPP
 
 #include <boost/requests/detail/async_coroutine.hpp>
+#include <boost/requests/detail/chunk_sizer.hpp>
 #include <boost/requests/detail/config.hpp>
 #include <boost/requests/http.hpp>
 #include <boost/requests/service.hpp>
@@ -18,12 +19,19 @@
 // TODO: Remove
 #include <boost/core/demangle.hpp>
 
+// beast::file also carries the resume sidecars, see download_options::resume
+#include <boost/beast/core/file.hpp>
+
 #if defined(BOOST_ASIO_HAS_FILE)
+#include <boost/asio/basic_random_access_file.hpp>
 #include <boost/asio/basic_stream_file.hpp>
-#else
-#include <boost/beast/core/file.hpp>
+#include <boost/asio/write_at.hpp>
 #endif
 
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+
 #include <boost/asio/yield.hpp>
 
 namespace boost
@@ -34,21 +42,42 @@ namespace requests
 #if defined(BOOST_ASIO_HAS_FILE)
 
 template<typename Stream>
-std::size_t write_to_file(Stream && str, const filesystem::path & file, system::error_code & ec)
+std::size_t write_to_file(Stream && str, const filesystem::path & file, system::error_code & ec,
+                          bool append = false)
 {
   asio::basic_stream_file<typename std::decay_t<Stream>::executor_type> f{str.get_executor()};
-  f.open(file.string().c_str(), asio::file_base::write_only | asio::file_base::create, ec);
+  f.open(file.string().c_str(),
+         append ? asio::file_base::write_only | asio::file_base::create | asio::file_base::append
+                : asio::file_base::write_only | asio::file_base::create, ec);
   if (ec)
     return 0u;
 
-  char buffer[BOOST_REQUESTS_CHUNK_SIZE];
+#if defined(__linux__)
+  // plain-tcp bodies with known framing move kernel-side, skipping the copy
+  // loop below; tls, chunked and compressed bodies fall through to it.
+  // splice(2) refuses O_APPEND targets, so appending copies too.
+  if (!append && str.splice_ready())
+  {
+    std::size_t written = 0;
+    while (!str.done() && !ec)
+      written += str.splice_some(f.native_handle(), ec);
+    return written;
+  }
+#endif
+
+  // chunks start at the announced body size (capped) and grow on full
+  // reads, see detail::chunk_sizer; the storage is recycled across calls.
+  detail::chunk_sizer chunk{str.content_length_remaining()};
+  detail::scratch_buffer scratch;
 
   std::size_t written = 0;
 
   while (!str.done() && !ec)
   {
     system::error_code ec_read;
-    std::size_t n = str.read_some(asio::buffer(buffer), ec_read);
+    const auto mb = scratch.prepare(chunk.size());
+    std::size_t n = str.read_some(mb, ec_read);
+    chunk.update(n);
 
     if (n == 0 && ec_read)
     {
@@ -56,7 +85,7 @@ std::size_t write_to_file(Stream && str, const filesystem::path & file, system::
       return written;
     }
 
-    written += f.write_some(asio::buffer(buffer, n), ec);
+    written += f.write_some(asio::buffer(mb.data(), n), ec);
 
     if (ec_read && !ec)
       ec = ec_read;
@@ -82,14 +111,18 @@ struct async_write_to_file_op : asio::coroutine
   Stream str;
   asio::basic_stream_file<typename std::decay_t<Stream>::executor_type>  f{str.get_executor()};
   const std::filesystem::path & file;
-  char buffer[BOOST_REQUESTS_CHUNK_SIZE];
+  bool append;
+  // adaptive chunks out of recycled storage, see detail::chunk_sizer
+  chunk_sizer chunk;
+  scratch_buffer scratch;
+  asio::mutable_buffer mb;
 
   std::size_t written = 0u;
   system::error_code ec_read;
 
   template<typename Stream_>
-  async_write_to_file_op(Stream_ && str, const std::filesystem::path & pt)
-      : str(std::forward<Stream>(str)), file(pt)
+  async_write_to_file_op(Stream_ && str, const std::filesystem::path & pt, bool append = false)
+      : str(std::forward<Stream>(str)), file(pt), append(append)
   {
   }
 
@@ -98,23 +131,40 @@ struct async_write_to_file_op : asio::coroutine
   {
     reenter(this)
     {
-      f.open(file.string().c_str(), asio::file_base::write_only | asio::file_base::create, ec);
+      f.open(file.string().c_str(),
+             append ? asio::file_base::write_only | asio::file_base::create | asio::file_base::append
+                    : asio::file_base::write_only | asio::file_base::create, ec);
       if (ec)
         return 0u;
 
+#if defined(__linux__)
+      // splice(2) refuses O_APPEND targets, so appending copies too.
+      if (!append && str.splice_ready())
+      {
+        while (!str.done() && !ec)
+        {
+          yield str.async_splice_some(f.native_handle(), std::move(self));
+          written += n;
+        }
+        return written;
+      }
+#endif
+
+      chunk = chunk_sizer{str.content_length_remaining()};
       while (!str.done() && !ec)
       {
         // KDM: this could be in parallel to write using parallel_group.
         yield {
-          auto b = asio::buffer(buffer);
-          str.async_read_some(b, std::move(self));
+          mb = scratch.prepare(chunk.size());
+          str.async_read_some(mb, std::move(self));
         }
+        chunk.update(n);
 
         if (n == 0 && ec)
           return written;
 
         ec_read = exchange(ec, {});
-        yield asio::async_write(f, asio::buffer(buffer, n), std::move(self));
+        yield asio::async_write(f, asio::buffer(mb.data(), n), std::move(self));
 
         written += n;
         if (ec_read && !ec)
@@ -130,21 +180,41 @@ struct async_write_to_file_op : asio::coroutine
 #else
 
 template<typename Stream>
-std::size_t write_to_file(Stream && str, const filesystem::path & file, system::error_code & ec)
+std::size_t write_to_file(Stream && str, const filesystem::path & file, system::error_code & ec,
+                          bool append = false)
 {
   beast::file f;
-  f.open(file.string().c_str(), beast::file_mode::write_new, ec);
+  f.open(file.string().c_str(),
+         append ? beast::file_mode::append : beast::file_mode::write_new, ec);
   if (ec)
     return 0u;
 
-  char buffer[BOOST_REQUESTS_CHUNK_SIZE];
+#if defined(__linux__) && BOOST_BEAST_USE_POSIX_FILE
+  // plain-tcp bodies with known framing move kernel-side, skipping the copy
+  // loop below; tls, chunked and compressed bodies fall through to it.
+  // splice(2) refuses O_APPEND targets, so appending copies too.
+  if (!append && str.splice_ready())
+  {
+    std::size_t written = 0;
+    while (!str.done() && !ec)
+      written += str.splice_some(f.native_handle(), ec);
+    return written;
+  }
+#endif
+
+  // chunks start at the announced body size (capped) and grow on full
+  // reads, see detail::chunk_sizer; the storage is recycled across calls.
+  detail::chunk_sizer chunk{str.content_length_remaining()};
+  detail::scratch_buffer scratch;
 
   std::size_t written = 0;
 
   while (!str.done() && !ec)
   {
     system::error_code ec_read;
-    std::size_t n = str.read_some(asio::buffer(buffer), ec_read);
+    const auto mb = scratch.prepare(chunk.size());
+    std::size_t n = str.read_some(mb, ec_read);
+    chunk.update(n);
 
     if (n == 0 && ec_read)
     {
@@ -152,7 +222,7 @@ std::size_t write_to_file(Stream && str, const filesystem::path & file, system::
       return written;
     }
 
-    written += f.write(buffer, n, ec);
+    written += f.write(mb.data(), n, ec);
 
     if (ec_read && !ec)
       ec = ec_read;
@@ -177,30 +247,54 @@ struct async_write_to_file_op : asio::coroutine
   Stream &str;
   beast::file f;
   const std::filesystem::path & file;
-  char buffer[BOOST_REQUESTS_CHUNK_SIZE];
+  bool append;
+  // adaptive chunks out of recycled storage, see detail::chunk_sizer
+  chunk_sizer chunk;
+  scratch_buffer scratch;
+  asio::mutable_buffer mb;
 
   std::size_t written = 0u;
 
-  async_write_to_file_op(Stream * str, const std::filesystem::path & pt) : str(*str), file(pt) {}
+  async_write_to_file_op(Stream * str, const std::filesystem::path & pt, bool append = false)
+      : str(*str), file(pt), append(append) {}
 
   std::size_t resume(requests::detail::co_token_t<step_signature_type> self,
                      system::error_code & ec, std::size_t n = 0u)
   {
     reenter(this)
     {
-      f.open(file.string().c_str(), beast::file_mode::write_new, ec);
+      f.open(file.string().c_str(),
+             append ? beast::file_mode::append : beast::file_mode::write_new, ec);
       if (ec)
         return 0u;
 
+#if defined(__linux__) && BOOST_BEAST_USE_POSIX_FILE
+      // splice(2) refuses O_APPEND targets, so appending copies too.
+      if (!append && str.splice_ready())
+      {
+        while (!str.done() && !ec)
+        {
+          yield str.async_splice_some(f.native_handle(), std::move(self));
+          written += n;
+        }
+        return written;
+      }
+#endif
+
+      chunk = chunk_sizer{str.content_length_remaining()};
       while (!str.done() && !ec)
       {
-        yield str.async_read_some(asio::buffer(buffer), std::move(self));
+        yield {
+          mb = scratch.prepare(chunk.size());
+          str.async_read_some(mb, std::move(self));
+        }
+        chunk.update(n);
 
         if (n == 0 && ec)
           return written;
 
         system::error_code ec_read = exchange(ec, {});
-        written += f.write(buffer, n, ec);
+        written += f.write(mb.data(), n, ec);
 
         if (ec_read && !ec)
           ec = ec_read;
@@ -227,6 +321,17 @@ async_write_to_file(Stream & str, const filesystem::path & file,
       detail::async_write_to_file_op<Stream>>(std::forward<CompletionToken>(completion_token), &str, file);
 }
 
+template<typename Stream,
+          BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, std::size_t)) CompletionToken
+              BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(typename Stream::executor_type)>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code, std::size_t))
+async_write_to_file(Stream & str, const filesystem::path & file, bool append,
+                    CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN( typename Stream::executor_type))
+{
+  return requests::detail::co_run<
+      detail::async_write_to_file_op<Stream>>(std::forward<CompletionToken>(completion_token), &str, file, append);
+}
+
 template<typename Stream>
 std::size_t write_to_file(Stream && str, const filesystem::path & file)
 {
@@ -237,6 +342,94 @@ std::size_t write_to_file(Stream && str, const filesystem::path & file)
   return res;
 }
 
+/// Options of download() & async_download.
+struct download_options
+{
+  /// Pick up where an interrupted download of the same file left off: an
+  /// existing partial file turns the request into `Range: bytes=N-` with
+  /// `If-Range` on the validator stored beside it, and the body gets
+  /// appended. A changed resource comes back whole (200) and replaces the
+  /// file. Without a stored validator the download starts over.
+  bool resume{false};
+};
+
+namespace detail
+{
+
+inline http::fields & fields_ref(http::fields & f)   { return f; }
+inline http::fields & fields_ref(request_settings & s) { return s.fields; }
+
+// The validator for If-Range lives in a sidecar next to the partial file
+// while a resumable download is in flight; only a completed download
+// removes it, so its presence marks the file as partial.
+inline filesystem::path resume_sidecar_path(const filesystem::path & file)
+{
+  filesystem::path p = file;
+  p += ".resume";
+  return p;
+}
+
+inline std::string read_resume_validator(const filesystem::path & file)
+{
+  beast::file f;
+  system::error_code ec;
+  f.open(resume_sidecar_path(file).string().c_str(), beast::file_mode::read, ec);
+  if (ec)
+    return {};
+  char buf[512];
+  const auto n = f.read(buf, sizeof(buf), ec);
+  if (ec)
+    return {};
+  return std::string(buf, n);
+}
+
+// best effort - a failed sidecar only costs the next run its resume
+inline void write_resume_validator(const filesystem::path & file, core::string_view validator)
+{
+  beast::file f;
+  system::error_code ec;
+  f.open(resume_sidecar_path(file).string().c_str(), beast::file_mode::write, ec);
+  if (!ec)
+    f.write(validator.data(), validator.size(), ec);
+}
+
+inline void remove_resume_sidecar(const filesystem::path & file)
+{
+  system::error_code ec;
+  filesystem::remove(resume_sidecar_path(file), ec);
+}
+
+// the validator the server would check on If-Range: a strong ETag wins,
+// Last-Modified second (RFC 9110 13.1).
+inline core::string_view response_validator(const http::response_header & h)
+{
+  auto itr = h.find(http::field::etag);
+  if (itr != h.end() && itr->value().substr(0u, 2u) != "W/")
+    return itr->value();
+  itr = h.find(http::field::last_modified);
+  if (itr != h.end())
+    return itr->value();
+  return core::string_view();
+}
+
+// where a resumed transfer would continue: the partial file's size, or zero
+// when there is nothing (or nothing trustworthy) to continue from.
+inline std::uint64_t resume_offset(const filesystem::path & file, std::string & validator)
+{
+  system::error_code ec;
+  if (!filesystem::is_regular_file(file, ec))
+    return 0u;
+  const auto n = filesystem::file_size(file, ec);
+  if (ec || n == 0u)
+    return 0u;
+  validator = read_resume_validator(file);
+  if (validator.empty())
+    return 0u;
+  return n;
+}
+
+}
+
 struct download_response : response_base
 {
   filesystem::path download_path;
@@ -287,6 +480,77 @@ inline auto download(Connection & conn,
   return res;
 }
 
+template<typename Connection>
+inline auto download(Connection & conn,
+                     urls::url_view target,
+                     typename Connection::request_type req,
+                     filesystem::path download_path,
+                     download_options opt,
+                     system::error_code & ec) -> download_response
+{
+  // the final file name gets resolved up front here, so the partial file
+  // can be probed before the request goes out
+  if (filesystem::exists(download_path, ec) && filesystem::is_directory(download_path) && !target.empty())
+    download_path /= target.segments().back(); // so we can download to a folder
+
+  std::string validator;
+  std::uint64_t offset = 0u;
+  if (opt.resume && !ec)
+  {
+    offset = detail::resume_offset(download_path, validator);
+    if (offset > 0u)
+    {
+      char range[32];
+      std::snprintf(range, sizeof(range), "bytes=%llu-",
+                    static_cast<unsigned long long>(offset));
+      detail::fields_ref(req).set(http::field::range, range);
+      detail::fields_ref(req).set(http::field::if_range, validator);
+    }
+  }
+
+  auto ro = conn.ropen(http::verb::get, target, empty{}, std::move(req), ec);
+  if (ec)
+    return download_response{std::move(ro).headers(), std::move(ro).history(), {}};
+
+  const bool append = offset > 0u
+                   && ro.headers().result() == http::status::partial_content;
+  if (opt.resume && !append)
+  {
+    // the range was refused or the resource changed - start over, and stash
+    // the fresh validator so the next interruption can resume
+    if (offset > 0u)
+    {
+      system::error_code ec_;
+      filesystem::remove(download_path, ec_);
+    }
+    const auto validator_ = detail::response_validator(ro.headers());
+    if (validator_.empty())
+      detail::remove_resume_sidecar(download_path);
+    else
+      detail::write_resume_validator(download_path, validator_);
+  }
+
+  if (!ec)
+    write_to_file(ro, download_path, ec, append);
+  if (opt.resume && !ec)
+    detail::remove_resume_sidecar(download_path);
+  return download_response{std::move(ro).headers(), std::move(ro).history(), std::move(download_path)};
+}
+
+template<typename Connection>
+inline auto download(Connection & conn,
+                     urls::url_view target,
+                     typename Connection::request_type req,
+                     filesystem::path download_path,
+                     download_options opt) -> download_response
+{
+  boost::system::error_code ec;
+  auto res = download(conn, target, std::move(req), std::move(download_path), opt, ec);
+  if (ec)
+    throw_exception(system::system_error(ec, "download"));
+  return res;
+}
+
 inline auto download(urls::url_view path,
                      http::fields req,
                      filesystem::path download_path,
@@ -317,15 +581,22 @@ struct async_download_op : asio::coroutine
   urls::url_view target;
   typename Connection::request_type req;
   filesystem::path download_path;
+  download_options opt;
 
   async_download_op(Connection * conn,
                     urls::url_view target,
                     typename Connection::request_type req,
-                    filesystem::path download_path)
-      : conn(*conn), target(target), req(std::move(req)), download_path(std::move(download_path)) {}
+                    filesystem::path download_path,
+                    download_options opt = {})
+      : conn(*conn), target(target), req(std::move(req)),
+        download_path(std::move(download_path)), opt(opt) {}
 
   download_response rb{req.get_allocator()};
   optional<typename Connection::stream> str_;
+  system::error_code ec_;
+  std::string validator_;
+  std::uint64_t offset_{0u};
+  bool append_{false};
 
   using completion_signature_type = void(system::error_code, download_response);
   using step_signature_type       = void(system::error_code, optional<typename Connection::stream>);
@@ -336,6 +607,26 @@ struct async_download_op : asio::coroutine
   {
     reenter(this)
     {
+      // resolve the final file name before the request goes out, so the
+      // partial file can be probed for a resume
+      if (filesystem::exists(download_path, ec_) && filesystem::is_directory(download_path, ec_) && !target.segments().empty())
+        rb.download_path = download_path / target.segments().back(); // so we can download to a folder
+      else
+        rb.download_path = std::move(download_path);
+
+      if (opt.resume && !ec_)
+      {
+        offset_ = detail::resume_offset(rb.download_path, validator_);
+        if (offset_ > 0u)
+        {
+          char range[32];
+          std::snprintf(range, sizeof(range), "bytes=%llu-",
+                        static_cast<unsigned long long>(offset_));
+          detail::fields_ref(req).set(http::field::range, range);
+          detail::fields_ref(req).set(http::field::if_range, validator_);
+        }
+      }
+
       yield conn.async_ropen(http::verb::get, target, empty{}, std::move(req), std::move(self));
       if (ec)
       {
@@ -344,17 +635,35 @@ struct async_download_op : asio::coroutine
         return rb;
       }
       str_ = std::move(s);
-      if (filesystem::exists(download_path, ec) && filesystem::is_directory(download_path, ec) && !target.segments().empty())
-        rb.download_path = download_path / target.segments().back(); // so we can download to a folder
-      else
-        rb.download_path = std::move(download_path);
+      if (!ec)
+        ec = ec_;
+
+      append_ = offset_ > 0u
+             && str_->headers().result() == http::status::partial_content;
+      if (opt.resume && !append_ && !ec)
+      {
+        // the range was refused or the resource changed - start over, and
+        // stash the fresh validator so the next interruption can resume
+        if (offset_ > 0u)
+        {
+          system::error_code ec2;
+          filesystem::remove(rb.download_path, ec2);
+        }
+        validator_ = detail::response_validator(str_->headers());
+        if (validator_.empty())
+          detail::remove_resume_sidecar(rb.download_path);
+        else
+          detail::write_resume_validator(rb.download_path, validator_);
+      }
 
       if (!ec)
       {
-        yield async_write_to_file(*str_, rb.download_path,
+        yield async_write_to_file(*str_, rb.download_path, append_,
                           asio::deferred([](system::error_code ec, std::size_t){return asio::deferred.values(ec);}))
                 (std::move(self));
       }
+      if (opt.resume && !ec)
+        detail::remove_resume_sidecar(rb.download_path);
 
       rb.history = std::move(*str_).history();
       rb.headers = std::move(*str_).headers();
@@ -381,6 +690,22 @@ async_download(Connection & conn,
           &conn, target, std::move(req), std::move(download_path));
 }
 
+template<typename Connection,
+         BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, download_response)) CompletionToken
+              BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(typename Connection::executor_type)>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code, download_response))
+async_download(Connection & conn,
+               urls::url_view target,
+               typename Connection::request_type req,
+               filesystem::path download_path,
+               download_options opt,
+               CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(typename Connection::executor_type))
+{
+  return detail::co_run<detail::async_download_op<Connection>>(
+          std::forward<CompletionToken>(completion_token),
+          &conn, target, std::move(req), std::move(download_path), opt);
+}
+
 namespace detail
 {
 
@@ -413,6 +738,294 @@ async_download(urls::url_view path,
       completion_token, path, std::move(req), std::move(download_path));
 }
 
+namespace detail
+{
+
+// shared by the segments of one ranged download, see async_download below.
+// The segments complete on whatever threads run the pool, so the join
+// follows the pool's batch machinery: an atomic count, the error under a
+// mutex, and the last segment to retire resumes the operation.
+template<typename Pool>
+struct ranged_download_state
+{
+  using executor_type = typename Pool::executor_type;
+
+  Pool & pool;
+  urls::url_view target;
+  request_settings base_req;
+  // each segment opens its own handle on this, see download_segment
+  std::string path;
+
+  std::atomic<std::size_t> outstanding{0u};
+  std::mutex mtx;
+  system::error_code first_ec;
+  optional<requests::detail::co_token_t<
+      void(system::error_code, variant2::variant<std::size_t, typename Pool::stream>)>> on_done;
+
+  ranged_download_state(Pool & pool, urls::url_view target, request_settings base_req)
+      : pool(pool), target(target), base_req(std::move(base_req))
+  {}
+
+  void arrive(system::error_code ec)
+  {
+    if (ec)
+    {
+      std::lock_guard<std::mutex> lock{mtx};
+      if (!first_ec)
+        first_ec = ec;
+    }
+    if (outstanding.fetch_sub(1u) == 1u)
+    {
+      auto tk = std::move(*on_done);
+      on_done.reset();
+      tk(first_ec);
+    }
+  }
+};
+
+template<typename Pool>
+struct download_segment
+{
+  std::shared_ptr<ranged_download_state<Pool>> st;
+  std::uint64_t offset, last; // the range is bytes=offset-last, both inclusive
+
+  // a file object must not see concurrent initiations, so every segment
+  // writes its disjoint range through its own handle
+#if defined(BOOST_ASIO_HAS_FILE)
+  asio::basic_random_access_file<typename Pool::executor_type> file;
+#else
+  beast::file file;
+#endif
+
+  optional<typename Pool::stream> str;
+  asio::coroutine coro;
+  // the segment knows its exact range, so the sizer is seeded with it
+  chunk_sizer chunk;
+  scratch_buffer scratch;
+  asio::mutable_buffer mb;
+  std::size_t n_{0u};
+  system::error_code ec_read_;
+
+  download_segment(std::shared_ptr<ranged_download_state<Pool>> st,
+                   std::uint64_t offset, std::uint64_t last)
+      : st(std::move(st)), offset(offset), last(last)
+#if defined(BOOST_ASIO_HAS_FILE)
+      , file(this->st->pool.get_executor())
+#endif
+      , chunk{boost::optional<std::uint64_t>(last - offset + 1u)} {}
+};
+
+// thin copyable facade, so the segment state stays at a stable address while
+// it is threaded through the completion handlers.
+template<typename Pool>
+struct download_segment_handler
+{
+  std::shared_ptr<download_segment<Pool>> seg;
+
+  void start()
+  {
+    auto & sg = *seg;
+    system::error_code ec;
+#if defined(BOOST_ASIO_HAS_FILE)
+    sg.file.open(sg.st->path.c_str(), asio::file_base::write_only, ec);
+#else
+    sg.file.open(sg.st->path.c_str(), beast::file_mode::write_existing, ec);
+#endif
+    if (ec)
+      return sg.st->arrive(ec);
+    auto req = sg.st->base_req;
+    char range[72];
+    std::snprintf(range, sizeof(range), "bytes=%llu-%llu",
+                  static_cast<unsigned long long>(sg.offset),
+                  static_cast<unsigned long long>(sg.last));
+    req.fields.set(http::field::range, range);
+    sg.st->pool.async_ropen(http::verb::get, sg.st->target, empty{}, std::move(req), std::move(*this));
+  }
+
+  void operator()(system::error_code ec, typename Pool::stream s)
+  {
+    if (!ec && s.headers().result() != http::status::partial_content)
+      BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::operation_not_supported);
+    if (ec)
+      return seg->st->arrive(ec);
+    seg->str.emplace(std::move(s));
+    (*this)();
+  }
+
+  void operator()(system::error_code ec = {}, std::size_t n = 0u)
+  {
+    auto & sg = *seg;
+    reenter(sg.coro)
+    {
+      while (!sg.str->done() && !ec)
+      {
+        yield {
+          sg.mb = sg.scratch.prepare(sg.chunk.size());
+          sg.str->async_read_some(sg.mb, std::move(*this));
+        }
+        sg.chunk.update(n);
+
+        if (n == 0u && ec)
+          break;
+
+        sg.ec_read_ = exchange(ec, {});
+        sg.n_ = n;
+#if defined(BOOST_ASIO_HAS_FILE)
+        yield asio::async_write_at(sg.file, sg.offset, asio::buffer(sg.mb.data(), sg.n_), std::move(*this));
+        sg.offset += n;
+#else
+        sg.file.seek(sg.offset, ec);
+        if (!ec)
+          sg.offset += sg.file.write(sg.mb.data(), sg.n_, ec);
+#endif
+        if (sg.ec_read_ && !ec)
+          ec = sg.ec_read_;
+      }
+      sg.st->arrive(ec);
+    }
+  }
+};
+
+template<typename Pool>
+struct async_ranged_download_op : asio::coroutine
+{
+  using executor_type = typename Pool::executor_type;
+  executor_type get_executor() {return pool.get_executor(); }
+
+  using completion_signature_type = void(system::error_code, download_response);
+  using step_signature_type       = void(system::error_code, variant2::variant<std::size_t, typename Pool::stream>);
+
+  Pool & pool;
+  urls::url_view target;
+  request_settings req;
+  filesystem::path download_path;
+  std::size_t parts;
+
+  download_response rb{req.get_allocator()};
+  optional<typename Pool::stream> str_;
+  std::shared_ptr<ranged_download_state<Pool>> st_;
+  std::uint64_t size_{0u};
+
+  async_ranged_download_op(Pool * pool,
+                           urls::url_view target,
+                           request_settings req,
+                           filesystem::path download_path,
+                           std::size_t parts)
+      : pool(*pool), target(target), req(std::move(req)),
+        download_path(std::move(download_path)), parts(parts) {}
+
+  download_response & resume(requests::detail::co_token_t<step_signature_type> self,
+                             system::error_code & ec,
+                             variant2::variant<std::size_t, typename Pool::stream> s)
+  {
+    reenter(this)
+    {
+      // learn the size & whether the server does ranges at all
+      yield
+      {
+        auto r = req;
+        pool.async_ropen(http::verb::head, target, empty{}, std::move(r), std::move(self));
+      }
+      if (ec)
+        return rb;
+      str_.emplace(std::move(variant2::get<1>(s)));
+      rb.headers = std::move(*str_).headers();
+      str_.reset(); // frees the connection for the range requests
+
+      if (filesystem::exists(download_path, ec) && filesystem::is_directory(download_path, ec) && !target.segments().empty())
+        rb.download_path = download_path / target.segments().back(); // so we can download to a folder
+      else
+        rb.download_path = std::move(download_path);
+
+      for (auto c : rb.headers[http::field::content_length])
+      {
+        if (c < '0' || c > '9')
+        {
+          size_ = 0u;
+          break;
+        }
+        size_ = size_ * 10u + static_cast<std::uint64_t>(c - '0');
+      }
+      if (size_ < parts)
+        parts = static_cast<std::size_t>(size_);
+
+      if (ec || parts < 2u || rb.headers[http::field::accept_ranges] != "bytes")
+      {
+        // no range support (or nothing to parallelize) - plain download
+        if (!ec)
+        {
+          yield pool.async_ropen(http::verb::get, target, empty{}, std::move(req), std::move(self));
+        }
+        if (!ec)
+        {
+          str_.emplace(std::move(variant2::get<1>(s)));
+          yield async_write_to_file(*str_, rb.download_path,
+                            asio::deferred([](system::error_code ec, std::size_t){return asio::deferred.values(ec);}))
+                  (std::move(self));
+          rb.headers = std::move(*str_).headers();
+          rb.history = std::move(*str_).history();
+        }
+        return rb;
+      }
+
+      st_ = std::allocate_shared<ranged_download_state<Pool>>(self.get_allocator(), pool, target, std::move(req));
+      st_->path = rb.download_path.string();
+      // create (and size) the file up front; the segments then open their
+      // own handles on it
+      {
+#if defined(BOOST_ASIO_HAS_FILE)
+        asio::basic_random_access_file<executor_type> f{get_executor()};
+        f.open(st_->path.c_str(),
+               asio::file_base::write_only | asio::file_base::create, ec);
+        if (!ec)
+          f.resize(size_, ec);
+#else
+        beast::file f;
+        f.open(st_->path.c_str(), beast::file_mode::write_new, ec);
+#endif
+      }
+      if (ec)
+        return rb;
+
+      st_->outstanding = parts;
+      yield
+      {
+        const auto alloc = self.get_allocator();
+        st_->on_done.emplace(std::move(self));
+        const std::uint64_t per = (size_ + parts - 1u) / parts;
+        for (std::size_t i = 0u; i < parts; i++)
+          download_segment_handler<Pool>{
+              std::allocate_shared<download_segment<Pool>>(
+                  alloc, st_, i * per, (std::min)(size_ - 1u, (i + 1u) * per - 1u))}.start();
+      }
+      // resumed by the last segment with the sticky first error
+    }
+    return rb;
+  }
+};
+
+}
+
+/** Download `target` into `download_path` by fetching `parts` byte ranges
+    over separate pool connections concurrently, after a HEAD request to
+    learn the size and whether the server advertises `Accept-Ranges: bytes`.
+    Falls back to a plain single-stream download when it does not. */
+template<typename Pool,
+         BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, download_response)) CompletionToken
+              BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(typename Pool::executor_type)>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code, download_response))
+async_download(Pool & pool,
+               urls::url_view target,
+               typename Pool::request_type req,
+               filesystem::path download_path,
+               std::size_t parts,
+               CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(typename Pool::executor_type))
+{
+  return detail::co_run<detail::async_ranged_download_op<Pool>>(
+          std::forward<CompletionToken>(completion_token),
+          &pool, target, std::move(req), std::move(download_path), parts);
+}
+
 
 }
 }
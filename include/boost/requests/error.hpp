@@ -45,7 +45,15 @@ enum class error
   /// The request violates the tls requirement
   insecure,
   /// The target host is invalid
-  wrong_host
+  wrong_host,
+  /// The proxy refused the CONNECT tunnel
+  tunnel_failed,
+  /// The session's concurrency budget and queue are exhausted
+  session_overloaded,
+  /// The pool's circuit breaker is open, see set_circuit_breaker
+  circuit_open,
+  /// The session is winding down, see basic_session::async_drain
+  session_draining
 };
 
 BOOST_REQUESTS_DECL
@@ -0,0 +1,53 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_FIELDS_ALT_SVC_HPP
+#define BOOST_REQUESTS_FIELDS_ALT_SVC_HPP
+
+#include <boost/core/detail/string_view.hpp>
+#include <boost/requests/detail/config.hpp>
+#include <boost/system/result.hpp>
+#include <boost/url/detail/config.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace boost
+{
+namespace requests
+{
+
+/// One alternative service from an Alt-Svc header (RFC 7838).
+struct alt_svc_entry
+{
+    /// The ALPN protocol identifier, e.g. "http/1.1" or "h2".
+    std::string protocol;
+    /// The alternative's host[:port]; a leading ':' means the origin's own
+    /// host on another port.
+    std::string authority;
+    /// When the advertisement stops being usable; the `ma` parameter,
+    /// defaulting to the 24 hours RFC 7838 prescribes.
+    std::chrono::system_clock::time_point expiry;
+};
+
+/// Parse an Alt-Svc header value into its alternatives, in the order they
+/// were advertised. The special value "clear" yields an empty list.
+BOOST_REQUESTS_DECL system::result<std::vector<alt_svc_entry>> parse_alt_svc_field(
+        core::string_view value,
+        std::chrono::system_clock::time_point now = std::chrono::system_clock::now());
+
+}
+}
+
+
+#if defined(BOOST_REQUESTS_HEADER_ONLY)
+#include <boost/requests/fields/impl/alt_svc.ipp>
+#endif
+
+
+#endif //BOOST_REQUESTS_FIELDS_ALT_SVC_HPP
@@ -0,0 +1,140 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_IMPL_ALT_SVC_IPP
+#define BOOST_REQUESTS_IMPL_ALT_SVC_IPP
+
+#include <boost/requests/fields/alt_svc.hpp>
+
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/variant_rule.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/lut_chars.hpp>
+#include <boost/url/grammar/optional_rule.hpp>
+#include <boost/url/grammar/token_rule.hpp>
+#include <boost/url/grammar/tuple_rule.hpp>
+#include <boost/url/grammar/literal_rule.hpp>
+#include <boost/url/grammar/range_rule.hpp>
+#include <boost/variant2/variant.hpp>
+
+namespace boost
+{
+namespace requests
+{
+/*
+ *
+   Alt-Svc       = clear / 1#alt-value
+   clear         = %s"clear"
+   alt-value     = alternative *( OWS ";" OWS parameter )
+   alternative   = protocol-id "=" alt-authority
+   protocol-id   = token ; percent-encoded ALPN protocol name
+   alt-authority = quoted-string ;  containing [ uri-host ] ":" port
+   parameter     = token "=" ( token / quoted-string )
+ */
+
+system::result<std::vector<alt_svc_entry>> parse_alt_svc_field(
+            core::string_view value,
+            std::chrono::system_clock::time_point now)
+{
+  namespace ug = urls::grammar;
+
+  if (ug::ci_is_equal(value, "clear"))
+    return std::vector<alt_svc_entry>{};
+
+  // token chars of RFC 7230; '%' carries the escaped octets of an ALPN name
+  constexpr ug::lut_chars tchars =
+      "!#$%&'*+-.^_`|~"
+      "0123456789"
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+      "abcdefghijklmnopqrstuvwxyz";
+  // what a quoted host[:port] is made of, IPv6 brackets included
+  constexpr ug::lut_chars achars =
+      "-.:[]_~"
+      "0123456789"
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+      "abcdefghijklmnopqrstuvwxyz";
+  // anything a quoted parameter value may hold, quotes and escapes aside
+  constexpr ug::lut_chars qchars =
+      "!#$%&'()*+,-./:;<=>?@[]^_`{|}~ "
+      "0123456789"
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+      "abcdefghijklmnopqrstuvwxyz";
+
+  constexpr ug::lut_chars space = " ";
+  constexpr auto ows = ug::optional_rule(ug::token_rule(space));
+
+  constexpr auto parameter = ug::tuple_rule(
+      ug::squelch(ows),
+      ug::squelch(ug::literal_rule(";")),
+      ug::squelch(ows),
+      ug::token_rule(tchars),
+      ug::squelch(ug::literal_rule("=")),
+      ug::variant_rule(
+          ug::tuple_rule(
+              ug::squelch(ug::literal_rule("\"")),
+              ug::token_rule(qchars),
+              ug::squelch(ug::literal_rule("\""))),
+          ug::token_rule(tchars)));
+
+  constexpr auto alternative = ug::tuple_rule(
+      ug::token_rule(tchars),
+      ug::squelch(ug::literal_rule("=\"")),
+      ug::token_rule(achars),
+      ug::squelch(ug::literal_rule("\"")),
+      ug::range_rule(parameter));
+
+  auto res = ug::parse(value,
+                     ug::range_rule(
+                         alternative,
+                         ug::tuple_rule(
+                           ug::squelch(
+                             ug::tuple_rule(
+                               ows,
+                               ug::literal_rule(","),
+                               ows)),
+                           alternative)));
+  if (res.has_error())
+    return res.error();
+
+  std::vector<alt_svc_entry> entries;
+
+  for (const auto & alt : *res)
+  {
+    alt_svc_entry e;
+    const auto & proto = get<0>(alt);
+    const auto & auth  = get<1>(alt);
+    e.protocol.assign(proto.begin(), proto.end());
+    e.authority.assign(auth.begin(), auth.end());
+    e.expiry = now + std::chrono::hours(24); // the RFC 7838 default
+
+    for (const auto & param : get<2>(alt))
+    {
+      const auto & k = get<0>(param);
+      const auto v = variant2::visit(
+          [](core::string_view sv) {return sv;}, get<1>(param));
+      if (ug::ci_is_equal(k, "ma"))
+      {
+        const auto d = parse(v, ug::token_rule(ug::digit_chars));
+        if (d.has_error())
+          return d.error();
+        e.expiry = now + std::chrono::seconds(std::stoull(v));
+      }
+      // persist=1 changes nothing here - the cache does not survive the
+      // session anyway
+    }
+    entries.push_back(std::move(e));
+  }
+
+  return entries;
+}
+
+
+}
+}
+
+#endif //BOOST_REQUESTS_IMPL_ALT_SVC_IPP
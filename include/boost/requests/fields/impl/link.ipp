@@ -118,6 +118,115 @@ system::result<urls::grammar::range<core::string_view>> link::rev() const
   return detail::parse_rel_type((*itr).value);
 }
 
+void link_field_view::iterator::advance_()
+{
+  while (!rest_.empty() && (rest_.front() == ' ' || rest_.front() == '\t' || rest_.front() == ','))
+    rest_.remove_prefix(1u);
+
+  if (rest_.empty())
+  {
+    done_ = true;
+    current_ = element{};
+    return;
+  }
+
+  core::string_view target;
+  if (rest_.front() == '<')
+  {
+    const auto gt = rest_.find('>');
+    if (gt != core::string_view::npos)
+    {
+      target = rest_.substr(1u, gt - 1u);
+      rest_.remove_prefix(gt + 1u);
+    }
+    // an unterminated target stays empty and the rest becomes attribute text
+  }
+
+  // the attribute text runs to the next ',' outside of quotes
+  bool quoted = false;
+  std::size_t n = 0u;
+  for (; n < rest_.size(); n++)
+  {
+    const char c = rest_[n];
+    if (quoted && c == '\\' && (n + 1u) < rest_.size())
+      n++;
+    else if (c == '"')
+      quoted = !quoted;
+    else if (!quoted && c == ',')
+      break;
+  }
+  current_ = element{target, rest_.substr(0u, n)};
+  rest_.remove_prefix(n);
+}
+
+system::result<core::string_view> link_field_view::element::attribute(core::string_view key) const
+{
+  core::string_view rest = attributes;
+  while (!rest.empty())
+  {
+    const auto before = rest.size();
+    while (!rest.empty() && (rest.front() == ' ' || rest.front() == '\t' || rest.front() == ';'))
+      rest.remove_prefix(1u);
+
+    std::size_t k = 0u;
+    while (k < rest.size() && rest[k] != '=' && rest[k] != ';' && rest[k] != ' ')
+      k++;
+    const auto ky = rest.substr(0u, k);
+    rest.remove_prefix(k);
+
+    core::string_view value;
+    while (!rest.empty() && rest.front() == ' ')
+      rest.remove_prefix(1u);
+    if (!rest.empty() && rest.front() == '=')
+    {
+      rest.remove_prefix(1u);
+      while (!rest.empty() && rest.front() == ' ')
+        rest.remove_prefix(1u);
+      if (!rest.empty() && rest.front() == '"')
+      {
+        std::size_t e = 1u;
+        while (e < rest.size() && rest[e] != '"')
+          e += (rest[e] == '\\' && (e + 1u) < rest.size()) ? 2u : 1u;
+        value = rest.substr(1u, e - 1u);
+        rest.remove_prefix((std::min)(rest.size(), e + 1u));
+      }
+      else
+      {
+        std::size_t e = 0u;
+        while (e < rest.size() && rest[e] != ';' && rest[e] != ' ')
+          e++;
+        value = rest.substr(0u, e);
+        rest.remove_prefix(e);
+      }
+    }
+
+    if (!ky.empty() && urls::grammar::ci_is_equal(ky, key))
+      return value;
+    if (rest.size() == before) // malformed tail that does not tokenize
+      break;
+  }
+  return urls::grammar::error::out_of_range;
+}
+
+bool link_field_view::element::has_rel(core::string_view token) const
+{
+  const auto rel = attribute("rel");
+  if (rel.has_error())
+    return false;
+
+  core::string_view v = *rel;
+  while (!v.empty())
+  {
+    const auto sp = v.find(' ');
+    if (urls::grammar::ci_is_equal(v.substr(0u, sp), token))
+      return true;
+    if (sp == core::string_view::npos)
+      break;
+    v.remove_prefix(sp + 1u);
+  }
+  return false;
+}
+
 system::result<urls::url_view> link::anchor() const
 {
   const auto begin = attributes.begin();
@@ -13,7 +13,9 @@
 #include <boost/requests/detail/config.hpp>
 #include <boost/url/grammar/ci_string.hpp>
 #include <boost/url/grammar/range_rule.hpp>
+#include <boost/url/parse.hpp>
 #include <boost/url/url_view.hpp>
+#include <iterator>
 
 namespace boost
 {
@@ -76,6 +78,95 @@ struct link
 
 BOOST_REQUESTS_DECL system::result<urls::grammar::range<link>> parse_link_field(core::string_view value );
 
+/// A lazy forward range over an unparsed Link field value.
+///
+/// Each increment tokenizes exactly one link element - the target between
+/// '<' and '>' plus its raw attribute text up to the next top-level ',' -
+/// and nothing is parsed, validated or allocated until the caller extracts
+/// a value from the element. This suits clients that only need a single
+/// attribute of a single element, e.g. the rel="next" target for
+/// pagination, where parse_link_field() materializes every attribute of
+/// every link.
+struct link_field_view
+{
+  /// One unparsed element of the field; the accessors scan on demand.
+  struct element
+  {
+    /// The text between '<' and '>'; empty if the element is malformed.
+    core::string_view target;
+    /// The raw attribute text following '>', up to the next top-level ','.
+    core::string_view attributes;
+
+    /// Parse the target on demand.
+    system::result<urls::url_view> url() const
+    {
+      return urls::parse_uri_reference(target);
+    }
+
+    /// Find an attribute by case-insensitive key and return its value with
+    /// surrounding quotes stripped, but without unescaping - i.e. still a
+    /// view into the field. out_of_range if the attribute is absent.
+    BOOST_REQUESTS_DECL system::result<core::string_view> attribute(core::string_view key) const;
+
+    /// Check whether the space-separated rel attribute contains `token`.
+    BOOST_REQUESTS_DECL bool has_rel(core::string_view token) const;
+  };
+
+  struct iterator
+  {
+    using value_type        = element;
+    using reference         = const element &;
+    using pointer           = const element *;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    iterator() = default;
+    explicit iterator(core::string_view value) : rest_(value), done_(false)
+    {
+      advance_();
+    }
+
+    reference operator*()  const { return current_; }
+    pointer   operator->() const { return &current_; }
+
+    iterator & operator++()
+    {
+      advance_();
+      return *this;
+    }
+    iterator operator++(int)
+    {
+      auto tmp = *this;
+      advance_();
+      return tmp;
+    }
+
+    bool operator==(const iterator & rhs) const
+    {
+      return done_ == rhs.done_ && (done_ || rest_.data() == rhs.rest_.data());
+    }
+    bool operator!=(const iterator & rhs) const
+    {
+      return !(*this == rhs);
+    }
+
+   private:
+    BOOST_REQUESTS_DECL void advance_();
+
+    core::string_view rest_;
+    element current_;
+    bool done_ = true;
+  };
+
+  explicit link_field_view(core::string_view value) : value_(value) {}
+
+  iterator begin() const { return iterator(value_); }
+  iterator end()   const { return iterator(); }
+
+ private:
+  core::string_view value_;
+};
+
 }
 }
 
@@ -0,0 +1,142 @@
+// Copyright (c) 2021 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_REQUESTS_FLAT_HEADERS_HPP
+#define BOOST_REQUESTS_FLAT_HEADERS_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/requests/http.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace requests {
+
+/// A flat header map: every field lives in one contiguous char block,
+/// already laid out in wire format (`Name: value\r\n`), plus a small
+/// offset table kept sorted for case-insensitive binary search. Setting a
+/// field is a block append and an O(log n) index insert; serializing is
+/// handing out the block as it is - one memcpy instead of walking a
+/// node-based container. An alternative to http::fields where allocation
+/// count and locality matter: feed it to a header_prototype (see
+/// prepared_request.hpp) for the flat request path, or convert with
+/// to_fields() for APIs that want beast's container.
+struct flat_headers
+{
+  struct value_type
+  {
+    core::string_view name;
+    core::string_view value;
+  };
+
+  flat_headers() = default;
+
+  explicit flat_headers(const http::fields & fields)
+  {
+    for (const auto & f : fields)
+      insert(f.name_string(), f.value());
+  }
+
+  /// Replace every `name` field with a single one set to `value`.
+  BOOST_REQUESTS_DECL void set(core::string_view name, core::string_view value);
+  void set(http::field field, core::string_view value)
+  {
+    set(beast::http::to_string(field), value);
+  }
+
+  /// Add a field, keeping existing ones of the same name (Set-Cookie et al).
+  BOOST_REQUESTS_DECL void insert(core::string_view name, core::string_view value);
+  void insert(http::field field, core::string_view value)
+  {
+    insert(beast::http::to_string(field), value);
+  }
+
+  /// The value of the first `name` field, or "" - like beast's operator[].
+  BOOST_REQUESTS_DECL core::string_view operator[](core::string_view name) const;
+  core::string_view operator[](http::field field) const
+  {
+    return (*this)[beast::http::to_string(field)];
+  }
+
+  BOOST_REQUESTS_DECL std::size_t count(core::string_view name) const;
+  bool contains(core::string_view name) const { return count(name) > 0u; }
+
+  /// Drop every `name` field; true if any was dropped.
+  BOOST_REQUESTS_DECL bool erase(core::string_view name);
+
+  std::size_t size()  const { return entries_.size(); }
+  bool        empty() const { return entries_.empty(); }
+  void clear() { block_.clear(); entries_.clear(); dead_ = 0u; }
+
+  /// Pre-size the char block; `bytes` of wire data, not a field count.
+  void reserve(std::size_t bytes) { block_.reserve(bytes); }
+
+  /// All fields in wire format, as one block ending in the last field's
+  /// CRLF; what a serializer copies in one go. Erased or replaced fields
+  /// leave holes in the block, so this compacts first when any exist.
+  BOOST_REQUESTS_DECL core::string_view wire();
+
+  /// Copy into beast's container, for APIs that want http::fields.
+  BOOST_REQUESTS_DECL http::fields to_fields(
+      container::pmr::memory_resource * res =
+          container::pmr::get_default_resource()) const;
+
+  // iteration, in case-insensitive name order
+  struct const_iterator
+  {
+    value_type operator*() const { return parent_->entry_at_(pos_); }
+    const_iterator & operator++() { pos_++; return *this; }
+    bool operator==(const const_iterator & rhs) const { return pos_ == rhs.pos_; }
+    bool operator!=(const const_iterator & rhs) const { return pos_ != rhs.pos_; }
+   private:
+    friend struct flat_headers;
+    const_iterator(const flat_headers * parent, std::size_t pos)
+        : parent_(parent), pos_(pos) {}
+    const flat_headers * parent_;
+    std::size_t pos_;
+  };
+  const_iterator begin() const { return const_iterator(this, 0u); }
+  const_iterator end()   const { return const_iterator(this, entries_.size()); }
+
+ private:
+  // one fragment per field: the name at off, then ": ", value, "\r\n"
+  struct entry_
+  {
+    std::uint32_t off, name_len, value_len;
+  };
+
+  static std::size_t wire_len_(const entry_ & e)
+  {
+    return std::size_t(e.name_len) + e.value_len + 4u;
+  }
+
+  value_type entry_at_(std::size_t pos) const
+  {
+    const auto & e = entries_[pos];
+    return value_type{
+        core::string_view(block_.data() + e.off, e.name_len),
+        core::string_view(block_.data() + e.off + e.name_len + 2u, e.value_len)};
+  }
+
+  // index range of `name`, [first, last)
+  BOOST_REQUESTS_DECL std::size_t lower_bound_(core::string_view name) const;
+  BOOST_REQUESTS_DECL std::size_t upper_bound_(core::string_view name) const;
+  BOOST_REQUESTS_DECL entry_ append_fragment_(core::string_view name, core::string_view value);
+  BOOST_REQUESTS_DECL void compact_();
+
+  std::string block_;
+  std::vector<entry_> entries_;
+  std::size_t dead_{0u};
+};
+
+}
+}
+
+#if defined(BOOST_REQUESTS_HEADER_ONLY)
+#include <boost/requests/impl/flat_headers.ipp>
+#endif
+
+#endif // BOOST_REQUESTS_FLAT_HEADERS_HPP
@@ -8,6 +8,7 @@
 #ifndef BOOST_REQUESTS_FORM_HPP
 #define BOOST_REQUESTS_FORM_HPP
 
+#include <boost/requests/detail/pctencode.hpp>
 #include <boost/url/url.hpp>
 #include <initializer_list>
 
@@ -21,7 +22,7 @@ struct form
 
   form(std::initializer_list<urls::param_view> params)
   {
-    storage.params().assign(std::move(params));
+    assign_(params.begin(), params.end());
   }
 
   form(form && ) = default;
@@ -31,9 +32,30 @@ struct form
   template<typename Container>
   form(Container && ct)
   {
-    storage.params().assign(std::begin(ct), std::end(ct));
+    assign_(std::begin(ct), std::end(ct));
   }
 
+ private:
+  // encode the query with the run-based encoder in detail/pctencode.hpp
+  // instead of going through params(), which classifies byte by byte.
+  template<typename Iterator>
+  void assign_(Iterator itr, Iterator end)
+  {
+    std::string q;
+    for (; itr != end; ++itr)
+    {
+      const urls::param_view p = *itr;
+      if (!q.empty())
+        q += '&';
+      detail::pctencode(p.key, q);
+      if (p.has_value)
+      {
+        q += '=';
+        detail::pctencode(p.value, q);
+      }
+    }
+    storage.set_encoded_query(q);
+  }
 };
 
 
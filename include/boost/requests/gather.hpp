@@ -0,0 +1,184 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_GATHER_HPP
+#define BOOST_REQUESTS_GATHER_HPP
+
+#include <boost/requests/request.hpp>
+#include <boost/requests/session.hpp>
+#include <boost/asio/append.hpp>
+#include <boost/asio/associated_allocator.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/recycling_allocator.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/core/span.hpp>
+#include <boost/optional.hpp>
+#include <boost/url/url.hpp>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+// Heap state shared by all in-flight GETs of one gather, the same shape as
+// the hedged ropen machinery: one allocation for the whole batch, copyable
+// attempt facades going into the sub-operations. The sub-requests may
+// complete concurrently on a multi-threaded executor, so the state follows
+// the pool's batch machinery: slots claimed and chains joined with atomics,
+// the error under a mutex, and the last chain to retire completes.
+template<typename Executor, typename Token>
+struct gather_state
+{
+  basic_session<Executor> * session;
+  // owned copies - the caller's views only need to survive initiation
+  std::vector<urls::url> urls;
+  // launch order, grouped by authority, see async_gather
+  std::vector<std::size_t> order;
+  std::vector<response> results;
+  std::atomic<std::size_t> next{0u};
+  std::atomic<std::size_t> outstanding{0u};
+  std::mutex mtx;
+  system::error_code first_ec;
+  optional<Token> on_done;
+
+  void set_error(system::error_code ec)
+  {
+    std::lock_guard<std::mutex> lock{mtx};
+    if (!first_ec)
+      first_ec = ec;
+  }
+};
+
+template<typename Executor, typename Token>
+struct gather_attempt;
+
+// claim the next slot; false when the order has run out
+template<typename Executor, typename Token>
+bool gather_launch(std::shared_ptr<gather_state<Executor, Token>> st)
+{
+  const auto slot = st->next.fetch_add(1u);
+  if (slot >= st->order.size())
+    return false;
+  const auto idx = st->order[slot];
+  auto & session = *st->session;
+  urls::url_view url = st->urls[idx];
+  async_request(session, http::verb::get, url, empty{}, http::fields{},
+                gather_attempt<Executor, Token>{std::move(st), idx});
+  return true;
+}
+
+template<typename Executor, typename Token>
+struct gather_attempt
+{
+  using executor_type = Executor;
+  executor_type get_executor() const { return st->session->get_executor(); }
+
+  std::shared_ptr<gather_state<Executor, Token>> st;
+  std::size_t idx;
+
+  void operator()(system::error_code ec, response res)
+  {
+    auto s = std::move(st);
+    if (!ec)
+      s->results[idx] = std::move(res); // exclusive slot, no lock needed
+    else
+      s->set_error(ec);
+    if (gather_launch(s))
+      return;
+    if (s->outstanding.fetch_sub(1u) == 1u)
+    {
+      auto tk = std::move(*s->on_done);
+      s->on_done.reset();
+      tk(s->first_ec, std::move(s->results));
+    }
+  }
+};
+
+}
+
+/// GET every URL over `session` and complete once with the responses in
+/// input order - the session-level sibling of
+/// basic_connection_pool::async_request_batch, for batches that span hosts.
+///
+/// One operation state serves the whole batch, and the launch order groups
+/// the URLs by authority: the first request to a host does that host's pool
+/// lookup (and DNS, connect, handshake), the ones behind it hit the
+/// session's lock-free pool snapshot and the warm connections. At most
+/// `parallelism` requests are in flight at a time.
+///
+/// A failed URL does not stop the rest: the first error is reported and
+/// the failed slots stay default-constructed.
+template<typename Executor,
+         BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, std::vector<response>)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code, std::vector<response>))
+async_gather(basic_session<Executor> & session,
+             span<const urls::url_view> urls,
+             std::size_t parallelism,
+             CompletionToken && completion_token)
+{
+  return asio::async_initiate<CompletionToken, void(boost::system::error_code, std::vector<response>)>(
+      [](auto handler,
+         basic_session<Executor> * session,
+         span<const urls::url_view> urls,
+         std::size_t parallelism)
+      {
+        using token_type = typename std::decay<decltype(handler)>::type;
+        if (urls.empty()) // never complete inline with the initiation
+          return asio::post(session->get_executor(),
+                            asio::append(std::move(handler),
+                                         system::error_code{}, std::vector<response>{}));
+
+        // shares the handler's allocator so asio's handler recycling applies
+        auto alloc = asio::get_associated_allocator(handler, asio::recycling_allocator<void>());
+        auto st = std::allocate_shared<detail::gather_state<Executor, token_type>>(alloc);
+        st->session = session;
+        st->urls.assign(urls.begin(), urls.end());
+        st->results.resize(st->urls.size());
+        st->order.resize(st->urls.size());
+        for (std::size_t i = 0u; i < st->order.size(); i++)
+          st->order[i] = i;
+        std::stable_sort(st->order.begin(), st->order.end(),
+                         [&](std::size_t lhs, std::size_t rhs)
+                         {
+                           return st->urls[lhs].encoded_authority()
+                                < st->urls[rhs].encoded_authority();
+                         });
+        st->on_done.emplace(std::move(handler));
+
+        if (parallelism == 0u)
+          parallelism = 1u;
+        const auto launch = (std::min)(parallelism, st->order.size());
+        st->outstanding = launch;
+        for (std::size_t i = 0u; i < launch; i++)
+          detail::gather_launch(st);
+      },
+      completion_token, &session, urls, parallelism);
+}
+
+/// As above with a default bound of eight requests in flight.
+template<typename Executor,
+         BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, std::vector<response>)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code, std::vector<response>))
+async_gather(basic_session<Executor> & session,
+             span<const urls::url_view> urls,
+             CompletionToken && completion_token)
+{
+  return async_gather(session, urls, 8u,
+                      std::forward<CompletionToken>(completion_token));
+}
+
+}
+}
+
+#endif // BOOST_REQUESTS_GATHER_HPP
@@ -7,6 +7,7 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/grammar/charset.hpp>
+#include <boost/requests/grammar/detail/charset_scan.hpp>
 
 namespace boost {
 namespace requests {
@@ -64,15 +65,19 @@ struct cookie_token_t
                && c != '{' && c != '}';;
     }
 
-#ifdef BOOST_URL_USE_SSE2
+#if defined(BOOST_URL_USE_SSE2) || defined(BOOST_REQUESTS_HAS_CHARSET_SCAN)
 
     char const *
     find_if(
             char const *first,
             char const *last) const noexcept
     {
+#if defined(BOOST_REQUESTS_HAS_CHARSET_SCAN)
+        return detail::find_if(first, last, *this);
+#else
         return urls::grammar::detail::find_if_pred(
                 *this, first, last);
+#endif
     }
 
     char const *
@@ -80,8 +85,12 @@ struct cookie_token_t
             char const *first,
             char const *last) const noexcept
     {
+#if defined(BOOST_REQUESTS_HAS_CHARSET_SCAN)
+        return detail::find_if_not(first, last, *this);
+#else
         return urls::grammar::detail::find_if_not_pred(
                 *this, first, last);
+#endif
     }
 
 #endif
@@ -0,0 +1,192 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_GRAMMAR_DETAIL_CHARSET_SCAN_HPP
+#define BOOST_REQUESTS_GRAMMAR_DETAIL_CHARSET_SCAN_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/url/grammar/charset.hpp>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__SSSE3__)
+# include <tmmintrin.h>
+# define BOOST_REQUESTS_HAS_CHARSET_SCAN 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+# include <arm_neon.h>
+# define BOOST_REQUESTS_HAS_CHARSET_SCAN 1
+#endif
+
+namespace boost {
+namespace requests {
+namespace grammar {
+namespace detail {
+
+#if defined(BOOST_REQUESTS_HAS_CHARSET_SCAN)
+
+/* Classify 16 bytes per step with the nibble-table trick used by Boost.JSON
+   and simdjson: for an ascii-only charset, byte c is a member iff bit
+   (c >> 4) of lo[c & 15] is set. A single shuffle looks up lo by the low
+   nibble and a second maps the high nibble to its bit, so membership of a
+   whole vector is two shuffles, an AND and a compare. Bytes >= 0x80 never
+   match. The tables are built at compile time from the charset, which
+   therefore has to be stateless (all of ours and boost.url's builtins are;
+   lut_chars is not and takes the scalar path). */
+template<class CharSet>
+struct charset_nibble_table
+{
+  std::uint8_t lo[16];
+  bool ascii_only;
+
+  constexpr charset_nibble_table() : lo{}, ascii_only(true)
+  {
+    const CharSet cs{};
+    for (int c = 0; c < 256; c++)
+      if (cs(static_cast<char>(static_cast<unsigned char>(c))))
+      {
+        if (c >= 0x80)
+          ascii_only = false;
+        else
+          lo[c & 15] = static_cast<std::uint8_t>(lo[c & 15] | (1u << (c >> 4)));
+      }
+  }
+};
+
+// bit mask of the bytes NOT in the charset, lowest bit = first byte.
+template<class CharSet>
+std::uint32_t mismatch_mask_16(const charset_nibble_table<CharSet> & t, const char * p) noexcept
+{
+#if defined(__SSSE3__)
+  const __m128i lo_table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t.lo));
+  const __m128i bit_table = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                          0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  // pshufb yields 0 for bytes with the high bit set, so >= 0x80 can't match
+  const __m128i rows = _mm_shuffle_epi8(lo_table, data);
+  const __m128i hi   = _mm_and_si128(_mm_srli_epi16(data, 4), _mm_set1_epi8(0x0f));
+  const __m128i bits = _mm_shuffle_epi8(bit_table, hi);
+  const __m128i miss = _mm_cmpeq_epi8(_mm_and_si128(rows, bits), _mm_setzero_si128());
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(miss));
+#else
+  const uint8x16_t lo_table = vld1q_u8(t.lo);
+  const std::uint8_t bit_data[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                     0, 0, 0, 0, 0, 0, 0, 0};
+  const uint8x16_t bit_table = vld1q_u8(bit_data);
+  const uint8x16_t data = vld1q_u8(reinterpret_cast<const std::uint8_t*>(p));
+  // out-of-range tbl indices yield 0, mirroring the pshufb behaviour above
+  const uint8x16_t rows = vqtbl1q_u8(lo_table, vorrq_u8(vandq_u8(data, vdupq_n_u8(0x0f)),
+                                                        vandq_u8(data, vdupq_n_u8(0x80))));
+  const uint8x16_t bits = vqtbl1q_u8(bit_table, vshrq_n_u8(data, 4));
+  const uint8x16_t miss = vceqq_u8(vandq_u8(rows, bits), vdupq_n_u8(0));
+  // narrow each lane to a nibble so the mask fits a scalar register
+  const std::uint64_t m = vget_lane_u64(vreinterpret_u64_u8(
+      vshrn_n_u16(vreinterpretq_u16_u8(miss), 4)), 0);
+  std::uint32_t res = 0u;
+  for (int i = 0; i < 16; i++)
+    if ((m >> (i * 4)) & 1u)
+      res |= 1u << i;
+  return res;
+#endif
+}
+
+inline unsigned mask_ctz(std::uint32_t m) noexcept
+{
+#if defined(_MSC_VER)
+  unsigned long idx;
+  _BitScanForward(&idx, m);
+  return idx;
+#else
+  return static_cast<unsigned>(__builtin_ctz(m));
+#endif
+}
+
+template<class CharSet>
+char const * find_if_not_(char const * first, char const * last,
+                          CharSet const &, std::true_type /* stateless */) noexcept
+{
+  static constexpr charset_nibble_table<CharSet> table{};
+  const CharSet cs{};
+  if (table.ascii_only)
+    while (last - first >= 16)
+    {
+      const auto miss = mismatch_mask_16(table, first);
+      if (miss != 0u)
+        return first + mask_ctz(miss);
+      first += 16;
+    }
+  // scalar tail; must not bounce through the charset's own find_if_not.
+  while (first != last && cs(*first))
+    first++;
+  return first;
+}
+
+template<class CharSet>
+char const * find_if_(char const * first, char const * last,
+                      CharSet const &, std::true_type /* stateless */) noexcept
+{
+  static constexpr charset_nibble_table<CharSet> table{};
+  const CharSet cs{};
+  if (table.ascii_only)
+    while (last - first >= 16)
+    {
+      const auto hit = (~mismatch_mask_16(table, first)) & 0xffffu;
+      if (hit != 0u)
+        return first + mask_ctz(hit);
+      first += 16;
+    }
+  while (first != last && !cs(*first))
+    first++;
+  return first;
+}
+
+template<class CharSet>
+char const * find_if_not_(char const * first, char const * last,
+                          CharSet const & cs, std::false_type) noexcept
+{
+  return (urls::grammar::find_if_not)(first, last, cs);
+}
+
+template<class CharSet>
+char const * find_if_(char const * first, char const * last,
+                      CharSet const & cs, std::false_type) noexcept
+{
+  return (urls::grammar::find_if)(first, last, cs);
+}
+
+template<class CharSet>
+using is_scannable = std::integral_constant<bool,
+    std::is_empty<CharSet>::value &&
+    std::is_default_constructible<CharSet>::value>;
+
+#endif // defined(BOOST_REQUESTS_HAS_CHARSET_SCAN)
+
+template<class CharSet>
+char const * find_if_not(char const * first, char const * last, CharSet const & cs) noexcept
+{
+#if defined(BOOST_REQUESTS_HAS_CHARSET_SCAN)
+  return find_if_not_(first, last, cs, is_scannable<CharSet>{});
+#else
+  return (urls::grammar::find_if_not)(first, last, cs);
+#endif
+}
+
+template<class CharSet>
+char const * find_if(char const * first, char const * last, CharSet const & cs) noexcept
+{
+#if defined(BOOST_REQUESTS_HAS_CHARSET_SCAN)
+  return find_if_(first, last, cs, is_scannable<CharSet>{});
+#else
+  return (urls::grammar::find_if)(first, last, cs);
+#endif
+}
+
+} // detail
+} // grammar
+} // requests
+} // boost
+
+#endif // BOOST_REQUESTS_GRAMMAR_DETAIL_CHARSET_SCAN_HPP
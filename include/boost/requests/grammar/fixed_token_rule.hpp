@@ -7,6 +7,7 @@
 
 #include <boost/url/grammar.hpp>
 #include <boost/requests/detail/config.hpp>
+#include <boost/requests/grammar/detail/charset_scan.hpp>
 
 namespace boost {
 namespace requests {
@@ -69,7 +70,7 @@ struct fixed_token_rule_t
                     urls::grammar::error::need_more);
 
         const auto e = std::next(it, Size);
-        it = (urls::grammar::find_if_not)(it, e, cs_);
+        it = detail::find_if_not(it, e, cs_);
         if(it == e)
             return core::string_view(it0, it - it0);
         BOOST_REQUESTS_RETURN_EC(
@@ -120,7 +121,7 @@ struct fixed_token_rule_2_t
     const auto emin = std::next(it, MinSize);
     const auto e = (std::min)(std::next(it, MaxSize), end);
 
-    it = (urls::grammar::find_if_not)(it, e, cs_);
+    it = detail::find_if_not(it, e, cs_);
     if(it >= emin)
       return core::string_view(it0, it - it0);
     BOOST_REQUESTS_RETURN_EC(
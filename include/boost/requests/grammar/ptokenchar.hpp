@@ -9,6 +9,7 @@
 #define BOOST_REQUESTS_GRAMMAR_PTOKENCHAR_HPP
 
 #include <boost/url/grammar/alnum_chars.hpp>
+#include <boost/requests/grammar/detail/charset_scan.hpp>
 
 
 namespace boost {
@@ -84,15 +85,19 @@ struct ptokenchar_t
         ;
   }
 
-#ifdef BOOST_URL_USE_SSE2
+#if defined(BOOST_URL_USE_SSE2) || defined(BOOST_REQUESTS_HAS_CHARSET_SCAN)
 
   char const *
   find_if(
       char const *first,
       char const *last) const noexcept
   {
+#if defined(BOOST_REQUESTS_HAS_CHARSET_SCAN)
+    return detail::find_if(first, last, *this);
+#else
     return urls::grammar::detail::find_if_pred(
         *this, first, last);
+#endif
   }
 
   char const *
@@ -100,8 +105,12 @@ struct ptokenchar_t
       char const *first,
       char const *last) const noexcept
   {
+#if defined(BOOST_REQUESTS_HAS_CHARSET_SCAN)
+    return detail::find_if_not(first, last, *this);
+#else
     return urls::grammar::detail::find_if_not_pred(
         *this, first, last);
+#endif
   }
 
 #endif
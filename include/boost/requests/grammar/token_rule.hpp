@@ -9,6 +9,7 @@
 #define BOOST_REQUESTS_GRAMMAR_TOKEN_RULE_HPP
 
 #include "boost/requests/detail/config.hpp"
+#include <boost/requests/grammar/detail/charset_scan.hpp>
 #include <boost/url/grammar/token_rule.hpp>
 
 namespace boost {
@@ -77,7 +78,7 @@ struct token_rule_2_t
       BOOST_REQUESTS_RETURN_EC(
           urls::grammar::error::mismatch);
 
-    it = (urls::grammar::find_if_not)(++it, end, csr_);
+    it = detail::find_if_not(++it, end, csr_);
     return urls::string_view(it0, it - it0);
   }
 
@@ -0,0 +1,112 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_HISTOGRAM_HPP
+#define BOOST_REQUESTS_HISTOGRAM_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost
+{
+namespace requests
+{
+
+/// A log-bucketed (HDR-style) latency distribution, cheap enough to sit on
+/// the request path: record() is two or three relaxed atomic adds, snap()
+/// reads the counters without stopping traffic. Bucket i holds durations
+/// in [2^i, 2^(i+1)) microseconds, so the resolution is a constant factor
+/// of two everywhere - coarse, but it keeps the multimodality averages
+/// flatten out (a bimodal retry hump sits two buckets to the right of the
+/// happy path, an average just drifts).
+///
+/// A snapshot taken under traffic is not a consistent cut - counters may
+/// be mid-update relative to each other - which is fine for monitoring and
+/// the price of not locking.
+struct latency_histogram
+{
+  using duration = std::chrono::steady_clock::duration;
+
+  /// 2^31 microseconds is ~36 minutes; everything above lands in the last
+  /// bucket, everything below 1us in the first.
+  constexpr static std::size_t bucket_count = 32u;
+
+  struct snapshot
+  {
+    std::uint64_t count{0u};
+    /// the sum, for averages
+    std::uint64_t total_us{0u};
+    std::uint64_t buckets[bucket_count]{};
+
+    /// The upper bound of the bucket the q-quantile (0 < q <= 1) falls
+    /// into, i.e. p99 <= quantile(0.99) < 2 * p99. Zero when empty.
+    std::chrono::microseconds quantile(double q) const
+    {
+      if (count == 0u)
+        return std::chrono::microseconds(0);
+      const auto rank = static_cast<std::uint64_t>(q * static_cast<double>(count));
+      std::uint64_t seen = 0u;
+      for (std::size_t i = 0u; i < bucket_count; i++)
+      {
+        seen += buckets[i];
+        if (seen > rank || (seen == count))
+          return std::chrono::microseconds(std::uint64_t(1u) << (i + 1u));
+      }
+      return std::chrono::microseconds(std::uint64_t(1u) << bucket_count);
+    }
+  };
+
+  void record(duration d)
+  {
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+    if (us < 0)
+      us = 0;
+    buckets_[index_(static_cast<std::uint64_t>(us))].fetch_add(1u, std::memory_order_relaxed);
+    count_   .fetch_add(1u, std::memory_order_relaxed);
+    total_us_.fetch_add(static_cast<std::uint64_t>(us), std::memory_order_relaxed);
+  }
+
+  snapshot snap() const
+  {
+    snapshot s;
+    s.count    = count_   .load(std::memory_order_relaxed);
+    s.total_us = total_us_.load(std::memory_order_relaxed);
+    for (std::size_t i = 0u; i < bucket_count; i++)
+      s.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+    return s;
+  }
+
+  latency_histogram() = default;
+  // moved like pool_metrics: the values carry over, concurrent updates to
+  // the source are lost.
+  latency_histogram(latency_histogram && lhs) noexcept
+      : count_(lhs.count_.load()), total_us_(lhs.total_us_.load())
+  {
+    for (std::size_t i = 0u; i < bucket_count; i++)
+      buckets_[i] = lhs.buckets_[i].load();
+  }
+
+ private:
+  static std::size_t index_(std::uint64_t us)
+  {
+    std::size_t b = 0u;
+    while ((us >> (b + 1u)) != 0u && (b + 1u) < bucket_count)
+      b++;
+    return b;
+  }
+
+  std::atomic<std::uint64_t> count_{0u}, total_us_{0u};
+  std::atomic<std::uint64_t> buckets_[bucket_count]{};
+};
+
+}
+}
+
+#endif // BOOST_REQUESTS_HISTOGRAM_HPP
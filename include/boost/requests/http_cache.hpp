@@ -0,0 +1,207 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_HTTP_CACHE_HPP
+#define BOOST_REQUESTS_HTTP_CACHE_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/requests/fields/keep_alive.hpp>
+#include <boost/requests/http.hpp>
+#include <boost/requests/stream.hpp>
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/optional.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/url/url_view.hpp>
+#include <chrono>
+#include <mutex>
+#include <string>
+
+namespace boost
+{
+namespace requests
+{
+namespace detail
+{
+
+// stream_base implementation replaying a stored response, so a cache hit is
+// served through the same basic_stream interface as a wire response. The
+// bytes come from a read-only file mapping (or a buffer owned directly,
+// right after a fill); the object deletes itself from do_release_buffer_(),
+// the stream destructor's last use of its impl.
+struct cache_replay final : stream_base
+{
+  cache_replay(asio::any_io_executor exec, std::string host)
+      : exec_(std::move(exec)), host_(std::move(host)) {}
+
+  cache_replay(const cache_replay & ) = delete;
+  BOOST_REQUESTS_DECL ~cache_replay();
+
+  // exactly one of the two holds the entry
+  void * map_ = nullptr;
+  std::size_t map_size_{0u};
+  std::string owned_;
+
+  const char * base_ = nullptr;
+  std::size_t size_{0u};
+  std::size_t pos_{0u}; // starts past the metadata prefix for mapped entries
+
+  asio::any_io_executor exec_;
+  std::string host_;
+  keep_alive keep_alive_;
+  bool open_{true};
+
+  BOOST_REQUESTS_DECL std::size_t do_read_some_(beast::http::basic_parser<false> & parser) override;
+  BOOST_REQUESTS_DECL std::size_t do_read_some_(beast::http::basic_parser<false> & parser, system::error_code & ec) override;
+  BOOST_REQUESTS_DECL void  do_async_read_some_(beast::http::basic_parser<false> & parser, detail::co_token_t<void(system::error_code, std::size_t)> tk) override;
+
+  BOOST_REQUESTS_DECL std::size_t do_buffered_input_() const override;
+  BOOST_REQUESTS_DECL std::size_t do_read_body_direct_(detail::buffer_span buffers, system::error_code & ec) override;
+  BOOST_REQUESTS_DECL void  do_async_read_body_direct_(detail::buffer_span buffers, detail::co_token_t<void(system::error_code, std::size_t)> tk) override;
+
+  BOOST_REQUESTS_DECL asio::const_buffer do_staged_input_() const override;
+  BOOST_REQUESTS_DECL void do_consume_staged_(std::size_t n) override;
+  BOOST_REQUESTS_DECL std::size_t do_stage_input_(system::error_code & ec) override;
+  BOOST_REQUESTS_DECL void do_async_stage_input_(detail::co_token_t<void(system::error_code, std::size_t)> tk) override;
+
+  BOOST_REQUESTS_DECL void do_close_(system::error_code & ec) override;
+  BOOST_REQUESTS_DECL void do_async_close_(detail::co_token_t<void(system::error_code)> tk) override;
+
+#if defined(__linux__)
+  BOOST_REQUESTS_DECL bool do_supports_splice_() const override;
+  BOOST_REQUESTS_DECL std::size_t do_splice_body_(int fd, std::size_t n, bool block, system::error_code & ec) override;
+  BOOST_REQUESTS_DECL void do_async_wait_readable_(detail::co_token_t<void(system::error_code)> tk) override;
+#endif
+
+  BOOST_REQUESTS_DECL void do_read_header_(beast::http::basic_parser<false> & parser, system::error_code & ec) override;
+  BOOST_REQUESTS_DECL void do_async_read_header_(beast::http::basic_parser<false> & parser, detail::co_token_t<void(system::error_code, std::size_t)> tk) override;
+  BOOST_REQUESTS_DECL core::string_view get_host_() const override;
+
+  BOOST_REQUESTS_DECL keep_alive & get_keep_alive_set_() override;
+  BOOST_REQUESTS_DECL bool is_open() const override;
+
+  BOOST_REQUESTS_DECL void do_release_buffer_() override;
+};
+
+template<typename Executor>
+struct async_cache_fill_op;
+
+// request side of the check: only plain GETs without a no-store or
+// no-cache directive touch the cache.
+template<typename Body>
+bool cache_usable(const beast::http::request<Body, http::fields> & req)
+{
+  if (req.method() != beast::http::verb::get)
+    return false;
+  const auto itr = req.find(beast::http::field::cache_control);
+  if (itr == req.end())
+    return true;
+  return itr->value().find("no-store") == core::string_view::npos
+      && itr->value().find("no-cache") == core::string_view::npos;
+}
+
+}
+
+/// An opt-in response cache for idempotent GETs, in the style of RFC 9111:
+/// responses with explicit freshness (Cache-Control max-age or Expires) are
+/// persisted under a directory and served from a read-only file mapping
+/// while fresh, removing the network round trip entirely. Attach it to a
+/// session with set_cache; it must outlive the session. Bodies are captured
+/// store-and-forward, so only responses with a known content-length up to
+/// max_entry_size get recorded.
+struct http_cache
+{
+  /// Open (or create) the store under `directory`; entries written by an
+  /// earlier run get indexed again.
+  BOOST_REQUESTS_DECL explicit http_cache(filesystem::path directory);
+
+  http_cache(const http_cache & ) = delete;
+
+  /// Largest body that gets recorded; bigger responses pass through uncached.
+  std::size_t max_entry_size{1024u * 1024u};
+
+  /// Serve a fresh stored response for `url`, if there is one.
+  template<typename Executor>
+  optional<basic_stream<Executor>> match(Executor exec, urls::url_view url);
+
+  /// True if the response on `str` can be recorded: storable per its
+  /// headers, not content-decoded, and a known body length within bounds.
+  template<typename Executor>
+  bool capturable(basic_stream<Executor> & str) const;
+
+  /// Record the response on `str` and hand back a replay of it, so hit and
+  /// fill get served through the same path. On a read error the original
+  /// stream comes back with ec set.
+  template<typename Executor>
+  basic_stream<Executor> fill(Executor exec, urls::url_view url,
+                              basic_stream<Executor> str, system::error_code & ec);
+
+  /// True if a response may be stored: a 200 with explicit freshness and
+  /// without a no-store directive.
+  BOOST_REQUESTS_DECL static bool cacheable(const http::response_header & h);
+
+  /// Hand out the stored validators for `url`, if an (expired) entry still
+  /// has any; used to turn a refetch into a conditional request.
+  BOOST_REQUESTS_DECL bool validators_for(core::string_view url,
+                                          std::string & etag,
+                                          std::string & last_modified);
+
+  /// Serve the stored entry for `url` after a 304, taking fresh expiry
+  /// and validators from the not-modified response's headers.
+  template<typename Executor>
+  optional<basic_stream<Executor>> revalidated(Executor exec, urls::url_view url,
+                                               const http::response_header & h);
+
+  /// Drop all entries, including the files on disk.
+  BOOST_REQUESTS_DECL void clear();
+
+ private:
+  template<typename>
+  friend struct detail::async_cache_fill_op;
+  // the session's single-flight fan-out serializes responses the same way
+  template<typename>
+  friend struct basic_session;
+
+  struct entry_
+  {
+    std::string path;
+    std::chrono::system_clock::time_point expires;
+    // validators, kept for conditional revalidation
+    std::string etag, last_modified;
+  };
+
+  BOOST_REQUESTS_DECL detail::cache_replay * do_match_(asio::any_io_executor exec, core::string_view url,
+                                                       bool ignore_freshness = false);
+  BOOST_REQUESTS_DECL void refresh_(core::string_view url, const http::response_header & h);
+  BOOST_REQUESTS_DECL static std::string make_payload_(http::response_header h, core::string_view body);
+  BOOST_REQUESTS_DECL void store_(core::string_view url, core::string_view host,
+                                  const http::response_header & h, const std::string & payload);
+  BOOST_REQUESTS_DECL void scan_();
+
+  template<typename Executor>
+  static optional<basic_stream<Executor>> stream_from_(Executor exec, detail::cache_replay * src);
+
+  template<typename Executor>
+  basic_stream<Executor> serve_filled_(Executor exec, urls::url_view url,
+                                       basic_stream<Executor> str, beast::flat_buffer & buf);
+
+  filesystem::path directory_;
+  std::mutex mtx_;
+  boost::unordered_map<std::string, entry_> entries_;
+};
+
+}
+}
+
+#include <boost/requests/impl/http_cache.hpp>
+
+#if defined(BOOST_REQUESTS_HEADER_ONLY)
+#include <boost/requests/impl/http_cache.ipp>
+#endif
+
+#endif // BOOST_REQUESTS_HTTP_CACHE_HPP
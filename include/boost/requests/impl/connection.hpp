@@ -11,16 +11,26 @@
 #include <boost/requests/connection.hpp>
 #include <boost/requests/detail/async_coroutine.hpp>
 #include <boost/requests/detail/config.hpp>
+#include <boost/requests/detail/header_block.hpp>
 #include <boost/requests/detail/ssl.hpp>
 #include <boost/requests/fields/location.hpp>
 #include <boost/requests/request_settings.hpp>
 #include <boost/requests/keep_alive.hpp>
 
 #include <boost/asem/lock_guard.hpp>
+#include <boost/asio/associated_allocator.hpp>
+#include <boost/asio/bind_executor.hpp>
+#include <boost/asio/compose.hpp>
 #include <boost/asio/deferred.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/recycling_allocator.hpp>
 #include <boost/asio/redirect_error.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/asio/ssl/host_name_verification.hpp>
+#include <boost/asio/write.hpp>
 #include <boost/asio/yield.hpp>
+#include <boost/beast/http/parser.hpp>
+#include <boost/beast/http/serializer.hpp>
 #include <boost/beast/core/buffer_ref.hpp>
 #include <boost/container/pmr/monotonic_buffer_resource.hpp>
 #include <boost/core/exchange.hpp>
@@ -29,6 +39,16 @@
 #include <boost/smart_ptr/allocate_unique.hpp>
 #include <boost/url/grammar/ci_string.hpp>
 
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if !defined(_WIN32)
+#include <poll.h>
+#endif
+
 
 namespace boost {
 namespace requests {
@@ -60,17 +80,176 @@ void shutdown(Stream *stream, system::error_code &ec)
 void shutdown(std::nullptr_t, system::error_code &) {}
 
 
+// open the socket ourselves (connect would) so the option profile lands
+// between open and connect, where it still covers the first request.
+template<typename Socket, typename Ep>
+void open_with_options(Socket & sock, const Ep & ep,
+                       const socket_options * sopts,
+                       system::error_code & ec)
+{
+  if (!sock.is_open())
+    sock.open(ep.protocol(), ec);
+  if (!ec && sopts != nullptr)
+    detail::apply_socket_options(sock, *sopts);
+}
+
+// One CONNECT exchange (RFC 9110 §9.3.6) on an already-connected socket;
+// the origin the proxy shall dial goes into the request target and Host
+// as "host:port". Anything but a 2xx means no tunnel.
+struct tunnel_state_
+{
+  explicit tunnel_state_(const std::string & target)
+    : req(beast::http::verb::connect, target, 11)
+  {
+    req.set(beast::http::field::host, target);
+    parser.skip(true); // a successful CONNECT response has no body
+  }
+  beast::http::request<beast::http::empty_body> req;
+  beast::flat_buffer buffer;
+  // only the status class of the proxy's reply matters, so the header
+  // lands in a flat block instead of per-field allocated fields
+  header_block hb;
+  header_block_parser parser{hb};
+};
+
+template<typename Socket>
+void tunnel_impl(Socket & socket, const std::string & target, system::error_code & ec)
+{
+  tunnel_state_ st{target};
+  beast::http::write(socket, st.req, ec);
+  if (ec)
+    return;
+  beast::http::read_header(socket, st.buffer, st.parser, ec);
+  if (!ec && beast::http::to_status_class(st.hb.result())
+           != beast::http::status_class::successful)
+    BOOST_REQUESTS_ASSIGN_EC(ec, error::tunnel_failed);
+}
+
+// the same exchange as a lazy deferred operation completing with void(ec),
+// so the connect chains below can splice it in before the TLS handshake.
+template<typename Socket>
+auto tunnel_exchange(Socket & socket, std::shared_ptr<tunnel_state_> st)
+{
+  using asio::deferred;
+  return beast::http::async_write(socket, st->req,
+      deferred([&socket, st](system::error_code ec, std::size_t)
+      {
+        return deferred.when(!ec)
+            .then(beast::http::async_read_header(socket, st->buffer, st->parser,
+                  deferred([st](system::error_code ec, std::size_t)
+                  {
+                    if (!ec && beast::http::to_status_class(st->hb.result())
+                             != beast::http::status_class::successful)
+                      BOOST_REQUESTS_ASSIGN_EC(ec, error::tunnel_failed);
+                    return deferred.values(ec);
+                  })))
+            .otherwise(deferred.values(ec));
+      }));
+}
+
+template<typename Socket, typename Token>
+auto async_tunnel_impl(Socket & socket, const std::string & target, Token && token)
+{
+  // op states use the token's allocator so asio's handler recycling applies
+  auto alloc = asio::get_associated_allocator(token, asio::recycling_allocator<void>());
+  return tunnel_exchange(socket, std::allocate_shared<tunnel_state_>(alloc, target))
+      (std::forward<Token>(token));
+}
+
+// The handshake with its crypto on a side executor, see
+// basic_connection::set_handshake_executor: the operation is initiated
+// from there - the first chunk of the key exchange runs in the initiation
+// - and its intermediate handlers are bound to it, so the io thread only
+// ever sees the socket reads and writes. The caller is resumed back on
+// the io executor, so nothing downstream runs off-thread. Without a side
+// executor this is a plain async_handshake, no extra hops.
+template<typename Ssl>
+struct handshake_on_op : asio::coroutine
+{
+  Ssl * ssl;
+  asio::any_io_executor hs_ex;
+  system::error_code ec_;
+
+  template<typename Self>
+  void operator()(Self && self, system::error_code ec = {})
+  {
+    reenter(this)
+    {
+      if (!hs_ex)
+      {
+        yield ssl->async_handshake(asio::ssl::stream_base::client, std::move(self));
+        return self.complete(ec);
+      }
+      yield asio::dispatch(hs_ex, std::move(self));
+      yield ssl->async_handshake(asio::ssl::stream_base::client,
+                                 asio::bind_executor(hs_ex, std::move(self)));
+      ec_ = ec;
+      yield asio::post(ssl->get_executor(), std::move(self));
+      return self.complete(ec_);
+    }
+  }
+};
+
+template<typename Ssl, typename Token>
+auto async_handshake_on(Ssl * ssl, asio::any_io_executor hs_ex, Token && token)
+{
+  return asio::async_compose<Token, void(system::error_code)>(
+      handshake_on_op<Ssl>{{}, ssl, std::move(hs_ex)},
+      token, ssl->get_executor());
+}
+
+template<typename Token>
+auto async_handshake_on(std::nullptr_t, const asio::any_io_executor &, Token && token)
+{
+  return asio::post(asio::append(std::forward<Token>(token), system::error_code{}));
+}
+
 template<typename Stream, typename Ep >
 void connect_impl(Stream & stream,
                    Ep ep,
-                   system::error_code & ec)
+                   system::error_code & ec,
+                   ssl_session_cache * session_cache = nullptr,
+                   const std::string & host = {},
+                   timing * tm = nullptr,
+                   const socket_options * sopts = nullptr,
+                   const std::string * tunnel = nullptr,
+                   trace_hook * hook = nullptr)
 {
   // if it's ssl we assume the host has been set up properly
-  beast::get_lowest_layer(stream).connect(ep, ec);
+  detail::offer_alpn(stream);
+  detail::apply_session(session_cache, detail::get_ssl_layer(stream), host);
+  if (tm)
+    tm->connect_start = timing::clock_type::now();
+  BOOST_REQUESTS_TRACE_ENTER(hook, connect, host);
+  detail::open_with_options(beast::get_lowest_layer(stream), ep, sopts, ec);
+  if (!ec)
+    beast::get_lowest_layer(stream).connect(ep, ec);
+  if (tm)
+    tm->connect_done = timing::clock_type::now();
+  BOOST_REQUESTS_TRACE_EXIT(hook, connect, ec);
   if (ec)
     return ;
 
+  // the proxy tunnel is part of the dial: it must stand before the origin
+  // sees the first TLS byte.
+  if (tunnel != nullptr && !tunnel->empty())
+  {
+    detail::tunnel_impl(beast::get_lowest_layer(stream), *tunnel, ec);
+    if (ec)
+      return;
+  }
+
+  if (!std::is_same<decltype(detail::get_ssl_layer(stream)), std::nullptr_t>::value)
+    BOOST_REQUESTS_TRACE_ENTER(hook, handshake, host);
   detail::handshake(detail::get_ssl_layer(stream), ec);
+  if (!std::is_same<decltype(detail::get_ssl_layer(stream)), std::nullptr_t>::value)
+  {
+    if (tm)
+      tm->handshake_done = timing::clock_type::now();
+    BOOST_REQUESTS_TRACE_EXIT(hook, handshake, ec);
+  }
+  if (!ec)
+    detail::store_session(session_cache, detail::get_ssl_layer(stream), host);
 }
 
 template<typename Stream>
@@ -83,32 +262,148 @@ void close_impl(Stream & stream,
 
 
 template<typename Stream, typename Ep, typename Token, typename Ssl>
-void async_connect_impl(Stream & stream, Ep && ep, Token && token, Ssl * ssl)
+void async_connect_impl(Stream & stream, Ep && ep, Token && token, Ssl * ssl,
+                        ssl_session_cache * session_cache, const std::string & host,
+                        timing * tm, const socket_options * sopts,
+                        const std::string * tunnel,
+                        trace_hook * hook = nullptr,
+                        asio::any_io_executor hs_ex = {})
 {
   using asio::deferred;
+  detail::offer_alpn_impl(ssl, false);
+  detail::apply_session(session_cache, ssl, host);
+  if (tm)
+    tm->connect_start = timing::clock_type::now();
+  BOOST_REQUESTS_TRACE_ENTER(hook, connect, host);
+  {
+    system::error_code ec;
+    detail::open_with_options(beast::get_lowest_layer(stream), ep, sopts, ec);
+    if (ec)
+    {
+      BOOST_REQUESTS_TRACE_EXIT(hook, connect, ec);
+      return asio::post(asio::append(std::forward<Token>(token), ec));
+    }
+  }
+  if (tunnel == nullptr || tunnel->empty())
+    return beast::get_lowest_layer(stream).
+        async_connect(std::forward<Ep>(ep),
+            deferred(
+                [ssl, session_cache, host, tm, hook, hs_ex](system::error_code ec)
+                {
+                  if (tm)
+                    tm->connect_done = timing::clock_type::now();
+                  BOOST_REQUESTS_TRACE_EXIT(hook, connect, ec);
+                  if (!ec)
+                    BOOST_REQUESTS_TRACE_ENTER(hook, handshake, host);
+                  return deferred.when(!ec)
+                      .then(async_handshake_on(ssl, hs_ex,
+                                deferred(
+                                    [ssl, session_cache, host, tm, hook](system::error_code ec)
+                                    {
+                                      if (tm)
+                                        tm->handshake_done = timing::clock_type::now();
+                                      BOOST_REQUESTS_TRACE_EXIT(hook, handshake, ec);
+                                      if (!ec)
+                                        detail::store_session(session_cache, ssl, host);
+                                      return deferred.values(ec);
+                                    })))
+                      .otherwise(deferred.values(ec));
+                }))(std::forward<Token>(token));
+
+  auto alloc = asio::get_associated_allocator(token, asio::recycling_allocator<void>());
+  auto st = std::allocate_shared<tunnel_state_>(alloc, *tunnel);
   return beast::get_lowest_layer(stream).
       async_connect(std::forward<Ep>(ep),
           deferred(
-              [ssl](system::error_code ec)
+              [&stream, st, ssl, session_cache, host, tm, hook, hs_ex](system::error_code ec)
               {
+                if (tm)
+                  tm->connect_done = timing::clock_type::now();
+                BOOST_REQUESTS_TRACE_EXIT(hook, connect, ec);
                 return deferred.when(!ec)
-                    .then(ssl->async_handshake(asio::ssl::stream_base::client, asio::deferred_t()))
+                    .then(tunnel_exchange(beast::get_lowest_layer(stream), st)(
+                          deferred(
+                              [ssl, session_cache, host, tm, hook, hs_ex](system::error_code ec)
+                              {
+                                if (!ec)
+                                  BOOST_REQUESTS_TRACE_ENTER(hook, handshake, host);
+                                return deferred.when(!ec)
+                                    .then(async_handshake_on(ssl, hs_ex,
+                                              deferred(
+                                                  [ssl, session_cache, host, tm, hook](system::error_code ec)
+                                                  {
+                                                    if (tm)
+                                                      tm->handshake_done = timing::clock_type::now();
+                                                    BOOST_REQUESTS_TRACE_EXIT(hook, handshake, ec);
+                                                    if (!ec)
+                                                      detail::store_session(session_cache, ssl, host);
+                                                    return deferred.values(ec);
+                                                  })))
+                                    .otherwise(deferred.values(ec));
+                              })))
                     .otherwise(deferred.values(ec));
               }))(std::forward<Token>(token));
 }
 
 template<typename Stream, typename Ep, typename Token>
-void async_connect_impl(Stream & stream, Ep && ep, Token && token, std::nullptr_t)
+void async_connect_impl(Stream & stream, Ep && ep, Token && token, std::nullptr_t,
+                        ssl_session_cache *, const std::string & host,
+                        timing * tm, const socket_options * sopts,
+                        const std::string * tunnel,
+                        trace_hook * hook = nullptr,
+                        asio::any_io_executor = {})
 {
-  return beast::get_lowest_layer(stream).async_connect(std::forward<Ep>(ep), std::forward<Token>(token));
+  using asio::deferred;
+  if (tm)
+    tm->connect_start = timing::clock_type::now();
+  BOOST_REQUESTS_TRACE_ENTER(hook, connect, host);
+  {
+    system::error_code ec;
+    detail::open_with_options(beast::get_lowest_layer(stream), ep, sopts, ec);
+    if (ec)
+    {
+      BOOST_REQUESTS_TRACE_EXIT(hook, connect, ec);
+      return asio::post(asio::append(std::forward<Token>(token), ec));
+    }
+  }
+  if (tunnel == nullptr || tunnel->empty())
+    return beast::get_lowest_layer(stream).async_connect(std::forward<Ep>(ep),
+            deferred(
+                [tm, hook](system::error_code ec)
+                {
+                  if (tm)
+                    tm->connect_done = timing::clock_type::now();
+                  BOOST_REQUESTS_TRACE_EXIT(hook, connect, ec);
+                  return deferred.values(ec);
+                }))(std::forward<Token>(token));
+
+  auto alloc = asio::get_associated_allocator(token, asio::recycling_allocator<void>());
+  auto st = std::allocate_shared<tunnel_state_>(alloc, *tunnel);
+  return beast::get_lowest_layer(stream).async_connect(std::forward<Ep>(ep),
+          deferred(
+              [&stream, st, tm, hook](system::error_code ec)
+              {
+                if (tm)
+                  tm->connect_done = timing::clock_type::now();
+                BOOST_REQUESTS_TRACE_EXIT(hook, connect, ec);
+                return deferred.when(!ec)
+                    .then(tunnel_exchange(beast::get_lowest_layer(stream), st))
+                    .otherwise(deferred.values(ec));
+              }))(std::forward<Token>(token));
 }
 
 
 template<typename Stream, typename Ep, typename Token>
-void async_connect_impl(Stream & stream, Ep && ep, Token && token)
+void async_connect_impl(Stream & stream, Ep && ep, Token && token,
+                        ssl_session_cache * session_cache = nullptr, const std::string & host = {},
+                        timing * tm = nullptr, const socket_options * sopts = nullptr,
+                        const std::string * tunnel = nullptr,
+                        trace_hook * hook = nullptr,
+                        asio::any_io_executor hs_ex = {})
 {
   return async_connect_impl(stream, std::forward<Ep>(ep),
-                            std::forward<Token>(token), get_ssl_layer(stream));
+                            std::forward<Token>(token), get_ssl_layer(stream),
+                            session_cache, host, tm, sopts, tunnel, hook, std::move(hs_ex));
 }
 
 template<typename Stream, typename Token, typename Ssl>
@@ -139,6 +434,132 @@ auto async_close_impl(Stream & stream, Token && token)
   return async_close_impl(stream, std::forward<Token>(token), get_ssl_layer(stream));
 }
 
+template<typename Stream, typename Token>
+void async_handshake_impl(Stream * stream, Token && token)
+{
+  return stream->async_handshake(asio::ssl::stream_base::client, std::forward<Token>(token));
+}
+
+template<typename Token>
+void async_handshake_impl(std::nullptr_t, Token && token)
+{
+  return asio::post(asio::append(std::forward<Token>(token), system::error_code{}));
+}
+
+// RFC 8305: alternate the address families so a blackholed family only
+// costs one stagger delay, not the whole endpoint list.
+inline void interleave_address_families(std::vector<asio::ip::tcp::endpoint> & eps)
+{
+  std::vector<asio::ip::tcp::endpoint> v6, v4;
+  for (const auto & ep : eps)
+    (ep.address().is_v6() ? v6 : v4).push_back(ep);
+
+  eps.clear();
+  for (std::size_t i = 0u; i < v6.size() || i < v4.size(); i++)
+  {
+    if (i < v6.size()) eps.push_back(v6[i]);
+    if (i < v4.size()) eps.push_back(v4[i]);
+  }
+}
+
+template<typename Endpoint> // other protocols have no families to interleave
+inline void interleave_address_families(std::vector<Endpoint> &) {}
+
+constexpr std::chrono::milliseconds happy_eyeballs_delay{250};
+
+// Dial every endpoint on its own socket, staggered by happy_eyeballs_delay;
+// the first one to connect is moved into `socket`, the others are cancelled.
+// Completes with void(error_code, endpoint).
+template<typename Protocol, typename Executor, typename Token>
+void async_race_connect(asio::basic_stream_socket<Protocol, Executor> & socket,
+                        std::vector<typename Protocol::endpoint> eps,
+                        Token && token,
+                        const socket_options * sopts = nullptr)
+{
+  using asio::deferred;
+  using socket_type = asio::basic_stream_socket<Protocol, Executor>;
+
+  if (eps.empty())
+  {
+    system::error_code ec;
+    BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
+    return asio::post(asio::append(std::forward<Token>(token), ec, typename Protocol::endpoint{}));
+  }
+
+  struct state_t
+  {
+    std::vector<socket_type> socks;
+    std::vector<asio::basic_waitable_timer<std::chrono::steady_clock,
+                                           asio::wait_traits<std::chrono::steady_clock>,
+                                           Executor>> timers;
+  };
+  auto alloc = asio::get_associated_allocator(token, asio::recycling_allocator<void>());
+  auto st = std::allocate_shared<state_t>(alloc);
+  st->socks.reserve(eps.size());
+  st->timers.reserve(eps.size());
+  for (std::size_t i = 0u; i < eps.size(); i++)
+  {
+    st->socks.emplace_back(socket.get_executor());
+    st->timers.emplace_back(socket.get_executor(),
+                            std::chrono::steady_clock::now() + happy_eyeballs_delay * i);
+  }
+
+  auto dial = [st, sopts](std::size_t i, typename Protocol::endpoint ep)
+  {
+    return st->timers[i].async_wait(
+        deferred([st, sopts, i, ep](system::error_code ec)
+        {
+          // a cancelled stagger timer means the race is already decided;
+          // each racing socket gets the option profile before its dial.
+          if (!ec)
+            detail::open_with_options(st->socks[i], ep, sopts, ec);
+          return deferred.when(!ec)
+              .then(st->socks[i].async_connect(ep, deferred))
+              .otherwise(deferred.values(ec));
+        }));
+  };
+
+  std::vector<decltype(dial(0u, eps.front()))> ops;
+  ops.reserve(eps.size());
+  for (std::size_t i = 0u; i < eps.size(); i++)
+    ops.push_back(dial(i, eps[i]));
+
+  asio::experimental::make_parallel_group(std::move(ops))
+      .async_wait(asio::experimental::wait_for_one_success(),
+          deferred([st, &socket, eps](std::vector<std::size_t> order,
+                                      std::vector<system::error_code> ecs)
+          {
+            system::error_code ec;
+            for (auto idx : order)
+              if (!ecs[idx])
+              {
+                socket = std::move(st->socks[idx]);
+                return deferred.values(ec, eps[idx]);
+              }
+            ec = ecs.front(); // every dial failed; report the first endpoint's error
+            return deferred.values(ec, typename Protocol::endpoint{});
+          }))
+      (std::forward<Token>(token));
+}
+
+// An inert, unconnected transport: upgrade() hands its live socket to the
+// websocket it releases, so every other exit path needs a stand-in of the
+// same type to complete with.
+template<typename Stream, typename Executor>
+Stream make_placeholder_stream(Executor exec, std::false_type /* has ssl */)
+{
+  return Stream(std::move(exec));
+}
+
+template<typename Stream, typename Executor>
+Stream make_placeholder_stream(Executor exec, std::true_type /* has ssl */)
+{
+  // the stream takes its own reference on the native handle; the local
+  // context may go out of scope.
+  asio::ssl::context ctx{asio::ssl::context_base::tls_client};
+  return Stream(std::move(exec), ctx);
+}
+
 }
 }
 
@@ -158,7 +579,48 @@ void basic_connection<Stream>::connect(endpoint_type ep, system::error_code & ec
   auto rlock = asem::lock(read_mtx_, ec);
   if (ec)
     return;
-  detail::connect_impl(next_layer_, endpoint_ = ep, ec);
+  detail::connect_impl(next_layer_, endpoint_ = ep, ec, tls_session_cache_, host_,
+                       nullptr, &socket_options_, &tunnel_target_, trace_hook_);
+  if (!ec && detail::has_ssl_v<Stream>)
+    detail::count_metric(metrics_, &detail::pool_metrics::handshakes);
+}
+
+template<typename Stream>
+void basic_connection<Stream>::connect(std::vector<endpoint_type> eps, system::error_code & ec)
+{
+  auto wlock = asem::lock(write_mtx_, ec);
+  if (ec)
+    return;
+
+  auto rlock = asem::lock(read_mtx_, ec);
+  if (ec)
+    return;
+
+  if (eps.empty())
+  {
+    BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
+    return;
+  }
+
+  // blocking connects can't race; walk the interleaved order instead.
+  detail::interleave_address_families(eps);
+  for (auto itr = eps.begin(); itr != eps.end(); itr++)
+  {
+    ec.clear();
+    detail::connect_impl(next_layer_, endpoint_ = *itr, ec, tls_session_cache_, host_,
+                         nullptr, &socket_options_, &tunnel_target_, trace_hook_);
+    if (!ec)
+    {
+      if (detail::has_ssl_v<Stream>)
+        detail::count_metric(metrics_, &detail::pool_metrics::handshakes);
+      return;
+    }
+    if (std::next(itr) != eps.end())
+    {
+      system::error_code ignore;
+      detail::close_impl(next_layer_, ignore);
+    }
+  }
 }
 
 
@@ -176,6 +638,53 @@ void basic_connection<Stream>::close(system::error_code & ec)
   detail::close_impl(next_layer_, ec);
 }
 
+template<typename Stream>
+auto basic_connection<Stream>::upgrade(urls::url_view path,
+                                       http::fields headers,
+                                       cookie_jar * jar,
+                                       system::error_code & ec) -> websocket_type
+{
+  auto wlock = asem::lock(write_mtx_, ec);
+  if (ec)
+    return websocket_type{detail::make_placeholder_stream<next_layer_type>(
+        get_executor(), detail::has_ssl<Stream>{})};
+
+  auto rlock = asem::lock(read_mtx_, ec);
+  if (!ec && !is_open())
+    BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_connected);
+  if (ec)
+    return websocket_type{detail::make_placeholder_stream<next_layer_type>(
+        get_executor(), detail::has_ssl<Stream>{})};
+
+  if (jar != nullptr)
+    jar->append_to(headers, host(), detail::has_ssl_v<Stream>, path.encoded_path());
+
+  // the transport moves out here - the connection is spent after an
+  // upgrade, and the pool's bookkeeping sees it as closed and exhausted.
+  websocket_type ws{std::move(next_layer_)};
+  keep_alive_set_.timeout = std::chrono::system_clock::time_point::min();
+  keep_alive_set_.max = 0u;
+
+  ws.set_option(beast::websocket::stream_base::decorator(
+      [&headers](beast::websocket::request_type & wreq)
+      {
+        for (auto & f : headers)
+          wreq.set(f.name_string(), f.value());
+      }));
+
+  core::string_view target = path.encoded_target();
+  if (target.empty())
+    target = "/";
+  beast::websocket::response_type res;
+  ws.handshake(res, host_, target, ec);
+  if (jar != nullptr && !ec)
+  {
+    system::error_code ec_;
+    jar->set_all(res.base(), host(), ec_);
+  }
+  return ws;
+}
+
 template<typename Stream>
 struct basic_connection<Stream>::async_connect_op : asio::coroutine
 {
@@ -204,7 +713,10 @@ struct basic_connection<Stream>::async_connect_op : asio::coroutine
     {
       await_lock(this_->write_mtx_, write_lock);
       await_lock(this_->read_mtx_,  read_lock);
-      yield detail::async_connect_impl(this_->next_layer_, this_->endpoint_ = ep, std::move(self));
+      yield detail::async_connect_impl(this_->next_layer_, this_->endpoint_ = ep, std::move(self),
+                                       this_->tls_session_cache_, this_->host_,
+                                       nullptr, &this_->socket_options_, &this_->tunnel_target_,
+                                       this_->trace_hook_, this_->handshake_ex_);
     }
   }
 };
@@ -219,6 +731,82 @@ basic_connection<Stream>::async_connect(endpoint_type ep, CompletionToken && com
       std::forward<CompletionToken>(completion_token), this, ep);
 }
 
+template<typename Stream>
+struct basic_connection<Stream>::async_connect_eps_op : asio::coroutine
+{
+  using executor_type = typename std::decay_t<Stream>::executor_type;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  basic_connection<Stream> * this_;
+  std::vector<endpoint_type> eps;
+
+  async_connect_eps_op(basic_connection<Stream> * this_, std::vector<endpoint_type> eps)
+      : this_(this_), eps(std::move(eps)) {}
+
+  using mutex_type = detail::basic_mutex<executor_type>;
+  using lock_type = asem::lock_guard<detail::basic_mutex<executor_type>>;
+
+  lock_type read_lock, write_lock;
+
+  using completion_signature_type = void(system::error_code);
+  using step_signature_type       = void(system::error_code, endpoint_type);
+
+  void resume(requests::detail::co_token_t<step_signature_type> self,
+              system::error_code & ec, endpoint_type ep = {})
+  {
+    reenter(this)
+    {
+      await_lock(this_->write_mtx_, write_lock);
+      await_lock(this_->read_mtx_,  read_lock);
+
+      detail::interleave_address_families(eps);
+      // the TCP dial is raced; TLS is only negotiated on the winner.
+      detail::offer_alpn(this_->next_layer_);
+      detail::apply_session(this_->tls_session_cache_,
+                            detail::get_ssl_layer(this_->next_layer_), this_->host_);
+      BOOST_REQUESTS_TRACE_ENTER(this_->trace_hook_, connect, this_->host_);
+      yield detail::async_race_connect(beast::get_lowest_layer(this_->next_layer_),
+                                       std::move(eps), std::move(self),
+                                       &this_->socket_options_);
+      BOOST_REQUESTS_TRACE_EXIT(this_->trace_hook_, connect, ec);
+      if (ec)
+        return;
+      this_->endpoint_ = ep;
+      if (!this_->tunnel_target_.empty())
+      {
+        yield detail::async_tunnel_impl(beast::get_lowest_layer(this_->next_layer_),
+                                        this_->tunnel_target_, std::move(self));
+        if (ec)
+          return;
+      }
+      if (detail::has_ssl_v<Stream>)
+        BOOST_REQUESTS_TRACE_ENTER(this_->trace_hook_, handshake, this_->host_);
+      // the crypto may run on a side executor, see set_handshake_executor;
+      // we resume on the io executor either way.
+      yield detail::async_handshake_on(detail::get_ssl_layer(this_->next_layer_),
+                                       this_->handshake_ex_, std::move(self));
+      if (detail::has_ssl_v<Stream>)
+        BOOST_REQUESTS_TRACE_EXIT(this_->trace_hook_, handshake, ec);
+      if (!ec)
+      {
+        if (detail::has_ssl_v<Stream>)
+          detail::count_metric(this_->metrics_, &detail::pool_metrics::handshakes);
+        detail::store_session(this_->tls_session_cache_,
+                              detail::get_ssl_layer(this_->next_layer_), this_->host_);
+      }
+    }
+  }
+};
+
+template<typename Stream>
+template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code))
+basic_connection<Stream>::async_connect(std::vector<endpoint_type> eps, CompletionToken && completion_token)
+{
+  return detail::co_run<async_connect_eps_op>(
+      std::forward<CompletionToken>(completion_token), this, std::move(eps));
+}
+
 template<typename Stream>
 struct basic_connection<Stream>::async_close_op
 {
@@ -306,124 +894,504 @@ static asio::deferred_function<drop_size_t> drop_size()
   return asio::deferred(drop_size_t{});
 }
 
-}
-
+// Beast's serializer hands the header to the transport as one tiny
+// const_buffer per field fragment. A plain socket turns that into a long
+// iovec, but TLS writes one record per buffer. For contiguous, non-chunked
+// bodies the request goes out as a gather write of two buffers instead:
+// the header serialized once into a single block, and the body bytes
+// passed through untouched.
+template<typename Body, typename = void>
+struct contiguous_body_buffer : std::false_type
+{
+};
 
-template<typename Stream>
-template<typename Body>
-void basic_connection<Stream>::write_impl(
-    http::request<Body> & req,
-    asem::lock_guard<detail::basic_mutex<executor_type>> & read_lock,
-    system::error_code & ec)
+template<>
+struct contiguous_body_buffer<beast::http::empty_body> : std::true_type
 {
-  using lock_type = asem::lock_guard<detail::basic_mutex<executor_type>>;
-  write_mtx_.lock(ec);
-  if (ec)
-    return;
+  static asio::const_buffer get(const beast::http::empty_body::value_type &)
+  {
+    return asio::const_buffer();
+  }
+};
 
-  lock_type lock{write_mtx_, std::adopt_lock};
-  boost::optional<lock_type> alock;
+template<typename T>
+struct contiguous_body_buffer<beast::http::span_body<T>> : std::true_type
+{
+  static asio::const_buffer get(const typename beast::http::span_body<T>::value_type & b)
+  {
+    return asio::const_buffer(b.data(), b.size() * sizeof(T));
+  }
+};
 
-  // disconnect first
-  if (!is_open() && keep_alive_set_.timeout < std::chrono::system_clock::now())
+template<typename Char, typename Traits, typename Alloc>
+struct contiguous_body_buffer<beast::http::basic_string_body<Char, Traits, Alloc>> : std::true_type
+{
+  static asio::const_buffer get(const typename beast::http::basic_string_body<Char, Traits, Alloc>::value_type & b)
   {
-    read_mtx_.lock(ec);
-    if (ec)
-      return;
-    alock.emplace(read_mtx_, std::adopt_lock);
-    // if the close goes wrong - so what, unless it's still open
-    detail::close_impl(next_layer_, ec);
-    ec.clear();
+    return asio::const_buffer(b.data(), b.size() * sizeof(Char));
   }
+};
 
-  if (!is_open())
+template<typename T, typename Alloc>
+struct contiguous_body_buffer<beast::http::vector_body<T, Alloc>> : std::true_type
+{
+  static asio::const_buffer get(const typename beast::http::vector_body<T, Alloc>::value_type & b)
   {
-  retry:
-    if (!alock)
-    {
-      read_mtx_.lock(ec);
-      if (ec)
-        return ;
-      alock.emplace(read_mtx_, std::adopt_lock);
-    }
-    detail::connect_impl(next_layer_, endpoint_, ec);
-    if (ec)
-      return ;
+    return asio::const_buffer(b.data(), b.size() * sizeof(T));
   }
+};
 
-  alock.reset();
-  beast::http::write(next_layer_, req, ec);
+using header_buffer_type = std::vector<char, container::pmr::polymorphic_allocator<char>>;
 
-  if (ec == asio::error::broken_pipe || ec == asio::error::connection_reset)
-    goto retry ;
-  else  if (ec)
-    return ;
+template<typename Body>
+void serialize_header(http::request<Body> & req,
+                      header_buffer_type & header,
+                      system::error_code & ec)
+{
+  header.clear();
+  beast::http::request_serializer<Body, http::fields> sr{req};
+  sr.split(true);
+  while (!sr.is_header_done() && !ec)
+  {
+    std::size_t n = 0u;
+    sr.next(ec, [&](system::error_code &, const auto & buffers)
+            {
+              const auto prev = header.size();
+              n = asio::buffer_size(buffers);
+              header.resize(prev + n);
+              asio::buffer_copy(asio::buffer(header.data() + prev, n), buffers);
+            });
+    sr.consume(n);
+  }
+}
 
-  // release after acquire!
-  read_mtx_.lock(ec);
+template<typename Stream, typename Body>
+std::size_t write_request_impl(Stream & stream,
+                               http::request<Body> & req,
+                               system::error_code & ec,
+                               std::false_type /* contiguous */)
+{
+  return beast::http::write(stream, req, ec);
+}
 
+template<typename Stream, typename Body>
+std::size_t write_request_impl(Stream & stream,
+                               http::request<Body> & req,
+                               system::error_code & ec,
+                               std::true_type /* contiguous */)
+{
+  if (req.chunked())
+    return beast::http::write(stream, req, ec);
+
+  header_buffer_type header{req.get_allocator()};
+  serialize_header(req, header, ec);
   if (ec)
-    return ;
+    return 0u;
 
-  read_lock = {read_mtx_, std::adopt_lock};
-  lock = {};
+  std::array<asio::const_buffer, 2u> buffers{{asio::buffer(header),
+                                              contiguous_body_buffer<Body>::get(req.body())}};
+  return asio::write(stream, buffers, ec);
 }
 
-template<typename Stream>
-template<typename Body>
-auto basic_connection<Stream>::ropen(http::request<Body> & req,
-                                     request_options opt,
-                                     cookie_jar * jar,
-                                     system::error_code & ec) -> stream
+template<typename Stream, typename Body>
+std::size_t write_request(Stream & stream,
+                          http::request<Body> & req,
+                          system::error_code & ec)
 {
-  constexpr auto is_secure = detail::has_ssl_v<Stream>;
+  return write_request_impl(stream, req, ec, contiguous_body_buffer<Body>{});
+}
+
+template<typename Stream, typename Body, typename CompletionToken>
+auto async_write_request_impl(Stream & stream,
+                              http::request<Body> & req,
+                              header_buffer_type & header,
+                              CompletionToken && token,
+                              std::false_type /* contiguous */)
+{
+  return beast::http::async_write(stream, req, std::forward<CompletionToken>(token));
+}
+
+template<typename Stream, typename Body, typename CompletionToken>
+auto async_write_request_impl(Stream & stream,
+                              http::request<Body> & req,
+                              header_buffer_type & header,
+                              CompletionToken && token,
+                              std::true_type /* contiguous */)
+{
+  system::error_code ec;
+  if (!req.chunked())
+    serialize_header(req, header, ec);
+  if (req.chunked() || ec) // beast reports the serializer error asynchronously
+    return beast::http::async_write(stream, req, std::forward<CompletionToken>(token));
+
+  std::array<asio::const_buffer, 2u> buffers{{asio::buffer(header),
+                                              contiguous_body_buffer<Body>::get(req.body())}};
+  return asio::async_write(stream, buffers, std::forward<CompletionToken>(token));
+}
+
+// `header` provides the storage for the serialized header and must live
+// until the write completes.
+template<typename Stream, typename Body, typename CompletionToken>
+auto async_write_request(Stream & stream,
+                         http::request<Body> & req,
+                         header_buffer_type & header,
+                         CompletionToken && token)
+{
+  return async_write_request_impl(stream, req, header,
+                                  std::forward<CompletionToken>(token),
+                                  contiguous_body_buffer<Body>{});
+}
+
+// What the staged bytes hold while waiting for the 100-continue: nothing
+// parseable yet, the interim response (consumed), or a final response the
+// server sent instead of inviting the body. The final response stays
+// staged - the regular header read picks it up.
+enum class interim_result
+{
+  need_more,
+  got_continue,
+  got_final
+};
+
+inline interim_result check_interim(beast::flat_buffer & buffer)
+{
+  // a fresh throw-away parser per call; put() cannot resume across the
+  // partial arrivals this peek gets fed. The flat header block only looks
+  // at the status code, where a fields-based parser would build a node
+  // per header field just to throw them all away.
+  header_block hb;
+  header_block_parser p{hb};
+  system::error_code ec;
+  const auto n = p.put(buffer.data(), ec);
+  if (p.is_header_done())
+  {
+    if (hb.result() == beast::http::status::continue_)
+    {
+      buffer.consume(n);
+      return interim_result::got_continue;
+    }
+    return interim_result::got_final;
+  }
+  if (ec == beast::http::error::need_more)
+    return interim_result::need_more;
+  // garbage - leave it staged, the regular header read reports the error.
+  return interim_result::got_final;
+}
+
+// Bounded synchronous wait for the interim response without committing
+// the thread to a blocking read; a timeout is not an error, the caller
+// just sends the body.
+template<typename Stream>
+bool wait_interim_readable(Stream & stream, std::chrono::milliseconds timeout)
+{
+#if defined(_WIN32)
+  WSAPOLLFD pfd{};
+  pfd.fd = beast::get_lowest_layer(stream).native_handle();
+  pfd.events = POLLRDNORM;
+  return WSAPoll(&pfd, 1u, static_cast<INT>(timeout.count())) > 0;
+#else
+  pollfd pfd{};
+  pfd.fd = beast::get_lowest_layer(stream).native_handle();
+  pfd.events = POLLIN;
+  return ::poll(&pfd, 1u, static_cast<int>(timeout.count())) > 0;
+#endif
+}
+
+// The asynchronous equivalent: race a read-readability wait against a
+// short timer. Completes with asio::error::timed_out when the timer wins.
+template<typename Stream, typename Token>
+void async_wait_readable_for(Stream & stream,
+                             std::chrono::milliseconds timeout,
+                             Token && token)
+{
+  auto & sock = beast::get_lowest_layer(stream);
+  struct state_t
+  {
+    asio::steady_timer timer;
+    bool done = false;
+    std::decay_t<Token> handler;
+  };
+  // one fused allocation through the token's allocator, so asio's handler
+  // recycling applies
+  auto alloc = asio::get_associated_allocator(token, asio::recycling_allocator<void>());
+  auto st = std::allocate_shared<state_t>(
+      alloc, state_t{asio::steady_timer{sock.get_executor(), timeout},
+                     false, std::forward<Token>(token)});
+  st->timer.async_wait(
+      [st, &sock](system::error_code ec)
+      {
+        if (st->done || ec == asio::error::operation_aborted)
+          return;
+        st->done = true;
+        system::error_code ign;
+        sock.cancel(ign);
+        st->handler(system::error_code(asio::error::timed_out));
+      });
+  sock.async_wait(asio::socket_base::wait_read,
+      [st](system::error_code ec)
+      {
+        if (st->done)
+          return;
+        st->done = true;
+        st->timer.cancel();
+        st->handler(ec);
+      });
+}
+
+}
+
+
+template<typename Stream>
+template<typename Body>
+void basic_connection<Stream>::write_impl(
+    http::request<Body> & req,
+    asem::lock_guard<detail::basic_mutex<executor_type>> & read_lock,
+    system::error_code & ec,
+    timing * tm,
+    bool pipeline,
+    detail::op_deadline<Stream> * deadline,
+    std::chrono::milliseconds connect_timeout,
+    bool expect_continue,
+    std::chrono::milliseconds continue_timeout)
+{
+  using lock_type = asem::lock_guard<detail::basic_mutex<executor_type>>;
+  // only requests that actually carry a body gain anything from waiting
+  const bool expect = expect_continue && !pipeline
+                   && (req.chunked() || (req.payload_size() && *req.payload_size() > 0u));
+  bool read_locked = false;
+  if (tm)
+    tm->write_queued = timing::clock_type::now();
+  write_mtx_.lock(ec);
+  if (ec)
+    return;
+  if (tm)
+    tm->write_lock_acquired = timing::clock_type::now();
+
+  lock_type lock{write_mtx_, std::adopt_lock};
+  boost::optional<lock_type> alock;
+
+  // disconnect first
+  if (!is_open() && keep_alive_set_.timeout < std::chrono::system_clock::now())
+  {
+    read_mtx_.lock(ec);
+    if (ec)
+      return;
+    alock.emplace(read_mtx_, std::adopt_lock);
+    // if the close goes wrong - so what, unless it's still open
+    detail::close_impl(next_layer_, ec);
+    ec.clear();
+    detail::count_metric(metrics_, &detail::pool_metrics::keep_alive_closes);
+  }
+
+  if (!is_open())
+  {
+  retry:
+    if (!alock)
+    {
+      read_mtx_.lock(ec);
+      if (ec)
+        return ;
+      alock.emplace(read_mtx_, std::adopt_lock);
+    }
+    if (deadline != nullptr)
+      deadline->arm(connect_timeout, get_executor());
+    detail::connect_impl(next_layer_, endpoint_, ec, tls_session_cache_, host_, tm,
+                         &socket_options_, &tunnel_target_, trace_hook_);
+    if (deadline != nullptr)
+    {
+      deadline->disarm();
+      deadline->translate(ec);
+    }
+    if (ec)
+      return ;
+    if (detail::has_ssl_v<Stream>)
+      detail::count_metric(metrics_, &detail::pool_metrics::handshakes);
+    keep_alive_set_ = keep_alive{}; // a fresh socket starts with a fresh budget
+  }
+
+  alock.reset();
+  if (!expect)
+  {
+    {
+      const auto n = detail::write_request(next_layer_, req, ec);
+      if (metrics_ != nullptr)
+        detail::count_metric(metrics_->bytes_written, n);
+    }
+
+    if (ec == asio::error::broken_pipe || ec == asio::error::connection_reset)
+      goto retry ;
+    else  if (ec)
+      return ;
+  }
+  else
+  {
+    // Expect: 100-continue - the header goes out alone and the body only
+    // follows once the server invites it (or the wait times out).
+    if (req.count(http::field::expect) == 0u)
+      req.set(http::field::expect, "100-continue");
+    beast::http::request_serializer<Body, http::fields> sr{req};
+    sr.split(true);
+    {
+      const auto n = beast::http::write_header(next_layer_, sr, ec);
+      if (metrics_ != nullptr)
+        detail::count_metric(metrics_->bytes_written, n);
+    }
+    if (ec == asio::error::broken_pipe || ec == asio::error::connection_reset)
+      goto retry ;
+    else if (ec)
+      return ;
+
+    // the interim response arrives on the read side, so the read mutex is
+    // taken here already - while the write mutex stays held until the body
+    // went out (or was skipped).
+    if (tm)
+      tm->read_queued = timing::clock_type::now();
+    read_mtx_.lock(ec);
+    if (ec)
+      return ;
+    read_lock = {read_mtx_, std::adopt_lock};
+    read_locked = true;
+    if (tm)
+      tm->read_lock_acquired = timing::clock_type::now();
+
+    maybe_checkout_buffer_();
+    bool skip_body = false;
+    if (detail::wait_interim_readable(next_layer_, continue_timeout))
+    {
+      auto res = detail::check_interim(buffer_);
+      while (res == detail::interim_result::need_more)
+      {
+        buffer_.commit(next_layer_.read_some(buffer_.prepare(BOOST_REQUESTS_CHUNK_SIZE), ec));
+        if (ec)
+          return ;
+        res = detail::check_interim(buffer_);
+      }
+      // got_final: the server rejected the request before seeing the body;
+      // it stays staged for the regular header read.
+      skip_body = (res == detail::interim_result::got_final);
+    }
+    // a timeout just sends the body - servers are allowed to ignore Expect.
+
+    if (!skip_body)
+    {
+      const auto n = beast::http::write(next_layer_, sr, ec);
+      if (metrics_ != nullptr)
+        detail::count_metric(metrics_->bytes_written, n);
+      if (ec)
+        return ;
+    }
+    else // the half-sent request poisons the framing for any follow-up
+      keep_alive_set_.max = 1u;
+  }
+
+  // pipelined requests leave the read mutex to the stream, which takes it
+  // when the response header is first needed.
+  if (pipeline)
+    return ;
+
+  // release after acquire!
+  if (!read_locked)
+  {
+    if (tm)
+      tm->read_queued = timing::clock_type::now();
+    read_mtx_.lock(ec);
+
+    if (ec)
+      return ;
+    if (tm)
+      tm->read_lock_acquired = timing::clock_type::now();
+
+    read_lock = {read_mtx_, std::adopt_lock};
+  }
+  lock = {};
+}
+
+template<typename Stream>
+template<typename Body>
+auto basic_connection<Stream>::ropen(http::request<Body> & req,
+                                     request_options opt,
+                                     cookie_jar * jar,
+                                     system::error_code & ec) -> stream
+{
+  constexpr auto is_secure = detail::has_ssl_v<Stream>;
   using body_type = Body;
   using lock_type = asem::lock_guard<detail::basic_mutex<executor_type>>;
-  detail::tracker t{this->ongoing_requests_};
+  detail::tracker t{this->ongoing_requests_, idle_listener_};
+  detail::count_metric(metrics_, &detail::pool_metrics::requests_started);
   lock_type read_lock;
+  detail::op_deadline<Stream> deadline{next_layer_};
+  if (opt.timings)
+    opt.timings->started = timing::clock_type::now();
   if (jar)
-  {
-    detail::monotonic_token mv;
-    auto cc = jar->get(host(), is_secure, req.target(), mv);
-    if (!cc.empty())
-      req.set(http::field::cookie, cc);
-  }
+    // serialized straight out of the request's header allocator, see
+    // cookie_jar::append_to
+    jar->append_to(req, host(), is_secure, req.target());
 
   req.set(http::field::host, host_);
   if (req.count(http::field::user_agent) > 0)
     req.set(http::field::user_agent, "Requests-" BOOST_BEAST_VERSION_STRING);
+  if (opt.decompress_body && req.count(http::field::accept_encoding) == 0u)
+    req.set(http::field::accept_encoding, "gzip, deflate");
   req.prepare_payload();
 
+  if (opt.pipeline)
+  {
+    // write only - the stream reads the header (in write order) on first use.
+    write_impl(req, read_lock, ec, opt.timings, true, &deadline, opt.connect_timeout);
+    if (ec)
+      return stream{get_executor(), this};
+
+    stream str{get_executor(), this};
+    str.parser_ = detail::make_pmr<http::response_parser<http::buffer_body>>(req.get_allocator().resource(),
+                                                                             http::response_header{http::fields(req.get_allocator())});
+    if (req.method() == http::verb::head)
+      str.parser_->skip(true);
+    str.t_ = std::move(t);
+    str.pipeline_mtx_ = &read_mtx_;
+    str.jar_ = jar;
+    str.decompress_ = opt.decompress_body;
+    str.timings_ = opt.timings;
+    str.spill_threshold_ = opt.spill_threshold;
+    // covers the deferred header read as well - the response is consumed
+    // through the stream from here on.
+    arm_body_deadline_(opt.body_timeout);
+    return str;
+  }
+
   response_base::history_type history;
 
   while (!ec)
   {
-    write_impl(req, read_lock, ec); // <- grabs the read-lock, too.
+    // <- grabs the read-lock, too.
+    write_impl(req, read_lock, ec, opt.timings, false, &deadline, opt.connect_timeout,
+               opt.expect_continue, opt.continue_timeout);
     if (ec)
       return stream{get_executor(), this};
 
     stream str{get_executor(), this};
-    str.parser_ = detail::make_pmr<http::response_parser<http::buffer_body>>(req.get_allocator().resource(),
-                                                                            http::response_header{http::fields(req.get_allocator())});
-    beast::http::read_header(next_layer_, buffer_, *str.parser_, ec);
+    // the loop skips a straggling interim response - the server answered
+    // 100 after the expect wait already gave up and sent the body.
+    do
+    {
+      str.parser_ = detail::make_pmr<http::response_parser<http::buffer_body>>(req.get_allocator().resource(),
+                                                                              http::response_header{http::fields(req.get_allocator())});
+      maybe_checkout_buffer_();
+      deadline.arm(opt.headers_timeout, get_executor());
+      beast::http::read_header(next_layer_, buffer_, *str.parser_, ec);
+      deadline.disarm();
+      deadline.translate(ec);
+    }
+    while (!ec && str.parser_->get().base().result() == http::status::continue_);
+    if (opt.timings)
+      opt.timings->headers_received = timing::clock_type::now();
     if (ec)
       break;
 
     if (jar)
     {
-      auto cookie_itr = str.headers().find(http::field::set_cookie);
-      if (cookie_itr != str.headers().end())
-      {
-          auto f = requests::parse_set_cookie_field(cookie_itr->value());
-          if (f)
-            jar->set(*f, host_);
-          else
-          {
-            ec = f.error();
-            return str;
-          }
-
-      }
+      jar->set_all(str.headers(), host_, ec);
+      if (ec)
+        return str;
     }
 
     auto rc = str.parser_->get().base().result();
@@ -438,11 +1406,24 @@ auto basic_connection<Stream>::ropen(http::request<Body> & req,
       str.t_ = std::move(t);
       str.lock_ = std::move(read_lock);
       str.history_ = std::move(history);
+      str.trim_history(opt.history, opt.max_history);
+      str.timings_ = opt.timings;
+      str.spill_threshold_ = opt.spill_threshold;
+    str.spill_threshold_ = opt.spill_threshold;
+      if (opt.decompress_body)
+        str.init_decompression_();
+      arm_body_deadline_(opt.body_timeout);
       return str;
     }
     response_base::buffer_type buf{req.get_allocator()};
     if (req.method() != http::verb::head)
-      str.read(buf, ec);
+    {
+      // only the full policy retains hop bodies - the rest just drain
+      if (opt.history == history_mode::full)
+        str.read(buf, ec);
+      else
+        str.dump(ec);
+    }
     if (ec)
       break;
 
@@ -465,10 +1446,11 @@ auto basic_connection<Stream>::ropen(http::request<Body> & req,
       ec = url.error();
       break;
     }
-    // we don't need to use should_redirect, bc we're on the same host.
-    if (url->has_authority() &&
-        host_ == url->encoded_host() &&
-        !same_endpoint_on_host(*url, endpoint()))
+    // the fast path: a target that stays on this very endpoint is
+    // replayed on the warm connection we already hold (the redirect body
+    // was drained into the history above); anything else goes back to
+    // the caller for re-routing.
+    if (!redirect_stays_here_(*url))
     {
       static constexpr auto sloc((BOOST_CURRENT_LOCATION));
       ec.assign(error::forbidden_redirect, &sloc);
@@ -484,13 +1466,7 @@ auto basic_connection<Stream>::ropen(http::request<Body> & req,
 
     req.base().target(url->encoded_resource());
     if (jar)
-    {
-      detail::monotonic_token mv;
-      auto cc = jar->get(host(), is_secure, url->encoded_path(), mv);
-
-      if (!cc.empty())
-        req.base().set(http::field::cookie, cc);
-    }
+      jar->append_to(req.base(), host(), is_secure, url->encoded_path());
 
     req.prepare_payload();
     read_lock = {};
@@ -517,6 +1493,137 @@ auto basic_connection<Stream>::ropen(http::request<http::string_body> & req, req
   return ropen<http::string_body>(req, std::move(opt), jar, ec);
 }
 
+template<typename Stream>
+auto basic_connection<Stream>::ropen(const prepared_request & pr,
+                                     core::string_view body,
+                                     request_options opt,
+                                     cookie_jar * jar,
+                                     system::error_code & ec) -> stream
+{
+  constexpr auto is_secure = detail::has_ssl_v<Stream>;
+  using lock_type = asem::lock_guard<detail::basic_mutex<executor_type>>;
+  detail::tracker t{this->ongoing_requests_, idle_listener_};
+  detail::count_metric(metrics_, &detail::pool_metrics::requests_started);
+  lock_type read_lock;
+  detail::op_deadline<Stream> deadline{next_layer_};
+  if (opt.timings)
+    opt.timings->started = timing::clock_type::now();
+
+  // the invariant block was serialized when pr was built; only the
+  // volatile fields get appended here.
+  detail::header_buffer_type header;
+  if (jar)
+  {
+    detail::resource_token mv{header.get_allocator().resource()};
+    auto cc = jar->get(host(), is_secure, pr.target(), mv);
+    pr.assemble(header, host_, cc, body.size(), opt.decompress_body);
+  }
+  else
+    pr.assemble(header, host_, "", body.size(), opt.decompress_body);
+
+  if (opt.timings)
+    opt.timings->write_queued = timing::clock_type::now();
+  write_mtx_.lock(ec);
+  if (ec)
+    return stream{get_executor(), this};
+  if (opt.timings)
+    opt.timings->write_lock_acquired = timing::clock_type::now();
+
+  lock_type lock{write_mtx_, std::adopt_lock};
+  boost::optional<lock_type> alock;
+
+  // disconnect first
+  if (!is_open() && keep_alive_set_.timeout < std::chrono::system_clock::now())
+  {
+    read_mtx_.lock(ec);
+    if (ec)
+      return stream{get_executor(), this};
+    alock.emplace(read_mtx_, std::adopt_lock);
+    // if the close goes wrong - so what, unless it's still open
+    detail::close_impl(next_layer_, ec);
+    ec.clear();
+    detail::count_metric(metrics_, &detail::pool_metrics::keep_alive_closes);
+  }
+
+  if (!is_open())
+  {
+  retry:
+    if (!alock)
+    {
+      read_mtx_.lock(ec);
+      if (ec)
+        return stream{get_executor(), this};
+      alock.emplace(read_mtx_, std::adopt_lock);
+    }
+    deadline.arm(opt.connect_timeout, get_executor());
+    detail::connect_impl(next_layer_, endpoint_, ec, tls_session_cache_, host_, opt.timings,
+                         &socket_options_, &tunnel_target_, trace_hook_);
+    deadline.disarm();
+    deadline.translate(ec);
+    if (ec)
+      return stream{get_executor(), this};
+    if (detail::has_ssl_v<Stream>)
+      detail::count_metric(metrics_, &detail::pool_metrics::handshakes);
+    keep_alive_set_ = keep_alive{}; // a fresh socket starts with a fresh budget
+  }
+
+  alock.reset();
+  {
+    std::array<asio::const_buffer, 2u> buffers{{asio::buffer(header),
+                                                asio::const_buffer(body.data(), body.size())}};
+    const auto n = asio::write(next_layer_, buffers, ec);
+    if (metrics_ != nullptr)
+      detail::count_metric(metrics_->bytes_written, n);
+  }
+
+  if (ec == asio::error::broken_pipe || ec == asio::error::connection_reset)
+    goto retry;
+  else if (ec)
+    return stream{get_executor(), this};
+
+  // release after acquire!
+  if (opt.timings)
+    opt.timings->read_queued = timing::clock_type::now();
+  read_mtx_.lock(ec);
+  if (ec)
+    return stream{get_executor(), this};
+  if (opt.timings)
+    opt.timings->read_lock_acquired = timing::clock_type::now();
+  read_lock = {read_mtx_, std::adopt_lock};
+  lock = {};
+
+  stream str{get_executor(), this};
+  str.parser_ = detail::make_pmr<http::response_parser<http::buffer_body>>(
+      container::pmr::get_default_resource(), http::response_header{});
+  if (pr.method() == http::verb::head)
+    str.parser_->skip(true);
+  maybe_checkout_buffer_();
+  deadline.arm(opt.headers_timeout, get_executor());
+  beast::http::read_header(next_layer_, buffer_, *str.parser_, ec);
+  deadline.disarm();
+  deadline.translate(ec);
+  if (opt.timings)
+    opt.timings->headers_received = timing::clock_type::now();
+  if (ec)
+    return str;
+
+  if (jar)
+  {
+    jar->set_all(str.headers(), host_, ec);
+    if (ec)
+      return str;
+  }
+
+  str.t_ = std::move(t);
+  str.lock_ = std::move(read_lock);
+  str.timings_ = opt.timings;
+  str.spill_threshold_ = opt.spill_threshold;
+  if (opt.decompress_body)
+    str.init_decompression_();
+  arm_body_deadline_(opt.body_timeout);
+  return str;
+}
+
 
 namespace detail
 {
@@ -587,6 +1694,11 @@ auto basic_connection<Stream>::ropen(
         req.fields.set(http::field::content_type, nm);
     }
   }
+  {
+    const auto enc = body_content_encoding<body_traits>(body);
+    if (!enc.empty() && req.fields.count(http::field::content_encoding) == 0u)
+      req.fields.set(http::field::content_encoding, enc);
+  }
   auto bd = body_traits::make_body(std::forward<RequestBody>(body), ec);
   if (ec)
     return stream{get_executor(), this};
@@ -613,7 +1725,8 @@ struct basic_connection<Stream>::async_ropen_op
   basic_connection<Stream> * this_;
   optional<stream> str;
 
-  detail::tracker t{this_->ongoing_requests_};
+  detail::tracker t{this_->ongoing_requests_, this_->idle_listener_};
+  detail::op_deadline<Stream> deadline{this_->next_layer_};
   using body_type = RequestBody;
 
   system::error_code ec_;
@@ -623,11 +1736,18 @@ struct basic_connection<Stream>::async_ropen_op
   optional<beast::http::request<body_type, http::fields>> hreq;
   beast::http::request<body_type, http::fields> &req;
   response_base::buffer_type buf{req.get_allocator()};
+  detail::header_buffer_type header_buf{req.get_allocator()};
 
   lock_type lock;
   boost::optional<lock_type> alock;
   asio::coroutine inner_coro;
 
+  // Expect: 100-continue state - the serializer keeps the header and body
+  // writes split, see request_options::expect_continue.
+  optional<beast::http::request_serializer<body_type, http::fields>> ser;
+  detail::interim_result interim{detail::interim_result::need_more};
+  bool skip_body{false};
+
   response_base::history_type history;
 
 
@@ -655,20 +1775,23 @@ struct basic_connection<Stream>::async_ropen_op
         req.fields.set(http::field::content_type, nm);
     }
 
-    if (req.jar)
     {
-      detail::monotonic_token mv;
-      auto cc = req.jar->get(host, is_secure, path,  mv);
-      if (!cc.empty())
-        req.fields.set(http::field::cookie, cc);
+      const auto enc = body_content_encoding<body_traits>(body);
+      if (!enc.empty() && req.fields.count(http::field::content_encoding) == 0u)
+        req.fields.set(http::field::content_encoding, enc);
     }
 
+    if (req.jar)
+      req.jar->append_to(req.fields, host, is_secure, path);
+
     http::request<body_type> hreq(method, path, 11,
                                   body_traits::make_body(std::forward<RequestBody_>(body), ec),
                                   std::move(req.fields));
 
     hreq.set(beast::http::field::host, host);
     hreq.set(beast::http::field::user_agent, "Requests-" BOOST_BEAST_VERSION_STRING);
+    if (req.opts.decompress_body && hreq.count(beast::http::field::accept_encoding) == 0u)
+      hreq.set(beast::http::field::accept_encoding, "gzip, deflate");
 
     hreq.prepare_payload();
     return hreq;
@@ -678,6 +1801,10 @@ struct basic_connection<Stream>::async_ropen_op
                  http::request<RequestBody> * req,
                  request_options opt, cookie_jar * jar) : this_(this_), opts(opt), jar(jar), req(*req)
   {
+    if (opts.decompress_body && req->count(http::field::accept_encoding) == 0u)
+      req->set(http::field::accept_encoding, "gzip, deflate");
+    if (opts.timings)
+      opts.timings->started = timing::clock_type::now();
   }
 
   template<typename RequestBody_>
@@ -691,6 +1818,8 @@ struct basic_connection<Stream>::async_ropen_op
         req(*hreq)
   {
     detail::check_endpoint(path, this_->endpoint(), this_->host(), detail::has_ssl_v<Stream>, ec_);
+    if (opts.timings)
+      opts.timings->started = timing::clock_type::now();
   }
 
   using completion_signature_type = void(system::error_code, stream);
@@ -701,6 +1830,8 @@ struct basic_connection<Stream>::async_ropen_op
   {
     reenter(this)
     {
+      detail::count_metric(this_->metrics_, &detail::pool_metrics::requests_started);
+      BOOST_REQUESTS_TRACE_ENTER(this_->trace_hook_, request, req.target());
       if (ec_)
       {
         yield asio::post(this_->get_executor(), std::move(self));
@@ -709,7 +1840,11 @@ struct basic_connection<Stream>::async_ropen_op
 
       while (!ec)
       {
+        if (opts.timings)
+          opts.timings->write_queued = timing::clock_type::now();
         await_lock(this_->write_mtx_, lock);
+        if (opts.timings)
+          opts.timings->write_lock_acquired = timing::clock_type::now();
 
         // disconnect first
         if (!this_->is_open() && this_->keep_alive_set_.timeout < std::chrono::system_clock::now())
@@ -718,6 +1853,7 @@ struct basic_connection<Stream>::async_ropen_op
           // if the close goes wrong - so what, unless it's still open
           yield detail::async_close_impl(this_->next_layer_, std::move(self));
           ec.clear();
+          detail::count_metric(this_->metrics_, &detail::pool_metrics::keep_alive_closes);
         }
 
 
@@ -726,44 +1862,174 @@ struct basic_connection<Stream>::async_ropen_op
         retry:
           if (!alock)
             await_lock(this_->read_mtx_, alock);
-          yield detail::async_connect_impl(this_->next_layer_, this_->endpoint_, std::move(self));
+          deadline.arm(opts.connect_timeout, this_->get_executor());
+          yield detail::async_connect_impl(this_->next_layer_, this_->endpoint_, std::move(self),
+                                           this_->tls_session_cache_, this_->host_, opts.timings,
+                                           &this_->socket_options_, &this_->tunnel_target_,
+                                           this_->trace_hook_, this_->handshake_ex_);
+          deadline.disarm();
+          deadline.translate(ec);
           if (ec)
             break;
+          if (detail::has_ssl_v<Stream>)
+            detail::count_metric(this_->metrics_, &detail::pool_metrics::handshakes);
+          this_->keep_alive_set_ = keep_alive{}; // a fresh socket starts with a fresh budget
         }
 
         alock.reset();
-        yield beast::http::async_write(this_->next_layer_, req, std::move(self));
-
-        if (ec == asio::error::broken_pipe || ec == asio::error::connection_reset)
-          goto retry ;
-        else if (ec)
-          break;
-
-        // release after acquire!
-        await_lock(this_->read_mtx_, lock);
-        // END OF write impl
-        using base = detail::stream_base;
-        str.emplace(this_->get_executor(), static_cast<base*>(this_)); // , req.get_allocator().resource()
-        str->parser_ = detail::make_pmr<http::response_parser<http::buffer_body>>(req.get_allocator().resource(),
-                                                                                  http::response_header{http::fields(req.get_allocator())});
-        yield beast::http::async_read_header(this_->next_layer_, this_->buffer_, *str->parser_, std::move(self));
-        if (ec)
-          break;
+        if (!opts.expect_continue || opts.pipeline
+            || !(req.chunked() || (req.payload_size() && *req.payload_size() > 0u)))
+        {
+          yield
+          {
+            if (this_->metrics_ != nullptr)
+              detail::async_write_request(this_->next_layer_, req, header_buf,
+                                          detail::count_bytes(this_->metrics_->bytes_written, std::move(self)));
+            else
+              detail::async_write_request(this_->next_layer_, req, header_buf, std::move(self));
+          }
 
+          if (ec == asio::error::broken_pipe || ec == asio::error::connection_reset)
+            goto retry ;
+          else if (ec)
+            break;
+        }
+        else
         {
-          if (jar)
+          // Expect: 100-continue - the header goes out alone and the body
+          // only follows once the server invites it (or the wait times out).
+          if (req.base().count(http::field::expect) == 0u)
+            req.base().set(http::field::expect, "100-continue");
+          ser.emplace(req);
+          ser->split(true);
+          yield
+          {
+            if (this_->metrics_ != nullptr)
+              beast::http::async_write_header(this_->next_layer_, *ser,
+                                              detail::count_bytes(this_->metrics_->bytes_written, std::move(self)));
+            else
+              beast::http::async_write_header(this_->next_layer_, *ser, std::move(self));
+          }
+          if (ec == asio::error::broken_pipe || ec == asio::error::connection_reset)
+            goto retry ;
+          else if (ec)
+            break;
+
+          // the interim response arrives on the read side, so the read
+          // mutex is taken here already - while the write mutex stays held
+          // until the body went out (or was skipped).
+          if (opts.timings)
+            opts.timings->read_queued = timing::clock_type::now();
+          await_lock(this_->read_mtx_, alock);
+          if (opts.timings)
+            opts.timings->read_lock_acquired = timing::clock_type::now();
+
+          this_->maybe_checkout_buffer_();
+          skip_body = false;
+          yield detail::async_wait_readable_for(this_->next_layer_, opts.continue_timeout, std::move(self));
+          if (ec == asio::error::timed_out)
+            ec.clear(); // servers are allowed to ignore Expect - send the body
+          else if (!ec)
           {
-            auto cookie_itr = str->headers().find(http::field::set_cookie);
-            if (cookie_itr != str->headers().end())
+            while ((interim = detail::check_interim(this_->buffer_)) == detail::interim_result::need_more)
             {
-              auto f = requests::parse_set_cookie_field(cookie_itr->value());
-              if (f)
-                jar->set(*f, this_->host());
-              else
-              {
-                ec = f.error();
-                return *std::move(str);
-              }
+              yield this_->next_layer_.async_read_some(this_->buffer_.prepare(BOOST_REQUESTS_CHUNK_SIZE), std::move(self));
+              if (ec)
+                break;
+              this_->buffer_.commit(res_);
+            }
+            // got_final: the server rejected the request before seeing the
+            // body; it stays staged for the regular header read.
+            skip_body = (interim == detail::interim_result::got_final);
+          }
+          if (ec)
+            break;
+
+          if (!skip_body)
+          {
+            yield
+            {
+              if (this_->metrics_ != nullptr)
+                beast::http::async_write(this_->next_layer_, *ser,
+                                         detail::count_bytes(this_->metrics_->bytes_written, std::move(self)));
+              else
+                beast::http::async_write(this_->next_layer_, *ser, std::move(self));
+            }
+            if (ec)
+              break;
+          }
+          else // the half-sent request poisons the framing for any follow-up
+            this_->keep_alive_set_.max = 1u;
+          ser.reset();
+        }
+
+        if (opts.pipeline)
+        {
+          // hand the stream back right after the write - it reads the
+          // header (in write order) on first use.
+          lock = {};
+          str.emplace(this_->get_executor(), static_cast<detail::stream_base*>(this_));
+          str->parser_ = detail::make_pmr<http::response_parser<http::buffer_body>>(req.get_allocator().resource(),
+                                                                                    http::response_header{http::fields(req.get_allocator())});
+          if (req.base().method() == http::verb::head)
+            str->parser_->skip(true);
+          str->t_ = std::move(t);
+          str->pipeline_mtx_ = &this_->read_mtx_;
+          str->jar_ = jar;
+          str->decompress_ = opts.decompress_body;
+          str->timings_ = opts.timings;
+          str->spill_threshold_ = opts.spill_threshold;
+          // covers the deferred header read as well - the response is
+          // consumed through the stream from here on.
+          this_->arm_body_deadline_(opts.body_timeout);
+          BOOST_REQUESTS_TRACE_EXIT(this_->trace_hook_, request, ec);
+          return *std::move(str);
+        }
+
+        // release after acquire!
+        if (alock) // the expect path took the read mutex for the interim peek
+        {
+          lock = std::move(*alock);
+          alock.reset();
+        }
+        else
+        {
+          if (opts.timings)
+            opts.timings->read_queued = timing::clock_type::now();
+          await_lock(this_->read_mtx_, lock);
+          if (opts.timings)
+            opts.timings->read_lock_acquired = timing::clock_type::now();
+        }
+        // END OF write impl
+        using base = detail::stream_base;
+        str.emplace(this_->get_executor(), static_cast<base*>(this_)); // , req.get_allocator().resource()
+        // the loop skips a straggling interim response - the server
+        // answered 100 after the expect wait already gave up and sent the
+        // body.
+        do
+        {
+          str->parser_ = detail::make_pmr<http::response_parser<http::buffer_body>>(req.get_allocator().resource(),
+                                                                                    http::response_header{http::fields(req.get_allocator())});
+          this_->maybe_checkout_buffer_();
+          deadline.arm(opts.headers_timeout, this_->get_executor());
+          yield beast::http::async_read_header(this_->next_layer_, this_->buffer_, *str->parser_, std::move(self));
+          deadline.disarm();
+          deadline.translate(ec);
+        }
+        while (!ec && str->parser_->get().base().result() == http::status::continue_);
+        if (opts.timings)
+          opts.timings->headers_received = timing::clock_type::now();
+        if (ec)
+          break;
+
+        {
+          if (jar)
+          {
+            jar->set_all(str->headers(), this_->host(), ec);
+            if (ec)
+            {
+              BOOST_REQUESTS_TRACE_EXIT(this_->trace_hook_, request, ec);
+              return *std::move(str);
             }
           }
 
@@ -776,13 +2042,61 @@ struct basic_connection<Stream>::async_ropen_op
             str->t_ = std::move(t);
             str->lock_ = std::move(lock);
             str->history_ = std::move(history);
+            str->trim_history(opts.history, opts.max_history);
+            str->timings_ = opts.timings;
+            str->spill_threshold_ = opts.spill_threshold;
+            if (opts.decompress_body)
+              str->init_decompression_();
+            this_->arm_body_deadline_(opts.body_timeout);
+            BOOST_REQUESTS_TRACE_EXIT(this_->trace_hook_, request, ec);
             return *std::move(str);
           }
         }
 
+        // peek at the Location before draining: a target that leaves this
+        // endpoint goes straight back to the caller, with the hop's
+        // remainder draining detached behind us. The session then resolves
+        // and connects the new host in parallel with the drain, so a
+        // cross-host redirect costs the longer of the two, not their sum.
+        // The detached stream keeps the read lock, so a later request on
+        // this connection still queues behind the drain.
+        if (req.base().method() != http::verb::head
+            && opts.history != history_mode::full)
+        {
+          auto loc_itr = str->parser_->get().base().find(http::field::location);
+          if (loc_itr != str->parser_->get().base().end())
+          {
+            const auto nurl = interpret_location(req.target(), loc_itr->value());
+            if (!nurl.has_error() && !this_->redirect_stays_here_(*nurl))
+            {
+              // the parser still owns its message while the drain runs,
+              // so the hop's headers go into the history as a copy.
+              history.emplace_back(http::response_header{str->parser_->get().base()}, std::move(buf));
+              str->lock_ = std::move(lock);
+              {
+                auto sp = std::make_shared<stream>(*std::move(str));
+                sp->detached_drain_ = true;
+                auto & ref = *sp;
+                ref.async_dump([sp](system::error_code) {});
+              }
+              str.reset();
+              BOOST_REQUESTS_ASSIGN_EC(ec, error::forbidden_redirect);
+              break;
+            }
+          }
+        }
+
         if (req.base().method() != http::verb::head)
         {
-          yield str->async_read(buf, std::move(self));
+          // only the full policy retains hop bodies - the rest just drain
+          if (opts.history == history_mode::full)
+          {
+            yield str->async_read(buf, std::move(self));
+          }
+          else
+          {
+            yield str->async_dump(std::move(self));
+          }
         }
         if (ec)
           break;
@@ -806,10 +2120,10 @@ struct basic_connection<Stream>::async_ropen_op
           ec = url.error();
           break;
         }
-        // we don't need to use should_redirect, bc we're on the same host.
-        if (url->has_authority() &&
-            this_->host_ == url->encoded_host() &&
-            !same_endpoint_on_host(*url, this_->endpoint()))
+        // see the sync ropen: only a target that stays on this endpoint
+        // is replayed on the warm connection, after draining the
+        // redirect body into the history above.
+        if (!this_->redirect_stays_here_(*url))
         {
           BOOST_REQUESTS_ASSIGN_EC(ec, error::forbidden_redirect);
           break ;
@@ -823,16 +2137,12 @@ struct basic_connection<Stream>::async_ropen_op
 
         req.base().target(url->encoded_resource());
         if (jar)
-        {
-          detail::monotonic_token mv;
-          auto cc = jar->get(this_->host(), detail::has_ssl_v<Stream>, url->encoded_path(), mv);
-          if (!cc.empty())
-            req.base().set(http::field::cookie, cc);
-        }
+          jar->append_to(req.base(), this_->host(), detail::has_ssl_v<Stream>, url->encoded_path());
 
         req.prepare_payload();
       }
 
+      BOOST_REQUESTS_TRACE_EXIT(this_->trace_hook_, request, ec);
       stream str{this_->get_executor(), this_};
       str.history_ = std::move(history);
       //t = {};
@@ -953,37 +2263,662 @@ basic_connection<Stream>::async_ropen(http::request<http::string_body> & req,
   return detail::co_run<async_ropen_string_op>(std::forward<CompletionToken>(completion_token), this, &req, std::move(opt), jar);
 }
 
+template<typename Stream>
+struct basic_connection<Stream>::async_ropen_prepared_op
+    : boost::asio::coroutine
+{
+  using executor_type = typename std::decay_t<Stream>::executor_type;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  using lock_type = asem::lock_guard<detail::basic_mutex<typename Stream::executor_type>>;
+
+  basic_connection<Stream> * this_;
+  const prepared_request & pr;
+  core::string_view body;
+  request_options opts;
+  cookie_jar * jar;
+
+  optional<stream> str;
+  detail::tracker t{this_->ongoing_requests_, this_->idle_listener_};
+  detail::op_deadline<Stream> deadline{this_->next_layer_};
+  detail::header_buffer_type header;
 
+  lock_type lock;
+  boost::optional<lock_type> alock;
+
+  async_ropen_prepared_op(basic_connection<Stream> * this_,
+                          const prepared_request * preq,
+                          core::string_view body,
+                          request_options opt,
+                          cookie_jar * jar)
+      : this_(this_), pr(*preq), body(body), opts(opt), jar(jar)
+  {
+    if (opts.timings)
+      opts.timings->started = timing::clock_type::now();
+    if (jar)
+    {
+      detail::resource_token mv{header.get_allocator().resource()};
+      auto cc = jar->get(this_->host(), detail::has_ssl_v<Stream>, pr.target(), mv);
+      pr.assemble(header, this_->host_, cc, body.size(), opts.decompress_body);
+    }
+    else
+      pr.assemble(header, this_->host_, "", body.size(), opts.decompress_body);
+  }
 
+  using completion_signature_type = void(system::error_code, stream);
+  using step_signature_type       = void(system::error_code, std::size_t);
+
+  auto resume(requests::detail::co_token_t<step_signature_type> self, system::error_code & ec,
+              std::size_t res_ = 0u) -> stream
+  {
+    reenter(this)
+    {
+      detail::count_metric(this_->metrics_, &detail::pool_metrics::requests_started);
+      if (opts.timings)
+        opts.timings->write_queued = timing::clock_type::now();
+      await_lock(this_->write_mtx_, lock);
+      if (opts.timings)
+        opts.timings->write_lock_acquired = timing::clock_type::now();
+
+      // disconnect first
+      if (!this_->is_open() && this_->keep_alive_set_.timeout < std::chrono::system_clock::now())
+      {
+        await_lock(this_->read_mtx_, alock);
+        // if the close goes wrong - so what, unless it's still open
+        yield detail::async_close_impl(this_->next_layer_, std::move(self));
+        ec.clear();
+        detail::count_metric(this_->metrics_, &detail::pool_metrics::keep_alive_closes);
+      }
+
+      if (!this_->is_open())
+      {
+      retry:
+        if (!alock)
+          await_lock(this_->read_mtx_, alock);
+        deadline.arm(opts.connect_timeout, this_->get_executor());
+        yield detail::async_connect_impl(this_->next_layer_, this_->endpoint_, std::move(self),
+                                         this_->tls_session_cache_, this_->host_, opts.timings,
+                                           &this_->socket_options_, &this_->tunnel_target_,
+                                           this_->trace_hook_, this_->handshake_ex_);
+        deadline.disarm();
+        deadline.translate(ec);
+        if (ec)
+          return stream{this_->get_executor(), this_};
+        if (detail::has_ssl_v<Stream>)
+          detail::count_metric(this_->metrics_, &detail::pool_metrics::handshakes);
+        this_->keep_alive_set_ = keep_alive{}; // a fresh socket starts with a fresh budget
+      }
+
+      alock.reset();
+      yield
+      {
+        std::array<asio::const_buffer, 2u> buffers{{asio::buffer(header),
+                                                    asio::const_buffer(body.data(), body.size())}};
+        if (this_->metrics_ != nullptr)
+          asio::async_write(this_->next_layer_, buffers,
+                            detail::count_bytes(this_->metrics_->bytes_written, std::move(self)));
+        else
+          asio::async_write(this_->next_layer_, buffers, std::move(self));
+      }
+
+      if (ec == asio::error::broken_pipe || ec == asio::error::connection_reset)
+        goto retry;
+      else if (ec)
+        return stream{this_->get_executor(), this_};
+
+      // release after acquire!
+      if (opts.timings)
+        opts.timings->read_queued = timing::clock_type::now();
+      await_lock(this_->read_mtx_, lock);
+      if (opts.timings)
+        opts.timings->read_lock_acquired = timing::clock_type::now();
+
+      str.emplace(this_->get_executor(), static_cast<detail::stream_base*>(this_));
+      str->parser_ = detail::make_pmr<http::response_parser<http::buffer_body>>(
+          container::pmr::get_default_resource(), http::response_header{});
+      if (pr.method() == http::verb::head)
+        str->parser_->skip(true);
+      this_->maybe_checkout_buffer_();
+      deadline.arm(opts.headers_timeout, this_->get_executor());
+      yield beast::http::async_read_header(this_->next_layer_, this_->buffer_, *str->parser_, std::move(self));
+      deadline.disarm();
+      deadline.translate(ec);
+      if (opts.timings)
+        opts.timings->headers_received = timing::clock_type::now();
+      if (ec)
+        return *std::move(str);
+
+      if (jar)
+      {
+        jar->set_all(str->headers(), this_->host(), ec);
+        if (ec)
+          return *std::move(str);
+      }
+
+      str->t_ = std::move(t);
+      str->lock_ = std::move(lock);
+      str->timings_ = opts.timings;
+      str->spill_threshold_ = opts.spill_threshold;
+      if (opts.decompress_body)
+        str->init_decompression_();
+      this_->arm_body_deadline_(opts.body_timeout);
+      return *std::move(str);
+    }
+    return stream{this_->get_executor(), this_};
+  }
+};
+
+template<typename Stream>
+template<typename CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken,
+                                   void (boost::system::error_code, typename basic_connection<Stream>::stream))
+basic_connection<Stream>::async_ropen(const prepared_request & req,
+                                      core::string_view body,
+                                      request_options opt,
+                                      cookie_jar * jar,
+                                      CompletionToken && completion_token)
+{
+  return detail::co_run<async_ropen_prepared_op>(std::forward<CompletionToken>(completion_token),
+                                                 this, &req, body, std::move(opt), jar);
+}
+
+template<typename Stream>
+struct basic_connection<Stream>::async_upgrade_op : asio::coroutine
+{
+  using executor_type = typename basic_connection<Stream>::executor_type;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  using lock_type = asem::lock_guard<detail::basic_mutex<executor_type>>;
+
+  basic_connection<Stream> * this_;
+  std::string target;
+  http::fields headers;
+  cookie_jar * jar;
+
+  lock_type wlock, rlock;
+  boost::optional<websocket_type> ws;
+  beast::websocket::response_type response;
+
+  async_upgrade_op(basic_connection<Stream> * this_,
+                   urls::url_view path,
+                   http::fields headers,
+                   cookie_jar * jar)
+      : this_(this_), headers(std::move(headers)), jar(jar)
+  {
+    core::string_view t = path.encoded_target();
+    target.assign(t.begin(), t.end());
+    if (target.empty())
+      target = "/";
+    if (jar != nullptr)
+      jar->append_to(this->headers, this_->host(), detail::has_ssl_v<Stream>, path.encoded_path());
+  }
+
+  using completion_signature_type = void(system::error_code, websocket_type);
+  using step_signature_type       = void(system::error_code);
+
+  auto resume(requests::detail::co_token_t<step_signature_type> self,
+              system::error_code & ec) -> websocket_type
+  {
+    reenter(this)
+    {
+      while (!ec)
+      {
+        await_lock(this_->write_mtx_, wlock);
+        await_lock(this_->read_mtx_, rlock);
+        if (!this_->is_open())
+        {
+          BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_connected);
+          break;
+        }
+
+        // the transport moves out here - the connection is spent after an
+        // upgrade, and the pool's bookkeeping sees it as closed and exhausted.
+        ws.emplace(std::move(this_->next_layer_));
+        this_->keep_alive_set_.timeout = std::chrono::system_clock::time_point::min();
+        this_->keep_alive_set_.max = 0u;
+
+        ws->set_option(beast::websocket::stream_base::decorator(
+            [this](beast::websocket::request_type & wreq)
+            {
+              for (auto & f : headers)
+                wreq.set(f.name_string(), f.value());
+            }));
+
+        yield ws->async_handshake(response, this_->host(), target, std::move(self));
+        if (ec)
+          break;
+
+        if (jar != nullptr)
+        {
+          system::error_code ec_;
+          jar->set_all(response.base(), this_->host(), ec_);
+        }
+        rlock = {};
+        wlock = {};
+        return *std::move(ws);
+      }
+    }
+    return websocket_type{detail::make_placeholder_stream<next_layer_type>(
+        this_->get_executor(), detail::has_ssl<Stream>{})};
+  }
+};
+
+template<typename Stream>
+template<typename CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken,
+                                   void (boost::system::error_code, typename basic_connection<Stream>::websocket_type))
+basic_connection<Stream>::async_upgrade(urls::url_view path,
+                                        http::fields headers,
+                                        cookie_jar * jar,
+                                        CompletionToken && completion_token)
+{
+  return detail::co_run<async_upgrade_op>(std::forward<CompletionToken>(completion_token),
+                                          this, path, std::move(headers), jar);
+}
+
+// beast's read_some loop with the socket read clamped so the staging
+// buffer stays at (or marginally over) the watermark. Staged bytes are
+// always fed first, so a full buffer drains without touching the socket.
+template<typename Stream>
+std::size_t basic_connection<Stream>::read_some_limited_(beast::http::basic_parser<false> & parser, system::error_code & ec)
+{
+  std::size_t bytes_transferred = 0u;
+  for (;;)
+  {
+    if (buffer_.size() > 0u)
+    {
+      const auto used = parser.put(buffer_.data(), ec);
+      bytes_transferred += used;
+      buffer_.consume(used);
+      if (ec != beast::http::error::need_more)
+        break;
+      ec = {};
+    }
+    const auto n = next_layer_.read_some(
+        buffer_.prepare((std::min)(watermark_headroom_(),
+                                   beast::read_size_or_throw(buffer_, 65536u))), ec);
+    if (ec == asio::error::eof)
+    {
+      if (parser.got_some())
+      {
+        ec = {};
+        parser.put_eof(ec);
+      }
+      break;
+    }
+    else if (ec)
+      break;
+    buffer_.commit(n);
+  }
+  return bytes_transferred;
+}
 
 template<typename Stream>
 std::size_t basic_connection<Stream>::do_read_some_(beast::http::basic_parser<false> & parser)
 {
-  return beast::http::read_some(next_layer_, buffer_, parser);
+  std::size_t n = 0u;
+  if (read_watermark_ == 0u)
+    n = beast::http::read_some(next_layer_, buffer_, parser);
+  else
+  {
+    system::error_code ec;
+    n = read_some_limited_(parser, ec);
+    if (ec)
+      throw_exception(system::system_error(ec, "read_some"));
+  }
+  if (metrics_ != nullptr)
+    detail::count_metric(metrics_->bytes_read, n);
+  return n;
 }
 template<typename Stream>
-std::size_t basic_connection<Stream>::do_read_some_(beast::http::basic_parser<false> & parser, system::error_code & ec) 
+std::size_t basic_connection<Stream>::do_read_some_(beast::http::basic_parser<false> & parser, system::error_code & ec)
 {
-  return beast::http::read_some(next_layer_, buffer_, parser, ec);
+  const auto n = read_watermark_ == 0u
+               ? beast::http::read_some(next_layer_, buffer_, parser, ec)
+               : read_some_limited_(parser, ec);
+  translate_body_timeout_(ec);
+  if (metrics_ != nullptr)
+    detail::count_metric(metrics_->bytes_read, n);
+  return n;
 }
 
+// async twin of read_some_limited_.
+template<typename Stream>
+struct basic_connection<Stream>::async_read_some_limited_op : asio::coroutine
+{
+  using executor_type = typename basic_connection<Stream>::executor_type;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  basic_connection<Stream> * this_;
+  beast::http::basic_parser<false> & parser;
+  std::size_t bytes_transferred{0u};
+
+  async_read_some_limited_op(basic_connection<Stream> * this_,
+                             beast::http::basic_parser<false> * parser)
+      : this_(this_), parser(*parser) {}
+
+  using completion_signature_type = void(system::error_code, std::size_t);
+  using step_signature_type       = void(system::error_code, std::size_t);
+
+  std::size_t resume(requests::detail::co_token_t<step_signature_type> self,
+                     system::error_code & ec, std::size_t n = 0u)
+  {
+    reenter(this)
+    {
+      for (;;)
+      {
+        if (this_->buffer_.size() > 0u)
+        {
+          n = parser.put(this_->buffer_.data(), ec);
+          bytes_transferred += n;
+          this_->buffer_.consume(n);
+          if (ec != beast::http::error::need_more)
+            break;
+          ec = {};
+        }
+        yield this_->next_layer_.async_read_some(
+            this_->buffer_.prepare((std::min)(this_->watermark_headroom_(),
+                                              beast::read_size_or_throw(this_->buffer_, 65536u))),
+            std::move(self));
+        if (ec == asio::error::eof)
+        {
+          if (parser.got_some())
+          {
+            ec = {};
+            parser.put_eof(ec);
+          }
+          break;
+        }
+        else if (ec)
+          break;
+        this_->buffer_.commit(n);
+      }
+      if (this_->metrics_ != nullptr)
+        detail::count_metric(this_->metrics_->bytes_read, bytes_transferred);
+    }
+    return bytes_transferred;
+  }
+};
+
 template<typename Stream>
 void basic_connection<Stream>::do_async_read_some_(beast::http::basic_parser<false> & parser, detail::co_token_t<void(system::error_code, std::size_t)> tk)
 {
+  if (read_watermark_ != 0u)
+    return detail::co_run<async_read_some_limited_op>(std::move(tk), this, &parser);
+  if (metrics_ != nullptr)
+    return beast::http::async_read_some(next_layer_, buffer_, parser,
+                                        detail::count_bytes(metrics_->bytes_read, std::move(tk)));
   return beast::http::async_read_some(next_layer_, buffer_, parser, std::move(tk));
 }
 
+template<typename Stream>
+std::size_t basic_connection<Stream>::do_buffered_input_() const
+{
+  return buffer_.size();
+}
+
+template<typename Stream>
+std::size_t basic_connection<Stream>::do_read_body_direct_(detail::buffer_span buffers, system::error_code & ec)
+{
+  // direct mode can begin with body bytes still staged when peek_some
+  // entered it (see basic_stream::peek_some); hand those out before
+  // touching the socket.
+  if (buffer_.size() > 0u)
+  {
+    const auto n = asio::buffer_copy(buffers, buffer_.data());
+    buffer_.consume(n);
+    return n;
+  }
+  const auto n = next_layer_.read_some(buffers, ec); // scatter-fills, one readv
+  translate_body_timeout_(ec);
+  if (metrics_ != nullptr)
+    detail::count_metric(metrics_->bytes_read, n);
+  return n;
+}
+
+template<typename Stream>
+void basic_connection<Stream>::do_async_read_body_direct_(detail::buffer_span buffers, detail::co_token_t<void(system::error_code, std::size_t)> tk)
+{
+  if (buffer_.size() > 0u)
+  {
+    const auto n = asio::buffer_copy(buffers, buffer_.data());
+    buffer_.consume(n);
+    return asio::post(get_executor(), asio::append(std::move(tk), system::error_code{}, n));
+  }
+  if (metrics_ != nullptr)
+    return next_layer_.async_read_some(buffers, detail::count_bytes(metrics_->bytes_read, std::move(tk)));
+  return next_layer_.async_read_some(buffers, std::move(tk));
+}
+
+template<typename Stream>
+asio::const_buffer basic_connection<Stream>::do_staged_input_() const
+{
+  return buffer_.data();
+}
+
+template<typename Stream>
+void basic_connection<Stream>::do_consume_staged_(std::size_t n)
+{
+  buffer_.consume(n);
+}
+
+template<typename Stream>
+std::size_t basic_connection<Stream>::do_stage_input_(system::error_code & ec)
+{
+  maybe_checkout_buffer_();
+  const auto n = next_layer_.read_some(
+      buffer_.prepare(read_watermark_ != 0u
+          ? (std::min)(watermark_headroom_(), std::size_t(BOOST_REQUESTS_CHUNK_SIZE))
+          : std::size_t(BOOST_REQUESTS_CHUNK_SIZE)), ec);
+  translate_body_timeout_(ec);
+  buffer_.commit(n);
+  if (metrics_ != nullptr)
+    detail::count_metric(metrics_->bytes_read, n);
+  return n;
+}
+
+// one staging read for the in-place body consumers, see basic_stream::peek_some.
+template<typename Stream>
+struct basic_connection<Stream>::async_stage_input_op : asio::coroutine
+{
+  using executor_type = typename basic_connection<Stream>::executor_type;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  basic_connection<Stream> * this_;
+  async_stage_input_op(basic_connection<Stream> * this_) : this_(this_) {}
+
+  using completion_signature_type = void(system::error_code, std::size_t);
+  using step_signature_type       = void(system::error_code, std::size_t);
+
+  std::size_t resume(requests::detail::co_token_t<step_signature_type> self,
+                     system::error_code & ec, std::size_t n = 0u)
+  {
+    reenter(this)
+    {
+      this_->maybe_checkout_buffer_();
+      yield this_->next_layer_.async_read_some(
+          this_->buffer_.prepare(this_->read_watermark_ != 0u
+              ? (std::min)(this_->watermark_headroom_(), std::size_t(BOOST_REQUESTS_CHUNK_SIZE))
+              : std::size_t(BOOST_REQUESTS_CHUNK_SIZE)),
+          std::move(self));
+      if (!ec)
+        this_->buffer_.commit(n);
+      if (this_->metrics_ != nullptr)
+        detail::count_metric(this_->metrics_->bytes_read, n);
+      return n;
+    }
+    return 0u;
+  }
+};
+
+template<typename Stream>
+void basic_connection<Stream>::do_async_stage_input_(detail::co_token_t<void(system::error_code, std::size_t)> tk)
+{
+  return detail::co_run<async_stage_input_op>(std::move(tk), this);
+}
+
+template<typename Stream>
+void basic_connection<Stream>::do_read_header_(beast::http::basic_parser<false> & parser, system::error_code & ec)
+{
+  maybe_checkout_buffer_();
+  const auto n = beast::http::read_header(next_layer_, buffer_, parser, ec);
+  translate_body_timeout_(ec);
+  if (metrics_ != nullptr)
+    detail::count_metric(metrics_->bytes_read, n);
+}
+
+template<typename Stream>
+void basic_connection<Stream>::do_async_read_header_(beast::http::basic_parser<false> & parser, detail::co_token_t<void(system::error_code, std::size_t)> tk)
+{
+  maybe_checkout_buffer_();
+  if (metrics_ != nullptr)
+    return beast::http::async_read_header(next_layer_, buffer_, parser,
+                                          detail::count_bytes(metrics_->bytes_read, std::move(tk)));
+  return beast::http::async_read_header(next_layer_, buffer_, parser, std::move(tk));
+}
+
+template<typename Stream>
+void basic_connection<Stream>::do_release_buffer_()
+{
+  // the response is done (or abandoned); its body deadline and read
+  // watermark with it.
+  if (body_deadline_ != nullptr)
+    body_deadline_->disarm();
+  read_watermark_ = 0u;
+  // bytes already staged belong to the next pipelined response, so the
+  // buffer stays with the connection in that case.
+  if (buffer_pool_ == nullptr || buffer_.capacity() == 0u
+      || (buffer_.size() != 0u && is_open()))
+    return;
+  buffer_pool_->checkin(std::move(buffer_));
+  buffer_ = beast::flat_buffer{};
+}
+
 template<typename Stream>
 void basic_connection<Stream>::do_close_(system::error_code & ec)
 {
+  if (body_deadline_ != nullptr)
+    body_deadline_->disarm();
   return detail::close_impl(next_layer_, ec);
 }
 template<typename Stream>
 void basic_connection<Stream>::do_async_close_(detail::co_token_t<void(system::error_code)> tk)
 {
+  if (body_deadline_ != nullptr)
+    body_deadline_->disarm();
   return detail::async_close_impl(next_layer_, std::move(tk));
 }
 
+#if defined(__linux__)
+
+template<typename Stream>
+std::size_t basic_connection<Stream>::do_splice_body_impl_(std::false_type, int, std::size_t, bool, system::error_code & ec)
+{
+  BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::operation_not_supported);
+  return 0u;
+}
+
+template<typename Stream>
+std::size_t basic_connection<Stream>::do_splice_body_impl_(std::true_type, int fd, std::size_t n, bool block, system::error_code & ec)
+{
+  if (splice_pipe_.fds[0] == -1 && ::pipe2(splice_pipe_.fds, O_NONBLOCK | O_CLOEXEC) == -1)
+  {
+    ec.assign(errno, system::system_category());
+    return 0u;
+  }
+
+  // the socket goes non-blocking either way; `block` only selects whether we
+  // wait for readability here or hand would_block back to the async op.
+  if (!next_layer_.native_non_blocking())
+    next_layer_.native_non_blocking(true, ec);
+  if (ec)
+    return 0u;
+
+  ssize_t in = -1;
+  for (;;)
+  {
+    in = ::splice(next_layer_.native_handle(), nullptr, splice_pipe_.fds[1], nullptr,
+                  n, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    if (in == -1 && errno == EINTR)
+      continue;
+    if (in == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+      if (!block)
+      {
+        BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::would_block);
+        return 0u;
+      }
+      next_layer_.wait(asio::socket_base::wait_read, ec);
+      if (ec)
+        return 0u;
+      continue;
+    }
+    break;
+  }
+
+  if (in == -1)
+  {
+    ec.assign(errno, system::system_category());
+    return 0u;
+  }
+  if (in == 0)
+  {
+    BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
+    return 0u;
+  }
+
+  // drain the pipe into the target; regular files don't block here, so this
+  // inner loop only spins on short moves.
+  std::size_t moved = 0u;
+  while (moved < static_cast<std::size_t>(in))
+  {
+    const auto out = ::splice(splice_pipe_.fds[0], nullptr, fd, nullptr,
+                              static_cast<std::size_t>(in) - moved, SPLICE_F_MOVE);
+    if (out == -1)
+    {
+      if (errno == EINTR)
+        continue;
+      ec.assign(errno, system::system_category());
+      return moved;
+    }
+    moved += static_cast<std::size_t>(out);
+  }
+  return moved;
+}
+
+template<typename Stream>
+void basic_connection<Stream>::do_async_wait_readable_(detail::co_token_t<void(system::error_code)> tk)
+{
+  beast::get_lowest_layer(next_layer_).async_wait(asio::socket_base::wait_read, std::move(tk));
+}
+
+#endif
+
+#if !defined(BOOST_REQUESTS_HEADER_ONLY)
+// The op definitions live above, so the declarations have to sit here rather
+// than next to the class externs in connection.hpp. Definitions are compiled
+// in connection.ipp.
+extern template struct basic_connection<asio::ip::tcp::socket>::async_connect_op;
+extern template struct basic_connection<asio::ip::tcp::socket>::async_connect_eps_op;
+extern template struct basic_connection<asio::ip::tcp::socket>::async_ropen_file_op;
+extern template struct basic_connection<asio::ip::tcp::socket>::async_ropen_string_op;
+extern template struct basic_connection<asio::ip::tcp::socket>::async_ropen_empty_op;
+extern template struct basic_connection<asio::ip::tcp::socket>::async_ropen_prepared_op;
+extern template struct basic_connection<asio::ip::tcp::socket>::async_upgrade_op;
+extern template struct basic_connection<asio::ip::tcp::socket>::async_read_some_limited_op;
+extern template struct basic_connection<asio::ip::tcp::socket>::async_stage_input_op;
+
+extern template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_connect_op;
+extern template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_connect_eps_op;
+extern template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_ropen_file_op;
+extern template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_ropen_string_op;
+extern template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_ropen_empty_op;
+extern template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_ropen_prepared_op;
+extern template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_upgrade_op;
+extern template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_read_some_limited_op;
+extern template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_stage_input_op;
+#endif
+
 }
 }
 
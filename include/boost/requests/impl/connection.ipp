@@ -20,6 +20,29 @@ namespace requests
 template struct basic_connection<asio::ip::tcp::socket>;
 template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>;
 
+// The co_run ops behind the deduced-token paths. Instantiating the class
+// above only covers declarations; spelling the ops out here compiles their
+// resume() bodies - the bulk of the beast/asio chains - exactly once.
+template struct basic_connection<asio::ip::tcp::socket>::async_connect_op;
+template struct basic_connection<asio::ip::tcp::socket>::async_connect_eps_op;
+template struct basic_connection<asio::ip::tcp::socket>::async_ropen_file_op;
+template struct basic_connection<asio::ip::tcp::socket>::async_ropen_string_op;
+template struct basic_connection<asio::ip::tcp::socket>::async_ropen_empty_op;
+template struct basic_connection<asio::ip::tcp::socket>::async_ropen_prepared_op;
+template struct basic_connection<asio::ip::tcp::socket>::async_upgrade_op;
+template struct basic_connection<asio::ip::tcp::socket>::async_read_some_limited_op;
+template struct basic_connection<asio::ip::tcp::socket>::async_stage_input_op;
+
+template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_connect_op;
+template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_connect_eps_op;
+template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_ropen_file_op;
+template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_ropen_string_op;
+template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_ropen_empty_op;
+template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_ropen_prepared_op;
+template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_upgrade_op;
+template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_read_some_limited_op;
+template struct basic_connection<asio::ssl::stream<asio::ip::tcp::socket>>::async_stage_input_op;
+
 }
 }
 
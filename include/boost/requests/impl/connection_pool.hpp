@@ -9,7 +9,11 @@
 #define BOOST_REQUESTS_IMPL_CONNECTION_POOL_HPP
 
 #include <boost/requests/connection_pool.hpp>
+#include <boost/asio/detached.hpp>
 #include <boost/asio/experimental/parallel_group.hpp>
+#include <boost/optional.hpp>
+#include <atomic>
+#include <mutex>
 #include <boost/asio/yield.hpp>
 
 namespace boost {
@@ -21,13 +25,40 @@ void basic_connection_pool<Stream>::lookup(urls::authority_view sv, system::erro
   constexpr auto protocol = detail::has_ssl_v<Stream> ? "https" : "http";
 
   const auto service = sv.has_port() ? sv.port() : protocol;
+  // with a proxy the pool resolves and dials the proxy; the origin is only
+  // named in the CONNECT target and the host the connections carry. An
+  // alternative service (set_alt_svc) takes the origin's place the same way.
+  const core::string_view rhost = !proxy_host_.empty()
+      ? core::string_view(proxy_host_)
+      : !alt_host_.empty() ? core::string_view(alt_host_)
+                           : core::string_view(sv.encoded_host_name());
+  const core::string_view rservice = !proxy_host_.empty()
+      ? core::string_view(proxy_service_)
+      : !alt_host_.empty() ? core::string_view(alt_service_)
+                           : core::string_view(service);
   using lock_type = asem::lock_guard<detail::basic_mutex<executor_type>>;
 
   lock_type lock = asem::lock(mutex_, ec);
   if (ec)
     return;
+
+  if (dns_cache_ != nullptr)
+  {
+    resolver_cache::entry cached;
+    if (dns_cache_->get(rhost, rservice, cached))
+    {
+      host_ = std::move(cached.host_name);
+      endpoints_.assign(cached.endpoints.begin(), cached.endpoints.end());
+      if (dns_cache_->claim_refresh(rhost, rservice))
+        refresh_dns_(rhost, rservice);
+      apply_tunnel_(sv);
+      apply_alt_(sv);
+      return;
+    }
+  }
+
   resolver_type resolver{get_executor()};
-  auto eps = resolver.resolve(sv.encoded_host_name(), service, ec);
+  auto eps = resolver.resolve(rhost, rservice, ec);
 
   if (eps.empty())
     BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found)
@@ -43,6 +74,183 @@ void basic_connection_pool<Stream>::lookup(urls::authority_view sv, system::erro
               });
 
   endpoints_.assign(r.begin(), r.end());
+
+  if (dns_cache_ != nullptr && !ec)
+    dns_cache_->put(rhost, rservice,
+                    resolver_cache::entry{host_, {endpoints_.begin(), endpoints_.end()}});
+  if (!ec)
+  {
+    apply_tunnel_(sv);
+    apply_alt_(sv);
+  }
+}
+
+template<typename Stream>
+void basic_connection_pool<Stream>::apply_tunnel_(urls::authority_view sv)
+{
+  // The resolver answered for the proxy; the connections must keep carrying
+  // the origin so Host, SNI and certificate checks still name it. Requires
+  // mutex_.
+  if (proxy_host_.empty())
+    return;
+  const auto hn = sv.encoded_host_name();
+  host_.assign(hn.begin(), hn.end());
+  tunnel_target_ = host_;
+  tunnel_target_ += ':';
+  const core::string_view port = sv.has_port()
+      ? core::string_view(sv.port())
+      : core::string_view(detail::has_ssl_v<Stream> ? "443" : "80");
+  tunnel_target_.append(port.begin(), port.end());
+}
+
+template<typename Stream>
+void basic_connection_pool<Stream>::apply_alt_(urls::authority_view sv)
+{
+  // The resolver answered for the alternative service; the connections must
+  // keep carrying the origin so Host, SNI and certificate checks still name
+  // it - RFC 7838 only lets an alternative serve what it can authenticate
+  // as. Requires mutex_.
+  if (alt_host_.empty() || !proxy_host_.empty())
+    return;
+  const auto hn = sv.encoded_host_name();
+  host_.assign(hn.begin(), hn.end());
+}
+
+template<typename Stream>
+void basic_connection_pool<Stream>::refresh_dns_(std::string host, std::string service)
+{
+  // detached refresh; the resolver keeps itself alive through the handler.
+  auto resolver = std::make_shared<resolver_type>(get_executor());
+  auto cache = dns_cache_;
+  auto & res = *resolver;
+  res.async_resolve(
+      host, service,
+      [resolver = std::move(resolver), cache, host, service]
+      (system::error_code ec, typename resolver_type::results_type eps)
+      {
+        if (ec || eps.empty())
+          return;
+        resolver_cache::entry e;
+        e.host_name = eps->host_name();
+        for (const auto & r : eps)
+          e.endpoints.push_back(r.endpoint());
+        cache->put(host, service, std::move(e));
+      });
+}
+
+template<typename Stream>
+void basic_connection_pool<Stream>::arm_reaper_()
+{
+  if (reap_interval_ <= std::chrono::milliseconds::zero())
+    return;
+
+  // detached sweep; stays defensive since the handlers outlive cancel().
+  reap_timer_.expires_after(reap_interval_);
+  reap_timer_.async_wait(
+      [this](system::error_code ec)
+      {
+        if (ec)
+          return;
+        asem::async_lock(
+            mutex_,
+            [this](system::error_code ec,
+                   asem::lock_guard<detail::basic_mutex<executor_type>> lock)
+            {
+              if (ec)
+                return;
+              reap_(std::chrono::system_clock::now());
+              arm_reaper_();
+            });
+      });
+}
+
+template<typename Stream>
+void basic_connection_pool<Stream>::reap_(std::chrono::system_clock::time_point now)
+{
+  // a connection that would hit its keep-alive deadline before the next
+  // sweep gets closed now, while it is cheap, instead of failing a write
+  // mid-request later.
+  const auto horizon = now + reap_interval_;
+
+  std::size_t idle = 0u;
+  for (const auto & kv : conns_)
+    if (kv.second->is_open() && kv.second->working_requests() == 0u)
+      idle++;
+
+  for (auto itr = conns_.begin(); itr != conns_.end();)
+  {
+    auto & conn = itr->second;
+    if (!conn->is_open())
+    {
+      itr = conns_.erase(itr);
+      budget_release_();
+      continue;
+    }
+    if (conn->working_requests() > 0u)
+    {
+      itr++;
+      continue;
+    }
+    if (conn->timeout() < horizon || conn->near_keep_alive_limit())
+    {
+      system::error_code ign;
+      conn->close(ign);
+      detail::count_metric(metrics_.keep_alive_closes);
+      itr = conns_.erase(itr);
+      budget_release_();
+      idle--;
+      continue;
+    }
+    itr++;
+  }
+
+  // then trim the idle surplus coldest-first: with most-recently-used
+  // hand-out (see get_connection) the stalest stamps are exactly the
+  // connections the current load no longer touches.
+  while (idle > reap_floor_)
+  {
+    auto victim = conns_.end();
+    for (auto itr = conns_.begin(); itr != conns_.end(); ++itr)
+      if (itr->second->is_open() && itr->second->working_requests() == 0u
+          && (victim == conns_.end() || itr->second->use_stamp() < victim->second->use_stamp()))
+        victim = itr;
+    if (victim == conns_.end())
+      break;
+    system::error_code ign;
+    victim->second->close(ign);
+    detail::count_metric(metrics_.keep_alive_closes);
+    conns_.erase(victim);
+    budget_release_();
+    idle--;
+  }
+}
+
+template<typename Stream>
+std::size_t basic_connection_pool<Stream>::retire_exhausted_()
+{
+  // a connection one request short of the server's `Keep-Alive: max=`
+  // budget is closed once idle instead of being handed out again -
+  // spending the last request would race the server-side close and turn
+  // into a failed write plus retry for whoever draws the connection next.
+  std::size_t retired = 0u;
+  for (auto itr = conns_.begin(); itr != conns_.end();)
+  {
+    auto & conn = itr->second;
+    if (conn->is_open()
+        && conn->working_requests() == 0u
+        && conn->near_keep_alive_limit())
+    {
+      system::error_code ign;
+      conn->close(ign);
+      detail::count_metric(metrics_.keep_alive_closes);
+      itr = conns_.erase(itr);
+      budget_release_();
+      retired++;
+      continue;
+    }
+    itr++;
+  }
+  return retired;
 }
 
 template<typename Stream>
@@ -55,12 +263,24 @@ struct basic_connection_pool<Stream>::async_lookup_op : asio::coroutine
   const  urls::authority_view sv;
   constexpr static auto protocol = detail::has_ssl_v<Stream> ? "https" : "http";
   const core::string_view service = sv.has_port() ? sv.port() : protocol;
+  // see the sync lookup: with a proxy the proxy gets resolved, not the
+  // origin, and an alternative service takes the origin's place likewise.
+  const core::string_view rhost = !this_->proxy_host_.empty()
+      ? core::string_view(this_->proxy_host_)
+      : !this_->alt_host_.empty() ? core::string_view(this_->alt_host_)
+                                  : core::string_view(sv.encoded_host_name());
+  const core::string_view rservice = !this_->proxy_host_.empty()
+      ? core::string_view(this_->proxy_service_)
+      : !this_->alt_host_.empty() ? core::string_view(this_->alt_service_)
+                                  : service;
   resolver_type resolver;
 
   using mutex_type = detail::basic_mutex<executor_type>;
   using lock_type = asem::lock_guard<mutex_type>;
 
   lock_type lock;
+  resolver_cache::entry cached;
+  bool claimed = false;
 
   async_lookup_op(basic_connection_pool<Stream> * this_, urls::authority_view sv, executor_type exec)
       : this_(this_), sv(sv), resolver(exec) {}
@@ -68,6 +288,24 @@ struct basic_connection_pool<Stream>::async_lookup_op : asio::coroutine
   using completion_signature_type = void(system::error_code);
   using step_signature_type       = void(system::error_code, typename resolver_type::results_type);
 
+  // Coalesce with other pools resolving the same name through the shared
+  // cache: the winner of the claim resolves and publishes, the losers park
+  // until then. The op suspends either way and gets posted back.
+  void claim_or_park_(requests::detail::co_token_t<step_signature_type> self)
+  {
+    auto alloc = self.get_allocator();
+    auto tok = std::allocate_shared<requests::detail::co_token_t<step_signature_type>>(alloc, std::move(self));
+    auto exec = get_executor();
+    if (this_->dns_cache_->claim_inflight(rhost, rservice,
+            [tok, exec](system::error_code ec)
+            {
+              asio::post(exec, [tok, ec]() mutable { (*tok)(ec); });
+            }))
+    {
+      claimed = true;
+      asio::post(exec, [tok]() mutable { (*tok)(system::error_code{}); });
+    }
+  }
 
   void resume(requests::detail::co_token_t<step_signature_type> self,
               system::error_code & ec, typename resolver_type::results_type eps = {})
@@ -83,9 +321,47 @@ struct basic_connection_pool<Stream>::async_lookup_op : asio::coroutine
 
       lock = {this_->mutex_, std::adopt_lock};
 
-      yield resolver.async_resolve(sv.encoded_host_name(), service, std::move(self));
+      if (this_->dns_cache_ != nullptr && this_->dns_cache_->get(rhost, rservice, cached))
+      {
+        this_->host_ = std::move(cached.host_name);
+        this_->endpoints_.assign(cached.endpoints.begin(), cached.endpoints.end());
+        if (this_->dns_cache_->claim_refresh(rhost, rservice))
+          this_->refresh_dns_(rhost, rservice);
+        this_->apply_tunnel_(sv);
+        this_->apply_alt_(sv);
+        return;
+      }
+
+      if (this_->dns_cache_ != nullptr)
+      {
+        yield claim_or_park_(std::move(self));
+        if (!claimed)
+        {
+          // the claimant finished; its failure is shared, its entry is
+          // fresh in the cache.
+          if (ec)
+            return;
+          if (this_->dns_cache_->get(rhost, rservice, cached))
+          {
+            this_->host_ = std::move(cached.host_name);
+            this_->endpoints_.assign(cached.endpoints.begin(), cached.endpoints.end());
+            this_->apply_tunnel_(sv);
+            this_->apply_alt_(sv);
+            return;
+          }
+          // the entry raced out of the cache - resolve it ourselves after all
+        }
+      }
+
+      BOOST_REQUESTS_TRACE_ENTER(this_->trace_hook_, resolve, rhost);
+      yield resolver.async_resolve(rhost, rservice, std::move(self));
+      BOOST_REQUESTS_TRACE_EXIT(this_->trace_hook_, resolve, ec);
       if (ec)
+      {
+        if (claimed)
+          this_->dns_cache_->publish(rhost, rservice, ec, {});
         return;
+      }
       if (eps.empty())
         BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found)
       else
@@ -100,6 +376,20 @@ struct basic_connection_pool<Stream>::async_lookup_op : asio::coroutine
               });
 
       this_->endpoints_.assign(r.begin(), r.end());
+
+      if (claimed)
+        this_->dns_cache_->publish(rhost, rservice, ec,
+                                   resolver_cache::entry{this_->host_,
+                                                         {this_->endpoints_.begin(), this_->endpoints_.end()}});
+      else if (this_->dns_cache_ != nullptr && !ec)
+        this_->dns_cache_->put(rhost, rservice,
+                               resolver_cache::entry{this_->host_,
+                                                     {this_->endpoints_.begin(), this_->endpoints_.end()}});
+      if (!ec)
+      {
+        this_->apply_tunnel_(sv);
+        this_->apply_alt_(sv);
+      }
     }
   }
 };
@@ -116,51 +406,168 @@ basic_connection_pool<Stream>::async_lookup(urls::authority_view av,
       this, av, get_executor());
 }
 
+template<typename Stream>
+void basic_connection_pool<Stream>::rank_endpoints_()
+{
+  if (endpoints_.size() < 2u)
+    return;
+  ++dial_round_;
+  // spread over the endpoints that carry the fewest connections first,
+  // then by observed quality: slow and failure-prone records sink.
+  std::stable_sort(endpoints_.begin(), endpoints_.end(),
+                   [this](const endpoint_type & a, const endpoint_type & b)
+                   {
+                     const auto ca = conns_.count(a), cb = conns_.count(b);
+                     if (ca != cb)
+                       return ca < cb;
+                     return dial_score_(a) < dial_score_(b);
+                   });
+  // periodic exploration: every few dials the stalest entry gets a turn at
+  // the front, so a demoted endpoint that recovered is re-measured instead
+  // of rotting at the back of the list forever.
+  if (dial_round_ % 8u == 0u)
+  {
+    const auto stalest = std::min_element(
+        endpoints_.begin(), endpoints_.end(),
+        [this](const endpoint_type & a, const endpoint_type & b)
+        {
+          const auto ia = endpoint_scores_.find(a), ib = endpoint_scores_.find(b);
+          const auto sa = ia == endpoint_scores_.end() ? 0u : ia->second.last_dial;
+          const auto sb = ib == endpoint_scores_.end() ? 0u : ib->second.last_dial;
+          return sa < sb;
+        });
+    std::rotate(endpoints_.begin(), stalest, std::next(stalest));
+  }
+}
+
+template<typename Stream>
+void basic_connection_pool<Stream>::note_dial_(const std::shared_ptr<connection_type> & conn,
+                                               std::chrono::steady_clock::time_point started,
+                                               const system::error_code & ec,
+                                               bool sequential)
+{
+  const auto took = std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - started).count();
+  constexpr double alpha = 0.3; // EWMA weight of the newest sample
+  const auto learn = [&](const endpoint_type & ep, bool success)
+  {
+    auto & sc = endpoint_scores_[ep];
+    const double outcome = success ? 0. : 1.;
+    sc.failure = sc.last_dial == 0u ? outcome : sc.failure + alpha * (outcome - sc.failure);
+    if (success)
+      sc.connect_ms = sc.connect_ms == 0. ? took : sc.connect_ms + alpha * (took - sc.connect_ms);
+    sc.last_dial = dial_round_;
+  };
+  if (ec)
+  {
+    // the whole dial failed - everyone on the list was given a chance
+    for (const auto & ep : endpoints_)
+      learn(ep, false);
+    return;
+  }
+  // the winner carries the connect time. A sequential dial tried (and
+  // failed) the endpoints ordered before it; a raced dial convicts no one.
+  for (const auto & ep : endpoints_)
+  {
+    if (ep == conn->endpoint())
+    {
+      learn(ep, true);
+      break;
+    }
+    if (sequential)
+      learn(ep, false);
+  }
+}
+
 template<typename Stream>
 auto basic_connection_pool<Stream>::get_connection(error_code & ec) -> std::shared_ptr<connection_type>
 {
+  // lock-free fast path; worst case two requests share a connection briefly,
+  // which the locked path below can produce as well.
+  if (auto hint = try_idle_hint_())
+  {
+    stamp_used_(hint);
+    return hint;
+  }
 
+  detail::tracker twait{metrics_.requests_waiting};
   auto lock = asem::lock(mutex_, ec);
   if (ec)
     return nullptr;
 
-  // find an idle connection
-  auto itr = std::find_if(conns_.begin(), conns_.end(),
-                          [](const std::pair<const endpoint_type, std::shared_ptr<connection_type>> & conn)
-                          {
-                            return conn.second->working_requests() == 0u;
-                          });
+  // retire connections at their keep-alive budget and pre-open the
+  // replacements in the background - the prewarm takes the mutex itself,
+  // so it runs once this call releases it.
+  if (std::size_t retired = retire_exhausted_())
+    async_prewarm(conns_.size() + retired, asio::detached);
+
+  // find the most recently used idle connection - concentrating traffic on
+  // few hot sockets keeps their cwnd and TLS record state warm while the
+  // cold tail decays and gets swept, see reap_. The pick gets a staleness
+  // probe (a peer that closed while idle still passes is_open, see
+  // basic_connection::appears_stale); a stale one is retired here rather
+  // than costing a written request plus a retry, and the next-best is tried.
+  auto itr = conns_.end();
+  for (;;)
+  {
+    itr = conns_.end();
+    for (auto c = conns_.begin(); c != conns_.end(); ++c)
+      if (c->second->working_requests() == 0u
+          && (itr == conns_.end() || itr->second->use_stamp() < c->second->use_stamp()))
+        itr = c;
+
+    if (itr == conns_.end())
+      break;
+
+    if (itr->second->appears_stale())
+    {
+      system::error_code ec_;
+      itr->second->close(ec_);
+      conns_.erase(itr);
+      budget_release_();
+      continue;
+    }
 
-  if (itr != conns_.end())
+    stamp_used_(itr->second);
+    set_idle_hint_(itr->second);
     return itr->second;
+  }
 
   // check if we can make more connections. -> open another connection.
   // the race here is that we might open one too many
-  if (conns_.size() <= limit_) // open another connection then -> we block the entire
+  // the budget check comes last: a failed acquire (after its reclaim had
+  // a chance) degrades to sharing an existing connection below.
+  if (conns_.size() <= limit_ && budget_acquire_(conns_.empty())) // open another connection then -> we block the entire
   {
     if (endpoints_.empty())
     {
+      budget_release_();
       BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
       return nullptr;
     }
 
-    //sort the endpoints by connections that use it
-    std::sort(endpoints_.begin(), endpoints_.end(),
-              [this](const endpoint_type & a, const endpoint_type & b)
-              {
-                return conns_.count(a) < conns_.count(b);
-              });
-    const auto ep = endpoints_.front();
+    // least-loaded and best-scoring endpoints first, see rank_endpoints_
+    rank_endpoints_();
     std::shared_ptr<connection_type> nconn = this->template make_connection_<connection_type>(get_executor());
     nconn->set_host(host_);
-    nconn->connect(ep, ec);
-    if (ec)
-      return nullptr;
-
+    nconn->set_buffer_pool(&buffer_pool_);
+    nconn->set_metrics(&metrics_);
+    nconn->set_idle_listener(waiters_.get());
+    nconn->set_trace_hook(trace_hook_);
+    nconn->set_socket_options(socket_options_);
+    nconn->set_connect_tunnel(tunnel_target_);
+    const auto dial_started = std::chrono::steady_clock::now();
+    nconn->connect(endpoints_, ec); // tries the interleaved endpoints in order
+    note_dial_(nconn, dial_started, ec, /*sequential=*/true);
     if (ec)
+    {
+      budget_release_();
       return nullptr;
+    }
 
-    conns_.emplace(ep, nconn);
+    conns_.emplace(nconn->endpoint(), nconn);
+    stamp_used_(nconn);
+    set_idle_hint_(nconn);
     return nconn;
 
   }
@@ -179,7 +586,45 @@ auto basic_connection_pool<Stream>::get_connection(error_code & ec) -> std::shar
     return nullptr;
   }
   else
+  {
+    stamp_used_(itr->second);
     return itr->second;
+  }
+}
+
+template<typename Stream>
+auto basic_connection_pool<Stream>::upgrade(urls::url_view path,
+                                            http::fields headers,
+                                            cookie_jar * jar,
+                                            system::error_code & ec) -> websocket_type
+{
+  auto conn = get_connection(ec);
+  if (!ec && conn == nullptr)
+    BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
+  if (ec)
+    return websocket_type{detail::make_placeholder_stream<typename connection_type::next_layer_type>(
+        get_executor(), detail::has_ssl<Stream>{})};
+
+  auto ws = conn->upgrade(path, std::move(headers), jar, ec);
+
+  // the connection handed its transport to the websocket; drop it from the
+  // pool and dial a replacement in the background.
+  {
+    system::error_code lec;
+    auto lock = asem::lock(mutex_, lec);
+    if (!lec)
+    {
+      for (auto itr = conns_.begin(); itr != conns_.end(); itr++)
+        if (itr->second == conn)
+        {
+          conns_.erase(itr);
+          budget_release_();
+          break;
+        }
+      async_prewarm(conns_.size() + 1u, asio::detached);
+    }
+  }
+  return ws;
 }
 
 template<typename Stream>
@@ -189,7 +634,10 @@ struct basic_connection_pool<Stream>::async_get_connection_op : asio::coroutine
   executor_type get_executor() {return this_->get_executor(); }
 
   basic_connection_pool<Stream> * this_;
-  async_get_connection_op(basic_connection_pool<Stream> * this_) : this_(this_) {}
+  std::uint8_t priority;
+  async_get_connection_op(basic_connection_pool<Stream> * this_,
+                          std::uint8_t priority = 0u)
+      : this_(this_), priority(priority) {}
 
   using lock_type = asem::lock_guard<detail::basic_mutex<executor_type>>;
   using conn_t = boost::unordered_multimap<endpoint_type,
@@ -200,7 +648,9 @@ struct basic_connection_pool<Stream>::async_get_connection_op : asio::coroutine
 
   std::shared_ptr<connection_type> nconn = nullptr;
   lock_type lock;
-  endpoint_type ep;
+  std::size_t retired = 0u;
+  std::chrono::steady_clock::time_point dial_started_;
+  detail::tracker twait{this_->metrics_.requests_waiting};
 
   using completion_signature_type = void(system::error_code, std::shared_ptr<connection_type>);
   using step_signature_type       = void(system::error_code);
@@ -210,66 +660,140 @@ struct basic_connection_pool<Stream>::async_get_connection_op : asio::coroutine
   {
     reenter (this)
     {
-      if (!this_->mutex_.try_lock())
+      // lock-free fast path, see get_connection.
+      if ((nconn = this_->try_idle_hint_()) != nullptr)
       {
-        yield this_->mutex_.async_lock(std::move(self));
+        this_->stamp_used_(nconn);
+        return std::move(nconn);
       }
-      if (ec)
-        return nullptr;
 
-      lock = {this_->mutex_, std::adopt_lock};
+      for (;;)
+      {
+        if (!this_->mutex_.try_lock())
+        {
+          yield this_->mutex_.async_lock(std::move(self));
+        }
+        if (ec)
+          return nullptr;
 
-      // find an idle connection
-      itr = std::find_if(this_->conns_.begin(), this_->conns_.end(),
-                         [](const std::pair<const endpoint_type, std::shared_ptr<connection_type>> & conn)
-                         {
-                           return conn.second->working_requests() == 0u;
-                         });
+        lock = {this_->mutex_, std::adopt_lock};
 
-      if (itr != this_->conns_.end())
-        return itr->second;
+        // retire connections at their keep-alive budget; the replacements
+        // dial in the background once this op releases the mutex.
+        if ((retired = this_->retire_exhausted_()) > 0u)
+          this_->async_prewarm(this_->conns_.size() + retired, asio::detached);
 
-      // check if we can make more connections. -> open another connection.
-      // the race here is that we might open one too many
-      if (this_->conns_.size() < this_->limit_) // open another connection then -> we block the entire
-      {
-        if (this_->endpoints_.empty())
+        // most recently used idle connection first, see get_connection;
+        // the pick is probed for staleness and retired on the spot, like
+        // the synchronous path.
+        for (;;)
         {
-          BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
-          return nullptr;
+          itr = this_->conns_.end();
+          for (auto c = this_->conns_.begin(); c != this_->conns_.end(); ++c)
+            if (c->second->working_requests() == 0u
+                && (itr == this_->conns_.end() || itr->second->use_stamp() < c->second->use_stamp()))
+              itr = c;
+
+          if (itr == this_->conns_.end())
+            break;
+
+          if (itr->second->appears_stale())
+          {
+            system::error_code lec;
+            itr->second->close(lec);
+            this_->conns_.erase(itr);
+            this_->budget_release_();
+            continue;
+          }
+
+          this_->stamp_used_(itr->second);
+          this_->set_idle_hint_(itr->second);
+          return itr->second;
+        }
+
+        // check if we can make more connections. -> open another connection.
+        // the race here is that we might open one too many
+        // a failed budget acquire falls through to the discipline below,
+        // like a pool at its own limit_.
+        if (this_->conns_.size() < this_->limit_
+            && this_->budget_acquire_(this_->conns_.empty())) // open another connection then -> we block the entire
+        {
+          if (this_->endpoints_.empty())
+          {
+            this_->budget_release_();
+            BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
+            return nullptr;
+          }
+
+          // least-loaded and best-scoring endpoints first, see rank_endpoints_
+          this_->rank_endpoints_();
+          nconn = this_->template make_connection_<connection_type>(this_->get_executor());
+          nconn->set_host(this_->host_);
+          nconn->set_buffer_pool(&this_->buffer_pool_);
+          nconn->set_metrics(&this_->metrics_);
+          nconn->set_idle_listener(this_->waiters_.get());
+          nconn->set_trace_hook(this_->trace_hook_);
+          nconn->set_socket_options(this_->socket_options_);
+          nconn->set_connect_tunnel(this_->tunnel_target_);
+          // race the endpoints happy-eyeballs style; don't unlock here.
+          dial_started_ = std::chrono::steady_clock::now();
+          yield nconn->async_connect(this_->endpoints_, std::move(self));
+          // a raced dial only convicts the endpoints when the whole dial failed
+          this_->note_dial_(nconn, dial_started_, ec, /*sequential=*/false);
+          if (ec)
+          {
+            this_->budget_release_();
+            return nullptr;
+          }
+
+          this_->conns_.emplace(nconn->endpoint(), nconn);
+          this_->stamp_used_(nconn);
+          this_->set_idle_hint_(nconn);
+          return std::move(nconn);
         }
 
-        //sort the endpoints by connections that use it
-        std::sort(this_->endpoints_.begin(), this_->endpoints_.end(),
-                  [this](const endpoint_type & a, const endpoint_type & b)
-                  {
-                    return this_->conns_.count(a) < this_->conns_.count(b);
-                  });
-        ep = this_->endpoints_.front();
-        nconn = this_->template make_connection_<connection_type>(this_->get_executor());
-        nconn->set_host(this_->host_);
-        yield nconn->async_connect(ep, std::move(self)); // don't unlock here.
+        if (this_->waiters_->discipline == queue_discipline::share)
+        {
+          // find the one with the lowest usage
+          itr = std::min_element(this_->conns_.begin(), this_->conns_.end(),
+                                 [](const std::pair<const endpoint_type, std::shared_ptr<connection_type>> & lhs,
+                                    const std::pair<const endpoint_type, std::shared_ptr<connection_type>> & rhs)
+                                 {
+                                   return (lhs.second->working_requests() + (lhs.second->is_open() ? 0 : 1))
+                                        < (rhs.second->working_requests() + (rhs.second->is_open() ? 0 : 1));
+                                 });
+          if (itr == this_->conns_.end())
+          {
+            BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
+            return nullptr;
+          }
+          else
+          {
+            this_->stamp_used_(itr->second);
+            return itr->second;
+          }
+        }
+
+        // park until a connection goes idle, then re-check from the top.
+        BOOST_REQUESTS_TRACE_ENTER(this_->trace_hook_, pool_acquire, this_->host_);
+        yield
+        {
+          this_->waiters_->park(priority, std::move(self));
+          // a connection may have gone idle between the scan above and the
+          // park - it goes idle without the pool mutex - so re-check and
+          // hand the wakeup on; otherwise it could be lost.
+          for (auto & kv : this_->conns_)
+            if (kv.second->is_open() && kv.second->working_requests() == 0u)
+            {
+              this_->waiters_->on_idle();
+              break;
+            }
+          lock = {};
+        }
+        BOOST_REQUESTS_TRACE_EXIT(this_->trace_hook_, pool_acquire, ec);
         if (ec)
           return nullptr;
-
-        this_->conns_.emplace(ep, nconn);
-        return std::move(nconn);
-      }
-      // find the one with the lowest usage
-      itr = std::min_element(this_->conns_.begin(), this_->conns_.end(),
-                             [](const std::pair<const endpoint_type, std::shared_ptr<connection_type>> & lhs,
-                                const std::pair<const endpoint_type, std::shared_ptr<connection_type>> & rhs)
-                             {
-                               return (lhs.second->working_requests() + (lhs.second->is_open() ? 0 : 1))
-                                    < (rhs.second->working_requests() + (rhs.second->is_open() ? 0 : 1));
-                             });
-      if (itr == this_->conns_.end())
-      {
-        BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
-        return nullptr;
       }
-      else
-        return itr->second;
     }
     return nullptr;
   }
@@ -287,6 +811,216 @@ basic_connection_pool<Stream>::async_get_connection(CompletionToken && completio
       );
 }
 
+template<typename Stream>
+template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code, std::shared_ptr<basic_connection<Stream>>)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code, std::shared_ptr<basic_connection<Stream>>))
+basic_connection_pool<Stream>::async_get_connection(std::uint8_t priority,
+                                                    CompletionToken && completion_token)
+{
+  return detail::co_run<async_get_connection_op>(
+      std::forward<CompletionToken>(completion_token),
+      this, priority
+      );
+}
+
+template<typename Stream>
+struct basic_connection_pool<Stream>::async_prewarm_op : asio::coroutine
+{
+  using executor_type = typename Stream::executor_type;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  basic_connection_pool<Stream> * this_;
+  std::size_t n;
+
+  using lock_type = asem::lock_guard<detail::basic_mutex<executor_type>>;
+  lock_type lock;
+  std::vector<std::pair<endpoint_type, std::shared_ptr<connection_type>>> pending;
+
+  using connect_op = decltype(std::declval<connection_type&>()
+                                  .async_connect(std::declval<endpoint_type>(), asio::deferred));
+
+  template<typename Self>
+  void operator()(Self && self, system::error_code ec = {})
+  {
+    reenter(this)
+    {
+      if (!this_->mutex_.try_lock())
+      {
+        yield this_->mutex_.async_lock(std::move(self));
+      }
+      if (ec)
+        return self.complete(ec);
+
+      lock = {this_->mutex_, std::adopt_lock};
+
+      n = (std::min)(n, this_->limit_);
+      if (this_->endpoints_.empty() && this_->conns_.size() < n)
+      {
+        lock = {};
+        BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
+        return self.complete(ec);
+      }
+
+      while (this_->conns_.size() + pending.size() < n)
+      {
+        // a denied budget merely cuts the warm-up short
+        if (!this_->budget_acquire_(this_->conns_.empty() && pending.empty()))
+          break;
+        // spread the new connections over the resolved endpoints
+        auto ep = this_->endpoints_[(this_->conns_.size() + pending.size()) % this_->endpoints_.size()];
+        auto conn = this_->template make_connection_<connection_type>(this_->get_executor());
+        conn->set_host(this_->host_);
+        conn->set_buffer_pool(&this_->buffer_pool_);
+        conn->set_metrics(&this_->metrics_);
+        conn->set_idle_listener(this_->waiters_.get());
+        conn->set_trace_hook(this_->trace_hook_);
+        conn->set_socket_options(this_->socket_options_);
+        conn->set_connect_tunnel(this_->tunnel_target_);
+        pending.emplace_back(ep, std::move(conn));
+      }
+
+      if (pending.empty()) // already warm enough
+      {
+        lock = {};
+        return self.complete(system::error_code{});
+      }
+
+      yield
+      {
+        std::vector<connect_op> ops;
+        ops.reserve(pending.size());
+        for (auto & p : pending)
+          ops.push_back(p.second->async_connect(p.first, asio::deferred));
+        asio::experimental::make_parallel_group(std::move(ops))
+            .async_wait(asio::experimental::wait_for_all(), std::move(self));
+      }
+    }
+  }
+
+  template<typename Self>
+  void operator()(Self && self,
+                  std::vector<std::size_t> /* completion order */,
+                  std::vector<system::error_code> ecs)
+  {
+    system::error_code ec;
+    for (std::size_t i = 0u; i < pending.size(); i++)
+    {
+      if (!ecs[i])
+      {
+        this_->conns_.emplace(pending[i].first, pending[i].second);
+        this_->set_idle_hint_(pending[i].second);
+      }
+      else
+      {
+        this_->budget_release_();
+        if (!ec)
+          ec = ecs[i];
+      }
+    }
+    // any established connection leaves the pool warmer than before.
+    if (!this_->conns_.empty())
+      ec = {};
+    lock = {};
+    self.complete(ec);
+  }
+};
+
+template<typename Stream>
+template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code))
+basic_connection_pool<Stream>::async_prewarm(std::size_t n, CompletionToken && completion_token)
+{
+  return asio::async_compose<CompletionToken, void(system::error_code)>(
+      async_prewarm_op{{}, this, n},
+      completion_token,
+      mutex_
+  );
+}
+
+template<typename Stream>
+struct basic_connection_pool<Stream>::async_upgrade_op : asio::coroutine
+{
+  using executor_type = typename Stream::executor_type;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  using lock_type = asem::lock_guard<detail::basic_mutex<executor_type>>;
+
+  basic_connection_pool<Stream> * this_;
+  urls::url path; // keep the target alive across the acquisition step
+  http::fields headers;
+  cookie_jar * jar;
+
+  std::shared_ptr<connection_type> conn;
+  boost::optional<websocket_type> ws;
+  lock_type lock;
+
+  async_upgrade_op(basic_connection_pool<Stream> * this_,
+                   urls::url_view path,
+                   http::fields headers,
+                   cookie_jar * jar)
+      : this_(this_), path(path), headers(std::move(headers)), jar(jar) {}
+
+  using step_variant_ = variant2::variant<variant2::monostate,
+                                          std::shared_ptr<connection_type>,
+                                          websocket_type>;
+
+  using completion_signature_type = void(system::error_code, websocket_type);
+  using step_signature_type       = void(system::error_code, step_variant_);
+
+  auto resume(requests::detail::co_token_t<step_signature_type> self,
+              system::error_code & ec, step_variant_ s) -> websocket_type
+  {
+    reenter(this)
+    {
+      while (!ec)
+      {
+        yield this_->async_get_connection(std::move(self));
+        if (!ec && variant2::get<1>(s) == nullptr)
+          BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
+        if (ec)
+          break;
+        conn = std::move(variant2::get<1>(s));
+
+        yield conn->async_upgrade(path, std::move(headers), jar, std::move(self));
+        if (ec)
+          break;
+        ws.emplace(std::move(variant2::get<2>(s)));
+
+        // the connection handed its transport to the websocket; drop it from
+        // the pool and dial a replacement in the background.
+        await_lock(this_->mutex_, lock);
+        {
+          for (auto itr = this_->conns_.begin(); itr != this_->conns_.end(); itr++)
+            if (itr->second == conn)
+            {
+              this_->conns_.erase(itr);
+              this_->budget_release_();
+              break;
+            }
+        }
+        this_->async_prewarm(this_->conns_.size() + 1u, asio::detached);
+        lock = {};
+        return *std::move(ws);
+      }
+    }
+    return websocket_type{detail::make_placeholder_stream<typename connection_type::next_layer_type>(
+        this_->get_executor(), detail::has_ssl<Stream>{})};
+  }
+};
+
+template<typename Stream>
+template<typename CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken,
+                                   void (boost::system::error_code, typename basic_connection_pool<Stream>::websocket_type))
+basic_connection_pool<Stream>::async_upgrade(urls::url_view path,
+                                             http::fields headers,
+                                             cookie_jar * jar,
+                                             CompletionToken && completion_token)
+{
+  return detail::co_run<async_upgrade_op>(std::forward<CompletionToken>(completion_token),
+                                          this, path, std::move(headers), jar);
+}
+
 template<typename Stream>
 template<typename RequestBody>
 struct basic_connection_pool<Stream>::async_ropen_op : asio::coroutine
@@ -305,11 +1039,25 @@ struct basic_connection_pool<Stream>::async_ropen_op : asio::coroutine
   {
     reenter(this)
     {
-      yield this_->async_get_connection(std::move(self));
+      if (!this_->breaker_admit_())
+      {
+        // fail fast, but never complete inline with the initiation
+        yield asio::post(this_->get_executor(), std::move(self));
+        BOOST_REQUESTS_ASSIGN_EC(ec, error::circuit_open);
+        return self.complete(ec, typename connection_type::stream{this_->get_executor(), nullptr});
+      }
+      if (req.opts.timings)
+        req.opts.timings->pool_queued = timing::clock_type::now();
+      yield this_->async_get_connection(req.opts.priority, std::move(self));
+      if (req.opts.timings)
+        req.opts.timings->connection_acquired = timing::clock_type::now();
       if (!ec && conn == nullptr)
         ec =  asio::error::not_found;
       if (ec)
+      {
+        this_->breaker_report_(false);
         return self.complete(ec, typename connection_type::stream{this_->get_executor(), nullptr});
+      }
 
       yield conn->async_ropen(method, path, std::forward<RequestBody>(body), std::move(req), std::move(self));
     }
@@ -318,6 +1066,7 @@ struct basic_connection_pool<Stream>::async_ropen_op : asio::coroutine
   template<typename Self>
   void operator()(Self && self, error_code ec, typename connection_type::stream res)
   {
+    this_->breaker_report_(!ec);
     self.complete(ec, std::move(res));
   }
 };
@@ -348,30 +1097,77 @@ struct basic_connection_pool<Stream>::async_ropen_op_1 : asio::coroutine
   using executor_type = typename Stream::executor_type;
   executor_type get_executor() {return this_->get_executor(); }
 
+  using timer_type = asio::basic_waitable_timer<std::chrono::steady_clock,
+                                                asio::wait_traits<std::chrono::steady_clock>,
+                                                executor_type>;
+
   basic_connection_pool<Stream> * this_;
   http::request<RequestBody> & req;
   request_options opt;
   cookie_jar * jar;
 
+  // value-initialized; the op is aggregate-initialized with these omitted.
+  std::size_t attempt_;
+  optional<typename connection_type::stream> res_;
+  std::shared_ptr<timer_type> backoff_timer_;
+
   template<typename Self>
   void operator()(Self && self, error_code ec = {}, std::shared_ptr<connection_type> conn = nullptr)
   {
     reenter(this)
     {
-      yield this_->async_get_connection(std::move(self));
-      if (!ec && conn == nullptr)
-        ec =  asio::error::not_found;
-      if (ec)
+      if (!this_->breaker_admit_())
+      {
+        // fail fast, but never complete inline with the initiation
+        yield asio::post(this_->get_executor(), std::move(self));
+        BOOST_REQUESTS_ASSIGN_EC(ec, error::circuit_open);
         return self.complete(ec, typename connection_type::stream{this_->get_executor(), nullptr});
+      }
+      for (;;)
+      {
+        if (opt.timings)
+          opt.timings->pool_queued = timing::clock_type::now();
+        yield this_->async_get_connection(opt.priority, std::move(self));
+        if (opt.timings)
+          opt.timings->connection_acquired = timing::clock_type::now();
+        if (!ec && conn == nullptr)
+          ec =  asio::error::not_found;
+        if (ec)
+        {
+          this_->breaker_report_(false);
+          return self.complete(ec, typename connection_type::stream{this_->get_executor(), nullptr});
+        }
 
-      yield conn->async_ropen(req, std::move(opt), jar, std::move(self));
+        yield conn->async_ropen(req, opt, jar, std::move(self));
+        // resumed through the stream overload below, which stashed the result.
+        if (!detail::may_retry_request(ec, req.method(), opt, attempt_))
+        {
+          this_->breaker_report_(!ec);
+          return self.complete(ec, std::move(*res_));
+        }
+
+        // the keep-alive connection was stale; the request is already built,
+        // so a retry only costs acquiring the next pooled connection.
+        res_.reset();
+        if (opt.retry_backoff.count() > 0)
+        {
+          if (backoff_timer_ == nullptr)
+            backoff_timer_ = std::make_shared<timer_type>(this_->get_executor());
+          backoff_timer_->expires_after(detail::retry_delay(opt, attempt_));
+          yield backoff_timer_->async_wait(std::move(self));
+          if (ec)
+            return self.complete(ec, typename connection_type::stream{this_->get_executor(), nullptr});
+        }
+        attempt_++;
+      }
     }
   }
 
   template<typename Self>
   void operator()(Self && self, error_code ec, typename connection_type::stream res)
   {
-    self.complete(ec, std::move(res));
+    res_.emplace(std::move(res));
+    (*this)(std::move(self), ec);
   }
 };
 
@@ -394,7 +1190,174 @@ basic_connection_pool<Stream>::async_ropen(http::request<RequestBody> & req,
   );
 }
 
+namespace detail
+{
+
+// Shared state of one batch: the response slots, the shared settings and the
+// final handler, allocated once up front. Workers claim items by index; the
+// last worker to finish completes.
+template<typename Pool, typename Handler>
+struct batch_state_
+{
+  Pool & pool;
+  span<const batch_request> items;
+  request_settings req;
+  Handler handler;
+
+  std::vector<response> responses{items.size()};
+  std::atomic<std::size_t> next{0u};
+  std::atomic<std::size_t> outstanding{0u};
+
+  std::mutex mtx;
+  system::error_code ec; // the first per-item failure
+
+  batch_state_(Pool * pool, span<const batch_request> items,
+               request_settings req, Handler handler)
+      : pool(*pool), items(items), req(std::move(req)), handler(std::move(handler)) {}
+
+  void set_error(system::error_code e)
+  {
+    std::lock_guard<std::mutex> lock{mtx};
+    if (!ec)
+      ec = e;
+  }
+
+  void complete()
+  {
+    auto exec = asio::get_associated_executor(handler, pool.get_executor());
+    asio::post(std::move(exec),
+               asio::append(std::move(handler), ec, std::move(responses)));
+  }
+};
+
+template<typename State>
+struct batch_join_
+{
+  std::shared_ptr<State> state;
+
+  void operator()(system::error_code) // per-item errors are already recorded
+  {
+    if (state->outstanding.fetch_sub(1u) == 1u)
+      state->complete();
+  }
+};
+
+template<typename Pool, typename State>
+struct batch_worker_op : asio::coroutine
+{
+  using executor_type = typename Pool::executor_type;
+  executor_type get_executor() {return state->pool.get_executor(); }
+
+  using connection_type = typename Pool::connection_type;
+  using stream_type     = typename Pool::stream;
+
+  std::shared_ptr<State> state;
+
+  std::shared_ptr<connection_type> conn;
+  std::size_t idx{0u};
+  optional<stream_type> str_;
+
+  batch_worker_op(std::shared_ptr<State> state) : state(std::move(state)) {}
+
+  using completion_signature_type = void(system::error_code);
+  using step_signature_type       = void(system::error_code,
+                                         variant2::variant<variant2::monostate,
+                                                           std::shared_ptr<connection_type>,
+                                                           stream_type, std::size_t>);
+
+  void resume(requests::detail::co_token_t<step_signature_type> self,
+              system::error_code & ec,
+              variant2::variant<variant2::monostate,
+                                std::shared_ptr<connection_type>,
+                                stream_type, std::size_t> s)
+  {
+    reenter(this)
+    {
+      // one connection per worker, not one per item
+      yield state->pool.async_get_connection(std::move(self));
+      if (!ec && variant2::get<1>(s) == nullptr)
+        BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
+      if (ec)
+      {
+        state->set_error(ec);
+        ec.clear(); // recorded; the join only counts workers down
+        return;
+      }
+      conn = std::move(variant2::get<1>(s));
+
+      for (;;)
+      {
+        idx = state->next.fetch_add(1u);
+        if (idx >= state->items.size())
+          return;
+
+        yield conn->async_ropen(state->items[idx].method,
+                                state->items[idx].target,
+                                state->items[idx].body,
+                                request_settings{state->req}, std::move(self));
+        str_.emplace(std::move(variant2::get<2>(s)));
+        if (!ec)
+        {
+          yield str_->async_read(state->responses[idx].buffer, std::move(self));
+        }
+        state->responses[idx].headers = std::move(*str_).headers();
+        state->responses[idx].history = std::move(*str_).history();
+        str_.reset();
+        if (ec)
+        {
+          state->set_error(ec);
+          ec.clear();
+        }
+      }
+    }
+  }
+};
+
+struct batch_initiate_
+{
+  template<typename Handler, typename Pool>
+  void operator()(Handler handler, Pool * pool,
+                  span<const batch_request> items, request_settings req) const
+  {
+    using state_type = batch_state_<Pool, Handler>;
+    auto st = std::allocate_shared<state_type>(
+        asio::get_associated_allocator(handler),
+        pool, items, std::move(req), std::move(handler));
+
+    if (items.empty())
+      return st->complete();
+
+    const std::size_t n = (std::min)(items.size(), pool->limit());
+    st->outstanding.store(n);
+    for (std::size_t i = 0u; i < n; i++)
+      co_run<batch_worker_op<Pool, state_type>>(batch_join_<state_type>{st}, st);
+  }
+};
+
+}
+
+template<typename Stream>
+template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, std::vector<response>)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code, std::vector<response>))
+basic_connection_pool<Stream>::async_request_batch(span<const batch_request> items,
+                                                   request_settings req,
+                                                   CompletionToken && completion_token)
+{
+  return asio::async_initiate<CompletionToken, void(boost::system::error_code, std::vector<response>)>(
+      detail::batch_initiate_{}, completion_token,
+      this, items, std::move(req));
+}
+
+#if !defined(BOOST_REQUESTS_HEADER_ONLY)
+// Declared here, below the op definitions; compiled in connection_pool.ipp.
+extern template struct basic_connection_pool<asio::ip::tcp::socket>::async_lookup_op;
+extern template struct basic_connection_pool<asio::ip::tcp::socket>::async_get_connection_op;
+extern template struct basic_connection_pool<asio::ip::tcp::socket>::async_upgrade_op;
 
+extern template struct basic_connection_pool<asio::ssl::stream<asio::ip::tcp::socket>>::async_lookup_op;
+extern template struct basic_connection_pool<asio::ssl::stream<asio::ip::tcp::socket>>::async_get_connection_op;
+extern template struct basic_connection_pool<asio::ssl::stream<asio::ip::tcp::socket>>::async_upgrade_op;
+#endif
 
 }
 }
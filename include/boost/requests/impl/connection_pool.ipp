@@ -18,6 +18,16 @@ namespace requests {
 template struct basic_connection_pool<asio::ip::tcp::socket>;
 template struct basic_connection_pool<asio::ssl::stream<asio::ip::tcp::socket>>;
 
+// The co_run ops; the compose-style ops (prewarm, ropen, batch) are templated
+// on the handler and cannot be instantiated ahead of time.
+template struct basic_connection_pool<asio::ip::tcp::socket>::async_lookup_op;
+template struct basic_connection_pool<asio::ip::tcp::socket>::async_get_connection_op;
+template struct basic_connection_pool<asio::ip::tcp::socket>::async_upgrade_op;
+
+template struct basic_connection_pool<asio::ssl::stream<asio::ip::tcp::socket>>::async_lookup_op;
+template struct basic_connection_pool<asio::ssl::stream<asio::ip::tcp::socket>>::async_get_connection_op;
+template struct basic_connection_pool<asio::ssl::stream<asio::ip::tcp::socket>>::async_upgrade_op;
+
 }
 }
 
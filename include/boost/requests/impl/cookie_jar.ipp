@@ -11,6 +11,8 @@
 #if defined(BOOST_REQUESTS_SOURCE)
 
 #include <boost/requests/cookie_jar.hpp>
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+#include <boost/endian/conversion.hpp>
 
 namespace boost {
 namespace requests {
@@ -59,6 +61,8 @@ bool cookie_jar::set(const set_cookie & set,
   sc.name = set.name;
   sc.value = set.value;
   const auto now = std::chrono::system_clock::now();
+  // amortized cleanup, so the jar stays sized to live cookies
+  purge_some_(now, 2u);
 
   // 3.   If the cookie-attribute-list contains an attribute with an attribute-name of "Max-Age":
   if (set.max_age != std::chrono::seconds::max())
@@ -130,24 +134,262 @@ bool cookie_jar::set(const set_cookie & set,
       return false;
 
     sc.creation_time = itr->creation_time;
+    erase_index_(&*itr);
+    invalidate_heap_(&*itr);
     content.erase(itr);
   }
 
   if (sc.expiry_time > now)
-    return content.insert(std::move(sc)).second;
+  {
+    const auto res = content.insert(std::move(sc));
+    if (res.second)
+    {
+      index_.emplace(domain_hash_(core::string_view(res.first->domain.data(), res.first->domain.size())),
+                     &*res.first);
+      push_heap_(&*res.first);
+    }
+    return res.second;
+  }
   else
     return false;
 }
 
+std::size_t cookie_jar::set_all(const http::fields & fields,
+                                core::string_view request_host,
+                                system::error_code & ec,
+                                bool from_non_http_api,
+                                urls::pct_string_view request_uri_path,
+                                const public_suffix_list & public_suffixes)
+{
+  // one stack-backed arena for the whole response: it carries the
+  // normalized host and the staging vector, while the parsed cookies
+  // themselves are only views into the header storage.
+  char buf[1024];
+  container::pmr::monotonic_buffer_resource arena{buf, sizeof(buf)};
+  container::pmr::polymorphic_allocator<char> alloc{&arena};
+
+  char * h = alloc.allocate(request_host.size());
+  for (std::size_t i = 0u; i < request_host.size(); i++)
+    h[i] = urls::grammar::to_lower(request_host[i]);
+  const core::string_view host{h, request_host.size()};
+
+  // parse every field before touching the jar, so a malformed one
+  // rejects the batch without leaving it half ingested.
+  container::small_vector<set_cookie, 12u,
+                          container::pmr::polymorphic_allocator<set_cookie>> parsed{alloc};
+  const auto er = fields.equal_range(http::field::set_cookie);
+  for (auto itr = er.first; itr != er.second; itr++)
+  {
+    auto f = parse_set_cookie_field(itr->value());
+    if (f.has_error())
+    {
+      ec = f.error();
+      return 0u;
+    }
+    parsed.push_back(std::move(*f));
+  }
+
+  std::size_t stored = 0u;
+  for (const auto & sc : parsed)
+    if (set(sc, host, from_non_http_api, request_uri_path, public_suffixes))
+      stored++;
+  return stored;
+}
+
+namespace {
+
+// snapshot layout, all integers little-endian:
+//   "BRCJ" u32-version
+//   per cookie: i64 expiry, i64 creation (seconds since epoch), u8 flags,
+//               u32 name-len, u32 value-len, u32 domain-len, u32 path-len,
+//               followed by the four strings back to back.
+constexpr char     snapshot_magic[4] = {'B', 'R', 'C', 'J'};
+constexpr std::uint32_t snapshot_version = 1u;
+
+constexpr std::uint8_t flag_host_only   = 1u;
+constexpr std::uint8_t flag_secure_only = 2u;
+constexpr std::uint8_t flag_http_only   = 4u;
+
+template<typename Int>
+void snapshot_write(std::string & out, Int value)
+{
+  unsigned char buf[sizeof(Int)];
+  endian::endian_store<Int, sizeof(Int), endian::order::little>(buf, value);
+  out.append(reinterpret_cast<const char*>(buf), sizeof(buf));
+}
+
+template<typename Int>
+bool snapshot_read(core::string_view & data, Int & value)
+{
+  if (data.size() < sizeof(Int))
+    return false;
+  value = endian::endian_load<Int, sizeof(Int), endian::order::little>(
+      reinterpret_cast<const unsigned char*>(data.data()));
+  data.remove_prefix(sizeof(Int));
+  return true;
+}
+
+bool snapshot_read(core::string_view & data, std::uint32_t len, core::string_view & value)
+{
+  if (data.size() < len)
+    return false;
+  value = data.substr(0u, len);
+  data.remove_prefix(len);
+  return true;
+}
+
+// one record's raw fields, the strings still viewing into the snapshot
+struct snapshot_record
+{
+  std::int64_t expiry, creation;
+  std::uint8_t flags;
+  core::string_view name, value, domain, path;
+};
+
+bool snapshot_read(core::string_view & data, snapshot_record & rec)
+{
+  std::uint32_t name_len, value_len, domain_len, path_len;
+  return snapshot_read(data, rec.expiry)     && snapshot_read(data, rec.creation)
+      && snapshot_read(data, rec.flags)
+      && snapshot_read(data, name_len)       && snapshot_read(data, value_len)
+      && snapshot_read(data, domain_len)     && snapshot_read(data, path_len)
+      && snapshot_read(data, name_len, rec.name)     && snapshot_read(data, value_len, rec.value)
+      && snapshot_read(data, domain_len, rec.domain) && snapshot_read(data, path_len, rec.path);
+}
+
+}
+
+std::string cookie_jar::save() const
+{
+  std::string res;
+  res.append(snapshot_magic, sizeof(snapshot_magic));
+  snapshot_write(res, snapshot_version);
+
+  for (const auto & ck : content)
+  {
+    if (!ck.persistent_flag)
+      continue;
+
+    using std::chrono::duration_cast;
+    using std::chrono::seconds;
+    snapshot_write<std::int64_t>(res, duration_cast<seconds>(ck.expiry_time.time_since_epoch()).count());
+    snapshot_write<std::int64_t>(res, duration_cast<seconds>(ck.creation_time.time_since_epoch()).count());
+    snapshot_write<std::uint8_t>(res, (ck.host_only_flag   ? flag_host_only   : 0u) |
+                                      (ck.secure_only_flag ? flag_secure_only : 0u) |
+                                      (ck.http_only_flag   ? flag_http_only   : 0u));
+    snapshot_write<std::uint32_t>(res, static_cast<std::uint32_t>(ck.name.size()));
+    snapshot_write<std::uint32_t>(res, static_cast<std::uint32_t>(ck.value.size()));
+    snapshot_write<std::uint32_t>(res, static_cast<std::uint32_t>(ck.domain.size()));
+    snapshot_write<std::uint32_t>(res, static_cast<std::uint32_t>(ck.path.size()));
+    res.append(ck.name.data(),   ck.name.size());
+    res.append(ck.value.data(),  ck.value.size());
+    res.append(ck.domain.data(), ck.domain.size());
+    res.append(ck.path.data(),   ck.path.size());
+  }
+  return res;
+}
+
+bool cookie_jar::load(core::string_view data)
+{
+  if (data.size() < sizeof(snapshot_magic) ||
+      data.substr(0, sizeof(snapshot_magic)) != core::string_view(snapshot_magic, sizeof(snapshot_magic)))
+    return false;
+  data.remove_prefix(sizeof(snapshot_magic));
+
+  std::uint32_t version;
+  if (!snapshot_read(data, version) || version != snapshot_version)
+    return false;
+
+  // first pass: walk every record's bounds up front, so a snapshot
+  // truncated mid-record is rejected before anything is ingested -
+  // load leaves the jar untouched on bad input, per its contract.
+  {
+    snapshot_record rec;
+    for (auto rest = data; !rest.empty();)
+      if (!snapshot_read(rest, rec))
+        return false;
+  }
+
+  const auto now = std::chrono::system_clock::now();
+  while (!data.empty())
+  {
+    snapshot_record rec;
+    snapshot_read(data, rec); // bounds vetted by the first pass
+
+    cookie ck{content.get_allocator()};
+    ck.expiry_time = std::chrono::system_clock::time_point(std::chrono::seconds(rec.expiry));
+    if (ck.expiry_time <= now)
+      continue;
+
+    ck.name.assign(rec.name.begin(), rec.name.end());
+    ck.value.assign(rec.value.begin(), rec.value.end());
+    ck.domain.assign(rec.domain.begin(), rec.domain.end());
+    ck.path.assign(rec.path.begin(), rec.path.end());
+    ck.creation_time = std::chrono::system_clock::time_point(std::chrono::seconds(rec.creation));
+    ck.last_access_time = now;
+    ck.persistent_flag  = true;
+    ck.host_only_flag   = (rec.flags & flag_host_only)   != 0u;
+    ck.secure_only_flag = (rec.flags & flag_secure_only) != 0u;
+    ck.http_only_flag   = (rec.flags & flag_http_only)   != 0u;
+
+    const auto itr = content.find(ck);
+    if (itr != content.end())
+    {
+      erase_index_(&*itr);
+      invalidate_heap_(&*itr);
+      content.erase(itr);
+    }
+    const auto res = content.insert(std::move(ck));
+    if (res.second)
+    {
+      index_.emplace(domain_hash_(core::string_view(res.first->domain.data(), res.first->domain.size())),
+                     &*res.first);
+      push_heap_(&*res.first);
+    }
+  }
+  return true;
+}
+
 void cookie_jar::drop_expired(const std::chrono::system_clock::time_point nw)
 {
   for (auto itr = content.begin(); itr != content.end();)
   {
     if (itr->expiry_time < nw)
+    {
+      erase_index_(&*itr);
       itr = content.erase(itr);
+    }
     else
       itr ++;
   }
+  // cheaper than nulling entry by entry during the scan
+  heap_.clear();
+  for (const auto & ck : content)
+    push_heap_(&ck);
+}
+
+void cookie_jar::purge_expired(const std::chrono::system_clock::time_point nw)
+{
+  purge_some_(nw, heap_.size());
+}
+
+void cookie_jar::purge_some_(std::chrono::system_clock::time_point nw, std::size_t limit)
+{
+  while (!heap_.empty() && limit > 0u)
+  {
+    const heap_entry top = heap_.front();
+    if (top.ck != nullptr && top.expiry >= nw)
+      break; // the soonest expiry still lies in the future
+    std::pop_heap(heap_.begin(), heap_.end(), &cookie_jar::expires_later_);
+    heap_.pop_back();
+    if (top.ck == nullptr)
+      continue; // its cookie was erased early, the slot just gets dropped
+    limit--;
+    erase_index_(top.ck);
+    const auto itr = content.find(*top.ck);
+    if (itr != content.end() && &*itr == top.ck)
+      content.erase(itr);
+  }
 }
 
 }
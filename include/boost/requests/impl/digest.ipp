@@ -0,0 +1,169 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_IMPL_DIGEST_IPP
+#define BOOST_REQUESTS_IMPL_DIGEST_IPP
+
+#include <boost/requests/digest.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace boost {
+namespace requests {
+
+namespace {
+
+// FIPS 180-4, 4.2.2: the first 32 bits of the fractional parts of the
+// cube roots of the first 64 primes.
+constexpr std::uint32_t sha256_k[64] = {
+    0x428a2f98u, 0x71374491u, 0xb5c0fbcfu, 0xe9b5dba5u,
+    0x3956c25bu, 0x59f111f1u, 0x923f82a4u, 0xab1c5ed5u,
+    0xd807aa98u, 0x12835b01u, 0x243185beu, 0x550c7dc3u,
+    0x72be5d74u, 0x80deb1feu, 0x9bdc06a7u, 0xc19bf174u,
+    0xe49b69c1u, 0xefbe4786u, 0x0fc19dc6u, 0x240ca1ccu,
+    0x2de92c6fu, 0x4a7484aau, 0x5cb0a9dcu, 0x76f988dau,
+    0x983e5152u, 0xa831c66du, 0xb00327c8u, 0xbf597fc7u,
+    0xc6e00bf3u, 0xd5a79147u, 0x06ca6351u, 0x14292967u,
+    0x27b70a85u, 0x2e1b2138u, 0x4d2c6dfcu, 0x53380d13u,
+    0x650a7354u, 0x766a0abbu, 0x81c2c92eu, 0x92722c85u,
+    0xa2bfe8a1u, 0xa81a664bu, 0xc24b8b70u, 0xc76c51a3u,
+    0xd192e819u, 0xd6990624u, 0xf40e3585u, 0x106aa070u,
+    0x19a4c116u, 0x1e376c08u, 0x2748774cu, 0x34b0bcb5u,
+    0x391c0cb3u, 0x4ed8aa4au, 0x5b9cca4fu, 0x682e6ff3u,
+    0x748f82eeu, 0x78a5636fu, 0x84c87814u, 0x8cc70208u,
+    0x90befffau, 0xa4506cebu, 0xbef9a3f7u, 0xc67178f2u};
+
+inline std::uint32_t sha256_rotr(std::uint32_t x, unsigned n)
+{
+  return (x >> n) | (x << (32u - n));
+}
+
+}
+
+sha256::sha256()
+{
+  reset();
+}
+
+void sha256::reset()
+{
+  // FIPS 180-4, 5.3.3
+  state_[0] = 0x6a09e667u; state_[1] = 0xbb67ae85u;
+  state_[2] = 0x3c6ef372u; state_[3] = 0xa54ff53au;
+  state_[4] = 0x510e527fu; state_[5] = 0x9b05688cu;
+  state_[6] = 0x1f83d9abu; state_[7] = 0x5be0cd19u;
+  size_ = 0u;
+  used_ = 0u;
+}
+
+void sha256::compress_(const std::uint8_t * block)
+{
+  std::uint32_t w[64];
+  for (std::size_t i = 0u; i < 16u; i++)
+    w[i] = (std::uint32_t(block[i * 4u]) << 24u) | (std::uint32_t(block[i * 4u + 1u]) << 16u)
+         | (std::uint32_t(block[i * 4u + 2u]) << 8u) | std::uint32_t(block[i * 4u + 3u]);
+  for (std::size_t i = 16u; i < 64u; i++)
+  {
+    const auto s0 = sha256_rotr(w[i - 15u], 7u) ^ sha256_rotr(w[i - 15u], 18u) ^ (w[i - 15u] >> 3u);
+    const auto s1 = sha256_rotr(w[i - 2u], 17u) ^ sha256_rotr(w[i - 2u], 19u) ^ (w[i - 2u] >> 10u);
+    w[i] = w[i - 16u] + s0 + w[i - 7u] + s1;
+  }
+
+  auto a = state_[0], b = state_[1], c = state_[2], d = state_[3],
+       e = state_[4], f = state_[5], g = state_[6], h = state_[7];
+
+  for (std::size_t i = 0u; i < 64u; i++)
+  {
+    const auto s1 = sha256_rotr(e, 6u) ^ sha256_rotr(e, 11u) ^ sha256_rotr(e, 25u);
+    const auto ch = (e & f) ^ (~e & g);
+    const auto t1 = h + s1 + ch + sha256_k[i] + w[i];
+    const auto s0 = sha256_rotr(a, 2u) ^ sha256_rotr(a, 13u) ^ sha256_rotr(a, 22u);
+    const auto mj = (a & b) ^ (a & c) ^ (b & c);
+    const auto t2 = s0 + mj;
+    h = g; g = f; f = e; e = d + t1;
+    d = c; c = b; b = a; a = t1 + t2;
+  }
+
+  state_[0] += a; state_[1] += b; state_[2] += c; state_[3] += d;
+  state_[4] += e; state_[5] += f; state_[6] += g; state_[7] += h;
+}
+
+void sha256::update(const void * data, std::size_t size)
+{
+  auto p = static_cast<const std::uint8_t *>(data);
+  size_ += size;
+
+  if (used_ > 0u)
+  {
+    const auto take = (std::min)(size, sizeof(block_) - used_);
+    std::memcpy(block_ + used_, p, take);
+    used_ += take;
+    p += take;
+    size -= take;
+    if (used_ < sizeof(block_))
+      return;
+    compress_(block_);
+    used_ = 0u;
+  }
+
+  while (size >= sizeof(block_))
+  {
+    compress_(p);
+    p += sizeof(block_);
+    size -= sizeof(block_);
+  }
+
+  if (size > 0u)
+  {
+    std::memcpy(block_, p, size);
+    used_ = size;
+  }
+}
+
+auto sha256::finish() -> digest_type
+{
+  // FIPS 180-4, 5.1.1: 0x80, zero padding, 64-bit message length in bits
+  const std::uint64_t bits = size_ * 8u;
+  const std::uint8_t pad = 0x80u;
+  update(&pad, 1u);
+  static const std::uint8_t zeros[64] = {};
+  while (used_ != 56u)
+    update(zeros, used_ < 56u ? 56u - used_ : sizeof(block_) - used_);
+  std::uint8_t len[8];
+  for (std::size_t i = 0u; i < 8u; i++)
+    len[i] = static_cast<std::uint8_t>(bits >> (56u - i * 8u));
+  update(len, sizeof(len));
+
+  digest_type res;
+  for (std::size_t i = 0u; i < 8u; i++)
+  {
+    res[i * 4u]      = static_cast<std::uint8_t>(state_[i] >> 24u);
+    res[i * 4u + 1u] = static_cast<std::uint8_t>(state_[i] >> 16u);
+    res[i * 4u + 2u] = static_cast<std::uint8_t>(state_[i] >> 8u);
+    res[i * 4u + 3u] = static_cast<std::uint8_t>(state_[i]);
+  }
+  return res;
+}
+
+std::string sha256::hex(const digest_type & digest)
+{
+  static const char tab[] = "0123456789abcdef";
+  std::string res;
+  res.resize(digest.size() * 2u);
+  for (std::size_t i = 0u; i < digest.size(); i++)
+  {
+    res[i * 2u]      = tab[digest[i] >> 4u];
+    res[i * 2u + 1u] = tab[digest[i] & 0x0fu];
+  }
+  return res;
+}
+
+}
+}
+
+#endif // BOOST_REQUESTS_IMPL_DIGEST_IPP
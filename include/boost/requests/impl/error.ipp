@@ -83,6 +83,10 @@ struct request_category_t final : system::error_category
     case error::insecure: return "insecure";
     case error::invalid_redirect: return "invalid-redirect";
     case error::wrong_host: return "wrong-host";
+    case error::tunnel_failed: return "tunnel-failed";
+    case error::session_overloaded: return "session-overloaded";
+    case error::circuit_open: return "circuit-open";
+    case error::session_draining: return "session-draining";
 
     default: return "unknown error";
     }
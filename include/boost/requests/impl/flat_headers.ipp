@@ -0,0 +1,182 @@
+// Copyright (c) 2021 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_REQUESTS_IMPL_FLAT_HEADERS_IPP
+#define BOOST_REQUESTS_IMPL_FLAT_HEADERS_IPP
+
+#include <boost/requests/flat_headers.hpp>
+#include <algorithm>
+
+namespace boost {
+namespace requests {
+
+namespace {
+
+inline char ascii_lower(char c)
+{
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+}
+
+// case-insensitive, per RFC 9110 field names
+inline bool ci_less(core::string_view lhs, core::string_view rhs)
+{
+  const auto n = (std::min)(lhs.size(), rhs.size());
+  for (std::size_t i = 0u; i < n; i++)
+  {
+    const char l = ascii_lower(lhs[i]), r = ascii_lower(rhs[i]);
+    if (l != r)
+      return l < r;
+  }
+  return lhs.size() < rhs.size();
+}
+
+}
+
+std::size_t flat_headers::lower_bound_(core::string_view name) const
+{
+  std::size_t first = 0u, count = entries_.size();
+  while (count > 0u)
+  {
+    const auto step = count / 2u;
+    const auto mid = first + step;
+    if (ci_less(entry_at_(mid).name, name))
+    {
+      first = mid + 1u;
+      count -= step + 1u;
+    }
+    else
+      count = step;
+  }
+  return first;
+}
+
+std::size_t flat_headers::upper_bound_(core::string_view name) const
+{
+  std::size_t first = 0u, count = entries_.size();
+  while (count > 0u)
+  {
+    const auto step = count / 2u;
+    const auto mid = first + step;
+    if (!ci_less(name, entry_at_(mid).name))
+    {
+      first = mid + 1u;
+      count -= step + 1u;
+    }
+    else
+      count = step;
+  }
+  return first;
+}
+
+auto flat_headers::append_fragment_(core::string_view name, core::string_view value) -> entry_
+{
+  entry_ e;
+  e.off = static_cast<std::uint32_t>(block_.size());
+  e.name_len = static_cast<std::uint32_t>(name.size());
+  e.value_len = static_cast<std::uint32_t>(value.size());
+  block_.reserve(block_.size() + wire_len_(e));
+  block_.append(name.data(), name.size());
+  block_.append(": ", 2u);
+  block_.append(value.data(), value.size());
+  block_.append("\r\n", 2u);
+  return e;
+}
+
+void flat_headers::set(core::string_view name, core::string_view value)
+{
+  const auto first = lower_bound_(name);
+  auto last = first;
+  while (last < entries_.size() && !ci_less(name, entry_at_(last).name))
+  {
+    dead_ += wire_len_(entries_[last]);
+    last++;
+  }
+  const auto e = append_fragment_(name, value);
+  if (last == first)
+    entries_.insert(entries_.begin() + first, e);
+  else
+  {
+    // reuse the first slot, the replaced fragments stay as holes until
+    // the next wire() compacts
+    entries_.erase(entries_.begin() + first + 1u, entries_.begin() + last);
+    entries_[first] = e;
+  }
+}
+
+void flat_headers::insert(core::string_view name, core::string_view value)
+{
+  const auto pos = upper_bound_(name); // after its equals, keeping age order
+  const auto e = append_fragment_(name, value);
+  entries_.insert(entries_.begin() + pos, e);
+}
+
+core::string_view flat_headers::operator[](core::string_view name) const
+{
+  const auto pos = lower_bound_(name);
+  if (pos < entries_.size())
+  {
+    const auto e = entry_at_(pos);
+    if (!ci_less(name, e.name))
+      return e.value;
+  }
+  return core::string_view();
+}
+
+std::size_t flat_headers::count(core::string_view name) const
+{
+  return upper_bound_(name) - lower_bound_(name);
+}
+
+bool flat_headers::erase(core::string_view name)
+{
+  const auto first = lower_bound_(name), last = upper_bound_(name);
+  for (auto i = first; i < last; i++)
+    dead_ += wire_len_(entries_[i]);
+  entries_.erase(entries_.begin() + first, entries_.begin() + last);
+  return first != last;
+}
+
+void flat_headers::compact_()
+{
+  // rewrite in block order, so the wire keeps the insertion order of the
+  // fields rather than the index's sorted one
+  std::vector<std::size_t> order(entries_.size());
+  for (std::size_t i = 0u; i < order.size(); i++)
+    order[i] = i;
+  std::sort(order.begin(), order.end(),
+            [this](std::size_t lhs, std::size_t rhs)
+            { return entries_[lhs].off < entries_[rhs].off; });
+
+  std::string next;
+  next.reserve(block_.size() - dead_);
+  for (const auto i : order)
+  {
+    auto & e = entries_[i];
+    const auto off = static_cast<std::uint32_t>(next.size());
+    next.append(block_.data() + e.off, wire_len_(e));
+    e.off = off;
+  }
+  block_ = std::move(next);
+  dead_ = 0u;
+}
+
+core::string_view flat_headers::wire()
+{
+  if (dead_ > 0u)
+    compact_();
+  return core::string_view(block_.data(), block_.size());
+}
+
+http::fields flat_headers::to_fields(container::pmr::memory_resource * res) const
+{
+  http::fields f{container::pmr::polymorphic_allocator<char>(res)};
+  for (const auto fv : *this)
+    f.insert(fv.name, fv.value);
+  return f;
+}
+
+}
+}
+
+#endif // BOOST_REQUESTS_IMPL_FLAT_HEADERS_IPP
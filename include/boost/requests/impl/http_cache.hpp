@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_IMPL_HTTP_CACHE_HPP
+#define BOOST_REQUESTS_IMPL_HTTP_CACHE_HPP
+
+#include <boost/requests/http_cache.hpp>
+#include <boost/url/url.hpp>
+#include <boost/asio/yield.hpp>
+
+namespace boost {
+namespace requests {
+
+template<typename Executor>
+auto http_cache::match(Executor exec, urls::url_view url) -> optional<basic_stream<Executor>>
+{
+  auto * src = do_match_(asio::any_io_executor(exec), url.buffer());
+  if (src == nullptr)
+    return boost::none;
+  return stream_from_(std::move(exec), src);
+}
+
+template<typename Executor>
+auto http_cache::stream_from_(Executor exec, detail::cache_replay * src)
+    -> optional<basic_stream<Executor>>
+{
+  basic_stream<Executor> str{exec, src};
+  str.parser_ = detail::make_pmr<http::response_parser<http::buffer_body>>(
+      container::pmr::get_default_resource(), http::response_header{});
+
+  system::error_code ec;
+  src->do_read_header_(*str.parser_, ec);
+  if (ec) // a corrupt entry reads as a miss; str's destructor frees the replay
+    return boost::none;
+  return optional<basic_stream<Executor>>(std::move(str));
+}
+
+template<typename Executor>
+auto http_cache::revalidated(Executor exec, urls::url_view url,
+                             const http::response_header & h)
+    -> optional<basic_stream<Executor>>
+{
+  refresh_(url.buffer(), h);
+  // stale is fine here - the 304 just told us the entry is still current.
+  auto * src = do_match_(asio::any_io_executor(exec), url.buffer(), true);
+  if (src == nullptr)
+    return boost::none;
+  return stream_from_(std::move(exec), src);
+}
+
+template<typename Executor>
+bool http_cache::capturable(basic_stream<Executor> & str) const
+{
+  return str.parser_ != nullptr && !str.inflater_
+      && str.parser_->is_header_done()
+      && !str.parser_->chunked()
+      && str.parser_->content_length()
+      && *str.parser_->content_length() <= max_entry_size
+      && cacheable(str.headers());
+}
+
+template<typename Executor>
+basic_stream<Executor> http_cache::fill(Executor exec, urls::url_view url,
+                                        basic_stream<Executor> str, system::error_code & ec)
+{
+  beast::flat_buffer buf;
+  str.read(buf, ec);
+  if (ec)
+    return str;
+  return serve_filled_(std::move(exec), url, std::move(str), buf);
+}
+
+template<typename Executor>
+basic_stream<Executor> http_cache::serve_filled_(Executor exec, urls::url_view url,
+                                                 basic_stream<Executor> str,
+                                                 beast::flat_buffer & buf)
+{
+  const auto hv = str.impl_->get_host_();
+  std::string host{hv.begin(), hv.end()};
+
+  auto payload = make_payload_(
+      http::response_header(str.headers()),
+      core::string_view(static_cast<const char*>(buf.data().data()), buf.data().size()));
+  store_(url.buffer(), host, str.headers(), payload);
+
+  // the caller gets served from the recorded bytes, the same way a later
+  // hit would be; a persistence failure only costs the next request a miss.
+  auto * src = new detail::cache_replay(asio::any_io_executor(exec), std::move(host));
+  src->owned_ = std::move(payload);
+  src->base_  = src->owned_.data();
+  src->size_  = src->owned_.size();
+
+  auto res = stream_from_(exec, src);
+  if (!res) // cannot happen for bytes just serialized here, but stay safe
+    return str;
+  res->history_ = std::move(str.history_);
+  res->timings_ = str.timings_;
+  return std::move(*res);
+}
+
+namespace detail
+{
+
+template<typename Executor>
+struct async_cache_fill_op : asio::coroutine
+{
+  using executor_type = Executor;
+  executor_type get_executor() {return exec; }
+
+  http_cache * cache;
+  urls::url url;
+  Executor exec;
+  basic_stream<Executor> str;
+  beast::flat_buffer buf;
+
+  async_cache_fill_op(http_cache * cache, urls::url_view url,
+                      Executor exec, basic_stream<Executor> str)
+      : cache(cache), url(url), exec(std::move(exec)), str(std::move(str)) {}
+
+  using completion_signature_type = void(system::error_code, basic_stream<Executor>);
+  using step_signature_type       = void(system::error_code, std::size_t);
+
+  auto resume(requests::detail::co_token_t<step_signature_type> self,
+              system::error_code & ec, std::size_t = 0u) -> basic_stream<Executor>
+  {
+    reenter(this)
+    {
+      yield str.async_read(buf, std::move(self));
+      if (ec)
+        return std::move(str);
+      return cache->serve_filled_(exec, url, std::move(str), buf);
+    }
+    return basic_stream<Executor>{exec, nullptr};
+  }
+};
+
+template<typename Executor, typename Token>
+auto async_cache_fill(http_cache * cache, urls::url_view url, Executor exec,
+                      basic_stream<Executor> str, Token && token)
+{
+  return co_run<async_cache_fill_op<Executor>>(std::forward<Token>(token),
+                                               cache, url, exec, std::move(str));
+}
+
+}
+
+}
+}
+
+#include <boost/asio/unyield.hpp>
+
+#endif // BOOST_REQUESTS_IMPL_HTTP_CACHE_HPP
@@ -0,0 +1,560 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_IMPL_HTTP_CACHE_IPP
+#define BOOST_REQUESTS_IMPL_HTTP_CACHE_IPP
+
+#include <boost/requests/http_cache.hpp>
+#include <boost/requests/rfc/dates.hpp>
+#include <boost/beast/core/file.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <cstdint>
+#include <cstdio>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace boost {
+namespace requests {
+namespace detail {
+
+cache_replay::~cache_replay()
+{
+#if !defined(_WIN32)
+  if (map_ != nullptr)
+    ::munmap(map_, map_size_);
+#endif
+}
+
+std::size_t cache_replay::do_read_some_(beast::http::basic_parser<false> & parser)
+{
+  system::error_code ec;
+  auto n = do_read_some_(parser, ec);
+  if (ec)
+    throw_exception(system::system_error(ec, "read_some"));
+  return n;
+}
+
+std::size_t cache_replay::do_read_some_(beast::http::basic_parser<false> & parser, system::error_code & ec)
+{
+  if (parser.is_done())
+    return 0u;
+  if (pos_ >= size_)
+  {
+    parser.put_eof(ec);
+    return 0u;
+  }
+  auto n = parser.put(asio::const_buffer(base_ + pos_, size_ - pos_), ec);
+  if (ec == beast::http::error::need_more)
+    ec = {};
+  pos_ += n;
+  return n;
+}
+
+void cache_replay::do_async_read_some_(beast::http::basic_parser<false> & parser, detail::co_token_t<void(system::error_code, std::size_t)> tk)
+{
+  system::error_code ec;
+  auto n = do_read_some_(parser, ec);
+  asio::post(exec_, asio::append(std::move(tk), ec, n));
+}
+
+std::size_t cache_replay::do_buffered_input_() const
+{
+  return size_ - pos_;
+}
+
+std::size_t cache_replay::do_read_body_direct_(detail::buffer_span buffers, system::error_code & ec)
+{
+  // the whole entry counts as buffered input, so only peek_some enters
+  // direct mode on a replay; serve straight from the mapping.
+  const auto n = asio::buffer_copy(buffers, asio::const_buffer(base_ + pos_, size_ - pos_));
+  if (n == 0u)
+    BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
+  pos_ += n;
+  return n;
+}
+
+void cache_replay::do_async_read_body_direct_(detail::buffer_span buffers, detail::co_token_t<void(system::error_code, std::size_t)> tk)
+{
+  system::error_code ec;
+  const auto n = do_read_body_direct_(buffers, ec);
+  asio::post(exec_, asio::append(std::move(tk), ec, n));
+}
+
+asio::const_buffer cache_replay::do_staged_input_() const
+{
+  return asio::const_buffer(base_ + pos_, size_ - pos_);
+}
+
+void cache_replay::do_consume_staged_(std::size_t n)
+{
+  pos_ += n;
+}
+
+std::size_t cache_replay::do_stage_input_(system::error_code & ec)
+{
+  // the whole entry is staged up front
+  BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
+  return 0u;
+}
+
+void cache_replay::do_async_stage_input_(detail::co_token_t<void(system::error_code, std::size_t)> tk)
+{
+  system::error_code ec;
+  BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
+  asio::post(exec_, asio::append(std::move(tk), ec, std::size_t(0u)));
+}
+
+void cache_replay::do_close_(system::error_code &)
+{
+  open_ = false;
+}
+
+void cache_replay::do_async_close_(detail::co_token_t<void(system::error_code)> tk)
+{
+  open_ = false;
+  asio::post(exec_, std::move(tk));
+}
+
+#if defined(__linux__)
+
+bool cache_replay::do_supports_splice_() const
+{
+  return false;
+}
+
+std::size_t cache_replay::do_splice_body_(int, std::size_t, bool, system::error_code & ec)
+{
+  BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::operation_not_supported);
+  return 0u;
+}
+
+void cache_replay::do_async_wait_readable_(detail::co_token_t<void(system::error_code)> tk)
+{
+  asio::post(exec_, std::move(tk));
+}
+
+#endif
+
+void cache_replay::do_read_header_(beast::http::basic_parser<false> & parser, system::error_code & ec)
+{
+  while (!parser.is_header_done() && !ec && pos_ < size_)
+  {
+    auto n = parser.put(asio::const_buffer(base_ + pos_, size_ - pos_), ec);
+    if (ec == beast::http::error::need_more)
+      ec = {};
+    if (n == 0u && !ec)
+      break;
+    pos_ += n;
+  }
+  if (!ec && !parser.is_header_done())
+    BOOST_REQUESTS_ASSIGN_EC(ec, beast::http::error::partial_message);
+}
+
+void cache_replay::do_async_read_header_(beast::http::basic_parser<false> & parser, detail::co_token_t<void(system::error_code, std::size_t)> tk)
+{
+  system::error_code ec;
+  const auto p0 = pos_;
+  do_read_header_(parser, ec);
+  asio::post(exec_, asio::append(std::move(tk), ec, pos_ - p0));
+}
+
+core::string_view cache_replay::get_host_() const
+{
+  return host_;
+}
+
+keep_alive & cache_replay::get_keep_alive_set_()
+{
+  return keep_alive_;
+}
+
+bool cache_replay::is_open() const
+{
+  return open_;
+}
+
+void cache_replay::do_release_buffer_()
+{
+  // ~basic_stream's last use of the impl; the replay owns itself.
+  delete this;
+}
+
+// metadata lines prepended to each entry file, before the raw response
+inline core::string_view cache_file_magic()
+{
+  return "boost.requests.cache.1";
+}
+
+inline std::uint64_t parse_cache_u64(core::string_view sv)
+{
+  std::uint64_t res = 0u;
+  for (auto c : sv)
+  {
+    if (c < '0' || c > '9')
+      break;
+    res = res * 10u + static_cast<std::uint64_t>(c - '0');
+  }
+  return res;
+}
+
+struct cache_entry_prefix
+{
+  core::string_view url, etag, last_modified, host;
+  std::chrono::system_clock::time_point expires;
+  std::size_t payload_offset{0u};
+};
+
+inline bool parse_cache_prefix(core::string_view data, cache_entry_prefix & out)
+{
+  core::string_view lines[6];
+  std::size_t pos = 0u;
+  for (auto & line : lines)
+  {
+    const auto nl = data.find('\n', pos);
+    if (nl == core::string_view::npos)
+      return false;
+    line = data.substr(pos, nl - pos);
+    pos = nl + 1u;
+  }
+  if (lines[0] != cache_file_magic()
+      || pos >= data.size() || data[pos] != '\n')
+    return false;
+
+  out.url           = lines[1];
+  out.etag          = lines[3];
+  out.last_modified = lines[4];
+  out.host          = lines[5];
+  out.expires       = std::chrono::system_clock::time_point(
+      std::chrono::seconds(parse_cache_u64(lines[2])));
+  out.payload_offset = pos + 1u;
+  return out.payload_offset <= data.size();
+}
+
+// explicit freshness per RFC 9111 4.2.1: Cache-Control max-age wins,
+// Expires relative to the origin's Date comes second, no heuristics.
+inline std::chrono::system_clock::time_point cache_expiry(
+    const http::response_header & h,
+    std::chrono::system_clock::time_point now)
+{
+  auto itr = h.find(beast::http::field::cache_control);
+  if (itr != h.end())
+  {
+    const auto v = itr->value();
+    auto pos = v.find("max-age=");
+    // "s-maxage" spells differently, but guard against extensions ending
+    // in "max-age" anyway.
+    if (pos != core::string_view::npos && (pos == 0u || v[pos - 1u] == ' ' || v[pos - 1u] == ','))
+      return now + std::chrono::seconds(parse_cache_u64(v.substr(pos + 8u)));
+  }
+
+  const auto eitr = h.find(beast::http::field::expires);
+  if (eitr != h.end())
+  {
+    const auto exp = urls::grammar::parse(eitr->value(), rfc::date_1123);
+    if (exp)
+    {
+      auto base = now;
+      const auto ditr = h.find(beast::http::field::date);
+      if (ditr != h.end())
+      {
+        const auto d = urls::grammar::parse(ditr->value(), rfc::date_1123);
+        if (d)
+          base = *d;
+      }
+      if (*exp > base)
+        return now + (*exp - base);
+    }
+  }
+  return now;
+}
+
+}
+
+http_cache::http_cache(filesystem::path directory)
+    : directory_(std::move(directory))
+{
+  try
+  {
+    filesystem::create_directories(directory_);
+  }
+  catch (...) {}
+  scan_();
+}
+
+bool http_cache::cacheable(const http::response_header & h)
+{
+  if (h.result() != beast::http::status::ok)
+    return false;
+  const auto itr = h.find(beast::http::field::cache_control);
+  if (itr != h.end() && itr->value().find("no-store") != core::string_view::npos)
+    return false;
+  const auto now = std::chrono::system_clock::now();
+  return detail::cache_expiry(h, now) > now;
+}
+
+detail::cache_replay * http_cache::do_match_(asio::any_io_executor exec, core::string_view url,
+                                             bool ignore_freshness)
+{
+  std::string path;
+  {
+    std::lock_guard<std::mutex> lock{mtx_};
+    const auto itr = entries_.find(std::string(url.begin(), url.end()));
+    if (itr == entries_.end()
+        || (!ignore_freshness && itr->second.expires <= std::chrono::system_clock::now()))
+      return nullptr;
+    path = itr->second.path;
+  }
+
+#if defined(_WIN32)
+  // no mmap here, the entry gets read into an owned buffer instead
+  std::string owned;
+  {
+    beast::file f;
+    system::error_code ec;
+    f.open(path.c_str(), beast::file_mode::read, ec);
+    if (ec)
+      return nullptr;
+    const auto size = f.size(ec);
+    if (ec)
+      return nullptr;
+    owned.resize(static_cast<std::size_t>(size));
+    f.read(&owned[0], owned.size(), ec);
+    if (ec)
+      return nullptr;
+  }
+  const char * base = owned.data();
+  const std::size_t size = owned.size();
+#else
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    return nullptr;
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || st.st_size <= 0)
+  {
+    ::close(fd);
+    return nullptr;
+  }
+  const auto size = static_cast<std::size_t>(st.st_size);
+  void * const map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (map == MAP_FAILED)
+    return nullptr;
+  const char * base = static_cast<const char *>(map);
+#endif
+
+  detail::cache_entry_prefix pre;
+  if (!detail::parse_cache_prefix(core::string_view(base, size), pre)
+      || pre.url != url)
+  {
+#if !defined(_WIN32)
+    ::munmap(map, size);
+#endif
+    return nullptr;
+  }
+
+  auto * src = new detail::cache_replay(std::move(exec),
+                                        std::string(pre.host.begin(), pre.host.end()));
+#if defined(_WIN32)
+  src->owned_ = std::move(owned);
+  src->base_  = src->owned_.data();
+#else
+  src->map_      = map;
+  src->map_size_ = size;
+  src->base_     = base;
+#endif
+  src->size_ = size;
+  src->pos_  = pre.payload_offset;
+  return src;
+}
+
+bool http_cache::validators_for(core::string_view url,
+                                std::string & etag,
+                                std::string & last_modified)
+{
+  std::lock_guard<std::mutex> lock{mtx_};
+  const auto itr = entries_.find(std::string(url.begin(), url.end()));
+  if (itr == entries_.end()
+      || (itr->second.etag.empty() && itr->second.last_modified.empty()))
+    return false;
+  etag          = itr->second.etag;
+  last_modified = itr->second.last_modified;
+  return true;
+}
+
+void http_cache::refresh_(core::string_view url, const http::response_header & h)
+{
+  const auto now = std::chrono::system_clock::now();
+  const auto expires = detail::cache_expiry(h, now);
+
+  std::lock_guard<std::mutex> lock{mtx_};
+  const auto itr = entries_.find(std::string(url.begin(), url.end()));
+  if (itr == entries_.end())
+    return;
+  // the entry file keeps its old expiry; after a restart the entry gets
+  // revalidated once more, which is the cheap case.
+  if (expires > now)
+    itr->second.expires = expires;
+  const auto eitr = h.find(beast::http::field::etag);
+  if (eitr != h.end())
+    itr->second.etag.assign(eitr->value().begin(), eitr->value().end());
+}
+
+std::string http_cache::make_payload_(http::response_header h, core::string_view body)
+{
+  // hop-by-hop and connection-level fields don't survive storage (RFC 9111
+  // 3.1); the content-length gets pinned to the stored body.
+  h.erase(beast::http::field::connection);
+  h.erase(beast::http::field::keep_alive);
+  h.erase(beast::http::field::proxy_authenticate);
+  h.erase(beast::http::field::proxy_authorization);
+  h.erase(beast::http::field::te);
+  h.erase(beast::http::field::trailer);
+  h.erase(beast::http::field::transfer_encoding);
+  h.erase(beast::http::field::upgrade);
+  h.erase(beast::http::field::set_cookie);
+  h.set(beast::http::field::content_length, std::to_string(body.size()));
+
+  std::string out;
+  out.reserve(256u + body.size());
+  out += "HTTP/1.1 ";
+  out += std::to_string(h.result_int());
+  out += ' ';
+  out.append(h.reason().begin(), h.reason().end());
+  out += "\r\n";
+  for (const auto & f : h)
+  {
+    out.append(f.name_string().begin(), f.name_string().end());
+    out += ": ";
+    out.append(f.value().begin(), f.value().end());
+    out += "\r\n";
+  }
+  out += "\r\n";
+  out.append(body.begin(), body.end());
+  return out;
+}
+
+void http_cache::store_(core::string_view url, core::string_view host,
+                        const http::response_header & h, const std::string & payload)
+{
+  const auto now = std::chrono::system_clock::now();
+  const auto expires = detail::cache_expiry(h, now);
+  if (expires <= now)
+    return;
+
+  entry_ e;
+  e.expires = expires;
+  auto itr = h.find(beast::http::field::etag);
+  if (itr != h.end())
+    e.etag.assign(itr->value().begin(), itr->value().end());
+  itr = h.find(beast::http::field::last_modified);
+  if (itr != h.end())
+    e.last_modified.assign(itr->value().begin(), itr->value().end());
+
+  char name[32];
+  std::snprintf(name, sizeof(name), "%016llx.http",
+                static_cast<unsigned long long>(
+                    boost::hash_range(url.begin(), url.end())));
+  e.path = (directory_ / name).string();
+
+  std::string prefix{detail::cache_file_magic().begin(), detail::cache_file_magic().end()};
+  prefix += '\n';
+  prefix.append(url.begin(), url.end());
+  prefix += '\n';
+  prefix += std::to_string(std::chrono::duration_cast<std::chrono::seconds>(
+      expires.time_since_epoch()).count());
+  prefix += '\n';
+  prefix += e.etag;
+  prefix += '\n';
+  prefix += e.last_modified;
+  prefix += '\n';
+  prefix.append(host.begin(), host.end());
+  prefix += "\n\n";
+
+  // written next to the final name and renamed over it, so readers only
+  // ever map complete entries. A replaced entry's old mapping stays valid
+  // until the last replay unmaps it.
+  const auto tmp = e.path + ".tmp";
+  {
+    beast::file f;
+    system::error_code ec;
+    f.open(tmp.c_str(), beast::file_mode::write, ec);
+    if (!ec)
+      f.write(prefix.data(), prefix.size(), ec);
+    if (!ec)
+      f.write(payload.data(), payload.size(), ec);
+    if (!ec)
+      f.close(ec);
+    if (ec)
+    {
+      std::remove(tmp.c_str());
+      return; // the caller still gets served; only persistence failed
+    }
+  }
+  if (std::rename(tmp.c_str(), e.path.c_str()) != 0)
+  {
+    std::remove(tmp.c_str());
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock{mtx_};
+  entries_[std::string(url.begin(), url.end())] = std::move(e);
+}
+
+void http_cache::scan_()
+{
+  try
+  {
+    for (filesystem::directory_iterator it(directory_), end; it != end; ++it)
+    {
+      const auto path = it->path().string();
+      if (path.size() < 5u || path.compare(path.size() - 5u, 5u, ".http") != 0)
+        continue;
+
+      beast::file f;
+      system::error_code ec;
+      f.open(path.c_str(), beast::file_mode::read, ec);
+      if (ec)
+        continue;
+      char buf[8192];
+      const auto n = f.read(buf, sizeof(buf), ec);
+      if (ec)
+        continue;
+
+      detail::cache_entry_prefix pre;
+      if (!detail::parse_cache_prefix(core::string_view(buf, n), pre))
+        continue;
+
+      entry_ e;
+      e.path = path;
+      e.expires = pre.expires;
+      e.etag.assign(pre.etag.begin(), pre.etag.end());
+      e.last_modified.assign(pre.last_modified.begin(), pre.last_modified.end());
+      entries_[std::string(pre.url.begin(), pre.url.end())] = std::move(e);
+    }
+  }
+  catch (...) {}
+}
+
+void http_cache::clear()
+{
+  std::lock_guard<std::mutex> lock{mtx_};
+  for (const auto & e : entries_)
+    std::remove(e.second.path.c_str());
+  entries_.clear();
+}
+
+}
+}
+
+#endif // BOOST_REQUESTS_IMPL_HTTP_CACHE_IPP
@@ -43,7 +43,18 @@ bool interpret_keep_alive_response(keep_alive & ka,
   {
     const auto kl_itr = res.find(beast::http::field::keep_alive);
     if (kl_itr == res.end())
-      ka = keep_alive{}; // set to max
+    {
+      // no fresh advertisement. a tracked request budget still counts
+      // down - the server's limit doesn't go away just because it stopped
+      // repeating it - while an untracked connection resets to unlimited.
+      if (ka.max != (std::numeric_limits<std::size_t>::max)())
+      {
+        if (ka.max > 0u)
+          --ka.max;
+      }
+      else
+        ka = keep_alive{}; // set to max
+    }
     else
     {
 
@@ -51,11 +62,14 @@ bool interpret_keep_alive_response(keep_alive & ka,
       if (rr.has_error())
         ec = rr.error();
       else
-        ka = *rr;
+        ka = *rr; // a fresh `max=` is the remaining budget as the server sees it
 
       if (ka.timeout < now)
         should_close = true;
     }
+
+    if (ka.max == 0u)
+      should_close = true; // budget spent, the server will hang up next
   }
 
   return should_close;
@@ -9,88 +9,186 @@
 #define BOOST_REQUESTS_IMPL_MIME_TYPES_IPP
 
 #include <boost/requests/mime_types.hpp>
+#include <cstdint>
 
 namespace boost {
 namespace requests {
+namespace detail {
 
+struct mime_entry
+{
+  const char * ext;
+  const char * type;
+};
+
+// copied from https://developer.mozilla.org/en-US/docs/Web/HTTP/Basics_of_HTTP/MIME_types/Common_types
+constexpr mime_entry mime_entries[] =
+    {
+      { ".3g2", /*3GPP2 audio/video container*/ "video/3gpp2"},
+      { ".7z", /*7-zip archive*/	"application/x-7z-compressed"},
+      { ".aac", /*AAC audio*/ "audio/aac"},
+      { ".abw", /*AbiWord document*/ "application-x-abiword"},
+      { ".arc", /*Archive document (multiple files embedded)*/	"application-x-freearc"},
+      { ".avif", /*AVIF image*/ "image/avif"},
+      { ".avi", /*AVI: Audio Video Interleave	*/ "videox-msvideo"},
+      { ".azw", /*Amazon Kindle eBook format */	"application/vnd.amazon.ebook"},
+      { ".bin", /*Any kind of binary data	*/ "application/octet-stream"},
+      { ".bmp", /*Windows OS/2 Bitmap Graphics*/ "image/bmp"},
+      { ".bz", /*BZip archive	*/ "application/x-bzip"},
+      { ".bz2", /*BZip2 archive	*/ "application/x-bzip2"},
+      { ".cda", /*CD audio	*/ "application/x-cdf"},
+      { ".csh", /*C-Shell script	*/ "application/x-csh"},
+      { ".css", /*Cascading Style Sheets (CSS)*/"text/css"},
+      { ".csv", /*Comma-separated values (CSV)*/"text/csv"},
+      { ".doc", /*Microsoft Word*/ "application/msword"},
+      { ".docx", /*Microsoft Word (OpenXML)	*/ "application/vnd.openxmlformats-officedocument.wordprocessingml.document"},
+      { ".eot", /*MS Embedded OpenType fonts	*/ "application/vnd.ms-fontobject"},
+      { ".epub", /*Electronic publication (EPUB)	*/ "application/epub+zip"},
+      { ".gz", /*GZip Compressed Archive*/ "application/gzip"},
+      { ".gif", /*Graphics Interchange Format (GIF)*/"image/gif"},
+      { ".htm", /*.html	HyperText Markup Language (HTML)*/"text/html"},
+      { ".html", /*.html	HyperText Markup Language (HTML)*/"text/html"},
+      { ".ico", /*Icon format*/ "image/vnd"},
+      { ".ics", /*iCalendar format*/ "text/calendar"},
+      { ".jar", /*Java Archive (JAR)	*/ "application/java-archive"},
+      { ".jpeg", /*.jpg	JPEG images*/ "image/jpeg"},
+      { ".js", /*JavaScript	*/"text/javascript"/* (Specifications: HTML and "RFC 9239)"*/},
+      { ".json", /*JSON format*/ "application/json"},
+      { ".jsonld", /*JSON-LD format	*/ "application/ld+json"},
+      { ".mid", /*.midi	Musical Instrument Digital Interface (MIDI)	audio/midi */ "audio/x-midi"},
+      { ".mjs", /*JavaScript module*/ "text/javascript"},
+      { ".mp3", /*MP3 audio*/ "audio/mpeg"},
+      { ".mp4", /*MP4 video*/ "video/mp4"},
+      { ".mpeg", /*MPEG Video*/ "video/mpeg"},
+      { ".mpkg", /*Apple Installer Package */	"application/vnd.apple.installer+xml"},
+      { ".odp", /*OpenDocument presentation document */ "application/vnd.oasis.opendocument.presentation"},
+      { ".ods", /*OpenDocument spreadsheet document  */ "application/vnd.oasis.opendocument.spreadsheet"},
+      { ".odt", /*OpenDocument text document	       */ "application/vnd.oasis.opendocument.text"},
+      { ".oga", /*OGG audio*/ "audio/ogg"},
+      { ".ogv", /*OGG video*/ "video/ogg"},
+      { ".ogx", /*OGG*/ "application/ogg"},
+      { ".opus", /*Opus audio*/ "audio/opus"},
+      { ".otf", /*OpenType font*/ "font/otf"},
+      { ".png", /*Portable Network Graphics*/ "image/png"},
+      { ".pdf", /*Adobe Portable Document Format (PDF)*/"application/pdf"},
+      { ".php", /*Hypertext Preprocessor (Personal Home Page)	application/x*/ "httpd-php"},
+      { ".ppt", /*Microsoft PowerPoint	application/vnd*/ "ms-powerpoint"},
+      { ".pptx", /*Microsoft PowerPoint (OpenXML)	*/ "application/vnd.openxmlformats-officedocument.presentationml.presentation"},
+      { ".rar", /*RAR archive	*/ "application/vnd.rar"},
+      { ".rtf", /*Rich Text Format (RTF)*/"application/rtf"},
+      { ".sh", /*Bourne shell script	*/ "application/x-sh"},
+      { ".svg", /*Scalable Vector Graphics (SVG)	*/ "image/svg+xml"},
+      { ".tar", /*Tape Archive (TAR)	*/ "application/x-tar"},
+      { ".tif", /*.tiff	Tagged Image File Format (TIFF)*/"image/tiff"},
+      { ".tiff", /*.tiff	Tagged Image File Format (TIFF)*/"image/tiff"},
+      { ".ts", /*MPEG transport stream*/ "video/mp2t"},
+      { ".ttf", /*TrueType Font*/ "font/ttf"},
+      { ".txt", /*Text, (generally ASCII or ISO 8859-n)*/"text/plain"},
+      { ".vsd", /*	Microsoft Visio	*/ "application/vnd.visio"},
+      { ".wav", /*Waveform Audio Format*/ "audio/wav"},
+      { ".weba", /*WEBM audio*/ "audio/webm"},
+      { ".webm", /*WEBM video*/ "video/webm"},
+      { ".webp", /*WEBP image*/ "image/webp"},
+      { ".woff", /*Web Open Font Format (WOFF)*/"font/woff"},
+      { ".woff2", /*Web Open Font Format (WOFF)*/"font/woff2"},
+      { ".xhtml", /*XHTML	*/ "application/xhtml+xml"},
+      { ".xls", /*Microsoft Excel	application/vnd*/ "ms-excel"},
+      { ".xlsx", /*Microsoft Excel (OpenXML) */	"application/vnd.openxmlformats-officedocument.spreadsheetml.sheet"},
+      { ".xml", /*  */ "application/xml"/* serves as a valid default.*/ }
+    };
+
+constexpr std::size_t mime_entry_count = sizeof(mime_entries) / sizeof(mime_entries[0]);
+
+// 128 slots for ~70 entries keeps the linear-probe chains to a couple of
+// steps; the whole table is built at compile time and lives in rodata.
+constexpr std::size_t mime_table_size = 128u;
+
+constexpr char mime_lower(char c)
+{
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+constexpr std::uint32_t mime_hash(const char * s, std::size_t n)
+{
+  // FNV-1a over the lowercased extension
+  std::uint32_t h = 2166136261u;
+  for (std::size_t i = 0u; i < n; i++)
+  {
+    h ^= static_cast<unsigned char>(mime_lower(s[i]));
+    h *= 16777619u;
+  }
+  return h;
+}
+
+constexpr std::size_t mime_strlen(const char * s)
+{
+  std::size_t n = 0u;
+  while (s[n] != '\0')
+    n++;
+  return n;
+}
+
+struct mime_table_t
+{
+  std::uint8_t slots[mime_table_size]; // index into mime_entries, 0xFF = empty
+};
+
+constexpr mime_table_t build_mime_table()
+{
+  mime_table_t t{};
+  for (std::size_t i = 0u; i < mime_table_size; i++)
+    t.slots[i] = 0xFFu;
+  for (std::size_t i = 0u; i < mime_entry_count; i++)
+  {
+    std::size_t h = mime_hash(mime_entries[i].ext,
+                              mime_strlen(mime_entries[i].ext)) % mime_table_size;
+    while (t.slots[h] != 0xFFu)
+      h = (h + 1u) % mime_table_size;
+    t.slots[h] = static_cast<std::uint8_t>(i);
+  }
+  return t;
+}
+
+constexpr mime_table_t mime_table = build_mime_table();
+
+inline bool mime_ci_equal(const char * a, core::string_view b)
+{
+  std::size_t i = 0u;
+  for (; i < b.size(); i++)
+    if (a[i] == '\0' || mime_lower(a[i]) != mime_lower(b[i]))
+      return false;
+  return a[i] == '\0';
+}
+
+}
+
+BOOST_REQUESTS_DECL core::string_view mime_type_for(core::string_view extension)
+{
+  if (extension.empty())
+    return core::string_view();
+  auto h = detail::mime_hash(extension.data(), extension.size()) % detail::mime_table_size;
+  for (std::size_t probes = 0u; probes < detail::mime_table_size; probes++)
+  {
+    const auto idx = detail::mime_table.slots[h];
+    if (idx == 0xFFu)
+      break;
+    if (detail::mime_ci_equal(detail::mime_entries[idx].ext, extension))
+      return detail::mime_entries[idx].type;
+    h = (h + 1u) % detail::mime_table_size;
+  }
+  return core::string_view();
+}
 
 BOOST_REQUESTS_DECL const mime_type_map & default_mime_type_map()
 {
-  // copied from https://developer.mozilla.org/en-US/docs/Web/HTTP/Basics_of_HTTP/MIME_types/Common_types
-  const static mime_type_map mp
-      {
-        { ".3g2", /*3GPP2 audio/video container*/ "video/3gpp2"},
-        { ".7z", /*7-zip archive*/	"application/x-7z-compressed"},
-        { ".aac", /*AAC audio*/ "audio/aac"},
-        { ".abw", /*AbiWord document*/ "application-x-abiword"},
-        { ".arc", /*Archive document (multiple files embedded)*/	"application-x-freearc"},
-        { ".avif", /*AVIF image*/ "image/avif"},
-        { ".avi", /*AVI: Audio Video Interleave	*/ "videox-msvideo"},
-        { ".azw", /*Amazon Kindle eBook format */	"application/vnd.amazon.ebook"},
-        { ".bin", /*Any kind of binary data	*/ "application/octet-stream"},
-        { ".bmp", /*Windows OS/2 Bitmap Graphics*/ "image/bmp"},
-        { ".bz", /*BZip archive	*/ "application/x-bzip"},
-        { ".bz2", /*BZip2 archive	*/ "application/x-bzip2"},
-        { ".cda", /*CD audio	*/ "application/x-cdf"},
-        { ".csh", /*C-Shell script	*/ "application/x-csh"},
-        { ".css", /*Cascading Style Sheets (CSS)*/"text/css"},
-        { ".csv", /*Comma-separated values (CSV)*/"text/csv"},
-        { ".doc", /*Microsoft Word*/ "application/msword"},
-        { ".docx", /*Microsoft Word (OpenXML)	*/ "application/vnd.openxmlformats-officedocument.wordprocessingml.document"},
-        { ".eot", /*MS Embedded OpenType fonts	*/ "application/vnd.ms-fontobject"},
-        { ".epub", /*Electronic publication (EPUB)	*/ "application/epub+zip"},
-        { ".gz", /*GZip Compressed Archive*/ "application/gzip"},
-        { ".gif", /*Graphics Interchange Format (GIF)*/"image/gif"},
-        { ".htm", /*.html	HyperText Markup Language (HTML)*/"text/html"},
-        { ".html", /*.html	HyperText Markup Language (HTML)*/"text/html"},
-        { ".ico", /*Icon format*/ "image/vnd"},
-        { ".ics", /*iCalendar format*/ "text/calendar"},
-        { ".jar", /*Java Archive (JAR)	*/ "application/java-archive"},
-        { ".jpeg", /*.jpg	JPEG images*/ "image/jpeg"},
-        { ".js", /*JavaScript	*/"text/javascript"/* (Specifications: HTML and "RFC 9239)"*/},
-        { ".json", /*JSON format*/ "application/json"},
-        { ".jsonld", /*JSON-LD format	*/ "application/ld+json"},
-        { ".mid", /*.midi	Musical Instrument Digital Interface (MIDI)	audio/midi */ "audio/x-midi"},
-        { ".mjs", /*JavaScript module*/ "text/javascript"},
-        { ".mp3", /*MP3 audio*/ "audio/mpeg"},
-        { ".mp4", /*MP4 video*/ "video/mp4"},
-        { ".mpeg", /*MPEG Video*/ "video/mpeg"},
-        { ".mpkg", /*Apple Installer Package */	"application/vnd.apple.installer+xml"},
-        { ".odp", /*OpenDocument presentation document */ "application/vnd.oasis.opendocument.presentation"},
-        { ".ods", /*OpenDocument spreadsheet document  */ "application/vnd.oasis.opendocument.spreadsheet"},
-        { ".odt", /*OpenDocument text document	       */ "application/vnd.oasis.opendocument.text"},
-        { ".oga", /*OGG audio*/ "audio/ogg"},
-        { ".ogv", /*OGG video*/ "video/ogg"},
-        { ".ogx", /*OGG*/ "application/ogg"},
-        { ".opus", /*Opus audio*/ "audio/opus"},
-        { ".otf", /*OpenType font*/ "font/otf"},
-        { ".png", /*Portable Network Graphics*/ "image/png"},
-        { ".pdf", /*Adobe Portable Document Format (PDF)*/"application/pdf"},
-        { ".php", /*Hypertext Preprocessor (Personal Home Page)	application/x*/ "httpd-php"},
-        { ".ppt", /*Microsoft PowerPoint	application/vnd*/ "ms-powerpoint"},
-        { ".pptx", /*Microsoft PowerPoint (OpenXML)	*/ "application/vnd.openxmlformats-officedocument.presentationml.presentation"},
-        { ".rar", /*RAR archive	*/ "application/vnd.rar"},
-        { ".rtf", /*Rich Text Format (RTF)*/"application/rtf"},
-        { ".sh", /*Bourne shell script	*/ "application/x-sh"},
-        { ".svg", /*Scalable Vector Graphics (SVG)	*/ "image/svg+xml"},
-        { ".tar", /*Tape Archive (TAR)	*/ "application/x-tar"},
-        { ".tif", /*.tiff	Tagged Image File Format (TIFF)*/"image/tiff"},
-        { ".tiff", /*.tiff	Tagged Image File Format (TIFF)*/"image/tiff"},
-        { ".ts", /*MPEG transport stream*/ "video/mp2t"},
-        { ".ttf", /*TrueType Font*/ "font/ttf"},
-        { ".txt", /*Text, (generally ASCII or ISO 8859-n)*/"text/plain"},
-        { ".vsd", /*	Microsoft Visio	*/ "application/vnd.visio"},
-        { ".wav", /*Waveform Audio Format*/ "audio/wav"},
-        { ".weba", /*WEBM audio*/ "audio/webm"},
-        { ".webm", /*WEBM video*/ "video/webm"},
-        { ".webp", /*WEBP image*/ "image/webp"},
-        { ".woff", /*Web Open Font Format (WOFF)*/"font/woff"},
-        { ".woff2", /*Web Open Font Format (WOFF)*/"font/woff2"},
-        { ".xhtml", /*XHTML	*/ "application/xhtml+xml"},
-        { ".xls", /*Microsoft Excel	application/vnd*/ "ms-excel"},
-        { ".xlsx", /*Microsoft Excel (OpenXML) */	"application/vnd.openxmlformats-officedocument.spreadsheetml.sheet"},
-        { ".xml", /*  */ "application/xml"/* serves as a valid default.*/ }
-      };
+  const static mime_type_map mp = []
+  {
+    mime_type_map m;
+    m.reserve(detail::mime_entry_count);
+    for (const auto & e : detail::mime_entries)
+      m.emplace(core::string_view(e.ext), core::string_view(e.type));
+    return m;
+  }();
   return mp;
 }
 
@@ -0,0 +1,152 @@
+// Copyright (c) 2021 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_REQUESTS_IMPL_PREPARED_REQUEST_IPP
+#define BOOST_REQUESTS_IMPL_PREPARED_REQUEST_IPP
+
+#include <boost/requests/flat_headers.hpp>
+#include <boost/requests/prepared_request.hpp>
+#include <boost/beast/version.hpp>
+
+namespace boost {
+namespace requests {
+
+header_prototype::header_prototype(const http::fields & fields)
+{
+  const auto append = [this](core::string_view sv)
+  {
+    block_.append(sv.data(), sv.size());
+  };
+
+  bool have_user_agent = false;
+  for (const auto & f : fields)
+  {
+    switch (f.name())
+    {
+      case http::field::host:
+      case http::field::cookie:
+      case http::field::content_length:
+        continue; // volatile, appended per call by assemble()
+      case http::field::accept_encoding:
+        has_accept_encoding_ = true;
+        break;
+      case http::field::user_agent:
+        have_user_agent = true;
+        break;
+      default:
+        break;
+    }
+    append(f.name_string());
+    append(": ");
+    append(f.value());
+    append("\r\n");
+  }
+
+  if (!have_user_agent)
+    append("User-Agent: Requests-" BOOST_BEAST_VERSION_STRING "\r\n");
+}
+
+header_prototype::header_prototype(flat_headers & fields)
+{
+  bool have_user_agent = false;
+  bool volatile_present = false;
+  for (const auto f : fields)
+  {
+    switch (beast::http::string_to_field(f.name))
+    {
+      case http::field::host:
+      case http::field::cookie:
+      case http::field::content_length:
+        volatile_present = true; // appended per call by assemble()
+        break;
+      case http::field::accept_encoding:
+        has_accept_encoding_ = true;
+        break;
+      case http::field::user_agent:
+        have_user_agent = true;
+        break;
+      default:
+        break;
+    }
+  }
+
+  if (!volatile_present)
+  {
+    // the flat block is the wire format already
+    const auto w = fields.wire();
+    block_.assign(w.data(), w.size());
+  }
+  else
+    for (const auto f : fields)
+    {
+      switch (beast::http::string_to_field(f.name))
+      {
+        case http::field::host:
+        case http::field::cookie:
+        case http::field::content_length:
+          continue;
+        default:
+          break;
+      }
+      block_.append(f.name.data(), f.name.size());
+      block_.append(": ", 2u);
+      block_.append(f.value.data(), f.value.size());
+      block_.append("\r\n", 2u);
+    }
+
+  if (!have_user_agent)
+    block_ += "User-Agent: Requests-" BOOST_BEAST_VERSION_STRING "\r\n";
+}
+
+prepared_request::prepared_request(beast::http::verb method,
+                                   urls::url_view target,
+                                   const http::fields & fields)
+    : prepared_request(method, target, header_prototype(fields))
+{
+}
+
+prepared_request::prepared_request(beast::http::verb method,
+                                   urls::url_view target,
+                                   flat_headers & fields)
+    : prepared_request(method, target, header_prototype(fields))
+{
+}
+
+prepared_request::prepared_request(beast::http::verb method,
+                                   urls::url_view target,
+                                   const header_prototype & prototype)
+    : method_(method)
+{
+  {
+    const auto t = target.encoded_target();
+    target_.assign(t.data(), t.size());
+    if (target_.empty())
+      target_ = "/";
+  }
+
+  head_.reserve(target_.size() + prototype.block_.size() + 16u);
+  const auto vb = beast::http::to_string(method_);
+  head_.append(vb.data(), vb.size());
+  head_ += ' ';
+  head_ += target_;
+  head_.append(" HTTP/1.1\r\n", 11u);
+  head_ += prototype.block_;
+  has_accept_encoding_ = prototype.has_accept_encoding_;
+
+  switch (method_)
+  {
+    case beast::http::verb::post:
+    case beast::http::verb::put:
+    case beast::http::verb::patch:
+      needs_content_length_ = true;
+      break;
+    default:
+      break;
+  }
+}
+
+}
+}
+
+#endif // BOOST_REQUESTS_IMPL_PREPARED_REQUEST_IPP
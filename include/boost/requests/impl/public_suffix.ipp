@@ -6,6 +6,7 @@
 #define BOOST_REQUESTS_COOKIES_IMPL_PUBLIC_SUFFIX_IPP
 
 #include "boost/requests/public_suffix.hpp"
+#include <algorithm>
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/core/detail/string_view.hpp>
 #include <boost/url/grammar/alnum_chars.hpp>
@@ -16,12 +17,34 @@
 namespace boost {
 namespace requests {
 
+namespace {
+
+struct psl_entry
+{
+    const char * p;
+    std::size_t n;
+};
+
+#include "public_suffix_table.ipp"
+
+template<std::size_t N>
+bool psl_contains(const psl_entry (&table)[N], core::string_view value)
+{
+    const auto itr = std::lower_bound(
+        table, table + N, value,
+        [](const psl_entry & e, core::string_view v)
+        {
+          return core::string_view(e.p, e.n) < v;
+        });
+    return itr != (table + N) && core::string_view(itr->p, itr->n) == value;
+}
+
+}
+
 const public_suffix_list & default_public_suffix_list()
 {
-    system::error_code ec;
-    const static public_suffix_list def_list = load_public_suffix_list(
-#include "public_suffix_list.dat"
-        );
+    // just a handle to the compiled-in table, nothing to parse or allocate.
+    const static public_suffix_list def_list{{}, {}, {}, true};
     return def_list;
 }
 
@@ -71,6 +94,20 @@ public_suffix_list load_public_suffix_list(core::string_view map)
 bool is_public_suffix(core::string_view value,
                       const public_suffix_list & pse)
 {
+    if (pse.use_builtin)
+    {
+        if (psl_contains(psl_full_matches, value))
+            return true;
+
+        auto dot = value.find('.');
+
+        if (psl_contains(psl_whitelist, value))
+            return false;
+
+        auto seg1 = dot == core::string_view::npos ? "" : value.substr(dot + 1);
+        return psl_contains(psl_wildcards, seg1);
+    }
+
     if (pse.full_matches.count(value) > 0)
         return true;
 
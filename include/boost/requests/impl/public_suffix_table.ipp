@@ -0,0 +1,9478 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Generated from public_suffix_list.dat - do not edit by hand.
+// Entries are sorted bytewise so is_public_suffix can binary-search them.
+
+const psl_entry psl_full_matches[] = {
+  {"0.bg", 4u},
+  {"001www.com", 10u},
+  {"0e.vc", 5u},
+  {"1.azurestaticapps.net", 21u},
+  {"1.bg", 4u},
+  {"12hp.at", 7u},
+  {"12hp.ch", 7u},
+  {"12hp.de", 7u},
+  {"1337.pictures", 13u},
+  {"16-b.it", 7u},
+  {"1kapp.com", 9u},
+  {"2.azurestaticapps.net", 21u},
+  {"2.bg", 4u},
+  {"2000.hu", 7u},
+  {"2038.io", 7u},
+  {"2ix.at", 6u},
+  {"2ix.ch", 6u},
+  {"2ix.de", 6u},
+  {"3.bg", 4u},
+  {"32-b.it", 7u},
+  {"3utilities.com", 14u},
+  {"4.bg", 4u},
+  {"4lima.at", 8u},
+  {"4lima.ch", 8u},
+  {"4lima.de", 8u},
+  {"4u.com", 6u},
+  {"5.bg", 4u},
+  {"5g.in", 5u},
+  {"6.bg", 4u},
+  {"611.to", 6u},
+  {"64-b.it", 7u},
+  {"6g.in", 5u},
+  {"7.bg", 4u},
+  {"8.bg", 4u},
+  {"9.bg", 4u},
+  {"9guacu.br", 9u},
+  {"a.bg", 4u},
+  {"a.prod.fastly.net", 17u},
+  {"a.run.app", 9u},
+  {"a.se", 4u},
+  {"a.ssl.fastly.net", 16u},
+  {"aa.no", 5u},
+  {"aaa", 3u},
+  {"aaa.pro", 7u},
+  {"aarborte.no", 11u},
+  {"aarp", 4u},
+  {"ab.ca", 5u},
+  {"abarth", 6u},
+  {"abashiri.hokkaido.jp", 20u},
+  {"abb", 3u},
+  {"abbott", 6u},
+  {"abbvie", 6u},
+  {"abc", 3u},
+  {"abc.br", 6u},
+  {"abeno.osaka.jp", 14u},
+  {"abiko.chiba.jp", 14u},
+  {"abira.hokkaido.jp", 17u},
+  {"abkhazia.su", 11u},
+  {"able", 4u},
+  {"abo.pa", 6u},
+  {"abogado", 7u},
+  {"abr.it", 6u},
+  {"abruzzo.it", 10u},
+  {"abu.yamaguchi.jp", 16u},
+  {"abudhabi", 8u},
+  {"ac", 2u},
+  {"ac.ae", 5u},
+  {"ac.at", 5u},
+  {"ac.be", 5u},
+  {"ac.ci", 5u},
+  {"ac.cn", 5u},
+  {"ac.cr", 5u},
+  {"ac.cy", 5u},
+  {"ac.fj", 5u},
+  {"ac.gn", 5u},
+  {"ac.gov.br", 9u},
+  {"ac.id", 5u},
+  {"ac.il", 5u},
+  {"ac.im", 5u},
+  {"ac.in", 5u},
+  {"ac.ir", 5u},
+  {"ac.jp", 5u},
+  {"ac.ke", 5u},
+  {"ac.kr", 5u},
+  {"ac.leg.br", 9u},
+  {"ac.lk", 5u},
+  {"ac.ls", 5u},
+  {"ac.ma", 5u},
+  {"ac.me", 5u},
+  {"ac.mu", 5u},
+  {"ac.mw", 5u},
+  {"ac.mz", 5u},
+  {"ac.ni", 5u},
+  {"ac.nz", 5u},
+  {"ac.pa", 5u},
+  {"ac.pr", 5u},
+  {"ac.rs", 5u},
+  {"ac.ru", 5u},
+  {"ac.rw", 5u},
+  {"ac.se", 5u},
+  {"ac.sz", 5u},
+  {"ac.th", 5u},
+  {"ac.tj", 5u},
+  {"ac.tz", 5u},
+  {"ac.ug", 5u},
+  {"ac.uk", 5u},
+  {"ac.vn", 5u},
+  {"ac.za", 5u},
+  {"ac.zm", 5u},
+  {"ac.zw", 5u},
+  {"aca.pro", 7u},
+  {"academia.bo", 11u},
+  {"academy", 7u},
+  {"academy.museum", 14u},
+  {"accenture", 9u},
+  {"accesscam.org", 13u},
+  {"accident-investigation.aero", 27u},
+  {"accident-prevention.aero", 24u},
+  {"accountant", 10u},
+  {"accountants", 11u},
+  {"acct.pro", 8u},
+  {"achi.nagano.jp", 14u},
+  {"aco", 3u},
+  {"act.au", 6u},
+  {"act.edu.au", 10u},
+  {"actor", 5u},
+  {"ad", 2u},
+  {"ad.jp", 5u},
+  {"adac", 4u},
+  {"adachi.tokyo.jp", 15u},
+  {"adimo.co.uk", 11u},
+  {"adm.br", 6u},
+  {"adobeaemcloud.com", 17u},
+  {"adobeaemcloud.net", 17u},
+  {"ads", 3u},
+  {"adult", 5u},
+  {"adult.ht", 8u},
+  {"adv.br", 6u},
+  {"adv.mz", 6u},
+  {"adygeya.ru", 10u},
+  {"adygeya.su", 10u},
+  {"ae", 2u},
+  {"ae.org", 6u},
+  {"aeg", 3u},
+  {"aejrie.no", 9u},
+  {"aero", 4u},
+  {"aero.mv", 7u},
+  {"aero.tt", 7u},
+  {"aerobatic.aero", 14u},
+  {"aeroclub.aero", 13u},
+  {"aerodrome.aero", 14u},
+  {"aeroport.fr", 11u},
+  {"aetna", 5u},
+  {"af", 2u},
+  {"affinitylottery.org.uk", 22u},
+  {"afjord.no", 9u},
+  {"afl", 3u},
+  {"africa", 6u},
+  {"africa.com", 10u},
+  {"ag", 2u},
+  {"ag.it", 5u},
+  {"aga.niigata.jp", 14u},
+  {"agakhan", 7u},
+  {"agano.niigata.jp", 16u},
+  {"agdenes.no", 10u},
+  {"agematsu.nagano.jp", 18u},
+  {"agency", 6u},
+  {"agents.aero", 11u},
+  {"agr.br", 6u},
+  {"agrar.hu", 8u},
+  {"agric.za", 8u},
+  {"agriculture.museum", 18u},
+  {"agrigento.it", 12u},
+  {"agro.bo", 7u},
+  {"agro.pl", 7u},
+  {"aguni.okinawa.jp", 16u},
+  {"ah.cn", 5u},
+  {"ah.no", 5u},
+  {"ai", 2u},
+  {"ai.in", 5u},
+  {"aibetsu.hokkaido.jp", 19u},
+  {"aichi.jp", 8u},
+  {"aid.pl", 6u},
+  {"aig", 3u},
+  {"aikawa.kanagawa.jp", 18u},
+  {"ainan.ehime.jp", 14u},
+  {"aioi.hyogo.jp", 13u},
+  {"aip.ee", 6u},
+  {"air-surveillance.aero", 21u},
+  {"air-traffic-control.aero", 24u},
+  {"air.museum", 10u},
+  {"airbus", 6u},
+  {"aircraft.aero", 13u},
+  {"airforce", 8u},
+  {"airguard.museum", 15u},
+  {"airkitapps-au.com", 17u},
+  {"airkitapps.com", 14u},
+  {"airkitapps.eu", 13u},
+  {"airline.aero", 12u},
+  {"airport.aero", 12u},
+  {"airtel", 6u},
+  {"airtraffic.aero", 15u},
+  {"aisai.aichi.jp", 14u},
+  {"aisho.shiga.jp", 14u},
+  {"aivencloud.com", 14u},
+  {"aizubange.fukushima.jp", 22u},
+  {"aizumi.tokushima.jp", 19u},
+  {"aizumisato.fukushima.jp", 23u},
+  {"aizuwakamatsu.fukushima.jp", 26u},
+  {"aju.br", 6u},
+  {"ak.us", 5u},
+  {"akabira.hokkaido.jp", 19u},
+  {"akagi.shimane.jp", 16u},
+  {"akaiwa.okayama.jp", 17u},
+  {"akashi.hyogo.jp", 15u},
+  {"akdn", 4u},
+  {"aki.kochi.jp", 12u},
+  {"akiruno.tokyo.jp", 16u},
+  {"akishima.tokyo.jp", 17u},
+  {"akita.akita.jp", 14u},
+  {"akita.jp", 8u},
+  {"akkeshi.hokkaido.jp", 19u},
+  {"aknoluokta.no", 13u},
+  {"ako.hyogo.jp", 12u},
+  {"akrehamn.no", 11u},
+  {"aktyubinsk.su", 13u},
+  {"akune.kagoshima.jp", 18u},
+  {"al", 2u},
+  {"al.eu.org", 9u},
+  {"al.gov.br", 9u},
+  {"al.it", 5u},
+  {"al.leg.br", 9u},
+  {"al.no", 5u},
+  {"al.us", 5u},
+  {"alabama.museum", 14u},
+  {"alaheadju.no", 12u},
+  {"aland.fi", 8u},
+  {"alaska.museum", 13u},
+  {"alessandria.it", 14u},
+  {"alesund.no", 10u},
+  {"alfaromeo", 9u},
+  {"algard.no", 9u},
+  {"alibaba", 7u},
+  {"alipay", 6u},
+  {"allfinanz", 9u},
+  {"allstate", 8u},
+  {"ally", 4u},
+  {"alp1.ae.flow.ch", 15u},
+  {"alpha-myqnapcloud.com", 21u},
+  {"alpha.bounty-full.com", 21u},
+  {"alsace", 6u},
+  {"alstahaug.no", 12u},
+  {"alstom", 6u},
+  {"alt.za", 6u},
+  {"alta.no", 7u},
+  {"altervista.org", 14u},
+  {"alto-adige.it", 13u},
+  {"altoadige.it", 12u},
+  {"alvdal.no", 9u},
+  {"alwaysdata.net", 14u},
+  {"am", 2u},
+  {"am.br", 5u},
+  {"am.gov.br", 9u},
+  {"am.in", 5u},
+  {"am.leg.br", 9u},
+  {"ama.aichi.jp", 12u},
+  {"ama.shimane.jp", 14u},
+  {"amagasaki.hyogo.jp", 18u},
+  {"amakusa.kumamoto.jp", 19u},
+  {"amami.kagoshima.jp", 18u},
+  {"amazon", 6u},
+  {"amber.museum", 12u},
+  {"ambulance.aero", 14u},
+  {"ambulance.museum", 16u},
+  {"american.museum", 15u},
+  {"americana.museum", 16u},
+  {"americanantiques.museum", 23u},
+  {"americanart.museum", 18u},
+  {"americanexpress", 15u},
+  {"americanfamily", 14u},
+  {"amex", 4u},
+  {"amfam", 5u},
+  {"ami.ibaraki.jp", 14u},
+  {"amica", 5u},
+  {"amli.no", 7u},
+  {"amot.no", 7u},
+  {"amscompute.com", 14u},
+  {"amsterdam", 9u},
+  {"amsterdam.museum", 16u},
+  {"amusement.aero", 14u},
+  {"an.it", 5u},
+  {"analytics", 9u},
+  {"anamizu.ishikawa.jp", 19u},
+  {"anan.nagano.jp", 14u},
+  {"anan.tokushima.jp", 17u},
+  {"anani.br", 8u},
+  {"ancona.it", 9u},
+  {"and.mom", 7u},
+  {"and.museum", 10u},
+  {"andasuolo.no", 12u},
+  {"andebu.no", 9u},
+  {"ando.nara.jp", 12u},
+  {"andoy.no", 8u},
+  {"andria-barletta-trani.it", 24u},
+  {"andria-trani-barletta.it", 24u},
+  {"andriabarlettatrani.it", 22u},
+  {"andriatranibarletta.it", 22u},
+  {"android", 7u},
+  {"and\303\270y.no", 9u},
+  {"angry.jp", 8u},
+  {"anjo.aichi.jp", 13u},
+  {"ann-arbor.mi.us", 15u},
+  {"annaka.gunma.jp", 15u},
+  {"annefrank.museum", 16u},
+  {"anpachi.gifu.jp", 15u},
+  {"anquan", 6u},
+  {"anthro.museum", 13u},
+  {"anthropology.museum", 19u},
+  {"antiques.museum", 15u},
+  {"anz", 3u},
+  {"ao", 2u},
+  {"ao.it", 5u},
+  {"aogaki.hyogo.jp", 15u},
+  {"aogashima.tokyo.jp", 18u},
+  {"aoki.nagano.jp", 14u},
+  {"aol", 3u},
+  {"aomori.aomori.jp", 16u},
+  {"aomori.jp", 9u},
+  {"aosta-valley.it", 15u},
+  {"aosta.it", 8u},
+  {"aostavalley.it", 14u},
+  {"aoste.it", 8u},
+  {"ap-northeast-1.elasticbeanstalk.com", 35u},
+  {"ap-northeast-2.elasticbeanstalk.com", 35u},
+  {"ap-northeast-3.elasticbeanstalk.com", 35u},
+  {"ap-south-1.elasticbeanstalk.com", 31u},
+  {"ap-southeast-1.elasticbeanstalk.com", 35u},
+  {"ap-southeast-2.elasticbeanstalk.com", 35u},
+  {"ap.gov.br", 9u},
+  {"ap.gov.pl", 9u},
+  {"ap.it", 5u},
+  {"ap.leg.br", 9u},
+  {"aparecida.br", 12u},
+  {"apartments", 10u},
+  {"api.gov.uk", 10u},
+  {"api.stdlib.com", 14u},
+  {"apigee.io", 9u},
+  {"app", 3u},
+  {"app.banzaicloud.io", 18u},
+  {"app.br", 6u},
+  {"app.gp", 6u},
+  {"app.lmpm.com", 12u},
+  {"app.os.fedoraproject.org", 24u},
+  {"app.os.stg.fedoraproject.org", 28u},
+  {"app.render.com", 14u},
+  {"appchizi.com", 12u},
+  {"appengine.flow.ch", 17u},
+  {"apple", 5u},
+  {"applinzi.com", 12u},
+  {"apps.fbsbx.com", 14u},
+  {"apps.lair.io", 12u},
+  {"appspacehosted.com", 18u},
+  {"appspaceusercontent.com", 23u},
+  {"appspot.com", 11u},
+  {"appudo.net", 10u},
+  {"aq", 2u},
+  {"aq.it", 5u},
+  {"aquarelle", 9u},
+  {"aquarium.museum", 15u},
+  {"aquila.it", 9u},
+  {"ar", 2u},
+  {"ar.com", 6u},
+  {"ar.it", 5u},
+  {"ar.us", 5u},
+  {"arab", 4u},
+  {"arai.shizuoka.jp", 16u},
+  {"arakawa.saitama.jp", 18u},
+  {"arakawa.tokyo.jp", 16u},
+  {"aramco", 6u},
+  {"arao.kumamoto.jp", 16u},
+  {"arboretum.museum", 16u},
+  {"archaeological.museum", 21u},
+  {"archaeology.museum", 18u},
+  {"archi", 5u},
+  {"architecture.museum", 19u},
+  {"ardal.no", 8u},
+  {"aremark.no", 10u},
+  {"arendal.no", 10u},
+  {"arezzo.it", 9u},
+  {"ariake.saga.jp", 14u},
+  {"arida.wakayama.jp", 17u},
+  {"aridagawa.wakayama.jp", 21u},
+  {"arita.saga.jp", 13u},
+  {"arkhangelsk.su", 14u},
+  {"armenia.su", 10u},
+  {"army", 4u},
+  {"arna.no", 7u},
+  {"arpa", 4u},
+  {"arq.br", 6u},
+  {"art", 3u},
+  {"art.br", 6u},
+  {"art.do", 6u},
+  {"art.dz", 6u},
+  {"art.ht", 6u},
+  {"art.museum", 10u},
+  {"art.pl", 6u},
+  {"art.sn", 6u},
+  {"artanddesign.museum", 19u},
+  {"artcenter.museum", 16u},
+  {"artdeco.museum", 14u},
+  {"arte", 4u},
+  {"arte.bo", 7u},
+  {"arteducation.museum", 19u},
+  {"artgallery.museum", 17u},
+  {"arts.co", 7u},
+  {"arts.museum", 11u},
+  {"arts.nf", 7u},
+  {"arts.ro", 7u},
+  {"arts.ve", 7u},
+  {"artsandcrafts.museum", 20u},
+  {"arvo.network", 12u},
+  {"as", 2u},
+  {"as.us", 5u},
+  {"asago.hyogo.jp", 14u},
+  {"asahi.chiba.jp", 14u},
+  {"asahi.ibaraki.jp", 16u},
+  {"asahi.mie.jp", 12u},
+  {"asahi.nagano.jp", 15u},
+  {"asahi.toyama.jp", 15u},
+  {"asahi.yamagata.jp", 17u},
+  {"asahikawa.hokkaido.jp", 21u},
+  {"asaka.saitama.jp", 16u},
+  {"asakawa.fukushima.jp", 20u},
+  {"asakuchi.okayama.jp", 19u},
+  {"asaminami.hiroshima.jp", 22u},
+  {"ascoli-piceno.it", 16u},
+  {"ascolipiceno.it", 15u},
+  {"asda", 4u},
+  {"aseral.no", 9u},
+  {"ashgabad.su", 11u},
+  {"ashibetsu.hokkaido.jp", 21u},
+  {"ashikaga.tochigi.jp", 19u},
+  {"ashiya.fukuoka.jp", 17u},
+  {"ashiya.hyogo.jp", 15u},
+  {"ashoro.hokkaido.jp", 18u},
+  {"asia", 4u},
+  {"asker.no", 8u},
+  {"askim.no", 8u},
+  {"askoy.no", 8u},
+  {"askvoll.no", 10u},
+  {"ask\303\270y.no", 9u},
+  {"asmatart.museum", 15u},
+  {"asn.au", 6u},
+  {"asn.lv", 6u},
+  {"asnes.no", 8u},
+  {"aso.kumamoto.jp", 15u},
+  {"ass.km", 6u},
+  {"assabu.hokkaido.jp", 18u},
+  {"assassination.museum", 20u},
+  {"assisi.museum", 13u},
+  {"assn.lk", 7u},
+  {"asso.bj", 7u},
+  {"asso.ci", 7u},
+  {"asso.dz", 7u},
+  {"asso.eu.org", 11u},
+  {"asso.fr", 7u},
+  {"asso.gp", 7u},
+  {"asso.ht", 7u},
+  {"asso.km", 7u},
+  {"asso.mc", 7u},
+  {"asso.nc", 7u},
+  {"asso.re", 7u},
+  {"associates", 10u},
+  {"association.aero", 16u},
+  {"association.museum", 18u},
+  {"asti.it", 7u},
+  {"astronomy.museum", 16u},
+  {"asuke.aichi.jp", 14u},
+  {"at", 2u},
+  {"at-band-camp.net", 16u},
+  {"at.eu.org", 9u},
+  {"at.it", 5u},
+  {"at.md", 5u},
+  {"at.vg", 5u},
+  {"atami.shizuoka.jp", 17u},
+  {"ath.cx", 6u},
+  {"athleta", 7u},
+  {"atl.jelastic.vps-host.net", 25u},
+  {"atlanta.museum", 14u},
+  {"atm.pl", 6u},
+  {"ato.br", 6u},
+  {"atsugi.kanagawa.jp", 18u},
+  {"atsuma.hokkaido.jp", 18u},
+  {"attorney", 8u},
+  {"au", 2u},
+  {"au.eu.org", 9u},
+  {"auction", 7u},
+  {"audi", 4u},
+  {"audible", 7u},
+  {"audio", 5u},
+  {"audnedaln.no", 12u},
+  {"augustow.pl", 11u},
+  {"aukra.no", 8u},
+  {"aure.no", 7u},
+  {"aurland.no", 10u},
+  {"aurskog-holand.no", 17u},
+  {"aurskog-h\303\270land.no", 18u},
+  {"aus.basketball", 14u},
+  {"auspost", 7u},
+  {"austevoll.no", 12u},
+  {"austin.museum", 13u},
+  {"australia.museum", 16u},
+  {"austrheim.no", 12u},
+  {"authgear-staging.com", 20u},
+  {"authgearapps.com", 16u},
+  {"author", 6u},
+  {"author.aero", 11u},
+  {"auto", 4u},
+  {"auto.pl", 7u},
+  {"automotive.museum", 17u},
+  {"autos", 5u},
+  {"av.it", 5u},
+  {"av.tr", 5u},
+  {"avellino.it", 11u},
+  {"averoy.no", 9u},
+  {"aver\303\270y.no", 10u},
+  {"avianca", 7u},
+  {"aviation.museum", 15u},
+  {"avocat.fr", 9u},
+  {"avocat.pro", 10u},
+  {"avoues.fr", 9u},
+  {"aw", 2u},
+  {"awaji.hyogo.jp", 14u},
+  {"aws", 3u},
+  {"awsglobalaccelerator.com", 24u},
+  {"awsmppl.com", 11u},
+  {"ax", 2u},
+  {"axa", 3u},
+  {"axis.museum", 11u},
+  {"aya.miyazaki.jp", 15u},
+  {"ayabe.kyoto.jp", 14u},
+  {"ayagawa.kagawa.jp", 17u},
+  {"ayase.kanagawa.jp", 17u},
+  {"az", 2u},
+  {"az.us", 5u},
+  {"azerbaijan.su", 13u},
+  {"azimuth.network", 15u},
+  {"azumino.nagano.jp", 17u},
+  {"azure", 5u},
+  {"azure-mobile.net", 16u},
+  {"azurestaticapps.net", 19u},
+  {"azurewebsites.net", 17u},
+  {"a\303\251roport.ci", 12u},
+  {"b-data.io", 9u},
+  {"b.bg", 4u},
+  {"b.br", 4u},
+  {"b.se", 4u},
+  {"b.ssl.fastly.net", 16u},
+  {"ba", 2u},
+  {"ba.gov.br", 9u},
+  {"ba.it", 5u},
+  {"ba.leg.br", 9u},
+  {"babia-gora.pl", 13u},
+  {"baby", 4u},
+  {"babyblue.jp", 11u},
+  {"babymilk.jp", 11u},
+  {"backdrop.jp", 11u},
+  {"backplaneapp.io", 15u},
+  {"badaddja.no", 11u},
+  {"badajoz.museum", 14u},
+  {"baghdad.museum", 14u},
+  {"bahcavuotna.no", 14u},
+  {"bahccavuotna.no", 15u},
+  {"bahn.museum", 11u},
+  {"baidar.no", 9u},
+  {"baidu", 5u},
+  {"bajddar.no", 10u},
+  {"balashov.su", 11u},
+  {"balat.no", 8u},
+  {"bale.museum", 11u},
+  {"balena-devices.com", 18u},
+  {"balestrand.no", 13u},
+  {"ballangen.no", 12u},
+  {"ballooning.aero", 15u},
+  {"balsan-sudtirol.it", 18u},
+  {"balsan-suedtirol.it", 19u},
+  {"balsan-s\303\274dtirol.it", 19u},
+  {"balsan.it", 9u},
+  {"balsfjord.no", 12u},
+  {"baltimore.museum", 16u},
+  {"bambina.jp", 10u},
+  {"bamble.no", 9u},
+  {"banamex", 7u},
+  {"bananarepublic", 14u},
+  {"band", 4u},
+  {"bandai.fukushima.jp", 19u},
+  {"bando.ibaraki.jp", 16u},
+  {"bank", 4u},
+  {"bar", 3u},
+  {"bar.pro", 7u},
+  {"bar0.net", 8u},
+  {"bar1.net", 8u},
+  {"bar2.net", 8u},
+  {"barcelona", 9u},
+  {"barcelona.museum", 16u},
+  {"barclaycard", 11u},
+  {"barclays", 8u},
+  {"bardu.no", 8u},
+  {"barefoot", 8u},
+  {"bargains", 8u},
+  {"bari.it", 7u},
+  {"barletta-trani-andria.it", 24u},
+  {"barlettatraniandria.it", 22u},
+  {"barreau.bj", 10u},
+  {"barrel-of-knowledge.info", 24u},
+  {"barrell-of-knowledge.info", 25u},
+  {"barsy.bg", 8u},
+  {"barsy.ca", 8u},
+  {"barsy.club", 10u},
+  {"barsy.co.uk", 11u},
+  {"barsy.de", 8u},
+  {"barsy.eu", 8u},
+  {"barsy.in", 8u},
+  {"barsy.info", 10u},
+  {"barsy.io", 8u},
+  {"barsy.me", 8u},
+  {"barsy.menu", 10u},
+  {"barsy.mobi", 10u},
+  {"barsy.net", 9u},
+  {"barsy.online", 12u},
+  {"barsy.org", 9u},
+  {"barsy.pro", 9u},
+  {"barsy.pub", 9u},
+  {"barsy.ro", 8u},
+  {"barsy.shop", 10u},
+  {"barsy.site", 10u},
+  {"barsy.support", 13u},
+  {"barsy.uk", 8u},
+  {"barsycenter.com", 15u},
+  {"barsyonline.co.uk", 17u},
+  {"barsyonline.com", 15u},
+  {"barueri.br", 10u},
+  {"barum.no", 8u},
+  {"bas.it", 6u},
+  {"base.ec", 7u},
+  {"base.shop", 9u},
+  {"baseball", 8u},
+  {"baseball.museum", 15u},
+  {"basel.museum", 12u},
+  {"bashkiria.ru", 12u},
+  {"bashkiria.su", 12u},
+  {"basicserver.io", 14u},
+  {"basilicata.it", 13u},
+  {"basketball", 10u},
+  {"baths.museum", 12u},
+  {"bato.tochigi.jp", 15u},
+  {"batsfjord.no", 12u},
+  {"bauern.museum", 13u},
+  {"bauhaus", 7u},
+  {"bayern", 6u},
+  {"bb", 2u},
+  {"bbc", 3u},
+  {"bbs.tr", 6u},
+  {"bbt", 3u},
+  {"bbva", 4u},
+  {"bc.ca", 5u},
+  {"bc.platform.sh", 14u},
+  {"bcg", 3u},
+  {"bci.dnstrace.pro", 16u},
+  {"bcn", 3u},
+  {"bd.se", 5u},
+  {"be", 2u},
+  {"be.ax", 5u},
+  {"be.eu.org", 9u},
+  {"be.gy", 5u},
+  {"beagleboard.io", 14u},
+  {"bearalvahki.no", 14u},
+  {"bearalv\303\241hki.no", 15u},
+  {"beardu.no", 9u},
+  {"beats", 5u},
+  {"beauty", 6u},
+  {"beauxarts.museum", 16u},
+  {"bedzin.pl", 9u},
+  {"beeldengeluid.museum", 20u},
+  {"beep.pl", 7u},
+  {"beer", 4u},
+  {"beiarn.no", 9u},
+  {"bel.tr", 6u},
+  {"belau.pw", 8u},
+  {"belem.br", 8u},
+  {"bellevue.museum", 15u},
+  {"belluno.it", 10u},
+  {"benevento.it", 12u},
+  {"bentley", 7u},
+  {"beppu.oita.jp", 13u},
+  {"berg.no", 7u},
+  {"bergamo.it", 10u},
+  {"bergbau.museum", 14u},
+  {"bergen.no", 9u},
+  {"berkeley.museum", 15u},
+  {"berlevag.no", 11u},
+  {"berlev\303\245g.no", 12u},
+  {"berlin", 6u},
+  {"berlin.museum", 13u},
+  {"bern.museum", 11u},
+  {"beskidy.pl", 10u},
+  {"best", 4u},
+  {"bestbuy", 7u},
+  {"bet", 3u},
+  {"bet.ar", 6u},
+  {"beta.bounty-full.com", 20u},
+  {"beta.tailscale.net", 18u},
+  {"betainabox.com", 14u},
+  {"better-than.tv", 14u},
+  {"bf", 2u},
+  {"bg", 2u},
+  {"bg.eu.org", 9u},
+  {"bg.it", 5u},
+  {"bh", 2u},
+  {"bharti", 6u},
+  {"bhz.br", 6u},
+  {"bi", 2u},
+  {"bi.it", 5u},
+  {"bialowieza.pl", 13u},
+  {"bialystok.pl", 12u},
+  {"bib.br", 6u},
+  {"bib.ve", 6u},
+  {"bibai.hokkaido.jp", 17u},
+  {"bible", 5u},
+  {"bible.museum", 12u},
+  {"bid", 3u},
+  {"biei.hokkaido.jp", 16u},
+  {"bielawa.pl", 10u},
+  {"biella.it", 9u},
+  {"bieszczady.pl", 13u},
+  {"bievat.no", 9u},
+  {"biev\303\241t.no", 10u},
+  {"bifuka.hokkaido.jp", 18u},
+  {"bihar.in", 8u},
+  {"bihoro.hokkaido.jp", 18u},
+  {"bike", 4u},
+  {"bilbao.museum", 13u},
+  {"bill.museum", 11u},
+  {"bindal.no", 9u},
+  {"bing", 4u},
+  {"bingo", 5u},
+  {"bio", 3u},
+  {"bio.br", 6u},
+  {"bip.sh", 6u},
+  {"bir.ru", 6u},
+  {"biratori.hokkaido.jp", 20u},
+  {"birdart.museum", 14u},
+  {"birkenes.no", 11u},
+  {"birthplace.museum", 17u},
+  {"bitbridge.net", 13u},
+  {"bitbucket.io", 12u},
+  {"bitter.jp", 9u},
+  {"biz", 3u},
+  {"biz.at", 6u},
+  {"biz.az", 6u},
+  {"biz.bb", 6u},
+  {"biz.cy", 6u},
+  {"biz.dk", 6u},
+  {"biz.et", 6u},
+  {"biz.fj", 6u},
+  {"biz.gl", 6u},
+  {"biz.id", 6u},
+  {"biz.in", 6u},
+  {"biz.ki", 6u},
+  {"biz.ls", 6u},
+  {"biz.mv", 6u},
+  {"biz.mw", 6u},
+  {"biz.my", 6u},
+  {"biz.ni", 6u},
+  {"biz.nr", 6u},
+  {"biz.pk", 6u},
+  {"biz.pl", 6u},
+  {"biz.pr", 6u},
+  {"biz.ss", 6u},
+  {"biz.tj", 6u},
+  {"biz.tr", 6u},
+  {"biz.tt", 6u},
+  {"biz.ua", 6u},
+  {"biz.vn", 6u},
+  {"biz.wf", 6u},
+  {"biz.zm", 6u},
+  {"bizen.okayama.jp", 16u},
+  {"bj", 2u},
+  {"bj.cn", 5u},
+  {"bjarkoy.no", 10u},
+  {"bjark\303\270y.no", 11u},
+  {"bjerkreim.no", 12u},
+  {"bjugn.no", 8u},
+  {"bl.it", 5u},
+  {"black", 5u},
+  {"blackbaudcdn.net", 16u},
+  {"blackfriday", 11u},
+  {"blockbuster", 11u},
+  {"blog", 4u},
+  {"blog.bo", 7u},
+  {"blog.br", 7u},
+  {"blog.gt", 7u},
+  {"blog.kg", 7u},
+  {"blog.vu", 7u},
+  {"blogdns.com", 11u},
+  {"blogdns.net", 11u},
+  {"blogdns.org", 11u},
+  {"blogsite.org", 12u},
+  {"blogsite.xyz", 12u},
+  {"blogspot.ae", 11u},
+  {"blogspot.al", 11u},
+  {"blogspot.am", 11u},
+  {"blogspot.ba", 11u},
+  {"blogspot.be", 11u},
+  {"blogspot.bg", 11u},
+  {"blogspot.bj", 11u},
+  {"blogspot.ca", 11u},
+  {"blogspot.cf", 11u},
+  {"blogspot.ch", 11u},
+  {"blogspot.cl", 11u},
+  {"blogspot.co.at", 14u},
+  {"blogspot.co.id", 14u},
+  {"blogspot.co.il", 14u},
+  {"blogspot.co.ke", 14u},
+  {"blogspot.co.nz", 14u},
+  {"blogspot.co.uk", 14u},
+  {"blogspot.co.za", 14u},
+  {"blogspot.com", 12u},
+  {"blogspot.com.ar", 15u},
+  {"blogspot.com.au", 15u},
+  {"blogspot.com.br", 15u},
+  {"blogspot.com.by", 15u},
+  {"blogspot.com.co", 15u},
+  {"blogspot.com.cy", 15u},
+  {"blogspot.com.ee", 15u},
+  {"blogspot.com.eg", 15u},
+  {"blogspot.com.es", 15u},
+  {"blogspot.com.mt", 15u},
+  {"blogspot.com.ng", 15u},
+  {"blogspot.com.tr", 15u},
+  {"blogspot.com.uy", 15u},
+  {"blogspot.cv", 11u},
+  {"blogspot.cz", 11u},
+  {"blogspot.de", 11u},
+  {"blogspot.dk", 11u},
+  {"blogspot.fi", 11u},
+  {"blogspot.fr", 11u},
+  {"blogspot.gr", 11u},
+  {"blogspot.hk", 11u},
+  {"blogspot.hr", 11u},
+  {"blogspot.hu", 11u},
+  {"blogspot.ie", 11u},
+  {"blogspot.in", 11u},
+  {"blogspot.is", 11u},
+  {"blogspot.it", 11u},
+  {"blogspot.jp", 11u},
+  {"blogspot.kr", 11u},
+  {"blogspot.li", 11u},
+  {"blogspot.lt", 11u},
+  {"blogspot.lu", 11u},
+  {"blogspot.md", 11u},
+  {"blogspot.mk", 11u},
+  {"blogspot.mr", 11u},
+  {"blogspot.mx", 11u},
+  {"blogspot.my", 11u},
+  {"blogspot.nl", 11u},
+  {"blogspot.no", 11u},
+  {"blogspot.pe", 11u},
+  {"blogspot.pt", 11u},
+  {"blogspot.qa", 11u},
+  {"blogspot.re", 11u},
+  {"blogspot.ro", 11u},
+  {"blogspot.rs", 11u},
+  {"blogspot.ru", 11u},
+  {"blogspot.se", 11u},
+  {"blogspot.sg", 11u},
+  {"blogspot.si", 11u},
+  {"blogspot.sk", 11u},
+  {"blogspot.sn", 11u},
+  {"blogspot.td", 11u},
+  {"blogspot.tw", 11u},
+  {"blogspot.ug", 11u},
+  {"blogspot.vn", 11u},
+  {"blogsyte.com", 12u},
+  {"bloomberg", 9u},
+  {"bloxcms.com", 11u},
+  {"blue", 4u},
+  {"bluebite.io", 11u},
+  {"blush.jp", 8u},
+  {"bm", 2u},
+  {"bmd.br", 6u},
+  {"bmoattachments.org", 18u},
+  {"bms", 3u},
+  {"bmw", 3u},
+  {"bn", 2u},
+  {"bn.it", 5u},
+  {"bnpparibas", 10u},
+  {"bnr.la", 6u},
+  {"bo", 2u},
+  {"bo.it", 5u},
+  {"bo.nordland.no", 14u},
+  {"bo.telemark.no", 14u},
+  {"boats", 5u},
+  {"boavista.br", 11u},
+  {"bodo.no", 7u},
+  {"bod\303\270.no", 8u},
+  {"boehringer", 10u},
+  {"bofa", 4u},
+  {"bokn.no", 7u},
+  {"boldlygoingnowhere.org", 22u},
+  {"boleslawiec.pl", 14u},
+  {"bolivia.bo", 10u},
+  {"bologna.it", 10u},
+  {"bolt.hu", 7u},
+  {"bolzano-altoadige.it", 20u},
+  {"bolzano.it", 10u},
+  {"bom", 3u},
+  {"bomlo.no", 8u},
+  {"bond", 4u},
+  {"bonn.museum", 11u},
+  {"boo", 3u},
+  {"boo.jp", 6u},
+  {"book", 4u},
+  {"booking", 7u},
+  {"bookonline.app", 14u},
+  {"boomla.net", 10u},
+  {"bosch", 5u},
+  {"bostik", 6u},
+  {"boston", 6u},
+  {"boston.museum", 13u},
+  {"bot", 3u},
+  {"botanical.museum", 16u},
+  {"botanicalgarden.museum", 22u},
+  {"botanicgarden.museum", 20u},
+  {"botany.museum", 13u},
+  {"bounceme.net", 12u},
+  {"bounty-full.com", 15u},
+  {"boutique", 8u},
+  {"boutir.com", 10u},
+  {"box", 3u},
+  {"boxfuse.io", 10u},
+  {"boy.jp", 6u},
+  {"boyfriend.jp", 12u},
+  {"bozen-sudtirol.it", 17u},
+  {"bozen-suedtirol.it", 18u},
+  {"bozen-s\303\274dtirol.it", 18u},
+  {"bozen.it", 8u},
+  {"bplaced.com", 11u},
+  {"bplaced.de", 10u},
+  {"bplaced.net", 11u},
+  {"br", 2u},
+  {"br.com", 6u},
+  {"br.it", 5u},
+  {"bradesco", 8u},
+  {"brand.se", 8u},
+  {"brandywinevalley.museum", 23u},
+  {"brasil.museum", 13u},
+  {"brasilia.me", 11u},
+  {"bremanger.no", 12u},
+  {"brescia.it", 10u},
+  {"bridgestone", 11u},
+  {"brindisi.it", 11u},
+  {"bristol.museum", 14u},
+  {"british.museum", 14u},
+  {"britishcolumbia.museum", 22u},
+  {"broadcast.museum", 16u},
+  {"broadway", 8u},
+  {"broke-it.net", 12u},
+  {"broker", 6u},
+  {"broker.aero", 11u},
+  {"bronnoy.no", 10u},
+  {"bronnoysund.no", 14u},
+  {"brother", 7u},
+  {"browsersafetymark.io", 20u},
+  {"brumunddal.no", 13u},
+  {"brunel.museum", 13u},
+  {"brussel.museum", 14u},
+  {"brussels", 8u},
+  {"brussels.museum", 15u},
+  {"bruxelles.museum", 16u},
+  {"bryansk.su", 10u},
+  {"bryne.no", 8u},
+  {"br\303\270nn\303\270y.no", 12u},
+  {"br\303\270nn\303\270ysund.no", 16u},
+  {"bs", 2u},
+  {"bs.it", 5u},
+  {"bsb.br", 6u},
+  {"bss.design", 10u},
+  {"bt", 2u},
+  {"bt.it", 5u},
+  {"bu.no", 5u},
+  {"budejju.no", 10u},
+  {"bugatti", 7u},
+  {"build", 5u},
+  {"builders", 8u},
+  {"building.museum", 15u},
+  {"builtwithdark.com", 17u},
+  {"bukhara.su", 10u},
+  {"bulsan-sudtirol.it", 18u},
+  {"bulsan-suedtirol.it", 19u},
+  {"bulsan-s\303\274dtirol.it", 19u},
+  {"bulsan.it", 9u},
+  {"bungoono.oita.jp", 16u},
+  {"bungotakada.oita.jp", 19u},
+  {"bunkyo.tokyo.jp", 15u},
+  {"burghof.museum", 14u},
+  {"bus.museum", 10u},
+  {"busan.kr", 8u},
+  {"bushey.museum", 13u},
+  {"business", 8u},
+  {"business.in", 11u},
+  {"but.jp", 6u},
+  {"buy", 3u},
+  {"buyshop.jp", 10u},
+  {"buyshouses.net", 14u},
+  {"buzen.fukuoka.jp", 16u},
+  {"buzz", 4u},
+  {"bv", 2u},
+  {"bw", 2u},
+  {"by", 2u},
+  {"bydgoszcz.pl", 12u},
+  {"byen.site", 9u},
+  {"bygland.no", 10u},
+  {"bykle.no", 8u},
+  {"bytom.pl", 8u},
+  {"bz", 2u},
+  {"bz.it", 5u},
+  {"bzh", 3u},
+  {"b\303\241hcavuotna.no", 15u},
+  {"b\303\241hccavuotna.no", 16u},
+  {"b\303\241id\303\241r.no", 11u},
+  {"b\303\241jddar.no", 11u},
+  {"b\303\241l\303\241t.no", 10u},
+  {"b\303\245d\303\245ddj\303\245.no", 14u},
+  {"b\303\245tsfjord.no", 13u},
+  {"b\303\246rum.no", 9u},
+  {"b\303\270.nordland.no", 15u},
+  {"b\303\270.telemark.no", 15u},
+  {"b\303\270mlo.no", 9u},
+  {"c.bg", 4u},
+  {"c.cdn77.org", 11u},
+  {"c.la", 4u},
+  {"c.se", 4u},
+  {"c66.me", 6u},
+  {"ca", 2u},
+  {"ca-central-1.elasticbeanstalk.com", 33u},
+  {"ca.eu.org", 9u},
+  {"ca.in", 5u},
+  {"ca.it", 5u},
+  {"ca.na", 5u},
+  {"ca.reclaim.cloud", 16u},
+  {"ca.us", 5u},
+  {"caa.aero", 8u},
+  {"caa.li", 6u},
+  {"cab", 3u},
+  {"cable-modem.org", 15u},
+  {"cadaques.museum", 15u},
+  {"cafe", 4u},
+  {"cafjs.com", 9u},
+  {"cagliari.it", 11u},
+  {"cahcesuolo.no", 13u},
+  {"cal", 3u},
+  {"cal.it", 6u},
+  {"calabria.it", 11u},
+  {"california.museum", 17u},
+  {"call", 4u},
+  {"caltanissetta.it", 16u},
+  {"calvinklein", 11u},
+  {"cam", 3u},
+  {"cam.it", 6u},
+  {"cambridge.museum", 16u},
+  {"camdvr.org", 10u},
+  {"camera", 6u},
+  {"camp", 4u},
+  {"campaign.gov.uk", 15u},
+  {"campania.it", 11u},
+  {"campidano-medio.it", 18u},
+  {"campidanomedio.it", 17u},
+  {"campinagrande.br", 16u},
+  {"campinas.br", 11u},
+  {"campobasso.it", 13u},
+  {"can.museum", 10u},
+  {"canada.museum", 13u},
+  {"cancerresearch", 14u},
+  {"candypop.jp", 11u},
+  {"canon", 5u},
+  {"capebreton.museum", 17u},
+  {"capetown", 8u},
+  {"capital", 7u},
+  {"capitalone", 10u},
+  {"capoo.jp", 8u},
+  {"car", 3u},
+  {"caracal.mythic-beasts.com", 25u},
+  {"caravan", 7u},
+  {"carbonia-iglesias.it", 20u},
+  {"carboniaiglesias.it", 19u},
+  {"cards", 5u},
+  {"care", 4u},
+  {"career", 6u},
+  {"careers", 7u},
+  {"cargo.aero", 10u},
+  {"carrara-massa.it", 16u},
+  {"carraramassa.it", 15u},
+  {"carrd.co", 8u},
+  {"carrier.museum", 14u},
+  {"cars", 4u},
+  {"cartoonart.museum", 17u},
+  {"casa", 4u},
+  {"casacam.net", 11u},
+  {"casadelamoneda.museum", 21u},
+  {"case", 4u},
+  {"caserta.it", 10u},
+  {"cash", 4u},
+  {"casino", 6u},
+  {"casino.hu", 9u},
+  {"castle.museum", 13u},
+  {"castres.museum", 14u},
+  {"cat", 3u},
+  {"cat.ax", 6u},
+  {"catania.it", 10u},
+  {"catanzaro.it", 12u},
+  {"catering", 8u},
+  {"catering.aero", 13u},
+  {"catfood.jp", 10u},
+  {"catholic", 8u},
+  {"catholic.edu.au", 15u},
+  {"caxias.br", 9u},
+  {"cb.it", 5u},
+  {"cba", 3u},
+  {"cbg.ru", 6u},
+  {"cbn", 3u},
+  {"cbre", 4u},
+  {"cbs", 3u},
+  {"cc", 2u},
+  {"cc.ak.us", 8u},
+  {"cc.al.us", 8u},
+  {"cc.ar.us", 8u},
+  {"cc.as.us", 8u},
+  {"cc.az.us", 8u},
+  {"cc.ca.us", 8u},
+  {"cc.co.us", 8u},
+  {"cc.ct.us", 8u},
+  {"cc.dc.us", 8u},
+  {"cc.de.us", 8u},
+  {"cc.fl.us", 8u},
+  {"cc.ga.us", 8u},
+  {"cc.gu.us", 8u},
+  {"cc.hi.us", 8u},
+  {"cc.hn", 5u},
+  {"cc.ia.us", 8u},
+  {"cc.id.us", 8u},
+  {"cc.il.us", 8u},
+  {"cc.in.us", 8u},
+  {"cc.ks.us", 8u},
+  {"cc.ky.us", 8u},
+  {"cc.la.us", 8u},
+  {"cc.ma.us", 8u},
+  {"cc.md.us", 8u},
+  {"cc.me.us", 8u},
+  {"cc.mi.us", 8u},
+  {"cc.mn.us", 8u},
+  {"cc.mo.us", 8u},
+  {"cc.ms.us", 8u},
+  {"cc.mt.us", 8u},
+  {"cc.na", 5u},
+  {"cc.nc.us", 8u},
+  {"cc.nd.us", 8u},
+  {"cc.ne.us", 8u},
+  {"cc.nh.us", 8u},
+  {"cc.nj.us", 8u},
+  {"cc.nm.us", 8u},
+  {"cc.nv.us", 8u},
+  {"cc.ny.us", 8u},
+  {"cc.oh.us", 8u},
+  {"cc.ok.us", 8u},
+  {"cc.or.us", 8u},
+  {"cc.pa.us", 8u},
+  {"cc.pr.us", 8u},
+  {"cc.ri.us", 8u},
+  {"cc.sc.us", 8u},
+  {"cc.sd.us", 8u},
+  {"cc.tn.us", 8u},
+  {"cc.tx.us", 8u},
+  {"cc.ua", 5u},
+  {"cc.ut.us", 8u},
+  {"cc.va.us", 8u},
+  {"cc.vi.us", 8u},
+  {"cc.vt.us", 8u},
+  {"cc.wa.us", 8u},
+  {"cc.wi.us", 8u},
+  {"cc.wv.us", 8u},
+  {"cc.wy.us", 8u},
+  {"cci.fr", 6u},
+  {"cd", 2u},
+  {"cd.eu.org", 9u},
+  {"cdn-edges.net", 13u},
+  {"cdn.prod.atlassian-dev.net", 26u},
+  {"cdn77-ssl.net", 13u},
+  {"ce.gov.br", 9u},
+  {"ce.it", 5u},
+  {"ce.leg.br", 9u},
+  {"cechire.com", 11u},
+  {"celtic.museum", 13u},
+  {"center", 6u},
+  {"center.museum", 13u},
+  {"centralus.azurestaticapps.net", 29u},
+  {"ceo", 3u},
+  {"cern", 4u},
+  {"certification.aero", 18u},
+  {"certmgr.org", 11u},
+  {"cesena-forli.it", 15u},
+  {"cesena-forl\303\254.it", 16u},
+  {"cesenaforli.it", 14u},
+  {"cesenaforl\303\254.it", 15u},
+  {"cf", 2u},
+  {"cfa", 3u},
+  {"cfd", 3u},
+  {"cg", 2u},
+  {"ch", 2u},
+  {"ch.eu.org", 9u},
+  {"ch.it", 5u},
+  {"ch.tc", 5u},
+  {"ch.trendhosting.cloud", 21u},
+  {"chambagri.fr", 12u},
+  {"championship.aero", 17u},
+  {"chanel", 6u},
+  {"channel", 7u},
+  {"channelsdvr.net", 15u},
+  {"charity", 7u},
+  {"charter.aero", 12u},
+  {"chase", 5u},
+  {"chat", 4u},
+  {"chattanooga.museum", 18u},
+  {"cheap", 5u},
+  {"cheap.jp", 8u},
+  {"cheltenham.museum", 17u},
+  {"cherkassy.ua", 12u},
+  {"cherkasy.ua", 11u},
+  {"chernigov.ua", 12u},
+  {"chernihiv.ua", 12u},
+  {"chernivtsi.ua", 13u},
+  {"chernovtsy.ua", 13u},
+  {"chesapeakebay.museum", 20u},
+  {"chiba.jp", 8u},
+  {"chicago.museum", 14u},
+  {"chicappa.jp", 11u},
+  {"chichibu.saitama.jp", 19u},
+  {"chieti.it", 9u},
+  {"chigasaki.kanagawa.jp", 21u},
+  {"chihayaakasaka.osaka.jp", 23u},
+  {"chijiwa.nagasaki.jp", 19u},
+  {"chikugo.fukuoka.jp", 18u},
+  {"chikuho.fukuoka.jp", 18u},
+  {"chikuhoku.nagano.jp", 19u},
+  {"chikujo.fukuoka.jp", 18u},
+  {"chikuma.nagano.jp", 17u},
+  {"chikusei.ibaraki.jp", 19u},
+  {"chikushino.fukuoka.jp", 21u},
+  {"chikuzen.fukuoka.jp", 19u},
+  {"children.museum", 15u},
+  {"childrens.museum", 16u},
+  {"childrensgarden.museum", 22u},
+  {"chillout.jp", 11u},
+  {"chimkent.su", 11u},
+  {"chino.nagano.jp", 15u},
+  {"chintai", 7u},
+  {"chippubetsu.hokkaido.jp", 23u},
+  {"chips.jp", 8u},
+  {"chiropractic.museum", 19u},
+  {"chirurgiens-dentistes-en-france.fr", 34u},
+  {"chirurgiens-dentistes.fr", 24u},
+  {"chiryu.aichi.jp", 15u},
+  {"chita.aichi.jp", 14u},
+  {"chitose.hokkaido.jp", 19u},
+  {"chiyoda.gunma.jp", 16u},
+  {"chiyoda.tokyo.jp", 16u},
+  {"chizu.tottori.jp", 16u},
+  {"chocolate.museum", 16u},
+  {"chofu.tokyo.jp", 14u},
+  {"chonan.chiba.jp", 15u},
+  {"chosei.chiba.jp", 15u},
+  {"choshi.chiba.jp", 15u},
+  {"chowder.jp", 10u},
+  {"choyo.kumamoto.jp", 17u},
+  {"christiansburg.museum", 21u},
+  {"christmas", 9u},
+  {"chrome", 6u},
+  {"chtr.k12.ma.us", 14u},
+  {"chu.jp", 6u},
+  {"chungbuk.kr", 11u},
+  {"chungnam.kr", 11u},
+  {"chuo.chiba.jp", 13u},
+  {"chuo.fukuoka.jp", 15u},
+  {"chuo.osaka.jp", 13u},
+  {"chuo.tokyo.jp", 13u},
+  {"chuo.yamanashi.jp", 17u},
+  {"church", 6u},
+  {"ci", 2u},
+  {"ci.it", 5u},
+  {"ciao.jp", 7u},
+  {"ciencia.bo", 10u},
+  {"cieszyn.pl", 10u},
+  {"cim.br", 6u},
+  {"cincinnati.museum", 17u},
+  {"cinema.museum", 13u},
+  {"cipriani", 8u},
+  {"circle", 6u},
+  {"circus.museum", 13u},
+  {"cisco", 5u},
+  {"ciscofreak.com", 14u},
+  {"cistron.nl", 10u},
+  {"citadel", 7u},
+  {"citi", 4u},
+  {"citic", 5u},
+  {"city", 4u},
+  {"city.hu", 7u},
+  {"cityeats", 8u},
+  {"civilaviation.aero", 18u},
+  {"civilisation.museum", 19u},
+  {"civilization.museum", 19u},
+  {"civilwar.museum", 15u},
+  {"ck.ua", 5u},
+  {"cl", 2u},
+  {"cl.it", 5u},
+  {"claims", 6u},
+  {"clan.rip", 8u},
+  {"cleaning", 8u},
+  {"clerk.app", 9u},
+  {"clerkstage.app", 14u},
+  {"cleverapps.io", 13u},
+  {"click", 5u},
+  {"clicketcloud.com", 16u},
+  {"clickrising.net", 15u},
+  {"clinic", 6u},
+  {"clinique", 8u},
+  {"clinton.museum", 14u},
+  {"clock.museum", 12u},
+  {"clothing", 8u},
+  {"cloud", 5u},
+  {"cloud-fr1.unispace.io", 21u},
+  {"cloud.fedoraproject.org", 23u},
+  {"cloud.goog", 10u},
+  {"cloud.interhostsolutions.be", 27u},
+  {"cloud.jelastic.open.tim.it", 26u},
+  {"cloud.nospamproxy.com", 21u},
+  {"cloud66.ws", 10u},
+  {"cloud66.zone", 12u},
+  {"cloudaccess.host", 16u},
+  {"cloudaccess.net", 15u},
+  {"cloudapp.net", 12u},
+  {"cloudapps.digital", 17u},
+  {"cloudcontrolapp.com", 19u},
+  {"cloudcontrolled.com", 19u},
+  {"cloudfront.net", 14u},
+  {"cloudfunctions.net", 18u},
+  {"cloudjiffy.net", 14u},
+  {"cloudns.asia", 12u},
+  {"cloudns.biz", 11u},
+  {"cloudns.cc", 10u},
+  {"cloudns.club", 12u},
+  {"cloudns.eu", 10u},
+  {"cloudns.in", 10u},
+  {"cloudns.info", 12u},
+  {"cloudns.org", 11u},
+  {"cloudns.pro", 11u},
+  {"cloudns.pw", 10u},
+  {"cloudns.us", 10u},
+  {"cloudsite.builders", 18u},
+  {"cloudycluster.net", 17u},
+  {"club", 4u},
+  {"club.aero", 9u},
+  {"club.tw", 7u},
+  {"clubmed", 7u},
+  {"cm", 2u},
+  {"cn", 2u},
+  {"cn-north-1.eb.amazonaws.com.cn", 30u},
+  {"cn-northwest-1.eb.amazonaws.com.cn", 34u},
+  {"cn.com", 6u},
+  {"cn.eu.org", 9u},
+  {"cn.in", 5u},
+  {"cn.it", 5u},
+  {"cn.ua", 5u},
+  {"cn.vu", 5u},
+  {"cng.br", 6u},
+  {"cnpy.gdn", 8u},
+  {"cnt.br", 6u},
+  {"co", 2u},
+  {"co.ae", 5u},
+  {"co.ag", 5u},
+  {"co.am", 5u},
+  {"co.ao", 5u},
+  {"co.at", 5u},
+  {"co.bb", 5u},
+  {"co.bi", 5u},
+  {"co.bn", 5u},
+  {"co.business", 11u},
+  {"co.bw", 5u},
+  {"co.ca", 5u},
+  {"co.ci", 5u},
+  {"co.cl", 5u},
+  {"co.cm", 5u},
+  {"co.com", 6u},
+  {"co.cr", 5u},
+  {"co.cz", 5u},
+  {"co.dk", 5u},
+  {"co.education", 12u},
+  {"co.events", 9u},
+  {"co.financial", 12u},
+  {"co.gg", 5u},
+  {"co.gl", 5u},
+  {"co.gy", 5u},
+  {"co.hu", 5u},
+  {"co.id", 5u},
+  {"co.il", 5u},
+  {"co.im", 5u},
+  {"co.in", 5u},
+  {"co.ir", 5u},
+  {"co.it", 5u},
+  {"co.je", 5u},
+  {"co.jp", 5u},
+  {"co.ke", 5u},
+  {"co.kr", 5u},
+  {"co.krd", 6u},
+  {"co.lc", 5u},
+  {"co.ls", 5u},
+  {"co.ma", 5u},
+  {"co.me", 5u},
+  {"co.mg", 5u},
+  {"co.mu", 5u},
+  {"co.mw", 5u},
+  {"co.mz", 5u},
+  {"co.na", 5u},
+  {"co.network", 10u},
+  {"co.ni", 5u},
+  {"co.nl", 5u},
+  {"co.no", 5u},
+  {"co.nz", 5u},
+  {"co.om", 5u},
+  {"co.pl", 5u},
+  {"co.place", 8u},
+  {"co.pn", 5u},
+  {"co.pw", 5u},
+  {"co.ro", 5u},
+  {"co.rs", 5u},
+  {"co.rw", 5u},
+  {"co.st", 5u},
+  {"co.sz", 5u},
+  {"co.technology", 13u},
+  {"co.th", 5u},
+  {"co.tj", 5u},
+  {"co.tm", 5u},
+  {"co.tt", 5u},
+  {"co.tz", 5u},
+  {"co.ua", 5u},
+  {"co.ug", 5u},
+  {"co.uk", 5u},
+  {"co.us", 5u},
+  {"co.uz", 5u},
+  {"co.ve", 5u},
+  {"co.vi", 5u},
+  {"co.za", 5u},
+  {"co.zm", 5u},
+  {"co.zw", 5u},
+  {"coach", 5u},
+  {"coal.museum", 11u},
+  {"coastaldefence.museum", 21u},
+  {"cocotte.jp", 10u},
+  {"codeberg.page", 13u},
+  {"codes", 5u},
+  {"codespot.com", 12u},
+  {"cody.museum", 11u},
+  {"coffee", 6u},
+  {"cog.mi.us", 9u},
+  {"col.ng", 6u},
+  {"coldwar.museum", 14u},
+  {"collection.museum", 17u},
+  {"college", 7u},
+  {"collegefan.org", 14u},
+  {"cologne", 7u},
+  {"colonialwilliamsburg.museum", 27u},
+  {"coloradoplateau.museum", 22u},
+  {"columbia.museum", 15u},
+  {"columbus.museum", 15u},
+  {"com", 3u},
+  {"com.ac", 6u},
+  {"com.af", 6u},
+  {"com.ag", 6u},
+  {"com.ai", 6u},
+  {"com.al", 6u},
+  {"com.am", 6u},
+  {"com.ar", 6u},
+  {"com.au", 6u},
+  {"com.aw", 6u},
+  {"com.az", 6u},
+  {"com.ba", 6u},
+  {"com.bb", 6u},
+  {"com.bh", 6u},
+  {"com.bi", 6u},
+  {"com.bm", 6u},
+  {"com.bn", 6u},
+  {"com.bo", 6u},
+  {"com.br", 6u},
+  {"com.bs", 6u},
+  {"com.bt", 6u},
+  {"com.by", 6u},
+  {"com.bz", 6u},
+  {"com.ci", 6u},
+  {"com.cm", 6u},
+  {"com.cn", 6u},
+  {"com.co", 6u},
+  {"com.cu", 6u},
+  {"com.cv", 6u},
+  {"com.cw", 6u},
+  {"com.cy", 6u},
+  {"com.de", 6u},
+  {"com.dm", 6u},
+  {"com.do", 6u},
+  {"com.dz", 6u},
+  {"com.ec", 6u},
+  {"com.ee", 6u},
+  {"com.eg", 6u},
+  {"com.es", 6u},
+  {"com.et", 6u},
+  {"com.fj", 6u},
+  {"com.fm", 6u},
+  {"com.fr", 6u},
+  {"com.ge", 6u},
+  {"com.gh", 6u},
+  {"com.gi", 6u},
+  {"com.gl", 6u},
+  {"com.gn", 6u},
+  {"com.gp", 6u},
+  {"com.gr", 6u},
+  {"com.gt", 6u},
+  {"com.gu", 6u},
+  {"com.gy", 6u},
+  {"com.hk", 6u},
+  {"com.hn", 6u},
+  {"com.hr", 6u},
+  {"com.ht", 6u},
+  {"com.im", 6u},
+  {"com.in", 6u},
+  {"com.io", 6u},
+  {"com.iq", 6u},
+  {"com.is", 6u},
+  {"com.jo", 6u},
+  {"com.kg", 6u},
+  {"com.ki", 6u},
+  {"com.km", 6u},
+  {"com.kp", 6u},
+  {"com.kw", 6u},
+  {"com.ky", 6u},
+  {"com.kz", 6u},
+  {"com.la", 6u},
+  {"com.lb", 6u},
+  {"com.lc", 6u},
+  {"com.lk", 6u},
+  {"com.lr", 6u},
+  {"com.lv", 6u},
+  {"com.ly", 6u},
+  {"com.mg", 6u},
+  {"com.mk", 6u},
+  {"com.ml", 6u},
+  {"com.mo", 6u},
+  {"com.ms", 6u},
+  {"com.mt", 6u},
+  {"com.mu", 6u},
+  {"com.mv", 6u},
+  {"com.mw", 6u},
+  {"com.mx", 6u},
+  {"com.my", 6u},
+  {"com.na", 6u},
+  {"com.nf", 6u},
+  {"com.ng", 6u},
+  {"com.ni", 6u},
+  {"com.nr", 6u},
+  {"com.om", 6u},
+  {"com.pa", 6u},
+  {"com.pe", 6u},
+  {"com.pf", 6u},
+  {"com.ph", 6u},
+  {"com.pk", 6u},
+  {"com.pl", 6u},
+  {"com.pr", 6u},
+  {"com.ps", 6u},
+  {"com.pt", 6u},
+  {"com.py", 6u},
+  {"com.qa", 6u},
+  {"com.re", 6u},
+  {"com.ro", 6u},
+  {"com.ru", 6u},
+  {"com.sa", 6u},
+  {"com.sb", 6u},
+  {"com.sc", 6u},
+  {"com.sd", 6u},
+  {"com.se", 6u},
+  {"com.sg", 6u},
+  {"com.sh", 6u},
+  {"com.sl", 6u},
+  {"com.sn", 6u},
+  {"com.so", 6u},
+  {"com.ss", 6u},
+  {"com.st", 6u},
+  {"com.sv", 6u},
+  {"com.sy", 6u},
+  {"com.tj", 6u},
+  {"com.tm", 6u},
+  {"com.tn", 6u},
+  {"com.to", 6u},
+  {"com.tr", 6u},
+  {"com.tt", 6u},
+  {"com.tw", 6u},
+  {"com.ua", 6u},
+  {"com.ug", 6u},
+  {"com.uy", 6u},
+  {"com.uz", 6u},
+  {"com.vc", 6u},
+  {"com.ve", 6u},
+  {"com.vi", 6u},
+  {"com.vn", 6u},
+  {"com.vu", 6u},
+  {"com.ws", 6u},
+  {"com.ye", 6u},
+  {"com.zm", 6u},
+  {"comcast", 7u},
+  {"commbank", 8u},
+  {"commune.am", 10u},
+  {"communication.museum", 20u},
+  {"communications.museum", 21u},
+  {"community", 9u},
+  {"community-pro.de", 16u},
+  {"community-pro.net", 17u},
+  {"community.museum", 16u},
+  {"como.it", 7u},
+  {"company", 7u},
+  {"compare", 7u},
+  {"computer", 8u},
+  {"computer.museum", 15u},
+  {"computerhistory.museum", 22u},
+  {"comsec", 6u},
+  {"comunica\303\247\303\265es.museum", 21u},
+  {"condos", 6u},
+  {"conf.au", 7u},
+  {"conf.lv", 7u},
+  {"conf.se", 7u},
+  {"conference.aero", 15u},
+  {"conn.uk", 7u},
+  {"construction", 12u},
+  {"consulado.st", 12u},
+  {"consultant.aero", 15u},
+  {"consulting", 10u},
+  {"consulting.aero", 15u},
+  {"contact", 7u},
+  {"contagem.br", 11u},
+  {"contemporary.museum", 19u},
+  {"contemporaryart.museum", 22u},
+  {"contractors", 11u},
+  {"control.aero", 12u},
+  {"convent.museum", 14u},
+  {"cooking", 7u},
+  {"cookingchannel", 14u},
+  {"cool", 4u},
+  {"coolblog.jp", 11u},
+  {"coop", 4u},
+  {"coop.ar", 7u},
+  {"coop.br", 7u},
+  {"coop.ht", 7u},
+  {"coop.in", 7u},
+  {"coop.km", 7u},
+  {"coop.mv", 7u},
+  {"coop.mw", 7u},
+  {"coop.py", 7u},
+  {"coop.rw", 7u},
+  {"coop.tt", 7u},
+  {"cooperativa.bo", 14u},
+  {"copenhagen.museum", 17u},
+  {"copro.uk", 8u},
+  {"corporation.museum", 18u},
+  {"correios-e-telecomunica\303\247\303\265es.museum", 36u},
+  {"corsica", 7u},
+  {"corvette.museum", 15u},
+  {"cosenza.it", 10u},
+  {"costume.museum", 14u},
+  {"couchpotatofries.org", 20u},
+  {"council.aero", 12u},
+  {"country", 7u},
+  {"countryestate.museum", 20u},
+  {"county.museum", 13u},
+  {"coupon", 6u},
+  {"coupons", 7u},
+  {"courses", 7u},
+  {"coz.br", 6u},
+  {"cpa", 3u},
+  {"cpa.pro", 7u},
+  {"cq.cn", 5u},
+  {"cr", 2u},
+  {"cr.it", 5u},
+  {"cr.ua", 5u},
+  {"crafting.xyz", 12u},
+  {"crafts.museum", 13u},
+  {"cranbrook.museum", 16u},
+  {"cranky.jp", 9u},
+  {"crd.co", 6u},
+  {"creation.museum", 15u},
+  {"credit", 6u},
+  {"creditcard", 10u},
+  {"creditunion", 11u},
+  {"cremona.it", 10u},
+  {"crew.aero", 9u},
+  {"cri.br", 6u},
+  {"cri.nz", 6u},
+  {"cricket", 7u},
+  {"crimea.ua", 9u},
+  {"crotone.it", 10u},
+  {"crown", 5u},
+  {"crs", 3u},
+  {"cruise", 6u},
+  {"cruises", 7u},
+  {"cs.in", 5u},
+  {"cs.it", 5u},
+  {"cs.keliweb.cloud", 16u},
+  {"csx.cc", 6u},
+  {"ct.it", 5u},
+  {"ct.us", 5u},
+  {"cu", 2u},
+  {"cuiaba.br", 9u},
+  {"cuisinella", 10u},
+  {"cultural.museum", 15u},
+  {"culturalcenter.museum", 21u},
+  {"culture.museum", 14u},
+  {"cuneo.it", 8u},
+  {"cupcake.is", 10u},
+  {"curitiba.br", 11u},
+  {"curv.dev", 8u},
+  {"cust.dev.thingdust.io", 21u},
+  {"cust.disrec.thingdust.io", 24u},
+  {"cust.prod.thingdust.io", 22u},
+  {"cust.retrosnub.co.uk", 20u},
+  {"cust.testing.thingdust.io", 25u},
+  {"custom.metacentrum.cz", 21u},
+  {"customer.mythic-beasts.com", 26u},
+  {"customer.speedpartner.de", 24u},
+  {"cutegirl.jp", 11u},
+  {"cv", 2u},
+  {"cv.ua", 5u},
+  {"cw", 2u},
+  {"cx", 2u},
+  {"cx.ua", 5u},
+  {"cy", 2u},
+  {"cy.eu.org", 9u},
+  {"cya.gg", 6u},
+  {"cyber.museum", 12u},
+  {"cymru", 5u},
+  {"cymru.museum", 12u},
+  {"cyon.link", 9u},
+  {"cyon.site", 9u},
+  {"cyou", 4u},
+  {"cz", 2u},
+  {"cz.eu.org", 9u},
+  {"cz.it", 5u},
+  {"czeladz.pl", 10u},
+  {"czest.pl", 8u},
+  {"d.bg", 4u},
+  {"d.gv.vc", 7u},
+  {"d.se", 4u},
+  {"daa.jp", 6u},
+  {"dabur", 5u},
+  {"dad", 3u},
+  {"daegu.kr", 8u},
+  {"daejeon.kr", 10u},
+  {"daemon.panel.gg", 15u},
+  {"dagestan.ru", 11u},
+  {"dagestan.su", 11u},
+  {"daigo.ibaraki.jp", 16u},
+  {"daisen.akita.jp", 15u},
+  {"daito.osaka.jp", 14u},
+  {"daiwa.hiroshima.jp", 18u},
+  {"dali.museum", 11u},
+  {"dallas.museum", 13u},
+  {"damnserver.com", 14u},
+  {"dance", 5u},
+  {"daplie.me", 9u},
+  {"data", 4u},
+  {"database.museum", 15u},
+  {"date", 4u},
+  {"date.fukushima.jp", 17u},
+  {"date.hokkaido.jp", 16u},
+  {"dating", 6u},
+  {"datsun", 6u},
+  {"dattolocal.com", 14u},
+  {"dattolocal.net", 14u},
+  {"dattorelay.com", 14u},
+  {"dattoweb.com", 12u},
+  {"davvenjarga.no", 14u},
+  {"davvenj\303\241rga.no", 15u},
+  {"davvesiida.no", 13u},
+  {"day", 3u},
+  {"dazaifu.fukuoka.jp", 18u},
+  {"dc.us", 5u},
+  {"dclk", 4u},
+  {"dd-dns.de", 9u},
+  {"ddns.me", 7u},
+  {"ddns.net", 8u},
+  {"ddns5.com", 9u},
+  {"ddnsfree.com", 12u},
+  {"ddnsgeek.com", 12u},
+  {"ddnsking.com", 12u},
+  {"ddnslive.com", 12u},
+  {"ddnss.de", 8u},
+  {"ddnss.org", 9u},
+  {"ddr.museum", 10u},
+  {"dds", 3u},
+  {"de", 2u},
+  {"de.com", 6u},
+  {"de.cool", 7u},
+  {"de.eu.org", 9u},
+  {"de.gt", 5u},
+  {"de.ls", 5u},
+  {"de.md", 5u},
+  {"de.trendhosting.cloud", 21u},
+  {"de.us", 5u},
+  {"deal", 4u},
+  {"dealer", 6u},
+  {"deals", 5u},
+  {"deatnu.no", 9u},
+  {"debian.net", 10u},
+  {"deca.jp", 7u},
+  {"deci.jp", 7u},
+  {"decorativearts.museum", 21u},
+  {"dedibox.fr", 10u},
+  {"dedyn.io", 8u},
+  {"def.br", 6u},
+  {"definima.io", 11u},
+  {"definima.net", 12u},
+  {"degree", 6u},
+  {"delaware.museum", 15u},
+  {"delhi.in", 8u},
+  {"delivery", 8u},
+  {"dell", 4u},
+  {"dell-ogliastra.it", 17u},
+  {"dellogliastra.it", 16u},
+  {"delmenhorst.museum", 18u},
+  {"deloitte", 8u},
+  {"delta", 5u},
+  {"demo.datacenter.fi", 18u},
+  {"demo.datadetect.com", 19u},
+  {"demo.jelastic.com", 17u},
+  {"democracia.bo", 13u},
+  {"democrat", 8u},
+  {"demon.nl", 8u},
+  {"denmark.museum", 14u},
+  {"deno-staging.dev", 16u},
+  {"deno.dev", 8u},
+  {"dental", 6u},
+  {"dentist", 7u},
+  {"dep.no", 6u},
+  {"deporte.bo", 10u},
+  {"depot.museum", 12u},
+  {"des.br", 6u},
+  {"desa.id", 7u},
+  {"desi", 4u},
+  {"design", 6u},
+  {"design.aero", 11u},
+  {"design.museum", 13u},
+  {"det.br", 6u},
+  {"deta.app", 8u},
+  {"deta.dev", 8u},
+  {"detroit.museum", 14u},
+  {"dev", 3u},
+  {"dev-myqnapcloud.com", 19u},
+  {"dev.br", 6u},
+  {"dev.static.land", 15u},
+  {"dev.vu", 6u},
+  {"development.run", 15u},
+  {"devices.resinstaging.io", 23u},
+  {"df.gov.br", 9u},
+  {"df.leg.br", 9u},
+  {"dgca.aero", 9u},
+  {"dh.bytemark.co.uk", 17u},
+  {"dhl", 3u},
+  {"diadem.cloud", 12u},
+  {"diamonds", 8u},
+  {"dielddanuorri.no", 16u},
+  {"diet", 4u},
+  {"digick.jp", 9u},
+  {"digital", 7u},
+  {"dinosaur.museum", 15u},
+  {"direct", 6u},
+  {"direct.quickconnect.cn", 22u},
+  {"direct.quickconnect.to", 22u},
+  {"directory", 9u},
+  {"discordsays.com", 15u},
+  {"discordsez.com", 14u},
+  {"discount", 8u},
+  {"discourse.group", 15u},
+  {"discourse.team", 14u},
+  {"discover", 8u},
+  {"discovery.museum", 16u},
+  {"dish", 4u},
+  {"diskstation.eu", 14u},
+  {"diskstation.me", 14u},
+  {"diskstation.org", 15u},
+  {"diskussionsbereich.de", 21u},
+  {"ditchyourip.com", 15u},
+  {"divtasvuodna.no", 15u},
+  {"divttasvuotna.no", 16u},
+  {"diy", 3u},
+  {"dj", 2u},
+  {"dk", 2u},
+  {"dk.eu.org", 9u},
+  {"dlugoleka.pl", 12u},
+  {"dm", 2u},
+  {"dn.ua", 5u},
+  {"dnepropetrovsk.ua", 17u},
+  {"dni.us", 6u},
+  {"dnipropetrovsk.ua", 17u},
+  {"dnp", 3u},
+  {"dnsalias.com", 12u},
+  {"dnsalias.net", 12u},
+  {"dnsalias.org", 12u},
+  {"dnsdojo.com", 11u},
+  {"dnsdojo.net", 11u},
+  {"dnsdojo.org", 11u},
+  {"dnsfor.me", 9u},
+  {"dnshome.de", 10u},
+  {"dnsiskinky.com", 14u},
+  {"dnsking.ch", 10u},
+  {"dnsup.net", 9u},
+  {"dnsupdate.info", 14u},
+  {"dnsupdater.de", 13u},
+  {"do", 2u},
+  {"docs", 4u},
+  {"doctor", 6u},
+  {"does-it.net", 11u},
+  {"doesntexist.com", 15u},
+  {"doesntexist.org", 15u},
+  {"dog", 3u},
+  {"dolls.museum", 12u},
+  {"domains", 7u},
+  {"donetsk.ua", 10u},
+  {"donna.no", 8u},
+  {"donostia.museum", 15u},
+  {"dontexist.com", 13u},
+  {"dontexist.net", 13u},
+  {"dontexist.org", 13u},
+  {"doomdns.com", 11u},
+  {"doomdns.org", 11u},
+  {"dopaas.com", 10u},
+  {"doshi.yamanashi.jp", 18u},
+  {"dot", 3u},
+  {"dovre.no", 8u},
+  {"download", 8u},
+  {"dp.ua", 5u},
+  {"dr.in", 5u},
+  {"dr.na", 5u},
+  {"dr.tr", 5u},
+  {"drammen.no", 10u},
+  {"drangedal.no", 12u},
+  {"dray-dns.de", 11u},
+  {"drayddns.com", 12u},
+  {"draydns.de", 10u},
+  {"dreamhosters.com", 16u},
+  {"drive", 5u},
+  {"drobak.no", 9u},
+  {"drr.ac", 6u},
+  {"drud.io", 7u},
+  {"drud.us", 7u},
+  {"dr\303\270bak.no", 10u},
+  {"dscloud.biz", 11u},
+  {"dscloud.me", 10u},
+  {"dscloud.mobi", 12u},
+  {"dsmynas.com", 11u},
+  {"dsmynas.net", 11u},
+  {"dsmynas.org", 11u},
+  {"dst.mi.us", 9u},
+  {"dtv", 3u},
+  {"dubai", 5u},
+  {"duckdns.org", 11u},
+  {"dunlop", 6u},
+  {"dupont", 6u},
+  {"durban", 6u},
+  {"durham.museum", 13u},
+  {"dvag", 4u},
+  {"dvr", 3u},
+  {"dvrcam.info", 11u},
+  {"dvrdns.org", 10u},
+  {"dy.fi", 5u},
+  {"dyn-berlin.de", 13u},
+  {"dyn-ip24.de", 11u},
+  {"dyn-o-saur.com", 14u},
+  {"dyn-vpn.de", 10u},
+  {"dyn.cosidns.de", 14u},
+  {"dyn.ddnss.de", 12u},
+  {"dyn.home-webserver.de", 21u},
+  {"dyn53.io", 8u},
+  {"dynalias.com", 12u},
+  {"dynalias.net", 12u},
+  {"dynalias.org", 12u},
+  {"dynamic-dns.info", 16u},
+  {"dynamisches-dns.de", 18u},
+  {"dynathome.net", 13u},
+  {"dyndns-at-home.com", 18u},
+  {"dyndns-at-work.com", 18u},
+  {"dyndns-blog.com", 15u},
+  {"dyndns-free.com", 15u},
+  {"dyndns-home.com", 15u},
+  {"dyndns-ip.com", 13u},
+  {"dyndns-mail.com", 15u},
+  {"dyndns-office.com", 17u},
+  {"dyndns-pics.com", 15u},
+  {"dyndns-remote.com", 17u},
+  {"dyndns-server.com", 17u},
+  {"dyndns-web.com", 14u},
+  {"dyndns-wiki.com", 15u},
+  {"dyndns-work.com", 15u},
+  {"dyndns.biz", 10u},
+  {"dyndns.dappnode.io", 18u},
+  {"dyndns.ddnss.de", 15u},
+  {"dyndns.info", 11u},
+  {"dyndns.org", 10u},
+  {"dyndns.tv", 9u},
+  {"dyndns.ws", 9u},
+  {"dyndns1.de", 10u},
+  {"dynns.com", 9u},
+  {"dynserv.org", 11u},
+  {"dynu.net", 8u},
+  {"dynv6.net", 9u},
+  {"dynvpn.de", 9u},
+  {"dyroy.no", 8u},
+  {"dyr\303\270y.no", 9u},
+  {"dz", 2u},
+  {"d\303\270nna.no", 9u},
+  {"e.bg", 4u},
+  {"e.se", 4u},
+  {"e12.ve", 6u},
+  {"e164.arpa", 9u},
+  {"e4.cz", 5u},
+  {"earth", 5u},
+  {"east-kazakhstan.su", 18u},
+  {"eastafrica.museum", 17u},
+  {"eastasia.azurestaticapps.net", 28u},
+  {"eastcoast.museum", 16u},
+  {"eastus2.azurestaticapps.net", 27u},
+  {"easypanel.app", 13u},
+  {"easypanel.host", 14u},
+  {"eat", 3u},
+  {"eating-organic.net", 18u},
+  {"eaton.mi.us", 11u},
+  {"ebetsu.hokkaido.jp", 18u},
+  {"ebina.kanagawa.jp", 17u},
+  {"ebino.miyazaki.jp", 17u},
+  {"ebiz.tw", 7u},
+  {"ec", 2u},
+  {"echizen.fukui.jp", 16u},
+  {"ecn.br", 6u},
+  {"eco", 3u},
+  {"eco.br", 6u},
+  {"ecologia.bo", 11u},
+  {"ecommerce-shop.pl", 17u},
+  {"economia.bo", 11u},
+  {"ed.ao", 5u},
+  {"ed.ci", 5u},
+  {"ed.cr", 5u},
+  {"ed.jp", 5u},
+  {"ed.pw", 5u},
+  {"edeka", 5u},
+  {"edgeapp.net", 11u},
+  {"edgecompute.app", 15u},
+  {"edgestack.me", 12u},
+  {"editorx.io", 10u},
+  {"edogawa.tokyo.jp", 16u},
+  {"edu", 3u},
+  {"edu.ac", 6u},
+  {"edu.af", 6u},
+  {"edu.al", 6u},
+  {"edu.ar", 6u},
+  {"edu.au", 6u},
+  {"edu.az", 6u},
+  {"edu.ba", 6u},
+  {"edu.bb", 6u},
+  {"edu.bh", 6u},
+  {"edu.bi", 6u},
+  {"edu.bm", 6u},
+  {"edu.bn", 6u},
+  {"edu.bo", 6u},
+  {"edu.br", 6u},
+  {"edu.bs", 6u},
+  {"edu.bt", 6u},
+  {"edu.bz", 6u},
+  {"edu.ci", 6u},
+  {"edu.cn", 6u},
+  {"edu.co", 6u},
+  {"edu.cu", 6u},
+  {"edu.cv", 6u},
+  {"edu.cw", 6u},
+  {"edu.dm", 6u},
+  {"edu.do", 6u},
+  {"edu.dz", 6u},
+  {"edu.ec", 6u},
+  {"edu.ee", 6u},
+  {"edu.eg", 6u},
+  {"edu.es", 6u},
+  {"edu.et", 6u},
+  {"edu.eu.org", 10u},
+  {"edu.fm", 6u},
+  {"edu.gd", 6u},
+  {"edu.ge", 6u},
+  {"edu.gh", 6u},
+  {"edu.gi", 6u},
+  {"edu.gl", 6u},
+  {"edu.gn", 6u},
+  {"edu.gp", 6u},
+  {"edu.gr", 6u},
+  {"edu.gt", 6u},
+  {"edu.gu", 6u},
+  {"edu.gy", 6u},
+  {"edu.hk", 6u},
+  {"edu.hn", 6u},
+  {"edu.ht", 6u},
+  {"edu.in", 6u},
+  {"edu.iq", 6u},
+  {"edu.is", 6u},
+  {"edu.it", 6u},
+  {"edu.jo", 6u},
+  {"edu.kg", 6u},
+  {"edu.ki", 6u},
+  {"edu.km", 6u},
+  {"edu.kn", 6u},
+  {"edu.kp", 6u},
+  {"edu.krd", 7u},
+  {"edu.kw", 6u},
+  {"edu.ky", 6u},
+  {"edu.kz", 6u},
+  {"edu.la", 6u},
+  {"edu.lb", 6u},
+  {"edu.lc", 6u},
+  {"edu.lk", 6u},
+  {"edu.lr", 6u},
+  {"edu.ls", 6u},
+  {"edu.lv", 6u},
+  {"edu.ly", 6u},
+  {"edu.me", 6u},
+  {"edu.mg", 6u},
+  {"edu.mk", 6u},
+  {"edu.ml", 6u},
+  {"edu.mn", 6u},
+  {"edu.mo", 6u},
+  {"edu.ms", 6u},
+  {"edu.mt", 6u},
+  {"edu.mv", 6u},
+  {"edu.mw", 6u},
+  {"edu.mx", 6u},
+  {"edu.my", 6u},
+  {"edu.mz", 6u},
+  {"edu.ng", 6u},
+  {"edu.ni", 6u},
+  {"edu.nr", 6u},
+  {"edu.om", 6u},
+  {"edu.pa", 6u},
+  {"edu.pe", 6u},
+  {"edu.pf", 6u},
+  {"edu.ph", 6u},
+  {"edu.pk", 6u},
+  {"edu.pl", 6u},
+  {"edu.pn", 6u},
+  {"edu.pr", 6u},
+  {"edu.ps", 6u},
+  {"edu.pt", 6u},
+  {"edu.py", 6u},
+  {"edu.qa", 6u},
+  {"edu.rs", 6u},
+  {"edu.ru", 6u},
+  {"edu.sa", 6u},
+  {"edu.sb", 6u},
+  {"edu.sc", 6u},
+  {"edu.scot", 8u},
+  {"edu.sd", 6u},
+  {"edu.sg", 6u},
+  {"edu.sl", 6u},
+  {"edu.sn", 6u},
+  {"edu.so", 6u},
+  {"edu.ss", 6u},
+  {"edu.st", 6u},
+  {"edu.sv", 6u},
+  {"edu.sy", 6u},
+  {"edu.tj", 6u},
+  {"edu.tm", 6u},
+  {"edu.to", 6u},
+  {"edu.tr", 6u},
+  {"edu.tt", 6u},
+  {"edu.tw", 6u},
+  {"edu.ua", 6u},
+  {"edu.uy", 6u},
+  {"edu.vc", 6u},
+  {"edu.ve", 6u},
+  {"edu.vn", 6u},
+  {"edu.vu", 6u},
+  {"edu.ws", 6u},
+  {"edu.ye", 6u},
+  {"edu.za", 6u},
+  {"edu.zm", 6u},
+  {"education", 9u},
+  {"education.museum", 16u},
+  {"educational.museum", 18u},
+  {"educator.aero", 13u},
+  {"edugit.io", 9u},
+  {"ee", 2u},
+  {"ee.eu.org", 9u},
+  {"eero-stage.online", 17u},
+  {"eero.online", 11u},
+  {"eg", 2u},
+  {"egersund.no", 11u},
+  {"egoism.jp", 9u},
+  {"egyptian.museum", 15u},
+  {"ehime.jp", 8u},
+  {"eid.no", 6u},
+  {"eidfjord.no", 11u},
+  {"eidsberg.no", 11u},
+  {"eidskog.no", 10u},
+  {"eidsvoll.no", 11u},
+  {"eigersund.no", 12u},
+  {"eiheiji.fukui.jp", 16u},
+  {"eisenbahn.museum", 16u},
+  {"ekloges.cy", 10u},
+  {"elasticbeanstalk.com", 20u},
+  {"elblag.pl", 9u},
+  {"elburg.museum", 13u},
+  {"elementor.cloud", 15u},
+  {"elementor.cool", 14u},
+  {"elk.pl", 6u},
+  {"elvendrell.museum", 17u},
+  {"elverum.no", 10u},
+  {"email", 5u},
+  {"emb.kw", 6u},
+  {"embaixada.st", 12u},
+  {"embetsu.hokkaido.jp", 19u},
+  {"embroidery.museum", 17u},
+  {"emerck", 6u},
+  {"emergency.aero", 14u},
+  {"emilia-romagna.it", 17u},
+  {"emiliaromagna.it", 16u},
+  {"emp.br", 6u},
+  {"empresa.bo", 10u},
+  {"emr.it", 6u},
+  {"en-root.fr", 10u},
+  {"en.it", 5u},
+  {"ena.gifu.jp", 11u},
+  {"encoreapi.com", 13u},
+  {"encr.app", 8u},
+  {"encyclopedic.museum", 19u},
+  {"endofinternet.net", 17u},
+  {"endofinternet.org", 17u},
+  {"endoftheinternet.org", 20u},
+  {"enebakk.no", 10u},
+  {"energy", 6u},
+  {"enf.br", 6u},
+  {"eng.br", 6u},
+  {"eng.pro", 7u},
+  {"engerdal.no", 11u},
+  {"engine.aero", 11u},
+  {"engineer", 8u},
+  {"engineer.aero", 13u},
+  {"engineering", 11u},
+  {"england.museum", 14u},
+  {"eniwa.hokkaido.jp", 17u},
+  {"enna.it", 7u},
+  {"ens.tn", 6u},
+  {"enscaled.sg", 11u},
+  {"ent.platform.sh", 15u},
+  {"enterprisecloud.nu", 18u},
+  {"enterprises", 11u},
+  {"entertainment.aero", 18u},
+  {"entomology.museum", 17u},
+  {"environment.museum", 18u},
+  {"environmentalconservation.museum", 32u},
+  {"epilepsy.museum", 15u},
+  {"epson", 5u},
+  {"equipment", 9u},
+  {"equipment.aero", 14u},
+  {"er.in", 5u},
+  {"ericsson", 8u},
+  {"erimo.hokkaido.jp", 17u},
+  {"erni", 4u},
+  {"erotica.hu", 10u},
+  {"erotika.hu", 10u},
+  {"es", 2u},
+  {"es-1.axarnet.cloud", 18u},
+  {"es.ax", 5u},
+  {"es.eu.org", 9u},
+  {"es.gov.br", 9u},
+  {"es.kr", 5u},
+  {"es.leg.br", 9u},
+  {"esan.hokkaido.jp", 16u},
+  {"esashi.hokkaido.jp", 18u},
+  {"esp.br", 6u},
+  {"esq", 3u},
+  {"essex.museum", 12u},
+  {"est-a-la-maison.com", 19u},
+  {"est-a-la-masion.com", 19u},
+  {"est-le-patron.com", 17u},
+  {"est-mon-blogueur.com", 20u},
+  {"est.pr", 6u},
+  {"estate", 6u},
+  {"estate.museum", 13u},
+  {"et", 2u},
+  {"etajima.hiroshima.jp", 20u},
+  {"etc.br", 6u},
+  {"ethnology.museum", 16u},
+  {"eti.br", 6u},
+  {"etisalat", 8u},
+  {"etne.no", 7u},
+  {"etnedal.no", 10u},
+  {"eu", 2u},
+  {"eu-1.evennode.com", 17u},
+  {"eu-2.evennode.com", 17u},
+  {"eu-3.evennode.com", 17u},
+  {"eu-4.evennode.com", 17u},
+  {"eu-central-1.elasticbeanstalk.com", 33u},
+  {"eu-west-1.elasticbeanstalk.com", 30u},
+  {"eu-west-2.elasticbeanstalk.com", 30u},
+  {"eu-west-3.elasticbeanstalk.com", 30u},
+  {"eu.ax", 5u},
+  {"eu.com", 6u},
+  {"eu.encoway.cloud", 16u},
+  {"eu.int", 6u},
+  {"eu.meteorapp.com", 16u},
+  {"eu.org", 6u},
+  {"eu.platform.sh", 14u},
+  {"eu.pythonanywhere.com", 21u},
+  {"eun.eg", 6u},
+  {"eurodir.ru", 10u},
+  {"eurovision", 10u},
+  {"eus", 3u},
+  {"evenassi.no", 11u},
+  {"evenes.no", 9u},
+  {"events", 6u},
+  {"even\303\241\305\241\305\241i.no", 14u},
+  {"evje-og-hornnes.no", 18u},
+  {"exchange", 8u},
+  {"exchange.aero", 13u},
+  {"exeter.museum", 13u},
+  {"exhibition.museum", 17u},
+  {"exnet.su", 8u},
+  {"expert", 6u},
+  {"experts-comptables.fr", 21u},
+  {"exposed", 7u},
+  {"express", 7u},
+  {"express.aero", 12u},
+  {"extraspace", 10u},
+  {"ezproxy.kuleuven.be", 19u},
+  {"f.bg", 4u},
+  {"f.se", 4u},
+  {"fage", 4u},
+  {"fail", 4u},
+  {"fairwinds", 9u},
+  {"faith", 5u},
+  {"fakefur.jp", 10u},
+  {"fam.pk", 6u},
+  {"family", 6u},
+  {"family.museum", 13u},
+  {"familyds.com", 12u},
+  {"familyds.net", 12u},
+  {"familyds.org", 12u},
+  {"fan", 3u},
+  {"fans", 4u},
+  {"fantasyleague.cc", 16u},
+  {"far.br", 6u},
+  {"farm", 4u},
+  {"farm.museum", 11u},
+  {"farmequipment.museum", 20u},
+  {"farmers", 7u},
+  {"farmers.museum", 14u},
+  {"farmstead.museum", 16u},
+  {"farsund.no", 10u},
+  {"fashion", 7u},
+  {"fashionstore.jp", 15u},
+  {"fast", 4u},
+  {"fastly-terrarium.com", 20u},
+  {"fastlylb.net", 12u},
+  {"faststacks.net", 14u},
+  {"fastvps-server.com", 18u},
+  {"fastvps.host", 12u},
+  {"fastvps.site", 12u},
+  {"fauske.no", 9u},
+  {"fbx-os.fr", 9u},
+  {"fbxos.fr", 8u},
+  {"fc.it", 5u},
+  {"fe.it", 5u},
+  {"fed.us", 6u},
+  {"federation.aero", 15u},
+  {"fedex", 5u},
+  {"fedje.no", 8u},
+  {"fedorainfracloud.org", 20u},
+  {"fedorapeople.org", 16u},
+  {"feedback", 8u},
+  {"feira.br", 8u},
+  {"fem.jp", 6u},
+  {"fentiger.mythic-beasts.com", 26u},
+  {"fermo.it", 8u},
+  {"ferrara.it", 10u},
+  {"ferrari", 7u},
+  {"ferrero", 7u},
+  {"feste-ip.net", 12u},
+  {"fet.no", 6u},
+  {"fetsund.no", 10u},
+  {"fg.it", 5u},
+  {"fh-muenster.io", 14u},
+  {"fh.se", 5u},
+  {"fhs.no", 6u},
+  {"fhsk.se", 7u},
+  {"fhv.se", 6u},
+  {"fi", 2u},
+  {"fi.cloudplatform.fi", 19u},
+  {"fi.cr", 5u},
+  {"fi.eu.org", 9u},
+  {"fi.it", 5u},
+  {"fiat", 4u},
+  {"fidelity", 8u},
+  {"fido", 4u},
+  {"fie.ee", 6u},
+  {"field.museum", 12u},
+  {"figueres.museum", 15u},
+  {"filatelia.museum", 16u},
+  {"filegear-au.me", 14u},
+  {"filegear-de.me", 14u},
+  {"filegear-gb.me", 14u},
+  {"filegear-ie.me", 14u},
+  {"filegear-jp.me", 14u},
+  {"filegear-sg.me", 14u},
+  {"filegear.me", 11u},
+  {"film", 4u},
+  {"film.hu", 7u},
+  {"film.museum", 11u},
+  {"fin.ci", 6u},
+  {"fin.ec", 6u},
+  {"fin.tn", 6u},
+  {"final", 5u},
+  {"finance", 7u},
+  {"financial", 9u},
+  {"fineart.museum", 14u},
+  {"finearts.museum", 15u},
+  {"finland.museum", 14u},
+  {"finnoy.no", 9u},
+  {"finn\303\270y.no", 10u},
+  {"fire", 4u},
+  {"firebaseapp.com", 15u},
+  {"firenze.it", 10u},
+  {"firestone", 9u},
+  {"firewall-gateway.com", 20u},
+  {"firewall-gateway.de", 19u},
+  {"firewall-gateway.net", 20u},
+  {"firewalledreplit.co", 19u},
+  {"fireweb.app", 11u},
+  {"firm.co", 7u},
+  {"firm.dk", 7u},
+  {"firm.ht", 7u},
+  {"firm.in", 7u},
+  {"firm.nf", 7u},
+  {"firm.ng", 7u},
+  {"firm.ro", 7u},
+  {"firm.ve", 7u},
+  {"firmdale", 8u},
+  {"fish", 4u},
+  {"fishing", 7u},
+  {"fit", 3u},
+  {"fitjar.no", 9u},
+  {"fitness", 7u},
+  {"fj", 2u},
+  {"fj.cn", 5u},
+  {"fjaler.no", 9u},
+  {"fjell.no", 8u},
+  {"fl.us", 5u},
+  {"fla.no", 6u},
+  {"flakstad.no", 11u},
+  {"flanders.museum", 15u},
+  {"flap.id", 7u},
+  {"flatanger.no", 12u},
+  {"fldrv.com", 9u},
+  {"flekkefjord.no", 14u},
+  {"flesberg.no", 11u},
+  {"flickr", 6u},
+  {"flier.jp", 8u},
+  {"flight.aero", 11u},
+  {"flights", 7u},
+  {"flir", 4u},
+  {"flog.br", 7u},
+  {"floppy.jp", 9u},
+  {"flora.no", 8u},
+  {"florence.it", 11u},
+  {"florida.museum", 14u},
+  {"floripa.br", 10u},
+  {"florist", 7u},
+  {"floro.no", 8u},
+  {"flor\303\270.no", 9u},
+  {"flowers", 7u},
+  {"flt.cloud.muni.cz", 17u},
+  {"fly", 3u},
+  {"fly.dev", 7u},
+  {"flynnhosting.net", 16u},
+  {"fl\303\245.no", 7u},
+  {"fm", 2u},
+  {"fm.br", 5u},
+  {"fm.it", 5u},
+  {"fm.no", 5u},
+  {"fnc.fr-par.scw.cloud", 20u},
+  {"fnd.br", 6u},
+  {"fnwk.site", 9u},
+  {"fo", 2u},
+  {"foggia.it", 9u},
+  {"folionetwork.site", 17u},
+  {"folkebibl.no", 12u},
+  {"folldal.no", 10u},
+  {"foo", 3u},
+  {"food", 4u},
+  {"foodnetwork", 11u},
+  {"fool.jp", 7u},
+  {"football", 8u},
+  {"for-better.biz", 14u},
+  {"for-more.biz", 12u},
+  {"for-our.info", 12u},
+  {"for-some.biz", 12u},
+  {"for-the.biz", 11u},
+  {"for.men", 7u},
+  {"for.mom", 7u},
+  {"for.one", 7u},
+  {"for.sale", 8u},
+  {"force.museum", 12u},
+  {"ford", 4u},
+  {"forde.no", 8u},
+  {"forex", 5u},
+  {"forgeblocks.com", 15u},
+  {"forgot.her.name", 15u},
+  {"forgot.his.name", 15u},
+  {"forli-cesena.it", 15u},
+  {"forlicesena.it", 14u},
+  {"forl\303\254-cesena.it", 16u},
+  {"forl\303\254cesena.it", 15u},
+  {"forsale", 7u},
+  {"forsand.no", 10u},
+  {"fortal.br", 9u},
+  {"forte.id", 8u},
+  {"fortmissoula.museum", 19u},
+  {"fortworth.museum", 16u},
+  {"forum", 5u},
+  {"forum.hu", 8u},
+  {"forumz.info", 11u},
+  {"fosnes.no", 9u},
+  {"fot.br", 6u},
+  {"foundation", 10u},
+  {"foundation.museum", 17u},
+  {"fox", 3u},
+  {"foz.br", 6u},
+  {"fr", 2u},
+  {"fr-1.paas.massivegrid.net", 25u},
+  {"fr-par-1.baremetal.scw.cloud", 28u},
+  {"fr-par-2.baremetal.scw.cloud", 28u},
+  {"fr.eu.org", 9u},
+  {"fr.it", 5u},
+  {"fra1-de.cloudjiffy.net", 22u},
+  {"framer.app", 10u},
+  {"framer.media", 12u},
+  {"framer.photos", 13u},
+  {"framer.website", 14u},
+  {"framer.wiki", 11u},
+  {"framercanvas.com", 16u},
+  {"frana.no", 8u},
+  {"francaise.museum", 16u},
+  {"frankfurt.museum", 16u},
+  {"franziskaner.museum", 19u},
+  {"fredrikstad.no", 14u},
+  {"free", 4u},
+  {"free.hr", 7u},
+  {"freebox-os.com", 14u},
+  {"freebox-os.fr", 13u},
+  {"freeboxos.com", 13u},
+  {"freeboxos.fr", 12u},
+  {"freeddns.org", 12u},
+  {"freeddns.us", 11u},
+  {"freedesktop.org", 15u},
+  {"freemasonry.museum", 18u},
+  {"freemyip.com", 12u},
+  {"freesite.host", 13u},
+  {"freetls.fastly.net", 18u},
+  {"frei.no", 7u},
+  {"freiburg.museum", 15u},
+  {"frenchkiss.jp", 13u},
+  {"fresenius", 9u},
+  {"fribourg.museum", 15u},
+  {"friuli-v-giulia.it", 18u},
+  {"friuli-ve-giulia.it", 19u},
+  {"friuli-vegiulia.it", 18u},
+  {"friuli-venezia-giulia.it", 24u},
+  {"friuli-veneziagiulia.it", 23u},
+  {"friuli-vgiulia.it", 17u},
+  {"friuliv-giulia.it", 17u},
+  {"friulive-giulia.it", 18u},
+  {"friulivegiulia.it", 17u},
+  {"friulivenezia-giulia.it", 23u},
+  {"friuliveneziagiulia.it", 22u},
+  {"friulivgiulia.it", 16u},
+  {"frl", 3u},
+  {"frog.museum", 11u},
+  {"frogans", 7u},
+  {"frogn.no", 8u},
+  {"froland.no", 10u},
+  {"from-ak.com", 11u},
+  {"from-al.com", 11u},
+  {"from-ar.com", 11u},
+  {"from-az.net", 11u},
+  {"from-ca.com", 11u},
+  {"from-co.net", 11u},
+  {"from-ct.com", 11u},
+  {"from-dc.com", 11u},
+  {"from-de.com", 11u},
+  {"from-fl.com", 11u},
+  {"from-ga.com", 11u},
+  {"from-hi.com", 11u},
+  {"from-ia.com", 11u},
+  {"from-id.com", 11u},
+  {"from-il.com", 11u},
+  {"from-in.com", 11u},
+  {"from-ks.com", 11u},
+  {"from-ky.com", 11u},
+  {"from-la.net", 11u},
+  {"from-ma.com", 11u},
+  {"from-md.com", 11u},
+  {"from-me.org", 11u},
+  {"from-mi.com", 11u},
+  {"from-mn.com", 11u},
+  {"from-mo.com", 11u},
+  {"from-ms.com", 11u},
+  {"from-mt.com", 11u},
+  {"from-nc.com", 11u},
+  {"from-nd.com", 11u},
+  {"from-ne.com", 11u},
+  {"from-nh.com", 11u},
+  {"from-nj.com", 11u},
+  {"from-nm.com", 11u},
+  {"from-nv.com", 11u},
+  {"from-ny.net", 11u},
+  {"from-oh.com", 11u},
+  {"from-ok.com", 11u},
+  {"from-or.com", 11u},
+  {"from-pa.com", 11u},
+  {"from-pr.com", 11u},
+  {"from-ri.com", 11u},
+  {"from-sc.com", 11u},
+  {"from-sd.com", 11u},
+  {"from-tn.com", 11u},
+  {"from-tx.com", 11u},
+  {"from-ut.com", 11u},
+  {"from-va.com", 11u},
+  {"from-vt.com", 11u},
+  {"from-wa.com", 11u},
+  {"from-wi.com", 11u},
+  {"from-wv.com", 11u},
+  {"from-wy.com", 11u},
+  {"from.hr", 7u},
+  {"from.marketing", 14u},
+  {"from.work", 9u},
+  {"frontdoor", 9u},
+  {"frontier", 8u},
+  {"frosinone.it", 12u},
+  {"frosta.no", 9u},
+  {"froya.no", 8u},
+  {"fr\303\246na.no", 9u},
+  {"fr\303\270ya.no", 9u},
+  {"fst.br", 6u},
+  {"ftpaccess.cc", 12u},
+  {"ftr", 3u},
+  {"fuchu.hiroshima.jp", 18u},
+  {"fuchu.tokyo.jp", 14u},
+  {"fuchu.toyama.jp", 15u},
+  {"fudai.iwate.jp", 14u},
+  {"fuefuki.yamanashi.jp", 20u},
+  {"fuel.aero", 9u},
+  {"fuettertdasnetz.de", 18u},
+  {"fuji.shizuoka.jp", 16u},
+  {"fujieda.shizuoka.jp", 19u},
+  {"fujiidera.osaka.jp", 18u},
+  {"fujikawa.shizuoka.jp", 20u},
+  {"fujikawa.yamanashi.jp", 21u},
+  {"fujikawaguchiko.yamanashi.jp", 28u},
+  {"fujimi.nagano.jp", 16u},
+  {"fujimi.saitama.jp", 17u},
+  {"fujimino.saitama.jp", 19u},
+  {"fujinomiya.shizuoka.jp", 22u},
+  {"fujioka.gunma.jp", 16u},
+  {"fujisato.akita.jp", 17u},
+  {"fujisawa.iwate.jp", 17u},
+  {"fujisawa.kanagawa.jp", 20u},
+  {"fujishiro.ibaraki.jp", 20u},
+  {"fujitsu", 7u},
+  {"fujiyoshida.yamanashi.jp", 24u},
+  {"fukagawa.hokkaido.jp", 20u},
+  {"fukaya.saitama.jp", 17u},
+  {"fukuchi.fukuoka.jp", 18u},
+  {"fukuchiyama.kyoto.jp", 20u},
+  {"fukudomi.saga.jp", 16u},
+  {"fukui.fukui.jp", 14u},
+  {"fukui.jp", 8u},
+  {"fukumitsu.toyama.jp", 19u},
+  {"fukuoka.jp", 10u},
+  {"fukuroi.shizuoka.jp", 19u},
+  {"fukusaki.hyogo.jp", 17u},
+  {"fukushima.fukushima.jp", 22u},
+  {"fukushima.hokkaido.jp", 21u},
+  {"fukushima.jp", 12u},
+  {"fukuyama.hiroshima.jp", 21u},
+  {"fun", 3u},
+  {"funabashi.chiba.jp", 18u},
+  {"funagata.yamagata.jp", 20u},
+  {"funahashi.toyama.jp", 19u},
+  {"functions.fnc.fr-par.scw.cloud", 30u},
+  {"fund", 4u},
+  {"fundacio.museum", 15u},
+  {"fuoisku.no", 10u},
+  {"fuossko.no", 10u},
+  {"furano.hokkaido.jp", 18u},
+  {"furniture", 9u},
+  {"furniture.museum", 16u},
+  {"furubira.hokkaido.jp", 20u},
+  {"furudono.fukushima.jp", 21u},
+  {"furukawa.miyagi.jp", 18u},
+  {"fusa.no", 7u},
+  {"fuso.aichi.jp", 13u},
+  {"fussa.tokyo.jp", 14u},
+  {"futaba.fukushima.jp", 19u},
+  {"futbol", 6u},
+  {"futsu.nagasaki.jp", 17u},
+  {"futtsu.chiba.jp", 15u},
+  {"futurehosting.at", 16u},
+  {"futuremailing.at", 16u},
+  {"fvg.it", 6u},
+  {"fyi", 3u},
+  {"fylkesbibl.no", 13u},
+  {"fyresdal.no", 11u},
+  {"f\303\270rde.no", 9u},
+  {"g.bg", 4u},
+  {"g.se", 4u},
+  {"g.vbrplsbx.io", 13u},
+  {"g12.br", 6u},
+  {"ga", 2u},
+  {"ga.us", 5u},
+  {"gaivuotna.no", 12u},
+  {"gal", 3u},
+  {"gallery", 7u},
+  {"gallery.museum", 14u},
+  {"gallo", 5u},
+  {"gallup", 6u},
+  {"galsa.no", 8u},
+  {"gamagori.aichi.jp", 17u},
+  {"game", 4u},
+  {"game-host.org", 13u},
+  {"game-server.cc", 14u},
+  {"game.tw", 7u},
+  {"games", 5u},
+  {"games.hu", 8u},
+  {"gamo.shiga.jp", 13u},
+  {"gamvik.no", 9u},
+  {"gangaviika.no", 13u},
+  {"gangwon.kr", 10u},
+  {"gap", 3u},
+  {"garden", 6u},
+  {"garden.museum", 13u},
+  {"gateway.museum", 14u},
+  {"gaular.no", 9u},
+  {"gausdal.no", 10u},
+  {"gay", 3u},
+  {"gb", 2u},
+  {"gb.net", 6u},
+  {"gbiz", 4u},
+  {"gc.ca", 5u},
+  {"gd", 2u},
+  {"gd.cn", 5u},
+  {"gda.pl", 6u},
+  {"gdansk.pl", 9u},
+  {"gdn", 3u},
+  {"gdynia.pl", 9u},
+  {"ge", 2u},
+  {"ge.it", 5u},
+  {"gea", 3u},
+  {"geek.nz", 7u},
+  {"geekgalaxy.com", 14u},
+  {"geelvinck.museum", 16u},
+  {"gehirn.ne.jp", 12u},
+  {"geisei.kochi.jp", 15u},
+  {"gemological.museum", 18u},
+  {"gen.in", 6u},
+  {"gen.mi.us", 9u},
+  {"gen.ng", 6u},
+  {"gen.nz", 6u},
+  {"gen.tr", 6u},
+  {"genkai.saga.jp", 14u},
+  {"genoa.it", 8u},
+  {"genova.it", 9u},
+  {"gent", 4u},
+  {"gentapps.com", 12u},
+  {"genting", 7u},
+  {"gentlentapis.com", 16u},
+  {"geo.br", 6u},
+  {"geology.museum", 14u},
+  {"geometre-expert.fr", 18u},
+  {"george", 6u},
+  {"georgia.museum", 14u},
+  {"georgia.su", 10u},
+  {"getmyip.com", 11u},
+  {"gets-it.net", 11u},
+  {"gf", 2u},
+  {"gg", 2u},
+  {"gg.ax", 5u},
+  {"ggee", 4u},
+  {"ggf.br", 6u},
+  {"gh", 2u},
+  {"ghost.io", 8u},
+  {"gi", 2u},
+  {"giehtavuoatna.no", 16u},
+  {"giessen.museum", 14u},
+  {"gift", 4u},
+  {"gifts", 5u},
+  {"gifu.gifu.jp", 12u},
+  {"gifu.jp", 7u},
+  {"giize.com", 9u},
+  {"gildeskal.no", 12u},
+  {"gildesk\303\245l.no", 13u},
+  {"ginan.gifu.jp", 13u},
+  {"ginowan.okinawa.jp", 18u},
+  {"ginoza.okinawa.jp", 17u},
+  {"girlfriend.jp", 13u},
+  {"girly.jp", 8u},
+  {"giske.no", 8u},
+  {"git-pages.rit.edu", 17u},
+  {"git-repos.de", 12u},
+  {"gitapp.si", 9u},
+  {"github.io", 9u},
+  {"githubpreview.dev", 17u},
+  {"githubusercontent.com", 21u},
+  {"gitlab.io", 9u},
+  {"gitpage.si", 10u},
+  {"gives", 5u},
+  {"giving", 6u},
+  {"gjemnes.no", 10u},
+  {"gjerdrum.no", 11u},
+  {"gjerstad.no", 11u},
+  {"gjesdal.no", 10u},
+  {"gjovik.no", 9u},
+  {"gj\303\270vik.no", 10u},
+  {"gl", 2u},
+  {"glas.museum", 11u},
+  {"glass", 5u},
+  {"glass.museum", 12u},
+  {"gle", 3u},
+  {"gleeze.com", 10u},
+  {"gliding.aero", 12u},
+  {"glitch.me", 9u},
+  {"gliwice.pl", 10u},
+  {"global", 6u},
+  {"global.prod.fastly.net", 22u},
+  {"global.ssl.fastly.net", 21u},
+  {"globo", 5u},
+  {"glogow.pl", 9u},
+  {"gloomy.jp", 9u},
+  {"gloppen.no", 10u},
+  {"glug.org.uk", 11u},
+  {"gm", 2u},
+  {"gmail", 5u},
+  {"gmbh", 4u},
+  {"gmina.pl", 8u},
+  {"gmo", 3u},
+  {"gmx", 3u},
+  {"gn", 2u},
+  {"gniezno.pl", 10u},
+  {"go.ci", 5u},
+  {"go.cr", 5u},
+  {"go.dyndns.org", 13u},
+  {"go.gov.br", 9u},
+  {"go.id", 5u},
+  {"go.it", 5u},
+  {"go.jp", 5u},
+  {"go.ke", 5u},
+  {"go.kr", 5u},
+  {"go.leg.br", 9u},
+  {"go.pw", 5u},
+  {"go.th", 5u},
+  {"go.tj", 5u},
+  {"go.tz", 5u},
+  {"go.ug", 5u},
+  {"gob.ar", 6u},
+  {"gob.bo", 6u},
+  {"gob.cl", 6u},
+  {"gob.do", 6u},
+  {"gob.ec", 6u},
+  {"gob.es", 6u},
+  {"gob.gt", 6u},
+  {"gob.hn", 6u},
+  {"gob.mx", 6u},
+  {"gob.ni", 6u},
+  {"gob.pa", 6u},
+  {"gob.pe", 6u},
+  {"gob.pk", 6u},
+  {"gob.sv", 6u},
+  {"gob.ve", 6u},
+  {"gobo.wakayama.jp", 16u},
+  {"godaddy", 7u},
+  {"godo.gifu.jp", 12u},
+  {"goiania.br", 10u},
+  {"goip.de", 7u},
+  {"gojome.akita.jp", 15u},
+  {"gok.pk", 6u},
+  {"gokase.miyazaki.jp", 18u},
+  {"gol.no", 6u},
+  {"gold", 4u},
+  {"goldpoint", 9u},
+  {"golf", 4u},
+  {"golffan.us", 10u},
+  {"gon.pk", 6u},
+  {"gonna.jp", 8u},
+  {"gonohe.aomori.jp", 16u},
+  {"goo", 3u},
+  {"goodyear", 8u},
+  {"goog", 4u},
+  {"google", 6u},
+  {"googleapis.com", 14u},
+  {"googlecode.com", 14u},
+  {"gop", 3u},
+  {"gop.pk", 6u},
+  {"gorge.museum", 12u},
+  {"gorizia.it", 10u},
+  {"gorlice.pl", 10u},
+  {"gos.pk", 6u},
+  {"gose.nara.jp", 12u},
+  {"gosen.niigata.jp", 16u},
+  {"goshiki.hyogo.jp", 16u},
+  {"got", 3u},
+  {"gotdns.ch", 9u},
+  {"gotdns.com", 10u},
+  {"gotdns.org", 10u},
+  {"gotemba.shizuoka.jp", 19u},
+  {"goto.nagasaki.jp", 16u},
+  {"gotpantheon.com", 15u},
+  {"gotsu.shimane.jp", 16u},
+  {"goupile.fr", 10u},
+  {"gouv.bj", 7u},
+  {"gouv.ci", 7u},
+  {"gouv.fr", 7u},
+  {"gouv.ht", 7u},
+  {"gouv.km", 7u},
+  {"gouv.ml", 7u},
+  {"gouv.sn", 7u},
+  {"gov", 3u},
+  {"gov.ac", 6u},
+  {"gov.ae", 6u},
+  {"gov.af", 6u},
+  {"gov.al", 6u},
+  {"gov.ar", 6u},
+  {"gov.as", 6u},
+  {"gov.au", 6u},
+  {"gov.az", 6u},
+  {"gov.ba", 6u},
+  {"gov.bb", 6u},
+  {"gov.bf", 6u},
+  {"gov.bh", 6u},
+  {"gov.bm", 6u},
+  {"gov.bn", 6u},
+  {"gov.br", 6u},
+  {"gov.bs", 6u},
+  {"gov.bt", 6u},
+  {"gov.by", 6u},
+  {"gov.bz", 6u},
+  {"gov.cd", 6u},
+  {"gov.cl", 6u},
+  {"gov.cm", 6u},
+  {"gov.cn", 6u},
+  {"gov.co", 6u},
+  {"gov.cu", 6u},
+  {"gov.cx", 6u},
+  {"gov.cy", 6u},
+  {"gov.dm", 6u},
+  {"gov.do", 6u},
+  {"gov.dz", 6u},
+  {"gov.ec", 6u},
+  {"gov.ee", 6u},
+  {"gov.eg", 6u},
+  {"gov.et", 6u},
+  {"gov.fj", 6u},
+  {"gov.gd", 6u},
+  {"gov.ge", 6u},
+  {"gov.gh", 6u},
+  {"gov.gi", 6u},
+  {"gov.gn", 6u},
+  {"gov.gr", 6u},
+  {"gov.gu", 6u},
+  {"gov.gy", 6u},
+  {"gov.hk", 6u},
+  {"gov.ie", 6u},
+  {"gov.il", 6u},
+  {"gov.in", 6u},
+  {"gov.iq", 6u},
+  {"gov.ir", 6u},
+  {"gov.is", 6u},
+  {"gov.it", 6u},
+  {"gov.jo", 6u},
+  {"gov.kg", 6u},
+  {"gov.ki", 6u},
+  {"gov.km", 6u},
+  {"gov.kn", 6u},
+  {"gov.kp", 6u},
+  {"gov.kw", 6u},
+  {"gov.kz", 6u},
+  {"gov.la", 6u},
+  {"gov.lb", 6u},
+  {"gov.lc", 6u},
+  {"gov.lk", 6u},
+  {"gov.lr", 6u},
+  {"gov.ls", 6u},
+  {"gov.lt", 6u},
+  {"gov.lv", 6u},
+  {"gov.ly", 6u},
+  {"gov.ma", 6u},
+  {"gov.me", 6u},
+  {"gov.mg", 6u},
+  {"gov.mk", 6u},
+  {"gov.ml", 6u},
+  {"gov.mn", 6u},
+  {"gov.mo", 6u},
+  {"gov.mr", 6u},
+  {"gov.ms", 6u},
+  {"gov.mu", 6u},
+  {"gov.mv", 6u},
+  {"gov.mw", 6u},
+  {"gov.my", 6u},
+  {"gov.mz", 6u},
+  {"gov.nc.tr", 9u},
+  {"gov.ng", 6u},
+  {"gov.nl", 6u},
+  {"gov.nr", 6u},
+  {"gov.om", 6u},
+  {"gov.ph", 6u},
+  {"gov.pk", 6u},
+  {"gov.pl", 6u},
+  {"gov.pn", 6u},
+  {"gov.pr", 6u},
+  {"gov.ps", 6u},
+  {"gov.pt", 6u},
+  {"gov.py", 6u},
+  {"gov.qa", 6u},
+  {"gov.rs", 6u},
+  {"gov.ru", 6u},
+  {"gov.rw", 6u},
+  {"gov.sa", 6u},
+  {"gov.sb", 6u},
+  {"gov.sc", 6u},
+  {"gov.scot", 8u},
+  {"gov.sd", 6u},
+  {"gov.sg", 6u},
+  {"gov.sh", 6u},
+  {"gov.sl", 6u},
+  {"gov.so", 6u},
+  {"gov.ss", 6u},
+  {"gov.sx", 6u},
+  {"gov.sy", 6u},
+  {"gov.tj", 6u},
+  {"gov.tl", 6u},
+  {"gov.tm", 6u},
+  {"gov.tn", 6u},
+  {"gov.to", 6u},
+  {"gov.tr", 6u},
+  {"gov.tt", 6u},
+  {"gov.tw", 6u},
+  {"gov.ua", 6u},
+  {"gov.uk", 6u},
+  {"gov.vc", 6u},
+  {"gov.ve", 6u},
+  {"gov.vn", 6u},
+  {"gov.ws", 6u},
+  {"gov.ye", 6u},
+  {"gov.za", 6u},
+  {"gov.zm", 6u},
+  {"gov.zw", 6u},
+  {"government.aero", 15u},
+  {"govt.nz", 7u},
+  {"gp", 2u},
+  {"gq", 2u},
+  {"gr", 2u},
+  {"gr.com", 6u},
+  {"gr.eu.org", 9u},
+  {"gr.it", 5u},
+  {"gr.jp", 5u},
+  {"grainger", 8u},
+  {"grajewo.pl", 10u},
+  {"gran.no", 7u},
+  {"grandrapids.museum", 18u},
+  {"grane.no", 8u},
+  {"granvin.no", 10u},
+  {"graphics", 8u},
+  {"graphox.us", 10u},
+  {"gratangen.no", 12u},
+  {"gratis", 6u},
+  {"graz.museum", 11u},
+  {"greater.jp", 10u},
+  {"green", 5u},
+  {"greta.fr", 8u},
+  {"grimstad.no", 11u},
+  {"gripe", 5u},
+  {"griw.gov.pl", 11u},
+  {"grocery", 7u},
+  {"groks-the.info", 14u},
+  {"groks-this.info", 15u},
+  {"grondar.za", 10u},
+  {"grong.no", 8u},
+  {"grosseto.it", 11u},
+  {"groundhandling.aero", 19u},
+  {"group", 5u},
+  {"group.aero", 10u},
+  {"grozny.ru", 9u},
+  {"grozny.su", 9u},
+  {"grp.lk", 6u},
+  {"gru.br", 6u},
+  {"grue.no", 7u},
+  {"gs", 2u},
+  {"gs.aa.no", 8u},
+  {"gs.ah.no", 8u},
+  {"gs.bu.no", 8u},
+  {"gs.cn", 5u},
+  {"gs.fm.no", 8u},
+  {"gs.hl.no", 8u},
+  {"gs.hm.no", 8u},
+  {"gs.jan-mayen.no", 15u},
+  {"gs.mr.no", 8u},
+  {"gs.nl.no", 8u},
+  {"gs.nt.no", 8u},
+  {"gs.of.no", 8u},
+  {"gs.ol.no", 8u},
+  {"gs.oslo.no", 10u},
+  {"gs.rl.no", 8u},
+  {"gs.sf.no", 8u},
+  {"gs.st.no", 8u},
+  {"gs.svalbard.no", 14u},
+  {"gs.tm.no", 8u},
+  {"gs.tr.no", 8u},
+  {"gs.va.no", 8u},
+  {"gs.vf.no", 8u},
+  {"gsj.bz", 6u},
+  {"gsm.pl", 6u},
+  {"gt", 2u},
+  {"gu", 2u},
+  {"gu.us", 5u},
+  {"guam.gu", 7u},
+  {"guardian", 8u},
+  {"gub.uy", 6u},
+  {"gucci", 5u},
+  {"guernsey.museum", 15u},
+  {"guge", 4u},
+  {"guide", 5u},
+  {"guitars", 7u},
+  {"gujarat.in", 10u},
+  {"gujo.gifu.jp", 12u},
+  {"gulen.no", 8u},
+  {"gunma.jp", 8u},
+  {"guovdageaidnu.no", 16u},
+  {"guru", 4u},
+  {"gushikami.okinawa.jp", 20u},
+  {"gv.ao", 5u},
+  {"gv.at", 5u},
+  {"gv.vc", 5u},
+  {"gw", 2u},
+  {"gwangju.kr", 10u},
+  {"gwiddle.co.uk", 13u},
+  {"gx.cn", 5u},
+  {"gy", 2u},
+  {"gyeongbuk.kr", 12u},
+  {"gyeonggi.kr", 11u},
+  {"gyeongnam.kr", 12u},
+  {"gyokuto.kumamoto.jp", 19u},
+  {"gz.cn", 5u},
+  {"g\303\241ivuotna.no", 13u},
+  {"g\303\241ls\303\241.no", 10u},
+  {"g\303\241\305\213gaviika.no", 15u},
+  {"g\303\274nstigbestellen.de", 20u},
+  {"g\303\274nstigliefern.de", 18u},
+  {"h.bg", 4u},
+  {"h.se", 4u},
+  {"ha.cn", 5u},
+  {"ha.no", 5u},
+  {"habikino.osaka.jp", 17u},
+  {"habmer.no", 9u},
+  {"haboro.hokkaido.jp", 18u},
+  {"hacca.jp", 8u},
+  {"hachijo.tokyo.jp", 16u},
+  {"hachinohe.aomori.jp", 19u},
+  {"hachioji.tokyo.jp", 17u},
+  {"hachirogata.akita.jp", 20u},
+  {"hadano.kanagawa.jp", 18u},
+  {"hadsel.no", 9u},
+  {"haebaru.okinawa.jp", 18u},
+  {"haga.tochigi.jp", 15u},
+  {"hagebostad.no", 13u},
+  {"hagi.yamaguchi.jp", 17u},
+  {"haibara.shizuoka.jp", 19u},
+  {"hair", 4u},
+  {"hakata.fukuoka.jp", 17u},
+  {"hakodate.hokkaido.jp", 20u},
+  {"hakone.kanagawa.jp", 18u},
+  {"hakuba.nagano.jp", 16u},
+  {"hakui.ishikawa.jp", 17u},
+  {"hakusan.ishikawa.jp", 19u},
+  {"halden.no", 9u},
+  {"half.host", 9u},
+  {"halloffame.museum", 17u},
+  {"halsa.no", 8u},
+  {"ham-radio-op.net", 16u},
+  {"hamada.shimane.jp", 17u},
+  {"hamamatsu.shizuoka.jp", 21u},
+  {"hamar.no", 8u},
+  {"hamaroy.no", 10u},
+  {"hamatama.saga.jp", 16u},
+  {"hamatonbetsu.hokkaido.jp", 24u},
+  {"hamburg", 7u},
+  {"hamburg.museum", 14u},
+  {"hammarfeasta.no", 15u},
+  {"hammerfest.no", 13u},
+  {"hamura.tokyo.jp", 15u},
+  {"hanamaki.iwate.jp", 17u},
+  {"hanamigawa.chiba.jp", 19u},
+  {"hanawa.fukushima.jp", 19u},
+  {"handa.aichi.jp", 14u},
+  {"handcrafted.jp", 14u},
+  {"handson.museum", 14u},
+  {"hanggliding.aero", 16u},
+  {"hangout", 7u},
+  {"hannan.osaka.jp", 15u},
+  {"hanno.saitama.jp", 16u},
+  {"hanyu.saitama.jp", 16u},
+  {"hapmir.no", 9u},
+  {"happou.akita.jp", 15u},
+  {"hara.nagano.jp", 14u},
+  {"haram.no", 8u},
+  {"hareid.no", 9u},
+  {"harima.hyogo.jp", 15u},
+  {"harstad.no", 10u},
+  {"harvestcelebration.museum", 25u},
+  {"hasama.oita.jp", 14u},
+  {"hasami.nagasaki.jp", 18u},
+  {"hashbang.sh", 11u},
+  {"hashikami.aomori.jp", 19u},
+  {"hashima.gifu.jp", 15u},
+  {"hashimoto.wakayama.jp", 21u},
+  {"hasuda.saitama.jp", 17u},
+  {"hasura-app.io", 13u},
+  {"hasura.app", 10u},
+  {"hasvik.no", 9u},
+  {"hatogaya.saitama.jp", 19u},
+  {"hatoyama.saitama.jp", 19u},
+  {"hatsukaichi.hiroshima.jp", 24u},
+  {"hattfjelldal.no", 15u},
+  {"haugesund.no", 12u},
+  {"haus", 4u},
+  {"hawaii.museum", 13u},
+  {"hayakawa.yamanashi.jp", 21u},
+  {"hayashima.okayama.jp", 20u},
+  {"hazu.aichi.jp", 13u},
+  {"hb.cldmail.ru", 13u},
+  {"hb.cn", 5u},
+  {"hbo", 3u},
+  {"hdfc", 4u},
+  {"hdfcbank", 8u},
+  {"he.cn", 5u},
+  {"health", 6u},
+  {"health-carereform.com", 21u},
+  {"health.museum", 13u},
+  {"health.nz", 9u},
+  {"health.vn", 9u},
+  {"healthcare", 10u},
+  {"heavy.jp", 8u},
+  {"heguri.nara.jp", 14u},
+  {"heimatunduhren.museum", 21u},
+  {"hekinan.aichi.jp", 16u},
+  {"hellas.museum", 13u},
+  {"help", 4u},
+  {"helsinki", 8u},
+  {"helsinki.museum", 15u},
+  {"hembygdsforbund.museum", 22u},
+  {"hemne.no", 8u},
+  {"hemnes.no", 9u},
+  {"hemsedal.no", 11u},
+  {"hepforge.org", 12u},
+  {"her.jp", 6u},
+  {"herad.no", 8u},
+  {"here", 4u},
+  {"here-for-more.info", 18u},
+  {"heritage.museum", 15u},
+  {"hermes", 6u},
+  {"herokuapp.com", 13u},
+  {"herokussl.com", 13u},
+  {"heroy.more-og-romsdal.no", 24u},
+  {"heroy.nordland.no", 17u},
+  {"her\303\270y.m\303\270re-og-romsdal.no", 26u},
+  {"her\303\270y.nordland.no", 18u},
+  {"heteml.net", 10u},
+  {"hgtv", 4u},
+  {"hi.cn", 5u},
+  {"hi.us", 5u},
+  {"hicam.net", 9u},
+  {"hichiso.gifu.jp", 15u},
+  {"hida.gifu.jp", 12u},
+  {"hidaka.hokkaido.jp", 18u},
+  {"hidaka.kochi.jp", 15u},
+  {"hidaka.saitama.jp", 17u},
+  {"hidaka.wakayama.jp", 18u},
+  {"hidora.com", 10u},
+  {"higashi.fukuoka.jp", 18u},
+  {"higashi.fukushima.jp", 20u},
+  {"higashi.okinawa.jp", 18u},
+  {"higashiagatsuma.gunma.jp", 24u},
+  {"higashichichibu.saitama.jp", 26u},
+  {"higashihiroshima.hiroshima.jp", 29u},
+  {"higashiizu.shizuoka.jp", 22u},
+  {"higashiizumo.shimane.jp", 23u},
+  {"higashikagawa.kagawa.jp", 23u},
+  {"higashikagura.hokkaido.jp", 25u},
+  {"higashikawa.hokkaido.jp", 23u},
+  {"higashikurume.tokyo.jp", 22u},
+  {"higashimatsushima.miyagi.jp", 27u},
+  {"higashimatsuyama.saitama.jp", 27u},
+  {"higashimurayama.tokyo.jp", 24u},
+  {"higashinaruse.akita.jp", 22u},
+  {"higashine.yamagata.jp", 21u},
+  {"higashiomi.shiga.jp", 19u},
+  {"higashiosaka.osaka.jp", 21u},
+  {"higashishirakawa.gifu.jp", 24u},
+  {"higashisumiyoshi.osaka.jp", 25u},
+  {"higashitsuno.kochi.jp", 21u},
+  {"higashiura.aichi.jp", 19u},
+  {"higashiyama.kyoto.jp", 20u},
+  {"higashiyamato.tokyo.jp", 22u},
+  {"higashiyodogawa.osaka.jp", 24u},
+  {"higashiyoshino.nara.jp", 22u},
+  {"hiho.jp", 7u},
+  {"hiji.oita.jp", 12u},
+  {"hikari.yamaguchi.jp", 19u},
+  {"hikawa.shimane.jp", 17u},
+  {"hikimi.shimane.jp", 17u},
+  {"hikone.shiga.jp", 15u},
+  {"himeji.hyogo.jp", 15u},
+  {"himeshima.oita.jp", 17u},
+  {"himi.toyama.jp", 14u},
+  {"hino.tokyo.jp", 13u},
+  {"hino.tottori.jp", 15u},
+  {"hinode.tokyo.jp", 15u},
+  {"hinohara.tokyo.jp", 17u},
+  {"hioki.kagoshima.jp", 18u},
+  {"hiphop", 6u},
+  {"hippy.jp", 8u},
+  {"hirado.nagasaki.jp", 18u},
+  {"hiraizumi.iwate.jp", 18u},
+  {"hirakata.osaka.jp", 17u},
+  {"hiranai.aomori.jp", 17u},
+  {"hirara.okinawa.jp", 17u},
+  {"hirata.fukushima.jp", 19u},
+  {"hiratsuka.kanagawa.jp", 21u},
+  {"hiraya.nagano.jp", 16u},
+  {"hirogawa.wakayama.jp", 20u},
+  {"hirokawa.fukuoka.jp", 19u},
+  {"hirono.fukushima.jp", 19u},
+  {"hirono.iwate.jp", 15u},
+  {"hiroo.hokkaido.jp", 17u},
+  {"hirosaki.aomori.jp", 18u},
+  {"hiroshima.jp", 12u},
+  {"hisamitsu", 9u},
+  {"hisayama.fukuoka.jp", 19u},
+  {"histoire.museum", 15u},
+  {"historical.museum", 17u},
+  {"historicalsociety.museum", 24u},
+  {"historichouses.museum", 21u},
+  {"historisch.museum", 17u},
+  {"historisches.museum", 19u},
+  {"history.museum", 14u},
+  {"historyofscience.museum", 23u},
+  {"hita.oita.jp", 12u},
+  {"hitachi", 7u},
+  {"hitachi.ibaraki.jp", 18u},
+  {"hitachinaka.ibaraki.jp", 22u},
+  {"hitachiomiya.ibaraki.jp", 23u},
+  {"hitachiota.ibaraki.jp", 21u},
+  {"hitra.no", 8u},
+  {"hiv", 3u},
+  {"hizen.saga.jp", 13u},
+  {"hjartdal.no", 11u},
+  {"hjelmeland.no", 13u},
+  {"hk", 2u},
+  {"hk.cn", 5u},
+  {"hk.com", 6u},
+  {"hk.org", 6u},
+  {"hkt", 3u},
+  {"hl.cn", 5u},
+  {"hl.no", 5u},
+  {"hlx.live", 8u},
+  {"hlx.page", 8u},
+  {"hlx3.page", 9u},
+  {"hm", 2u},
+  {"hm.no", 5u},
+  {"hn", 2u},
+  {"hn.cn", 5u},
+  {"hobby-site.com", 14u},
+  {"hobby-site.org", 14u},
+  {"hobol.no", 8u},
+  {"hob\303\270l.no", 9u},
+  {"hockey", 6u},
+  {"hof.no", 6u},
+  {"hofu.yamaguchi.jp", 17u},
+  {"hokkaido.jp", 11u},
+  {"hokksund.no", 11u},
+  {"hokuryu.hokkaido.jp", 19u},
+  {"hokuto.hokkaido.jp", 18u},
+  {"hokuto.yamanashi.jp", 19u},
+  {"hol.no", 6u},
+  {"holdings", 8u},
+  {"hole.no", 7u},
+  {"holiday", 7u},
+  {"holmestrand.no", 14u},
+  {"holtalen.no", 11u},
+  {"holt\303\245len.no", 12u},
+  {"holy.jp", 7u},
+  {"home-webserver.de", 17u},
+  {"home.dyndns.org", 15u},
+  {"homebuilt.aero", 14u},
+  {"homedepot", 9u},
+  {"homedns.org", 11u},
+  {"homeftp.net", 11u},
+  {"homeftp.org", 11u},
+  {"homegoods", 9u},
+  {"homeip.net", 10u},
+  {"homelink.one", 12u},
+  {"homelinux.com", 13u},
+  {"homelinux.net", 13u},
+  {"homelinux.org", 13u},
+  {"homeoffice.gov.uk", 17u},
+  {"homes", 5u},
+  {"homesecuritymac.com", 19u},
+  {"homesecuritypc.com", 18u},
+  {"homesense", 9u},
+  {"homesklep.pl", 12u},
+  {"homeunix.com", 12u},
+  {"homeunix.net", 12u},
+  {"homeunix.org", 12u},
+  {"honai.ehime.jp", 14u},
+  {"honbetsu.hokkaido.jp", 20u},
+  {"honda", 5u},
+  {"honefoss.no", 11u},
+  {"hongo.hiroshima.jp", 18u},
+  {"honjo.akita.jp", 14u},
+  {"honjo.saitama.jp", 16u},
+  {"honjyo.akita.jp", 15u},
+  {"hoplix.shop", 11u},
+  {"hopto.me", 8u},
+  {"hopto.org", 9u},
+  {"hornindal.no", 12u},
+  {"horokanai.hokkaido.jp", 21u},
+  {"horology.museum", 15u},
+  {"horonobe.hokkaido.jp", 20u},
+  {"horse", 5u},
+  {"horten.no", 9u},
+  {"hosp.uk", 7u},
+  {"hospital", 8u},
+  {"host", 4u},
+  {"hostedpi.com", 12u},
+  {"hosting", 7u},
+  {"hosting-cluster.nl", 18u},
+  {"hostyhosting.io", 15u},
+  {"hot", 3u},
+  {"hotel.hu", 8u},
+  {"hotel.lk", 8u},
+  {"hotel.tz", 8u},
+  {"hoteles", 7u},
+  {"hotels", 6u},
+  {"hotelwithflight.com", 19u},
+  {"hotmail", 7u},
+  {"house", 5u},
+  {"house.museum", 12u},
+  {"how", 3u},
+  {"hoyanger.no", 11u},
+  {"hoylandet.no", 12u},
+  {"hr", 2u},
+  {"hr.eu.org", 9u},
+  {"hra.health", 10u},
+  {"hs.kr", 5u},
+  {"hs.run", 6u},
+  {"hs.zone", 7u},
+  {"hsbc", 4u},
+  {"ht", 2u},
+  {"httpbin.org", 11u},
+  {"hu", 2u},
+  {"hu.com", 6u},
+  {"hu.eu.org", 9u},
+  {"hu.net", 6u},
+  {"hughes", 6u},
+  {"huissier-justice.fr", 19u},
+  {"humanities.museum", 17u},
+  {"hungry.jp", 9u},
+  {"hurdal.no", 9u},
+  {"hurum.no", 8u},
+  {"hvaler.no", 9u},
+  {"hyatt", 5u},
+  {"hyllestad.no", 12u},
+  {"hyogo.jp", 8u},
+  {"hyuga.miyazaki.jp", 17u},
+  {"hyundai", 7u},
+  {"hzc.io", 6u},
+  {"h\303\241bmer.no", 10u},
+  {"h\303\241mm\303\241rfeasta.no", 17u},
+  {"h\303\241pmir.no", 10u},
+  {"h\303\244kkinen.fi", 12u},
+  {"h\303\245.no", 6u},
+  {"h\303\246gebostad.no", 14u},
+  {"h\303\270nefoss.no", 12u},
+  {"h\303\270yanger.no", 12u},
+  {"h\303\270ylandet.no", 13u},
+  {"i.bg", 4u},
+  {"i.ng", 4u},
+  {"i.ph", 4u},
+  {"i.se", 4u},
+  {"i234.me", 7u},
+  {"ia.us", 5u},
+  {"iamallama.com", 13u},
+  {"ibara.okayama.jp", 16u},
+  {"ibaraki.ibaraki.jp", 18u},
+  {"ibaraki.jp", 10u},
+  {"ibaraki.osaka.jp", 16u},
+  {"ibestad.no", 10u},
+  {"ibigawa.gifu.jp", 15u},
+  {"ibm", 3u},
+  {"ibxos.it", 8u},
+  {"ic.gov.pl", 9u},
+  {"icbc", 4u},
+  {"ice", 3u},
+  {"ichiba.tokushima.jp", 19u},
+  {"ichihara.chiba.jp", 17u},
+  {"ichikai.tochigi.jp", 18u},
+  {"ichikawa.chiba.jp", 17u},
+  {"ichikawa.hyogo.jp", 17u},
+  {"ichikawamisato.yamanashi.jp", 27u},
+  {"ichinohe.iwate.jp", 17u},
+  {"ichinomiya.aichi.jp", 19u},
+  {"ichinomiya.chiba.jp", 19u},
+  {"ichinoseki.iwate.jp", 19u},
+  {"icu", 3u},
+  {"icurus.jp", 9u},
+  {"id", 2u},
+  {"id.au", 5u},
+  {"id.firewalledreplit.co", 22u},
+  {"id.forgerock.io", 15u},
+  {"id.ir", 5u},
+  {"id.lv", 5u},
+  {"id.ly", 5u},
+  {"id.repl.co", 10u},
+  {"id.us", 5u},
+  {"ide.kyoto.jp", 12u},
+  {"idf.il", 6u},
+  {"idrett.no", 9u},
+  {"idv.hk", 6u},
+  {"idv.tw", 6u},
+  {"ie", 2u},
+  {"ie.eu.org", 9u},
+  {"ieee", 4u},
+  {"if.ua", 5u},
+  {"ifm", 3u},
+  {"iglesias-carbonia.it", 20u},
+  {"iglesiascarbonia.it", 19u},
+  {"iheya.okinawa.jp", 16u},
+  {"iida.nagano.jp", 14u},
+  {"iide.yamagata.jp", 16u},
+  {"iijima.nagano.jp", 16u},
+  {"iitate.fukushima.jp", 19u},
+  {"iiyama.nagano.jp", 16u},
+  {"iizuka.fukuoka.jp", 17u},
+  {"iizuna.nagano.jp", 16u},
+  {"ikano", 5u},
+  {"ikaruga.nara.jp", 15u},
+  {"ikata.ehime.jp", 14u},
+  {"ikawa.akita.jp", 14u},
+  {"ikeda.fukui.jp", 14u},
+  {"ikeda.gifu.jp", 13u},
+  {"ikeda.hokkaido.jp", 17u},
+  {"ikeda.nagano.jp", 15u},
+  {"ikeda.osaka.jp", 14u},
+  {"iki.fi", 6u},
+  {"iki.nagasaki.jp", 15u},
+  {"ikoma.nara.jp", 13u},
+  {"ikusaka.nagano.jp", 17u},
+  {"il", 2u},
+  {"il.eu.org", 9u},
+  {"il.us", 5u},
+  {"ilawa.pl", 8u},
+  {"iliadboxos.it", 13u},
+  {"illustration.museum", 19u},
+  {"ilovecollege.info", 17u},
+  {"im", 2u},
+  {"im.it", 5u},
+  {"imabari.ehime.jp", 16u},
+  {"imageandsound.museum", 20u},
+  {"imakane.hokkaido.jp", 19u},
+  {"imamat", 6u},
+  {"imari.saga.jp", 13u},
+  {"imb.br", 6u},
+  {"imdb", 4u},
+  {"imizu.toyama.jp", 15u},
+  {"immo", 4u},
+  {"immobilien", 10u},
+  {"imperia.it", 10u},
+  {"impertrix.com", 13u},
+  {"impertrixcdn.com", 16u},
+  {"in", 2u},
+  {"in-addr.arpa", 12u},
+  {"in-berlin.de", 12u},
+  {"in-brb.de", 9u},
+  {"in-butter.de", 12u},
+  {"in-dsl.de", 9u},
+  {"in-dsl.net", 10u},
+  {"in-dsl.org", 10u},
+  {"in-the-band.net", 15u},
+  {"in-vpn.de", 9u},
+  {"in-vpn.net", 10u},
+  {"in-vpn.org", 10u},
+  {"in.eu.org", 9u},
+  {"in.london", 9u},
+  {"in.na", 5u},
+  {"in.net", 6u},
+  {"in.ni", 5u},
+  {"in.rs", 5u},
+  {"in.th", 5u},
+  {"in.ua", 5u},
+  {"in.us", 5u},
+  {"ina.ibaraki.jp", 14u},
+  {"ina.nagano.jp", 13u},
+  {"ina.saitama.jp", 14u},
+  {"inabe.mie.jp", 12u},
+  {"inagawa.hyogo.jp", 16u},
+  {"inagi.tokyo.jp", 14u},
+  {"inami.toyama.jp", 15u},
+  {"inami.wakayama.jp", 17u},
+  {"inashiki.ibaraki.jp", 19u},
+  {"inatsuki.fukuoka.jp", 19u},
+  {"inawashiro.fukushima.jp", 23u},
+  {"inazawa.aichi.jp", 16u},
+  {"inc", 3u},
+  {"inc.hk", 6u},
+  {"incheon.kr", 10u},
+  {"ind.br", 6u},
+  {"ind.gt", 6u},
+  {"ind.in", 6u},
+  {"ind.kw", 6u},
+  {"ind.tn", 6u},
+  {"independent-commission.uk", 25u},
+  {"independent-inquest.uk", 22u},
+  {"independent-inquiry.uk", 22u},
+  {"independent-panel.uk", 20u},
+  {"independent-review.uk", 21u},
+  {"inderoy.no", 10u},
+  {"inder\303\270y.no", 11u},
+  {"indian.museum", 13u},
+  {"indiana.museum", 14u},
+  {"indianapolis.museum", 19u},
+  {"indianmarket.museum", 19u},
+  {"indie.porn", 10u},
+  {"indigena.bo", 11u},
+  {"industria.bo", 12u},
+  {"industries", 10u},
+  {"ine.kyoto.jp", 12u},
+  {"inf.br", 6u},
+  {"inf.cu", 6u},
+  {"inf.mk", 6u},
+  {"inf.ua", 6u},
+  {"infiniti", 8u},
+  {"info", 4u},
+  {"info.at", 7u},
+  {"info.au", 7u},
+  {"info.az", 7u},
+  {"info.bb", 7u},
+  {"info.bo", 7u},
+  {"info.co", 7u},
+  {"info.cx", 7u},
+  {"info.ec", 7u},
+  {"info.et", 7u},
+  {"info.fj", 7u},
+  {"info.gu", 7u},
+  {"info.ht", 7u},
+  {"info.hu", 7u},
+  {"info.in", 7u},
+  {"info.ke", 7u},
+  {"info.ki", 7u},
+  {"info.la", 7u},
+  {"info.ls", 7u},
+  {"info.mv", 7u},
+  {"info.na", 7u},
+  {"info.nf", 7u},
+  {"info.ni", 7u},
+  {"info.nr", 7u},
+  {"info.pk", 7u},
+  {"info.pl", 7u},
+  {"info.pr", 7u},
+  {"info.ro", 7u},
+  {"info.sd", 7u},
+  {"info.tn", 7u},
+  {"info.tr", 7u},
+  {"info.tt", 7u},
+  {"info.tz", 7u},
+  {"info.ve", 7u},
+  {"info.vn", 7u},
+  {"info.zm", 7u},
+  {"ing", 3u},
+  {"ing.pa", 6u},
+  {"ingatlan.hu", 11u},
+  {"ink", 3u},
+  {"ino.kochi.jp", 12u},
+  {"instance.datadetect.com", 23u},
+  {"instances.spawn.cc", 18u},
+  {"instantcloud.cn", 15u},
+  {"institute", 9u},
+  {"insurance", 9u},
+  {"insurance.aero", 14u},
+  {"insure", 6u},
+  {"int", 3u},
+  {"int.ar", 6u},
+  {"int.az", 6u},
+  {"int.bo", 6u},
+  {"int.ci", 6u},
+  {"int.co", 6u},
+  {"int.cv", 6u},
+  {"int.eu.org", 10u},
+  {"int.in", 6u},
+  {"int.is", 6u},
+  {"int.la", 6u},
+  {"int.lk", 6u},
+  {"int.mv", 6u},
+  {"int.mw", 6u},
+  {"int.ni", 6u},
+  {"int.pt", 6u},
+  {"int.ru", 6u},
+  {"int.tj", 6u},
+  {"int.tt", 6u},
+  {"int.ve", 6u},
+  {"int.vn", 6u},
+  {"intelligence.museum", 19u},
+  {"interactive.museum", 18u},
+  {"international", 13u},
+  {"internet-dns.de", 15u},
+  {"internet.in", 11u},
+  {"intl.tn", 7u},
+  {"intuit", 6u},
+  {"inuyama.aichi.jp", 16u},
+  {"investments", 11u},
+  {"inzai.chiba.jp", 14u},
+  {"io", 2u},
+  {"io.in", 5u},
+  {"io.kg", 5u},
+  {"iobb.net", 8u},
+  {"iopsys.se", 9u},
+  {"ip.linodeusercontent.com", 24u},
+  {"ip6.arpa", 8u},
+  {"ipifony.net", 11u},
+  {"ipiranga", 8u},
+  {"iq", 2u},
+  {"ir", 2u},
+  {"iraq.museum", 11u},
+  {"iris.arpa", 9u},
+  {"irish", 5u},
+  {"iron.museum", 11u},
+  {"iruma.saitama.jp", 16u},
+  {"is", 2u},
+  {"is-a-anarchist.com", 18u},
+  {"is-a-blogger.com", 16u},
+  {"is-a-bookkeeper.com", 19u},
+  {"is-a-bruinsfan.org", 18u},
+  {"is-a-bulls-fan.com", 18u},
+  {"is-a-candidate.org", 18u},
+  {"is-a-caterer.com", 16u},
+  {"is-a-celticsfan.org", 19u},
+  {"is-a-chef.com", 13u},
+  {"is-a-chef.net", 13u},
+  {"is-a-chef.org", 13u},
+  {"is-a-conservative.com", 21u},
+  {"is-a-cpa.com", 12u},
+  {"is-a-cubicle-slave.com", 22u},
+  {"is-a-democrat.com", 17u},
+  {"is-a-designer.com", 17u},
+  {"is-a-doctor.com", 15u},
+  {"is-a-financialadvisor.com", 25u},
+  {"is-a-geek.com", 13u},
+  {"is-a-geek.net", 13u},
+  {"is-a-geek.org", 13u},
+  {"is-a-green.com", 14u},
+  {"is-a-guru.com", 13u},
+  {"is-a-hard-worker.com", 20u},
+  {"is-a-hunter.com", 15u},
+  {"is-a-knight.org", 15u},
+  {"is-a-landscaper.com", 19u},
+  {"is-a-lawyer.com", 15u},
+  {"is-a-liberal.com", 16u},
+  {"is-a-libertarian.com", 20u},
+  {"is-a-linux-user.org", 19u},
+  {"is-a-llama.com", 14u},
+  {"is-a-musician.com", 17u},
+  {"is-a-nascarfan.com", 18u},
+  {"is-a-nurse.com", 14u},
+  {"is-a-painter.com", 16u},
+  {"is-a-patsfan.org", 16u},
+  {"is-a-personaltrainer.com", 24u},
+  {"is-a-photographer.com", 21u},
+  {"is-a-player.com", 15u},
+  {"is-a-republican.com", 19u},
+  {"is-a-rockstar.com", 17u},
+  {"is-a-socialist.com", 18u},
+  {"is-a-soxfan.org", 15u},
+  {"is-a-student.com", 16u},
+  {"is-a-teacher.com", 16u},
+  {"is-a-techie.com", 15u},
+  {"is-a-therapist.com", 18u},
+  {"is-an-accountant.com", 20u},
+  {"is-an-actor.com", 15u},
+  {"is-an-actress.com", 17u},
+  {"is-an-anarchist.com", 19u},
+  {"is-an-artist.com", 16u},
+  {"is-an-engineer.com", 18u},
+  {"is-an-entertainer.com", 21u},
+  {"is-by.us", 8u},
+  {"is-certified.com", 16u},
+  {"is-found.org", 12u},
+  {"is-gone.com", 11u},
+  {"is-into-anime.com", 17u},
+  {"is-into-cars.com", 16u},
+  {"is-into-cartoons.com", 20u},
+  {"is-into-games.com", 17u},
+  {"is-leet.com", 11u},
+  {"is-lost.org", 11u},
+  {"is-not-certified.com", 20u},
+  {"is-saved.org", 12u},
+  {"is-slick.com", 12u},
+  {"is-uberleet.com", 15u},
+  {"is-very-bad.org", 15u},
+  {"is-very-evil.org", 16u},
+  {"is-very-good.org", 16u},
+  {"is-very-nice.org", 16u},
+  {"is-very-sweet.org", 17u},
+  {"is-with-theband.com", 19u},
+  {"is.eu.org", 9u},
+  {"is.gov.pl", 9u},
+  {"is.it", 5u},
+  {"isa-geek.com", 12u},
+  {"isa-geek.net", 12u},
+  {"isa-geek.org", 12u},
+  {"isa-hockeynut.com", 17u},
+  {"isa.kagoshima.jp", 16u},
+  {"isa.us", 6u},
+  {"isahaya.nagasaki.jp", 19u},
+  {"ise.mie.jp", 10u},
+  {"isehara.kanagawa.jp", 19u},
+  {"isen.kagoshima.jp", 17u},
+  {"isernia.it", 10u},
+  {"iserv.dev", 9u},
+  {"iservschule.de", 14u},
+  {"isesaki.gunma.jp", 16u},
+  {"ishigaki.okinawa.jp", 19u},
+  {"ishikari.hokkaido.jp", 20u},
+  {"ishikawa.fukushima.jp", 21u},
+  {"ishikawa.jp", 11u},
+  {"ishikawa.okinawa.jp", 19u},
+  {"ishinomaki.miyagi.jp", 20u},
+  {"isla.pr", 7u},
+  {"isleofman.museum", 16u},
+  {"ismaili", 7u},
+  {"isshiki.aichi.jp", 16u},
+  {"issmarterthanyou.com", 20u},
+  {"ist", 3u},
+  {"istanbul", 8u},
+  {"isteingeek.de", 13u},
+  {"istmein.de", 10u},
+  {"isumi.chiba.jp", 14u},
+  {"it", 2u},
+  {"it.ao", 5u},
+  {"it.eu.org", 9u},
+  {"it1.eur.aruba.jenv-aruba.cloud", 30u},
+  {"it1.jenv-aruba.cloud", 20u},
+  {"itabashi.tokyo.jp", 17u},
+  {"itako.ibaraki.jp", 16u},
+  {"itakura.gunma.jp", 16u},
+  {"itami.hyogo.jp", 14u},
+  {"itano.tokushima.jp", 18u},
+  {"itau", 4u},
+  {"itayanagi.aomori.jp", 19u},
+  {"itcouldbewor.se", 15u},
+  {"itigo.jp", 8u},
+  {"ito.shizuoka.jp", 15u},
+  {"itoigawa.niigata.jp", 19u},
+  {"itoman.okinawa.jp", 17u},
+  {"its.me", 6u},
+  {"itv", 3u},
+  {"ivano-frankivsk.ua", 18u},
+  {"ivanovo.su", 10u},
+  {"iveland.no", 10u},
+  {"ivgu.no", 7u},
+  {"iwade.wakayama.jp", 17u},
+  {"iwafune.tochigi.jp", 18u},
+  {"iwaizumi.iwate.jp", 17u},
+  {"iwaki.fukushima.jp", 18u},
+  {"iwakuni.yamaguchi.jp", 20u},
+  {"iwakura.aichi.jp", 16u},
+  {"iwama.ibaraki.jp", 16u},
+  {"iwamizawa.hokkaido.jp", 21u},
+  {"iwanai.hokkaido.jp", 18u},
+  {"iwanuma.miyagi.jp", 17u},
+  {"iwata.shizuoka.jp", 17u},
+  {"iwate.iwate.jp", 14u},
+  {"iwate.jp", 8u},
+  {"iwatsuki.saitama.jp", 19u},
+  {"iwi.nz", 6u},
+  {"iyo.ehime.jp", 12u},
+  {"iz.hr", 5u},
+  {"izena.okinawa.jp", 16u},
+  {"izu.shizuoka.jp", 15u},
+  {"izumi.kagoshima.jp", 18u},
+  {"izumi.osaka.jp", 14u},
+  {"izumiotsu.osaka.jp", 18u},
+  {"izumisano.osaka.jp", 18u},
+  {"izumizaki.fukushima.jp", 22u},
+  {"izumo.shimane.jp", 16u},
+  {"izumozaki.niigata.jp", 20u},
+  {"izunokuni.shizuoka.jp", 21u},
+  {"j.bg", 4u},
+  {"j.layershift.co.uk", 18u},
+  {"j.scaleforce.com.cy", 19u},
+  {"j.scaleforce.net", 16u},
+  {"jab.br", 6u},
+  {"jaguar", 6u},
+  {"jambyl.su", 9u},
+  {"jamison.museum", 14u},
+  {"jampa.br", 8u},
+  {"jan-mayen.no", 12u},
+  {"java", 4u},
+  {"jaworzno.pl", 11u},
+  {"jc.neen.it", 10u},
+  {"jcb", 3u},
+  {"jcloud-ver-jpc.ik-server.com", 28u},
+  {"jcloud.ik-server.com", 20u},
+  {"jcloud.kz", 9u},
+  {"jdevcloud.com", 13u},
+  {"jdf.br", 6u},
+  {"je", 2u},
+  {"jed.wafaicloud.com", 18u},
+  {"jeep", 4u},
+  {"jefferson.museum", 16u},
+  {"jeju.kr", 7u},
+  {"jelastic.dogado.eu", 18u},
+  {"jelastic.regruhosting.ru", 24u},
+  {"jelastic.saveincloud.net", 24u},
+  {"jelastic.team", 13u},
+  {"jelastic.tsukaeru.net", 21u},
+  {"jele.cloud", 10u},
+  {"jele.club", 9u},
+  {"jele.host", 9u},
+  {"jele.io", 7u},
+  {"jele.site", 9u},
+  {"jelenia-gora.pl", 15u},
+  {"jellybean.jp", 12u},
+  {"jeonbuk.kr", 10u},
+  {"jeonnam.kr", 10u},
+  {"jerusalem.museum", 16u},
+  {"jessheim.no", 11u},
+  {"jetzt", 5u},
+  {"jevnaker.no", 11u},
+  {"jewelry", 7u},
+  {"jewelry.museum", 14u},
+  {"jewish.museum", 13u},
+  {"jewishart.museum", 16u},
+  {"jfk.museum", 10u},
+  {"jgora.pl", 8u},
+  {"jinsekikogen.hiroshima.jp", 25u},
+  {"jio", 3u},
+  {"jl.cn", 5u},
+  {"jll", 3u},
+  {"jls-sto1.elastx.net", 19u},
+  {"jls-sto2.elastx.net", 19u},
+  {"jls-sto3.elastx.net", 19u},
+  {"jmp", 3u},
+  {"jnj", 3u},
+  {"jo", 2u},
+  {"joboji.iwate.jp", 15u},
+  {"jobs", 4u},
+  {"jobs.tt", 7u},
+  {"joburg", 6u},
+  {"joetsu.niigata.jp", 17u},
+  {"jogasz.hu", 9u},
+  {"johana.toyama.jp", 16u},
+  {"joinville.br", 12u},
+  {"jolster.no", 10u},
+  {"jondal.no", 9u},
+  {"jor.br", 6u},
+  {"jorpeland.no", 12u},
+  {"joso.ibaraki.jp", 15u},
+  {"jot", 3u},
+  {"jotelulu.cloud", 14u},
+  {"journal.aero", 12u},
+  {"journalism.museum", 17u},
+  {"journalist.aero", 15u},
+  {"joy", 3u},
+  {"joyo.kyoto.jp", 13u},
+  {"jozi.biz", 8u},
+  {"jp", 2u},
+  {"jp.eu.org", 9u},
+  {"jp.kg", 5u},
+  {"jp.md", 5u},
+  {"jp.net", 6u},
+  {"jpmorgan", 8u},
+  {"jpn.com", 7u},
+  {"jprs", 4u},
+  {"js.cn", 5u},
+  {"js.org", 6u},
+  {"js.wpenginepowered.com", 22u},
+  {"ju.mp", 5u},
+  {"judaica.museum", 14u},
+  {"judygarland.museum", 18u},
+  {"juedisches.museum", 17u},
+  {"juegos", 6u},
+  {"juif.museum", 11u},
+  {"juniper", 7u},
+  {"jur.pro", 7u},
+  {"jus.br", 6u},
+  {"jx.cn", 5u},
+  {"j\303\270lster.no", 11u},
+  {"j\303\270rpeland.no", 13u},
+  {"k.bg", 4u},
+  {"k.se", 4u},
+  {"k12.ak.us", 9u},
+  {"k12.al.us", 9u},
+  {"k12.ar.us", 9u},
+  {"k12.as.us", 9u},
+  {"k12.az.us", 9u},
+  {"k12.ca.us", 9u},
+  {"k12.co.us", 9u},
+  {"k12.ct.us", 9u},
+  {"k12.dc.us", 9u},
+  {"k12.de.us", 9u},
+  {"k12.ec", 6u},
+  {"k12.fl.us", 9u},
+  {"k12.ga.us", 9u},
+  {"k12.gu.us", 9u},
+  {"k12.ia.us", 9u},
+  {"k12.id.us", 9u},
+  {"k12.il", 6u},
+  {"k12.il.us", 9u},
+  {"k12.in.us", 9u},
+  {"k12.ks.us", 9u},
+  {"k12.ky.us", 9u},
+  {"k12.la.us", 9u},
+  {"k12.ma.us", 9u},
+  {"k12.md.us", 9u},
+  {"k12.me.us", 9u},
+  {"k12.mi.us", 9u},
+  {"k12.mn.us", 9u},
+  {"k12.mo.us", 9u},
+  {"k12.ms.us", 9u},
+  {"k12.mt.us", 9u},
+  {"k12.nc.us", 9u},
+  {"k12.ne.us", 9u},
+  {"k12.nh.us", 9u},
+  {"k12.nj.us", 9u},
+  {"k12.nm.us", 9u},
+  {"k12.nv.us", 9u},
+  {"k12.ny.us", 9u},
+  {"k12.oh.us", 9u},
+  {"k12.ok.us", 9u},
+  {"k12.or.us", 9u},
+  {"k12.pa.us", 9u},
+  {"k12.pr.us", 9u},
+  {"k12.sc.us", 9u},
+  {"k12.tn.us", 9u},
+  {"k12.tr", 6u},
+  {"k12.tx.us", 9u},
+  {"k12.ut.us", 9u},
+  {"k12.va.us", 9u},
+  {"k12.vi", 6u},
+  {"k12.vi.us", 9u},
+  {"k12.vt.us", 9u},
+  {"k12.wa.us", 9u},
+  {"k12.wi.us", 9u},
+  {"k12.wy.us", 9u},
+  {"k8s.fr-par.scw.cloud", 20u},
+  {"k8s.nl-ams.scw.cloud", 20u},
+  {"k8s.pl-waw.scw.cloud", 20u},
+  {"k8s.scw.cloud", 13u},
+  {"kaas.gg", 7u},
+  {"kadena.okinawa.jp", 17u},
+  {"kadogawa.miyazaki.jp", 20u},
+  {"kadoma.osaka.jp", 15u},
+  {"kafjord.no", 10u},
+  {"kaga.ishikawa.jp", 16u},
+  {"kagami.kochi.jp", 15u},
+  {"kagamiishi.fukushima.jp", 23u},
+  {"kagamino.okayama.jp", 19u},
+  {"kagawa.jp", 9u},
+  {"kagoshima.jp", 12u},
+  {"kagoshima.kagoshima.jp", 22u},
+  {"kaho.fukuoka.jp", 15u},
+  {"kahoku.ishikawa.jp", 18u},
+  {"kahoku.yamagata.jp", 18u},
+  {"kai.yamanashi.jp", 16u},
+  {"kainan.tokushima.jp", 19u},
+  {"kainan.wakayama.jp", 18u},
+  {"kaisei.kanagawa.jp", 18u},
+  {"kaita.hiroshima.jp", 18u},
+  {"kaizuka.osaka.jp", 16u},
+  {"kakamigahara.gifu.jp", 20u},
+  {"kakegawa.shizuoka.jp", 20u},
+  {"kakinoki.shimane.jp", 19u},
+  {"kakogawa.hyogo.jp", 17u},
+  {"kakuda.miyagi.jp", 16u},
+  {"kalisz.pl", 9u},
+  {"kalmykia.ru", 11u},
+  {"kalmykia.su", 11u},
+  {"kaluga.su", 9u},
+  {"kamagaya.chiba.jp", 17u},
+  {"kamaishi.iwate.jp", 17u},
+  {"kamakura.kanagawa.jp", 20u},
+  {"kameoka.kyoto.jp", 16u},
+  {"kameyama.mie.jp", 15u},
+  {"kami.kochi.jp", 13u},
+  {"kami.miyagi.jp", 14u},
+  {"kamiamakusa.kumamoto.jp", 23u},
+  {"kamifurano.hokkaido.jp", 22u},
+  {"kamigori.hyogo.jp", 17u},
+  {"kamiichi.toyama.jp", 18u},
+  {"kamiizumi.saitama.jp", 20u},
+  {"kamijima.ehime.jp", 17u},
+  {"kamikawa.hokkaido.jp", 20u},
+  {"kamikawa.hyogo.jp", 17u},
+  {"kamikawa.saitama.jp", 19u},
+  {"kamikitayama.nara.jp", 20u},
+  {"kamikoani.akita.jp", 18u},
+  {"kamimine.saga.jp", 16u},
+  {"kaminokawa.tochigi.jp", 21u},
+  {"kaminoyama.yamagata.jp", 22u},
+  {"kamioka.akita.jp", 16u},
+  {"kamisato.saitama.jp", 19u},
+  {"kamishihoro.hokkaido.jp", 23u},
+  {"kamisu.ibaraki.jp", 17u},
+  {"kamisunagawa.hokkaido.jp", 24u},
+  {"kamitonda.wakayama.jp", 21u},
+  {"kamitsue.oita.jp", 16u},
+  {"kamo.kyoto.jp", 13u},
+  {"kamo.niigata.jp", 15u},
+  {"kamoenai.hokkaido.jp", 20u},
+  {"kamogawa.chiba.jp", 17u},
+  {"kanagawa.jp", 11u},
+  {"kanan.osaka.jp", 14u},
+  {"kanazawa.ishikawa.jp", 20u},
+  {"kanegasaki.iwate.jp", 19u},
+  {"kaneyama.fukushima.jp", 21u},
+  {"kaneyama.yamagata.jp", 20u},
+  {"kani.gifu.jp", 12u},
+  {"kanie.aichi.jp", 14u},
+  {"kanmaki.nara.jp", 15u},
+  {"kanna.gunma.jp", 14u},
+  {"kannami.shizuoka.jp", 19u},
+  {"kanonji.kagawa.jp", 17u},
+  {"kanoya.kagoshima.jp", 19u},
+  {"kanra.gunma.jp", 14u},
+  {"kanuma.tochigi.jp", 17u},
+  {"kanzaki.saga.jp", 15u},
+  {"kapsi.fi", 8u},
+  {"karacol.su", 10u},
+  {"karaganda.su", 12u},
+  {"karasjohka.no", 13u},
+  {"karasjok.no", 11u},
+  {"karasuyama.tochigi.jp", 21u},
+  {"karate.museum", 13u},
+  {"karatsu.saga.jp", 15u},
+  {"karelia.su", 10u},
+  {"karikatur.museum", 16u},
+  {"kariwa.niigata.jp", 17u},
+  {"kariya.aichi.jp", 15u},
+  {"karlsoy.no", 10u},
+  {"karmoy.no", 9u},
+  {"karm\303\270y.no", 10u},
+  {"karpacz.pl", 10u},
+  {"kartuzy.pl", 10u},
+  {"karuizawa.nagano.jp", 19u},
+  {"karumai.iwate.jp", 16u},
+  {"kasahara.gifu.jp", 16u},
+  {"kasai.hyogo.jp", 14u},
+  {"kasama.ibaraki.jp", 17u},
+  {"kasamatsu.gifu.jp", 17u},
+  {"kasaoka.okayama.jp", 18u},
+  {"kashiba.nara.jp", 15u},
+  {"kashihara.nara.jp", 17u},
+  {"kashima.ibaraki.jp", 18u},
+  {"kashima.saga.jp", 15u},
+  {"kashiwa.chiba.jp", 16u},
+  {"kashiwara.osaka.jp", 18u},
+  {"kashiwazaki.niigata.jp", 22u},
+  {"kasserver.com", 13u},
+  {"kasuga.fukuoka.jp", 17u},
+  {"kasuga.hyogo.jp", 15u},
+  {"kasugai.aichi.jp", 16u},
+  {"kasukabe.saitama.jp", 19u},
+  {"kasumigaura.ibaraki.jp", 22u},
+  {"kasuya.fukuoka.jp", 17u},
+  {"kaszuby.pl", 10u},
+  {"katagami.akita.jp", 17u},
+  {"katano.osaka.jp", 15u},
+  {"katashina.gunma.jp", 18u},
+  {"katori.chiba.jp", 15u},
+  {"katowice.pl", 11u},
+  {"katsuragi.nara.jp", 17u},
+  {"katsuragi.wakayama.jp", 21u},
+  {"katsushika.tokyo.jp", 19u},
+  {"katsuura.chiba.jp", 17u},
+  {"katsuyama.fukui.jp", 18u},
+  {"kaufen", 6u},
+  {"kautokeino.no", 13u},
+  {"kawaba.gunma.jp", 15u},
+  {"kawachinagano.osaka.jp", 22u},
+  {"kawagoe.mie.jp", 14u},
+  {"kawagoe.saitama.jp", 18u},
+  {"kawaguchi.saitama.jp", 20u},
+  {"kawahara.tottori.jp", 19u},
+  {"kawai.iwate.jp", 14u},
+  {"kawai.nara.jp", 13u},
+  {"kawaiishop.jp", 13u},
+  {"kawajima.saitama.jp", 19u},
+  {"kawakami.nagano.jp", 18u},
+  {"kawakami.nara.jp", 16u},
+  {"kawakita.ishikawa.jp", 20u},
+  {"kawamata.fukushima.jp", 21u},
+  {"kawaminami.miyazaki.jp", 22u},
+  {"kawanabe.kagoshima.jp", 21u},
+  {"kawanehon.shizuoka.jp", 21u},
+  {"kawanishi.hyogo.jp", 18u},
+  {"kawanishi.nara.jp", 17u},
+  {"kawanishi.yamagata.jp", 21u},
+  {"kawara.fukuoka.jp", 17u},
+  {"kawasaki.miyagi.jp", 18u},
+  {"kawatana.nagasaki.jp", 20u},
+  {"kawaue.gifu.jp", 14u},
+  {"kawazu.shizuoka.jp", 18u},
+  {"kayabe.hokkaido.jp", 18u},
+  {"kazimierz-dolny.pl", 18u},
+  {"kazo.saitama.jp", 15u},
+  {"kazuno.akita.jp", 15u},
+  {"kddi", 4u},
+  {"ke", 2u},
+  {"keisen.fukuoka.jp", 17u},
+  {"keliweb.cloud", 13u},
+  {"kembuchi.hokkaido.jp", 20u},
+  {"kep.tr", 6u},
+  {"kepno.pl", 8u},
+  {"kerryhotels", 11u},
+  {"kerrylogistics", 14u},
+  {"kerryproperties", 15u},
+  {"ketrzyn.pl", 10u},
+  {"keymachine.de", 13u},
+  {"kfh", 3u},
+  {"kg", 2u},
+  {"kg.kr", 5u},
+  {"kh.ua", 5u},
+  {"khakassia.su", 12u},
+  {"kharkiv.ua", 10u},
+  {"kharkov.ua", 10u},
+  {"kherson.ua", 10u},
+  {"khmelnitskiy.ua", 15u},
+  {"khmelnytskyi.ua", 15u},
+  {"khplay.nl", 9u},
+  {"ki", 2u},
+  {"kia", 3u},
+  {"kibichuo.okayama.jp", 19u},
+  {"kicks-ass.net", 13u},
+  {"kicks-ass.org", 13u},
+  {"kids", 4u},
+  {"kids.museum", 11u},
+  {"kids.us", 7u},
+  {"kiev.ua", 7u},
+  {"kiho.mie.jp", 11u},
+  {"kihoku.ehime.jp", 15u},
+  {"kijo.miyazaki.jp", 16u},
+  {"kikirara.jp", 11u},
+  {"kikonai.hokkaido.jp", 19u},
+  {"kikuchi.kumamoto.jp", 19u},
+  {"kikugawa.shizuoka.jp", 20u},
+  {"kilatiron.com", 13u},
+  {"kill.jp", 7u},
+  {"kilo.jp", 7u},
+  {"kim", 3u},
+  {"kimino.wakayama.jp", 18u},
+  {"kimitsu.chiba.jp", 16u},
+  {"kimobetsu.hokkaido.jp", 21u},
+  {"kin.okinawa.jp", 14u},
+  {"kinder", 6u},
+  {"kindle", 6u},
+  {"kinghost.net", 12u},
+  {"kinko.kagoshima.jp", 18u},
+  {"kinokawa.wakayama.jp", 20u},
+  {"kira.aichi.jp", 13u},
+  {"kirkenes.no", 11u},
+  {"kirovograd.ua", 13u},
+  {"kiryu.gunma.jp", 14u},
+  {"kisarazu.chiba.jp", 17u},
+  {"kishiwada.osaka.jp", 18u},
+  {"kiso.nagano.jp", 14u},
+  {"kisofukushima.nagano.jp", 23u},
+  {"kisosaki.mie.jp", 15u},
+  {"kita.kyoto.jp", 13u},
+  {"kita.osaka.jp", 13u},
+  {"kita.tokyo.jp", 13u},
+  {"kitaaiki.nagano.jp", 18u},
+  {"kitaakita.akita.jp", 18u},
+  {"kitadaito.okinawa.jp", 20u},
+  {"kitagata.gifu.jp", 16u},
+  {"kitagata.saga.jp", 16u},
+  {"kitagawa.kochi.jp", 17u},
+  {"kitagawa.miyazaki.jp", 20u},
+  {"kitahata.saga.jp", 16u},
+  {"kitahiroshima.hokkaido.jp", 25u},
+  {"kitakami.iwate.jp", 17u},
+  {"kitakata.fukushima.jp", 21u},
+  {"kitakata.miyazaki.jp", 20u},
+  {"kitami.hokkaido.jp", 18u},
+  {"kitamoto.saitama.jp", 19u},
+  {"kitanakagusuku.okinawa.jp", 25u},
+  {"kitashiobara.fukushima.jp", 25u},
+  {"kitaura.miyazaki.jp", 19u},
+  {"kitayama.wakayama.jp", 20u},
+  {"kitchen", 7u},
+  {"kiwa.mie.jp", 11u},
+  {"kiwi", 4u},
+  {"kiwi.nz", 7u},
+  {"kiyama.saga.jp", 14u},
+  {"kiyokawa.kanagawa.jp", 20u},
+  {"kiyosato.hokkaido.jp", 20u},
+  {"kiyose.tokyo.jp", 15u},
+  {"kiyosu.aichi.jp", 15u},
+  {"kizu.kyoto.jp", 13u},
+  {"klabu.no", 8u},
+  {"klepp.no", 8u},
+  {"klodzko.pl", 10u},
+  {"kl\303\246bu.no", 9u},
+  {"km", 2u},
+  {"km.ua", 5u},
+  {"kmpsp.gov.pl", 12u},
+  {"kn", 2u},
+  {"knightpoint.systems", 19u},
+  {"knowsitall.info", 15u},
+  {"knx-server.net", 14u},
+  {"kobayashi.miyazaki.jp", 21u},
+  {"kobierzyce.pl", 13u},
+  {"kochi.jp", 8u},
+  {"kochi.kochi.jp", 14u},
+  {"kodaira.tokyo.jp", 16u},
+  {"koebenhavn.museum", 17u},
+  {"koeln", 5u},
+  {"koeln.museum", 12u},
+  {"kofu.yamanashi.jp", 17u},
+  {"koga.fukuoka.jp", 15u},
+  {"koga.ibaraki.jp", 15u},
+  {"koganei.tokyo.jp", 16u},
+  {"koge.tottori.jp", 15u},
+  {"koka.shiga.jp", 13u},
+  {"kokonoe.oita.jp", 15u},
+  {"kokubunji.tokyo.jp", 18u},
+  {"kolobrzeg.pl", 12u},
+  {"komae.tokyo.jp", 14u},
+  {"komagane.nagano.jp", 18u},
+  {"komaki.aichi.jp", 15u},
+  {"komatsu", 7u},
+  {"komatsu.ishikawa.jp", 19u},
+  {"komatsushima.tokushima.jp", 25u},
+  {"komforb.se", 10u},
+  {"kommunalforbund.se", 18u},
+  {"kommune.no", 10u},
+  {"komono.mie.jp", 13u},
+  {"komoro.nagano.jp", 16u},
+  {"komvux.se", 9u},
+  {"konan.aichi.jp", 14u},
+  {"konan.shiga.jp", 14u},
+  {"kongsberg.no", 12u},
+  {"kongsvinger.no", 14u},
+  {"konin.pl", 8u},
+  {"konskowola.pl", 13u},
+  {"konsulat.gov.pl", 15u},
+  {"konyvelo.hu", 11u},
+  {"koobin.events", 13u},
+  {"koori.fukushima.jp", 18u},
+  {"kopervik.no", 11u},
+  {"koriyama.fukushima.jp", 21u},
+  {"koryo.nara.jp", 13u},
+  {"kosai.shizuoka.jp", 17u},
+  {"kosaka.akita.jp", 15u},
+  {"kosei.shiga.jp", 14u},
+  {"kosher", 6u},
+  {"koshigaya.saitama.jp", 20u},
+  {"koshimizu.hokkaido.jp", 21u},
+  {"koshu.yamanashi.jp", 18u},
+  {"kosuge.yamanashi.jp", 19u},
+  {"kota.aichi.jp", 13u},
+  {"koto.shiga.jp", 13u},
+  {"koto.tokyo.jp", 13u},
+  {"kotohira.kagawa.jp", 18u},
+  {"kotoura.tottori.jp", 18u},
+  {"kouhoku.saga.jp", 15u},
+  {"kounosu.saitama.jp", 18u},
+  {"kouyama.kagoshima.jp", 20u},
+  {"kouzushima.tokyo.jp", 19u},
+  {"koya.wakayama.jp", 16u},
+  {"koza.wakayama.jp", 16u},
+  {"kozagawa.wakayama.jp", 20u},
+  {"kozaki.chiba.jp", 15u},
+  {"kozow.com", 9u},
+  {"kp", 2u},
+  {"kpmg", 4u},
+  {"kpn", 3u},
+  {"kppsp.gov.pl", 12u},
+  {"kr", 2u},
+  {"kr.com", 6u},
+  {"kr.eu.org", 9u},
+  {"kr.it", 5u},
+  {"kr.ua", 5u},
+  {"kraanghke.no", 12u},
+  {"kragero.no", 10u},
+  {"krager\303\270.no", 11u},
+  {"krakow.pl", 9u},
+  {"krasnik.pl", 10u},
+  {"krasnodar.su", 12u},
+  {"krd", 3u},
+  {"kred", 4u},
+  {"krellian.net", 12u},
+  {"kristiansand.no", 15u},
+  {"kristiansund.no", 15u},
+  {"krodsherad.no", 13u},
+  {"krokstadelva.no", 15u},
+  {"krym.ua", 7u},
+  {"kr\303\245anghke.no", 13u},
+  {"kr\303\270dsherad.no", 14u},
+  {"ks.ua", 5u},
+  {"ks.us", 5u},
+  {"ktistory.com", 12u},
+  {"kuchinotsu.nagasaki.jp", 22u},
+  {"kudamatsu.yamaguchi.jp", 22u},
+  {"kudoyama.wakayama.jp", 20u},
+  {"kui.hiroshima.jp", 16u},
+  {"kuji.iwate.jp", 13u},
+  {"kuju.oita.jp", 12u},
+  {"kujukuri.chiba.jp", 17u},
+  {"kuki.saitama.jp", 15u},
+  {"kuleuven.cloud", 14u},
+  {"kumagaya.saitama.jp", 19u},
+  {"kumakogen.ehime.jp", 18u},
+  {"kumamoto.jp", 11u},
+  {"kumamoto.kumamoto.jp", 20u},
+  {"kumano.hiroshima.jp", 19u},
+  {"kumano.mie.jp", 13u},
+  {"kumatori.osaka.jp", 17u},
+  {"kumejima.okinawa.jp", 19u},
+  {"kumenan.okayama.jp", 18u},
+  {"kumiyama.kyoto.jp", 17u},
+  {"kunigami.okinawa.jp", 19u},
+  {"kunimi.fukushima.jp", 19u},
+  {"kunisaki.oita.jp", 16u},
+  {"kunitachi.tokyo.jp", 18u},
+  {"kunitomi.miyazaki.jp", 20u},
+  {"kunneppu.hokkaido.jp", 20u},
+  {"kunohe.iwate.jp", 15u},
+  {"kunst.museum", 12u},
+  {"kunstsammlung.museum", 20u},
+  {"kunstunddesign.museum", 21u},
+  {"kuokgroup", 9u},
+  {"kurashiki.okayama.jp", 20u},
+  {"kurate.fukuoka.jp", 17u},
+  {"kure.hiroshima.jp", 17u},
+  {"kurgan.su", 9u},
+  {"kuriyama.hokkaido.jp", 20u},
+  {"kurobe.toyama.jp", 16u},
+  {"kurogi.fukuoka.jp", 17u},
+  {"kuroishi.aomori.jp", 18u},
+  {"kuroiso.tochigi.jp", 18u},
+  {"kuromatsunai.hokkaido.jp", 24u},
+  {"kuron.jp", 8u},
+  {"kurotaki.nara.jp", 16u},
+  {"kurume.fukuoka.jp", 17u},
+  {"kusatsu.gunma.jp", 16u},
+  {"kusatsu.shiga.jp", 16u},
+  {"kushima.miyazaki.jp", 19u},
+  {"kushimoto.wakayama.jp", 21u},
+  {"kushiro.hokkaido.jp", 19u},
+  {"kustanai.ru", 11u},
+  {"kustanai.su", 11u},
+  {"kusu.oita.jp", 12u},
+  {"kutchan.hokkaido.jp", 19u},
+  {"kutno.pl", 8u},
+  {"kuwana.mie.jp", 13u},
+  {"kuzumaki.iwate.jp", 17u},
+  {"kv.ua", 5u},
+  {"kvafjord.no", 11u},
+  {"kvalsund.no", 11u},
+  {"kvam.no", 7u},
+  {"kvanangen.no", 12u},
+  {"kvinesdal.no", 12u},
+  {"kvinnherad.no", 13u},
+  {"kviteseid.no", 12u},
+  {"kvitsoy.no", 10u},
+  {"kvits\303\270y.no", 11u},
+  {"kv\303\246fjord.no", 12u},
+  {"kv\303\246nangen.no", 13u},
+  {"kw", 2u},
+  {"kwp.gov.pl", 10u},
+  {"kwpsp.gov.pl", 12u},
+  {"ky", 2u},
+  {"ky.us", 5u},
+  {"kyiv.ua", 7u},
+  {"kyonan.chiba.jp", 15u},
+  {"kyotamba.kyoto.jp", 17u},
+  {"kyotanabe.kyoto.jp", 18u},
+  {"kyotango.kyoto.jp", 17u},
+  {"kyoto", 5u},
+  {"kyoto.jp", 8u},
+  {"kyowa.akita.jp", 14u},
+  {"kyowa.hokkaido.jp", 17u},
+  {"kyuragi.saga.jp", 15u},
+  {"kz", 2u},
+  {"k\303\241r\303\241\305\241johka.no", 16u},
+  {"k\303\245fjord.no", 11u},
+  {"l-o-g-i-n.de", 12u},
+  {"l.bg", 4u},
+  {"l.se", 4u},
+  {"la", 2u},
+  {"la-spezia.it", 12u},
+  {"la.us", 5u},
+  {"laakesvuemie.no", 15u},
+  {"lab.ms", 6u},
+  {"labor.museum", 12u},
+  {"labour.museum", 13u},
+  {"lacaixa", 7u},
+  {"lahppi.no", 9u},
+  {"lajolla.museum", 14u},
+  {"lakas.hu", 8u},
+  {"lamborghini", 11u},
+  {"lamer", 5u},
+  {"lanbib.se", 9u},
+  {"lancashire.museum", 17u},
+  {"lancaster", 9u},
+  {"lancia", 6u},
+  {"land", 4u},
+  {"land-4-sale.us", 14u},
+  {"landes.museum", 13u},
+  {"landrover", 9u},
+  {"langevag.no", 11u},
+  {"langev\303\245g.no", 12u},
+  {"lans.museum", 11u},
+  {"lanxess", 7u},
+  {"lapy.pl", 7u},
+  {"laquila.it", 10u},
+  {"lardal.no", 9u},
+  {"larsson.museum", 14u},
+  {"larvik.no", 9u},
+  {"lasalle", 7u},
+  {"laspezia.it", 11u},
+  {"lat", 3u},
+  {"latina.it", 9u},
+  {"latino", 6u},
+  {"latrobe", 7u},
+  {"lavagis.no", 10u},
+  {"lavangen.no", 11u},
+  {"law", 3u},
+  {"law.pro", 7u},
+  {"law.za", 6u},
+  {"lawyer", 6u},
+  {"laz.it", 6u},
+  {"lazio.it", 8u},
+  {"lb", 2u},
+  {"lc", 2u},
+  {"lc.it", 5u},
+  {"lcube-server.de", 15u},
+  {"lds", 3u},
+  {"le.it", 5u},
+  {"leadpages.co", 12u},
+  {"leangaviika.no", 14u},
+  {"lease", 5u},
+  {"leasing.aero", 12u},
+  {"lea\305\213gaviika.no", 15u},
+  {"lebesby.no", 10u},
+  {"lebork.pl", 9u},
+  {"lebtimnetz.de", 13u},
+  {"lecce.it", 8u},
+  {"lecco.it", 8u},
+  {"leclerc", 7u},
+  {"leczna.pl", 9u},
+  {"lefrak", 6u},
+  {"leg.br", 6u},
+  {"legal", 5u},
+  {"legnica.pl", 10u},
+  {"lego", 4u},
+  {"leikanger.no", 12u},
+  {"leirfjord.no", 12u},
+  {"leirvik.no", 10u},
+  {"leitungsen.de", 13u},
+  {"leka.no", 7u},
+  {"leksvik.no", 10u},
+  {"lel.br", 6u},
+  {"lelux.site", 10u},
+  {"lenug.su", 8u},
+  {"lenvik.no", 9u},
+  {"lerdal.no", 9u},
+  {"lesja.no", 8u},
+  {"levanger.no", 11u},
+  {"lewismiller.museum", 18u},
+  {"lexus", 5u},
+  {"lezajsk.pl", 10u},
+  {"lg.jp", 5u},
+  {"lg.ua", 5u},
+  {"lgbt", 4u},
+  {"li", 2u},
+  {"li.it", 5u},
+  {"lib.ak.us", 9u},
+  {"lib.al.us", 9u},
+  {"lib.ar.us", 9u},
+  {"lib.as.us", 9u},
+  {"lib.az.us", 9u},
+  {"lib.ca.us", 9u},
+  {"lib.co.us", 9u},
+  {"lib.ct.us", 9u},
+  {"lib.dc.us", 9u},
+  {"lib.de.us", 9u},
+  {"lib.ee", 6u},
+  {"lib.fl.us", 9u},
+  {"lib.ga.us", 9u},
+  {"lib.gu.us", 9u},
+  {"lib.hi.us", 9u},
+  {"lib.ia.us", 9u},
+  {"lib.id.us", 9u},
+  {"lib.il.us", 9u},
+  {"lib.in.us", 9u},
+  {"lib.ks.us", 9u},
+  {"lib.ky.us", 9u},
+  {"lib.la.us", 9u},
+  {"lib.ma.us", 9u},
+  {"lib.md.us", 9u},
+  {"lib.me.us", 9u},
+  {"lib.mi.us", 9u},
+  {"lib.mn.us", 9u},
+  {"lib.mo.us", 9u},
+  {"lib.ms.us", 9u},
+  {"lib.mt.us", 9u},
+  {"lib.nc.us", 9u},
+  {"lib.nd.us", 9u},
+  {"lib.ne.us", 9u},
+  {"lib.nh.us", 9u},
+  {"lib.nj.us", 9u},
+  {"lib.nm.us", 9u},
+  {"lib.nv.us", 9u},
+  {"lib.ny.us", 9u},
+  {"lib.oh.us", 9u},
+  {"lib.ok.us", 9u},
+  {"lib.or.us", 9u},
+  {"lib.pa.us", 9u},
+  {"lib.pr.us", 9u},
+  {"lib.ri.us", 9u},
+  {"lib.sc.us", 9u},
+  {"lib.sd.us", 9u},
+  {"lib.tn.us", 9u},
+  {"lib.tx.us", 9u},
+  {"lib.ut.us", 9u},
+  {"lib.va.us", 9u},
+  {"lib.vi.us", 9u},
+  {"lib.vt.us", 9u},
+  {"lib.wa.us", 9u},
+  {"lib.wi.us", 9u},
+  {"lib.wy.us", 9u},
+  {"lidl", 4u},
+  {"lier.no", 7u},
+  {"lierne.no", 9u},
+  {"life", 4u},
+  {"lifeinsurance", 13u},
+  {"lifestyle", 9u},
+  {"lig.it", 6u},
+  {"lighting", 8u},
+  {"liguria.it", 10u},
+  {"like", 4u},
+  {"likes-pie.com", 13u},
+  {"likescandy.com", 14u},
+  {"lillehammer.no", 14u},
+  {"lillesand.no", 12u},
+  {"lilly", 5u},
+  {"lima-city.at", 12u},
+  {"lima-city.ch", 12u},
+  {"lima-city.de", 12u},
+  {"lima-city.rocks", 15u},
+  {"lima.zone", 9u},
+  {"limanowa.pl", 11u},
+  {"limited", 7u},
+  {"limo", 4u},
+  {"lincoln", 7u},
+  {"lincoln.museum", 14u},
+  {"lindas.no", 9u},
+  {"linde", 5u},
+  {"lindesnes.no", 12u},
+  {"lind\303\245s.no", 10u},
+  {"link", 4u},
+  {"linkyard-cloud.ch", 17u},
+  {"linkyard.cloud", 14u},
+  {"linz.museum", 11u},
+  {"lipsy", 5u},
+  {"littlestar.jp", 13u},
+  {"live", 4u},
+  {"living", 6u},
+  {"living.museum", 13u},
+  {"livinghistory.museum", 20u},
+  {"livorno.it", 10u},
+  {"lk", 2u},
+  {"lk3.ru", 6u},
+  {"llc", 3u},
+  {"llp", 3u},
+  {"ln.cn", 5u},
+  {"lo.it", 5u},
+  {"loabat.no", 9u},
+  {"loab\303\241t.no", 10u},
+  {"loan", 4u},
+  {"loans", 5u},
+  {"localhistory.museum", 19u},
+  {"localhost.daplie.me", 19u},
+  {"localzone.xyz", 13u},
+  {"locker", 6u},
+  {"locus", 5u},
+  {"lodi.it", 7u},
+  {"lodingen.no", 11u},
+  {"loft", 4u},
+  {"log.br", 6u},
+  {"loginline.app", 13u},
+  {"loginline.dev", 13u},
+  {"loginline.io", 12u},
+  {"loginline.services", 18u},
+  {"loginline.site", 14u},
+  {"loginto.me", 10u},
+  {"logistics.aero", 14u},
+  {"logoip.com", 10u},
+  {"logoip.de", 9u},
+  {"lohmus.me", 9u},
+  {"lol", 3u},
+  {"lolipop.io", 10u},
+  {"lolipopmc.jp", 12u},
+  {"lolitapunk.jp", 13u},
+  {"lom.it", 6u},
+  {"lom.no", 6u},
+  {"lombardia.it", 12u},
+  {"lombardy.it", 11u},
+  {"lomo.jp", 7u},
+  {"lomza.pl", 8u},
+  {"lon-1.paas.massivegrid.net", 26u},
+  {"lon-2.paas.massivegrid.net", 26u},
+  {"lon.wafaicloud.com", 18u},
+  {"london", 6u},
+  {"london.cloudapps.digital", 24u},
+  {"london.museum", 13u},
+  {"londrina.br", 11u},
+  {"loppa.no", 8u},
+  {"lorenskog.no", 12u},
+  {"losangeles.museum", 17u},
+  {"loseyourip.com", 14u},
+  {"loten.no", 8u},
+  {"lotte", 5u},
+  {"lotto", 5u},
+  {"louvre.museum", 13u},
+  {"love", 4u},
+  {"lovepop.jp", 10u},
+  {"lovesick.jp", 11u},
+  {"lowicz.pl", 9u},
+  {"loyalist.museum", 15u},
+  {"lpages.co", 9u},
+  {"lpl", 3u},
+  {"lplfinancial", 12u},
+  {"lpusercontent.com", 17u},
+  {"lr", 2u},
+  {"ls", 2u},
+  {"lt", 2u},
+  {"lt.eu.org", 9u},
+  {"lt.it", 5u},
+  {"lt.ua", 5u},
+  {"ltd", 3u},
+  {"ltd.co.im", 9u},
+  {"ltd.cy", 6u},
+  {"ltd.gi", 6u},
+  {"ltd.hk", 6u},
+  {"ltd.lk", 6u},
+  {"ltd.ng", 6u},
+  {"ltd.ua", 6u},
+  {"ltd.uk", 6u},
+  {"ltda", 4u},
+  {"lu", 2u},
+  {"lu.eu.org", 9u},
+  {"lu.it", 5u},
+  {"lubartow.pl", 11u},
+  {"lubin.pl", 8u},
+  {"lublin.pl", 9u},
+  {"lucania.it", 10u},
+  {"lucca.it", 8u},
+  {"lucerne.museum", 14u},
+  {"lug.org.uk", 10u},
+  {"lugansk.ua", 10u},
+  {"lugs.org.uk", 11u},
+  {"lukow.pl", 8u},
+  {"lund.no", 7u},
+  {"lundbeck", 8u},
+  {"lunner.no", 9u},
+  {"luroy.no", 8u},
+  {"lur\303\270y.no", 9u},
+  {"luster.no", 9u},
+  {"lutsk.ua", 8u},
+  {"luxe", 4u},
+  {"luxembourg.museum", 17u},
+  {"luxury", 6u},
+  {"luzern.museum", 13u},
+  {"lv", 2u},
+  {"lv.eu.org", 9u},
+  {"lv.ua", 5u},
+  {"lviv.ua", 7u},
+  {"ly", 2u},
+  {"lyngdal.no", 10u},
+  {"lyngen.no", 9u},
+  {"lynx.mythic-beasts.com", 22u},
+  {"l\303\241hppi.no", 10u},
+  {"l\303\244ns.museum", 12u},
+  {"l\303\246rdal.no", 10u},
+  {"l\303\270dingen.no", 12u},
+  {"l\303\270renskog.no", 13u},
+  {"l\303\270ten.no", 9u},
+  {"m.bg", 4u},
+  {"m.se", 4u},
+  {"ma", 2u},
+  {"ma.gov.br", 9u},
+  {"ma.leg.br", 9u},
+  {"ma.us", 5u},
+  {"macapa.br", 9u},
+  {"maceio.br", 9u},
+  {"macerata.it", 11u},
+  {"machida.tokyo.jp", 16u},
+  {"macys", 5u},
+  {"mad.museum", 10u},
+  {"madrid", 6u},
+  {"madrid.museum", 13u},
+  {"maebashi.gunma.jp", 17u},
+  {"magazine.aero", 13u},
+  {"magnet.page", 11u},
+  {"maibara.shiga.jp", 16u},
+  {"maif", 4u},
+  {"mail.pl", 7u},
+  {"main.jp", 7u},
+  {"maintenance.aero", 16u},
+  {"maison", 6u},
+  {"maizuru.kyoto.jp", 16u},
+  {"makeup", 6u},
+  {"makinohara.shizuoka.jp", 22u},
+  {"makurazaki.kagoshima.jp", 23u},
+  {"malatvuopmi.no", 14u},
+  {"malbork.pl", 10u},
+  {"mallorca.museum", 15u},
+  {"malopolska.pl", 13u},
+  {"malselv.no", 10u},
+  {"malvik.no", 9u},
+  {"mamurogawa.yamagata.jp", 22u},
+  {"man", 3u},
+  {"management", 10u},
+  {"manaus.br", 9u},
+  {"manchester.museum", 17u},
+  {"mandal.no", 9u},
+  {"mango", 5u},
+  {"mangyshlak.su", 13u},
+  {"maniwa.okayama.jp", 17u},
+  {"manno.kagawa.jp", 15u},
+  {"mansion.museum", 14u},
+  {"mansions.museum", 15u},
+  {"mantova.it", 10u},
+  {"manx.museum", 11u},
+  {"maori.nz", 8u},
+  {"map", 3u},
+  {"map.fastly.net", 14u},
+  {"map.fastlylb.net", 16u},
+  {"mar.it", 6u},
+  {"marburg.museum", 14u},
+  {"marche.it", 9u},
+  {"marine.ru", 9u},
+  {"maringa.br", 10u},
+  {"maritime.museum", 15u},
+  {"maritimo.museum", 15u},
+  {"marker.no", 9u},
+  {"market", 6u},
+  {"marketing", 9u},
+  {"markets", 7u},
+  {"marnardal.no", 12u},
+  {"marriott", 8u},
+  {"marshalls", 9u},
+  {"marugame.kagawa.jp", 18u},
+  {"marumori.miyagi.jp", 18u},
+  {"maryland.museum", 15u},
+  {"marylhurst.museum", 17u},
+  {"masaki.ehime.jp", 15u},
+  {"maserati", 8u},
+  {"masfjorden.no", 13u},
+  {"mashike.hokkaido.jp", 19u},
+  {"mashiki.kumamoto.jp", 19u},
+  {"mashiko.tochigi.jp", 18u},
+  {"masoy.no", 8u},
+  {"massa-carrara.it", 16u},
+  {"massacarrara.it", 15u},
+  {"masuda.shimane.jp", 17u},
+  {"mat.br", 6u},
+  {"matera.it", 9u},
+  {"matsubara.osaka.jp", 18u},
+  {"matsubushi.saitama.jp", 21u},
+  {"matsuda.kanagawa.jp", 19u},
+  {"matsudo.chiba.jp", 16u},
+  {"matsue.shimane.jp", 17u},
+  {"matsukawa.nagano.jp", 19u},
+  {"matsumae.hokkaido.jp", 20u},
+  {"matsumoto.kagoshima.jp", 22u},
+  {"matsumoto.nagano.jp", 19u},
+  {"matsuno.ehime.jp", 16u},
+  {"matsusaka.mie.jp", 16u},
+  {"matsushige.tokushima.jp", 23u},
+  {"matsushima.miyagi.jp", 20u},
+  {"matsuura.nagasaki.jp", 20u},
+  {"matsuyama.ehime.jp", 18u},
+  {"matsuzaki.shizuoka.jp", 21u},
+  {"matta-varjjat.no", 16u},
+  {"mattel", 6u},
+  {"mayfirst.info", 13u},
+  {"mayfirst.org", 12u},
+  {"mazeplay.com", 12u},
+  {"mazowsze.pl", 11u},
+  {"mazury.pl", 9u},
+  {"mb.ca", 5u},
+  {"mb.it", 5u},
+  {"mba", 3u},
+  {"mc", 2u},
+  {"mc.ax", 5u},
+  {"mc.eu.org", 9u},
+  {"mc.it", 5u},
+  {"mcdir.me", 8u},
+  {"mcdir.ru", 8u},
+  {"mckinsey", 8u},
+  {"mcpe.me", 7u},
+  {"mcpre.ru", 8u},
+  {"md", 2u},
+  {"md.ci", 5u},
+  {"md.us", 5u},
+  {"me", 2u},
+  {"me.eu.org", 9u},
+  {"me.in", 5u},
+  {"me.it", 5u},
+  {"me.ke", 5u},
+  {"me.so", 5u},
+  {"me.ss", 5u},
+  {"me.tc", 5u},
+  {"me.tz", 5u},
+  {"me.uk", 5u},
+  {"me.us", 5u},
+  {"me.vu", 5u},
+  {"med", 3u},
+  {"med.br", 6u},
+  {"med.ec", 6u},
+  {"med.ee", 6u},
+  {"med.ht", 6u},
+  {"med.ly", 6u},
+  {"med.om", 6u},
+  {"med.pa", 6u},
+  {"med.pl", 6u},
+  {"med.pro", 7u},
+  {"med.sa", 6u},
+  {"med.sd", 6u},
+  {"medecin.fr", 10u},
+  {"medecin.km", 10u},
+  {"media", 5u},
+  {"media.aero", 10u},
+  {"media.hu", 8u},
+  {"media.museum", 12u},
+  {"media.pl", 8u},
+  {"mediatech.by", 12u},
+  {"mediatech.dev", 13u},
+  {"medical.museum", 14u},
+  {"medicina.bo", 11u},
+  {"medio-campidano.it", 18u},
+  {"mediocampidano.it", 17u},
+  {"medizinhistorisches.museum", 26u},
+  {"meeres.museum", 13u},
+  {"meet", 4u},
+  {"meguro.tokyo.jp", 15u},
+  {"mein-iserv.de", 13u},
+  {"mein-vigor.de", 13u},
+  {"meinforum.net", 13u},
+  {"meiwa.gunma.jp", 14u},
+  {"meiwa.mie.jp", 12u},
+  {"mel.cloudlets.com.au", 20u},
+  {"meland.no", 9u},
+  {"melbourne", 9u},
+  {"meldal.no", 9u},
+  {"melhus.no", 9u},
+  {"meloy.no", 8u},
+  {"mel\303\270y.no", 9u},
+  {"members.linode.com", 18u},
+  {"meme", 4u},
+  {"memorial", 8u},
+  {"memorial.museum", 15u},
+  {"memset.net", 10u},
+  {"men", 3u},
+  {"menu", 4u},
+  {"meraker.no", 10u},
+  {"merckmsd", 8u},
+  {"merseine.nu", 11u},
+  {"mer\303\245ker.no", 11u},
+  {"mesaverde.museum", 16u},
+  {"messerli.app", 12u},
+  {"messina.it", 10u},
+  {"messwithdns.com", 15u},
+  {"meteorapp.com", 13u},
+  {"mex.com", 7u},
+  {"mg", 2u},
+  {"mg.gov.br", 9u},
+  {"mg.leg.br", 9u},
+  {"mh", 2u},
+  {"mi.it", 5u},
+  {"mi.th", 5u},
+  {"mi.us", 5u},
+  {"miami", 5u},
+  {"miasa.nagano.jp", 15u},
+  {"miasta.pl", 9u},
+  {"mibu.tochigi.jp", 15u},
+  {"michigan.museum", 15u},
+  {"microlight.aero", 15u},
+  {"microsoft", 9u},
+  {"midatlantic.museum", 18u},
+  {"midori.chiba.jp", 15u},
+  {"midori.gunma.jp", 15u},
+  {"midsund.no", 10u},
+  {"midtre-gauldal.no", 17u},
+  {"mie.jp", 6u},
+  {"mielec.pl", 9u},
+  {"mielno.pl", 9u},
+  {"mifune.kumamoto.jp", 18u},
+  {"mihama.aichi.jp", 15u},
+  {"mihama.chiba.jp", 15u},
+  {"mihama.fukui.jp", 15u},
+  {"mihama.mie.jp", 13u},
+  {"mihama.wakayama.jp", 18u},
+  {"mihara.hiroshima.jp", 19u},
+  {"mihara.kochi.jp", 15u},
+  {"miharu.fukushima.jp", 19u},
+  {"miho.ibaraki.jp", 15u},
+  {"mikasa.hokkaido.jp", 18u},
+  {"mikawa.yamagata.jp", 18u},
+  {"miki.hyogo.jp", 13u},
+  {"mil", 3u},
+  {"mil.ac", 6u},
+  {"mil.ae", 6u},
+  {"mil.al", 6u},
+  {"mil.ar", 6u},
+  {"mil.az", 6u},
+  {"mil.ba", 6u},
+  {"mil.bo", 6u},
+  {"mil.br", 6u},
+  {"mil.by", 6u},
+  {"mil.cl", 6u},
+  {"mil.cn", 6u},
+  {"mil.co", 6u},
+  {"mil.cy", 6u},
+  {"mil.do", 6u},
+  {"mil.ec", 6u},
+  {"mil.eg", 6u},
+  {"mil.fj", 6u},
+  {"mil.ge", 6u},
+  {"mil.gh", 6u},
+  {"mil.gt", 6u},
+  {"mil.hn", 6u},
+  {"mil.id", 6u},
+  {"mil.in", 6u},
+  {"mil.iq", 6u},
+  {"mil.jo", 6u},
+  {"mil.kg", 6u},
+  {"mil.km", 6u},
+  {"mil.kr", 6u},
+  {"mil.kz", 6u},
+  {"mil.lv", 6u},
+  {"mil.mg", 6u},
+  {"mil.mv", 6u},
+  {"mil.my", 6u},
+  {"mil.mz", 6u},
+  {"mil.ng", 6u},
+  {"mil.ni", 6u},
+  {"mil.no", 6u},
+  {"mil.nz", 6u},
+  {"mil.pe", 6u},
+  {"mil.ph", 6u},
+  {"mil.pl", 6u},
+  {"mil.py", 6u},
+  {"mil.qa", 6u},
+  {"mil.ru", 6u},
+  {"mil.rw", 6u},
+  {"mil.sh", 6u},
+  {"mil.st", 6u},
+  {"mil.sy", 6u},
+  {"mil.tj", 6u},
+  {"mil.tm", 6u},
+  {"mil.to", 6u},
+  {"mil.tr", 6u},
+  {"mil.tw", 6u},
+  {"mil.tz", 6u},
+  {"mil.uy", 6u},
+  {"mil.vc", 6u},
+  {"mil.ve", 6u},
+  {"mil.ye", 6u},
+  {"mil.za", 6u},
+  {"mil.zm", 6u},
+  {"mil.zw", 6u},
+  {"milan.it", 8u},
+  {"milano.it", 9u},
+  {"military.museum", 15u},
+  {"mill.museum", 11u},
+  {"mima.tokushima.jp", 17u},
+  {"mimata.miyazaki.jp", 18u},
+  {"minakami.gunma.jp", 17u},
+  {"minamata.kumamoto.jp", 20u},
+  {"minami-alps.yamanashi.jp", 24u},
+  {"minami.fukuoka.jp", 17u},
+  {"minami.kyoto.jp", 15u},
+  {"minami.tokushima.jp", 19u},
+  {"minamiaiki.nagano.jp", 20u},
+  {"minamiashigara.kanagawa.jp", 26u},
+  {"minamiawaji.hyogo.jp", 20u},
+  {"minamiboso.chiba.jp", 19u},
+  {"minamidaito.okinawa.jp", 22u},
+  {"minamiechizen.fukui.jp", 22u},
+  {"minamifurano.hokkaido.jp", 24u},
+  {"minamiise.mie.jp", 16u},
+  {"minamiizu.shizuoka.jp", 21u},
+  {"minamimaki.nagano.jp", 20u},
+  {"minamiminowa.nagano.jp", 22u},
+  {"minamioguni.kumamoto.jp", 23u},
+  {"minamisanriku.miyagi.jp", 23u},
+  {"minamitane.kagoshima.jp", 23u},
+  {"minamiuonuma.niigata.jp", 23u},
+  {"minamiyamashiro.kyoto.jp", 24u},
+  {"minano.saitama.jp", 17u},
+  {"minato.osaka.jp", 15u},
+  {"minato.tokyo.jp", 15u},
+  {"mincom.tn", 9u},
+  {"mine.nu", 7u},
+  {"miners.museum", 13u},
+  {"mini", 4u},
+  {"mining.museum", 13u},
+  {"miniserver.com", 14u},
+  {"minisite.ms", 11u},
+  {"minnesota.museum", 16u},
+  {"mino.gifu.jp", 12u},
+  {"minobu.yamanashi.jp", 19u},
+  {"minoh.osaka.jp", 14u},
+  {"minokamo.gifu.jp", 16u},
+  {"minowa.nagano.jp", 16u},
+  {"mint", 4u},
+  {"mintere.site", 12u},
+  {"mircloud.host", 13u},
+  {"mircloud.ru", 11u},
+  {"mircloud.us", 11u},
+  {"misaki.okayama.jp", 17u},
+  {"misaki.osaka.jp", 15u},
+  {"misasa.tottori.jp", 17u},
+  {"misato.akita.jp", 15u},
+  {"misato.miyagi.jp", 16u},
+  {"misato.saitama.jp", 17u},
+  {"misato.shimane.jp", 17u},
+  {"misato.wakayama.jp", 18u},
+  {"misawa.aomori.jp", 16u},
+  {"misconfused.org", 15u},
+  {"mishima.fukushima.jp", 20u},
+  {"mishima.shizuoka.jp", 19u},
+  {"missile.museum", 14u},
+  {"missoula.museum", 15u},
+  {"misugi.mie.jp", 13u},
+  {"mit", 3u},
+  {"mitaka.tokyo.jp", 15u},
+  {"mitake.gifu.jp", 14u},
+  {"mitane.akita.jp", 15u},
+  {"mito.ibaraki.jp", 15u},
+  {"mitou.yamaguchi.jp", 18u},
+  {"mitoyo.kagawa.jp", 16u},
+  {"mitsubishi", 10u},
+  {"mitsue.nara.jp", 14u},
+  {"mitsuke.niigata.jp", 18u},
+  {"miura.kanagawa.jp", 17u},
+  {"miyada.nagano.jp", 16u},
+  {"miyagi.jp", 9u},
+  {"miyake.nara.jp", 14u},
+  {"miyako.fukuoka.jp", 17u},
+  {"miyako.iwate.jp", 15u},
+  {"miyakonojo.miyazaki.jp", 22u},
+  {"miyama.fukuoka.jp", 17u},
+  {"miyama.mie.jp", 13u},
+  {"miyashiro.saitama.jp", 20u},
+  {"miyawaka.fukuoka.jp", 19u},
+  {"miyazaki.jp", 11u},
+  {"miyazaki.miyazaki.jp", 20u},
+  {"miyazu.kyoto.jp", 15u},
+  {"miyoshi.aichi.jp", 16u},
+  {"miyoshi.hiroshima.jp", 20u},
+  {"miyoshi.saitama.jp", 18u},
+  {"miyoshi.tokushima.jp", 20u},
+  {"miyota.nagano.jp", 16u},
+  {"mizuho.tokyo.jp", 15u},
+  {"mizumaki.fukuoka.jp", 19u},
+  {"mizunami.gifu.jp", 16u},
+  {"mizusawa.iwate.jp", 17u},
+  {"mjondalen.no", 12u},
+  {"mj\303\270ndalen.no", 13u},
+  {"mk", 2u},
+  {"mk.eu.org", 9u},
+  {"mk.ua", 5u},
+  {"ml", 2u},
+  {"mlb", 3u},
+  {"mlbfan.org", 10u},
+  {"mls", 3u},
+  {"mma", 3u},
+  {"mmafan.biz", 10u},
+  {"mn", 2u},
+  {"mn.it", 5u},
+  {"mn.us", 5u},
+  {"mo", 2u},
+  {"mo-i-rana.no", 12u},
+  {"mo-siemens.io", 13u},
+  {"mo.cn", 5u},
+  {"mo.it", 5u},
+  {"mo.us", 5u},
+  {"moareke.no", 10u},
+  {"mobara.chiba.jp", 15u},
+  {"mobi", 4u},
+  {"mobi.gp", 7u},
+  {"mobi.ke", 7u},
+  {"mobi.na", 7u},
+  {"mobi.ng", 7u},
+  {"mobi.tt", 7u},
+  {"mobi.tz", 7u},
+  {"mobile", 6u},
+  {"mochizuki.nagano.jp", 19u},
+  {"mock.pstmn.io", 13u},
+  {"mod.gi", 6u},
+  {"moda", 4u},
+  {"modalen.no", 10u},
+  {"modelling.aero", 14u},
+  {"modena.it", 9u},
+  {"modern.museum", 13u},
+  {"mods.jp", 7u},
+  {"modum.no", 8u},
+  {"moe", 3u},
+  {"moi", 3u},
+  {"moka.tochigi.jp", 15u},
+  {"mol.it", 6u},
+  {"molde.no", 8u},
+  {"molise.it", 9u},
+  {"mom", 3u},
+  {"moma.museum", 11u},
+  {"mombetsu.hokkaido.jp", 20u},
+  {"monash", 6u},
+  {"mond.jp", 7u},
+  {"money", 5u},
+  {"money.museum", 12u},
+  {"mongolian.jp", 12u},
+  {"monmouth.museum", 15u},
+  {"monster", 7u},
+  {"monticello.museum", 17u},
+  {"montreal.museum", 15u},
+  {"monza-brianza.it", 16u},
+  {"monza-e-della-brianza.it", 24u},
+  {"monza.it", 8u},
+  {"monzabrianza.it", 15u},
+  {"monzaebrianza.it", 16u},
+  {"monzaedellabrianza.it", 21u},
+  {"moo.jp", 6u},
+  {"moonscale.net", 13u},
+  {"mordovia.ru", 11u},
+  {"mordovia.su", 11u},
+  {"morena.br", 9u},
+  {"moriguchi.osaka.jp", 18u},
+  {"morimachi.shizuoka.jp", 21u},
+  {"morioka.iwate.jp", 16u},
+  {"moriya.ibaraki.jp", 17u},
+  {"moriyama.shiga.jp", 17u},
+  {"moriyoshi.akita.jp", 18u},
+  {"mormon", 6u},
+  {"morotsuka.miyazaki.jp", 21u},
+  {"moroyama.saitama.jp", 19u},
+  {"mortgage", 8u},
+  {"moscow", 6u},
+  {"moscow.museum", 13u},
+  {"moseushi.hokkaido.jp", 20u},
+  {"mosjoen.no", 10u},
+  {"mosj\303\270en.no", 11u},
+  {"moskenes.no", 11u},
+  {"moss.no", 7u},
+  {"mosvik.no", 9u},
+  {"motegi.tochigi.jp", 17u},
+  {"moto", 4u},
+  {"motobu.okinawa.jp", 17u},
+  {"motorcycle.museum", 17u},
+  {"motorcycles", 11u},
+  {"motosu.gifu.jp", 14u},
+  {"motoyama.kochi.jp", 17u},
+  {"mov", 3u},
+  {"movie", 5u},
+  {"movimiento.bo", 13u},
+  {"mozilla-iot.org", 15u},
+  {"mo\303\245reke.no", 11u},
+  {"mp", 2u},
+  {"mp.br", 5u},
+  {"mq", 2u},
+  {"mr", 2u},
+  {"mr.no", 5u},
+  {"mragowo.pl", 10u},
+  {"ms", 2u},
+  {"ms.gov.br", 9u},
+  {"ms.it", 5u},
+  {"ms.kr", 5u},
+  {"ms.leg.br", 9u},
+  {"ms.us", 5u},
+  {"msd", 3u},
+  {"msk.ru", 6u},
+  {"msk.su", 6u},
+  {"mt", 2u},
+  {"mt.eu.org", 9u},
+  {"mt.gov.br", 9u},
+  {"mt.it", 5u},
+  {"mt.leg.br", 9u},
+  {"mt.us", 5u},
+  {"mtn", 3u},
+  {"mtr", 3u},
+  {"mu", 2u},
+  {"muenchen.museum", 15u},
+  {"muenster.museum", 15u},
+  {"mugi.tokushima.jp", 17u},
+  {"muika.niigata.jp", 16u},
+  {"mukawa.hokkaido.jp", 18u},
+  {"muko.kyoto.jp", 13u},
+  {"mulhouse.museum", 15u},
+  {"munakata.fukuoka.jp", 19u},
+  {"muncie.museum", 13u},
+  {"muni.il", 7u},
+  {"muosat.no", 9u},
+  {"muos\303\241t.no", 10u},
+  {"mup.gov.pl", 10u},
+  {"murakami.niigata.jp", 19u},
+  {"murata.miyagi.jp", 16u},
+  {"murayama.yamagata.jp", 20u},
+  {"murmansk.su", 11u},
+  {"muroran.hokkaido.jp", 19u},
+  {"muroto.kochi.jp", 15u},
+  {"mus.br", 6u},
+  {"mus.mi.us", 9u},
+  {"musashimurayama.tokyo.jp", 24u},
+  {"musashino.tokyo.jp", 18u},
+  {"museet.museum", 13u},
+  {"museum", 6u},
+  {"museum.mv", 9u},
+  {"museum.mw", 9u},
+  {"museum.no", 9u},
+  {"museum.om", 9u},
+  {"museum.tt", 9u},
+  {"museumcenter.museum", 19u},
+  {"museumvereniging.museum", 23u},
+  {"music", 5u},
+  {"music.museum", 12u},
+  {"musica.ar", 9u},
+  {"musica.bo", 9u},
+  {"musician.io", 11u},
+  {"mutsu.aomori.jp", 15u},
+  {"mutsuzawa.chiba.jp", 18u},
+  {"mutual", 6u},
+  {"mutual.ar", 9u},
+  {"mv", 2u},
+  {"mw", 2u},
+  {"mw.gov.pl", 9u},
+  {"mx", 2u},
+  {"mx.na", 5u},
+  {"my", 2u},
+  {"my-firewall.org", 15u},
+  {"my-gateway.de", 13u},
+  {"my-router.de", 12u},
+  {"my-vigor.de", 11u},
+  {"my-wan.de", 9u},
+  {"my.eu.org", 9u},
+  {"my.id", 5u},
+  {"myactivedirectory.com", 21u},
+  {"myasustor.com", 13u},
+  {"mycd.eu", 7u},
+  {"mycloud.by", 10u},
+  {"mydatto.com", 11u},
+  {"mydatto.net", 11u},
+  {"myddns.rocks", 12u},
+  {"mydissent.net", 13u},
+  {"mydobiss.com", 12u},
+  {"mydrobo.com", 11u},
+  {"myds.me", 7u},
+  {"myeffect.net", 12u},
+  {"myfast.host", 11u},
+  {"myfast.space", 12u},
+  {"myfirewall.org", 14u},
+  {"myforum.community", 17u},
+  {"myfritz.net", 11u},
+  {"myftp.biz", 9u},
+  {"myftp.org", 9u},
+  {"myhome-server.de", 16u},
+  {"myiphost.com", 12u},
+  {"myjino.ru", 9u},
+  {"mykolaiv.ua", 11u},
+  {"mymailer.com.tw", 15u},
+  {"mymediapc.net", 13u},
+  {"myoko.niigata.jp", 16u},
+  {"mypep.link", 10u},
+  {"mypets.ws", 9u},
+  {"myphotos.cc", 11u},
+  {"mypi.co", 7u},
+  {"mypsx.net", 9u},
+  {"myqnapcloud.com", 15u},
+  {"myravendb.com", 13u},
+  {"mysecuritycamera.com", 20u},
+  {"mysecuritycamera.net", 20u},
+  {"mysecuritycamera.org", 20u},
+  {"myshopblocks.com", 16u},
+  {"myshopify.com", 13u},
+  {"myspreadshop.at", 15u},
+  {"myspreadshop.be", 15u},
+  {"myspreadshop.ca", 15u},
+  {"myspreadshop.ch", 15u},
+  {"myspreadshop.co.uk", 18u},
+  {"myspreadshop.com", 16u},
+  {"myspreadshop.com.au", 19u},
+  {"myspreadshop.de", 15u},
+  {"myspreadshop.dk", 15u},
+  {"myspreadshop.es", 15u},
+  {"myspreadshop.fi", 15u},
+  {"myspreadshop.fr", 15u},
+  {"myspreadshop.ie", 15u},
+  {"myspreadshop.it", 15u},
+  {"myspreadshop.net", 16u},
+  {"myspreadshop.nl", 15u},
+  {"myspreadshop.no", 15u},
+  {"myspreadshop.pl", 15u},
+  {"myspreadshop.se", 15u},
+  {"mytis.ru", 8u},
+  {"mytuleap.com", 12u},
+  {"myvnc.com", 9u},
+  {"mywire.org", 10u},
+  {"mz", 2u},
+  {"m\303\241latvuopmi.no", 15u},
+  {"m\303\241tta-v\303\241rjjat.no", 18u},
+  {"m\303\245lselv.no", 11u},
+  {"m\303\245s\303\270y.no", 10u},
+  {"m\304\201ori.nz", 9u},
+  {"n.bg", 4u},
+  {"n.se", 4u},
+  {"n4t.co", 6u},
+  {"na", 2u},
+  {"na.it", 5u},
+  {"na4u.ru", 7u},
+  {"naamesjevuemie.no", 17u},
+  {"nab", 3u},
+  {"nabari.mie.jp", 13u},
+  {"nachikatsuura.wakayama.jp", 25u},
+  {"nagahama.shiga.jp", 17u},
+  {"nagai.yamagata.jp", 17u},
+  {"nagano.jp", 9u},
+  {"nagano.nagano.jp", 16u},
+  {"naganohara.gunma.jp", 19u},
+  {"nagaoka.niigata.jp", 18u},
+  {"nagaokakyo.kyoto.jp", 19u},
+  {"nagara.chiba.jp", 15u},
+  {"nagareyama.chiba.jp", 19u},
+  {"nagasaki.jp", 11u},
+  {"nagasaki.nagasaki.jp", 20u},
+  {"nagasu.kumamoto.jp", 18u},
+  {"nagato.yamaguchi.jp", 19u},
+  {"nagatoro.saitama.jp", 19u},
+  {"nagawa.nagano.jp", 16u},
+  {"nagi.okayama.jp", 15u},
+  {"nagiso.nagano.jp", 16u},
+  {"nago.okinawa.jp", 15u},
+  {"nagoya", 6u},
+  {"naha.okinawa.jp", 15u},
+  {"nahari.kochi.jp", 15u},
+  {"naie.hokkaido.jp", 16u},
+  {"naka.hiroshima.jp", 17u},
+  {"naka.ibaraki.jp", 15u},
+  {"nakadomari.aomori.jp", 20u},
+  {"nakagawa.fukuoka.jp", 19u},
+  {"nakagawa.hokkaido.jp", 20u},
+  {"nakagawa.nagano.jp", 18u},
+  {"nakagawa.tokushima.jp", 21u},
+  {"nakagusuku.okinawa.jp", 21u},
+  {"nakagyo.kyoto.jp", 16u},
+  {"nakai.kanagawa.jp", 17u},
+  {"nakama.fukuoka.jp", 17u},
+  {"nakamichi.yamanashi.jp", 22u},
+  {"nakamura.kochi.jp", 17u},
+  {"nakaniikawa.toyama.jp", 21u},
+  {"nakano.nagano.jp", 16u},
+  {"nakano.tokyo.jp", 15u},
+  {"nakanojo.gunma.jp", 17u},
+  {"nakanoto.ishikawa.jp", 20u},
+  {"nakasatsunai.hokkaido.jp", 24u},
+  {"nakatane.kagoshima.jp", 21u},
+  {"nakatombetsu.hokkaido.jp", 24u},
+  {"nakatsugawa.gifu.jp", 19u},
+  {"nakayama.yamagata.jp", 20u},
+  {"nakijin.okinawa.jp", 18u},
+  {"naklo.pl", 8u},
+  {"nalchik.ru", 10u},
+  {"nalchik.su", 10u},
+  {"namaste.jp", 10u},
+  {"namdalseid.no", 13u},
+  {"name", 4u},
+  {"name.az", 7u},
+  {"name.eg", 7u},
+  {"name.et", 7u},
+  {"name.fj", 7u},
+  {"name.hr", 7u},
+  {"name.jo", 7u},
+  {"name.mk", 7u},
+  {"name.mv", 7u},
+  {"name.my", 7u},
+  {"name.na", 7u},
+  {"name.ng", 7u},
+  {"name.pm", 7u},
+  {"name.pr", 7u},
+  {"name.qa", 7u},
+  {"name.tj", 7u},
+  {"name.tr", 7u},
+  {"name.tt", 7u},
+  {"name.vn", 7u},
+  {"namegata.ibaraki.jp", 19u},
+  {"namegawa.saitama.jp", 19u},
+  {"namerikawa.toyama.jp", 20u},
+  {"namie.fukushima.jp", 18u},
+  {"namikata.ehime.jp", 17u},
+  {"namsos.no", 9u},
+  {"namsskogan.no", 13u},
+  {"nanae.hokkaido.jp", 17u},
+  {"nanao.ishikawa.jp", 17u},
+  {"nanbu.tottori.jp", 16u},
+  {"nanbu.yamanashi.jp", 18u},
+  {"nango.fukushima.jp", 18u},
+  {"nanjo.okinawa.jp", 16u},
+  {"nankoku.kochi.jp", 16u},
+  {"nanmoku.gunma.jp", 16u},
+  {"nannestad.no", 12u},
+  {"nanporo.hokkaido.jp", 19u},
+  {"nantan.kyoto.jp", 15u},
+  {"nanto.toyama.jp", 15u},
+  {"nanyo.yamagata.jp", 17u},
+  {"naoshima.kagawa.jp", 18u},
+  {"naples.it", 9u},
+  {"napoli.it", 9u},
+  {"nara.jp", 7u},
+  {"nara.nara.jp", 12u},
+  {"narashino.chiba.jp", 18u},
+  {"narita.chiba.jp", 15u},
+  {"naroy.no", 8u},
+  {"narusawa.yamanashi.jp", 21u},
+  {"naruto.tokushima.jp", 19u},
+  {"narviika.no", 11u},
+  {"narvik.no", 9u},
+  {"nasu.tochigi.jp", 15u},
+  {"nasushiobara.tochigi.jp", 23u},
+  {"nat.tn", 6u},
+  {"natal.br", 8u},
+  {"national.museum", 15u},
+  {"nationalfirearms.museum", 23u},
+  {"nationalheritage.museum", 23u},
+  {"nativeamerican.museum", 21u},
+  {"natori.miyagi.jp", 16u},
+  {"natura", 6u},
+  {"natural.bo", 10u},
+  {"naturalhistory.museum", 21u},
+  {"naturalhistorymuseum.museum", 27u},
+  {"naturalsciences.museum", 22u},
+  {"naturbruksgymn.se", 17u},
+  {"nature.museum", 13u},
+  {"naturhistorisches.museum", 24u},
+  {"natuurwetenschappen.museum", 26u},
+  {"naumburg.museum", 15u},
+  {"naustdal.no", 11u},
+  {"naval.museum", 12u},
+  {"navigation.aero", 15u},
+  {"navoi.su", 8u},
+  {"navuotna.no", 11u},
+  {"navy", 4u},
+  {"nayoro.hokkaido.jp", 18u},
+  {"nb.ca", 5u},
+  {"nba", 3u},
+  {"nc", 2u},
+  {"nc.tr", 5u},
+  {"nc.us", 5u},
+  {"nd.us", 5u},
+  {"ne", 2u},
+  {"ne.jp", 5u},
+  {"ne.ke", 5u},
+  {"ne.kr", 5u},
+  {"ne.pw", 5u},
+  {"ne.tz", 5u},
+  {"ne.ug", 5u},
+  {"ne.us", 5u},
+  {"neat-url.com", 12u},
+  {"nebraska.museum", 15u},
+  {"nec", 3u},
+  {"nedre-eiker.no", 14u},
+  {"neko.am", 7u},
+  {"nemuro.hokkaido.jp", 18u},
+  {"nerdpol.ovh", 11u},
+  {"nerima.tokyo.jp", 15u},
+  {"nes.akershus.no", 15u},
+  {"nes.buskerud.no", 15u},
+  {"nesna.no", 8u},
+  {"nesodden.no", 11u},
+  {"nesoddtangen.no", 15u},
+  {"nesseby.no", 10u},
+  {"nesset.no", 9u},
+  {"net", 3u},
+  {"net-freaks.com", 14u},
+  {"net.ac", 6u},
+  {"net.ae", 6u},
+  {"net.af", 6u},
+  {"net.ag", 6u},
+  {"net.ai", 6u},
+  {"net.al", 6u},
+  {"net.am", 6u},
+  {"net.ar", 6u},
+  {"net.au", 6u},
+  {"net.az", 6u},
+  {"net.ba", 6u},
+  {"net.bb", 6u},
+  {"net.bh", 6u},
+  {"net.bm", 6u},
+  {"net.bn", 6u},
+  {"net.bo", 6u},
+  {"net.br", 6u},
+  {"net.bs", 6u},
+  {"net.bt", 6u},
+  {"net.bz", 6u},
+  {"net.ci", 6u},
+  {"net.cm", 6u},
+  {"net.cn", 6u},
+  {"net.co", 6u},
+  {"net.cu", 6u},
+  {"net.cw", 6u},
+  {"net.cy", 6u},
+  {"net.dm", 6u},
+  {"net.do", 6u},
+  {"net.dz", 6u},
+  {"net.ec", 6u},
+  {"net.eg", 6u},
+  {"net.et", 6u},
+  {"net.eu.org", 10u},
+  {"net.fj", 6u},
+  {"net.fm", 6u},
+  {"net.ge", 6u},
+  {"net.gg", 6u},
+  {"net.gl", 6u},
+  {"net.gn", 6u},
+  {"net.gp", 6u},
+  {"net.gr", 6u},
+  {"net.gt", 6u},
+  {"net.gu", 6u},
+  {"net.gy", 6u},
+  {"net.hk", 6u},
+  {"net.hn", 6u},
+  {"net.ht", 6u},
+  {"net.id", 6u},
+  {"net.il", 6u},
+  {"net.im", 6u},
+  {"net.in", 6u},
+  {"net.iq", 6u},
+  {"net.ir", 6u},
+  {"net.is", 6u},
+  {"net.je", 6u},
+  {"net.jo", 6u},
+  {"net.kg", 6u},
+  {"net.ki", 6u},
+  {"net.kn", 6u},
+  {"net.kw", 6u},
+  {"net.ky", 6u},
+  {"net.kz", 6u},
+  {"net.la", 6u},
+  {"net.lb", 6u},
+  {"net.lc", 6u},
+  {"net.lk", 6u},
+  {"net.lr", 6u},
+  {"net.ls", 6u},
+  {"net.lv", 6u},
+  {"net.ly", 6u},
+  {"net.ma", 6u},
+  {"net.me", 6u},
+  {"net.mk", 6u},
+  {"net.ml", 6u},
+  {"net.mo", 6u},
+  {"net.ms", 6u},
+  {"net.mt", 6u},
+  {"net.mu", 6u},
+  {"net.mv", 6u},
+  {"net.mw", 6u},
+  {"net.mx", 6u},
+  {"net.my", 6u},
+  {"net.mz", 6u},
+  {"net.nf", 6u},
+  {"net.ng", 6u},
+  {"net.ni", 6u},
+  {"net.nr", 6u},
+  {"net.nz", 6u},
+  {"net.om", 6u},
+  {"net.pa", 6u},
+  {"net.pe", 6u},
+  {"net.ph", 6u},
+  {"net.pk", 6u},
+  {"net.pl", 6u},
+  {"net.pn", 6u},
+  {"net.pr", 6u},
+  {"net.ps", 6u},
+  {"net.pt", 6u},
+  {"net.py", 6u},
+  {"net.qa", 6u},
+  {"net.ru", 6u},
+  {"net.rw", 6u},
+  {"net.sa", 6u},
+  {"net.sb", 6u},
+  {"net.sc", 6u},
+  {"net.sd", 6u},
+  {"net.sg", 6u},
+  {"net.sh", 6u},
+  {"net.sl", 6u},
+  {"net.so", 6u},
+  {"net.ss", 6u},
+  {"net.st", 6u},
+  {"net.sy", 6u},
+  {"net.th", 6u},
+  {"net.tj", 6u},
+  {"net.tm", 6u},
+  {"net.tn", 6u},
+  {"net.to", 6u},
+  {"net.tr", 6u},
+  {"net.tt", 6u},
+  {"net.tw", 6u},
+  {"net.ua", 6u},
+  {"net.uk", 6u},
+  {"net.uy", 6u},
+  {"net.uz", 6u},
+  {"net.vc", 6u},
+  {"net.ve", 6u},
+  {"net.vi", 6u},
+  {"net.vn", 6u},
+  {"net.vu", 6u},
+  {"net.ws", 6u},
+  {"net.ye", 6u},
+  {"net.za", 6u},
+  {"net.zm", 6u},
+  {"netbank", 7u},
+  {"netflix", 7u},
+  {"netlify.app", 11u},
+  {"network", 7u},
+  {"neues.museum", 12u},
+  {"neustar", 7u},
+  {"new", 3u},
+  {"newhampshire.museum", 19u},
+  {"newjersey.museum", 16u},
+  {"newmexico.museum", 16u},
+  {"newport.museum", 14u},
+  {"news", 4u},
+  {"news.hu", 7u},
+  {"newspaper.museum", 16u},
+  {"newyork.museum", 14u},
+  {"next", 4u},
+  {"nextdirect", 10u},
+  {"nexus", 5u},
+  {"neyagawa.osaka.jp", 17u},
+  {"nf", 2u},
+  {"nf.ca", 5u},
+  {"nfl", 3u},
+  {"nflfan.org", 10u},
+  {"nfshost.com", 11u},
+  {"ng", 2u},
+  {"ng.eu.org", 9u},
+  {"ngo", 3u},
+  {"ngo.lk", 6u},
+  {"ngo.ng", 6u},
+  {"ngo.ph", 6u},
+  {"ngo.za", 6u},
+  {"ngrok.io", 8u},
+  {"nh-serv.co.uk", 13u},
+  {"nh.us", 5u},
+  {"nhk", 3u},
+  {"nhlfan.net", 10u},
+  {"nhs.uk", 6u},
+  {"ni", 2u},
+  {"nic.in", 6u},
+  {"nic.tj", 6u},
+  {"nic.za", 6u},
+  {"nichinan.miyazaki.jp", 20u},
+  {"nichinan.tottori.jp", 19u},
+  {"nico", 4u},
+  {"nid.io", 6u},
+  {"niepce.museum", 13u},
+  {"nieruchomosci.pl", 16u},
+  {"niigata.jp", 10u},
+  {"niigata.niigata.jp", 18u},
+  {"niihama.ehime.jp", 16u},
+  {"niikappu.hokkaido.jp", 20u},
+  {"niimi.okayama.jp", 16u},
+  {"niiza.saitama.jp", 16u},
+  {"nikaho.akita.jp", 15u},
+  {"nike", 4u},
+  {"niki.hokkaido.jp", 16u},
+  {"nikita.jp", 9u},
+  {"nikko.tochigi.jp", 16u},
+  {"nikolaev.ua", 11u},
+  {"nikon", 5u},
+  {"ninja", 5u},
+  {"ninohe.iwate.jp", 15u},
+  {"ninomiya.kanagawa.jp", 20u},
+  {"nirasaki.yamanashi.jp", 21u},
+  {"nis.za", 6u},
+  {"nishi.fukuoka.jp", 16u},
+  {"nishi.osaka.jp", 14u},
+  {"nishiaizu.fukushima.jp", 22u},
+  {"nishiarita.saga.jp", 18u},
+  {"nishiawakura.okayama.jp", 23u},
+  {"nishiazai.shiga.jp", 18u},
+  {"nishigo.fukushima.jp", 20u},
+  {"nishihara.kumamoto.jp", 21u},
+  {"nishihara.okinawa.jp", 20u},
+  {"nishiizu.shizuoka.jp", 20u},
+  {"nishikata.tochigi.jp", 20u},
+  {"nishikatsura.yamanashi.jp", 25u},
+  {"nishikawa.yamagata.jp", 21u},
+  {"nishimera.miyazaki.jp", 21u},
+  {"nishinomiya.hyogo.jp", 20u},
+  {"nishinoomote.kagoshima.jp", 25u},
+  {"nishinoshima.shimane.jp", 23u},
+  {"nishio.aichi.jp", 15u},
+  {"nishiokoppe.hokkaido.jp", 23u},
+  {"nishitosa.kochi.jp", 18u},
+  {"nishiwaki.hyogo.jp", 18u},
+  {"nissan", 6u},
+  {"nissay", 6u},
+  {"nissedal.no", 11u},
+  {"nisshin.aichi.jp", 16u},
+  {"niteroi.br", 10u},
+  {"nittedal.no", 11u},
+  {"niyodogawa.kochi.jp", 19u},
+  {"nj.us", 5u},
+  {"njs.jelastic.vps-host.net", 25u},
+  {"nl", 2u},
+  {"nl-ams-1.baremetal.scw.cloud", 28u},
+  {"nl.ca", 5u},
+  {"nl.ci", 5u},
+  {"nl.eu.org", 9u},
+  {"nl.no", 5u},
+  {"nm.cn", 5u},
+  {"nm.us", 5u},
+  {"no", 2u},
+  {"no-ip.biz", 9u},
+  {"no-ip.ca", 8u},
+  {"no-ip.co.uk", 11u},
+  {"no-ip.info", 10u},
+  {"no-ip.net", 9u},
+  {"no-ip.org", 9u},
+  {"no.com", 6u},
+  {"no.eu.org", 9u},
+  {"no.it", 5u},
+  {"nobeoka.miyazaki.jp", 19u},
+  {"noboribetsu.hokkaido.jp", 23u},
+  {"nobushi.jp", 10u},
+  {"noda.chiba.jp", 13u},
+  {"noda.iwate.jp", 13u},
+  {"nodes.k8s.fr-par.scw.cloud", 26u},
+  {"nodes.k8s.nl-ams.scw.cloud", 26u},
+  {"nodes.k8s.pl-waw.scw.cloud", 26u},
+  {"nog.community", 13u},
+  {"nogata.fukuoka.jp", 17u},
+  {"nogi.tochigi.jp", 15u},
+  {"noheji.aomori.jp", 16u},
+  {"noho.st", 7u},
+  {"nohost.me", 9u},
+  {"noip.me", 7u},
+  {"noip.us", 7u},
+  {"nokia", 5u},
+  {"nom.ad", 6u},
+  {"nom.ag", 6u},
+  {"nom.co", 6u},
+  {"nom.es", 6u},
+  {"nom.fr", 6u},
+  {"nom.km", 6u},
+  {"nom.mg", 6u},
+  {"nom.nc", 6u},
+  {"nom.ni", 6u},
+  {"nom.pa", 6u},
+  {"nom.pe", 6u},
+  {"nom.pl", 6u},
+  {"nom.re", 6u},
+  {"nom.ro", 6u},
+  {"nom.tm", 6u},
+  {"nom.ve", 6u},
+  {"nom.za", 6u},
+  {"nombre.bo", 9u},
+  {"nome.cv", 7u},
+  {"nome.pt", 7u},
+  {"nomi.ishikawa.jp", 16u},
+  {"nonoichi.ishikawa.jp", 20u},
+  {"noop.app", 8u},
+  {"noor.jp", 7u},
+  {"nord-aurdal.no", 14u},
+  {"nord-fron.no", 12u},
+  {"nord-odal.no", 12u},
+  {"norddal.no", 10u},
+  {"nordeste-idc.saveincloud.net", 28u},
+  {"nordkapp.no", 11u},
+  {"nordre-land.no", 14u},
+  {"nordreisa.no", 12u},
+  {"nore-og-uvdal.no", 16u},
+  {"norfolk.museum", 14u},
+  {"north-kazakhstan.su", 19u},
+  {"north.museum", 12u},
+  {"northwesternmutual", 18u},
+  {"norton", 6u},
+  {"nose.osaka.jp", 13u},
+  {"nosegawa.nara.jp", 16u},
+  {"noshiro.akita.jp", 16u},
+  {"not.br", 6u},
+  {"notaires.fr", 11u},
+  {"notaires.km", 11u},
+  {"noticeable.news", 15u},
+  {"noticias.bo", 11u},
+  {"noto.ishikawa.jp", 16u},
+  {"notodden.no", 11u},
+  {"notogawa.shiga.jp", 17u},
+  {"notteroy.no", 11u},
+  {"nov.ru", 6u},
+  {"nov.su", 6u},
+  {"novara.it", 9u},
+  {"novecore.site", 13u},
+  {"now", 3u},
+  {"now-dns.net", 11u},
+  {"now-dns.org", 11u},
+  {"now-dns.top", 11u},
+  {"now.sh", 6u},
+  {"nowaruda.pl", 11u},
+  {"nowruz", 6u},
+  {"nowtv", 5u},
+  {"nozawaonsen.nagano.jp", 21u},
+  {"nr", 2u},
+  {"nra", 3u},
+  {"nrw", 3u},
+  {"nrw.museum", 10u},
+  {"ns.ca", 5u},
+  {"nsn.us", 6u},
+  {"nsupdate.info", 13u},
+  {"nsw.au", 6u},
+  {"nsw.edu.au", 10u},
+  {"nt.au", 5u},
+  {"nt.ca", 5u},
+  {"nt.edu.au", 9u},
+  {"nt.no", 5u},
+  {"nt.ro", 5u},
+  {"ntdll.top", 9u},
+  {"ntr.br", 6u},
+  {"ntt", 3u},
+  {"nu", 2u},
+  {"nu.ca", 5u},
+  {"nu.it", 5u},
+  {"numata.gunma.jp", 15u},
+  {"numata.hokkaido.jp", 18u},
+  {"numazu.shizuoka.jp", 18u},
+  {"nuoro.it", 8u},
+  {"nv.us", 5u},
+  {"nx.cn", 5u},
+  {"ny-1.paas.massivegrid.net", 25u},
+  {"ny-2.paas.massivegrid.net", 25u},
+  {"ny.us", 5u},
+  {"nyaa.am", 7u},
+  {"nyan.to", 7u},
+  {"nyc", 3u},
+  {"nyc.mn", 6u},
+  {"nyc.museum", 10u},
+  {"nyny.museum", 11u},
+  {"nysa.pl", 7u},
+  {"nyuzen.toyama.jp", 16u},
+  {"nz", 2u},
+  {"nz.basketball", 13u},
+  {"nz.eu.org", 9u},
+  {"n\303\241vuotna.no", 12u},
+  {"n\303\245\303\245mesjevuemie.no", 19u},
+  {"n\303\246r\303\270y.no", 10u},
+  {"n\303\270tter\303\270y.no", 13u},
+  {"o.bg", 4u},
+  {"o.se", 4u},
+  {"oamishirasato.chiba.jp", 22u},
+  {"oarai.ibaraki.jp", 16u},
+  {"obama.fukui.jp", 14u},
+  {"obama.nagasaki.jp", 17u},
+  {"obanazawa.yamagata.jp", 21u},
+  {"obi", 3u},
+  {"obihiro.hokkaido.jp", 19u},
+  {"obira.hokkaido.jp", 17u},
+  {"obninsk.su", 10u},
+  {"observer", 8u},
+  {"obu.aichi.jp", 12u},
+  {"obuse.nagano.jp", 15u},
+  {"oceanographic.museum", 20u},
+  {"oceanographique.museum", 22u},
+  {"ocelot.mythic-beasts.com", 24u},
+  {"ochi.kochi.jp", 13u},
+  {"od.ua", 5u},
+  {"odate.akita.jp", 14u},
+  {"odawara.kanagawa.jp", 19u},
+  {"odda.no", 7u},
+  {"odesa.ua", 8u},
+  {"odessa.ua", 9u},
+  {"odo.br", 6u},
+  {"oe.yamagata.jp", 14u},
+  {"of.by", 5u},
+  {"of.fashion", 10u},
+  {"of.je", 5u},
+  {"of.london", 9u},
+  {"of.no", 5u},
+  {"off.ai", 6u},
+  {"office", 6u},
+  {"office-on-the.net", 17u},
+  {"official.academy", 16u},
+  {"official.ec", 11u},
+  {"ofunato.iwate.jp", 16u},
+  {"og.ao", 5u},
+  {"og.it", 5u},
+  {"oga.akita.jp", 12u},
+  {"ogaki.gifu.jp", 13u},
+  {"ogano.saitama.jp", 16u},
+  {"ogasawara.tokyo.jp", 18u},
+  {"ogata.akita.jp", 14u},
+  {"ogawa.ibaraki.jp", 16u},
+  {"ogawa.nagano.jp", 15u},
+  {"ogawa.saitama.jp", 16u},
+  {"ogawara.miyagi.jp", 17u},
+  {"ogi.saga.jp", 11u},
+  {"ogimi.okinawa.jp", 16u},
+  {"ogliastra.it", 12u},
+  {"ogori.fukuoka.jp", 16u},
+  {"ogose.saitama.jp", 16u},
+  {"oguchi.aichi.jp", 15u},
+  {"oguni.kumamoto.jp", 17u},
+  {"oguni.yamagata.jp", 17u},
+  {"oh.us", 5u},
+  {"oharu.aichi.jp", 14u},
+  {"ohda.shimane.jp", 15u},
+  {"ohi.fukui.jp", 12u},
+  {"ohira.miyagi.jp", 15u},
+  {"ohira.tochigi.jp", 16u},
+  {"ohkura.yamagata.jp", 18u},
+  {"ohtawara.tochigi.jp", 19u},
+  {"oi.kanagawa.jp", 14u},
+  {"oirase.aomori.jp", 16u},
+  {"oirm.gov.pl", 11u},
+  {"oishida.yamagata.jp", 19u},
+  {"oiso.kanagawa.jp", 16u},
+  {"oita.jp", 7u},
+  {"oita.oita.jp", 12u},
+  {"oizumi.gunma.jp", 15u},
+  {"oji.nara.jp", 11u},
+  {"ojiya.niigata.jp", 16u},
+  {"ok.us", 5u},
+  {"okagaki.fukuoka.jp", 18u},
+  {"okawa.fukuoka.jp", 16u},
+  {"okawa.kochi.jp", 14u},
+  {"okaya.nagano.jp", 15u},
+  {"okayama.jp", 10u},
+  {"okayama.okayama.jp", 18u},
+  {"okazaki.aichi.jp", 16u},
+  {"okegawa.saitama.jp", 18u},
+  {"oketo.hokkaido.jp", 17u},
+  {"oki.fukuoka.jp", 14u},
+  {"okinawa", 7u},
+  {"okinawa.jp", 10u},
+  {"okinawa.okinawa.jp", 18u},
+  {"okinoshima.shimane.jp", 21u},
+  {"okoppe.hokkaido.jp", 18u},
+  {"oksnes.no", 9u},
+  {"okuizumo.shimane.jp", 19u},
+  {"okuma.fukushima.jp", 18u},
+  {"okutama.tokyo.jp", 16u},
+  {"ol.no", 5u},
+  {"olawa.pl", 8u},
+  {"olayan", 6u},
+  {"olayangroup", 11u},
+  {"olbia-tempio.it", 15u},
+  {"olbiatempio.it", 14u},
+  {"oldnavy", 7u},
+  {"olecko.pl", 9u},
+  {"olkusz.pl", 9u},
+  {"ollo", 4u},
+  {"olsztyn.pl", 10u},
+  {"om", 2u},
+  {"omachi.nagano.jp", 16u},
+  {"omachi.saga.jp", 14u},
+  {"omaezaki.shizuoka.jp", 20u},
+  {"omaha.museum", 12u},
+  {"omasvuotna.no", 13u},
+  {"ome.tokyo.jp", 12u},
+  {"omega", 5u},
+  {"omg.lol", 7u},
+  {"omi.nagano.jp", 13u},
+  {"omi.niigata.jp", 14u},
+  {"omigawa.chiba.jp", 16u},
+  {"omihachiman.shiga.jp", 20u},
+  {"omitama.ibaraki.jp", 18u},
+  {"omiya.saitama.jp", 16u},
+  {"omniwe.site", 11u},
+  {"omotego.fukushima.jp", 20u},
+  {"omura.nagasaki.jp", 17u},
+  {"omuta.fukuoka.jp", 16u},
+  {"on-aptible.com", 14u},
+  {"on-the-web.tv", 13u},
+  {"on-web.fr", 9u},
+  {"on.ca", 5u},
+  {"onagawa.miyagi.jp", 17u},
+  {"onavstack.net", 13u},
+  {"oncilla.mythic-beasts.com", 25u},
+  {"ondigitalocean.app", 18u},
+  {"one", 3u},
+  {"onfabrica.com", 13u},
+  {"onflashdrive.app", 16u},
+  {"ong", 3u},
+  {"ong.br", 6u},
+  {"onga.fukuoka.jp", 15u},
+  {"onion", 5u},
+  {"onjuku.chiba.jp", 15u},
+  {"onl", 3u},
+  {"online", 6u},
+  {"online.museum", 13u},
+  {"online.th", 9u},
+  {"onna.okinawa.jp", 15u},
+  {"ono.fukui.jp", 12u},
+  {"ono.fukushima.jp", 16u},
+  {"ono.hyogo.jp", 12u},
+  {"onojo.fukuoka.jp", 16u},
+  {"onomichi.hiroshima.jp", 21u},
+  {"onporter.run", 12u},
+  {"onred.one", 9u},
+  {"onrender.com", 12u},
+  {"ontario.museum", 14u},
+  {"onthewifi.com", 13u},
+  {"onza.mythic-beasts.com", 22u},
+  {"ooguy.com", 9u},
+  {"ookuwa.nagano.jp", 16u},
+  {"ooo", 3u},
+  {"oops.jp", 7u},
+  {"ooshika.nagano.jp", 17u},
+  {"open", 4u},
+  {"openair.museum", 14u},
+  {"opencraft.hosting", 17u},
+  {"opensocial.site", 15u},
+  {"operaunite.com", 14u},
+  {"opoczno.pl", 10u},
+  {"opole.pl", 8u},
+  {"oppdal.no", 9u},
+  {"oppegard.no", 11u},
+  {"oppeg\303\245rd.no", 12u},
+  {"or.at", 5u},
+  {"or.bi", 5u},
+  {"or.ci", 5u},
+  {"or.cr", 5u},
+  {"or.id", 5u},
+  {"or.it", 5u},
+  {"or.jp", 5u},
+  {"or.ke", 5u},
+  {"or.kr", 5u},
+  {"or.mu", 5u},
+  {"or.na", 5u},
+  {"or.pw", 5u},
+  {"or.th", 5u},
+  {"or.tz", 5u},
+  {"or.ug", 5u},
+  {"or.us", 5u},
+  {"ora.gunma.jp", 12u},
+  {"oracle", 6u},
+  {"orange", 6u},
+  {"orangecloud.tn", 14u},
+  {"oregon.museum", 13u},
+  {"oregontrail.museum", 18u},
+  {"org", 3u},
+  {"org.ac", 6u},
+  {"org.ae", 6u},
+  {"org.af", 6u},
+  {"org.ag", 6u},
+  {"org.ai", 6u},
+  {"org.al", 6u},
+  {"org.am", 6u},
+  {"org.ar", 6u},
+  {"org.au", 6u},
+  {"org.az", 6u},
+  {"org.ba", 6u},
+  {"org.bb", 6u},
+  {"org.bh", 6u},
+  {"org.bi", 6u},
+  {"org.bm", 6u},
+  {"org.bn", 6u},
+  {"org.bo", 6u},
+  {"org.br", 6u},
+  {"org.bs", 6u},
+  {"org.bt", 6u},
+  {"org.bw", 6u},
+  {"org.bz", 6u},
+  {"org.ci", 6u},
+  {"org.cn", 6u},
+  {"org.co", 6u},
+  {"org.cu", 6u},
+  {"org.cv", 6u},
+  {"org.cw", 6u},
+  {"org.cy", 6u},
+  {"org.dm", 6u},
+  {"org.do", 6u},
+  {"org.dz", 6u},
+  {"org.ec", 6u},
+  {"org.ee", 6u},
+  {"org.eg", 6u},
+  {"org.es", 6u},
+  {"org.et", 6u},
+  {"org.fj", 6u},
+  {"org.fm", 6u},
+  {"org.ge", 6u},
+  {"org.gg", 6u},
+  {"org.gh", 6u},
+  {"org.gi", 6u},
+  {"org.gl", 6u},
+  {"org.gn", 6u},
+  {"org.gp", 6u},
+  {"org.gr", 6u},
+  {"org.gt", 6u},
+  {"org.gu", 6u},
+  {"org.gy", 6u},
+  {"org.hk", 6u},
+  {"org.hn", 6u},
+  {"org.ht", 6u},
+  {"org.hu", 6u},
+  {"org.il", 6u},
+  {"org.im", 6u},
+  {"org.in", 6u},
+  {"org.iq", 6u},
+  {"org.ir", 6u},
+  {"org.is", 6u},
+  {"org.je", 6u},
+  {"org.jo", 6u},
+  {"org.kg", 6u},
+  {"org.ki", 6u},
+  {"org.km", 6u},
+  {"org.kn", 6u},
+  {"org.kp", 6u},
+  {"org.kw", 6u},
+  {"org.ky", 6u},
+  {"org.kz", 6u},
+  {"org.la", 6u},
+  {"org.lb", 6u},
+  {"org.lc", 6u},
+  {"org.lk", 6u},
+  {"org.lr", 6u},
+  {"org.ls", 6u},
+  {"org.lv", 6u},
+  {"org.ly", 6u},
+  {"org.ma", 6u},
+  {"org.me", 6u},
+  {"org.mg", 6u},
+  {"org.mk", 6u},
+  {"org.ml", 6u},
+  {"org.mn", 6u},
+  {"org.mo", 6u},
+  {"org.ms", 6u},
+  {"org.mt", 6u},
+  {"org.mu", 6u},
+  {"org.mv", 6u},
+  {"org.mw", 6u},
+  {"org.mx", 6u},
+  {"org.my", 6u},
+  {"org.mz", 6u},
+  {"org.na", 6u},
+  {"org.ng", 6u},
+  {"org.ni", 6u},
+  {"org.nr", 6u},
+  {"org.nz", 6u},
+  {"org.om", 6u},
+  {"org.pa", 6u},
+  {"org.pe", 6u},
+  {"org.pf", 6u},
+  {"org.ph", 6u},
+  {"org.pk", 6u},
+  {"org.pl", 6u},
+  {"org.pn", 6u},
+  {"org.pr", 6u},
+  {"org.ps", 6u},
+  {"org.pt", 6u},
+  {"org.py", 6u},
+  {"org.qa", 6u},
+  {"org.ro", 6u},
+  {"org.rs", 6u},
+  {"org.ru", 6u},
+  {"org.rw", 6u},
+  {"org.sa", 6u},
+  {"org.sb", 6u},
+  {"org.sc", 6u},
+  {"org.sd", 6u},
+  {"org.se", 6u},
+  {"org.sg", 6u},
+  {"org.sh", 6u},
+  {"org.sl", 6u},
+  {"org.sn", 6u},
+  {"org.so", 6u},
+  {"org.ss", 6u},
+  {"org.st", 6u},
+  {"org.sv", 6u},
+  {"org.sy", 6u},
+  {"org.sz", 6u},
+  {"org.tj", 6u},
+  {"org.tm", 6u},
+  {"org.tn", 6u},
+  {"org.to", 6u},
+  {"org.tr", 6u},
+  {"org.tt", 6u},
+  {"org.tw", 6u},
+  {"org.ua", 6u},
+  {"org.ug", 6u},
+  {"org.uk", 6u},
+  {"org.uy", 6u},
+  {"org.uz", 6u},
+  {"org.vc", 6u},
+  {"org.ve", 6u},
+  {"org.vi", 6u},
+  {"org.vn", 6u},
+  {"org.vu", 6u},
+  {"org.ws", 6u},
+  {"org.ye", 6u},
+  {"org.yt", 6u},
+  {"org.za", 6u},
+  {"org.zm", 6u},
+  {"org.zw", 6u},
+  {"organic", 7u},
+  {"origins", 7u},
+  {"oristano.it", 11u},
+  {"orkanger.no", 11u},
+  {"orkdal.no", 9u},
+  {"orland.no", 9u},
+  {"orsites.com", 11u},
+  {"orskog.no", 9u},
+  {"orsta.no", 8u},
+  {"orx.biz", 7u},
+  {"os.hedmark.no", 13u},
+  {"os.hordaland.no", 15u},
+  {"osaka", 5u},
+  {"osaka.jp", 8u},
+  {"osakasayama.osaka.jp", 20u},
+  {"osaki.miyagi.jp", 15u},
+  {"osakikamijima.hiroshima.jp", 26u},
+  {"osasco.br", 9u},
+  {"osen.no", 7u},
+  {"oseto.nagasaki.jp", 17u},
+  {"oshima.tokyo.jp", 15u},
+  {"oshima.yamaguchi.jp", 19u},
+  {"oshino.yamanashi.jp", 19u},
+  {"oshu.iwate.jp", 13u},
+  {"oslo.no", 7u},
+  {"osoyro.no", 9u},
+  {"osteroy.no", 10u},
+  {"oster\303\270y.no", 11u},
+  {"ostre-toten.no", 14u},
+  {"ostroda.pl", 10u},
+  {"ostroleka.pl", 12u},
+  {"ostrowiec.pl", 12u},
+  {"ostrowwlkp.pl", 13u},
+  {"os\303\270yro.no", 10u},
+  {"ot.it", 5u},
+  {"ota.gunma.jp", 12u},
+  {"ota.tokyo.jp", 12u},
+  {"otago.museum", 12u},
+  {"otake.hiroshima.jp", 18u},
+  {"otaki.chiba.jp", 14u},
+  {"otaki.nagano.jp", 15u},
+  {"otaki.saitama.jp", 16u},
+  {"otama.fukushima.jp", 18u},
+  {"otari.nagano.jp", 15u},
+  {"otaru.hokkaido.jp", 17u},
+  {"other.nf", 8u},
+  {"oto.fukuoka.jp", 14u},
+  {"otobe.hokkaido.jp", 17u},
+  {"otofuke.hokkaido.jp", 19u},
+  {"otoineppu.hokkaido.jp", 21u},
+  {"otoyo.kochi.jp", 14u},
+  {"otsu.shiga.jp", 13u},
+  {"otsuchi.iwate.jp", 16u},
+  {"otsuka", 6u},
+  {"otsuki.kochi.jp", 15u},
+  {"otsuki.yamanashi.jp", 19u},
+  {"ott", 3u},
+  {"ouchi.saga.jp", 13u},
+  {"ouda.nara.jp", 12u},
+  {"oum.gov.pl", 10u},
+  {"oumu.hokkaido.jp", 16u},
+  {"outsystemscloud.com", 19u},
+  {"overhalla.no", 12u},
+  {"ovh", 3u},
+  {"ovre-eiker.no", 13u},
+  {"owani.aomori.jp", 15u},
+  {"owariasahi.aichi.jp", 19u},
+  {"own.pm", 6u},
+  {"ownip.net", 9u},
+  {"ownprovider.com", 15u},
+  {"ox.rs", 5u},
+  {"oxa.cloud", 9u},
+  {"oxford.museum", 13u},
+  {"oy.lc", 5u},
+  {"oya.to", 6u},
+  {"oyabe.toyama.jp", 15u},
+  {"oyama.tochigi.jp", 16u},
+  {"oyamazaki.kyoto.jp", 18u},
+  {"oyer.no", 7u},
+  {"oygarden.no", 11u},
+  {"oyodo.nara.jp", 13u},
+  {"oystre-slidre.no", 16u},
+  {"oz.au", 5u},
+  {"ozora.hokkaido.jp", 17u},
+  {"ozu.ehime.jp", 12u},
+  {"ozu.kumamoto.jp", 15u},
+  {"p.bg", 4u},
+  {"p.se", 4u},
+  {"pa", 2u},
+  {"pa.gov.br", 9u},
+  {"pa.gov.pl", 9u},
+  {"pa.it", 5u},
+  {"pa.leg.br", 9u},
+  {"pa.us", 5u},
+  {"paas.beebyte.io", 15u},
+  {"paas.datacenter.fi", 18u},
+  {"paas.hosted-by-previder.com", 27u},
+  {"paas.massivegrid.com", 20u},
+  {"pacific.museum", 14u},
+  {"paderborn.museum", 16u},
+  {"padova.it", 9u},
+  {"padua.it", 8u},
+  {"page", 4u},
+  {"pagefrontapp.com", 16u},
+  {"pages.dev", 9u},
+  {"pages.it.hs-heilbronn.de", 24u},
+  {"pages.torproject.net", 20u},
+  {"pages.wiardweb.com", 18u},
+  {"pagespeedmobilizer.com", 22u},
+  {"pagexl.com", 10u},
+  {"palace.museum", 13u},
+  {"paleo.museum", 12u},
+  {"palermo.it", 10u},
+  {"palmas.br", 9u},
+  {"palmsprings.museum", 18u},
+  {"panama.museum", 13u},
+  {"panasonic", 9u},
+  {"panel.gg", 8u},
+  {"pantheonsite.io", 15u},
+  {"parachuting.aero", 16u},
+  {"paragliding.aero", 16u},
+  {"parallel.jp", 11u},
+  {"parasite.jp", 11u},
+  {"paris", 5u},
+  {"paris.eu.org", 12u},
+  {"paris.museum", 12u},
+  {"parliament.nz", 13u},
+  {"parma.it", 8u},
+  {"paroch.k12.ma.us", 16u},
+  {"pars", 4u},
+  {"parti.se", 8u},
+  {"partners", 8u},
+  {"parts", 5u},
+  {"party", 5u},
+  {"pasadena.museum", 15u},
+  {"passagens", 9u},
+  {"passenger-association.aero", 26u},
+  {"patria.bo", 9u},
+  {"pavia.it", 8u},
+  {"pay", 3u},
+  {"pb.ao", 5u},
+  {"pb.gov.br", 9u},
+  {"pb.leg.br", 9u},
+  {"pc.it", 5u},
+  {"pc.pl", 5u},
+  {"pccw", 4u},
+  {"pcloud.host", 11u},
+  {"pd.it", 5u},
+  {"pdns.page", 9u},
+  {"pe", 2u},
+  {"pe.ca", 5u},
+  {"pe.gov.br", 9u},
+  {"pe.it", 5u},
+  {"pe.kr", 5u},
+  {"pe.leg.br", 9u},
+  {"pecori.jp", 9u},
+  {"peewee.jp", 9u},
+  {"penne.jp", 8u},
+  {"penza.su", 8u},
+  {"pepper.jp", 9u},
+  {"per.la", 6u},
+  {"per.nf", 6u},
+  {"per.sg", 6u},
+  {"perma.jp", 8u},
+  {"perso.ht", 8u},
+  {"perso.sn", 8u},
+  {"perso.tn", 8u},
+  {"perspecta.cloud", 15u},
+  {"perugia.it", 10u},
+  {"pesaro-urbino.it", 16u},
+  {"pesarourbino.it", 15u},
+  {"pescara.it", 10u},
+  {"pet", 3u},
+  {"pf", 2u},
+  {"pfizer", 6u},
+  {"pg.in", 5u},
+  {"pg.it", 5u},
+  {"pgafan.net", 10u},
+  {"pgfog.com", 9u},
+  {"ph", 2u},
+  {"pharmacien.fr", 13u},
+  {"pharmaciens.km", 14u},
+  {"pharmacy", 8u},
+  {"pharmacy.museum", 15u},
+  {"phd", 3u},
+  {"philadelphia.museum", 19u},
+  {"philadelphiaarea.museum", 23u},
+  {"philately.museum", 16u},
+  {"philips", 7u},
+  {"phoenix.museum", 14u},
+  {"phone", 5u},
+  {"photo", 5u},
+  {"photography", 11u},
+  {"photography.museum", 18u},
+  {"photos", 6u},
+  {"phx.enscaled.us", 15u},
+  {"physio", 6u},
+  {"pi.gov.br", 9u},
+  {"pi.it", 5u},
+  {"pi.leg.br", 9u},
+  {"piacenza.it", 11u},
+  {"pics", 4u},
+  {"pictet", 6u},
+  {"pictures", 8u},
+  {"pid", 3u},
+  {"piedmont.it", 11u},
+  {"piemonte.it", 11u},
+  {"pigboat.jp", 10u},
+  {"pila.pl", 7u},
+  {"pilot.aero", 10u},
+  {"pilots.museum", 13u},
+  {"pimienta.org", 12u},
+  {"pin", 3u},
+  {"pinb.gov.pl", 11u},
+  {"ping", 4u},
+  {"pink", 4u},
+  {"pinoko.jp", 9u},
+  {"pioneer", 7u},
+  {"pippu.hokkaido.jp", 17u},
+  {"pisa.it", 7u},
+  {"pistoia.it", 10u},
+  {"pisz.pl", 7u},
+  {"pittsburgh.museum", 17u},
+  {"piw.gov.pl", 10u},
+  {"pixolino.com", 12u},
+  {"pizza", 5u},
+  {"pk", 2u},
+  {"pl", 2u},
+  {"pl.eu.org", 9u},
+  {"pl.ua", 5u},
+  {"place", 5u},
+  {"planetarium.museum", 18u},
+  {"plantation.museum", 17u},
+  {"plants.museum", 13u},
+  {"platform0.app", 13u},
+  {"platter-app.com", 15u},
+  {"platter-app.dev", 15u},
+  {"platterp.us", 11u},
+  {"play", 4u},
+  {"playstation", 11u},
+  {"playstation-cloud.com", 21u},
+  {"plaza.museum", 12u},
+  {"plc.co.im", 9u},
+  {"plc.ly", 6u},
+  {"plc.uk", 6u},
+  {"plesk.page", 10u},
+  {"pleskns.com", 11u},
+  {"plo.ps", 6u},
+  {"plumbing", 8u},
+  {"plurinacional.bo", 16u},
+  {"plus", 4u},
+  {"pm", 2u},
+  {"pmn.it", 6u},
+  {"pn", 2u},
+  {"pn.it", 5u},
+  {"pnc", 3u},
+  {"po.gov.pl", 9u},
+  {"po.it", 5u},
+  {"poa.br", 6u},
+  {"podhale.pl", 10u},
+  {"podlasie.pl", 11u},
+  {"podzone.net", 11u},
+  {"podzone.org", 11u},
+  {"pohl", 4u},
+  {"point2this.com", 14u},
+  {"pointto.us", 10u},
+  {"poivron.org", 11u},
+  {"poker", 5u},
+  {"pokrovsk.su", 11u},
+  {"pol.dz", 6u},
+  {"pol.ht", 6u},
+  {"pol.tr", 6u},
+  {"police.uk", 9u},
+  {"politica.bo", 11u},
+  {"politie", 7u},
+  {"polkowice.pl", 12u},
+  {"poltava.ua", 10u},
+  {"pomorskie.pl", 12u},
+  {"pomorze.pl", 10u},
+  {"poniatowa.pl", 12u},
+  {"ponpes.id", 9u},
+  {"pony.club", 9u},
+  {"pordenone.it", 12u},
+  {"porn", 4u},
+  {"porsanger.no", 12u},
+  {"porsangu.no", 11u},
+  {"porsgrunn.no", 12u},
+  {"pors\303\241\305\213gu.no", 13u},
+  {"port.fr", 7u},
+  {"portal.museum", 13u},
+  {"portland.museum", 15u},
+  {"portlligat.museum", 17u},
+  {"post", 4u},
+  {"post.in", 7u},
+  {"postman-echo.com", 16u},
+  {"posts-and-telecommunications.museum", 35u},
+  {"potager.org", 11u},
+  {"potenza.it", 10u},
+  {"powiat.pl", 9u},
+  {"poznan.pl", 9u},
+  {"pp.az", 5u},
+  {"pp.ru", 5u},
+  {"pp.se", 5u},
+  {"pp.ua", 5u},
+  {"ppg.br", 6u},
+  {"pr", 2u},
+  {"pr.gov.br", 9u},
+  {"pr.it", 5u},
+  {"pr.leg.br", 9u},
+  {"pr.us", 5u},
+  {"pramerica", 9u},
+  {"prato.it", 8u},
+  {"praxi", 5u},
+  {"prd.fr", 6u},
+  {"prd.km", 6u},
+  {"prd.mg", 6u},
+  {"prequalifyme.today", 18u},
+  {"preservation.museum", 19u},
+  {"presidio.museum", 15u},
+  {"press", 5u},
+  {"press.aero", 10u},
+  {"press.cy", 8u},
+  {"press.ma", 8u},
+  {"press.museum", 12u},
+  {"press.se", 8u},
+  {"presse.ci", 9u},
+  {"presse.km", 9u},
+  {"presse.ml", 9u},
+  {"pri.ee", 6u},
+  {"prime", 5u},
+  {"primetel.cloud", 14u},
+  {"principe.st", 11u},
+  {"priv.at", 7u},
+  {"priv.hu", 7u},
+  {"priv.instances.scw.cloud", 24u},
+  {"priv.me", 7u},
+  {"priv.no", 7u},
+  {"priv.pl", 7u},
+  {"privatizehealthinsurance.net", 28u},
+  {"pro", 3u},
+  {"pro.az", 6u},
+  {"pro.br", 6u},
+  {"pro.cy", 6u},
+  {"pro.ec", 6u},
+  {"pro.fj", 6u},
+  {"pro.ht", 6u},
+  {"pro.in", 6u},
+  {"pro.mv", 6u},
+  {"pro.na", 6u},
+  {"pro.om", 6u},
+  {"pro.pr", 6u},
+  {"pro.tt", 6u},
+  {"pro.typeform.com", 16u},
+  {"pro.vn", 6u},
+  {"prochowice.pl", 13u},
+  {"prod", 4u},
+  {"production.aero", 15u},
+  {"productions", 11u},
+  {"prof", 4u},
+  {"prof.pr", 7u},
+  {"profesional.bo", 14u},
+  {"progressive", 11u},
+  {"project.museum", 14u},
+  {"promo", 5u},
+  {"properties", 10u},
+  {"property", 8u},
+  {"protection", 10u},
+  {"protonet.io", 11u},
+  {"pru", 3u},
+  {"prudential", 10u},
+  {"pruszkow.pl", 11u},
+  {"prvcy.page", 10u},
+  {"przeworsk.pl", 12u},
+  {"ps", 2u},
+  {"psc.br", 6u},
+  {"psi.br", 6u},
+  {"psp.gov.pl", 10u},
+  {"psse.gov.pl", 11u},
+  {"pstmn.io", 8u},
+  {"pt", 2u},
+  {"pt.eu.org", 9u},
+  {"pt.it", 5u},
+  {"pu.it", 5u},
+  {"pub", 3u},
+  {"pub.instances.scw.cloud", 23u},
+  {"pub.sa", 6u},
+  {"publ.pt", 7u},
+  {"public-inquiry.uk", 17u},
+  {"public.museum", 13u},
+  {"publishproxy.com", 16u},
+  {"pubol.museum", 12u},
+  {"pubtls.org", 10u},
+  {"pueblo.bo", 9u},
+  {"pug.it", 6u},
+  {"puglia.it", 9u},
+  {"pulawy.pl", 9u},
+  {"punyu.jp", 8u},
+  {"pup.gov.pl", 10u},
+  {"pupu.jp", 7u},
+  {"pussycat.jp", 11u},
+  {"pv.it", 5u},
+  {"pvh.br", 6u},
+  {"pvt.ge", 6u},
+  {"pvt.k12.ma.us", 13u},
+  {"pw", 2u},
+  {"pwc", 3u},
+  {"py", 2u},
+  {"pya.jp", 6u},
+  {"pyatigorsk.ru", 13u},
+  {"pymnt.uk", 8u},
+  {"pythonanywhere.com", 18u},
+  {"pz.it", 5u},
+  {"q-a.eu.org", 10u},
+  {"q.bg", 4u},
+  {"qa", 2u},
+  {"qa2.com", 7u},
+  {"qbuser.com", 10u},
+  {"qc.ca", 5u},
+  {"qc.com", 6u},
+  {"qcx.io", 6u},
+  {"qh.cn", 5u},
+  {"qld.au", 6u},
+  {"qld.edu.au", 10u},
+  {"qld.gov.au", 10u},
+  {"qoto.io", 7u},
+  {"qpon", 4u},
+  {"qsl.br", 6u},
+  {"qualifioapp.com", 15u},
+  {"quebec", 6u},
+  {"quebec.museum", 13u},
+  {"quest", 5u},
+  {"quicksytes.com", 14u},
+  {"r.bg", 4u},
+  {"r.cdn77.net", 11u},
+  {"r.se", 4u},
+  {"ra.it", 5u},
+  {"racing", 6u},
+  {"rackmaze.com", 12u},
+  {"rackmaze.net", 12u},
+  {"rade.no", 7u},
+  {"radio", 5u},
+  {"radio.am", 8u},
+  {"radio.br", 8u},
+  {"radio.fm", 8u},
+  {"radom.pl", 8u},
+  {"radoy.no", 8u},
+  {"rad\303\270y.no", 9u},
+  {"raffleentry.org.uk", 18u},
+  {"rag-cloud-ch.hosteur.com", 24u},
+  {"rag-cloud.hosteur.com", 21u},
+  {"ragusa.it", 9u},
+  {"rahkkeravju.no", 14u},
+  {"raholt.no", 9u},
+  {"railroad.museum", 15u},
+  {"railway.museum", 14u},
+  {"raindrop.jp", 11u},
+  {"raisa.no", 8u},
+  {"rakkestad.no", 12u},
+  {"ralingen.no", 11u},
+  {"rana.no", 7u},
+  {"randaberg.no", 12u},
+  {"rankoshi.hokkaido.jp", 20u},
+  {"ranzan.saitama.jp", 17u},
+  {"rar.ve", 6u},
+  {"ras.ru", 6u},
+  {"rauma.no", 8u},
+  {"ravendb.cloud", 13u},
+  {"ravendb.community", 17u},
+  {"ravendb.me", 10u},
+  {"ravendb.run", 11u},
+  {"ravenna.it", 10u},
+  {"ravpage.co.il", 13u},
+  {"rawa-maz.pl", 11u},
+  {"rc.it", 5u},
+  {"rdv.to", 6u},
+  {"re", 2u},
+  {"re.it", 5u},
+  {"re.kr", 5u},
+  {"read", 4u},
+  {"read-books.org", 14u},
+  {"readmyblog.org", 14u},
+  {"readthedocs.io", 14u},
+  {"readymade.jp", 12u},
+  {"realestate", 10u},
+  {"realestate.pl", 13u},
+  {"realm.cz", 8u},
+  {"realtor", 7u},
+  {"realty", 6u},
+  {"rebun.hokkaido.jp", 17u},
+  {"rec.br", 6u},
+  {"rec.co", 6u},
+  {"rec.nf", 6u},
+  {"rec.ro", 6u},
+  {"rec.ve", 6u},
+  {"recht.pro", 9u},
+  {"recife.br", 9u},
+  {"recipes", 7u},
+  {"recreation.aero", 15u},
+  {"red", 3u},
+  {"red.sv", 6u},
+  {"redirectme.net", 14u},
+  {"redstone", 8u},
+  {"redumbrella", 11u},
+  {"reg.dk", 6u},
+  {"reggio-calabria.it", 18u},
+  {"reggio-emilia.it", 16u},
+  {"reggiocalabria.it", 17u},
+  {"reggioemilia.it", 15u},
+  {"rehab", 5u},
+  {"reise", 5u},
+  {"reisen", 6u},
+  {"reit", 4u},
+  {"reklam.hu", 9u},
+  {"rel.ht", 6u},
+  {"rel.pl", 6u},
+  {"reliance", 8u},
+  {"remotewd.com", 12u},
+  {"ren", 3u},
+  {"rendalen.no", 11u},
+  {"rennebu.no", 10u},
+  {"rennesoy.no", 11u},
+  {"rennes\303\270y.no", 12u},
+  {"rent", 4u},
+  {"rentals", 7u},
+  {"rep.br", 6u},
+  {"rep.kp", 6u},
+  {"repair", 6u},
+  {"repair.men", 10u},
+  {"repbody.aero", 12u},
+  {"repl.co", 7u},
+  {"repl.run", 8u},
+  {"report", 6u},
+  {"republican", 10u},
+  {"res.aero", 8u},
+  {"res.in", 6u},
+  {"research.aero", 13u},
+  {"research.museum", 15u},
+  {"reservd.com", 11u},
+  {"reservd.dev.thingdust.io", 24u},
+  {"reservd.disrec.thingdust.io", 27u},
+  {"reservd.testing.thingdust.io", 28u},
+  {"reserve-online.com", 18u},
+  {"reserve-online.net", 18u},
+  {"resindevice.io", 14u},
+  {"resistance.museum", 17u},
+  {"rest", 4u},
+  {"restaurant", 10u},
+  {"review", 6u},
+  {"reviews", 7u},
+  {"revista.bo", 10u},
+  {"rexroth", 7u},
+  {"rg.it", 5u},
+  {"rhcloud.com", 11u},
+  {"ri.it", 5u},
+  {"ri.us", 5u},
+  {"ribeirao.br", 11u},
+  {"ric.jelastic.vps-host.net", 25u},
+  {"rich", 4u},
+  {"richardli", 9u},
+  {"ricoh", 5u},
+  {"rieti.it", 8u},
+  {"rifu.miyagi.jp", 14u},
+  {"riik.ee", 7u},
+  {"rikubetsu.hokkaido.jp", 21u},
+  {"rikuzentakata.iwate.jp", 22u},
+  {"ril", 3u},
+  {"rimini.it", 9u},
+  {"rindal.no", 9u},
+  {"ringebu.no", 10u},
+  {"ringerike.no", 12u},
+  {"ringsaker.no", 12u},
+  {"rio", 3u},
+  {"rio.br", 6u},
+  {"riobranco.br", 12u},
+  {"riodejaneiro.museum", 19u},
+  {"riopreto.br", 11u},
+  {"rip", 3u},
+  {"rishiri.hokkaido.jp", 19u},
+  {"rishirifuji.hokkaido.jp", 23u},
+  {"risor.no", 8u},
+  {"rissa.no", 8u},
+  {"ris\303\270r.no", 9u},
+  {"ritto.shiga.jp", 14u},
+  {"rivne.ua", 8u},
+  {"rj.gov.br", 9u},
+  {"rj.leg.br", 9u},
+  {"rl.no", 5u},
+  {"rm.it", 5u},
+  {"rn.gov.br", 9u},
+  {"rn.it", 5u},
+  {"rn.leg.br", 9u},
+  {"ro", 2u},
+  {"ro.eu.org", 9u},
+  {"ro.gov.br", 9u},
+  {"ro.im", 5u},
+  {"ro.it", 5u},
+  {"ro.leg.br", 9u},
+  {"roan.no", 7u},
+  {"rocher", 6u},
+  {"rochester.museum", 16u},
+  {"rockart.museum", 14u},
+  {"rocks", 5u},
+  {"rocky.page", 10u},
+  {"rodeo", 5u},
+  {"rodoy.no", 8u},
+  {"rogers", 6u},
+  {"rokunohe.aomori.jp", 18u},
+  {"rollag.no", 9u},
+  {"roma.it", 7u},
+  {"roma.museum", 11u},
+  {"rome.it", 7u},
+  {"romsa.no", 8u},
+  {"romskog.no", 10u},
+  {"room", 4u},
+  {"roros.no", 8u},
+  {"rost.no", 7u},
+  {"rotorcraft.aero", 15u},
+  {"router.management", 17u},
+  {"rovigo.it", 9u},
+  {"rovno.ua", 8u},
+  {"royal-commission.uk", 19u},
+  {"royken.no", 9u},
+  {"royrvik.no", 10u},
+  {"rr.gov.br", 9u},
+  {"rr.leg.br", 9u},
+  {"rs", 2u},
+  {"rs.ba", 5u},
+  {"rs.gov.br", 9u},
+  {"rs.leg.br", 9u},
+  {"rsc.cdn77.org", 13u},
+  {"rsvp", 4u},
+  {"ru", 2u},
+  {"ru.com", 6u},
+  {"ru.eu.org", 9u},
+  {"ru.net", 6u},
+  {"rugby", 5u},
+  {"ruhr", 4u},
+  {"run", 3u},
+  {"run.app", 7u},
+  {"ruovat.no", 9u},
+  {"russia.museum", 13u},
+  {"rv.ua", 5u},
+  {"rw", 2u},
+  {"rwe", 3u},
+  {"rybnik.pl", 9u},
+  {"ryd.wafaicloud.com", 18u},
+  {"rygge.no", 8u},
+  {"ryokami.saitama.jp", 18u},
+  {"ryugasaki.ibaraki.jp", 20u},
+  {"ryukyu", 6u},
+  {"ryuoh.shiga.jp", 14u},
+  {"rzeszow.pl", 10u},
+  {"rzgw.gov.pl", 11u},
+  {"r\303\241hkker\303\241vju.no", 16u},
+  {"r\303\241isa.no", 9u},
+  {"r\303\245de.no", 8u},
+  {"r\303\245holt.no", 10u},
+  {"r\303\246lingen.no", 12u},
+  {"r\303\270d\303\270y.no", 10u},
+  {"r\303\270mskog.no", 11u},
+  {"r\303\270ros.no", 9u},
+  {"r\303\270st.no", 8u},
+  {"r\303\270yken.no", 10u},
+  {"r\303\270yrvik.no", 11u},
+  {"s.bg", 4u},
+  {"s.se", 4u},
+  {"s3-ap-northeast-1.amazonaws.com", 31u},
+  {"s3-ap-northeast-2.amazonaws.com", 31u},
+  {"s3-ap-south-1.amazonaws.com", 27u},
+  {"s3-ap-southeast-1.amazonaws.com", 31u},
+  {"s3-ap-southeast-2.amazonaws.com", 31u},
+  {"s3-ca-central-1.amazonaws.com", 29u},
+  {"s3-eu-central-1.amazonaws.com", 29u},
+  {"s3-eu-west-1.amazonaws.com", 26u},
+  {"s3-eu-west-2.amazonaws.com", 26u},
+  {"s3-eu-west-3.amazonaws.com", 26u},
+  {"s3-external-1.amazonaws.com", 27u},
+  {"s3-fips-us-gov-west-1.amazonaws.com", 35u},
+  {"s3-sa-east-1.amazonaws.com", 26u},
+  {"s3-us-east-2.amazonaws.com", 26u},
+  {"s3-us-gov-west-1.amazonaws.com", 30u},
+  {"s3-us-west-1.amazonaws.com", 26u},
+  {"s3-us-west-2.amazonaws.com", 26u},
+  {"s3-website-ap-northeast-1.amazonaws.com", 39u},
+  {"s3-website-ap-southeast-1.amazonaws.com", 39u},
+  {"s3-website-ap-southeast-2.amazonaws.com", 39u},
+  {"s3-website-eu-west-1.amazonaws.com", 34u},
+  {"s3-website-sa-east-1.amazonaws.com", 34u},
+  {"s3-website-us-east-1.amazonaws.com", 34u},
+  {"s3-website-us-west-1.amazonaws.com", 34u},
+  {"s3-website-us-west-2.amazonaws.com", 34u},
+  {"s3-website.ap-northeast-2.amazonaws.com", 39u},
+  {"s3-website.ap-south-1.amazonaws.com", 35u},
+  {"s3-website.ca-central-1.amazonaws.com", 37u},
+  {"s3-website.eu-central-1.amazonaws.com", 37u},
+  {"s3-website.eu-west-2.amazonaws.com", 34u},
+  {"s3-website.eu-west-3.amazonaws.com", 34u},
+  {"s3-website.fr-par.scw.cloud", 27u},
+  {"s3-website.nl-ams.scw.cloud", 27u},
+  {"s3-website.pl-waw.scw.cloud", 27u},
+  {"s3-website.us-east-2.amazonaws.com", 34u},
+  {"s3.amazonaws.com", 16u},
+  {"s3.ap-northeast-2.amazonaws.com", 31u},
+  {"s3.ap-south-1.amazonaws.com", 27u},
+  {"s3.ca-central-1.amazonaws.com", 29u},
+  {"s3.cn-north-1.amazonaws.com.cn", 30u},
+  {"s3.dualstack.ap-northeast-1.amazonaws.com", 41u},
+  {"s3.dualstack.ap-northeast-2.amazonaws.com", 41u},
+  {"s3.dualstack.ap-south-1.amazonaws.com", 37u},
+  {"s3.dualstack.ap-southeast-1.amazonaws.com", 41u},
+  {"s3.dualstack.ap-southeast-2.amazonaws.com", 41u},
+  {"s3.dualstack.ca-central-1.amazonaws.com", 39u},
+  {"s3.dualstack.eu-central-1.amazonaws.com", 39u},
+  {"s3.dualstack.eu-west-1.amazonaws.com", 36u},
+  {"s3.dualstack.eu-west-2.amazonaws.com", 36u},
+  {"s3.dualstack.eu-west-3.amazonaws.com", 36u},
+  {"s3.dualstack.sa-east-1.amazonaws.com", 36u},
+  {"s3.dualstack.us-east-1.amazonaws.com", 36u},
+  {"s3.dualstack.us-east-2.amazonaws.com", 36u},
+  {"s3.eu-central-1.amazonaws.com", 29u},
+  {"s3.eu-west-2.amazonaws.com", 26u},
+  {"s3.eu-west-3.amazonaws.com", 26u},
+  {"s3.fr-par.scw.cloud", 19u},
+  {"s3.nl-ams.scw.cloud", 19u},
+  {"s3.pl-waw.scw.cloud", 19u},
+  {"s3.teckids.org", 14u},
+  {"s3.us-east-2.amazonaws.com", 26u},
+  {"sa", 2u},
+  {"sa-east-1.elasticbeanstalk.com", 30u},
+  {"sa.au", 5u},
+  {"sa.com", 6u},
+  {"sa.cr", 5u},
+  {"sa.edu.au", 9u},
+  {"sa.gov.au", 9u},
+  {"sa.gov.pl", 9u},
+  {"sa.it", 5u},
+  {"saarland", 8u},
+  {"sabae.fukui.jp", 14u},
+  {"sadist.jp", 9u},
+  {"sado.niigata.jp", 15u},
+  {"safe", 4u},
+  {"safety", 6u},
+  {"safety.aero", 11u},
+  {"saga.jp", 7u},
+  {"saga.saga.jp", 12u},
+  {"sagae.yamagata.jp", 17u},
+  {"sagamihara.kanagawa.jp", 22u},
+  {"saigawa.fukuoka.jp", 18u},
+  {"saijo.ehime.jp", 14u},
+  {"saikai.nagasaki.jp", 18u},
+  {"saiki.oita.jp", 13u},
+  {"saintlouis.museum", 17u},
+  {"saitama.jp", 10u},
+  {"saitama.saitama.jp", 18u},
+  {"saito.miyazaki.jp", 17u},
+  {"saka.hiroshima.jp", 17u},
+  {"sakado.saitama.jp", 17u},
+  {"sakae.chiba.jp", 14u},
+  {"sakae.nagano.jp", 15u},
+  {"sakahogi.gifu.jp", 16u},
+  {"sakai.fukui.jp", 14u},
+  {"sakai.ibaraki.jp", 16u},
+  {"sakai.osaka.jp", 14u},
+  {"sakaiminato.tottori.jp", 22u},
+  {"sakaki.nagano.jp", 16u},
+  {"sakata.yamagata.jp", 18u},
+  {"sakawa.kochi.jp", 15u},
+  {"sakegawa.yamagata.jp", 20u},
+  {"saku.nagano.jp", 14u},
+  {"sakuho.nagano.jp", 16u},
+  {"sakura", 6u},
+  {"sakura.chiba.jp", 15u},
+  {"sakura.tochigi.jp", 17u},
+  {"sakuragawa.ibaraki.jp", 21u},
+  {"sakurai.nara.jp", 15u},
+  {"sakyo.kyoto.jp", 14u},
+  {"salangen.no", 11u},
+  {"salat.no", 8u},
+  {"sale", 4u},
+  {"salem.museum", 12u},
+  {"salerno.it", 10u},
+  {"salon", 5u},
+  {"saltdal.no", 10u},
+  {"salud.bo", 8u},
+  {"salvador.br", 11u},
+  {"salvadordali.museum", 19u},
+  {"salzburg.museum", 15u},
+  {"samegawa.fukushima.jp", 21u},
+  {"samnanger.no", 12u},
+  {"sampa.br", 8u},
+  {"samsclub", 8u},
+  {"samsung", 7u},
+  {"samukawa.kanagawa.jp", 20u},
+  {"sanagochi.tokushima.jp", 22u},
+  {"sanda.hyogo.jp", 14u},
+  {"sandcats.io", 11u},
+  {"sande.more-og-romsdal.no", 24u},
+  {"sande.m\303\270re-og-romsdal.no", 25u},
+  {"sande.vestfold.no", 17u},
+  {"sandefjord.no", 13u},
+  {"sandiego.museum", 15u},
+  {"sandnes.no", 10u},
+  {"sandnessjoen.no", 15u},
+  {"sandnessj\303\270en.no", 16u},
+  {"sandoy.no", 9u},
+  {"sandvik", 7u},
+  {"sandvikcoromant", 15u},
+  {"sand\303\270y.no", 10u},
+  {"sanfrancisco.museum", 19u},
+  {"sango.nara.jp", 13u},
+  {"sanjo.niigata.jp", 16u},
+  {"sannan.hyogo.jp", 15u},
+  {"sannohe.aomori.jp", 17u},
+  {"sano.tochigi.jp", 15u},
+  {"sanofi", 6u},
+  {"sanok.pl", 8u},
+  {"santabarbara.museum", 19u},
+  {"santacruz.museum", 16u},
+  {"santafe.museum", 14u},
+  {"santamaria.br", 13u},
+  {"santoandre.br", 13u},
+  {"sanuki.kagawa.jp", 16u},
+  {"saobernardo.br", 14u},
+  {"saogonca.br", 11u},
+  {"saotome.st", 10u},
+  {"sap", 3u},
+  {"sar.it", 6u},
+  {"sardegna.it", 11u},
+  {"sardinia.it", 11u},
+  {"sarl", 4u},
+  {"saroma.hokkaido.jp", 18u},
+  {"sarpsborg.no", 12u},
+  {"sarufutsu.hokkaido.jp", 21u},
+  {"sas", 3u},
+  {"sasaguri.fukuoka.jp", 19u},
+  {"sasayama.hyogo.jp", 17u},
+  {"sasebo.nagasaki.jp", 18u},
+  {"saskatchewan.museum", 19u},
+  {"sassari.it", 10u},
+  {"satosho.okayama.jp", 18u},
+  {"satsumasendai.kagoshima.jp", 26u},
+  {"satte.saitama.jp", 16u},
+  {"satx.museum", 11u},
+  {"sauda.no", 8u},
+  {"sauherad.no", 11u},
+  {"savannahga.museum", 17u},
+  {"save", 4u},
+  {"saves-the-whales.com", 20u},
+  {"savona.it", 9u},
+  {"saxo", 4u},
+  {"sayama.osaka.jp", 15u},
+  {"sayama.saitama.jp", 17u},
+  {"sayo.hyogo.jp", 13u},
+  {"sb", 2u},
+  {"sb.ua", 5u},
+  {"sbi", 3u},
+  {"sbs", 3u},
+  {"sc", 2u},
+  {"sc.cn", 5u},
+  {"sc.gov.br", 9u},
+  {"sc.ke", 5u},
+  {"sc.kr", 5u},
+  {"sc.leg.br", 9u},
+  {"sc.ls", 5u},
+  {"sc.tz", 5u},
+  {"sc.ug", 5u},
+  {"sc.us", 5u},
+  {"sca", 3u},
+  {"scalebook.scw.cloud", 19u},
+  {"scb", 3u},
+  {"sch.ae", 6u},
+  {"sch.id", 6u},
+  {"sch.ir", 6u},
+  {"sch.jo", 6u},
+  {"sch.lk", 6u},
+  {"sch.ly", 6u},
+  {"sch.ng", 6u},
+  {"sch.qa", 6u},
+  {"sch.sa", 6u},
+  {"sch.so", 6u},
+  {"sch.ss", 6u},
+  {"sch.tf", 6u},
+  {"sch.wf", 6u},
+  {"sch.zm", 6u},
+  {"schaeffler", 10u},
+  {"schlesisches.museum", 19u},
+  {"schmidt", 7u},
+  {"schoenbrunn.museum", 18u},
+  {"schokokeks.net", 14u},
+  {"schokoladen.museum", 18u},
+  {"scholarships", 12u},
+  {"school", 6u},
+  {"school.museum", 13u},
+  {"school.na", 9u},
+  {"school.nz", 9u},
+  {"school.za", 9u},
+  {"schoolbus.jp", 12u},
+  {"schools.nsw.edu.au", 18u},
+  {"schule", 6u},
+  {"schulplattform.de", 17u},
+  {"schulserver.de", 14u},
+  {"schwarz", 7u},
+  {"schweiz.museum", 14u},
+  {"sci.eg", 6u},
+  {"science", 7u},
+  {"science-fiction.museum", 22u},
+  {"science.museum", 14u},
+  {"scienceandhistory.museum", 24u},
+  {"scienceandindustry.museum", 25u},
+  {"sciencecenter.museum", 20u},
+  {"sciencecenters.museum", 21u},
+  {"sciencehistory.museum", 21u},
+  {"sciences.museum", 15u},
+  {"sciencesnaturelles.museum", 25u},
+  {"scientist.aero", 14u},
+  {"scot", 4u},
+  {"scotland.museum", 15u},
+  {"scrapper-site.net", 17u},
+  {"scrapping.cc", 12u},
+  {"scrysec.com", 11u},
+  {"sd", 2u},
+  {"sd.cn", 5u},
+  {"sd.us", 5u},
+  {"sdn.gov.pl", 10u},
+  {"sdscloud.pl", 11u},
+  {"se", 2u},
+  {"se.eu.org", 9u},
+  {"se.gov.br", 9u},
+  {"se.leg.br", 9u},
+  {"se.net", 6u},
+  {"seaport.museum", 14u},
+  {"search", 6u},
+  {"seat", 4u},
+  {"sebastopol.ua", 13u},
+  {"sec.ps", 6u},
+  {"secaas.hk", 9u},
+  {"secret.jp", 9u},
+  {"secure", 6u},
+  {"security", 8u},
+  {"securitytactics.com", 19u},
+  {"seek", 4u},
+  {"seg.br", 6u},
+  {"seidat.net", 10u},
+  {"seihi.nagasaki.jp", 17u},
+  {"seika.kyoto.jp", 14u},
+  {"seiro.niigata.jp", 16u},
+  {"seirou.niigata.jp", 17u},
+  {"seiyo.ehime.jp", 14u},
+  {"sejny.pl", 8u},
+  {"sekd1.beebyteapp.io", 19u},
+  {"seki.gifu.jp", 12u},
+  {"sekigahara.gifu.jp", 18u},
+  {"sekikawa.niigata.jp", 19u},
+  {"sel.no", 6u},
+  {"selbu.no", 8u},
+  {"select", 6u},
+  {"selfip.biz", 10u},
+  {"selfip.com", 10u},
+  {"selfip.info", 11u},
+  {"selfip.net", 10u},
+  {"selfip.org", 10u},
+  {"selje.no", 8u},
+  {"seljord.no", 10u},
+  {"sellfy.store", 12u},
+  {"sells-for-less.com", 18u},
+  {"sells-for-u.com", 15u},
+  {"sells-it.net", 12u},
+  {"sellsyourhome.org", 17u},
+  {"semboku.akita.jp", 16u},
+  {"semine.miyagi.jp", 16u},
+  {"senasa.ar", 9u},
+  {"sener", 5u},
+  {"sennan.osaka.jp", 15u},
+  {"senseering.net", 14u},
+  {"seoul.kr", 8u},
+  {"sera.hiroshima.jp", 17u},
+  {"seranishi.hiroshima.jp", 22u},
+  {"servebbs.com", 12u},
+  {"servebbs.net", 12u},
+  {"servebbs.org", 12u},
+  {"servebeer.com", 13u},
+  {"serveblog.net", 13u},
+  {"servecounterstrike.com", 22u},
+  {"serveexchange.com", 17u},
+  {"serveftp.com", 12u},
+  {"serveftp.net", 12u},
+  {"serveftp.org", 12u},
+  {"servegame.com", 13u},
+  {"servegame.org", 13u},
+  {"servehalflife.com", 17u},
+  {"servehttp.com", 13u},
+  {"servehumour.com", 15u},
+  {"serveirc.com", 12u},
+  {"serveminecraft.net", 18u},
+  {"servemp3.com", 12u},
+  {"servep2p.com", 12u},
+  {"servepics.com", 13u},
+  {"servequake.com", 14u},
+  {"servers.run", 11u},
+  {"servesarcasm.com", 16u},
+  {"service.gov.scot", 16u},
+  {"service.gov.uk", 14u},
+  {"service.one", 11u},
+  {"services", 8u},
+  {"services.aero", 13u},
+  {"ses", 3u},
+  {"setagaya.tokyo.jp", 17u},
+  {"seto.aichi.jp", 13u},
+  {"setouchi.okayama.jp", 19u},
+  {"settlement.museum", 17u},
+  {"settlers.museum", 15u},
+  {"settsu.osaka.jp", 15u},
+  {"sevastopol.ua", 13u},
+  {"seven", 5u},
+  {"sew", 3u},
+  {"sex", 3u},
+  {"sex.hu", 6u},
+  {"sex.pl", 6u},
+  {"sexy", 4u},
+  {"sf.no", 5u},
+  {"sfr", 3u},
+  {"sg", 2u},
+  {"sg-1.paas.massivegrid.net", 25u},
+  {"sh", 2u},
+  {"sh.cn", 5u},
+  {"shacknet.nu", 11u},
+  {"shakotan.hokkaido.jp", 20u},
+  {"shangrila", 9u},
+  {"shari.hokkaido.jp", 17u},
+  {"sharp", 5u},
+  {"shaw", 4u},
+  {"shell", 5u},
+  {"shell.museum", 12u},
+  {"sherbrooke.museum", 17u},
+  {"shia", 4u},
+  {"shibata.miyagi.jp", 17u},
+  {"shibata.niigata.jp", 18u},
+  {"shibecha.hokkaido.jp", 20u},
+  {"shibetsu.hokkaido.jp", 20u},
+  {"shibukawa.gunma.jp", 18u},
+  {"shibuya.tokyo.jp", 16u},
+  {"shichikashuku.miyagi.jp", 23u},
+  {"shichinohe.aomori.jp", 20u},
+  {"shiftcrypto.dev", 15u},
+  {"shiftcrypto.io", 14u},
+  {"shiftedit.io", 12u},
+  {"shiga.jp", 8u},
+  {"shiiba.miyazaki.jp", 18u},
+  {"shijonawate.osaka.jp", 20u},
+  {"shika.ishikawa.jp", 17u},
+  {"shikabe.hokkaido.jp", 19u},
+  {"shikama.miyagi.jp", 17u},
+  {"shikaoi.hokkaido.jp", 19u},
+  {"shikatsu.aichi.jp", 17u},
+  {"shiki.saitama.jp", 16u},
+  {"shikokuchuo.ehime.jp", 20u},
+  {"shiksha", 7u},
+  {"shima.mie.jp", 12u},
+  {"shimabara.nagasaki.jp", 21u},
+  {"shimada.shizuoka.jp", 19u},
+  {"shimamaki.hokkaido.jp", 21u},
+  {"shimamoto.osaka.jp", 18u},
+  {"shimane.jp", 10u},
+  {"shimane.shimane.jp", 18u},
+  {"shimizu.hokkaido.jp", 19u},
+  {"shimizu.shizuoka.jp", 19u},
+  {"shimoda.shizuoka.jp", 19u},
+  {"shimodate.ibaraki.jp", 20u},
+  {"shimofusa.chiba.jp", 18u},
+  {"shimogo.fukushima.jp", 20u},
+  {"shimoichi.nara.jp", 17u},
+  {"shimoji.okinawa.jp", 18u},
+  {"shimokawa.hokkaido.jp", 21u},
+  {"shimokitayama.nara.jp", 21u},
+  {"shimonita.gunma.jp", 18u},
+  {"shimonoseki.yamaguchi.jp", 24u},
+  {"shimosuwa.nagano.jp", 19u},
+  {"shimotsuke.tochigi.jp", 21u},
+  {"shimotsuma.ibaraki.jp", 21u},
+  {"shinagawa.tokyo.jp", 18u},
+  {"shinanomachi.nagano.jp", 22u},
+  {"shingo.aomori.jp", 16u},
+  {"shingu.fukuoka.jp", 17u},
+  {"shingu.hyogo.jp", 15u},
+  {"shingu.wakayama.jp", 18u},
+  {"shinichi.hiroshima.jp", 21u},
+  {"shinjo.nara.jp", 14u},
+  {"shinjo.okayama.jp", 17u},
+  {"shinjo.yamagata.jp", 18u},
+  {"shinjuku.tokyo.jp", 17u},
+  {"shinkamigoto.nagasaki.jp", 24u},
+  {"shinonsen.hyogo.jp", 18u},
+  {"shinshinotsu.hokkaido.jp", 24u},
+  {"shinshiro.aichi.jp", 18u},
+  {"shinto.gunma.jp", 15u},
+  {"shintoku.hokkaido.jp", 20u},
+  {"shintomi.miyazaki.jp", 20u},
+  {"shinyoshitomi.fukuoka.jp", 24u},
+  {"shiogama.miyagi.jp", 18u},
+  {"shiojiri.nagano.jp", 18u},
+  {"shioya.tochigi.jp", 17u},
+  {"shirahama.wakayama.jp", 21u},
+  {"shirakawa.fukushima.jp", 22u},
+  {"shirakawa.gifu.jp", 17u},
+  {"shirako.chiba.jp", 16u},
+  {"shiranuka.hokkaido.jp", 21u},
+  {"shiraoi.hokkaido.jp", 19u},
+  {"shiraoka.saitama.jp", 19u},
+  {"shirataka.yamagata.jp", 21u},
+  {"shiriuchi.hokkaido.jp", 21u},
+  {"shiroi.chiba.jp", 15u},
+  {"shiroishi.miyagi.jp", 19u},
+  {"shiroishi.saga.jp", 17u},
+  {"shirosato.ibaraki.jp", 20u},
+  {"shishikui.tokushima.jp", 22u},
+  {"shiso.hyogo.jp", 14u},
+  {"shisui.chiba.jp", 15u},
+  {"shitara.aichi.jp", 16u},
+  {"shiwa.iwate.jp", 14u},
+  {"shizukuishi.iwate.jp", 20u},
+  {"shizuoka.jp", 11u},
+  {"shizuoka.shizuoka.jp", 20u},
+  {"shobara.hiroshima.jp", 20u},
+  {"shoes", 5u},
+  {"shonai.fukuoka.jp", 17u},
+  {"shonai.yamagata.jp", 18u},
+  {"shoo.okayama.jp", 15u},
+  {"shop", 4u},
+  {"shop.brendly.rs", 15u},
+  {"shop.ht", 7u},
+  {"shop.hu", 7u},
+  {"shop.pl", 7u},
+  {"shop.ro", 7u},
+  {"shop.th", 7u},
+  {"shoparena.pl", 12u},
+  {"shopitsite.com", 14u},
+  {"shopping", 8u},
+  {"shopselect.net", 14u},
+  {"shopware.store", 14u},
+  {"shouji", 6u},
+  {"show", 4u},
+  {"show.aero", 9u},
+  {"showa.fukushima.jp", 18u},
+  {"showa.gunma.jp", 14u},
+  {"showa.yamanashi.jp", 18u},
+  {"showtime", 8u},
+  {"shunan.yamaguchi.jp", 19u},
+  {"shw.io", 6u},
+  {"si", 2u},
+  {"si.eu.org", 9u},
+  {"si.it", 5u},
+  {"sibenik.museum", 14u},
+  {"sic.it", 6u},
+  {"sicilia.it", 10u},
+  {"sicily.it", 9u},
+  {"siellak.no", 10u},
+  {"siena.it", 8u},
+  {"sigdal.no", 9u},
+  {"siiites.com", 11u},
+  {"siljan.no", 9u},
+  {"silk", 4u},
+  {"silk.museum", 11u},
+  {"simple-url.com", 14u},
+  {"sina", 4u},
+  {"sinaapp.com", 11u},
+  {"singles", 7u},
+  {"siracusa.it", 11u},
+  {"sirdal.no", 9u},
+  {"site", 4u},
+  {"site.tb-hosting.com", 19u},
+  {"site.transip.me", 15u},
+  {"siteleaf.net", 12u},
+  {"sites.static.land", 17u},
+  {"sj", 2u},
+  {"sjc.br", 6u},
+  {"sk", 2u},
+  {"sk.ca", 5u},
+  {"sk.eu.org", 9u},
+  {"skanit.no", 9u},
+  {"skanland.no", 11u},
+  {"skaun.no", 8u},
+  {"skedsmo.no", 10u},
+  {"skedsmokorset.no", 16u},
+  {"ski", 3u},
+  {"ski.museum", 10u},
+  {"ski.no", 6u},
+  {"skien.no", 8u},
+  {"skierva.no", 10u},
+  {"skierv\303\241.no", 11u},
+  {"skin", 4u},
+  {"skiptvet.no", 11u},
+  {"skjak.no", 8u},
+  {"skjervoy.no", 11u},
+  {"skjerv\303\270y.no", 12u},
+  {"skj\303\245k.no", 9u},
+  {"sklep.pl", 8u},
+  {"sko.gov.pl", 10u},
+  {"skoczow.pl", 10u},
+  {"skodje.no", 9u},
+  {"skole.museum", 12u},
+  {"sky", 3u},
+  {"skydiving.aero", 14u},
+  {"skygearapp.com", 14u},
+  {"skype", 5u},
+  {"sk\303\241nit.no", 10u},
+  {"sk\303\245nland.no", 12u},
+  {"sl", 2u},
+  {"slask.pl", 8u},
+  {"slattum.no", 10u},
+  {"sld.do", 6u},
+  {"sld.pa", 6u},
+  {"slg.br", 6u},
+  {"sling", 5u},
+  {"slupsk.pl", 9u},
+  {"slz.br", 6u},
+  {"sm", 2u},
+  {"sm.ua", 5u},
+  {"small-web.org", 13u},
+  {"smart", 5u},
+  {"smartlabeling.scw.cloud", 23u},
+  {"smile", 5u},
+  {"smola.no", 8u},
+  {"smushcdn.com", 12u},
+  {"sm\303\270la.no", 9u},
+  {"sn", 2u},
+  {"sn.cn", 5u},
+  {"snaase.no", 9u},
+  {"snasa.no", 8u},
+  {"sncf", 4u},
+  {"snillfjord.no", 13u},
+  {"snoasa.no", 9u},
+  {"sn\303\245ase.no", 10u},
+  {"sn\303\245sa.no", 9u},
+  {"so", 2u},
+  {"so.gov.pl", 9u},
+  {"so.it", 5u},
+  {"sobetsu.hokkaido.jp", 19u},
+  {"soc.dz", 6u},
+  {"soc.lk", 6u},
+  {"soc.srcf.net", 12u},
+  {"soccer", 6u},
+  {"sochi.su", 8u},
+  {"social", 6u},
+  {"society.museum", 14u},
+  {"sodegaura.chiba.jp", 18u},
+  {"soeda.fukuoka.jp", 16u},
+  {"softbank", 8u},
+  {"software", 8u},
+  {"software.aero", 13u},
+  {"sogndal.no", 10u},
+  {"sogne.no", 8u},
+  {"sohu", 4u},
+  {"soja.okayama.jp", 15u},
+  {"soka.saitama.jp", 15u},
+  {"sokndal.no", 10u},
+  {"sola.no", 7u},
+  {"solar", 5u},
+  {"sologne.museum", 14u},
+  {"solund.no", 9u},
+  {"solutions", 9u},
+  {"soma.fukushima.jp", 17u},
+  {"somna.no", 8u},
+  {"sondre-land.no", 14u},
+  {"sondrio.it", 10u},
+  {"song", 4u},
+  {"songdalen.no", 12u},
+  {"soni.nara.jp", 12u},
+  {"sony", 4u},
+  {"soo.kagoshima.jp", 16u},
+  {"sopot.pl", 8u},
+  {"sor-aurdal.no", 13u},
+  {"sor-fron.no", 11u},
+  {"sor-odal.no", 11u},
+  {"sor-varanger.no", 15u},
+  {"sorfold.no", 10u},
+  {"sorocaba.br", 11u},
+  {"sorreisa.no", 11u},
+  {"sortland.no", 11u},
+  {"sorum.no", 8u},
+  {"sos.pl", 6u},
+  {"sosa.chiba.jp", 13u},
+  {"sosnowiec.pl", 12u},
+  {"soundandvision.museum", 21u},
+  {"soundcast.me", 12u},
+  {"southcarolina.museum", 20u},
+  {"southwest.museum", 16u},
+  {"sowa.ibaraki.jp", 15u},
+  {"soy", 3u},
+  {"sp.gov.br", 9u},
+  {"sp.it", 5u},
+  {"sp.leg.br", 9u},
+  {"spa", 3u},
+  {"space", 5u},
+  {"space-to-rent.com", 17u},
+  {"space.museum", 12u},
+  {"spacekit.io", 11u},
+  {"spb.ru", 6u},
+  {"spb.su", 6u},
+  {"spdns.de", 8u},
+  {"spdns.eu", 8u},
+  {"spdns.org", 9u},
+  {"sphinx.mythic-beasts.com", 24u},
+  {"spjelkavik.no", 13u},
+  {"sport", 5u},
+  {"sport.hu", 8u},
+  {"spot", 4u},
+  {"spy.museum", 10u},
+  {"spydeberg.no", 12u},
+  {"square.museum", 13u},
+  {"square7.ch", 10u},
+  {"square7.de", 10u},
+  {"square7.net", 11u},
+  {"sr", 2u},
+  {"sr.gov.pl", 9u},
+  {"sr.it", 5u},
+  {"srht.site", 9u},
+  {"srl", 3u},
+  {"srv.br", 6u},
+  {"ss", 2u},
+  {"ss.it", 5u},
+  {"ssl.origin.cdn77-secure.org", 27u},
+  {"st", 2u},
+  {"st.no", 5u},
+  {"staba.jp", 8u},
+  {"stackhero-network.com", 21u},
+  {"stada", 5u},
+  {"stadt.museum", 12u},
+  {"stage.nodeart.io", 16u},
+  {"staging.onred.one", 17u},
+  {"stalbans.museum", 15u},
+  {"stalowa-wola.pl", 15u},
+  {"stange.no", 9u},
+  {"staples", 7u},
+  {"star", 4u},
+  {"starachowice.pl", 15u},
+  {"stargard.pl", 11u},
+  {"starnberg.museum", 16u},
+  {"starostwo.gov.pl", 16u},
+  {"stat.no", 7u},
+  {"state.museum", 12u},
+  {"statebank", 9u},
+  {"statefarm", 9u},
+  {"stateofdelaware.museum", 22u},
+  {"stathelle.no", 12u},
+  {"static-access.net", 17u},
+  {"static.land", 11u},
+  {"static.observableusercontent.com", 32u},
+  {"station.museum", 14u},
+  {"stavanger.no", 12u},
+  {"stavern.no", 10u},
+  {"stc", 3u},
+  {"stcgroup", 8u},
+  {"steam.museum", 12u},
+  {"steiermark.museum", 17u},
+  {"steigen.no", 10u},
+  {"steinkjer.no", 12u},
+  {"sth.ac.at", 9u},
+  {"stjohn.museum", 13u},
+  {"stjordal.no", 11u},
+  {"stjordalshalsen.no", 18u},
+  {"stj\303\270rdal.no", 12u},
+  {"stj\303\270rdalshalsen.no", 19u},
+  {"stockholm", 9u},
+  {"stockholm.museum", 16u},
+  {"stokke.no", 9u},
+  {"stor-elvdal.no", 14u},
+  {"storage", 7u},
+  {"storage.yandexcloud.net", 23u},
+  {"stord.no", 8u},
+  {"stordal.no", 10u},
+  {"store", 5u},
+  {"store.bb", 8u},
+  {"store.dk", 8u},
+  {"store.nf", 8u},
+  {"store.ro", 8u},
+  {"store.st", 8u},
+  {"store.ve", 8u},
+  {"storebase.store", 15u},
+  {"storfjord.no", 12u},
+  {"storj.farm", 10u},
+  {"stpetersburg.museum", 19u},
+  {"strand.no", 9u},
+  {"stranda.no", 10u},
+  {"stream", 6u},
+  {"streamlitapp.com", 16u},
+  {"stripper.jp", 11u},
+  {"stryn.no", 8u},
+  {"student.aero", 12u},
+  {"studio", 6u},
+  {"study", 5u},
+  {"stuff-4-sale.org", 16u},
+  {"stuff-4-sale.us", 15u},
+  {"stufftoread.com", 15u},
+  {"stuttgart.museum", 16u},
+  {"style", 5u},
+  {"su", 2u},
+  {"su.paba.se", 10u},
+  {"sub.jp", 6u},
+  {"sucks", 5u},
+  {"sue.fukuoka.jp", 14u},
+  {"suedtirol.it", 12u},
+  {"suginami.tokyo.jp", 17u},
+  {"sugito.saitama.jp", 17u},
+  {"suifu.ibaraki.jp", 16u},
+  {"suisse.museum", 13u},
+  {"suita.osaka.jp", 14u},
+  {"sukagawa.fukushima.jp", 21u},
+  {"sukumo.kochi.jp", 15u},
+  {"sula.no", 7u},
+  {"suldal.no", 9u},
+  {"suli.hu", 7u},
+  {"sumida.tokyo.jp", 15u},
+  {"sumita.iwate.jp", 15u},
+  {"sumoto.hyogo.jp", 15u},
+  {"sumoto.kumamoto.jp", 18u},
+  {"sumy.ua", 7u},
+  {"sunagawa.hokkaido.jp", 20u},
+  {"sund.no", 7u},
+  {"sunndal.no", 10u},
+  {"sunnyday.jp", 11u},
+  {"supabase.co", 11u},
+  {"supabase.in", 11u},
+  {"supabase.net", 12u},
+  {"supersale.jp", 12u},
+  {"supplies", 8u},
+  {"supply", 6u},
+  {"support", 7u},
+  {"surf", 4u},
+  {"surgeonshall.museum", 19u},
+  {"surgery", 7u},
+  {"surnadal.no", 11u},
+  {"surrey.museum", 13u},
+  {"susaki.kochi.jp", 15u},
+  {"susono.shizuoka.jp", 18u},
+  {"suwa.nagano.jp", 14u},
+  {"suwalki.pl", 10u},
+  {"suzaka.nagano.jp", 16u},
+  {"suzu.ishikawa.jp", 16u},
+  {"suzuka.mie.jp", 13u},
+  {"suzuki", 6u},
+  {"sv", 2u},
+  {"sv.it", 5u},
+  {"svalbard.no", 11u},
+  {"sveio.no", 8u},
+  {"svelvik.no", 10u},
+  {"svizzera.museum", 15u},
+  {"svn-repos.de", 12u},
+  {"swatch", 6u},
+  {"sweden.museum", 13u},
+  {"sweetpepper.org", 15u},
+  {"swidnica.pl", 11u},
+  {"swidnik.pl", 10u},
+  {"swiebodzin.pl", 13u},
+  {"swinoujscie.pl", 14u},
+  {"swiss", 5u},
+  {"sx", 2u},
+  {"sx.cn", 5u},
+  {"sy", 2u},
+  {"sydney", 6u},
+  {"sydney.museum", 13u},
+  {"sykkylven.no", 12u},
+  {"syncloud.it", 11u},
+  {"syno-ds.de", 10u},
+  {"synology-diskstation.de", 23u},
+  {"synology-ds.de", 14u},
+  {"synology.me", 11u},
+  {"systems", 7u},
+  {"sytes.net", 9u},
+  {"sz", 2u},
+  {"szczecin.pl", 11u},
+  {"szczytno.pl", 11u},
+  {"szex.hu", 7u},
+  {"szkola.pl", 9u},
+  {"s\303\241lat.no", 9u},
+  {"s\303\241l\303\241t.no", 10u},
+  {"s\303\270gne.no", 9u},
+  {"s\303\270mna.no", 9u},
+  {"s\303\270ndre-land.no", 15u},
+  {"s\303\270r-aurdal.no", 14u},
+  {"s\303\270r-fron.no", 12u},
+  {"s\303\270r-odal.no", 12u},
+  {"s\303\270r-varanger.no", 16u},
+  {"s\303\270rfold.no", 11u},
+  {"s\303\270rreisa.no", 12u},
+  {"s\303\270rum.no", 9u},
+  {"s\303\274dtirol.it", 12u},
+  {"t.bg", 4u},
+  {"t.se", 4u},
+  {"t3l3p0rt.net", 12u},
+  {"ta.it", 5u},
+  {"taa.it", 6u},
+  {"tab", 3u},
+  {"tabayama.yamanashi.jp", 21u},
+  {"tabitorder.co.il", 16u},
+  {"tabuse.yamaguchi.jp", 19u},
+  {"tachiarai.fukuoka.jp", 20u},
+  {"tachikawa.tokyo.jp", 18u},
+  {"tadaoka.osaka.jp", 16u},
+  {"tado.mie.jp", 11u},
+  {"tadotsu.kagawa.jp", 17u},
+  {"tagajo.miyagi.jp", 16u},
+  {"tagami.niigata.jp", 17u},
+  {"tagawa.fukuoka.jp", 17u},
+  {"tahara.aichi.jp", 15u},
+  {"taifun-dns.de", 13u},
+  {"taiji.wakayama.jp", 17u},
+  {"taiki.hokkaido.jp", 17u},
+  {"taiki.mie.jp", 12u},
+  {"tainai.niigata.jp", 17u},
+  {"taipei", 6u},
+  {"taira.toyama.jp", 15u},
+  {"taishi.hyogo.jp", 15u},
+  {"taishi.osaka.jp", 15u},
+  {"taishin.fukushima.jp", 20u},
+  {"taito.tokyo.jp", 14u},
+  {"taiwa.miyagi.jp", 15u},
+  {"tajimi.gifu.jp", 14u},
+  {"tajiri.osaka.jp", 15u},
+  {"taka.hyogo.jp", 13u},
+  {"takagi.nagano.jp", 16u},
+  {"takahagi.ibaraki.jp", 19u},
+  {"takahama.aichi.jp", 17u},
+  {"takahama.fukui.jp", 17u},
+  {"takaharu.miyazaki.jp", 20u},
+  {"takahashi.okayama.jp", 20u},
+  {"takahata.yamagata.jp", 20u},
+  {"takaishi.osaka.jp", 17u},
+  {"takamatsu.kagawa.jp", 19u},
+  {"takamori.kumamoto.jp", 20u},
+  {"takamori.nagano.jp", 18u},
+  {"takanabe.miyazaki.jp", 20u},
+  {"takanezawa.tochigi.jp", 21u},
+  {"takaoka.toyama.jp", 17u},
+  {"takarazuka.hyogo.jp", 19u},
+  {"takasago.hyogo.jp", 17u},
+  {"takasaki.gunma.jp", 17u},
+  {"takashima.shiga.jp", 18u},
+  {"takasu.hokkaido.jp", 18u},
+  {"takata.fukuoka.jp", 17u},
+  {"takatori.nara.jp", 16u},
+  {"takatsuki.osaka.jp", 18u},
+  {"takatsuki.shiga.jp", 18u},
+  {"takayama.gifu.jp", 16u},
+  {"takayama.gunma.jp", 17u},
+  {"takayama.nagano.jp", 18u},
+  {"takazaki.miyazaki.jp", 20u},
+  {"takehara.hiroshima.jp", 21u},
+  {"taketa.oita.jp", 14u},
+  {"taketomi.okinawa.jp", 19u},
+  {"taki.mie.jp", 11u},
+  {"takikawa.hokkaido.jp", 20u},
+  {"takino.hyogo.jp", 15u},
+  {"takinoue.hokkaido.jp", 20u},
+  {"takko.aomori.jp", 15u},
+  {"tako.chiba.jp", 13u},
+  {"taku.saga.jp", 12u},
+  {"talk", 4u},
+  {"tama.tokyo.jp", 13u},
+  {"tamakawa.fukushima.jp", 21u},
+  {"tamaki.mie.jp", 13u},
+  {"tamamura.gunma.jp", 17u},
+  {"tamano.okayama.jp", 17u},
+  {"tamatsukuri.ibaraki.jp", 22u},
+  {"tamayu.shimane.jp", 17u},
+  {"tamba.hyogo.jp", 14u},
+  {"tana.no", 7u},
+  {"tanabe.kyoto.jp", 15u},
+  {"tanabe.wakayama.jp", 18u},
+  {"tanagura.fukushima.jp", 21u},
+  {"tananger.no", 11u},
+  {"tank.museum", 11u},
+  {"tanohata.iwate.jp", 17u},
+  {"taobao", 6u},
+  {"tara.saga.jp", 12u},
+  {"tarama.okinawa.jp", 17u},
+  {"taranto.it", 10u},
+  {"target", 6u},
+  {"targi.pl", 8u},
+  {"tarnobrzeg.pl", 13u},
+  {"tarui.gifu.jp", 13u},
+  {"tarumizu.kagoshima.jp", 21u},
+  {"tas.au", 6u},
+  {"tas.edu.au", 10u},
+  {"tas.gov.au", 10u},
+  {"tashkent.su", 11u},
+  {"tatamotors", 10u},
+  {"tatar", 5u},
+  {"tatebayashi.gunma.jp", 20u},
+  {"tateshina.nagano.jp", 19u},
+  {"tateyama.chiba.jp", 17u},
+  {"tateyama.toyama.jp", 18u},
+  {"tatsuno.hyogo.jp", 16u},
+  {"tatsuno.nagano.jp", 17u},
+  {"tattoo", 6u},
+  {"tawaramoto.nara.jp", 18u},
+  {"tax", 3u},
+  {"taxi", 4u},
+  {"taxi.br", 7u},
+  {"tbits.me", 8u},
+  {"tc", 2u},
+  {"tc.br", 5u},
+  {"tci", 3u},
+  {"tcm.museum", 10u},
+  {"tcp4.me", 7u},
+  {"td", 2u},
+  {"tdk", 3u},
+  {"te.it", 5u},
+  {"te.ua", 5u},
+  {"teaches-yoga.com", 16u},
+  {"team", 4u},
+  {"tec.br", 6u},
+  {"tec.mi.us", 9u},
+  {"tec.ve", 6u},
+  {"tech", 4u},
+  {"tech.orange", 11u},
+  {"technology", 10u},
+  {"technology.museum", 17u},
+  {"tecnologia.bo", 13u},
+  {"tel", 3u},
+  {"tel.tr", 6u},
+  {"tele.amune.org", 14u},
+  {"telebit.app", 11u},
+  {"telebit.io", 10u},
+  {"telekommunikation.museum", 24u},
+  {"television.museum", 17u},
+  {"temasek", 7u},
+  {"temp-dns.com", 12u},
+  {"tempio-olbia.it", 15u},
+  {"tempioolbia.it", 14u},
+  {"tempurl.host", 12u},
+  {"tendo.yamagata.jp", 17u},
+  {"tenei.fukushima.jp", 18u},
+  {"tenkawa.nara.jp", 15u},
+  {"tennis", 6u},
+  {"tenri.nara.jp", 13u},
+  {"teo.br", 6u},
+  {"teramo.it", 9u},
+  {"termez.su", 9u},
+  {"terni.it", 8u},
+  {"ternopil.ua", 11u},
+  {"teshikaga.hokkaido.jp", 21u},
+  {"test-iserv.de", 13u},
+  {"test.ru", 7u},
+  {"test.tj", 7u},
+  {"teva", 4u},
+  {"texas.museum", 12u},
+  {"textile.museum", 14u},
+  {"tf", 2u},
+  {"tg", 2u},
+  {"tgory.pl", 8u},
+  {"th", 2u},
+  {"that.win", 8u},
+  {"thd", 3u},
+  {"the.br", 6u},
+  {"theater", 7u},
+  {"theater.museum", 14u},
+  {"theatre", 7u},
+  {"theshop.jp", 10u},
+  {"theworkpc.com", 13u},
+  {"thick.jp", 8u},
+  {"thingdustdata.com", 17u},
+  {"thruhere.net", 12u},
+  {"tiaa", 4u},
+  {"tickets", 7u},
+  {"tickets.io", 10u},
+  {"tienda", 6u},
+  {"tiffany", 7u},
+  {"time.museum", 11u},
+  {"time.no", 7u},
+  {"timekeeping.museum", 18u},
+  {"tingvoll.no", 11u},
+  {"tinn.no", 7u},
+  {"tips", 4u},
+  {"tires", 5u},
+  {"tirol", 5u},
+  {"tj", 2u},
+  {"tj.cn", 5u},
+  {"tjeldsund.no", 12u},
+  {"tjmaxx", 6u},
+  {"tjome.no", 8u},
+  {"tjx", 3u},
+  {"tj\303\270me.no", 9u},
+  {"tk", 2u},
+  {"tkmaxx", 6u},
+  {"tksat.bo", 8u},
+  {"tl", 2u},
+  {"tlon.network", 12u},
+  {"tm", 2u},
+  {"tm.cy", 5u},
+  {"tm.dz", 5u},
+  {"tm.fr", 5u},
+  {"tm.hu", 5u},
+  {"tm.km", 5u},
+  {"tm.mc", 5u},
+  {"tm.mg", 5u},
+  {"tm.no", 5u},
+  {"tm.pl", 5u},
+  {"tm.ro", 5u},
+  {"tm.se", 5u},
+  {"tm.za", 5u},
+  {"tmall", 5u},
+  {"tmp.br", 6u},
+  {"tn", 2u},
+  {"tn.it", 5u},
+  {"tn.oxa.cloud", 12u},
+  {"tn.us", 5u},
+  {"to", 2u},
+  {"to.gov.br", 9u},
+  {"to.gt", 5u},
+  {"to.it", 5u},
+  {"to.leg.br", 9u},
+  {"to.md", 5u},
+  {"to.work", 7u},
+  {"toba.mie.jp", 11u},
+  {"tobe.ehime.jp", 13u},
+  {"tobetsu.hokkaido.jp", 19u},
+  {"tobishima.aichi.jp", 18u},
+  {"tochigi.jp", 10u},
+  {"tochigi.tochigi.jp", 18u},
+  {"tochio.niigata.jp", 17u},
+  {"toda.saitama.jp", 15u},
+  {"today", 5u},
+  {"toei.aichi.jp", 13u},
+  {"toga.toyama.jp", 14u},
+  {"togakushi.nagano.jp", 19u},
+  {"togane.chiba.jp", 15u},
+  {"togitsu.nagasaki.jp", 19u},
+  {"togliatti.su", 12u},
+  {"togo.aichi.jp", 13u},
+  {"togura.nagano.jp", 16u},
+  {"tohma.hokkaido.jp", 17u},
+  {"tohnosho.chiba.jp", 17u},
+  {"toho.fukuoka.jp", 15u},
+  {"tokai.aichi.jp", 14u},
+  {"tokai.ibaraki.jp", 16u},
+  {"tokamachi.niigata.jp", 20u},
+  {"tokashiki.okinawa.jp", 20u},
+  {"toki.gifu.jp", 12u},
+  {"tokigawa.saitama.jp", 19u},
+  {"tokke.no", 8u},
+  {"tokoname.aichi.jp", 17u},
+  {"tokorozawa.saitama.jp", 21u},
+  {"tokushima.jp", 12u},
+  {"tokushima.tokushima.jp", 22u},
+  {"tokuyama.yamaguchi.jp", 21u},
+  {"tokyo", 5u},
+  {"tokyo.jp", 8u},
+  {"tolga.no", 8u},
+  {"tomakomai.hokkaido.jp", 21u},
+  {"tomari.hokkaido.jp", 18u},
+  {"tome.miyagi.jp", 14u},
+  {"tomi.nagano.jp", 14u},
+  {"tomigusuku.okinawa.jp", 21u},
+  {"tomika.gifu.jp", 14u},
+  {"tomioka.gunma.jp", 16u},
+  {"tomisato.chiba.jp", 17u},
+  {"tomiya.miyagi.jp", 16u},
+  {"tomobe.ibaraki.jp", 17u},
+  {"tonaki.okinawa.jp", 17u},
+  {"tonami.toyama.jp", 16u},
+  {"tondabayashi.osaka.jp", 21u},
+  {"tone.ibaraki.jp", 15u},
+  {"tonkotsu.jp", 11u},
+  {"tono.iwate.jp", 13u},
+  {"tonosho.kagawa.jp", 17u},
+  {"tonsberg.no", 11u},
+  {"toolforge.org", 13u},
+  {"tools", 5u},
+  {"toon.ehime.jp", 13u},
+  {"top", 3u},
+  {"topology.museum", 15u},
+  {"torahime.shiga.jp", 17u},
+  {"toray", 5u},
+  {"toride.ibaraki.jp", 17u},
+  {"torino.it", 9u},
+  {"torino.museum", 13u},
+  {"torproject.net", 14u},
+  {"torsken.no", 10u},
+  {"tos.it", 6u},
+  {"tosa.kochi.jp", 13u},
+  {"tosashimizu.kochi.jp", 20u},
+  {"toscana.it", 10u},
+  {"toshiba", 7u},
+  {"toshima.tokyo.jp", 16u},
+  {"tosu.saga.jp", 12u},
+  {"total", 5u},
+  {"tottori.jp", 10u},
+  {"tottori.tottori.jp", 18u},
+  {"touch.museum", 12u},
+  {"tourism.pl", 10u},
+  {"tourism.tn", 10u},
+  {"tours", 5u},
+  {"towada.aomori.jp", 16u},
+  {"town", 4u},
+  {"town.museum", 11u},
+  {"townnews-staging.com", 20u},
+  {"toya.hokkaido.jp", 16u},
+  {"toyako.hokkaido.jp", 18u},
+  {"toyama.jp", 9u},
+  {"toyama.toyama.jp", 16u},
+  {"toyo.kochi.jp", 13u},
+  {"toyoake.aichi.jp", 16u},
+  {"toyohashi.aichi.jp", 18u},
+  {"toyokawa.aichi.jp", 17u},
+  {"toyonaka.osaka.jp", 17u},
+  {"toyone.aichi.jp", 15u},
+  {"toyono.osaka.jp", 15u},
+  {"toyooka.hyogo.jp", 16u},
+  {"toyosato.shiga.jp", 17u},
+  {"toyota", 6u},
+  {"toyota.aichi.jp", 15u},
+  {"toyota.yamaguchi.jp", 19u},
+  {"toyotomi.hokkaido.jp", 20u},
+  {"toyotsu.fukuoka.jp", 18u},
+  {"toyoura.hokkaido.jp", 19u},
+  {"toys", 4u},
+  {"tozawa.yamagata.jp", 18u},
+  {"tozsde.hu", 9u},
+  {"tp.it", 5u},
+  {"tr", 2u},
+  {"tr.eu.org", 9u},
+  {"tr.it", 5u},
+  {"tr.no", 5u},
+  {"tra.kp", 6u},
+  {"trade", 5u},
+  {"trader.aero", 11u},
+  {"trading", 7u},
+  {"trading.aero", 12u},
+  {"traeumtgerade.de", 16u},
+  {"trafficplex.cloud", 17u},
+  {"trainer.aero", 12u},
+  {"training", 8u},
+  {"trana.no", 8u},
+  {"tranby.no", 9u},
+  {"trani-andria-barletta.it", 24u},
+  {"trani-barletta-andria.it", 24u},
+  {"traniandriabarletta.it", 22u},
+  {"tranibarlettaandria.it", 22u},
+  {"tranoy.no", 9u},
+  {"translate.goog", 14u},
+  {"translated.page", 15u},
+  {"transport.museum", 16u},
+  {"transporte.bo", 13u},
+  {"tran\303\270y.no", 10u},
+  {"trapani.it", 10u},
+  {"travel", 6u},
+  {"travel.in", 9u},
+  {"travel.pl", 9u},
+  {"travel.tt", 9u},
+  {"travelchannel", 13u},
+  {"travelers", 9u},
+  {"travelersinsurance", 18u},
+  {"trd.br", 6u},
+  {"tree.museum", 11u},
+  {"trentin-sud-tirol.it", 20u},
+  {"trentin-sudtirol.it", 19u},
+  {"trentin-sued-tirol.it", 21u},
+  {"trentin-suedtirol.it", 20u},
+  {"trentin-s\303\274d-tirol.it", 21u},
+  {"trentin-s\303\274dtirol.it", 20u},
+  {"trentino-a-adige.it", 19u},
+  {"trentino-aadige.it", 18u},
+  {"trentino-alto-adige.it", 22u},
+  {"trentino-altoadige.it", 21u},
+  {"trentino-s-tirol.it", 19u},
+  {"trentino-stirol.it", 18u},
+  {"trentino-sud-tirol.it", 21u},
+  {"trentino-sudtirol.it", 20u},
+  {"trentino-sued-tirol.it", 22u},
+  {"trentino-suedtirol.it", 21u},
+  {"trentino-s\303\274d-tirol.it", 22u},
+  {"trentino-s\303\274dtirol.it", 21u},
+  {"trentino.it", 11u},
+  {"trentinoa-adige.it", 18u},
+  {"trentinoaadige.it", 17u},
+  {"trentinoalto-adige.it", 21u},
+  {"trentinoaltoadige.it", 20u},
+  {"trentinos-tirol.it", 18u},
+  {"trentinostirol.it", 17u},
+  {"trentinosud-tirol.it", 20u},
+  {"trentinosudtirol.it", 19u},
+  {"trentinosued-tirol.it", 21u},
+  {"trentinosuedtirol.it", 20u},
+  {"trentinos\303\274d-tirol.it", 21u},
+  {"trentinos\303\274dtirol.it", 20u},
+  {"trentinsud-tirol.it", 19u},
+  {"trentinsudtirol.it", 18u},
+  {"trentinsued-tirol.it", 20u},
+  {"trentinsuedtirol.it", 19u},
+  {"trentins\303\274d-tirol.it", 20u},
+  {"trentins\303\274dtirol.it", 19u},
+  {"trento.it", 9u},
+  {"treviso.it", 10u},
+  {"trieste.it", 10u},
+  {"troandin.no", 11u},
+  {"trogstad.no", 11u},
+  {"troitsk.su", 10u},
+  {"trolley.museum", 14u},
+  {"tromsa.no", 9u},
+  {"tromso.no", 9u},
+  {"troms\303\270.no", 10u},
+  {"trondheim.no", 12u},
+  {"trust", 5u},
+  {"trust.museum", 12u},
+  {"trustee.museum", 14u},
+  {"trv", 3u},
+  {"try-snowplow.com", 16u},
+  {"trycloudflare.com", 17u},
+  {"trysil.no", 9u},
+  {"tr\303\246na.no", 9u},
+  {"tr\303\270gstad.no", 12u},
+  {"ts.it", 5u},
+  {"ts.net", 6u},
+  {"tselinograd.su", 14u},
+  {"tsk.tr", 6u},
+  {"tsu.mie.jp", 10u},
+  {"tsubame.niigata.jp", 18u},
+  {"tsubata.ishikawa.jp", 19u},
+  {"tsubetsu.hokkaido.jp", 20u},
+  {"tsuchiura.ibaraki.jp", 20u},
+  {"tsuga.tochigi.jp", 16u},
+  {"tsugaru.aomori.jp", 17u},
+  {"tsuiki.fukuoka.jp", 17u},
+  {"tsukigata.hokkaido.jp", 21u},
+  {"tsukiyono.gunma.jp", 18u},
+  {"tsukuba.ibaraki.jp", 18u},
+  {"tsukui.kanagawa.jp", 18u},
+  {"tsukumi.oita.jp", 15u},
+  {"tsumagoi.gunma.jp", 17u},
+  {"tsunan.niigata.jp", 17u},
+  {"tsuno.kochi.jp", 14u},
+  {"tsuno.miyazaki.jp", 17u},
+  {"tsuru.yamanashi.jp", 18u},
+  {"tsuruga.fukui.jp", 16u},
+  {"tsurugashima.saitama.jp", 23u},
+  {"tsurugi.ishikawa.jp", 19u},
+  {"tsuruoka.yamagata.jp", 20u},
+  {"tsuruta.aomori.jp", 17u},
+  {"tsushima.aichi.jp", 17u},
+  {"tsushima.nagasaki.jp", 20u},
+  {"tsuwano.shimane.jp", 18u},
+  {"tsuyama.okayama.jp", 18u},
+  {"tt", 2u},
+  {"tt.im", 5u},
+  {"tube", 4u},
+  {"tui", 3u},
+  {"tula.su", 7u},
+  {"tuleap-partners.com", 19u},
+  {"tunes", 5u},
+  {"tunk.org", 8u},
+  {"tur.ar", 6u},
+  {"tur.br", 6u},
+  {"turek.pl", 8u},
+  {"turin.it", 8u},
+  {"turystyka.pl", 12u},
+  {"tuscany.it", 10u},
+  {"tushu", 5u},
+  {"tuva.su", 7u},
+  {"tuxfamily.org", 13u},
+  {"tv", 2u},
+  {"tv.bb", 5u},
+  {"tv.bo", 5u},
+  {"tv.br", 5u},
+  {"tv.im", 5u},
+  {"tv.in", 5u},
+  {"tv.it", 5u},
+  {"tv.kg", 5u},
+  {"tv.na", 5u},
+  {"tv.sd", 5u},
+  {"tv.tr", 5u},
+  {"tv.tz", 5u},
+  {"tvedestrand.no", 14u},
+  {"tvs", 3u},
+  {"tw", 2u},
+  {"tw.cn", 5u},
+  {"twmail.cc", 9u},
+  {"twmail.net", 10u},
+  {"twmail.org", 10u},
+  {"tx.us", 5u},
+  {"tychy.pl", 8u},
+  {"tydal.no", 8u},
+  {"tynset.no", 9u},
+  {"typedream.app", 13u},
+  {"tysfjord.no", 11u},
+  {"tysnes.no", 9u},
+  {"tysvar.no", 9u},
+  {"tysv\303\246r.no", 10u},
+  {"tz", 2u},
+  {"t\303\270nsberg.no", 12u},
+  {"u.bg", 4u},
+  {"u.channelsdvr.net", 17u},
+  {"u.se", 4u},
+  {"u2-local.xnbay.com", 18u},
+  {"u2.xnbay.com", 12u},
+  {"ua", 2u},
+  {"ua.rs", 5u},
+  {"ubank", 5u},
+  {"ube.yamaguchi.jp", 16u},
+  {"uber.space", 10u},
+  {"ubs", 3u},
+  {"uchihara.ibaraki.jp", 19u},
+  {"uchiko.ehime.jp", 15u},
+  {"uchinada.ishikawa.jp", 20u},
+  {"uchinomi.kagawa.jp", 18u},
+  {"ud.it", 5u},
+  {"uda.nara.jp", 11u},
+  {"udi.br", 6u},
+  {"udine.it", 8u},
+  {"udono.mie.jp", 12u},
+  {"ueda.nagano.jp", 14u},
+  {"ueno.gunma.jp", 13u},
+  {"uenohara.yamanashi.jp", 21u},
+  {"ufcfan.org", 10u},
+  {"ug", 2u},
+  {"ug.gov.pl", 9u},
+  {"ugim.gov.pl", 11u},
+  {"uhren.museum", 12u},
+  {"ui.nabu.casa", 12u},
+  {"uji.kyoto.jp", 12u},
+  {"ujiie.tochigi.jp", 16u},
+  {"ujitawara.kyoto.jp", 18u},
+  {"uk", 2u},
+  {"uk.com", 6u},
+  {"uk.eu.org", 9u},
+  {"uk.in", 5u},
+  {"uk.kg", 5u},
+  {"uk.net", 6u},
+  {"uk.oxa.cloud", 12u},
+  {"uk.primetel.cloud", 17u},
+  {"uk.reclaim.cloud", 16u},
+  {"uk0.bigv.io", 11u},
+  {"uki.kumamoto.jp", 15u},
+  {"ukiha.fukuoka.jp", 16u},
+  {"ullensaker.no", 13u},
+  {"ullensvang.no", 13u},
+  {"ulm.museum", 10u},
+  {"ulsan.kr", 8u},
+  {"ulvik.no", 8u},
+  {"um.gov.pl", 9u},
+  {"umaji.kochi.jp", 14u},
+  {"umb.it", 6u},
+  {"umbria.it", 9u},
+  {"umi.fukuoka.jp", 14u},
+  {"umig.gov.pl", 11u},
+  {"unazuki.toyama.jp", 17u},
+  {"under.jp", 8u},
+  {"under.one", 9u},
+  {"undersea.museum", 15u},
+  {"uni5.net", 8u},
+  {"unicloud.pl", 11u},
+  {"unicom", 6u},
+  {"union.aero", 10u},
+  {"univ.sn", 7u},
+  {"university", 10u},
+  {"university.museum", 17u},
+  {"unjarga.no", 10u},
+  {"unj\303\241rga.no", 11u},
+  {"unnan.shimane.jp", 16u},
+  {"uno", 3u},
+  {"unusualperson.com", 17u},
+  {"unzen.nagasaki.jp", 17u},
+  {"uol", 3u},
+  {"uonuma.niigata.jp", 17u},
+  {"uozu.toyama.jp", 14u},
+  {"up.in", 5u},
+  {"upaas.kazteleport.kz", 20u},
+  {"upli.io", 7u},
+  {"upow.gov.pl", 11u},
+  {"upper.jp", 8u},
+  {"uppo.gov.pl", 11u},
+  {"ups", 3u},
+  {"urakawa.hokkaido.jp", 19u},
+  {"urasoe.okinawa.jp", 17u},
+  {"urausu.hokkaido.jp", 18u},
+  {"urawa.saitama.jp", 16u},
+  {"urayasu.chiba.jp", 16u},
+  {"urbino-pesaro.it", 16u},
+  {"urbinopesaro.it", 15u},
+  {"ureshino.mie.jp", 15u},
+  {"uri.arpa", 8u},
+  {"url.tw", 6u},
+  {"urn.arpa", 8u},
+  {"urown.cloud", 11u},
+  {"uruma.okinawa.jp", 16u},
+  {"uryu.hokkaido.jp", 16u},
+  {"us", 2u},
+  {"us-1.evennode.com", 17u},
+  {"us-2.evennode.com", 17u},
+  {"us-3.evennode.com", 17u},
+  {"us-4.evennode.com", 17u},
+  {"us-east-1.amazonaws.com", 23u},
+  {"us-east-1.elasticbeanstalk.com", 30u},
+  {"us-east-2.elasticbeanstalk.com", 30u},
+  {"us-gov-west-1.elasticbeanstalk.com", 34u},
+  {"us-west-1.elasticbeanstalk.com", 30u},
+  {"us-west-2.elasticbeanstalk.com", 30u},
+  {"us.ax", 5u},
+  {"us.com", 6u},
+  {"us.eu.org", 9u},
+  {"us.gov.pl", 9u},
+  {"us.in", 5u},
+  {"us.kg", 5u},
+  {"us.na", 5u},
+  {"us.org", 6u},
+  {"us.platform.sh", 14u},
+  {"us.reclaim.cloud", 16u},
+  {"usa.museum", 10u},
+  {"usa.oita.jp", 11u},
+  {"usantiques.museum", 17u},
+  {"usarts.museum", 13u},
+  {"uscountryestate.museum", 22u},
+  {"usculture.museum", 16u},
+  {"usdecorativearts.museum", 23u},
+  {"user.aseinet.ne.jp", 18u},
+  {"user.party.eus", 14u},
+  {"user.srcf.net", 13u},
+  {"usercontent.jp", 14u},
+  {"users.scale.virtualcloud.com.br", 31u},
+  {"usgarden.museum", 15u},
+  {"ushiku.ibaraki.jp", 17u},
+  {"ushistory.museum", 16u},
+  {"ushuaia.museum", 14u},
+  {"uslivinghistory.museum", 22u},
+  {"usr.cloud.muni.cz", 17u},
+  {"ustka.pl", 8u},
+  {"usui.fukuoka.jp", 15u},
+  {"usuki.oita.jp", 13u},
+  {"ut.us", 5u},
+  {"utah.museum", 11u},
+  {"utashinai.hokkaido.jp", 21u},
+  {"utazas.hu", 9u},
+  {"utazu.kagawa.jp", 15u},
+  {"uto.kumamoto.jp", 15u},
+  {"utsira.no", 9u},
+  {"utsunomiya.tochigi.jp", 21u},
+  {"utwente.io", 10u},
+  {"uvic.museum", 11u},
+  {"uw.gov.pl", 9u},
+  {"uwajima.ehime.jp", 16u},
+  {"uwu.ai", 6u},
+  {"uy", 2u},
+  {"uy.com", 6u},
+  {"uz", 2u},
+  {"uz.ua", 5u},
+  {"uzhgorod.ua", 11u},
+  {"uzs.gov.pl", 10u},
+  {"v-info.info", 11u},
+  {"v.bg", 4u},
+  {"v.ua", 4u},
+  {"va", 2u},
+  {"va.it", 5u},
+  {"va.no", 5u},
+  {"va.us", 5u},
+  {"vaapste.no", 10u},
+  {"vacations", 9u},
+  {"vadso.no", 8u},
+  {"vads\303\270.no", 9u},
+  {"vaga.no", 7u},
+  {"vagan.no", 8u},
+  {"vagsoy.no", 9u},
+  {"vaksdal.no", 10u},
+  {"val-d-aosta.it", 14u},
+  {"val-daosta.it", 13u},
+  {"vald-aosta.it", 13u},
+  {"valdaosta.it", 12u},
+  {"valer.hedmark.no", 16u},
+  {"valer.ostfold.no", 16u},
+  {"valle-aosta.it", 14u},
+  {"valle-d-aosta.it", 16u},
+  {"valle-daosta.it", 15u},
+  {"valle.no", 8u},
+  {"valleaosta.it", 13u},
+  {"valled-aosta.it", 15u},
+  {"valledaosta.it", 14u},
+  {"vallee-aoste.it", 15u},
+  {"vallee-d-aoste.it", 17u},
+  {"valleeaoste.it", 14u},
+  {"valleedaoste.it", 15u},
+  {"valley.museum", 13u},
+  {"vall\303\251e-aoste.it", 16u},
+  {"vall\303\251e-d-aoste.it", 18u},
+  {"vall\303\251eaoste.it", 15u},
+  {"vall\303\251edaoste.it", 16u},
+  {"vana", 4u},
+  {"vang.no", 7u},
+  {"vanguard", 8u},
+  {"vantaa.museum", 13u},
+  {"vanylven.no", 11u},
+  {"vao.it", 6u},
+  {"vapor.cloud", 11u},
+  {"vaporcloud.io", 13u},
+  {"vardo.no", 8u},
+  {"vard\303\270.no", 9u},
+  {"varese.it", 9u},
+  {"varggat.no", 10u},
+  {"varoy.no", 8u},
+  {"vb.it", 5u},
+  {"vc", 2u},
+  {"vc.it", 5u},
+  {"vda.it", 6u},
+  {"ve", 2u},
+  {"ve.it", 5u},
+  {"vefsn.no", 8u},
+  {"vega.no", 7u},
+  {"vegarshei.no", 12u},
+  {"vegas", 5u},
+  {"veg\303\245rshei.no", 13u},
+  {"velvet.jp", 9u},
+  {"ven.it", 6u},
+  {"veneto.it", 9u},
+  {"venezia.it", 10u},
+  {"venice.it", 9u},
+  {"vennesla.no", 11u},
+  {"ventures", 8u},
+  {"verbania.it", 11u},
+  {"vercel.app", 10u},
+  {"vercel.dev", 10u},
+  {"vercelli.it", 11u},
+  {"verdal.no", 9u},
+  {"verisign", 8u},
+  {"verm\303\266gensberater", 17u},
+  {"verm\303\266gensberatung", 18u},
+  {"verona.it", 9u},
+  {"verran.no", 9u},
+  {"versailles.museum", 17u},
+  {"verse.jp", 8u},
+  {"versicherung", 12u},
+  {"versus.jp", 9u},
+  {"vestby.no", 9u},
+  {"vestnes.no", 10u},
+  {"vestre-slidre.no", 16u},
+  {"vestre-toten.no", 15u},
+  {"vestvagoy.no", 12u},
+  {"vestv\303\245g\303\270y.no", 14u},
+  {"vet", 3u},
+  {"vet.br", 6u},
+  {"veterinaire.fr", 14u},
+  {"veterinaire.km", 14u},
+  {"vevelstad.no", 12u},
+  {"vf.no", 5u},
+  {"vfs.cloud9.af-south-1.amazonaws.com", 35u},
+  {"vfs.cloud9.ap-east-1.amazonaws.com", 34u},
+  {"vfs.cloud9.ap-northeast-1.amazonaws.com", 39u},
+  {"vfs.cloud9.ap-northeast-2.amazonaws.com", 39u},
+  {"vfs.cloud9.ap-northeast-3.amazonaws.com", 39u},
+  {"vfs.cloud9.ap-south-1.amazonaws.com", 35u},
+  {"vfs.cloud9.ap-southeast-1.amazonaws.com", 39u},
+  {"vfs.cloud9.ap-southeast-2.amazonaws.com", 39u},
+  {"vfs.cloud9.ca-central-1.amazonaws.com", 37u},
+  {"vfs.cloud9.eu-central-1.amazonaws.com", 37u},
+  {"vfs.cloud9.eu-north-1.amazonaws.com", 35u},
+  {"vfs.cloud9.eu-south-1.amazonaws.com", 35u},
+  {"vfs.cloud9.eu-west-1.amazonaws.com", 34u},
+  {"vfs.cloud9.eu-west-2.amazonaws.com", 34u},
+  {"vfs.cloud9.eu-west-3.amazonaws.com", 34u},
+  {"vfs.cloud9.me-south-1.amazonaws.com", 35u},
+  {"vfs.cloud9.sa-east-1.amazonaws.com", 34u},
+  {"vfs.cloud9.us-east-1.amazonaws.com", 34u},
+  {"vfs.cloud9.us-east-2.amazonaws.com", 34u},
+  {"vfs.cloud9.us-west-1.amazonaws.com", 34u},
+  {"vfs.cloud9.us-west-2.amazonaws.com", 34u},
+  {"vg", 2u},
+  {"vgs.no", 6u},
+  {"vi", 2u},
+  {"vi.it", 5u},
+  {"vi.us", 5u},
+  {"viajes", 6u},
+  {"vibo-valentia.it", 16u},
+  {"vibovalentia.it", 15u},
+  {"vic.au", 6u},
+  {"vic.edu.au", 10u},
+  {"vic.gov.au", 10u},
+  {"vicenza.it", 10u},
+  {"video", 5u},
+  {"video.hu", 8u},
+  {"vig", 3u},
+  {"vik.no", 6u},
+  {"viking", 6u},
+  {"viking.museum", 13u},
+  {"vikna.no", 8u},
+  {"village.museum", 14u},
+  {"villas", 6u},
+  {"vin", 3u},
+  {"vindafjord.no", 13u},
+  {"vinnica.ua", 10u},
+  {"vinnytsia.ua", 12u},
+  {"vip", 3u},
+  {"vip.jelastic.cloud", 18u},
+  {"vipsinaapp.com", 14u},
+  {"virgin", 6u},
+  {"virginia.museum", 15u},
+  {"virtual-user.de", 15u},
+  {"virtual.museum", 14u},
+  {"virtualserver.io", 16u},
+  {"virtualuser.de", 14u},
+  {"virtuel.museum", 14u},
+  {"visa", 4u},
+  {"vision", 6u},
+  {"viterbo.it", 10u},
+  {"viva", 4u},
+  {"vivian.jp", 9u},
+  {"vivo", 4u},
+  {"vix.br", 6u},
+  {"vlaanderen", 10u},
+  {"vlaanderen.museum", 17u},
+  {"vladikavkaz.ru", 14u},
+  {"vladikavkaz.su", 14u},
+  {"vladimir.ru", 11u},
+  {"vladimir.su", 11u},
+  {"vlog.br", 7u},
+  {"vm.bytemark.co.uk", 17u},
+  {"vn", 2u},
+  {"vn.ua", 5u},
+  {"voagat.no", 9u},
+  {"vodka", 5u},
+  {"volda.no", 8u},
+  {"volkenkunde.museum", 18u},
+  {"volkswagen", 10u},
+  {"vologda.su", 10u},
+  {"volvo", 5u},
+  {"volyn.ua", 8u},
+  {"voorloper.cloud", 15u},
+  {"voss.no", 7u},
+  {"vossevangen.no", 14u},
+  {"vote", 4u},
+  {"voting", 6u},
+  {"voto", 4u},
+  {"voyage", 6u},
+  {"vp4.me", 6u},
+  {"vpndns.net", 10u},
+  {"vpnplus.to", 10u},
+  {"vps-host.net", 12u},
+  {"vps.mcdir.ru", 12u},
+  {"vr.it", 5u},
+  {"vs.it", 5u},
+  {"vs.mythic-beasts.com", 20u},
+  {"vt.it", 5u},
+  {"vt.us", 5u},
+  {"vu", 2u},
+  {"vuelos", 6u},
+  {"vv.it", 5u},
+  {"vxl.sh", 6u},
+  {"v\303\241rgg\303\241t.no", 12u},
+  {"v\303\245gan.no", 9u},
+  {"v\303\245gs\303\270y.no", 11u},
+  {"v\303\245g\303\245.no", 9u},
+  {"v\303\245ler.hedmark.no", 17u},
+  {"v\303\245ler.\303\270stfold.no", 18u},
+  {"v\303\246r\303\270y.no", 10u},
+  {"w.bg", 4u},
+  {"w.se", 4u},
+  {"wa.au", 5u},
+  {"wa.edu.au", 9u},
+  {"wa.gov.au", 9u},
+  {"wa.us", 5u},
+  {"wada.nagano.jp", 14u},
+  {"wafflecell.com", 14u},
+  {"wajiki.tokushima.jp", 19u},
+  {"wajima.ishikawa.jp", 18u},
+  {"wakasa.fukui.jp", 15u},
+  {"wakasa.tottori.jp", 17u},
+  {"wakayama.jp", 11u},
+  {"wakayama.wakayama.jp", 20u},
+  {"wake.okayama.jp", 15u},
+  {"wakkanai.hokkaido.jp", 20u},
+  {"wakuya.miyagi.jp", 16u},
+  {"walbrzych.pl", 12u},
+  {"wales", 5u},
+  {"wales.museum", 12u},
+  {"wallonie.museum", 15u},
+  {"walmart", 7u},
+  {"walter", 6u},
+  {"wang", 4u},
+  {"wanggou", 7u},
+  {"wanouchi.gifu.jp", 16u},
+  {"war.museum", 10u},
+  {"warabi.saitama.jp", 17u},
+  {"warmia.pl", 9u},
+  {"warszawa.pl", 11u},
+  {"washingtondc.museum", 19u},
+  {"washtenaw.mi.us", 15u},
+  {"wassamu.hokkaido.jp", 19u},
+  {"watarai.mie.jp", 14u},
+  {"watari.miyagi.jp", 16u},
+  {"watch", 5u},
+  {"watch-and-clock.museum", 22u},
+  {"watchandclock.museum", 20u},
+  {"watches", 7u},
+  {"watson.jp", 9u},
+  {"waw.pl", 6u},
+  {"wazuka.kyoto.jp", 15u},
+  {"we.bs", 5u},
+  {"we.tc", 5u},
+  {"weather", 7u},
+  {"weatherchannel", 14u},
+  {"web.app", 7u},
+  {"web.bo", 6u},
+  {"web.co", 6u},
+  {"web.do", 6u},
+  {"web.gu", 6u},
+  {"web.id", 6u},
+  {"web.in", 6u},
+  {"web.lk", 6u},
+  {"web.nf", 6u},
+  {"web.ni", 6u},
+  {"web.pk", 6u},
+  {"web.tj", 6u},
+  {"web.tr", 6u},
+  {"web.ve", 6u},
+  {"web.za", 6u},
+  {"webcam", 6u},
+  {"weber", 5u},
+  {"webhop.biz", 10u},
+  {"webhop.info", 11u},
+  {"webhop.me", 9u},
+  {"webhop.net", 10u},
+  {"webhop.org", 10u},
+  {"webhosting.be", 13u},
+  {"weblike.jp", 10u},
+  {"webredirect.org", 15u},
+  {"website", 7u},
+  {"website.yandexcloud.net", 23u},
+  {"webspace.rocks", 14u},
+  {"webthings.io", 12u},
+  {"webview-assets.cloud9.af-south-1.amazonaws.com", 46u},
+  {"webview-assets.cloud9.ap-east-1.amazonaws.com", 45u},
+  {"webview-assets.cloud9.ap-northeast-1.amazonaws.com", 50u},
+  {"webview-assets.cloud9.ap-northeast-2.amazonaws.com", 50u},
+  {"webview-assets.cloud9.ap-northeast-3.amazonaws.com", 50u},
+  {"webview-assets.cloud9.ap-south-1.amazonaws.com", 46u},
+  {"webview-assets.cloud9.ap-southeast-1.amazonaws.com", 50u},
+  {"webview-assets.cloud9.ap-southeast-2.amazonaws.com", 50u},
+  {"webview-assets.cloud9.ca-central-1.amazonaws.com", 48u},
+  {"webview-assets.cloud9.eu-central-1.amazonaws.com", 48u},
+  {"webview-assets.cloud9.eu-north-1.amazonaws.com", 46u},
+  {"webview-assets.cloud9.eu-south-1.amazonaws.com", 46u},
+  {"webview-assets.cloud9.eu-west-1.amazonaws.com", 45u},
+  {"webview-assets.cloud9.eu-west-2.amazonaws.com", 45u},
+  {"webview-assets.cloud9.eu-west-3.amazonaws.com", 45u},
+  {"webview-assets.cloud9.me-south-1.amazonaws.com", 46u},
+  {"webview-assets.cloud9.sa-east-1.amazonaws.com", 45u},
+  {"webview-assets.cloud9.us-east-1.amazonaws.com", 45u},
+  {"webview-assets.cloud9.us-east-2.amazonaws.com", 45u},
+  {"webview-assets.cloud9.us-west-1.amazonaws.com", 45u},
+  {"webview-assets.cloud9.us-west-2.amazonaws.com", 45u},
+  {"wedding", 7u},
+  {"wedeploy.io", 11u},
+  {"wedeploy.me", 11u},
+  {"wedeploy.sh", 11u},
+  {"weeklylottery.org.uk", 20u},
+  {"wegrow.pl", 9u},
+  {"weibo", 5u},
+  {"weir", 4u},
+  {"wellbeingzone.co.uk", 19u},
+  {"wellbeingzone.eu", 16u},
+  {"west1-us.cloudjiffy.net", 23u},
+  {"western.museum", 14u},
+  {"westeurope.azurestaticapps.net", 30u},
+  {"westfalen.museum", 16u},
+  {"westus2.azurestaticapps.net", 27u},
+  {"wf", 2u},
+  {"whaling.museum", 14u},
+  {"whitesnow.jp", 12u},
+  {"whm.fr-par.scw.cloud", 20u},
+  {"whm.nl-ams.scw.cloud", 20u},
+  {"whoswho", 7u},
+  {"wi.us", 5u},
+  {"wielun.pl", 9u},
+  {"wien", 4u},
+  {"wien.funkfeuer.at", 17u},
+  {"wif.gov.pl", 10u},
+  {"wiih.gov.pl", 11u},
+  {"wiki", 4u},
+  {"wiki.bo", 7u},
+  {"wiki.br", 7u},
+  {"wildlife.museum", 15u},
+  {"williamhill", 11u},
+  {"williamsburg.museum", 19u},
+  {"win", 3u},
+  {"winb.gov.pl", 11u},
+  {"windmill.museum", 15u},
+  {"windows", 7u},
+  {"wine", 4u},
+  {"winners", 7u},
+  {"wios.gov.pl", 11u},
+  {"witd.gov.pl", 11u},
+  {"with.marketing", 14u},
+  {"withgoogle.com", 14u},
+  {"withyoutube.com", 15u},
+  {"wiw.gov.pl", 10u},
+  {"wixsite.com", 11u},
+  {"wlocl.pl", 8u},
+  {"wloclawek.pl", 12u},
+  {"wmcloud.org", 11u},
+  {"wme", 3u},
+  {"wmflabs.org", 11u},
+  {"wnext.app", 9u},
+  {"wodzislaw.pl", 12u},
+  {"wolomin.pl", 10u},
+  {"wolterskluwer", 13u},
+  {"woltlab-demo.com", 16u},
+  {"woodside", 8u},
+  {"work", 4u},
+  {"workers.dev", 11u},
+  {"workinggroup.aero", 17u},
+  {"workisboring.com", 16u},
+  {"works", 5u},
+  {"works.aero", 10u},
+  {"workshop.museum", 15u},
+  {"world", 5u},
+  {"worse-than.tv", 13u},
+  {"wow", 3u},
+  {"wpdevcloud.com", 14u},
+  {"wpenginepowered.com", 19u},
+  {"wphostedmail.com", 16u},
+  {"wpmucdn.com", 11u},
+  {"wpmudev.host", 12u},
+  {"writesthisblog.com", 18u},
+  {"wroc.pl", 7u},
+  {"wroclaw.pl", 10u},
+  {"ws", 2u},
+  {"ws.na", 5u},
+  {"wsa.gov.pl", 10u},
+  {"wskr.gov.pl", 11u},
+  {"wtc", 3u},
+  {"wtf", 3u},
+  {"wuoz.gov.pl", 11u},
+  {"wv.us", 5u},
+  {"www.ro", 6u},
+  {"wy.us", 5u},
+  {"wzmiuw.gov.pl", 13u},
+  {"x.bg", 4u},
+  {"x.mythic-beasts.com", 19u},
+  {"x.se", 4u},
+  {"x443.pw", 7u},
+  {"xbox", 4u},
+  {"xen.prgmr.com", 13u},
+  {"xerox", 5u},
+  {"xfinity", 7u},
+  {"xihuan", 6u},
+  {"xin", 3u},
+  {"xj.cn", 5u},
+  {"xnbay.com", 9u},
+  {"xs4all.space", 12u},
+  {"xx.gl", 5u},
+  {"xxx", 3u},
+  {"xy.ax", 5u},
+  {"xyz", 3u},
+  {"xz.cn", 5u},
+  {"y.bg", 4u},
+  {"y.se", 4u},
+  {"yabu.hyogo.jp", 13u},
+  {"yabuki.fukushima.jp", 19u},
+  {"yachimata.chiba.jp", 18u},
+  {"yachiyo.chiba.jp", 16u},
+  {"yachiyo.ibaraki.jp", 18u},
+  {"yachts", 6u},
+  {"yaese.okinawa.jp", 16u},
+  {"yahaba.iwate.jp", 15u},
+  {"yahiko.niigata.jp", 17u},
+  {"yahoo", 5u},
+  {"yaita.tochigi.jp", 16u},
+  {"yaizu.shizuoka.jp", 17u},
+  {"yakage.okayama.jp", 17u},
+  {"yakumo.hokkaido.jp", 18u},
+  {"yakumo.shimane.jp", 17u},
+  {"yali.mythic-beasts.com", 22u},
+  {"yalta.ua", 8u},
+  {"yamada.fukuoka.jp", 17u},
+  {"yamada.iwate.jp", 15u},
+  {"yamada.toyama.jp", 16u},
+  {"yamaga.kumamoto.jp", 18u},
+  {"yamagata.gifu.jp", 16u},
+  {"yamagata.ibaraki.jp", 19u},
+  {"yamagata.jp", 11u},
+  {"yamagata.nagano.jp", 18u},
+  {"yamagata.yamagata.jp", 20u},
+  {"yamaguchi.jp", 12u},
+  {"yamakita.kanagawa.jp", 20u},
+  {"yamamoto.miyagi.jp", 18u},
+  {"yamanakako.yamanashi.jp", 23u},
+  {"yamanashi.jp", 12u},
+  {"yamanashi.yamanashi.jp", 22u},
+  {"yamanobe.yamagata.jp", 20u},
+  {"yamanouchi.nagano.jp", 20u},
+  {"yamashina.kyoto.jp", 18u},
+  {"yamato.fukushima.jp", 19u},
+  {"yamato.kanagawa.jp", 18u},
+  {"yamato.kumamoto.jp", 18u},
+  {"yamatokoriyama.nara.jp", 22u},
+  {"yamatotakada.nara.jp", 20u},
+  {"yamatsuri.fukushima.jp", 22u},
+  {"yamaxun", 7u},
+  {"yamazoe.nara.jp", 15u},
+  {"yame.fukuoka.jp", 15u},
+  {"yanagawa.fukuoka.jp", 19u},
+  {"yanaizu.fukushima.jp", 20u},
+  {"yandex", 6u},
+  {"yandexcloud.net", 15u},
+  {"yao.osaka.jp", 12u},
+  {"yaotsu.gifu.jp", 14u},
+  {"yasaka.nagano.jp", 16u},
+  {"yashio.saitama.jp", 17u},
+  {"yashiro.hyogo.jp", 16u},
+  {"yasu.shiga.jp", 13u},
+  {"yasuda.kochi.jp", 15u},
+  {"yasugi.shimane.jp", 17u},
+  {"yasuoka.nagano.jp", 17u},
+  {"yatomi.aichi.jp", 15u},
+  {"yatsuka.shimane.jp", 18u},
+  {"yatsushiro.kumamoto.jp", 22u},
+  {"yawara.ibaraki.jp", 17u},
+  {"yawata.kyoto.jp", 15u},
+  {"yawatahama.ehime.jp", 19u},
+  {"yazu.tottori.jp", 15u},
+  {"ybo.faith", 9u},
+  {"ybo.party", 9u},
+  {"ybo.review", 10u},
+  {"ybo.science", 11u},
+  {"ybo.trade", 9u},
+  {"ye", 2u},
+  {"yk.ca", 5u},
+  {"yn.cn", 5u},
+  {"ynh.fr", 6u},
+  {"yodobashi", 9u},
+  {"yoga", 4u},
+  {"yoichi.hokkaido.jp", 18u},
+  {"yoita.niigata.jp", 16u},
+  {"yoka.hyogo.jp", 13u},
+  {"yokaichiba.chiba.jp", 19u},
+  {"yokawa.hyogo.jp", 15u},
+  {"yokkaichi.mie.jp", 16u},
+  {"yokohama", 8u},
+  {"yokoshibahikari.chiba.jp", 24u},
+  {"yokosuka.kanagawa.jp", 20u},
+  {"yokote.akita.jp", 15u},
+  {"yokoze.saitama.jp", 17u},
+  {"yolasite.com", 12u},
+  {"yombo.me", 8u},
+  {"yomitan.okinawa.jp", 18u},
+  {"yonabaru.okinawa.jp", 19u},
+  {"yonago.tottori.jp", 17u},
+  {"yonaguni.okinawa.jp", 19u},
+  {"yonezawa.yamagata.jp", 20u},
+  {"yono.saitama.jp", 15u},
+  {"yorii.saitama.jp", 16u},
+  {"york.museum", 11u},
+  {"yorkshire.museum", 16u},
+  {"yoro.gifu.jp", 12u},
+  {"yosemite.museum", 15u},
+  {"yoshida.saitama.jp", 18u},
+  {"yoshida.shizuoka.jp", 19u},
+  {"yoshikawa.saitama.jp", 20u},
+  {"yoshimi.saitama.jp", 18u},
+  {"yoshino.nara.jp", 15u},
+  {"yoshinogari.saga.jp", 19u},
+  {"yoshioka.gunma.jp", 17u},
+  {"yotsukaido.chiba.jp", 19u},
+  {"you", 3u},
+  {"youth.museum", 12u},
+  {"youtube", 7u},
+  {"yt", 2u},
+  {"yuasa.wakayama.jp", 17u},
+  {"yufu.oita.jp", 12u},
+  {"yugawa.fukushima.jp", 19u},
+  {"yugawara.kanagawa.jp", 20u},
+  {"yuki.ibaraki.jp", 15u},
+  {"yukuhashi.fukuoka.jp", 20u},
+  {"yun", 3u},
+  {"yura.wakayama.jp", 16u},
+  {"yurihonjo.akita.jp", 18u},
+  {"yusuhara.kochi.jp", 17u},
+  {"yusui.kagoshima.jp", 18u},
+  {"yuu.yamaguchi.jp", 16u},
+  {"yuza.yamagata.jp", 16u},
+  {"yuzawa.niigata.jp", 17u},
+  {"z.bg", 4u},
+  {"z.se", 4u},
+  {"za.bz", 5u},
+  {"za.com", 6u},
+  {"za.net", 6u},
+  {"za.org", 6u},
+  {"zachpomor.pl", 12u},
+  {"zagan.pl", 8u},
+  {"zakopane.pl", 11u},
+  {"zama.kanagawa.jp", 16u},
+  {"zamami.okinawa.jp", 17u},
+  {"zao.miyagi.jp", 13u},
+  {"zaporizhzhe.ua", 14u},
+  {"zaporizhzhia.ua", 15u},
+  {"zappos", 6u},
+  {"zapto.org", 9u},
+  {"zapto.xyz", 9u},
+  {"zara", 4u},
+  {"zarow.pl", 8u},
+  {"zentsuji.kagawa.jp", 18u},
+  {"zero", 4u},
+  {"zgora.pl", 8u},
+  {"zgorzelec.pl", 12u},
+  {"zhitomir.ua", 11u},
+  {"zhytomyr.ua", 11u},
+  {"zip", 3u},
+  {"zj.cn", 5u},
+  {"zlg.br", 6u},
+  {"zm", 2u},
+  {"zombie.jp", 9u},
+  {"zone", 4u},
+  {"zoological.museum", 17u},
+  {"zoology.museum", 14u},
+  {"zp.gov.pl", 9u},
+  {"zp.ua", 5u},
+  {"zt.ua", 5u},
+  {"zuerich", 7u},
+  {"zushi.kanagawa.jp", 17u},
+  {"zw", 2u},
+  {"\303\241k\305\213oluokta.no", 15u},
+  {"\303\241laheadju.no", 13u},
+  {"\303\241lt\303\241.no", 9u},
+  {"\303\245fjord.no", 10u},
+  {"\303\245krehamn.no", 12u},
+  {"\303\245l.no", 6u},
+  {"\303\245lesund.no", 11u},
+  {"\303\245lg\303\245rd.no", 11u},
+  {"\303\245mli.no", 8u},
+  {"\303\245mot.no", 8u},
+  {"\303\245rdal.no", 9u},
+  {"\303\245s.no", 6u},
+  {"\303\245seral.no", 10u},
+  {"\303\245snes.no", 9u},
+  {"\303\270ksnes.no", 10u},
+  {"\303\270rland.no", 10u},
+  {"\303\270rskog.no", 10u},
+  {"\303\270rsta.no", 9u},
+  {"\303\270stre-toten.no", 15u},
+  {"\303\270vre-eiker.no", 14u},
+  {"\303\270yer.no", 8u},
+  {"\303\270ygarden.no", 12u},
+  {"\303\270ystre-slidre.no", 17u},
+  {"\304\215\303\241hcesuolo.no", 15u},
+  {"\316\265\316\273", 4u},
+  {"\316\265\317\205", 4u},
+  {"\320\260\320\272.\321\201\321\200\320\261", 11u},
+  {"\320\261\320\263", 4u},
+  {"\320\261\320\265\320\273", 6u},
+  {"\320\261\320\270\320\267.\321\200\321\203\321\201", 13u},
+  {"\320\264\320\265\321\202\320\270", 8u},
+  {"\320\265\321\216", 4u},
+  {"\320\270\320\272\320\276\320\274.museum", 15u},
+  {"\320\272\320\260\321\202\320\276\320\273\320\270\320\272", 14u},
+  {"\320\272\320\276\320\274", 6u},
+  {"\320\272\320\276\320\274.\321\200\321\203\321\201", 13u},
+  {"\320\272\321\200\321\213\320\274.\321\200\321\203\321\201", 15u},
+  {"\320\274\320\270\321\200.\321\200\321\203\321\201", 13u},
+  {"\320\274\320\272\320\264", 6u},
+  {"\320\274\320\276\320\275", 6u},
+  {"\320\274\320\276\321\201\320\272\320\262\320\260", 12u},
+  {"\320\274\321\201\320\272.\321\200\321\203\321\201", 13u},
+  {"\320\276\320\261\321\200.\321\201\321\200\320\261", 13u},
+  {"\320\276\320\264.\321\201\321\200\320\261", 11u},
+  {"\320\276\320\275\320\273\320\260\320\271\320\275", 12u},
+  {"\320\276\321\200\320\263", 6u},
+  {"\320\276\321\200\320\263.\321\200\321\203\321\201", 13u},
+  {"\320\276\321\200\320\263.\321\201\321\200\320\261", 13u},
+  {"\320\277\321\200.\321\201\321\200\320\261", 11u},
+  {"\321\200\321\203\321\201", 6u},
+  {"\321\200\321\204", 4u},
+  {"\321\201\320\260\320\271\321\202", 8u},
+  {"\321\201\320\260\320\274\320\260\321\200\320\260.\321\200\321\203\321\201", 19u},
+  {"\321\201\320\276\321\207\320\270.\321\200\321\203\321\201", 15u},
+  {"\321\201\320\277\320\261.\321\200\321\203\321\201", 13u},
+  {"\321\201\321\200\320\261", 6u},
+  {"\321\203\320\272\321\200", 6u},
+  {"\321\203\320\277\321\200.\321\201\321\200\320\261", 13u},
+  {"\321\217.\321\200\321\203\321\201", 9u},
+  {"\322\233\320\260\320\267", 6u},
+  {"\325\260\325\241\325\265", 6u},
+  {"\327\220\327\247\327\223\327\236\327\231\327\224.\327\231\327\251\327\250\327\220\327\234", 23u},
+  {"\327\231\327\250\327\225\327\251\327\234\327\231\327\235.museum", 21u},
+  {"\327\231\327\251\327\225\327\221.\327\231\327\251\327\250\327\220\327\234", 19u},
+  {"\327\231\327\251\327\250\327\220\327\234", 10u},
+  {"\327\236\327\236\327\251\327\234.\327\231\327\251\327\250\327\220\327\234", 19u},
+  {"\327\246\327\224\327\234.\327\231\327\251\327\250\327\220\327\234", 17u},
+  {"\327\247\327\225\327\235", 6u},
+  {"\330\247\330\250\331\210\330\270\330\250\331\212", 12u},
+  {"\330\247\330\252\330\265\330\247\331\204\330\247\330\252", 14u},
+  {"\330\247\330\261\330\247\331\205\331\203\331\210", 12u},
+  {"\330\247\331\204\330\247\330\261\330\257\331\206", 12u},
+  {"\330\247\331\204\330\250\330\255\330\261\331\212\331\206", 14u},
+  {"\330\247\331\204\330\254\330\262\330\247\330\246\330\261", 14u},
+  {"\330\247\331\204\330\263\330\271\331\210\330\257\331\212\330\251", 16u},
+  {"\330\247\331\204\330\263\330\271\331\210\330\257\331\212\331\207", 16u},
+  {"\330\247\331\204\330\263\330\271\331\210\330\257\333\214\330\251", 16u},
+  {"\330\247\331\204\330\263\330\271\331\210\330\257\333\214\333\203", 16u},
+  {"\330\247\331\204\330\271\331\204\331\212\330\247\331\206", 14u},
+  {"\330\247\331\204\331\205\330\272\330\261\330\250", 12u},
+  {"\330\247\331\204\331\212\331\205\331\206", 10u},
+  {"\330\247\331\205\330\247\330\261\330\247\330\252", 12u},
+  {"\330\247\331\212\330\261\330\247\331\206", 10u},
+  {"\330\247\331\212\330\261\330\247\331\206.ir", 13u},
+  {"\330\247\333\214\330\261\330\247\331\206", 10u},
+  {"\330\247\333\214\330\261\330\247\331\206.ir", 13u},
+  {"\330\250\330\247\330\261\330\252", 8u},
+  {"\330\250\330\247\330\262\330\247\330\261", 10u},
+  {"\330\250\331\212\330\252\331\203", 8u},
+  {"\330\250\332\276\330\247\330\261\330\252", 10u},
+  {"\330\252\331\210\331\206\330\263", 8u},
+  {"\330\263\331\210\330\257\330\247\331\206", 10u},
+  {"\330\263\331\210\330\261\331\212\330\247", 10u},
+  {"\330\263\331\210\330\261\331\212\330\251", 10u},
+  {"\330\264\330\250\331\203\330\251", 8u},
+  {"\330\271\330\261\330\247\331\202", 8u},
+  {"\330\271\330\261\330\250", 6u},
+  {"\330\271\331\205\330\247\331\206", 8u},
+  {"\331\201\331\204\330\263\330\267\331\212\331\206", 12u},
+  {"\331\202\330\267\330\261", 6u},
+  {"\331\203\330\247\330\253\331\210\331\204\331\212\331\203", 14u},
+  {"\331\203\331\210\331\205", 6u},
+  {"\331\205\330\265\330\261", 6u},
+  {"\331\205\331\204\331\212\330\263\331\212\330\247", 12u},
+  {"\331\205\331\210\330\261\331\212\330\252\330\247\331\206\331\212\330\247", 18u},
+  {"\331\205\331\210\331\202\330\271", 8u},
+  {"\331\207\331\205\330\261\330\247\331\207", 10u},
+  {"\331\276\330\247\331\203\330\263\330\252\330\247\331\206", 14u},
+  {"\331\276\330\247\332\251\330\263\330\252\330\247\331\206", 14u},
+  {"\332\200\330\247\330\261\330\252", 8u},
+  {"\340\244\225\340\245\211\340\244\256", 9u},
+  {"\340\244\250\340\245\207\340\244\237", 9u},
+  {"\340\244\255\340\244\276\340\244\260\340\244\244", 12u},
+  {"\340\244\255\340\244\276\340\244\260\340\244\244\340\244\256\340\245\215", 18u},
+  {"\340\244\255\340\244\276\340\244\260\340\245\213\340\244\244", 15u},
+  {"\340\244\270\340\244\202\340\244\227\340\244\240\340\244\250", 15u},
+  {"\340\246\254\340\246\276\340\246\202\340\246\262\340\246\276", 15u},
+  {"\340\246\255\340\246\276\340\246\260\340\246\244", 12u},
+  {"\340\246\255\340\246\276\340\247\260\340\246\244", 12u},
+  {"\340\250\255\340\250\276\340\250\260\340\250\244", 12u},
+  {"\340\252\255\340\252\276\340\252\260\340\252\244", 12u},
+  {"\340\254\255\340\254\276\340\254\260\340\254\244", 12u},
+  {"\340\256\207\340\256\250\340\257\215\340\256\244\340\256\277\340\256\257\340\256\276", 21u},
+  {"\340\256\207\340\256\262\340\256\231\340\257\215\340\256\225\340\257\210", 18u},
+  {"\340\256\232\340\256\277\340\256\231\340\257\215\340\256\225\340\256\252\340\257\215\340\256\252\340\257\202\340\256\260\340\257\215", 33u},
+  {"\340\260\255\340\260\276\340\260\260\340\260\244\340\261\215", 15u},
+  {"\340\262\255\340\262\276\340\262\260\340\262\244", 12u},
+  {"\340\264\255\340\264\276\340\264\260\340\264\244\340\264\202", 15u},
+  {"\340\266\275\340\266\202\340\266\232\340\267\217", 12u},
+  {"\340\270\204\340\270\255\340\270\241", 9u},
+  {"\340\270\227\340\270\253\340\270\262\340\270\243.\340\271\204\340\270\227\340\270\242", 22u},
+  {"\340\270\230\340\270\270\340\270\243\340\270\201\340\270\264\340\270\210.\340\271\204\340\270\227\340\270\242", 28u},
+  {"\340\270\243\340\270\261\340\270\220\340\270\232\340\270\262\340\270\245.\340\271\204\340\270\227\340\270\242", 28u},
+  {"\340\270\250\340\270\266\340\270\201\340\270\251\340\270\262.\340\271\204\340\270\227\340\270\242", 25u},
+  {"\340\270\255\340\270\207\340\270\204\340\271\214\340\270\201\340\270\243.\340\271\204\340\270\227\340\270\242", 28u},
+  {"\340\271\200\340\270\231\340\271\207\340\270\225.\340\271\204\340\270\227\340\270\242", 22u},
+  {"\340\271\204\340\270\227\340\270\242", 9u},
+  {"\340\272\245\340\272\262\340\272\247", 9u},
+  {"\341\203\222\341\203\224", 6u},
+  {"\343\201\277\343\202\223\343\201\252", 9u},
+  {"\343\202\242\343\203\236\343\202\276\343\203\263", 12u},
+  {"\343\202\257\343\203\251\343\202\246\343\203\211", 12u},
+  {"\343\202\260\343\203\274\343\202\260\343\203\253", 12u},
+  {"\343\202\263\343\203\240", 6u},
+  {"\343\202\271\343\203\210\343\202\242", 9u},
+  {"\343\202\273\343\203\274\343\203\253", 9u},
+  {"\343\203\225\343\202\241\343\203\203\343\202\267\343\203\247\343\203\263", 18u},
+  {"\343\203\235\343\202\244\343\203\263\343\203\210", 12u},
+  {"\344\270\211\351\207\215.jp", 9u},
+  {"\344\270\226\347\225\214", 6u},
+  {"\344\270\252\344\272\272.hk", 9u},
+  {"\344\270\255\344\277\241", 6u},
+  {"\344\270\255\345\233\275", 6u},
+  {"\344\270\255\345\234\213", 6u},
+  {"\344\270\255\346\226\207\347\275\221", 9u},
+  {"\344\272\232\351\251\254\351\200\212", 9u},
+  {"\344\272\254\351\203\275.jp", 9u},
+  {"\344\274\201\344\270\232", 6u},
+  {"\344\275\220\350\263\200.jp", 9u},
+  {"\344\275\233\345\261\261", 6u},
+  {"\344\277\241\346\201\257", 6u},
+  {"\345\200\213\344\272\272.hk", 9u},
+  {"\345\200\213\344\272\272.\351\246\231\346\270\257", 13u},
+  {"\345\201\245\345\272\267", 6u},
+  {"\345\205\253\345\215\246", 6u},
+  {"\345\205\254\345\217\270", 6u},
+  {"\345\205\254\345\217\270.cn", 9u},
+  {"\345\205\254\345\217\270.hk", 9u},
+  {"\345\205\254\345\217\270.\351\246\231\346\270\257", 13u},
+  {"\345\205\254\347\233\212", 6u},
+  {"\345\205\265\345\272\253.jp", 9u},
+  {"\345\214\227\346\265\267\351\201\223.jp", 12u},
+  {"\345\215\203\350\221\211.jp", 9u},
+  {"\345\217\260\346\271\276", 6u},
+  {"\345\217\260\347\201\243", 6u},
+  {"\345\222\214\346\255\214\345\261\261.jp", 12u},
+  {"\345\225\206\345\237\216", 6u},
+  {"\345\225\206\345\272\227", 6u},
+  {"\345\225\206\346\240\207", 6u},
+  {"\345\225\206\346\245\255.tw", 9u},
+  {"\345\230\211\351\207\214", 6u},
+  {"\345\230\211\351\207\214\345\244\247\351\205\222\345\272\227", 15u},
+  {"\345\234\250\347\272\277", 6u},
+  {"\345\237\274\347\216\211.jp", 9u},
+  {"\345\244\247\345\210\206.jp", 9u},
+  {"\345\244\247\346\213\277", 6u},
+  {"\345\244\247\351\230\252.jp", 9u},
+  {"\345\244\251\344\270\273\346\225\231", 9u},
+  {"\345\245\210\350\211\257.jp", 9u},
+  {"\345\250\261\344\271\220", 6u},
+  {"\345\256\256\345\237\216.jp", 9u},
+  {"\345\256\256\345\264\216.jp", 9u},
+  {"\345\256\266\351\233\273", 6u},
+  {"\345\257\214\345\261\261.jp", 9u},
+  {"\345\261\261\345\217\243.jp", 9u},
+  {"\345\261\261\345\275\242.jp", 9u},
+  {"\345\261\261\346\242\250.jp", 9u},
+  {"\345\262\220\351\230\234.jp", 9u},
+  {"\345\262\241\345\261\261.jp", 9u},
+  {"\345\262\251\346\211\213.jp", 9u},
+  {"\345\263\266\346\240\271.jp", 9u},
+  {"\345\271\277\344\270\234", 6u},
+  {"\345\272\203\345\263\266.jp", 9u},
+  {"\345\276\256\345\215\232", 6u},
+  {"\345\276\263\345\263\266.jp", 9u},
+  {"\346\204\233\345\252\233.jp", 9u},
+  {"\346\204\233\347\237\245.jp", 9u},
+  {"\346\205\210\345\226\204", 6u},
+  {"\346\210\221\347\210\261\344\275\240", 9u},
+  {"\346\211\213\346\234\272", 6u},
+  {"\346\213\233\350\201\230", 6u},
+  {"\346\224\277\345\212\241", 6u},
+  {"\346\224\277\345\272\234", 6u},
+  {"\346\224\277\345\272\234.hk", 9u},
+  {"\346\224\277\345\272\234.\351\246\231\346\270\257", 13u},
+  {"\346\225\216\350\202\262.hk", 9u},
+  {"\346\225\231\350\202\262.hk", 9u},
+  {"\346\225\231\350\202\262.\351\246\231\346\270\257", 13u},
+  {"\346\226\260\345\212\240\345\235\241", 9u},
+  {"\346\226\260\346\275\237.jp", 9u},
+  {"\346\226\260\351\227\273", 6u},
+  {"\346\227\266\345\260\232", 6u},
+  {"\346\233\270\347\261\215", 6u},
+  {"\346\234\272\346\236\204", 6u},
+  {"\346\235\261\344\272\254.jp", 9u},
+  {"\346\240\203\346\234\250.jp", 9u},
+  {"\346\262\226\347\270\204.jp", 9u},
+  {"\346\267\241\351\251\254\351\224\241", 9u},
+  {"\346\270\270\346\210\217", 6u},
+  {"\346\273\213\350\263\200.jp", 9u},
+  {"\346\276\263\351\226\200", 6u},
+  {"\346\276\263\351\227\250", 6u},
+  {"\347\202\271\347\234\213", 6u},
+  {"\347\206\212\346\234\254.jp", 9u},
+  {"\347\237\263\345\267\235.jp", 9u},
+  {"\347\245\236\345\245\210\345\267\235.jp", 12u},
+  {"\347\246\217\344\272\225.jp", 9u},
+  {"\347\246\217\345\262\241.jp", 9u},
+  {"\347\246\217\345\263\266.jp", 9u},
+  {"\347\247\213\347\224\260.jp", 9u},
+  {"\347\247\273\345\212\250", 6u},
+  {"\347\256\207\344\272\272.hk", 9u},
+  {"\347\265\204\347\271\224.hk", 9u},
+  {"\347\265\204\347\271\224.tw", 9u},
+  {"\347\265\204\347\271\224.\351\246\231\346\270\257", 13u},
+  {"\347\265\204\347\273\207.hk", 9u},
+  {"\347\266\262\347\265\241.cn", 9u},
+  {"\347\266\262\347\265\241.hk", 9u},
+  {"\347\266\262\347\265\241.\351\246\231\346\270\257", 13u},
+  {"\347\266\262\347\273\234.hk", 9u},
+  {"\347\266\262\350\267\257.tw", 9u},
+  {"\347\273\204\347\271\224.hk", 9u},
+  {"\347\273\204\347\273\207.hk", 9u},
+  {"\347\273\204\347\273\207\346\234\272\346\236\204", 12u},
+  {"\347\275\221\345\235\200", 6u},
+  {"\347\275\221\345\272\227", 6u},
+  {"\347\275\221\347\253\231", 6u},
+  {"\347\275\221\347\265\241.hk", 9u},
+  {"\347\275\221\347\273\234", 6u},
+  {"\347\275\221\347\273\234.cn", 9u},
+  {"\347\275\221\347\273\234.hk", 9u},
+  {"\347\276\244\351\246\254.jp", 9u},
+  {"\350\201\224\351\200\232", 6u},
+  {"\350\207\272\347\201\243", 6u},
+  {"\350\214\250\345\237\216.jp", 9u},
+  {"\350\257\272\345\237\272\344\272\232", 9u},
+  {"\350\260\267\346\255\214", 6u},
+  {"\350\264\255\347\211\251", 6u},
+  {"\351\200\232\350\262\251", 6u},
+  {"\351\225\267\345\264\216.jp", 9u},
+  {"\351\225\267\351\207\216.jp", 9u},
+  {"\351\233\206\345\233\242", 6u},
+  {"\351\233\273\350\250\212\347\233\210\347\247\221", 12u},
+  {"\351\235\222\346\243\256.jp", 9u},
+  {"\351\235\231\345\262\241.jp", 9u},
+  {"\351\243\236\345\210\251\346\265\246", 9u},
+  {"\351\243\237\345\223\201", 6u},
+  {"\351\244\220\345\216\205", 6u},
+  {"\351\246\231\345\267\235.jp", 9u},
+  {"\351\246\231\346\240\274\351\207\214\346\213\211", 12u},
+  {"\351\246\231\346\270\257", 6u},
+  {"\351\253\230\347\237\245.jp", 9u},
+  {"\351\263\245\345\217\226.jp", 9u},
+  {"\351\271\277\345\205\220\345\263\266.jp", 12u},
+  {"\353\213\267\353\204\267", 6u},
+  {"\353\213\267\354\273\264", 6u},
+  {"\354\202\274\354\204\261", 6u},
+  {"\355\225\234\352\265\255", 6u},
+};
+
+const psl_entry psl_whitelist[] = {
+  {"city.kawasaki.jp", 16u},
+  {"city.kitakyushu.jp", 18u},
+  {"city.kobe.jp", 12u},
+  {"city.nagoya.jp", 14u},
+  {"city.sapporo.jp", 15u},
+  {"city.sendai.jp", 14u},
+  {"city.yokohama.jp", 16u},
+  {"www.ck", 6u},
+};
+
+const psl_entry psl_wildcards[] = {
+  {"0emm.com", 8u},
+  {"advisor.ws", 10u},
+  {"alces.network", 13u},
+  {"awdev.ca", 8u},
+  {"azurecontainer.io", 17u},
+  {"backyards.banzaicloud.io", 24u},
+  {"banzai.cloud", 12u},
+  {"bd", 2u},
+  {"beget.app", 9u},
+  {"build.run", 9u},
+  {"builder.code.com", 16u},
+  {"bzz.dapps.earth", 15u},
+  {"ck", 2u},
+  {"cloud.metacentrum.cz", 20u},
+  {"cloudera.site", 13u},
+  {"cns.joyent.com", 14u},
+  {"code.run", 8u},
+  {"compute-1.amazonaws.com", 23u},
+  {"compute.amazonaws.com", 21u},
+  {"compute.amazonaws.com.cn", 24u},
+  {"compute.estate", 14u},
+  {"cryptonomic.net", 15u},
+  {"customer-oci.com", 16u},
+  {"dapps.earth", 11u},
+  {"database.run", 12u},
+  {"dev-builder.code.com", 20u},
+  {"dev.adobeaemcloud.com", 21u},
+  {"devcdnaccesso.com", 17u},
+  {"developer.app", 13u},
+  {"digitaloceanspaces.com", 22u},
+  {"diher.solutions", 15u},
+  {"dweb.link", 9u},
+  {"elb.amazonaws.com", 17u},
+  {"elb.amazonaws.com.cn", 20u},
+  {"er", 2u},
+  {"ex.futurecms.at", 15u},
+  {"ex.ortsinfo.at", 14u},
+  {"firenet.ch", 10u},
+  {"fk", 2u},
+  {"frusky.de", 9u},
+  {"futurecms.at", 12u},
+  {"gateway.dev", 11u},
+  {"hosting.myjino.ru", 17u},
+  {"hosting.ovh.net", 15u},
+  {"in.futurecms.at", 15u},
+  {"jm", 2u},
+  {"kawasaki.jp", 11u},
+  {"kh", 2u},
+  {"kitakyushu.jp", 13u},
+  {"kobe.jp", 7u},
+  {"kunden.ortsinfo.at", 18u},
+  {"landing.myjino.ru", 17u},
+  {"lcl.dev", 7u},
+  {"lclstage.dev", 12u},
+  {"linodeobjects.com", 17u},
+  {"magentosite.cloud", 17u},
+  {"migration.run", 13u},
+  {"mm", 2u},
+  {"moonscale.io", 12u},
+  {"nagoya.jp", 9u},
+  {"nodebalancer.linode.com", 23u},
+  {"nom.br", 6u},
+  {"northflank.app", 14u},
+  {"np", 2u},
+  {"oci.customer-oci.com", 20u},
+  {"ocp.customer-oci.com", 20u},
+  {"ocs.customer-oci.com", 20u},
+  {"on-acorn.io", 11u},
+  {"on-k3s.io", 9u},
+  {"on-rancher.cloud", 16u},
+  {"on-rio.io", 9u},
+  {"otap.co", 7u},
+  {"owo.codes", 9u},
+  {"paywhirl.com", 12u},
+  {"pg", 2u},
+  {"platformsh.site", 15u},
+  {"quipelements.com", 16u},
+  {"r.appspot.com", 13u},
+  {"rss.my.id", 9u},
+  {"s5y.io", 6u},
+  {"sapporo.jp", 10u},
+  {"sch.uk", 6u},
+  {"sendai.jp", 9u},
+  {"sensiosite.cloud", 16u},
+  {"spectrum.myjino.ru", 18u},
+  {"statics.cloud", 13u},
+  {"stg-builder.code.com", 20u},
+  {"stg.dev", 7u},
+  {"stgstage.dev", 12u},
+  {"stolos.io", 9u},
+  {"svc.firenet.ch", 14u},
+  {"sys.qcx.io", 10u},
+  {"telebit.xyz", 11u},
+  {"transurl.be", 11u},
+  {"transurl.eu", 11u},
+  {"transurl.nl", 11u},
+  {"triton.zone", 11u},
+  {"tst.site", 8u},
+  {"uberspace.de", 12u},
+  {"user.localcert.dev", 18u},
+  {"usercontent.goog", 16u},
+  {"vps.myjino.ru", 13u},
+  {"vultrobjects.com", 16u},
+  {"webhare.dev", 11u},
+  {"webpaas.ovh.net", 15u},
+  {"yokohama.jp", 11u},
+};
@@ -38,6 +38,26 @@ auto request(Connection & conn,
   return rb;
 }
 
+template<typename Connection, typename RequestBody, typename DynamicBuffer>
+auto request(Connection & conn,
+             beast::http::verb method,
+             urls::url_view target,
+             RequestBody && body,
+             typename Connection::request_type  req,
+             DynamicBuffer & sink,
+             system::error_code & ec) -> response_base
+{
+  auto s = conn.ropen(method, target, std::forward<RequestBody>(body), std::move(req), ec);
+  response_base rb{req.get_allocator()};
+
+  if (!ec)
+    s.read(sink, ec);
+  rb.headers = std::move(s).headers();
+  rb.history = std::move(s).history();
+
+  return rb;
+}
+
 namespace detail
 {
 
@@ -90,6 +110,59 @@ struct async_request_op : asio::coroutine
   }
 };
 
+// the sink flavour: same choreography, but the body bytes go straight
+// into the caller's dynamic buffer and only header & history come back.
+template<typename Connection, typename RequestBody, typename DynamicBuffer>
+struct async_request_sink_op : asio::coroutine
+{
+  using executor_type = typename Connection::executor_type;
+  executor_type get_executor() {return conn.get_executor(); }
+
+  using completion_signature_type = void(system::error_code, response_base);
+  using step_signature_type       = void(system::error_code, variant2::variant<std::size_t, typename Connection::stream>);
+
+  Connection & conn;
+  http::verb method;
+  urls::url_view target;
+  RequestBody && request_body;
+  typename Connection::request_type req;
+  DynamicBuffer & sink;
+  optional<typename Connection::stream> str_;
+
+  response_base rb{req.get_allocator()};
+
+  template<typename RequestBody_>
+  async_request_sink_op(Connection * conn,
+                        http::verb method,
+                        urls::url_view target,
+                        RequestBody_ && request_body,
+                        typename Connection::request_type req,
+                        DynamicBuffer * sink)
+      : conn(*conn), method(method), target(target),
+        request_body(static_cast<RequestBody&&>(request_body)), req(std::move(req)), sink(*sink) {}
+
+  response_base & resume(requests::detail::co_token_t<step_signature_type> self,
+                         system::error_code & ec,
+                         variant2::variant<std::size_t, typename Connection::stream> s)
+  {
+    reenter(this)
+    {
+      yield conn.async_ropen(method, target,
+                             std::forward<RequestBody>(request_body),
+                             std::move(req), std::move(self));
+      str_.emplace(std::move(variant2::get<1>(s)));
+      if (!ec)
+      {
+        yield str_->async_read(sink, std::move(self));
+      }
+
+      rb.headers = std::move(*str_).headers();
+      rb.history = std::move(*str_).history();
+    }
+    return rb;
+  }
+};
+
 
 struct async_free_request_op
 {
@@ -126,6 +199,24 @@ async_request(Connection & conn,
                           &conn, method, target, std::forward<RequestBody>(body), std::move(req));
 }
 
+template<typename Connection,
+         typename RequestBody,
+         typename DynamicBuffer,
+         BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code, response_base)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code, response_base))
+async_request(Connection & conn,
+              beast::http::verb method,
+              urls::url_view target,
+              RequestBody && body,
+              typename Connection::request_type req,
+              DynamicBuffer & sink,
+              CompletionToken && completion_token)
+{
+  return requests::detail::co_run<detail::async_request_sink_op<Connection, RequestBody, DynamicBuffer>>(
+                          std::forward<CompletionToken>(completion_token),
+                          &conn, method, target, std::forward<RequestBody>(body), std::move(req), &sink);
+}
+
 template<typename RequestBody,
           BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code,
                                                response)) CompletionToken>
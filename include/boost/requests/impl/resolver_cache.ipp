@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_IMPL_RESOLVER_CACHE_IPP
+#define BOOST_REQUESTS_IMPL_RESOLVER_CACHE_IPP
+
+#include <boost/requests/resolver_cache.hpp>
+
+namespace boost
+{
+namespace requests
+{
+
+bool resolver_cache::get(core::string_view host, core::string_view service, entry & out)
+{
+  const auto nw = clock_type::now();
+  std::lock_guard<std::mutex> lock{mtx_};
+  auto itr = entries_.find(make_key_(host, service));
+  if (itr == entries_.end())
+    return false;
+  if (itr->second.expiry <= nw)
+  {
+    entries_.erase(itr);
+    return false;
+  }
+  out = itr->second.data;
+  return true;
+}
+
+void resolver_cache::put(core::string_view host, core::string_view service, entry e)
+{
+  const auto expiry = clock_type::now() + ttl_;
+  std::lock_guard<std::mutex> lock{mtx_};
+  auto & impl = entries_[make_key_(host, service)];
+  impl.data = std::move(e);
+  impl.expiry = expiry;
+  impl.refreshing = false;
+}
+
+bool resolver_cache::claim_refresh(core::string_view host, core::string_view service)
+{
+  const auto nw = clock_type::now();
+  std::lock_guard<std::mutex> lock{mtx_};
+  auto itr = entries_.find(make_key_(host, service));
+  if (itr == entries_.end())
+    return false;
+  // refresh in the last quarter of the lifetime.
+  if (itr->second.refreshing || (itr->second.expiry - nw) > (ttl_ / 4))
+    return false;
+  itr->second.refreshing = true;
+  return true;
+}
+
+bool resolver_cache::claim_inflight(core::string_view host, core::string_view service,
+                                    std::function<void(system::error_code)> cb)
+{
+  auto key = make_key_(host, service);
+  std::lock_guard<std::mutex> lock{mtx_};
+  auto itr = inflight_.find(key);
+  if (itr == inflight_.end())
+  {
+    inflight_.emplace(std::move(key), std::vector<std::function<void(system::error_code)>>{});
+    return true;
+  }
+  itr->second.push_back(std::move(cb));
+  return false;
+}
+
+void resolver_cache::publish(core::string_view host, core::string_view service,
+                             system::error_code ec, entry e)
+{
+  std::vector<std::function<void(system::error_code)>> waiters;
+  {
+    std::lock_guard<std::mutex> lock{mtx_};
+    auto itr = inflight_.find(make_key_(host, service));
+    if (itr != inflight_.end())
+    {
+      waiters = std::move(itr->second);
+      inflight_.erase(itr);
+    }
+  }
+  // store before waking, so woken callers find the entry right away.
+  if (!ec)
+    put(host, service, std::move(e));
+  for (auto & w : waiters)
+    w(ec);
+}
+
+void resolver_cache::clear()
+{
+  std::lock_guard<std::mutex> lock{mtx_};
+  entries_.clear();
+}
+
+std::vector<resolver_cache::stored_entry> resolver_cache::snapshot()
+{
+  const auto nw = clock_type::now();
+  std::vector<stored_entry> res;
+  std::lock_guard<std::mutex> lock{mtx_};
+  res.reserve(entries_.size());
+  for (const auto & e : entries_)
+  {
+    if (e.second.expiry <= nw)
+      continue;
+    res.push_back(stored_entry{
+        e.first, e.second.data,
+        std::chrono::duration_cast<std::chrono::seconds>(e.second.expiry - nw)});
+  }
+  return res;
+}
+
+void resolver_cache::restore(core::string_view key, entry e, std::chrono::seconds remaining)
+{
+  if (remaining <= std::chrono::seconds::zero())
+    return;
+  const auto expiry = clock_type::now() + (std::min)(remaining, std::chrono::seconds(ttl_));
+  std::lock_guard<std::mutex> lock{mtx_};
+  auto & impl = entries_[std::string(key)];
+  impl.data = std::move(e);
+  impl.expiry = expiry;
+  impl.refreshing = false;
+}
+
+}
+}
+
+#endif // BOOST_REQUESTS_IMPL_RESOLVER_CACHE_IPP
@@ -9,12 +9,75 @@
 #define BOOST_REQUESTS_IMPL_SESSION_HPP
 
 #include <boost/requests/session.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/unordered_set.hpp>
 #include <boost/url/grammar/string_token.hpp>
+#include <boost/asio/associated_allocator.hpp>
+#include <boost/asio/recycling_allocator.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/asio/yield.hpp>
+#include <cstring>
 
 namespace boost {
 namespace requests {
 
+namespace detail {
+
+// primitives of the warm-state snapshot, see basic_session::save_state;
+// integers little-endian, doubles as their little-endian bit pattern.
+template<typename Int>
+inline void warm_write(std::string & out, Int value)
+{
+  unsigned char buf[sizeof(Int)];
+  endian::endian_store<Int, sizeof(Int), endian::order::little>(buf, value);
+  out.append(reinterpret_cast<const char*>(buf), sizeof(buf));
+}
+
+inline void warm_write(std::string & out, double value)
+{
+  std::uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  warm_write(out, bits);
+}
+
+inline void warm_write_str(std::string & out, core::string_view value)
+{
+  warm_write<std::uint32_t>(out, static_cast<std::uint32_t>(value.size()));
+  out.append(value.data(), value.size());
+}
+
+template<typename Int>
+inline bool warm_read(core::string_view & data, Int & value)
+{
+  if (data.size() < sizeof(Int))
+    return false;
+  value = endian::endian_load<Int, sizeof(Int), endian::order::little>(
+      reinterpret_cast<const unsigned char*>(data.data()));
+  data.remove_prefix(sizeof(Int));
+  return true;
+}
+
+inline bool warm_read(core::string_view & data, double & value)
+{
+  std::uint64_t bits;
+  if (!warm_read(data, bits))
+    return false;
+  std::memcpy(&value, &bits, sizeof(bits));
+  return true;
+}
+
+inline bool warm_read_str(core::string_view & data, core::string_view & value)
+{
+  std::uint32_t len;
+  if (!warm_read(data, len) || data.size() < len)
+    return false;
+  value = data.substr(0u, len);
+  data.remove_prefix(len);
+  return true;
+}
+
+}
+
 
 template<typename Executor>
 auto basic_session<Executor>::make_request_(http::fields fields) -> requests::request_settings
@@ -22,10 +85,230 @@ auto basic_session<Executor>::make_request_(http::fields fields) -> requests::re
   return requests::request_settings{
     std::move(fields),
     options_,
-    &jar_
+    jar_ptr_
   };
 }
 
+template<typename Executor>
+std::string basic_session<Executor>::save_state()
+{
+  // snapshot layout:
+  //   "BRWS" u32-version i64-saved-at (seconds since epoch)
+  //   u32 dns-count, per entry: str key, str host-name, i64 remaining
+  //     seconds, u32 endpoint-count, per endpoint: str address, u16 port
+  //   u32 origin-count, per origin: u8 https-flag, str host, u16 port,
+  //     u32 score-count, per score: str address, u16 port, f64 connect-ms,
+  //     f64 failure; u32 ticket-count, per ticket: str sni-host, str der
+  // where `str` is u32 length + bytes, see detail::warm_write_str.
+  std::string res;
+  res.append("BRWS", 4);
+  detail::warm_write<std::uint32_t>(res, 1u);
+  using std::chrono::duration_cast;
+  using std::chrono::seconds;
+  detail::warm_write<std::int64_t>(
+      res, duration_cast<seconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+  const auto dns = dns_cache_ptr_->snapshot();
+  detail::warm_write<std::uint32_t>(res, static_cast<std::uint32_t>(dns.size()));
+  for (const auto & e : dns)
+  {
+    detail::warm_write_str(res, e.key);
+    detail::warm_write_str(res, e.data.host_name);
+    detail::warm_write<std::int64_t>(res, e.remaining.count());
+    detail::warm_write<std::uint32_t>(res, static_cast<std::uint32_t>(e.data.endpoints.size()));
+    for (const auto & ep : e.data.endpoints)
+    {
+      detail::warm_write_str(res, ep.address().to_string());
+      detail::warm_write<std::uint16_t>(res, ep.port());
+    }
+  }
+
+  // one blob per origin, so the count can go in front of them. A pool
+  // behind a proxy dials the proxy, not the origin - nothing to keep.
+  std::vector<std::string> origins;
+  boost::unordered_set<std::string> seen;
+  const auto add_origin = [&](bool is_https, core::string_view host, std::uint16_t port,
+                              const std::vector<std::tuple<asio::ip::tcp::endpoint, double, double>> & scores,
+                              const std::vector<std::pair<std::string, std::string>> & tickets)
+  {
+    if (scores.empty() && tickets.empty())
+      return;
+    std::string blob;
+    detail::warm_write<std::uint8_t>(blob, is_https ? 1u : 0u);
+    detail::warm_write_str(blob, host);
+    detail::warm_write<std::uint16_t>(blob, port);
+    detail::warm_write<std::uint32_t>(blob, static_cast<std::uint32_t>(scores.size()));
+    for (const auto & sc : scores)
+    {
+      detail::warm_write_str(blob, std::get<0>(sc).address().to_string());
+      detail::warm_write<std::uint16_t>(blob, std::get<0>(sc).port());
+      detail::warm_write(blob, std::get<1>(sc));
+      detail::warm_write(blob, std::get<2>(sc));
+    }
+    detail::warm_write<std::uint32_t>(blob, static_cast<std::uint32_t>(tickets.size()));
+    for (const auto & tk : tickets)
+    {
+      detail::warm_write_str(blob, tk.first);
+      detail::warm_write_str(blob, tk.second);
+    }
+    origins.push_back(std::move(blob));
+  };
+
+  const auto pools = std::atomic_load(&pools_);
+  for (const auto & p : pools->http)
+  {
+    if (!std::get<2>(p.first).empty())
+      continue;
+    const core::string_view host{std::get<0>(p.first).data(), std::get<0>(p.first).size()};
+    seen.insert(warm_key_(false, host, std::get<1>(p.first)));
+    add_origin(false, host, std::get<1>(p.first), p.second->endpoint_quality(), {});
+  }
+  for (const auto & p : pools->https)
+  {
+    if (!std::get<2>(p.first).empty())
+      continue;
+    const core::string_view host{std::get<0>(p.first).data(), std::get<0>(p.first).size()};
+    seen.insert(warm_key_(true, host, std::get<1>(p.first)));
+    // a shared ticket cache (use_tls_sessions) holds every origin's
+    // sessions; only this pool's belong in its blob
+    auto tickets = p.second->ssl_sessions().export_sessions();
+    tickets.erase(std::remove_if(tickets.begin(), tickets.end(),
+                                 [&](const std::pair<std::string, std::string> & tk)
+                                 { return tk.first != host; }),
+                  tickets.end());
+    add_origin(true, host, std::get<1>(p.first),
+               p.second->endpoint_quality(), tickets);
+  }
+
+  // restored state still parked for a pool that never got created again
+  // rides along, so back-to-back restarts don't shed it.
+  {
+    std::lock_guard<std::mutex> lock{warm_mtx_};
+    for (const auto & w : warm_origins_)
+    {
+      if (seen.count(w.first) != 0u)
+        continue;
+      const bool is_https = w.first.compare(0u, 6u, "https:") == 0;
+      const auto rest = core::string_view(w.first).substr(is_https ? 6u : 5u);
+      const auto colon = rest.rfind(':');
+      std::vector<std::tuple<asio::ip::tcp::endpoint, double, double>> scores;
+      scores.reserve(w.second.scores.size());
+      for (const auto & sc : w.second.scores)
+      {
+        system::error_code aec;
+        const auto addr = asio::ip::make_address(sc.address, aec);
+        if (!aec)
+          scores.emplace_back(asio::ip::tcp::endpoint(addr, sc.port), sc.connect_ms, sc.failure);
+      }
+      add_origin(is_https, rest.substr(0u, colon),
+                 static_cast<std::uint16_t>(std::atoi(rest.substr(colon + 1u).data())),
+                 scores, w.second.tickets);
+    }
+  }
+
+  detail::warm_write<std::uint32_t>(res, static_cast<std::uint32_t>(origins.size()));
+  for (const auto & blob : origins)
+    res += blob;
+  return res;
+}
+
+template<typename Executor>
+bool basic_session<Executor>::restore_state(core::string_view data)
+{
+  if (data.size() < 4u || data.substr(0u, 4u) != "BRWS")
+    return false;
+  data.remove_prefix(4u);
+
+  std::uint32_t version;
+  if (!detail::warm_read(data, version) || version != 1u)
+    return false;
+
+  using std::chrono::duration_cast;
+  using std::chrono::seconds;
+  std::int64_t saved_at;
+  if (!detail::warm_read(data, saved_at))
+    return false;
+  // the wall time the snapshot spent on disk; a clock that jumped
+  // backwards since just counts as no time passed.
+  const auto age = (std::max<std::int64_t>)(
+      0, duration_cast<seconds>(std::chrono::system_clock::now().time_since_epoch()).count() - saved_at);
+
+  std::uint32_t dns_count;
+  if (!detail::warm_read(data, dns_count))
+    return false;
+  for (std::uint32_t i = 0u; i < dns_count; i++)
+  {
+    core::string_view key, host_name;
+    std::int64_t remaining;
+    std::uint32_t ep_count;
+    if (!detail::warm_read_str(data, key) || !detail::warm_read_str(data, host_name) ||
+        !detail::warm_read(data, remaining) || !detail::warm_read(data, ep_count))
+      return false;
+    resolver_cache::entry e;
+    e.host_name.assign(host_name.begin(), host_name.end());
+    for (std::uint32_t j = 0u; j < ep_count; j++)
+    {
+      core::string_view address;
+      std::uint16_t port;
+      if (!detail::warm_read_str(data, address) || !detail::warm_read(data, port))
+        return false;
+      system::error_code aec;
+      const auto addr = asio::ip::make_address(std::string(address), aec);
+      if (!aec)
+        e.endpoints.emplace_back(addr, port);
+    }
+    // the lifetime keeps running while the snapshot sits on disk
+    if (!e.endpoints.empty())
+      dns_cache_ptr_->restore(key, std::move(e), seconds(remaining - age));
+  }
+
+  const bool keep_scores = age <= BOOST_REQUESTS_WARM_SCORE_MAX_AGE;
+  std::uint32_t origin_count;
+  if (!detail::warm_read(data, origin_count))
+    return false;
+  for (std::uint32_t i = 0u; i < origin_count; i++)
+  {
+    std::uint8_t is_https;
+    core::string_view host;
+    std::uint16_t port;
+    std::uint32_t score_count;
+    if (!detail::warm_read(data, is_https) || !detail::warm_read_str(data, host) ||
+        !detail::warm_read(data, port) || !detail::warm_read(data, score_count))
+      return false;
+    warm_origin_ w;
+    for (std::uint32_t j = 0u; j < score_count; j++)
+    {
+      typename warm_origin_::score_ sc;
+      core::string_view address;
+      if (!detail::warm_read_str(data, address) || !detail::warm_read(data, sc.port) ||
+          !detail::warm_read(data, sc.connect_ms) || !detail::warm_read(data, sc.failure))
+        return false;
+      sc.address.assign(address.begin(), address.end());
+      if (keep_scores)
+        w.scores.push_back(std::move(sc));
+    }
+    std::uint32_t ticket_count;
+    if (!detail::warm_read(data, ticket_count))
+      return false;
+    for (std::uint32_t j = 0u; j < ticket_count; j++)
+    {
+      core::string_view sni, der;
+      if (!detail::warm_read_str(data, sni) || !detail::warm_read_str(data, der))
+        return false;
+      // tickets only matter where there is a handshake to resume; their
+      // expiry is checked when the pool imports them.
+      if (is_https != 0u)
+        w.tickets.emplace_back(std::string(sni), std::string(der));
+    }
+    if (w.scores.empty() && w.tickets.empty())
+      continue;
+    std::lock_guard<std::mutex> lock{warm_mtx_};
+    warm_origins_[warm_key_(is_https != 0u, host, port)] = std::move(w);
+    has_warm_origins_.store(true, std::memory_order_relaxed);
+  }
+  return true;
+}
+
 
 template<typename Executor>
 auto
@@ -36,43 +319,137 @@ basic_session<Executor>::get_pool(urls::url_view url, error_code & ec) -> pool_p
   container::pmr::monotonic_buffer_resource res{buf, sizeof(buf)};
   using alloc = container::pmr::polymorphic_allocator<char>;
   using str = std::basic_string<char, std::char_traits<char>, alloc>;
-  std::pair<str, unsigned short> host_key{alloc(&res), get_port(url)};
-  url.host(urls::string_token::assign_to(host_key.first));
+  host_ host_key{str(alloc(&res)), get_port(url), str(alloc(&res))};
+  const bool is_unix = url.scheme() == "unix";
+  if (is_unix) // the socket path takes the place of the host in the key
+    url.path(urls::string_token::assign_to(std::get<0>(host_key)));
+  else
+    url.host(urls::string_token::assign_to(std::get<0>(host_key)));
+  {
+    const auto pa = proxy_.encoded_authority();
+    std::get<2>(host_key).assign(pa.begin(), pa.end());
+  }
 
   const auto is_https = (url.scheme_id() == urls::scheme::https)
                      || (url.scheme_id() == urls::scheme::wss);
+
+  // the alternative service this origin should be reached through, if one
+  // is on file (see set_alt_svc); a pool dialed for another (or a lapsed)
+  // alternative no longer matches and gets rebuilt below.
+  std::string alt;
+  if (is_https)
+    alt = alt_svc_for(url.encoded_host_and_port());
+
+  // fast path: the snapshot is immutable, so an existing pool is found
+  // without touching the session mutex.
+  auto pools = std::atomic_load(&pools_);
+  if (is_unix)
+  {
+    auto itr = pools->local.find(host_key);
+    if (itr != pools->local.end())
+      return itr->second;
+  }
+  else if (is_https)
+  {
+    auto itr = pools->https.find(host_key);
+    if (itr != pools->https.end() && itr->second->alt_svc() == alt)
+      return itr->second;
+  }
+  else
+  {
+    auto itr = pools->http.find(host_key);
+    if (itr != pools->http.end())
+      return itr->second;
+  }
+
   auto lock = asem::lock(mutex_, ec);
   if (ec)
     return std::shared_ptr<basic_http_connection_pool<Executor>>();
 
-  if (is_https)
+  // re-check under the lock - someone may have published the pool meanwhile
+  pools = std::atomic_load(&pools_);
+  if (is_unix)
+  {
+    auto itr = pools->local.find(host_key);
+    if (itr != pools->local.end())
+      return itr->second;
+    // nothing to resolve: the pool is ready as soon as it knows the path
+    auto p = std::make_shared<basic_unix_connection_pool<Executor>>(get_executor());
+    p->set_trace_hook(trace_hook_);
+    p->set_conn_budget(&conn_budget_);
+    p->set_endpoint(typename basic_unix_connection_pool<Executor>::endpoint_type(url.path()));
+    auto next = std::make_shared<pool_table_>(*pools);
+    next->local.emplace(host_key, p);
+    publish_pools_(std::move(next));
+    return p;
+  }
+  else if (is_https)
   {
-    auto itr = https_pools_.find(host_key);
-    if (itr != https_pools_.end())
+    auto itr = pools->https.find(host_key);
+    if (itr != pools->https.end() && itr->second->alt_svc() == alt)
       return itr->second;
     else
     {
       auto p = std::make_shared<basic_https_connection_pool<Executor>>(get_executor(), sslctx_);
+      p->set_dns_cache(dns_cache_ptr_);
+      if (shared_tls_ != nullptr)
+        p->share_ssl_sessions(shared_tls_);
+      p->set_trace_hook(trace_hook_);
+      p->set_conn_budget(&conn_budget_);
+      if (!proxy_.empty())
+        p->set_proxy(proxy_.authority());
+      if (!alt.empty())
+        p->set_alt_svc(urls::parse_authority(alt).value());
       p->lookup(url.authority(), ec);
+      if (ec && !alt.empty())
+      {
+        // an alternative that does not resolve is dropped again and the
+        // origin dialed directly, on a fresh pool - the failed one is
+        // half set up.
+        set_alt_svc(url.encoded_host_and_port(), "");
+        alt.clear();
+        ec.clear();
+        p = std::make_shared<basic_https_connection_pool<Executor>>(get_executor(), sslctx_);
+        p->set_dns_cache(dns_cache_ptr_);
+        if (shared_tls_ != nullptr)
+          p->share_ssl_sessions(shared_tls_);
+        p->set_trace_hook(trace_hook_);
+        p->set_conn_budget(&conn_budget_);
+        if (!proxy_.empty())
+          p->set_proxy(proxy_.authority());
+        p->lookup(url.authority(), ec);
+      }
       if (!ec)
       {
-        https_pools_.emplace(host_key, p);
+        warm_pool_(*p, host_key, true);
+        auto next = std::make_shared<pool_table_>(*pools);
+        next->https.erase(host_key); // may hold a pool built for a stale alternative
+        next->https.emplace(host_key, p);
+        publish_pools_(std::move(next));
         return p;
       }
     }
   }
   else
   {
-    auto itr = http_pools_.find(host_key);
-    if (itr != http_pools_.end())
+    auto itr = pools->http.find(host_key);
+    if (itr != pools->http.end())
       return itr->second;
     else
     {
       auto p = std::make_shared<basic_http_connection_pool<Executor>>(get_executor());
+      p->set_dns_cache(dns_cache_ptr_);
+      p->set_trace_hook(trace_hook_);
+      p->set_conn_budget(&conn_budget_);
+      if (!proxy_.empty())
+        p->set_proxy(proxy_.authority());
       p->lookup(url.authority(), ec);
       if (!ec)
       {
-        http_pools_.emplace(host_key, p);
+        warm_pool_(*p, host_key, false);
+        auto next = std::make_shared<pool_table_>(*pools);
+        next->http.emplace(host_key, p);
+        publish_pools_(std::move(next));
         return p;
       }
     }
@@ -95,19 +472,32 @@ struct basic_session<Executor>::async_get_pool_op : asio::coroutine
     container::pmr::monotonic_buffer_resource res{buf, sizeof(buf)};
     using alloc = container::pmr::polymorphic_allocator<char>;
     using str = std::basic_string<char, std::char_traits<char>, alloc>;
-    std::pair<str, unsigned short> host_key;
+    host_ host_key;
     const bool is_https;
+    const bool is_unix;
+    // the alternative service on file for the origin, see the sync get_pool
+    std::string alt;
 
-    impl_t(urls::url_view url)
-        : host_key{alloc(&res), get_port(url)}
+    impl_t(basic_session<Executor> * sess, urls::url_view url, urls::url_view proxy)
+        : host_key{str(alloc(&res)), get_port(url), str(alloc(&res))}
         , is_https((url.scheme_id() == urls::scheme::https) || (url.scheme_id() == urls::scheme::wss))
-
+        , is_unix(url.scheme() == "unix")
     {
-      url.host(urls::string_token::assign_to(host_key.first));
+      if (is_unix) // the socket path takes the place of the host in the key
+        url.path(urls::string_token::assign_to(std::get<0>(host_key)));
+      else
+        url.host(urls::string_token::assign_to(std::get<0>(host_key)));
+      const auto pa = proxy.encoded_authority();
+      std::get<2>(host_key).assign(pa.begin(), pa.end());
+      if (is_https)
+        alt = sess->alt_svc_for(url.encoded_host_and_port());
     }
   };
 
   urls::url_view url;
+  // prepared handle to resolve through & refill, see basic_endpoint_ref
+  basic_endpoint_ref<Executor> * ep = nullptr;
+  std::uint64_t epoch_ = 0u;
   std::shared_ptr<impl_t> impl;
 
   template<typename Self>
@@ -116,6 +506,8 @@ struct basic_session<Executor>::async_get_pool_op : asio::coroutine
                 pool_ptr pp,
                 asem::lock_guard<detail::basic_mutex<executor_type>> &lock)
   {
+    if (ep != nullptr && !ec)
+      this_->cache_endpoint_(*ep, pp, epoch_);
     impl = {};
     lock = {};
     self.complete(ec, std::move(pp));
@@ -123,6 +515,40 @@ struct basic_session<Executor>::async_get_pool_op : asio::coroutine
 
   std::shared_ptr<basic_http_connection_pool <Executor>> p;
   std::shared_ptr<basic_https_connection_pool<Executor>> ps;
+  std::shared_ptr<basic_unix_connection_pool <Executor>> pl;
+  pool_ptr hit;
+
+  bool find_(const std::shared_ptr<const pool_table_> & pools)
+  {
+    if (impl->is_unix)
+    {
+      auto itr = pools->local.find(impl->host_key);
+      if (itr != pools->local.end())
+      {
+        hit = itr->second;
+        return true;
+      }
+    }
+    else if (impl->is_https)
+    {
+      auto itr = pools->https.find(impl->host_key);
+      if (itr != pools->https.end() && itr->second->alt_svc() == impl->alt)
+      {
+        hit = itr->second;
+        return true;
+      }
+    }
+    else
+    {
+      auto itr = pools->http.find(impl->host_key);
+      if (itr != pools->http.end())
+      {
+        hit = itr->second;
+        return true;
+      }
+    }
+    return false;
+  }
 
   template<typename Self>
   void operator()(Self && self, error_code ec = {},
@@ -130,38 +556,110 @@ struct basic_session<Executor>::async_get_pool_op : asio::coroutine
   {
     reenter(this)
     {
-      impl = std::allocate_shared<impl_t>(self.get_allocator(), url);
+      // fastest path: a current prepared handle resolves without building
+      // the key or walking the table at all.
+      if (ep != nullptr)
+      {
+        epoch_ = this_->pools_epoch_.load(std::memory_order_acquire);
+        if (this_->pool_from_(*ep, hit))
+        {
+          yield asio::post(this_->get_executor(), std::move(self));
+          return complete(std::move(self), {}, std::move(hit), lock);
+        }
+      }
+
+      impl = std::allocate_shared<impl_t>(self.get_allocator(), this_, url, this_->proxy_);
+
+      // fast path: an existing pool is found in the snapshot without
+      // ever queueing on the session mutex.
+      if (find_(std::atomic_load(&this_->pools_)))
+      {
+        yield asio::post(this_->get_executor(), std::move(self));
+        return complete(std::move(self), {}, std::move(hit), lock);
+      }
+
       yield asem::async_lock(this_->mutex_, std::move(self));
       if (ec)
         return complete(std::move(self), ec, {}, lock);
 
-      if (impl->is_https)
+      // re-check under the lock - someone may have published it meanwhile
+      if (find_(std::atomic_load(&this_->pools_)))
+        return complete(std::move(self), {}, std::move(hit), lock);
+
+      if (impl->is_unix)
       {
+        // nothing to resolve: the pool is ready as soon as it knows the path
+        pl = std::make_shared<basic_unix_connection_pool<Executor>>(this_->get_executor());
+        pl->set_trace_hook(this_->trace_hook_);
+        pl->set_conn_budget(&this_->conn_budget_);
+        pl->set_endpoint(typename basic_unix_connection_pool<Executor>::endpoint_type(url.path()));
         {
-          auto itr = this_->https_pools_.find(impl->host_key);
-          if (itr != this_->https_pools_.end())
-            return complete(std::move(self), {}, itr->second, lock);
+          auto next = std::make_shared<pool_table_>(*std::atomic_load(&this_->pools_));
+          next->local.emplace(impl->host_key, pl);
+          this_->publish_pools_(std::move(next));
         }
+        return complete(std::move(self), {}, std::move(pl), lock);
+      }
+      else if (impl->is_https)
+      {
         ps = std::make_shared<basic_https_connection_pool<Executor>>(this_->get_executor(), this_->sslctx_);
+        ps->set_dns_cache(this_->dns_cache_ptr_);
+        if (this_->shared_tls_ != nullptr)
+          ps->share_ssl_sessions(this_->shared_tls_);
+        ps->set_trace_hook(this_->trace_hook_);
+        ps->set_conn_budget(&this_->conn_budget_);
+        if (!this_->proxy_.empty())
+          ps->set_proxy(this_->proxy_.authority());
+        if (!impl->alt.empty())
+          ps->set_alt_svc(urls::parse_authority(impl->alt).value());
         yield ps->async_lookup(url.authority(), asio::append(std::move(self), std::move(lock)));
+        if (ec && !impl->alt.empty())
+        {
+          // an alternative that does not resolve is dropped again and the
+          // origin dialed directly, on a fresh pool - the failed one is
+          // half set up.
+          this_->set_alt_svc(url.encoded_host_and_port(), "");
+          impl->alt.clear();
+          ec.clear();
+          ps = std::make_shared<basic_https_connection_pool<Executor>>(this_->get_executor(), this_->sslctx_);
+          ps->set_dns_cache(this_->dns_cache_ptr_);
+          if (this_->shared_tls_ != nullptr)
+            ps->share_ssl_sessions(this_->shared_tls_);
+          ps->set_trace_hook(this_->trace_hook_);
+          ps->set_conn_budget(&this_->conn_budget_);
+          if (!this_->proxy_.empty())
+            ps->set_proxy(this_->proxy_.authority());
+          yield ps->async_lookup(url.authority(), asio::append(std::move(self), std::move(lock)));
+        }
         if (!ec)
         {
-          this_->https_pools_.emplace(impl->host_key, ps);
+          {
+            this_->warm_pool_(*ps, impl->host_key, true);
+            auto next = std::make_shared<pool_table_>(*std::atomic_load(&this_->pools_));
+            next->https.erase(impl->host_key); // may hold a pool built for a stale alternative
+            next->https.emplace(impl->host_key, ps);
+            this_->publish_pools_(std::move(next));
+          }
           return complete(std::move(self), {}, std::move(ps), lock);
         }
       }
       else
       {
-        {
-          auto itr = this_->http_pools_.find(impl->host_key);
-          if (itr != this_->http_pools_.end())
-            return complete(std::move(self), {}, itr->second, lock);
-        }
         p = std::make_shared<basic_http_connection_pool<Executor>>(this_->get_executor());
+        p->set_dns_cache(this_->dns_cache_ptr_);
+        p->set_trace_hook(this_->trace_hook_);
+        p->set_conn_budget(&this_->conn_budget_);
+        if (!this_->proxy_.empty())
+          p->set_proxy(this_->proxy_.authority());
         yield p->async_lookup(url.authority(), asio::append(std::move(self), std::move(lock)));
         if (!ec)
         {
-          this_->http_pools_.emplace(impl->host_key, p);
+          {
+            this_->warm_pool_(*p, impl->host_key, false);
+            auto next = std::make_shared<pool_table_>(*std::atomic_load(&this_->pools_));
+            next->http.emplace(impl->host_key, p);
+            this_->publish_pools_(std::move(next));
+          }
           return complete(std::move(self), {}, std::move(p), lock);
         }
       }
@@ -185,33 +683,171 @@ basic_session<Executor>::async_get_pool(urls::url_view url,
   );
 }
 
+template<typename Executor>
+template< BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, pool_ptr)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code, pool_ptr))
+basic_session<Executor>::async_get_pool(basic_endpoint_ref<Executor> & ep,
+                                        CompletionToken && completion_token)
+{
+  return asio::async_compose<CompletionToken, void(system::error_code, pool_ptr)>(
+      async_get_pool_op{{}, this, ep.url(), &ep},
+      completion_token,
+      mutex_
+  );
+}
+
+template<typename Executor>
+struct basic_session<Executor>::async_prewarm_op : asio::coroutine
+{
+  using executor_type = Executor;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  basic_session<Executor> *this_;
+  urls::url_view url;
+  std::size_t n;
+
+  template<typename Self>
+  void operator()(Self && self, error_code ec = {}, pool_ptr pool = {})
+  {
+    reenter(this)
+    {
+      yield this_->async_get_pool(url, std::move(self));
+      if (!ec && variant2::visit([](const auto & p) {return p == nullptr;}, pool))
+        BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_found);
+      if (ec)
+        return self.complete(ec);
+
+      yield variant2::visit(
+          [&](auto & p)
+          {
+            p->async_prewarm(n, std::move(self));
+          }, pool);
+      return self.complete(ec);
+    }
+  }
+};
+
+template<typename Executor>
+template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code))
+basic_session<Executor>::async_prewarm(urls::url_view url, std::size_t n,
+                                       CompletionToken && completion_token)
+{
+  return asio::async_compose<CompletionToken, void(system::error_code)>(
+      async_prewarm_op{{}, this, url, n},
+      completion_token,
+      mutex_
+  );
+}
+
+template<typename Executor>
+struct basic_session<Executor>::async_drain_op : asio::coroutine
+{
+  using executor_type = Executor;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  basic_session<Executor> *this_;
+  std::chrono::steady_clock::time_point deadline;
+  optional<asio::steady_timer> timer;
+  std::size_t busy{0u};
+
+  template<typename Self>
+  void operator()(Self && self, error_code ec = {})
+  {
+    reenter(this)
+    {
+      this_->draining_.store(true, std::memory_order_relaxed);
+      yield asio::post(this_->get_executor(), std::move(self));
+
+      // going idle has no single wake-up point - requests finish inside
+      // their pools - so the drain sweeps: close what is idle, then sleep
+      // a beat while the rest runs out.
+      for (;;)
+      {
+        busy = this_->close_idle_();
+        if (busy == 0u || std::chrono::steady_clock::now() >= deadline)
+          break;
+        if (!timer)
+          timer.emplace(get_executor());
+        timer->expires_at((std::min)(deadline,
+                                     std::chrono::steady_clock::now() + std::chrono::milliseconds(50)));
+        yield timer->async_wait(std::move(self));
+        if (ec)
+          return self.complete(ec);
+      }
+      this_->shutdown();
+      if (busy > 0u)
+      {
+        static constexpr auto loc((BOOST_CURRENT_LOCATION));
+        BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::timed_out);
+      }
+      return self.complete(ec);
+    }
+  }
+};
+
+template<typename Executor>
+template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code))
+basic_session<Executor>::async_drain(std::chrono::steady_clock::duration timeout,
+                                     CompletionToken && completion_token)
+{
+  return asio::async_compose<CompletionToken, void(system::error_code)>(
+      async_drain_op{{}, this, std::chrono::steady_clock::now() + timeout},
+      completion_token,
+      mutex_
+  );
+}
+
 template<typename Executor>
 template<typename Body>
-auto basic_session<Executor>::ropen(
+auto basic_session<Executor>::ropen_(
            urls::url_view url,
            http::request<Body>& req,
+           basic_endpoint_ref<Executor> * ep,
            system::error_code & ec) -> stream
 {
-  auto opts = options_;
+  if (draining_.load(std::memory_order_relaxed))
+  {
+    static constexpr auto loc((BOOST_CURRENT_LOCATION));
+    BOOST_REQUESTS_ASSIGN_EC(ec, error::session_draining);
+    return stream{get_executor(), nullptr};
+  }
+
+  auto opts = options_for(url.encoded_host_and_port());
 
   response_base::history_type history{req.get_allocator()};
 
   if (!url.encoded_target().empty() && req.target().empty())
     req.target(url.encoded_resource());
 
+  std::shared_ptr<void> budget_slot;
+
   auto do_ropen =
       [&](http::request<Body> & req, request_options opts) -> stream
       {
-        auto p = get_pool(url, ec);
+        // pool acquisition includes the DNS lookup on a cold host; a
+        // current prepared handle resolves it without the table walk
+        if (opts.timings)
+          opts.timings->resolve_start = timing::clock_type::now();
+        auto p = ep != nullptr ? get_pool(*ep, ec) : get_pool(url, ec);
+        if (opts.timings)
+          opts.timings->resolve_done = timing::clock_type::now();
         if (ec)
           return stream{get_executor(), nullptr};
 
-        return visit(
+        auto str = visit(
             [&](auto pool) -> stream
             {
               assert(pool);
-              return pool->ropen( req, opts, &jar_, ec);
+              return pool->ropen( req, opts, jar_ptr_, ec);
             }, p);
+        // every hop of a redirect chain shares the slot; it frees with the
+        // last live reference.
+        str.budget_slot_ = budget_slot;
+        if (!ec)
+          record_alt_svc_(url, str.headers());
+        return str;
       };
 
   const auto is_secure = (url.scheme_id() == urls::scheme::https)
@@ -226,22 +862,99 @@ auto basic_session<Executor>::ropen(
     return stream{get_executor(), nullptr};
   }
 
+  // serialized straight out of the request's header allocator, see
+  // cookie_jar::append_to
+  jar_ptr_->append_to(req, host, is_secure, url.encoded_path());
+
+  req.prepare_payload();
+
+  bool revalidate = false;
+  if (cache_ != nullptr && detail::cache_usable(req))
+  {
+    auto hit = cache_->match(get_executor(), url);
+    if (hit)
+      return std::move(*hit);
+
+    // an expired entry with validators turns the refetch into a
+    // conditional request; a 304 below gets answered from the store.
+    std::string etag, last_modified;
+    if (cache_->validators_for(url.buffer(), etag, last_modified))
+    {
+      if (!etag.empty() && req.count(http::field::if_none_match) == 0u)
+      {
+        req.set(http::field::if_none_match, etag);
+        revalidate = true;
+      }
+      if (!last_modified.empty() && req.count(http::field::if_modified_since) == 0u)
+      {
+        req.set(http::field::if_modified_since, last_modified);
+        revalidate = true;
+      }
+    }
+  }
+
+  // Coalesce with identical in-flight GETs, see use_single_flight: the
+  // claimant dials out, everyone else parks here and replays the fanned
+  // out response.
+  std::shared_ptr<sf_flight_> flight;
+  std::string sf_key;
+  if (use_single_flight_ && detail::cache_usable(req))
   {
-    detail::monotonic_token mv;
-    auto cc = jar_.get(host, is_secure, url.encoded_path(), mv);
-    if (!cc.empty())
-      req.set(http::field::cookie, cc);
+    sf_key = sf_key_(url, req.base());
+    std::unique_lock<std::mutex> lock{sf_mtx_};
+    auto & slot = sf_flights_[sf_key];
+    if (slot == nullptr)
+      slot = flight = std::make_shared<sf_flight_>();
+    else
+    {
+      auto f = slot;
+      f->cv.wait(lock, [&] { return f->done; });
+      if (f->ec)
+      {
+        ec = f->ec;
+        return stream{get_executor(), nullptr};
+      }
+      if (!f->payload.empty())
+      {
+        auto payload = f->payload;
+        auto fhost = f->host;
+        lock.unlock();
+        return sf_replay_(std::move(payload), std::move(fhost));
+      }
+      // the flight ended without a replayable body - dial out ourselves
+    }
   }
 
-  req.prepare_payload();
+  // session-wide admission, see set_concurrency_limit. This path cannot
+  // park, so over-budget requests shed right away.
+  if (max_inflight_ > 0u)
+  {
+    if (!budget_.try_acquire())
+    {
+      BOOST_REQUESTS_ASSIGN_EC(ec, error::session_overloaded);
+      return sf_finish_(flight, sf_key, stream{get_executor(), nullptr}, ec);
+    }
+    budget_slot = make_budget_slot_();
+  }
 
   auto str = do_ropen(req, opts);
+  ep = nullptr; // redirect hops go through the regular lookup
 
   if (!ec) // all good
-    return str;
+  {
+    if (revalidate && str.headers().result() == http::status::not_modified)
+    {
+      auto entry = cache_->revalidated(get_executor(), url, str.headers());
+      if (entry)
+        return sf_finish_(flight, sf_key, std::move(*entry), ec);
+    }
+    if (cache_ != nullptr && detail::cache_usable(req) && cache_->capturable(str))
+      return sf_finish_(flight, sf_key, cache_->fill(get_executor(), url, std::move(str), ec), ec);
+    return sf_finish_(flight, sf_key, std::move(str), ec);
+  }
 
   if (opts.max_redirects == str.history().size())
-    return str;
+    return sf_finish_(flight, sf_key, std::move(str), ec);
 
   urls::url url_cache;
   while (ec == error::forbidden_redirect)
@@ -281,7 +994,7 @@ auto basic_session<Executor>::ropen(
       break;
     }
 
-    if (!should_redirect(options_.redirect, url, *nurl))
+    if (!should_redirect(opts.redirect, url, *nurl))
     {
       BOOST_REQUESTS_ASSIGN_EC(ec, error::forbidden_redirect);
       break ;
@@ -297,28 +1010,28 @@ auto basic_session<Executor>::ropen(
     }
 
     req.base().target(url.encoded_resource());
-    {
-      detail::monotonic_token mv;
-      auto cc = jar_.get(host, is_secure, url.encoded_path(), mv);
-      if (!cc.empty())
-        req.base().set(http::field::cookie, cc);
-    }
+    jar_ptr_->append_to(req.base(), host, is_secure, url.encoded_path());
     history.insert(history.end(),
                    std::make_move_iterator(std::move(str).history().begin()),
                    std::make_move_iterator(std::move(str).history().end()));
     str = do_ropen(req, opts);
   }
   str.prepend_history(std::move(history));
-  return str;
+  if (!ec) // failed chains keep the hops' headers for diagnosis
+    str.trim_history(opts.history, opts.max_history);
+  if (!ec && cache_ != nullptr && detail::cache_usable(req) && cache_->capturable(str))
+    return sf_finish_(flight, sf_key, cache_->fill(get_executor(), url, std::move(str), ec), ec);
+  return sf_finish_(flight, sf_key, std::move(str), ec);
 }
 
 template<typename Executor>
 template<typename RequestBody>
-auto basic_session<Executor>::ropen(
+auto basic_session<Executor>::ropen_(
     beast::http::verb method,
     urls::url_view url,
     RequestBody && body,
     http::fields fields,
+    basic_endpoint_ref<Executor> * ep,
     system::error_code & ec) -> stream
 {
   const auto is_secure = (url.scheme_id() == urls::scheme::https)
@@ -326,7 +1039,7 @@ auto basic_session<Executor>::ropen(
 
   auto host = url.encoded_host();
 
-  if (!is_secure && options_.enforce_tls)
+  if (!is_secure && options_for(url.encoded_host_and_port()).enforce_tls)
   {
     static constexpr auto loc((BOOST_CURRENT_LOCATION));
     BOOST_REQUESTS_ASSIGN_EC(ec, error::insecure);
@@ -344,16 +1057,258 @@ auto basic_session<Executor>::ropen(
         fields.set(http::field::content_type, nm);
   }
 
+  {
+    const auto enc = body_content_encoding<body_traits>(body);
+    if (!enc.empty() && fields.count(http::field::content_encoding) == 0u)
+      fields.set(http::field::content_encoding, enc);
+  }
+
   auto bd = body_traits::make_body(std::forward<RequestBody>(body), ec);
   if (ec)
     return stream{get_executor(), nullptr};
 
+  // with the arena enabled the headers get rebuilt inside it, and parser,
+  // response buffer & history follow the request's allocator downstream.
+  detail::arena_anchor anchor;
+  container::pmr::memory_resource * res = fields.get_allocator().resource();
+  if (use_arena_)
+  {
+    anchor = detail::arena_anchor(arena_pool_.acquire());
+    res = anchor.resource();
+  }
+  http::fields afields{container::pmr::polymorphic_allocator<char>(res)};
+  afields = std::move(fields); // steals when the resource is unchanged, copies into the arena otherwise
 
   beast::http::request<body_type, http::fields> hreq{method, url.encoded_resource(), 11,
                                                      std::move(bd),
-                                                     std::move(fields)};
+                                                     std::move(afields)};
+
+  return ropen_(url, hreq, ep, ec);
+}
+
+namespace detail
+{
+
+// Hedged acquisition, see request_options::hedge_after: the winning stream
+// resumes the session's ropen coroutine, the straggler gets drained in the
+// background so its connection returns to the pool in a reusable state.
+// Heap state with copyable handler facades, the same shape as the ranged
+// download machinery - pool ops capture object addresses, so the state must
+// not move. The two attempts complete on whatever threads run the pool, so
+// the join state is guarded by a plain mutex, the shape of the pool's batch
+// machinery; the token is always invoked outside the lock.
+template<typename Executor, typename Token, typename Body>
+struct hedged_ropen_state
+{
+  using stream_type = basic_stream<Executor>;
+
+  asio::basic_waitable_timer<std::chrono::steady_clock,
+                             asio::wait_traits<std::chrono::steady_clock>,
+                             Executor> timer;
+  // the connection op stores the request by reference and mutates it over
+  // the whole exchange (host, cookies, redirects), so each attempt runs
+  // against its own copy owned here
+  beast::http::request<Body, http::fields> reqs[2];
+  std::mutex mtx;
+  std::size_t outstanding{0u};
+  bool settled{false};
+  system::error_code first_ec;
+  optional<Token> on_done;
+
+  hedged_ropen_state(Executor exec, const beast::http::request<Body, http::fields> & req)
+      : timer(std::move(exec)), reqs{req, req} {}
+
+  // an attempt only goes out while the race is open; the timer's
+  // duplicate may lose against the winner's completion
+  bool claim_start()
+  {
+    std::lock_guard<std::mutex> lock{mtx};
+    if (settled)
+      return false;
+    ++outstanding;
+    return true;
+  }
+
+  void arrive(system::error_code ec, stream_type str)
+  {
+    optional<Token> tk;
+    {
+      std::lock_guard<std::mutex> lock{mtx};
+      --outstanding;
+      if (!settled)
+      {
+        if (ec && !first_ec)
+          first_ec = ec;
+        if (!ec || outstanding == 0u)
+        {
+          settled = true;
+          timer.cancel();
+          tk = std::move(on_done);
+          on_done.reset();
+        }
+      }
+    }
+
+    if (tk)
+    {
+      if (!ec)
+        return (*tk)(system::error_code{}, std::move(str));
+      // settled, so first_ec is ours alone now
+      return (*tk)(first_ec, stream_type{timer.get_executor(), nullptr});
+    }
+
+    if (!ec && !str.done())
+    {
+      auto sp = std::make_shared<stream_type>(std::move(str));
+      auto & ref = *sp;
+      ref.async_dump([sp](system::error_code) {});
+    }
+  }
+};
+
+template<typename Executor, typename Token, typename Pool, typename Body>
+struct hedged_ropen_attempt
+{
+  using executor_type = Executor;
+  executor_type get_executor() const { return st->timer.get_executor(); }
+
+  std::shared_ptr<hedged_ropen_state<Executor, Token, Body>> st;
+  std::shared_ptr<Pool> pool;
+  request_options opts;
+  cookie_jar * jar;
+  std::size_t idx;
+
+  void start()
+  {
+    if (!st->claim_start())
+      return;
+    // a copy goes into the operation, so the timer's copy stays usable
+    pool->async_ropen(st->reqs[idx], opts, jar, hedged_ropen_attempt(*this));
+  }
+
+  void operator()(system::error_code ec, basic_stream<Executor> str)
+  {
+    st->arrive(ec, std::move(str));
+  }
+};
+
+template<typename Executor, typename Token, typename Pool, typename Body>
+struct hedged_ropen_timer
+{
+  using executor_type = Executor;
+  executor_type get_executor() const { return attempt.st->timer.get_executor(); }
+
+  hedged_ropen_attempt<Executor, Token, Pool, Body> attempt;
+
+  void operator()(system::error_code ec)
+  {
+    if (!ec)
+      attempt.start();
+  }
+};
+
+template<typename Executor, typename Pool, typename Body, typename Token>
+void hedged_ropen_(std::true_type /* copyable body */,
+                   Executor exec,
+                   std::shared_ptr<Pool> pool,
+                   beast::http::request<Body, http::fields> * req,
+                   const request_options & opts,
+                   cookie_jar * jar,
+                   Token tk)
+{
+  // shares the token's allocator so asio's handler recycling applies
+  auto alloc = asio::get_associated_allocator(tk, asio::recycling_allocator<void>());
+  auto st = std::allocate_shared<hedged_ropen_state<Executor, Token, Body>>(alloc, std::move(exec), *req);
+  st->on_done.emplace(std::move(tk));
+  st->timer.expires_after(opts.hedge_after);
+
+  // the wait goes out before the first attempt, so a cancel from arrive()
+  // always has an operation to hit
+  st->timer.async_wait(hedged_ropen_timer<Executor, Token, Pool, Body>{
+      hedged_ropen_attempt<Executor, Token, Pool, Body>{st, pool, opts, jar, 1u}});
+  hedged_ropen_attempt<Executor, Token, Pool, Body>{std::move(st), std::move(pool), opts, jar, 0u}.start();
+}
+
+template<typename Executor, typename Pool, typename Body, typename Token>
+void hedged_ropen_(std::false_type /* copyable body */,
+                   Executor,
+                   std::shared_ptr<Pool> pool,
+                   beast::http::request<Body, http::fields> * req,
+                   const request_options & opts,
+                   cookie_jar * jar,
+                   Token tk)
+{
+  // single-shot bodies (files, pipes) cannot be duplicated; the request
+  // goes out plain
+  pool->async_ropen(*req, opts, jar, std::move(tk));
+}
+
+template<typename Executor, typename Pool, typename Body, typename Token>
+void hedged_ropen(Executor exec,
+                  std::shared_ptr<Pool> pool,
+                  beast::http::request<Body, http::fields> * req,
+                  const request_options & opts,
+                  cookie_jar * jar,
+                  Token tk)
+{
+  hedged_ropen_(std::is_copy_constructible<typename Body::value_type>{},
+                std::move(exec), std::move(pool), req, opts, jar, std::move(tk));
+}
+
+// Buffers a claimed single-flight response without blocking the io thread,
+// the shape of async_cache_fill_op: read the body into a flat buffer
+// asynchronously, then hand the flight's end to the session. A failed read
+// publishes the error and returns the part-read stream with ec set.
+template<typename Executor>
+struct async_sf_fill_op : asio::coroutine
+{
+  using executor_type = Executor;
+  executor_type get_executor() {return exec; }
+
+  using flight_type = typename basic_session<Executor>::sf_flight_;
+
+  basic_session<Executor> * sess;
+  std::shared_ptr<flight_type> flight;
+  std::string key;
+  Executor exec;
+  basic_stream<Executor> str;
+  beast::flat_buffer buf;
+
+  async_sf_fill_op(basic_session<Executor> * sess, std::shared_ptr<flight_type> flight,
+                   std::string key, Executor exec, basic_stream<Executor> str)
+      : sess(sess), flight(std::move(flight)), key(std::move(key)),
+        exec(std::move(exec)), str(std::move(str)) {}
+
+  using completion_signature_type = void(system::error_code, basic_stream<Executor>);
+  using step_signature_type       = void(system::error_code, std::size_t);
+
+  auto resume(requests::detail::co_token_t<step_signature_type> self,
+              system::error_code & ec, std::size_t = 0u) -> basic_stream<Executor>
+  {
+    reenter(this)
+    {
+      yield str.async_read(buf, std::move(self));
+      if (ec)
+      {
+        sess->sf_publish_(flight, key, {}, {}, ec);
+        return std::move(str);
+      }
+      return sess->sf_serve_(flight, key, std::move(str), buf);
+    }
+    return basic_stream<Executor>{exec, nullptr};
+  }
+};
+
+// `Flight` stays deduced - the flight type is private to the session
+template<typename Executor, typename Flight, typename Token>
+auto async_sf_fill(basic_session<Executor> * sess, Flight flight, std::string key,
+                   Executor exec, basic_stream<Executor> str, Token && token)
+{
+  return co_run<async_sf_fill_op<Executor>>(std::forward<Token>(token),
+                                            sess, std::move(flight), std::move(key),
+                                            exec, std::move(str));
+}
 
-  return ropen(url, hreq, ec);
 }
 
 template<typename Executor>
@@ -367,6 +1322,9 @@ struct basic_session<Executor>::async_ropen_op : asio::coroutine
 
   struct request_options opts;
   urls::url_view url;
+  // prepared handle for the first hop, see basic_endpoint_ref; redirect
+  // hops go through the regular lookup.
+  basic_endpoint_ref<Executor> * ep_ = nullptr;
   core::string_view default_mime_type;
 
   system::error_code ec_;
@@ -377,12 +1335,72 @@ struct basic_session<Executor>::async_ropen_op : asio::coroutine
 
   response_base::history_type history;
 
+  detail::arena_anchor anchor_; // must precede hreq, prepare_request sets it
   optional<beast::http::request<body_type, http::fields>> hreq;
   beast::http::request<body_type, http::fields> &req;
 
   using flat_buffer = beast::basic_flat_buffer<container::pmr::polymorphic_allocator<char>>;
 
   urls::url url_cache;
+  bool revalidate_ = false;
+
+  // the in-flight slot held from admission until the returned stream (or
+  // this op, on failure) lets go of it, see set_concurrency_limit.
+  std::shared_ptr<void> slot_;
+
+  // per-host pacing, see set_rate_limit
+  std::shared_ptr<rate_bucket_> bucket_;
+  optional<asio::steady_timer> rate_timer_;
+  std::chrono::steady_clock::duration rate_delay_{};
+
+  // latency accounting, see basic_session::request_latency: when the caller
+  // did not ask for timings the op stamps its own to get at the pool-wait
+  // and handshake boundaries. tm_ dies with the op, so a stream that was
+  // pointed at it must be detached before it leaves.
+  timing tm_;
+  bool own_timings_{false};
+  timing::time_point started_{};
+
+  // single-flight coalescing, see use_single_flight: the flight this op
+  // claimed (and publishes through finish_) or parked on
+  std::shared_ptr<sf_flight_> sf_flight;
+  bool sf_claimed = false;
+  std::string sf_key;
+
+  // Claim the flight or park on it; the op suspends either way and gets
+  // posted back, like the DNS single-flight in async_lookup_op.
+  void sf_claim_or_park_(requests::detail::co_token_t<step_signature_type> self)
+  {
+    auto alloc = self.get_allocator();
+    auto tok = std::allocate_shared<requests::detail::co_token_t<step_signature_type>>(alloc, std::move(self));
+    auto exec = get_executor();
+    if (this_->sf_claim_(sf_key, sf_flight,
+            [tok, exec](system::error_code ec)
+            {
+              asio::post(exec, [tok, ec]() mutable { (*tok)(ec); });
+            }))
+    {
+      sf_claimed = true;
+      asio::post(exec, [tok]() mutable { (*tok)(system::error_code{}); });
+    }
+  }
+
+  stream finish_(system::error_code & ec, stream str)
+  {
+    // A claimed flight still open here could not be buffered (the
+    // bufferable successes went through detail::async_sf_fill before the
+    // tail): it ends empty-handed, the parked waiters dial out themselves.
+    if (sf_claimed)
+    {
+      sf_claimed = false;
+      this_->sf_publish_(sf_flight, sf_key, {}, {}, ec);
+    }
+    this_->record_latencies_(timing::clock_type::now() - started_,
+                             own_timings_ ? &tm_ : opts.timings);
+    if (own_timings_)
+      str.timings_ = nullptr;
+    return str;
+  }
 
   async_ropen_op(basic_session<Executor> * this_,
                  http::request<RequestBody> * req,
@@ -401,7 +1419,7 @@ struct basic_session<Executor>::async_ropen_op : asio::coroutine
       error_code &ec)
   {
     using body_traits = request_body_traits<std::decay_t<RequestBody_>>;
-    if (!is_secure && this_->options_.enforce_tls)
+    if (!is_secure && opts.enforce_tls)
     {
       static constexpr auto loc((BOOST_CURRENT_LOCATION));
       ec.assign(error::insecure, &loc);
@@ -416,15 +1434,26 @@ struct basic_session<Executor>::async_ropen_op : asio::coroutine
     }
 
     {
-      detail::monotonic_token mv;
-      auto cc = this_->jar_.get(host, is_secure, path,  mv);
-      if (!cc.empty())
-        fields.set(http::field::cookie, cc);
+      const auto enc = body_content_encoding<body_traits>(body);
+      if (!enc.empty() && fields.count(http::field::content_encoding) == 0u)
+        fields.set(http::field::content_encoding, enc);
     }
 
+    this_->jar_ptr_->append_to(fields, host, is_secure, path);
+
+    // see the sync ropen: rebuild the headers inside the arena when enabled.
+    container::pmr::memory_resource * res = fields.get_allocator().resource();
+    if (this_->use_arena_)
+    {
+      anchor_ = detail::arena_anchor(this_->arena_pool_.acquire());
+      res = anchor_.resource();
+    }
+    http::fields afields{container::pmr::polymorphic_allocator<char>(res)};
+    afields = std::move(fields);
+
     http::request<body_type> hreq(method, path, 11,
                                   body_traits::make_body(std::forward<RequestBody_>(body), ec),
-                                  std::move(fields));
+                                  std::move(afields));
 
     hreq.set(beast::http::field::host, host);
     hreq.set(beast::http::field::user_agent, "Requests-" BOOST_BEAST_VERSION_STRING);
@@ -439,8 +1468,9 @@ struct basic_session<Executor>::async_ropen_op : asio::coroutine
                  beast::http::verb method,
                  urls::url_view path,
                  RequestBody_ && body,
-                 http::fields req)
-      : this_(this_), opts(this_->options_), url(path),
+                 http::fields req,
+                 basic_endpoint_ref<Executor> * ep = nullptr)
+      : this_(this_), opts(this_->options_for(path.encoded_host_and_port())), url(path), ep_(ep),
         default_mime_type(request_body_traits<std::decay_t<RequestBody_>>::default_content_type(body)),
         hreq(prepare_request(method, url.encoded_resource(), url.encoded_host_and_port(), std::forward<RequestBody_>(body), std::move(req), ec_)),
         req(*hreq)
@@ -455,34 +1485,169 @@ struct basic_session<Executor>::async_ropen_op : asio::coroutine
   {
     reenter(this)
     {
+      started_ = timing::clock_type::now();
+      if (opts.timings == nullptr)
+      {
+        opts.timings = &tm_;
+        own_timings_ = true;
+      }
 
 
-      if (!is_secure && this_->options_.enforce_tls)
+      if (this_->draining_.load(std::memory_order_relaxed))
       {
         static constexpr auto loc((BOOST_CURRENT_LOCATION));
-        BOOST_REQUESTS_ASSIGN_EC(ec, error::insecure);
-        return stream{get_executor(), nullptr};
+        BOOST_REQUESTS_ASSIGN_EC(ec, error::session_draining);
+        return finish_(ec, stream{get_executor(), nullptr});
       }
 
+      if (!is_secure && opts.enforce_tls)
       {
-        detail::monotonic_token mv;
-        auto cc = this_->jar_.get(url.encoded_host(), is_secure, url.encoded_path(), mv);
-        if (!cc.empty())
-          req.set(http::field::cookie, cc);
+        static constexpr auto loc((BOOST_CURRENT_LOCATION));
+        BOOST_REQUESTS_ASSIGN_EC(ec, error::insecure);
+        return finish_(ec, stream{get_executor(), nullptr});
       }
 
+      this_->jar_ptr_->append_to(req, url.encoded_host(), is_secure, url.encoded_path());
+
       req.prepare_payload();
-      yield this_->async_get_pool(url, std::move(self));
+
+      if (this_->cache_ != nullptr && detail::cache_usable(req))
+      {
+        auto hit = this_->cache_->match(get_executor(), url);
+        if (hit)
+          return finish_(ec, std::move(*hit));
+
+        // see the sync ropen: expired entries with validators get refetched
+        // conditionally, a 304 below gets answered from the store.
+        std::string etag, last_modified;
+        if (this_->cache_->validators_for(url.buffer(), etag, last_modified))
+        {
+          if (!etag.empty() && req.count(http::field::if_none_match) == 0u)
+          {
+            req.set(http::field::if_none_match, etag);
+            revalidate_ = true;
+          }
+          if (!last_modified.empty() && req.count(http::field::if_modified_since) == 0u)
+          {
+            req.set(http::field::if_modified_since, last_modified);
+            revalidate_ = true;
+          }
+        }
+      }
+
+      // Coalesce with identical in-flight GETs, see use_single_flight;
+      // mirrors the sync ropen: the claimant dials out and publishes in
+      // finish_, a follower parks and replays the fanned out outcome.
+      if (this_->use_single_flight_ && detail::cache_usable(req))
+      {
+        sf_key = basic_session<Executor>::sf_key_(url, req.base());
+        yield sf_claim_or_park_(std::move(self));
+        if (!sf_claimed)
+        {
+          if (ec) // the claimant's failure is ours too
+            return finish_(ec, stream{get_executor(), nullptr});
+          {
+            std::string payload, host;
+            {
+              std::lock_guard<std::mutex> lock{this_->sf_mtx_};
+              payload = sf_flight->payload;
+              host = sf_flight->host;
+            }
+            if (!payload.empty())
+              return finish_(ec, this_->sf_replay_(std::move(payload), std::move(host)));
+          }
+          sf_flight = nullptr; // ended empty-handed - dial out ourselves
+        }
+      }
+
+      // per-host pacing, see set_rate_limit: take one token for this
+      // request, sleeping out the deficit when the bucket is drained. This
+      // comes before admission, so a paced request does not sit on one of
+      // the in-flight slots while it waits.
+      bucket_ = this_->rate_bucket_for_(url.encoded_host_and_port());
+      while (bucket_ != nullptr
+          && (rate_delay_ = bucket_->acquire_or_delay()) > std::chrono::steady_clock::duration::zero())
+      {
+        if (!rate_timer_)
+          rate_timer_.emplace(get_executor());
+        rate_timer_->expires_after(rate_delay_);
+        yield rate_timer_->async_wait(std::move(self));
+        if (ec)
+          return finish_(ec, stream{get_executor(), nullptr});
+      }
+
+      // session-wide admission, see set_concurrency_limit: wait in the
+      // bounded queue for a free slot, or shed when the queue is full.
+      if (this_->max_inflight_ > 0u)
+      {
+        if (!this_->budget_.try_acquire())
+        {
+          if (this_->queued_.fetch_add(1u, std::memory_order_relaxed) >= this_->max_queued_)
+          {
+            this_->queued_.fetch_sub(1u, std::memory_order_relaxed);
+            BOOST_REQUESTS_ASSIGN_EC(ec, error::session_overloaded);
+            return finish_(ec, stream{get_executor(), nullptr});
+          }
+          yield this_->budget_.async_acquire(std::move(self));
+          this_->queued_.fetch_sub(1u, std::memory_order_relaxed);
+          if (ec)
+            return finish_(ec, stream{get_executor(), nullptr});
+        }
+        slot_ = this_->make_budget_slot_();
+      }
+
+      // pool acquisition includes the DNS lookup on a cold host; a current
+      // prepared handle resolves it without the table walk
+      if (opts.timings)
+        opts.timings->resolve_start = timing::clock_type::now();
+      if (ep_ != nullptr)
+      {
+        yield this_->async_get_pool(*ep_, std::move(self));
+      }
+      else
+      {
+        yield this_->async_get_pool(url, std::move(self));
+      }
+      if (opts.timings)
+        opts.timings->resolve_done = timing::clock_type::now();
       if (ec)
-        return basic_stream<Executor>{get_executor(), nullptr};
+        return finish_(ec, basic_stream<Executor>{get_executor(), nullptr});
       yield visit(
           [&](auto pool)
           {
-            pool->async_ropen(req, opts, &this_->jar_, std::move(self));
+            if (detail::may_hedge_request(req.method(), opts))
+              detail::hedged_ropen(get_executor(), std::move(pool), &req, opts, this_->jar_ptr_, std::move(self));
+            else
+              pool->async_ropen(req, opts, this_->jar_ptr_, std::move(self));
           }, variant2::get<1>(s));
+      if (!ec)
+        this_->record_alt_svc_(url, variant2::get<2>(s).headers());
 
       if (!ec || opts.max_redirects == variant2::get<2>(s).history().size())
-        return std::move(variant2::get<2>(s));
+      {
+        if (!ec && revalidate_
+            && variant2::get<2>(s).headers().result() == http::status::not_modified)
+        {
+          auto entry = this_->cache_->revalidated(get_executor(), url,
+                                                  variant2::get<2>(s).headers());
+          if (entry)
+            return finish_(ec, std::move(*entry));
+        }
+        if (!ec && this_->cache_ != nullptr && detail::cache_usable(req)
+            && this_->cache_->capturable(variant2::get<2>(s)))
+          yield detail::async_cache_fill(this_->cache_, url, get_executor(),
+                                         std::move(variant2::get<2>(s)), std::move(self));
+        // buffer the claimed flight asynchronously - never a blocking
+        // read on the io thread, see basic_session::sf_finish_
+        if (sf_claimed && !ec && this_->sf_bufferable_(variant2::get<2>(s)))
+        {
+          sf_claimed = false;
+          yield detail::async_sf_fill(this_, sf_flight, sf_key, get_executor(),
+                                      std::move(variant2::get<2>(s)), std::move(self));
+        }
+        variant2::get<2>(s).budget_slot_ = std::move(slot_);
+        return finish_(ec, std::move(variant2::get<2>(s)));
+      }
 
       while (ec == error::forbidden_redirect)
       {
@@ -519,7 +1684,7 @@ struct basic_session<Executor>::async_ropen_op : asio::coroutine
             break;
           }
 
-          if (!should_redirect(this_->options_.redirect, url, *nurl))
+          if (!should_redirect(opts.redirect, url, *nurl))
           {
             BOOST_REQUESTS_ASSIGN_EC(ec, error::forbidden_redirect);
             break ;
@@ -537,26 +1702,43 @@ struct basic_session<Executor>::async_ropen_op : asio::coroutine
         }
 
         req.base().target(url.encoded_resource());
-        {
-          detail::monotonic_token mv;
-          auto cc = this_->jar_.get(url.encoded_host(), is_secure, url.encoded_path(), mv);
-          if (!cc.empty())
-            req.base().set(http::field::cookie, cc);
-        }
+        this_->jar_ptr_->append_to(req.base(), url.encoded_host(), is_secure, url.encoded_path());
         history.insert(history.end(),
                        std::make_move_iterator(std::move(variant2::get<2>(s)).history().begin()),
                        std::make_move_iterator(std::move(variant2::get<2>(s)).history().end()));
+        if (opts.timings)
+          opts.timings->resolve_start = timing::clock_type::now();
         yield this_->async_get_pool(url, std::move(self));
+        if (opts.timings)
+          opts.timings->resolve_done = timing::clock_type::now();
         if (ec)
-          return stream{get_executor(), nullptr};
+          return finish_(ec, stream{get_executor(), nullptr});
         yield visit(
             [&](auto pool)
             {
-              pool->async_ropen(req, opts, &this_->jar_, std::move(self));
+              if (detail::may_hedge_request(req.method(), opts))
+                detail::hedged_ropen(get_executor(), std::move(pool), &req, opts, this_->jar_ptr_, std::move(self));
+              else
+                pool->async_ropen(req, opts, this_->jar_ptr_, std::move(self));
             }, variant2::get<1>(s));
+        if (!ec)
+          this_->record_alt_svc_(url, variant2::get<2>(s).headers());
       }
       variant2::get<2>(s).prepend_history(std::move(history));
-      return std::move(variant2::get<2>(s));
+      if (!ec) // failed chains keep the hops' headers for diagnosis
+        variant2::get<2>(s).trim_history(opts.history, opts.max_history);
+      if (!ec && this_->cache_ != nullptr && detail::cache_usable(req)
+          && this_->cache_->capturable(variant2::get<2>(s)))
+        yield detail::async_cache_fill(this_->cache_, url, get_executor(),
+                                       std::move(variant2::get<2>(s)), std::move(self));
+      if (sf_claimed && !ec && this_->sf_bufferable_(variant2::get<2>(s)))
+      {
+        sf_claimed = false;
+        yield detail::async_sf_fill(this_, sf_flight, sf_key, get_executor(),
+                                    std::move(variant2::get<2>(s)), std::move(self));
+      }
+      variant2::get<2>(s).budget_slot_ = std::move(slot_);
+      return finish_(ec, std::move(variant2::get<2>(s)));
 
     }
     return stream{this_->get_executor(), nullptr};
@@ -592,6 +1774,35 @@ basic_session<Executor>::async_ropen(urls::url_view url,
 
 }
 
+template<typename Executor>
+template<typename RequestBody,
+          BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, basic_stream<Executor>)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code, basic_stream<Executor>))
+basic_session<Executor>::async_ropen(beast::http::verb method,
+                                     basic_endpoint_ref<Executor> & ep,
+                                     RequestBody && body,
+                                     http::fields req,
+                                     CompletionToken && completion_token)
+{
+  using op_t = async_ropen_op<typename request_body_traits<std::decay_t<RequestBody>>::body_type>;
+  return detail::co_run<op_t>(std::forward<CompletionToken>(completion_token),
+                              this, method, ep.url(), std::forward<RequestBody>(body), std::move(req), &ep);
+}
+
+template<typename Executor>
+template<typename RequestBody,
+          BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, basic_stream<Executor>)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken,
+                                   void (boost::system::error_code, basic_stream<Executor>))
+basic_session<Executor>::async_ropen(basic_endpoint_ref<Executor> & ep,
+                                     http::request<RequestBody> & req,
+                                     CompletionToken && completion_token)
+{
+  using op_t = async_ropen_op<typename request_body_traits<std::decay_t<RequestBody>>::body_type>;
+  return detail::co_run<op_t>(std::forward<CompletionToken>(completion_token), this, ep.url(), &req);
+
+}
+
 }
 }
 
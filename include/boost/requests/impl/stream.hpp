@@ -10,6 +10,7 @@
 
 #include <boost/asio/read_until.hpp>
 #include <boost/asio/redirect_error.hpp>
+#include <boost/core/exchange.hpp>
 #include <boost/beast/core/buffer_ref.hpp>
 #include <boost/requests/keep_alive.hpp>
 #include <boost/requests/stream.hpp>
@@ -22,8 +23,67 @@ namespace requests
 {
 
 template<typename Executor>
-template<typename MutableBuffer>
-std::size_t basic_stream<Executor>::read_some(const MutableBuffer & buffer, system::error_code & ec)
+template<typename MutableBufferSequence>
+std::size_t basic_stream<Executor>::read_some(const MutableBufferSequence & buffers, system::error_code & ec)
+{
+  if (headers_pending_())
+  {
+    ensure_headers_(ec);
+    if (ec)
+      return 0u;
+  }
+
+  if (!inflater_)
+  {
+    const auto n = read_some_raw_(buffers, ec);
+    if (read_tap_ && n > 0u)
+    {
+      // a direct read may have scattered across the sequence's regions
+      std::size_t remaining = n;
+      for (auto itr = asio::buffer_sequence_begin(buffers);
+           itr != asio::buffer_sequence_end(buffers) && remaining > 0u; itr++)
+      {
+        const auto k = (std::min)(remaining, itr->size());
+        if (k > 0u)
+          read_tap_(itr->data(), k);
+        remaining -= k;
+      }
+    }
+    return n;
+  }
+
+  if (inflater_->done())
+  {
+    BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
+    return 0u;
+  }
+
+  auto itr = boost::asio::buffer_sequence_begin(buffers);
+  const auto end = boost::asio::buffer_sequence_end(buffers);
+  if (itr == end)
+    return 0u;
+
+  asio::mutable_buffer out = *itr;
+  std::size_t written = 0u;
+  while (written == 0u && out.size() > 0u && !inflater_->done() && !ec)
+  {
+    if (inflater_->needs_input())
+    {
+      const auto n = read_some_raw_(inflater_->input_buffer(), ec);
+      if (ec)
+        return written;
+      inflater_->commit(n);
+    }
+    written += inflater_->write_output(out, ec);
+  }
+  if (read_tap_ && written > 0u)
+    read_tap_(out.data(), written);
+  return written;
+}
+
+template<typename Executor>
+template<typename MutableBufferSequence>
+std::size_t basic_stream<Executor>::read_some_raw_(const MutableBufferSequence & buffers, system::error_code & ec)
 {
   if (!parser_)
   {
@@ -36,11 +96,15 @@ std::size_t basic_stream<Executor>::read_some(const MutableBuffer & buffer, syst
     return 0u;
   }
 
-  auto itr = boost::asio::buffer_sequence_begin(buffer);
-  const auto end = boost::asio::buffer_sequence_end(buffer);
+  auto itr = boost::asio::buffer_sequence_begin(buffers);
+  const auto end = boost::asio::buffer_sequence_end(buffers);
   if (itr == end)
     return 0u;
 
+  if (maybe_enter_direct_())
+    return read_some_direct_(buffers, ec);
+
+  // the parser's buffer_body fills one contiguous region per call
   parser_->get().body().data = itr->data();
   parser_->get().body().size = itr->size();
 
@@ -55,6 +119,7 @@ std::size_t basic_stream<Executor>::read_some(const MutableBuffer & buffer, syst
   else
   {
     parser_->get().body().more = false;
+    mark_body_complete_();
     bool should_close = interpret_keep_alive_response(impl_->get_keep_alive_set_(), parser_->get(), ec);
     if (should_close)
     {
@@ -67,33 +132,177 @@ std::size_t basic_stream<Executor>::read_some(const MutableBuffer & buffer, syst
   return res;
 };
 
+template<typename Executor>
+template<typename MutableBufferSequence>
+std::size_t basic_stream<Executor>::read_some_direct_(const MutableBufferSequence & buffers, system::error_code & ec)
+{
+  if (direct_remaining_ == 0u)
+  {
+    BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
+    return 0u;
+  }
+
+  // flatten the sequence, clamped to the end of this response, so the
+  // implementation scatter-fills every region with a single read
+  asio::mutable_buffer bufs[BOOST_REQUESTS_MAX_SCATTER_BUFFERS];
+  std::size_t count = 0u;
+  std::uint64_t space = direct_remaining_;
+  for (auto itr = boost::asio::buffer_sequence_begin(buffers);
+       itr != boost::asio::buffer_sequence_end(buffers)
+       && count < std::size_t(BOOST_REQUESTS_MAX_SCATTER_BUFFERS) && space > 0u; itr++)
+  {
+    asio::mutable_buffer b = *itr;
+    if (b.size() == 0u)
+      continue;
+    if (b.size() > space)
+      b = asio::buffer(b.data(), static_cast<std::size_t>(space));
+    space -= b.size();
+    bufs[count++] = b;
+  }
+  if (count == 0u)
+    return 0u;
+
+  const auto res = impl_->do_read_body_direct_(detail::buffer_span(bufs, count), ec);
+  direct_remaining_ -= res;
+
+  if (direct_remaining_ == 0u)
+  {
+    parser_->get().body().more = false;
+    mark_body_complete_();
+    bool should_close = interpret_keep_alive_response(impl_->get_keep_alive_set_(), parser_->get(), ec);
+    if (should_close)
+    {
+      boost::system::error_code ec_;
+      impl_->do_close_(ec_);
+    }
+  }
+
+  return res;
+}
+
+template<typename Executor>
+asio::const_buffer basic_stream<Executor>::peek_some() const
+{
+  auto b = impl_->do_staged_input_();
+  // staged bytes past direct_remaining_ belong to the next pipelined response
+  if (b.size() > direct_remaining_)
+    b = asio::const_buffer(b.data(), static_cast<std::size_t>(direct_remaining_));
+  return b;
+}
+
+template<typename Executor>
+void basic_stream<Executor>::consume(std::size_t n, system::error_code & ec)
+{
+  if (read_tap_ && n > 0u)
+  {
+    const auto b = impl_->do_staged_input_();
+    read_tap_(b.data(), (std::min)(n, b.size()));
+  }
+  impl_->do_consume_staged_(n);
+  direct_remaining_ -= n;
+
+  if (direct_remaining_ == 0u)
+  {
+    parser_->get().body().more = false;
+    mark_body_complete_();
+    bool should_close = interpret_keep_alive_response(impl_->get_keep_alive_set_(), parser_->get(), ec);
+    if (should_close)
+    {
+      boost::system::error_code ec_;
+      impl_->do_close_(ec_);
+    }
+  }
+}
+
+template<typename Executor>
+std::size_t basic_stream<Executor>::stage_some(system::error_code & ec)
+{
+  if (direct_remaining_ == 0u)
+  {
+    BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
+    return 0u;
+  }
+  return impl_->do_stage_input_(ec);
+}
+
+#if defined(__linux__)
+
+template<typename Executor>
+std::size_t basic_stream<Executor>::splice_some(int fd, system::error_code & ec)
+{
+  if (direct_remaining_ == 0u)
+  {
+    BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
+    return 0u;
+  }
+
+  // one pipe-full at a time, so the staging pipe is always drained between calls
+  const auto res = impl_->do_splice_body_(
+      fd, static_cast<std::size_t>((std::min)(
+          direct_remaining_, static_cast<std::uint64_t>(65536u))), true, ec);
+  direct_remaining_ -= res;
+
+  if (direct_remaining_ == 0u)
+  {
+    parser_->get().body().more = false;
+    mark_body_complete_();
+    bool should_close = interpret_keep_alive_response(impl_->get_keep_alive_set_(), parser_->get(), ec);
+    if (should_close)
+    {
+      boost::system::error_code ec_;
+      impl_->do_close_(ec_);
+    }
+  }
+
+  return res;
+}
+
+#endif
 
 template<typename Executor>
 template<typename DynamicBuffer>
 std::size_t basic_stream<Executor>::read(DynamicBuffer & buffer, system::error_code & ec)
 {
+  if (headers_pending_())
+  {
+    ensure_headers_(ec);
+    if (ec)
+      return 0u;
+  }
+
   if (!parser_)
   {
     BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_connected);
     return 0u;
   }
-  else if (!parser_->get().body().more)
+  else if (inflater_ ? inflater_->done() : !parser_->get().body().more)
   {
     BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
     return 0u;
   }
+  else if (!inflater_ && parser_->content_length_remaining() &&
+           *parser_->content_length_remaining() >
+               static_cast<std::uint64_t>(buffer.max_size() - buffer.size()))
+  {
+    // announced size over the buffer's cap - fail before allocating or reading
+    BOOST_REQUESTS_ASSIGN_EC(ec, beast::http::error::buffer_overflow);
+    return 0u;
+  }
 
   std::size_t res = 0u;
-  while (!ec && !parser_->is_done())
+  while (!ec && !body_done_())
   {
-    auto n = read_some(buffer.prepare(parser_->content_length_remaining().value_or(BOOST_REQUESTS_CHUNK_SIZE)), ec);
+    auto n = read_some(buffer.prepare(
+                 inflater_ ? std::size_t(BOOST_REQUESTS_CHUNK_SIZE) :
+                 direct_   ? static_cast<std::size_t>(direct_remaining_)
+                           : parser_->content_length_remaining().value_or(BOOST_REQUESTS_CHUNK_SIZE)), ec);
     buffer.commit(n);
     res += n;
   }
 
-  if (!parser_->is_done())
+  if (!body_done_())
     ec = beast::http::error::need_buffer;
-  else
+  else if (!direct_ && !inflater_) // those paths interpret keep-alive on their last raw read
   {
     parser_->get().body().more = false;
     bool should_close = interpret_keep_alive_response(impl_->get_keep_alive_set_(), parser_->get(), ec);
@@ -111,10 +320,35 @@ std::size_t basic_stream<Executor>::read(DynamicBuffer & buffer, system::error_c
 template<typename Executor>
 void basic_stream<Executor>::dump(system::error_code & ec)
 {
+  if (headers_pending_())
+  {
+    ensure_headers_(ec);
+    if (ec)
+      return;
+  }
+
   if (!parser_ || !parser_->get().body().more)
     return;
 
   char data[65535];
+  if (direct_)
+  {
+    while (direct_remaining_ > 0u && !ec)
+      direct_remaining_ -= impl_->do_read_body_direct_(
+          asio::buffer(data, static_cast<std::size_t>(
+              (std::min)(direct_remaining_, static_cast<std::uint64_t>(sizeof(data))))), ec);
+
+    parser_->get().body().more = false;
+    mark_body_complete_();
+    bool should_close = interpret_keep_alive_response(impl_->get_keep_alive_set_(), parser_->get(), ec);
+    if (should_close)
+    {
+      boost::system::error_code ec_;
+      impl_->do_close_(ec_);
+    }
+    return;
+  }
+
   while (parser_->get().body().more)
   {
     parser_->get().body().data = data;
@@ -131,6 +365,7 @@ void basic_stream<Executor>::dump(system::error_code & ec)
       parser_->get().body().more = false;
   }
 
+  mark_body_complete_();
   bool should_close = interpret_keep_alive_response(impl_->get_keep_alive_set_(), parser_->get(), ec);
   if (should_close)
   {
@@ -139,6 +374,30 @@ void basic_stream<Executor>::dump(system::error_code & ec)
   }
 }
 
+template<typename Executor>
+void basic_stream<Executor>::ensure_headers_(system::error_code & ec)
+{
+  auto * mtx = boost::exchange(pipeline_mtx_, nullptr);
+  mtx->lock(ec);
+  if (ec)
+    return;
+  lock_ = asem::lock_guard<detail::basic_mutex<executor_type>>{*mtx, std::adopt_lock};
+
+  impl_->do_read_header_(*parser_, ec);
+  if (timings_)
+    timings_->headers_received = timing::clock_type::now();
+  if (!ec)
+    on_headers_(ec);
+}
+
+template<typename Executor>
+void basic_stream<Executor>::on_headers_(system::error_code & ec)
+{
+  if (jar_)
+    jar_->set_all(parser_->get().base(), impl_->get_host_(), ec);
+  if (decompress_)
+    init_decompression_();
+}
 
 
 template<typename Executor>
@@ -172,27 +431,36 @@ struct basic_stream<Executor>::async_read_op : asio::coroutine
     {
       if (!this_->parser_)
         BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::not_connected)
-      else if (!this_->parser_->get().body().more)
+      else if (this_->inflater_ ? this_->inflater_->done() : !this_->parser_->get().body().more)
         BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof)
+      else if (!this_->inflater_ && this_->parser_->content_length_remaining() &&
+               *this_->parser_->content_length_remaining() >
+                   static_cast<std::uint64_t>(buffer.max_size() - buffer.size()))
+        // announced size over the buffer's cap - fail before allocating or reading
+        BOOST_REQUESTS_ASSIGN_EC(ec, beast::http::error::buffer_overflow)
 
       if (ec)
         break;
 
-      if (this_->parser_->is_done())
+      if (this_->body_done_())
         break;
 
-      while (!ec && !this_->parser_->is_done())
+      while (!ec && !this_->body_done_())
       {
         yield this_->async_read_some(
-            buffer.prepare(this_->parser_->content_length_remaining().value_or(BOOST_REQUESTS_CHUNK_SIZE)),
+            buffer.prepare(this_->inflater_
+                ? std::size_t(BOOST_REQUESTS_CHUNK_SIZE)
+                : this_->direct_
+                ? static_cast<std::size_t>(this_->direct_remaining_)
+                : this_->parser_->content_length_remaining().value_or(BOOST_REQUESTS_CHUNK_SIZE)),
             std::move(self));
         buffer.commit(n);
         res += n;
       }
 
-      if (!this_->parser_->is_done() && !ec)
+      if (!this_->body_done_() && !ec)
         BOOST_REQUESTS_ASSIGN_EC(ec, beast::http::error::need_buffer)
-      else
+      else if (!this_->direct_ && !this_->inflater_) // those paths interpret keep-alive on their last raw read
       {
         this_->parser_->get().body().more = false;
         if (interpret_keep_alive_response(this_->impl_->get_keep_alive_set_(), this_->parser_->get(), ec))
@@ -230,6 +498,10 @@ struct basic_stream<Executor>::async_read_some_op : asio::coroutine
   executor_type get_executor() {return this_->get_executor(); }
 
   basic_stream * this_;
+  // the sequence's regions, flattened so the direct path can scatter-fill
+  // them in one read; the parser path fills the first one per call.
+  asio::mutable_buffer bufs_[BOOST_REQUESTS_MAX_SCATTER_BUFFERS];
+  std::size_t buf_count_ = 0u;
   asio::mutable_buffer buffer;
 
   template<typename MutableBufferSequence>
@@ -238,19 +510,17 @@ struct basic_stream<Executor>::async_read_some_op : asio::coroutine
     auto itr = boost::asio::buffer_sequence_begin(buffer);
     const auto end = boost::asio::buffer_sequence_end(buffer);
 
-    while (itr != end)
-    {
+    for (; itr != end && buf_count_ < std::size_t(BOOST_REQUESTS_MAX_SCATTER_BUFFERS); itr++)
       if (itr->size() != 0u)
-      {
-        this->buffer = *itr;
-        break;
-      }
-    }
+        bufs_[buf_count_++] = *itr;
+    if (buf_count_ != 0u)
+      this->buffer = bufs_[0];
   }
 
   using lock_type = asem::lock_guard<detail::basic_mutex<executor_type>>;
   lock_type lock;
   system::error_code ec_;
+  std::size_t res_ = 0u;
 
 
   using completion_signature_type = void(system::error_code, std::size_t);
@@ -280,10 +550,55 @@ struct basic_stream<Executor>::async_read_some_op : asio::coroutine
         return 0u;
       }
 
+      if (this_->maybe_enter_direct_())
+      {
+        {
+          // clamp the regions to the end of this response
+          std::uint64_t space = this_->direct_remaining_;
+          std::size_t count = 0u;
+          while (count < buf_count_ && space > 0u)
+          {
+            if (bufs_[count].size() > space)
+              bufs_[count] = asio::buffer(bufs_[count].data(), static_cast<std::size_t>(space));
+            space -= bufs_[count].size();
+            count++;
+          }
+          buf_count_ = count;
+        }
+
+        yield this_->impl_->do_async_read_body_direct_(
+            detail::buffer_span(bufs_, buf_count_), std::move(self));
+        res_ = res;
+        if (this_->read_tap_ && res_ > 0u)
+          for (std::size_t i = 0u, remaining = res_; i < buf_count_ && remaining > 0u; i++)
+          {
+            const auto k = (std::min)(remaining, bufs_[i].size());
+            this_->read_tap_(bufs_[i].data(), k);
+            remaining -= k;
+          }
+        this_->direct_remaining_ -= res;
+        if (this_->direct_remaining_ == 0u)
+        {
+          this_->parser_->get().body().more = false;
+          this_->mark_body_complete_();
+          if (interpret_keep_alive_response(this_->impl_->get_keep_alive_set_(), this_->parser_->get(), ec))
+          {
+            ec_ = ec;
+            yield this_->impl_->do_async_close_(std::move(self));
+            ec = ec_;
+          }
+        }
+        return res_;
+      }
+
       this_->parser_->get().body().data = buffer.data();
       this_->parser_->get().body().size = buffer.size();
 
       yield this_->impl_->do_async_read_some_(*this_->parser_, std::move(self));
+      // the raw reads feeding an inflater are not consumer-visible - the
+      // inflate op taps its decompressed output instead
+      if (this_->read_tap_ && !this_->inflater_ && res > 0u)
+        this_->read_tap_(buffer.data(), res);
       if (!this_->parser_->is_done())
       {
         this_->parser_->get().body().more = true;
@@ -293,6 +608,7 @@ struct basic_stream<Executor>::async_read_some_op : asio::coroutine
       else
       {
         this_->parser_->get().body().more = false;
+        this_->mark_body_complete_();
         if (interpret_keep_alive_response(this_->impl_->get_keep_alive_set_(), this_->parser_->get(), ec))
         {
           ec_ = ec ;
@@ -307,6 +623,187 @@ struct basic_stream<Executor>::async_read_some_op : asio::coroutine
 
 };
 
+template<typename Executor>
+struct basic_stream<Executor>::async_read_some_inflate_op : asio::coroutine
+{
+  using executor_type = Executor;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  basic_stream * this_;
+  asio::mutable_buffer buffer;
+  std::size_t written = 0u;
+
+  template<typename MutableBufferSequence>
+  async_read_some_inflate_op(basic_stream * this_, const MutableBufferSequence & buffer) : this_(this_)
+  {
+    auto itr = boost::asio::buffer_sequence_begin(buffer);
+    const auto end = boost::asio::buffer_sequence_end(buffer);
+
+    while (itr != end)
+    {
+      if (itr->size() != 0u)
+      {
+        this->buffer = *itr;
+        break;
+      }
+    }
+  }
+
+  using completion_signature_type = void(system::error_code, std::size_t);
+  using step_signature_type       = void(system::error_code, std::size_t);
+
+  std::size_t resume(requests::detail::co_token_t<step_signature_type> self,
+                     system::error_code & ec, std::size_t res = 0u)
+  {
+    reenter(this)
+    {
+      if (this_->inflater_->done())
+      {
+        yield asio::post(this_->get_executor(), std::move(self));
+        BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
+        return 0u;
+      }
+
+      if (buffer.size() == 0u)
+      {
+        yield asio::post(this_->get_executor(), std::move(self));
+        return 0u;
+      }
+
+      while (written == 0u && !this_->inflater_->done() && !ec)
+      {
+        if (this_->inflater_->needs_input())
+        {
+          yield this_->async_read_some_raw_(this_->inflater_->input_buffer(), std::move(self));
+          if (ec)
+            return written;
+          this_->inflater_->commit(res);
+        }
+        written += this_->inflater_->write_output(buffer, ec);
+      }
+      if (this_->read_tap_ && written > 0u)
+        this_->read_tap_(buffer.data(), written);
+      return written;
+    }
+    return 0u;
+  }
+};
+
+template<typename Executor>
+struct basic_stream<Executor>::async_ensure_headers_op : asio::coroutine
+{
+  using executor_type = Executor;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  basic_stream * this_;
+  async_ensure_headers_op(basic_stream * this_) : this_(this_) {}
+
+  using lock_type = asem::lock_guard<detail::basic_mutex<executor_type>>;
+
+  using completion_signature_type = void(system::error_code);
+  using step_signature_type       = void(system::error_code, std::size_t);
+
+  void resume(requests::detail::co_token_t<step_signature_type> self,
+              system::error_code & ec, std::size_t = 0u)
+  {
+    reenter(this)
+    {
+      if (!this_->pipeline_mtx_->try_lock())
+      {
+        yield this_->pipeline_mtx_->async_lock(std::move(self));
+        if (ec)
+          return;
+      }
+      this_->lock_ = lock_type{*this_->pipeline_mtx_, std::adopt_lock};
+      this_->pipeline_mtx_ = nullptr;
+
+      yield this_->impl_->do_async_read_header_(*this_->parser_, std::move(self));
+      if (this_->timings_)
+        this_->timings_->headers_received = timing::clock_type::now();
+      if (!ec)
+        this_->on_headers_(ec);
+    }
+  }
+};
+
+template<typename Executor>
+template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code))
+basic_stream<Executor>::async_ensure_headers_(CompletionToken && token)
+{
+  return detail::co_run<async_ensure_headers_op>(std::forward<CompletionToken>(token), this);
+}
+
+template<typename Executor>
+struct basic_stream<Executor>::async_read_some_pipeline_op : asio::coroutine
+{
+  using executor_type = Executor;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  basic_stream * this_;
+  asio::mutable_buffer buffer;
+
+  template<typename MutableBufferSequence>
+  async_read_some_pipeline_op(basic_stream * this_, const MutableBufferSequence & buffer) : this_(this_)
+  {
+    auto itr = boost::asio::buffer_sequence_begin(buffer);
+    const auto end = boost::asio::buffer_sequence_end(buffer);
+
+    while (itr != end)
+    {
+      if (itr->size() != 0u)
+      {
+        this->buffer = *itr;
+        break;
+      }
+    }
+  }
+
+  using completion_signature_type = void(system::error_code, std::size_t);
+  using step_signature_type       = void(system::error_code, std::size_t);
+
+  std::size_t resume(requests::detail::co_token_t<step_signature_type> self,
+                     system::error_code & ec, std::size_t res = 0u)
+  {
+    reenter(this)
+    {
+      yield this_->async_ensure_headers_(std::move(self));
+      if (ec)
+        return 0u;
+      // redispatch - the header read may have installed the inflater
+      yield this_->async_read_some(buffer, std::move(self));
+      return res;
+    }
+    return 0u;
+  }
+};
+
+template<typename Executor>
+struct basic_stream<Executor>::async_dump_pipeline_op : asio::coroutine
+{
+  using executor_type = Executor;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  basic_stream * this_;
+  async_dump_pipeline_op(basic_stream * this_) : this_(this_) {}
+
+  using completion_signature_type = void(system::error_code);
+  using step_signature_type       = void(system::error_code, std::size_t);
+
+  void resume(requests::detail::co_token_t<step_signature_type> self,
+              system::error_code & ec, std::size_t = 0u)
+  {
+    reenter(this)
+    {
+      yield this_->async_ensure_headers_(std::move(self));
+      if (!ec)
+      {
+        yield this_->async_dump(std::move(self));
+      }
+    }
+  }
+};
+
 template<typename Executor>
 template<
     typename MutableBufferSequence,
@@ -315,6 +812,132 @@ BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code, st
 basic_stream<Executor>::async_read_some(
     const MutableBufferSequence & buffers,
     CompletionToken && token)
+{
+  if (headers_pending_())
+    return detail::co_run<async_read_some_pipeline_op>(std::forward<CompletionToken>(token), this, buffers);
+  return inflater_
+      ? detail::co_run<async_read_some_inflate_op>(std::forward<CompletionToken>(token), this, buffers)
+      : detail::co_run<async_read_some_op>(std::forward<CompletionToken>(token), this, buffers);
+}
+
+#if defined(__linux__)
+
+template<typename Executor>
+struct basic_stream<Executor>::async_splice_some_op : asio::coroutine
+{
+  using executor_type = Executor;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  basic_stream * this_;
+  int fd;
+
+  async_splice_some_op(basic_stream * this_, int fd) : this_(this_), fd(fd) {}
+
+  system::error_code ec_;
+  std::size_t res_ = 0u;
+
+  using completion_signature_type = void(system::error_code, std::size_t);
+  using step_signature_type       = void(system::error_code, std::size_t);
+
+  std::size_t resume(requests::detail::co_token_t<step_signature_type> self,
+                     system::error_code & ec, std::size_t = 0u)
+  {
+    reenter(this)
+    {
+      if (this_->direct_remaining_ == 0u)
+      {
+        yield asio::post(this_->get_executor(), std::move(self));
+        BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
+        return 0u;
+      }
+
+      while (res_ == 0u && !ec)
+      {
+        // one pipe-full at a time, so the staging pipe is always drained between calls
+        res_ = this_->impl_->do_splice_body_(
+            fd, static_cast<std::size_t>((std::min)(
+                this_->direct_remaining_, static_cast<std::uint64_t>(65536u))), false, ec);
+        if (res_ == 0u && ec == asio::error::would_block)
+        {
+          ec = {};
+          yield this_->impl_->do_async_wait_readable_(std::move(self));
+        }
+      }
+      this_->direct_remaining_ -= res_;
+
+      if (this_->direct_remaining_ == 0u)
+      {
+        this_->parser_->get().body().more = false;
+        this_->mark_body_complete_();
+        if (interpret_keep_alive_response(this_->impl_->get_keep_alive_set_(), this_->parser_->get(), ec))
+        {
+          ec_ = ec;
+          yield this_->impl_->do_async_close_(std::move(self));
+          ec = ec_;
+        }
+      }
+      return res_;
+    }
+    return 0u;
+  }
+};
+
+template<typename Executor>
+template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code, std::size_t)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code, std::size_t))
+basic_stream<Executor>::async_splice_some(int fd, CompletionToken && token)
+{
+  return detail::co_run<async_splice_some_op>(std::forward<CompletionToken>(token), this, fd);
+}
+
+#endif
+
+template<typename Executor>
+struct basic_stream<Executor>::async_stage_some_op : asio::coroutine
+{
+  using executor_type = Executor;
+  executor_type get_executor() {return this_->get_executor(); }
+
+  basic_stream * this_;
+  async_stage_some_op(basic_stream * this_) : this_(this_) {}
+
+  using completion_signature_type = void(system::error_code, std::size_t);
+  using step_signature_type       = void(system::error_code, std::size_t);
+
+  std::size_t resume(requests::detail::co_token_t<step_signature_type> self,
+                     system::error_code & ec, std::size_t n = 0u)
+  {
+    reenter(this)
+    {
+      if (this_->direct_remaining_ == 0u)
+      {
+        yield asio::post(this_->get_executor(), std::move(self));
+        BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
+        return 0u;
+      }
+      yield this_->impl_->do_async_stage_input_(std::move(self));
+      return n;
+    }
+    return 0u;
+  }
+};
+
+template<typename Executor>
+template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code, std::size_t)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code, std::size_t))
+basic_stream<Executor>::async_stage_some(CompletionToken && token)
+{
+  return detail::co_run<async_stage_some_op>(std::forward<CompletionToken>(token), this);
+}
+
+template<typename Executor>
+template<
+    typename MutableBufferSequence,
+    BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code, std::size_t)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code, std::size_t))
+basic_stream<Executor>::async_read_some_raw_(
+    const MutableBufferSequence & buffers,
+    CompletionToken && token)
 {
   return detail::co_run<async_read_some_op>(std::forward<CompletionToken>(token), this, buffers);
 }
@@ -330,6 +953,8 @@ struct basic_stream<Executor>::async_dump_op : asio::coroutine
   using mutex_type = detail::basic_mutex<executor_type>;
 
   char buffer[BOOST_REQUESTS_CHUNK_SIZE];
+  // kept in the frame so the buffer_span handed down stays valid in flight
+  asio::mutable_buffer chunk_;
   using lock_type = asem::lock_guard<detail::basic_mutex<executor_type>>;
   lock_type lock;
   system::error_code ec_;
@@ -344,6 +969,28 @@ struct basic_stream<Executor>::async_dump_op : asio::coroutine
   {
     reenter(this)
     {
+      if (this_->parser_ && this_->direct_)
+      {
+        while (this_->direct_remaining_ > 0u && !ec)
+        {
+          chunk_ = asio::buffer(buffer, static_cast<std::size_t>(
+              (std::min)(this_->direct_remaining_,
+                         static_cast<std::uint64_t>(BOOST_REQUESTS_CHUNK_SIZE))));
+          yield this_->impl_->do_async_read_body_direct_(chunk_, std::move(self));
+          this_->direct_remaining_ -= n;
+        }
+
+        this_->parser_->get().body().more = false;
+        this_->mark_body_complete_();
+        if (interpret_keep_alive_response(this_->impl_->get_keep_alive_set_(), this_->parser_->get(), ec))
+        {
+          ec_ = ec;
+          yield this_->impl_->do_async_close_(std::move(self));
+          ec = ec_;
+        }
+        return;
+      }
+
       if (!this_->parser_ || !this_->parser_->is_done())
       {
         yield asio::post(this_->get_executor(), std::move(self));
@@ -359,6 +1006,7 @@ struct basic_stream<Executor>::async_dump_op : asio::coroutine
         yield this_->impl_->do_async_read_some_(*this_->parser_, std::move(self));
       }
 
+      this_->mark_body_complete_();
       if (interpret_keep_alive_response(this_->impl_->get_keep_alive_set_(), this_->parser_->get(), ec))
       {
         ec_ = ec ;
@@ -374,6 +1022,8 @@ template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code)) Compl
 BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code))
 basic_stream<Executor>::async_dump(CompletionToken && token)
 {
+  if (headers_pending_())
+    return detail::co_run<async_dump_pipeline_op>(std::forward<CompletionToken>(token), this);
   return detail::co_run<async_dump_op>(std::forward<CompletionToken>(token), this);
 }
 
@@ -382,9 +1032,58 @@ basic_stream<Executor>::async_dump(CompletionToken && token)
 template<typename Executor>
 basic_stream<Executor>::~basic_stream()
 {
+  // an unread pipelined response would desync the connection for the
+  // streams queued behind this one, so consume it here.
+  if (headers_pending_() && impl_ && impl_->is_open())
+  {
+    system::error_code ec;
+    ensure_headers_(ec);
+    if (!ec)
+    {
+      if (drain_is_cheap_())
+        dump(ec);
+      else
+        impl_->do_close_(ec);
+    }
+    impl_->do_release_buffer_();
+    return;
+  }
+
   if (parser_ && parser_->is_header_done() && !parser_->is_done()
       && parser_->get().body().more && impl_ && impl_->is_open())
-    dump();
+  {
+    // cancelling a request lands here, too: the aborted read left the
+    // body unread and the caller dropped the stream.
+    if (drain_is_cheap_())
+    {
+      if (!detached_drain_)
+      {
+        // hand the remainder to the executor instead of blocking this
+        // thread on socket reads, like the hedged loser drain. The read
+        // lock, buffer and budget slot move along, so the connection only
+        // returns to the pool once the wire is clean. Should the handler
+        // never run (executor teardown), the inner destructor falls back
+        // to the synchronous dump below.
+        auto sp = std::make_shared<basic_stream>(std::move(*this));
+        sp->detached_drain_ = true;
+        auto & ref = *sp;
+        ref.async_dump([sp](system::error_code) {});
+        return;
+      }
+      system::error_code ec;
+      dump(ec);
+    }
+    else
+    {
+      system::error_code ec;
+      impl_->do_close_(ec);
+    }
+  }
+
+  // the read lock is still held here, so no other stream can be using the
+  // connection's staging buffer while it goes back to the pool.
+  if (impl_ != nullptr && parser_ != nullptr)
+    impl_->do_release_buffer_();
 }
 
 }
@@ -12,6 +12,8 @@
 #include <boost/json.hpp>
 #include <boost/requests/body_traits.hpp>
 #include <boost/requests/detail/async_coroutine.hpp>
+#include <boost/requests/detail/chunk_sizer.hpp>
+#include <boost/requests/detail/parser_pool.hpp>
 #include <boost/requests/error.hpp>
 #include <boost/requests/fields/link.hpp>
 #include <boost/requests/http.hpp>
@@ -21,6 +23,16 @@
 #include <boost/json/parser.hpp>
 #include <boost/json/value.hpp>
 
+// parser_for is the SAX parser behind json::parse_into; where available it
+// lets read_json decode straight into a described struct without building
+// an intermediate json::value.
+#if defined(__has_include)
+# if __has_include(<boost/json/parse_into.hpp>)
+#  include <boost/json/parse_into.hpp>
+#  define BOOST_REQUESTS_HAS_PARSE_INTO 1
+# endif
+#endif
+
 #include <boost/range.hpp>
 #include <vector>
 
@@ -92,8 +104,11 @@ inline auto as_json(const response & res,
                     json::storage_ptr ptr,
                     system::error_code & ec) -> json::value
 {
-  json::parser ps;
-  ps.write(res.string_view(), ec);
+  auto lease = detail::default_parser_pool().acquire(std::move(ptr));
+  auto & ps = lease.parser();
+  ps.write(res.string_view().data(), res.string_view().size(), ec);
+  if (!ec)
+    ps.finish(ec);
   if (ec)
     return nullptr;
   else
@@ -143,34 +158,60 @@ struct response : response_base
 
 };
 
-template<typename Value = value, typename Stream>
-Value read_json(Stream & str, json::storage_ptr ptr = {})
+namespace detail
 {
-  ::boost::json::stream_parser sp{ptr};
-  char buffer[BOOST_REQUESTS_CHUNK_SIZE];
-  while (!sp.done() && !str.done())
-  {
-    const auto n = str.read_some(asio::buffer(buffer));
-    sp.write_some(buffer, n);
-  }
-  sp.finish();
-  return ::boost::json::value_to<Value>(sp.release());
-}
 
-template<typename Value = value,
-         typename Stream>
-Value read_json(Stream & str,
-                json::storage_ptr ptr,
-                system::error_code & ec)
+// Parsing via the DOM costs two traversals and a full json::value
+// allocation; typed values go through the direct overloads below when
+// parse_into is available, json::value itself always takes this path.
+#if defined(BOOST_REQUESTS_HAS_PARSE_INTO)
+template<typename Value>
+using read_json_via_dom = std::is_same<Value, value>;
+#else
+template<typename Value>
+using read_json_via_dom = std::true_type;
+#endif
+
+template<typename Value, typename Stream>
+Value read_json_impl(Stream & str,
+                     json::storage_ptr ptr,
+                     system::error_code & ec,
+                     std::true_type /* via dom */)
 {
-  ::boost::json::stream_parser sp{ptr};
-  char buffer[BOOST_REQUESTS_CHUNK_SIZE];
-  while (!sp.done() && !ec && !str.done())
+  auto lease = requests::detail::default_parser_pool().acquire(std::move(ptr));
+  auto & sp = lease.parser();
+  if (str.peek_ready())
   {
-    const auto n = str.read_some(asio::buffer(buffer), ec);
-    if (ec)
-      break;
-    sp.write_some(buffer, n, ec);
+    // the body bytes already sit in the stream's staging buffer; feed the
+    // parser in place and consume exactly what it took, no copy in between.
+    while (!sp.done() && !ec && !str.done())
+    {
+      const auto in = str.peek_some();
+      if (in.size() == 0u)
+      {
+        str.stage_some(ec);
+        continue;
+      }
+      const auto n = sp.write_some(static_cast<const char*>(in.data()), in.size(), ec);
+      if (ec)
+        break;
+      str.consume(n, ec);
+    }
+  }
+  else
+  {
+    // adaptive chunks out of recycled storage, see detail::chunk_sizer
+    requests::detail::chunk_sizer chunk{str.content_length_remaining()};
+    requests::detail::scratch_buffer scratch;
+    while (!sp.done() && !ec && !str.done())
+    {
+      const auto mb = scratch.prepare(chunk.size());
+      const auto n = str.read_some(mb, ec);
+      chunk.update(n);
+      if (ec)
+        break;
+      sp.write_some(static_cast<const char*>(mb.data()), n, ec);
+    }
   }
   if (!ec)
     sp.finish(ec);
@@ -187,27 +228,214 @@ Value read_json(Stream & str,
     return res.value();
 }
 
-template<typename Value = value, typename Stream>
-optional<Value> read_optional_json(Stream & str, json::storage_ptr ptr = {})
+template<typename Value, typename Stream>
+optional<Value> read_optional_json_impl(Stream & str,
+                                        json::storage_ptr ptr,
+                                        system::error_code & ec,
+                                        std::true_type /* via dom */)
 {
-  ::boost::json::stream_parser sp{ptr};
-  char buffer[BOOST_REQUESTS_CHUNK_SIZE];
+  auto lease = requests::detail::default_parser_pool().acquire(std::move(ptr));
+  auto & sp = lease.parser();
+  if (str.peek_ready())
+  {
+    // a peek-ready stream has a non-empty body, so the empty check of the
+    // copying path below can't hit
+    while (!sp.done() && !ec && !str.done())
+    {
+      const auto in = str.peek_some();
+      if (in.size() == 0u)
+      {
+        str.stage_some(ec);
+        continue;
+      }
+      const auto w = sp.write_some(static_cast<const char*>(in.data()), in.size(), ec);
+      if (ec)
+        break;
+      str.consume(w, ec);
+    }
+  }
+  else
+  {
+    // adaptive chunks out of recycled storage, see detail::chunk_sizer
+    requests::detail::chunk_sizer chunk{str.content_length_remaining()};
+    requests::detail::scratch_buffer scratch;
+
+    auto mb = scratch.prepare(chunk.size());
+    auto n = str.read_some(mb, ec);
+    chunk.update(n);
+    if (n == 0u && str.done())
+      return boost::none;
+    if (ec)
+      return boost::none;
+    sp.write_some(static_cast<const char*>(mb.data()), n, ec);
+
+    while (!sp.done() && !ec && !str.done())
+    {
+      mb = scratch.prepare(chunk.size());
+      n = str.read_some(mb, ec);
+      chunk.update(n);
+      if (ec)
+        break;
+      sp.write_some(static_cast<const char*>(mb.data()), n, ec);
+    }
+  }
+  if (!ec)
+    sp.finish(ec);
+  if (ec)
+    return boost::none;
 
-  auto n = str.read_some(asio::buffer(buffer));
-  if (n == 0u && str.done())
+  auto res =  ::boost::json::try_value_to<Value>(sp.release());
+  if (res.has_error())
+  {
+    ec = res.error();
     return boost::none;
+  }
+  else
+    return optional<Value>(std::move(res.value()));
+}
+
+#if defined(BOOST_REQUESTS_HAS_PARSE_INTO)
 
-  sp.write_some(buffer, n);
-  while (!sp.done() && !str.done())
+// The SAX handler feeds Value's described/tag_invoke mapping as the body
+// comes off the wire; the only allocations are Value's own.
+template<typename Value, typename Stream>
+Value read_json_impl(Stream & str,
+                     json::storage_ptr,
+                     system::error_code & ec,
+                     std::false_type /* via dom */)
+{
+  Value res{};
+  ::boost::json::parser_for<Value> sp{::boost::json::parse_options(), &res};
+  if (str.peek_ready())
+  {
+    while (!sp.done() && !ec && !str.done())
+    {
+      const auto in = str.peek_some();
+      if (in.size() == 0u)
+      {
+        str.stage_some(ec);
+        continue;
+      }
+      const auto n = sp.write_some(true, static_cast<const char*>(in.data()), in.size(), ec);
+      if (ec)
+        break;
+      str.consume(n, ec);
+    }
+  }
+  else
   {
-    n = str.read_some(asio::buffer(buffer));
-    sp.write_some(buffer, n);
+    // adaptive chunks out of recycled storage, see detail::chunk_sizer
+    requests::detail::chunk_sizer chunk{str.content_length_remaining()};
+    requests::detail::scratch_buffer scratch;
+    while (!sp.done() && !ec && !str.done())
+    {
+      const auto mb = scratch.prepare(chunk.size());
+      const auto n = str.read_some(mb, ec);
+      chunk.update(n);
+      if (ec)
+        break;
+      sp.write_some(true, static_cast<const char*>(mb.data()), n, ec);
+    }
   }
-  sp.finish();
-  if (std::is_same<Value, value>::value)
-    return sp.release();
+  if (!ec && !sp.done())
+    sp.write_some(false, nullptr, 0u, ec);
+  if (ec)
+    return Value();
+  return res;
+}
+
+template<typename Value, typename Stream>
+optional<Value> read_optional_json_impl(Stream & str,
+                                        json::storage_ptr,
+                                        system::error_code & ec,
+                                        std::false_type /* via dom */)
+{
+  Value res{};
+  ::boost::json::parser_for<Value> sp{::boost::json::parse_options(), &res};
+  if (str.peek_ready())
+  {
+    // a peek-ready stream has a non-empty body, so the empty check of the
+    // copying path below can't hit
+    while (!sp.done() && !ec && !str.done())
+    {
+      const auto in = str.peek_some();
+      if (in.size() == 0u)
+      {
+        str.stage_some(ec);
+        continue;
+      }
+      const auto w = sp.write_some(true, static_cast<const char*>(in.data()), in.size(), ec);
+      if (ec)
+        break;
+      str.consume(w, ec);
+    }
+  }
+  else
+  {
+    // adaptive chunks out of recycled storage, see detail::chunk_sizer
+    requests::detail::chunk_sizer chunk{str.content_length_remaining()};
+    requests::detail::scratch_buffer scratch;
+
+    auto mb = scratch.prepare(chunk.size());
+    auto n = str.read_some(mb, ec);
+    chunk.update(n);
+    if (n == 0u && str.done())
+      return boost::none;
+    if (ec)
+      return boost::none;
+    sp.write_some(true, static_cast<const char*>(mb.data()), n, ec);
+
+    while (!sp.done() && !ec && !str.done())
+    {
+      mb = scratch.prepare(chunk.size());
+      n = str.read_some(mb, ec);
+      chunk.update(n);
+      if (ec)
+        break;
+      sp.write_some(true, static_cast<const char*>(mb.data()), n, ec);
+    }
+  }
+  if (!ec && !sp.done())
+    sp.write_some(false, nullptr, 0u, ec);
+  if (ec)
+    return boost::none;
+  return optional<Value>(std::move(res));
+}
+
+#endif
+
+}
+
+template<typename Value = value, typename Stream>
+Value read_json(Stream & str, json::storage_ptr ptr = {})
+{
+  boost::system::error_code ec;
+  auto res = detail::read_json_impl<Value>(str, std::move(ptr), ec,
+                                           detail::read_json_via_dom<Value>{});
+  if (ec)
+    urls::detail::throw_system_error(ec);
+  return res;
+}
+
+template<typename Value = value,
+         typename Stream>
+Value read_json(Stream & str,
+                json::storage_ptr ptr,
+                system::error_code & ec)
+{
+  return detail::read_json_impl<Value>(str, std::move(ptr), ec,
+                                       detail::read_json_via_dom<Value>{});
+}
 
-  return ::boost::json::value_to<Value>(sp.release());
+template<typename Value = value, typename Stream>
+optional<Value> read_optional_json(Stream & str, json::storage_ptr ptr = {})
+{
+  boost::system::error_code ec;
+  auto res = detail::read_optional_json_impl<Value>(str, std::move(ptr), ec,
+                                                    detail::read_json_via_dom<Value>{});
+  if (ec)
+    urls::detail::throw_system_error(ec);
+  return res;
 }
 
 template<typename Value = value,
@@ -217,37 +445,166 @@ optional<Value> read_optional_json(
                 json::storage_ptr ptr,
                 system::error_code & ec)
 {
-  ::boost::json::stream_parser sp{ptr};
-  char buffer[BOOST_REQUESTS_CHUNK_SIZE];
+  return detail::read_optional_json_impl<Value>(str, std::move(ptr), ec,
+                                                detail::read_json_via_dom<Value>{});
+}
 
-  auto n = str.read_some(asio::buffer(buffer));
-  if (n == 0u && str.done())
-    return boost::none;
-  sp.write_some(buffer, n, ec);
+namespace detail
+{
+template<typename Stream>
+struct async_read_next_op;
+}
 
-  while (!sp.done() && !ec && !str.done())
+// Reads one JSON document at a time from a live stream carrying
+// JSON-Lines / NDJSON, i.e. documents separated by whitespace. One
+// parser and its arena are checked out of the parser pool for the
+// lifetime of the reader, and bytes read past the end of a document are
+// carried over to the next one, so nothing gets copied twice.
+template<typename Stream>
+struct stream_reader
+{
+  explicit stream_reader(Stream & str, json::storage_ptr ptr = {})
+      : str_(&str), ptr_(std::move(ptr)),
+        lease_(requests::detail::default_parser_pool().acquire(ptr_))
   {
-    n = str.read_some(asio::buffer(buffer), ec);
-    if (ec)
-      break;
-    sp.write_some(buffer, n, ec);
   }
-  if (!ec)
-    sp.finish(ec);
-  if (ec)
-    return Value();
 
-  if (std::is_same<Value, value>::value)
+  /// Whether the underlying stream is exhausted and the carry buffer drained.
+  bool done() const
+  {
+    return pos_ == size_ && str_->done();
+  }
+
+  /// Parse the next document; none at a clean end of the stream,
+  /// ec set if the stream ends inside a document.
+  optional<value> read_next(system::error_code & ec)
+  {
+    auto & sp = lease_.parser();
+    sp.reset(ptr_);
+    bool started = false;
+    while (!ec)
+    {
+      if (pos_ == size_)
+      {
+        if (str_->done())
+          break;
+        pos_ = 0u;
+        size_ = str_->read_some(asio::buffer(buffer_), ec);
+        continue;
+      }
+      if (!started)
+      {
+        while (pos_ < size_ && is_ws_(buffer_[pos_]))
+          pos_++;
+        if (pos_ == size_)
+          continue;
+        started = true;
+      }
+      pos_ += sp.write_some(buffer_ + pos_, size_ - pos_, ec);
+      if (!ec && sp.done())
+        return sp.release();
+    }
+    if (ec || !started)
+      return boost::none;
+    sp.finish(ec); // the stream ended inside the document
+    if (ec)
+      return boost::none;
     return sp.release();
+  }
 
-  auto res =  ::boost::json::try_value_to<Value>(sp.release());
-  if (res.has_error())
+  optional<value> read_next()
   {
-    ec = res.error();
-    return Value();
+    boost::system::error_code ec;
+    auto res = read_next(ec);
+    if (ec)
+      urls::detail::throw_system_error(ec);
+    return res;
   }
-  else
-    return res.value();
+
+  template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, optional<value>)) CompletionToken
+               BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(typename Stream::executor_type)>
+  BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code, optional<value>))
+  async_read_next(CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN( typename Stream::executor_type))
+  {
+    return requests::detail::co_run<
+        detail::async_read_next_op<Stream>>(std::forward<CompletionToken>(completion_token), this);
+  }
+
+ private:
+  template<typename>
+  friend struct detail::async_read_next_op;
+
+  static bool is_ws_(char c)
+  {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+  }
+
+  Stream * str_;
+  json::storage_ptr ptr_;
+  requests::detail::parser_lease lease_;
+  char buffer_[BOOST_REQUESTS_CHUNK_SIZE];
+  std::size_t pos_{0u}, size_{0u};
+};
+
+namespace detail
+{
+
+template<typename Stream>
+struct async_read_next_op : asio::coroutine
+{
+  using executor_type = typename Stream::executor_type;
+  executor_type get_executor() {return rd.str_->get_executor(); }
+
+  using completion_signature_type = void(system::error_code, optional<value>);
+  using step_signature_type       = void(system::error_code, std::size_t);
+
+  stream_reader<Stream> & rd;
+  bool started = false;
+
+  async_read_next_op(stream_reader<Stream> * rd) : rd(*rd) {}
+
+  optional<value> resume(requests::detail::co_token_t<step_signature_type> self,
+                         system::error_code & ec, std::size_t n = 0u)
+  {
+    reenter(this)
+    {
+      rd.lease_.parser().reset(rd.ptr_);
+      while (!ec)
+      {
+        if (rd.pos_ == rd.size_)
+        {
+          if (rd.str_->done())
+            break;
+          yield rd.str_->async_read_some(asio::buffer(rd.buffer_), std::move(self));
+          if (ec)
+            return boost::none;
+          rd.pos_ = 0u;
+          rd.size_ = n;
+          continue;
+        }
+        if (!started)
+        {
+          while (rd.pos_ < rd.size_ && stream_reader<Stream>::is_ws_(rd.buffer_[rd.pos_]))
+            rd.pos_++;
+          if (rd.pos_ == rd.size_)
+            continue;
+          started = true;
+        }
+        rd.pos_ += rd.lease_.parser().write_some(rd.buffer_ + rd.pos_, rd.size_ - rd.pos_, ec);
+        if (!ec && rd.lease_.parser().done())
+          return rd.lease_.parser().release();
+      }
+      if (ec || !started)
+        return boost::none;
+      rd.lease_.parser().finish(ec); // the stream ended inside the document
+      if (ec)
+        return boost::none;
+      return rd.lease_.parser().release();
+    }
+    return boost::none;
+  }
+};
+
 }
 
 inline void set_accept_headers(http::fields & hd)
@@ -704,22 +1061,59 @@ struct async_read_json_op : asio::coroutine
   using step_signature_type       = void(system::error_code, std::size_t);
 
   Stream &str;
-  ::boost::json::stream_parser sp;
-  char buffer[BOOST_REQUESTS_CHUNK_SIZE];
+  requests::detail::parser_lease lease;
+  ::boost::json::stream_parser &sp;
+  // adaptive chunks out of recycled storage, see detail::chunk_sizer
+  requests::detail::chunk_sizer chunk;
+  requests::detail::scratch_buffer scratch;
+  asio::mutable_buffer mb;
 
-  async_read_json_op(Stream * str, json::storage_ptr ptr) : str(*str), sp{ptr} {}
+  async_read_json_op(Stream * str, json::storage_ptr ptr)
+      : str(*str), lease(requests::detail::default_parser_pool().acquire(std::move(ptr))),
+        sp(lease.parser()) {}
 
   value resume(requests::detail::co_token_t<step_signature_type> self,
                system::error_code & ec, std::size_t n = 0u)
   {
     reenter(this)
     {
-      while (!sp.done() && !str.done())
+      if (str.peek_ready())
+      {
+        // feed the parser in place from the staging buffer, see read_json_impl
+        while (!sp.done() && !str.done())
+        {
+          if (str.peek_some().size() == 0u)
+          {
+            yield str.async_stage_some(std::move(self));
+            if (ec)
+              return nullptr;
+            continue;
+          }
+          {
+            const auto in = str.peek_some();
+            const auto w = sp.write_some(static_cast<const char*>(in.data()), in.size(), ec);
+            if (ec)
+              return nullptr;
+            str.consume(w, ec);
+            if (ec)
+              return nullptr;
+          }
+        }
+      }
+      else
       {
-        yield str.async_read_some(asio::buffer(buffer), std::move(self));
-        if (ec)
-          return nullptr;
-        sp.write_some(buffer, n, ec);
+        chunk = requests::detail::chunk_sizer{str.content_length_remaining()};
+        while (!sp.done() && !str.done())
+        {
+          yield {
+            mb = scratch.prepare(chunk.size());
+            str.async_read_some(mb, std::move(self));
+          }
+          chunk.update(n);
+          if (ec)
+            return nullptr;
+          sp.write_some(static_cast<const char*>(mb.data()), n, ec);
+        }
       }
       if (!ec)
         sp.finish(ec);
@@ -743,27 +1137,69 @@ struct async_read_optional_json_op : asio::coroutine
   using step_signature_type       = void(system::error_code, std::size_t);
 
   Stream & str;
-  ::boost::json::stream_parser sp;
-  char buffer[BOOST_REQUESTS_CHUNK_SIZE];
+  requests::detail::parser_lease lease;
+  ::boost::json::stream_parser &sp;
+  // adaptive chunks out of recycled storage, see detail::chunk_sizer
+  requests::detail::chunk_sizer chunk;
+  requests::detail::scratch_buffer scratch;
+  asio::mutable_buffer mb;
 
-  async_read_optional_json_op(Stream * str, json::storage_ptr ptr) : str(*str), sp{ptr} {}
+  async_read_optional_json_op(Stream * str, json::storage_ptr ptr)
+      : str(*str), lease(requests::detail::default_parser_pool().acquire(std::move(ptr))),
+        sp(lease.parser()) {}
 
   optional<value> resume(requests::detail::co_token_t<step_signature_type> self,
                          system::error_code & ec, std::size_t n = 0u)
   {
     reenter(this)
     {
-      yield str.async_read_some(asio::buffer(buffer), std::move(self));
-      if (n == 0  && str.done())
-        return boost::none;
-      sp.write_some(buffer, n, ec);
-
-      while (!sp.done() && !str.done())
+      if (str.peek_ready())
+      {
+        // a peek-ready stream has a non-empty body, so the empty check of
+        // the copying path below can't hit
+        while (!sp.done() && !str.done())
+        {
+          if (str.peek_some().size() == 0u)
+          {
+            yield str.async_stage_some(std::move(self));
+            if (ec)
+              return boost::none;
+            continue;
+          }
+          {
+            const auto in = str.peek_some();
+            const auto w = sp.write_some(static_cast<const char*>(in.data()), in.size(), ec);
+            if (ec)
+              return boost::none;
+            str.consume(w, ec);
+            if (ec)
+              return boost::none;
+          }
+        }
+      }
+      else
       {
-        yield str.async_read_some(asio::buffer(buffer), std::move(self));
-        if (ec)
+        chunk = requests::detail::chunk_sizer{str.content_length_remaining()};
+        yield {
+          mb = scratch.prepare(chunk.size());
+          str.async_read_some(mb, std::move(self));
+        }
+        chunk.update(n);
+        if (n == 0  && str.done())
           return boost::none;
-        sp.write_some(buffer, n, ec);
+        sp.write_some(static_cast<const char*>(mb.data()), n, ec);
+
+        while (!sp.done() && !str.done())
+        {
+          yield {
+            mb = scratch.prepare(chunk.size());
+            str.async_read_some(mb, std::move(self));
+          }
+          chunk.update(n);
+          if (ec)
+            return boost::none;
+          sp.write_some(static_cast<const char*>(mb.data()), n, ec);
+        }
       }
       if (!ec)
         sp.finish(ec);
@@ -9,7 +9,9 @@
 
 #include <boost/system/error_code.hpp>
 #include <boost/requests/http.hpp>
+#include <boost/requests/prepared_request.hpp>
 #include <boost/requests/request.hpp>
+#include <boost/requests/request_options.hpp>
 #include <boost/requests/response.hpp>
 
 namespace boost
@@ -102,6 +104,80 @@ auto post(Connection & conn,
 }
 
 
+// ---- borrowed header prototypes ----
+// For the hot path of identical headers over millions of calls: the
+// prototype is borrowed by const reference and never copied; per call
+// only the request line and Host/Cookie/Content-Length are layered
+// around the pre-serialized block, see prepared_request. Redirects are
+// not followed on this path, they come back to the caller.
+
+template<typename Connection>
+auto get(Connection & conn,
+         urls::url_view target,
+         const header_prototype & proto,
+         request_options opt,
+         cookie_jar * jar,
+         system::error_code & ec) -> response
+{
+  prepared_request pr{http::verb::get, target, proto};
+  auto s = conn.ropen(pr, "", std::move(opt), jar, ec);
+  response res{};
+  if (!ec)
+    s.read(res.buffer, ec);
+  res.headers = std::move(s).headers();
+  res.history = std::move(s).history();
+  return res;
+}
+
+template<typename Connection>
+auto get(Connection & conn,
+         urls::url_view target,
+         const header_prototype & proto,
+         request_options opt = {},
+         cookie_jar * jar = nullptr) -> response
+{
+  system::error_code ec;
+  auto res = get(conn, target, proto, std::move(opt), jar, ec);
+  if (ec)
+    throw_exception(system::system_error(ec, "get"));
+  return res;
+}
+
+template<typename Connection>
+auto post(Connection & conn,
+          urls::url_view target,
+          core::string_view request_body,
+          const header_prototype & proto,
+          request_options opt,
+          cookie_jar * jar,
+          system::error_code & ec) -> response
+{
+  prepared_request pr{http::verb::post, target, proto};
+  auto s = conn.ropen(pr, request_body, std::move(opt), jar, ec);
+  response res{};
+  if (!ec)
+    s.read(res.buffer, ec);
+  res.headers = std::move(s).headers();
+  res.history = std::move(s).history();
+  return res;
+}
+
+template<typename Connection>
+auto post(Connection & conn,
+          urls::url_view target,
+          core::string_view request_body,
+          const header_prototype & proto,
+          request_options opt = {},
+          cookie_jar * jar = nullptr) -> response
+{
+  system::error_code ec;
+  auto res = post(conn, target, request_body, proto, std::move(opt), jar, ec);
+  if (ec)
+    throw_exception(system::system_error(ec, "post"));
+  return res;
+}
+
+
 template<typename Connection>
 auto patch(Connection & conn,
           urls::url_view target,
@@ -21,9 +21,21 @@ using mime_type_map =
                   boost::urls::grammar::ci_hash,
                   boost::urls::grammar::ci_equal>;
 
+/// Look up the mime type for a file extension (".json", case-insensitive).
+/// Served from a hash table built at compile time: a couple of probes over
+/// static rodata, no allocation and nothing to initialize on the first
+/// request. Empty if the extension is unknown.
+BOOST_REQUESTS_DECL core::string_view mime_type_for(core::string_view extension);
+
+/// The same data as a heap map, for callers that want to iterate or copy
+/// it. Built lazily on first call; lookups should prefer mime_type_for.
 BOOST_REQUESTS_DECL const mime_type_map & default_mime_type_map();
 
 }
 }
 
+#if defined(BOOST_REQUESTS_HEADER_ONLY)
+#include <boost/requests/impl/mime_types.ipp>
+#endif
+
 #endif // BOOST_REQUESTS_MIME_TYPES_HPP
@@ -0,0 +1,271 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_MULTIPART_HPP
+#define BOOST_REQUESTS_MULTIPART_HPP
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/beast/core/file.hpp>
+#include <boost/beast/http/message.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/optional.hpp>
+#include <boost/requests/detail/config.hpp>
+#include <boost/requests/mime_types.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace requests {
+
+/// A multipart/form-data body description, the counterpart of `form` for
+/// uploads. The parts are only described here - names, inline values and
+/// file paths - and serialized incrementally by `multipart_body`, so a
+/// file part of any size needs a staging buffer of kilobytes, not a copy
+/// of the file.
+struct multipart_form
+{
+  struct part
+  {
+    std::string name;
+    std::string filename;     // only set for file parts
+    std::string content_type;
+    std::string value;        // the inline value, or the path for file parts
+    bool is_file = false;
+    std::uint64_t size = 0u;  // file parts: the size recorded by append_file
+  };
+
+  multipart_form()
+  {
+    // 16 random hex digits; the prefix makes an accidental
+    // occurrence in the payload even more unlikely.
+    std::random_device rd;
+    std::uniform_int_distribution<int> dist{0, 15};
+    boundary_ = "-----------------------boost-requests-";
+    for (int i = 0; i < 16; i++)
+      boundary_ += "0123456789abcdef"[dist(rd)];
+    content_type_ = "multipart/form-data; boundary=" + boundary_;
+  }
+
+  /// Append an inline value part.
+  void append(core::string_view name, core::string_view value,
+              core::string_view content_type = "text/plain; charset=utf-8")
+  {
+    part pt;
+    pt.name.assign(name.begin(), name.end());
+    pt.value.assign(value.begin(), value.end());
+    pt.content_type.assign(content_type.begin(), content_type.end());
+    parts_.push_back(std::move(pt));
+  }
+
+  /// Append a file part. The file is sized here but streamed from disk
+  /// during serialization; its size at this point goes into the request's
+  /// Content-Length, like beast's file_body a file that changes in
+  /// between fails the upload. An empty content_type is deduced from the
+  /// extension, falling back to application/octet-stream.
+  void append_file(core::string_view name, core::string_view path,
+                   core::string_view content_type = "")
+  {
+    part pt;
+    pt.name.assign(name.begin(), name.end());
+    pt.value.assign(path.begin(), path.end());
+
+    {
+      // a file that cannot be sized here cannot be opened during
+      // serialization either; the error surfaces when the request is sent.
+      system::error_code ec;
+      beast::file f;
+      f.open(pt.value.c_str(), beast::file_mode::read, ec);
+      if (!ec)
+        pt.size = f.size(ec);
+    }
+
+    auto fn = path;
+    const auto sl = fn.find_last_of("/\\");
+    if (sl != core::string_view::npos)
+      fn.remove_prefix(sl + 1u);
+    pt.filename.assign(fn.begin(), fn.end());
+
+    if (content_type.empty())
+    {
+      const auto dot = fn.rfind('.');
+      const auto mt = dot != core::string_view::npos ? mime_type_for(fn.substr(dot)) : core::string_view();
+      content_type = mt.empty() ? core::string_view("application/octet-stream") : mt;
+    }
+    pt.content_type.assign(content_type.begin(), content_type.end());
+    pt.is_file = true;
+    parts_.push_back(std::move(pt));
+  }
+
+  core::string_view boundary()     const { return boundary_; }
+  /// The Content-Type for the request, including the boundary parameter.
+  core::string_view content_type() const { return content_type_; }
+
+  /// The exact serialized length: boundary arithmetic plus the inline
+  /// values and the file sizes recorded by append_file. This is what
+  /// multipart_body::size reports, so the request carries a
+  /// Content-Length instead of going out chunked - intermediaries that
+  /// buffer chunked uploads whole before forwarding stream it instead.
+  std::uint64_t content_size() const
+  {
+    // the trailer: "--" + boundary + "--\r\n"
+    std::uint64_t res = boundary_.size() + 6u;
+    for (const auto & pt : parts_)
+    {
+      res += pt.name.size() + boundary_.size()
+           + sizeof("--") - 1u + sizeof("\r\nContent-Disposition: form-data; name=\"\"") - 1u;
+      if (pt.is_file)
+        res += sizeof("; filename=\"\"") - 1u + pt.filename.size();
+      res += sizeof("\r\nContent-Type: ") - 1u + pt.content_type.size() + sizeof("\r\n\r\n") - 1u;
+      res += (pt.is_file ? pt.size : pt.value.size()) + 2u; // the content & its closing crlf
+    }
+    return res;
+  }
+
+  const std::vector<part> & parts() const { return parts_; }
+
+ private:
+  std::string boundary_;
+  std::string content_type_;
+  std::vector<part> parts_;
+};
+
+/// The upload body for multipart_form. Boundaries and part headers are
+/// staged into a small string per part, inline values are served as views
+/// straight out of the form and file parts are read chunk by chunk
+/// through a staging buffer, like detail::mmap_body. The total length is
+/// known up front (see multipart_form::content_size), so the request goes
+/// out with a Content-Length and predictable framing - no per-chunk
+/// header interleaving.
+struct multipart_body
+{
+  using value_type = multipart_form;
+
+  static std::uint64_t size(const value_type & body)
+  {
+    return body.content_size();
+  }
+
+  struct writer
+  {
+    using const_buffers_type = asio::const_buffer;
+
+    template<bool IsRequest, typename Fields>
+    writer(const beast::http::header<IsRequest, Fields> &, const value_type & body)
+        : body_(body)
+    {
+    }
+
+    void init(system::error_code & ec)
+    {
+      ec = {};
+      index_ = 0u;
+      state_ = state_t::header;
+    }
+
+    boost::optional<std::pair<const_buffers_type, bool>> get(system::error_code & ec)
+    {
+      ec = {};
+      switch (state_)
+      {
+      case state_t::header:
+      {
+        stage_.clear();
+        stage_ += "--";
+        stage_.append(body_.boundary().begin(), body_.boundary().end());
+        if (index_ == body_.parts().size())
+        {
+          stage_ += "--\r\n";
+          state_ = state_t::done;
+          return std::make_pair(const_buffers_type(stage_.data(), stage_.size()), false);
+        }
+        const auto & pt = body_.parts()[index_];
+        stage_ += "\r\nContent-Disposition: form-data; name=\"";
+        stage_ += pt.name;
+        stage_ += '"';
+        if (pt.is_file)
+        {
+          stage_ += "; filename=\"";
+          stage_ += pt.filename;
+          stage_ += '"';
+        }
+        stage_ += "\r\nContent-Type: ";
+        stage_ += pt.content_type;
+        stage_ += "\r\n\r\n";
+
+        if (pt.is_file)
+        {
+          file_.open(pt.value.c_str(), beast::file_mode::read, ec);
+          if (ec)
+            return boost::none;
+          // the size recorded by append_file, i.e. the announced framing
+          remain_ = pt.size;
+          state_ = state_t::file;
+        }
+        else
+          state_ = state_t::value;
+        return std::make_pair(const_buffers_type(stage_.data(), stage_.size()), true);
+      }
+      case state_t::value:
+      {
+        const auto & pt = body_.parts()[index_];
+        state_ = state_t::crlf;
+        return std::make_pair(const_buffers_type(pt.value.data(), pt.value.size()), true);
+      }
+      case state_t::file:
+      {
+        if (remain_ == 0u)
+        {
+          file_.close(ec);
+          if (ec)
+            return boost::none;
+          index_++;
+          state_ = state_t::header;
+          return std::make_pair(const_buffers_type("\r\n", 2u), true);
+        }
+        const auto n = file_.read(
+            buffer_, (std::min)(remain_, static_cast<std::uint64_t>(sizeof(buffer_))), ec);
+        if (ec)
+          return boost::none;
+        if (n == 0u)
+        {
+          // the file shrank since append_file sized it - the announced
+          // Content-Length cannot be met anymore
+          BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
+          return boost::none;
+        }
+        remain_ -= n;
+        return std::make_pair(const_buffers_type(buffer_, n), true);
+      }
+      case state_t::crlf:
+        index_++;
+        state_ = state_t::header;
+        return std::make_pair(const_buffers_type("\r\n", 2u), true);
+      case state_t::done:
+      default:
+        return boost::none;
+      }
+    }
+
+   private:
+    enum class state_t { header, value, file, crlf, done };
+
+    const value_type & body_;
+    state_t state_{state_t::header};
+    std::size_t index_{0u};
+    std::string stage_;
+    beast::file file_;
+    std::uint64_t remain_{0u};
+    char buffer_[BOOST_REQUESTS_CHUNK_SIZE];
+  };
+};
+
+}
+}
+
+#endif // BOOST_REQUESTS_MULTIPART_HPP
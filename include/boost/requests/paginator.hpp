@@ -0,0 +1,271 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_PAGINATOR_HPP
+#define BOOST_REQUESTS_PAGINATOR_HPP
+
+#include <boost/requests/body_traits.hpp>
+#include <boost/requests/fields/link.hpp>
+#include <boost/requests/session.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/url/url.hpp>
+#include <algorithm>
+
+namespace boost {
+namespace requests {
+
+/// The URL of the page following the one `hd` belongs to, taken from the
+/// rel="next" entry of its Link field (RFC 5988) and resolved against
+/// `base` - the URL the page itself was fetched from, since the link may
+/// be relative. An empty url when there is none: the walk is over.
+inline urls::url next_page_url(const http::response_header & hd, urls::url_view base)
+{
+  const auto itr = hd.base().find(http::field::link);
+  if (itr == hd.base().end())
+    return urls::url();
+  const auto links = parse_link_field(itr->value());
+  if (links.has_error())
+    return urls::url(); // a malformed field means no next page, not a failure
+  for (const auto & l : *links)
+  {
+    const auto rel = l.rel();
+    if (rel.has_error())
+      continue;
+    if (std::none_of(rel->begin(), rel->end(),
+                     [](core::string_view r) { return urls::grammar::ci_is_equal(r, "next"); }))
+      continue;
+    urls::url res;
+    if (urls::resolve(base, l.url, res).has_value())
+      return res;
+  }
+  return urls::url();
+}
+
+/// Walks a paginated API along the Link field's rel="next" chain
+/// (RFC 5988), the way GitHub-style APIs paginate, and hands the pages
+/// out as response streams. The asynchronous side fetches ahead: as soon
+/// as a page is handed out, the following page is requested over the
+/// session's pool while the caller still consumes the current body, so
+/// the walk overlaps the per-page round trip instead of paying it
+/// between every two pages.
+///
+/// Everything runs through the session the paginator was built on, with
+/// the usual I/O-object discipline: one thread (or strand), one
+/// next()/async_next() at a time. The synchronous next() cannot overlap
+/// anything - the calling thread is busy reading - and must not be mixed
+/// with async_next on the same paginator. A fetched-ahead page that is
+/// never collected is simply dropped with the paginator.
+template<typename Executor = asio::any_io_executor>
+struct basic_paginator
+{
+  /// The type of the executor associated with the object.
+  typedef Executor executor_type;
+
+  using stream = basic_stream<Executor>;
+
+  /// Start a walk at `first`; `headers` ride along on every page request.
+  basic_paginator(basic_session<Executor> & sess,
+                  urls::url_view first,
+                  http::fields headers = {})
+      : st_(std::make_shared<state_>(&sess, urls::url(first), std::move(headers)))
+  {
+  }
+
+  /// Get the executor associated with the object.
+  executor_type get_executor() BOOST_ASIO_NOEXCEPT
+  {
+    return st_->session->get_executor();
+  }
+
+  /// Whether the chain is exhausted: no next page on file and none underway.
+  bool done() const
+  {
+    return st_->next.empty() && !st_->in_flight && !st_->landed;
+  }
+
+  /// The URL the next page comes from; empty once the walk is over.
+  urls::url_view next_url() const { return st_->next; }
+
+  /// Fetch the next page, strictly serially; asio::error::eof once the
+  /// chain is exhausted.
+  stream next(system::error_code & ec)
+  {
+    auto & st = *st_;
+    if (st.next.empty())
+    {
+      static constexpr auto loc((BOOST_CURRENT_LOCATION));
+      BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
+      return stream{get_executor(), nullptr};
+    }
+    auto str = st.session->ropen(beast::http::verb::get, urls::url_view(st.next),
+                                 empty{}, http::fields(st.headers), ec);
+    if (!ec)
+      st.next = next_page_url(str.headers(), st.next);
+    return str;
+  }
+
+  stream next()
+  {
+    boost::system::error_code ec;
+    auto res = next(ec);
+    if (ec)
+      throw_exception(system::system_error(ec, "next"));
+    return res;
+  }
+
+  /// Fetch the next page and start the one after it in the background.
+  template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, basic_stream<Executor>)) CompletionToken
+                BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code, basic_stream<Executor>))
+  async_next(CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
+
+private:
+  // Shared with the fetch-ahead handler, which keeps it alive past the
+  // paginator if need be, so an abandoned walk runs out harmlessly.
+  struct state_
+  {
+    basic_session<Executor> * session;
+    urls::url next;
+    http::fields headers;
+
+    // the page fetched ahead of the caller - either still flying or
+    // landed - and the bell a parked async_next waits on
+    bool in_flight = false;
+    bool landed = false;
+    system::error_code ec;
+    optional<stream> str;
+    optional<asio::steady_timer> bell;
+
+    state_(basic_session<Executor> * session, urls::url next, http::fields headers)
+        : session(session), next(std::move(next)), headers(std::move(headers))
+    {
+    }
+  };
+  std::shared_ptr<state_> st_;
+
+  // Fire the fetch of the page after the one just handed out. The
+  // session pool gives it its own connection, so it downloads while the
+  // caller reads the current body.
+  static void start_prefetch_(const std::shared_ptr<state_> & st)
+  {
+    if (st->next.empty() || st->in_flight || st->landed)
+      return;
+    st->in_flight = true;
+    st->session->async_ropen(
+        beast::http::verb::get, urls::url_view(st->next), empty{}, http::fields(st->headers),
+        [st](system::error_code ec, stream str)
+        {
+          st->in_flight = false;
+          st->landed = true;
+          st->ec = ec;
+          st->str.emplace(std::move(str));
+          if (!ec)
+            st->next = next_page_url(st->str->headers(), st->next);
+          if (st->bell)
+            st->bell->cancel();
+        });
+  }
+
+  struct async_next_op;
+};
+
+typedef basic_paginator<> paginator;
+
+}
+}
+
+#include <boost/asio/yield.hpp>
+
+namespace boost {
+namespace requests {
+
+template<typename Executor>
+struct basic_paginator<Executor>::async_next_op : asio::coroutine
+{
+  using executor_type = Executor;
+  executor_type get_executor() { return st->session->get_executor(); }
+
+  std::shared_ptr<state_> st;
+  optional<stream> res;
+
+  template<typename Self>
+  void operator()(Self && self, error_code ec, stream str)
+  {
+    res.emplace(std::move(str));
+    (*this)(std::move(self), ec);
+  }
+
+  template<typename Self>
+  void operator()(Self && self, error_code ec = {})
+  {
+    reenter(this)
+    {
+      for (;;)
+      {
+        // the page already landed ahead of us
+        if (st->landed)
+        {
+          yield asio::post(get_executor(), std::move(self));
+          ec = st->ec;
+          res = std::move(st->str);
+          st->landed = false;
+          st->str.reset();
+          st->ec = {};
+          if (!ec)
+            start_prefetch_(st); // the page after, while the caller reads this one
+          return self.complete(ec, std::move(*res));
+        }
+        // the fetch ahead is still flying - park on the bell
+        if (st->in_flight)
+        {
+          if (!st->bell)
+            st->bell.emplace(get_executor(), std::chrono::steady_clock::time_point::max());
+          yield st->bell->async_wait(std::move(self));
+          ec = {}; // woken by the cancel
+          continue;
+        }
+        if (st->next.empty())
+        {
+          yield asio::post(get_executor(), std::move(self));
+          {
+            static constexpr auto loc((BOOST_CURRENT_LOCATION));
+            BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::eof);
+          }
+          return self.complete(ec, stream{get_executor(), nullptr});
+        }
+        // nothing underway - the first page: fetch it ourselves
+        yield st->session->async_ropen(beast::http::verb::get, urls::url_view(st->next),
+                                       empty{}, http::fields(st->headers), std::move(self));
+        if (!ec)
+        {
+          st->next = next_page_url(res->headers(), st->next);
+          start_prefetch_(st);
+        }
+        return self.complete(ec, std::move(*res));
+      }
+    }
+  }
+};
+
+template<typename Executor>
+template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, basic_stream<Executor>)) CompletionToken>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code, basic_stream<Executor>))
+basic_paginator<Executor>::async_next(CompletionToken && completion_token)
+{
+  return asio::async_compose<CompletionToken, void(system::error_code, basic_stream<Executor>)>(
+      async_next_op{{}, st_},
+      completion_token,
+      get_executor());
+}
+
+}
+}
+
+#include <boost/asio/unyield.hpp>
+
+#endif // BOOST_REQUESTS_PAGINATOR_HPP
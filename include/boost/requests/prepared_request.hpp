@@ -0,0 +1,132 @@
+// Copyright (c) 2021 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_REQUESTS_PREPARED_REQUEST_HPP
+#define BOOST_REQUESTS_PREPARED_REQUEST_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/requests/http.hpp>
+#include <boost/url/url_view.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace boost {
+namespace requests {
+
+struct prepared_request;
+struct flat_headers;
+
+/// A shareable, immutable field block: the invariant fields are
+/// serialized once and any number of requests - and threads - can borrow
+/// the prototype concurrently by const reference; nothing is copied per
+/// call beyond the flat bytes. Unlike prepared_request the method and
+/// target stay per call, so one prototype serves a whole API rather than
+/// a single route. Host, Cookie and Content-Length in `fields` are
+/// ignored, they are layered on top per call.
+struct header_prototype
+{
+  BOOST_REQUESTS_DECL explicit header_prototype(const http::fields & fields);
+
+  /// From a flat_headers map: its block is already in wire format, so
+  /// without volatile fields to exclude, this is one copy of the block
+  /// rather than a per-field re-serialization.
+  BOOST_REQUESTS_DECL explicit header_prototype(flat_headers & fields);
+
+  /// The pre-serialized invariant fields, without a request line.
+  core::string_view field_block() const { return block_; }
+
+ private:
+  friend struct prepared_request;
+  std::string block_;
+  bool has_accept_encoding_{false};
+};
+
+/// A request prototype for one route: the request line and the invariant
+/// header fields (authorization, accept, content-type, ...) are serialized
+/// once at construction, into a single flat block of bytes. Per call only
+/// the volatile fields - Host, Cookie, Content-Length and (on demand)
+/// Accept-Encoding - get appended, so repeated calls skip the field-map
+/// assembly and serialization entirely; think prepared statements for HTTP.
+///
+/// Host, Cookie and Content-Length in `fields` are ignored here, they are
+/// per-connection respectively per-call. Use with basic_connection::ropen.
+/// Redirects are not followed there - a prepared request cannot be
+/// rewritten - so redirect responses come back to the caller as they are.
+struct prepared_request
+{
+  BOOST_REQUESTS_DECL prepared_request(beast::http::verb method,
+                                       urls::url_view target,
+                                       const http::fields & fields);
+
+  BOOST_REQUESTS_DECL prepared_request(beast::http::verb method,
+                                       urls::url_view target,
+                                       flat_headers & fields);
+
+  /// Build the request for one call from a borrowed prototype: just the
+  /// request line plus one copy of the pre-serialized block - no field
+  /// map is touched.
+  BOOST_REQUESTS_DECL prepared_request(beast::http::verb method,
+                                       urls::url_view target,
+                                       const header_prototype & prototype);
+
+  beast::http::verb method() const { return method_; }
+  /// The encoded target the request line was built from.
+  core::string_view target() const { return target_; }
+  /// The pre-serialized request line and invariant fields.
+  core::string_view header_block() const { return head_; }
+
+  /// Assemble the full header of one call into `out` (any contiguous char
+  /// container): the invariant block, the volatile fields and the final
+  /// CRLF. The bytes must stay alive until the request is written.
+  template<typename Container>
+  void assemble(Container & out,
+                core::string_view host,
+                core::string_view cookie,
+                std::uint64_t content_length,
+                bool request_encoding = false) const
+  {
+    out.clear();
+    out.reserve(head_.size() + host.size() + cookie.size() + 96u);
+    const auto append = [&out](core::string_view sv)
+    {
+      out.insert(out.end(), sv.begin(), sv.end());
+    };
+    append(head_);
+    append("Host: ");
+    append(host);
+    append("\r\n");
+    if (!cookie.empty())
+    {
+      append("Cookie: ");
+      append(cookie);
+      append("\r\n");
+    }
+    if (content_length > 0u || needs_content_length_)
+    {
+      char buf[24];
+      const int n = std::snprintf(buf, sizeof(buf), "%llu",
+                                  static_cast<unsigned long long>(content_length));
+      append("Content-Length: ");
+      append(core::string_view(buf, static_cast<std::size_t>(n)));
+      append("\r\n");
+    }
+    if (request_encoding && !has_accept_encoding_)
+      append("Accept-Encoding: gzip, deflate\r\n");
+    append("\r\n");
+  }
+
+ private:
+  beast::http::verb method_;
+  std::string target_;
+  std::string head_;
+  // methods that send Content-Length even for an empty body
+  bool needs_content_length_{false};
+  bool has_accept_encoding_{false};
+};
+
+}
+}
+
+#endif // BOOST_REQUESTS_PREPARED_REQUEST_HPP
@@ -19,6 +19,10 @@ struct public_suffix_list
     unordered_set<core::string_view> full_matches;
     unordered_set<core::string_view> whitelist;
     unordered_set<core::string_view> wildcards;
+    // When set, lookups use the table compiled in from the shipped list and
+    // the sets above are unused. default_public_suffix_list() returns such a
+    // handle, so the default costs neither startup parsing nor allocation.
+    bool use_builtin{false};
 };
 
 BOOST_REQUESTS_DECL const public_suffix_list & default_public_suffix_list();
@@ -34,6 +34,18 @@ enum redirect_mode
     any
 };
 
+/// How much of a followed redirect chain the final response retains in
+/// response_base::history, see request_options.
+enum class history_mode
+{
+    /// retain nothing once the chain is done
+    none,
+    /// retain every hop's header, but not its drained body (the default)
+    headers,
+    /// retain complete intermediate responses, bodies included
+    full
+};
+
 BOOST_REQUESTS_DECL bool should_redirect(
         redirect_mode mode,
         urls::url_view current,
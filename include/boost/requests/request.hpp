@@ -22,6 +22,9 @@ namespace detail
 template<typename Connection, typename RequestBody = empty>
 struct async_request_op;
 
+template<typename Connection, typename RequestBody, typename DynamicBuffer>
+struct async_request_sink_op;
+
 }
 
 template<typename Connection, typename RequestBody>
@@ -47,6 +50,35 @@ auto request(Connection & conn,
   return res;
 }
 
+// Like request(), but the body bytes land in the caller-provided dynamic
+// buffer - shared memory, a recycled block, a pmr arena - instead of the
+// response's own storage, so they are written exactly once. The returned
+// response_base carries the header & history only.
+template<typename Connection, typename RequestBody, typename DynamicBuffer>
+auto request(Connection & conn,
+             beast::http::verb method,
+             urls::url_view path,
+             RequestBody && body,
+             typename Connection::request_type req,
+             DynamicBuffer & sink,
+             system::error_code & ec) -> response_base;
+
+template<typename Connection, typename RequestBody, typename DynamicBuffer>
+auto request(Connection & conn,
+             beast::http::verb method,
+             urls::url_view path,
+             RequestBody && body,
+             typename Connection::request_type req,
+             DynamicBuffer & sink)
+    -> response_base
+{
+  boost::system::error_code ec;
+  auto res = request(conn, method, path, std::forward<RequestBody>(body), std::move(req), sink, ec);
+  if (ec)
+    throw_exception(system::system_error(ec, "request"));
+  return res;
+}
+
 
 
 
@@ -112,6 +144,21 @@ async_request(Connection & conn,
               typename Connection::request_type req,
               CompletionToken && completion_token
                   BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(typename Connection::executor_type));
+
+template<typename Connection,
+          typename RequestBody,
+          typename DynamicBuffer,
+          BOOST_ASIO_COMPLETION_TOKEN_FOR( void (system::error_code, response_base)) CompletionToken
+              BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(typename Connection::executor_type)>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code, response_base))
+async_request(Connection & conn,
+              beast::http::verb method,
+              urls::url_view target,
+              RequestBody && body,
+              typename Connection::request_type req,
+              DynamicBuffer & sink,
+              CompletionToken && completion_token
+                  BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(typename Connection::executor_type));
 }
 }
 
@@ -6,6 +6,10 @@
 #define BOOST_REQUESTS_REQUEST_OPTIONS_HPP
 
 #include <boost/requests/redirect.hpp>
+#include <boost/requests/timing.hpp>
+#include <boost/beast/http/verb.hpp>
+#include <chrono>
+#include <cstdint>
 
 namespace boost {
 namespace requests {
@@ -18,6 +22,79 @@ struct request_options {
   redirect_mode redirect{private_domain};
   /// The maximum of allowed redirectse
   std::size_t max_redirects{12};
+  /// What the final response keeps of the redirect chain it followed:
+  /// headers only (default), complete hop responses, or nothing. Applied
+  /// when the stream is handed out; a chain that fails mid-way still
+  /// carries the hops' headers so the error can be diagnosed or re-driven.
+  history_mode history{history_mode::headers};
+  /// Cap on retained history entries - the oldest hops are dropped first
+  /// once the chain grows past it. Zero keeps the whole chain.
+  std::size_t max_history{0u};
+  /// Offer gzip & deflate and transparently decode the response body.
+  bool decompress_body{false};
+  /// If set, the request stamps its timing breakdown here. Must outlive the request.
+  timing * timings{nullptr};
+  /// Pipeline this request: ropen returns as soon as the request is written
+  /// and the response header is read when the stream is first used. Responses
+  /// arrive in write order, so the streams must be consumed in the order the
+  /// requests were made. Only use this for idempotent requests; redirects are
+  /// not followed in this mode.
+  bool pipeline{false};
+  /// Send the header with `Expect: 100-continue` and hold the body back
+  /// until the server sends an interim response (or continue_timeout
+  /// passes - servers are allowed to ignore Expect). A final status
+  /// arriving instead of the 100 skips the body entirely, so a rejected
+  /// upload costs one round trip instead of the whole payload. Only
+  /// applied to requests that carry a body; ignored when pipelining.
+  bool expect_continue{false};
+  /// How long to wait for the interim response before sending the body anyway.
+  std::chrono::milliseconds continue_timeout{std::chrono::seconds(1)};
+  /// Hedge the request against slow backends: if the response header has
+  /// not arrived after this delay, fire one duplicate over a second pooled
+  /// connection and take whichever response wins; the straggler is drained
+  /// in the background. Zero disables hedging. Async sessions only;
+  /// limited to idempotent methods, see hedge_predicate.
+  std::chrono::milliseconds hedge_after{0};
+  /// Hedging duplicates the request, so like retries it is limited to
+  /// idempotent methods (GET, HEAD, PUT, DELETE, OPTIONS, TRACE). Set this
+  /// to replace that check, e.g. to allow a POST that is known to be safe
+  /// to send twice.
+  bool (*hedge_predicate)(beast::http::verb) = nullptr;
+  /// Retry on stale keep-alive connections: when a pooled connection fails
+  /// with eof, connection_reset or broken_pipe before the response header
+  /// arrived, resend the already-built request over the next pooled
+  /// connection, up to this many times. Zero disables retrying.
+  std::size_t retries{0};
+  /// Wait this long before the first retry; the delay doubles per attempt.
+  /// Zero retries immediately.
+  std::chrono::milliseconds retry_backoff{0};
+  /// Retries are limited to idempotent methods (GET, HEAD, PUT, DELETE,
+  /// OPTIONS, TRACE). Set this to replace that check, e.g. to allow a POST
+  /// that is known to be safe to repeat.
+  bool (*retry_predicate)(beast::http::verb) = nullptr;
+  /// Native deadlines, armed on the shared per-context timer wheel (100ms
+  /// granularity, see detail::timer_wheel_service): for establishing the
+  /// connection, for receiving the response header once the transport is
+  /// ready, and for receiving the response body. On expiry the socket is
+  /// closed and the guarded operation fails with asio::error::timed_out.
+  /// Zero disables a phase.
+  std::chrono::milliseconds connect_timeout{0};
+  std::chrono::milliseconds headers_timeout{0};
+  std::chrono::milliseconds body_timeout{0};
+  /// Bound the memory a buffered response body may take: once it grows past
+  /// this many bytes, the body spills into an anonymous temp file and is
+  /// handed back as a memory-mapped view, so response::string_view(),
+  /// body_view() and as_json keep working while peak RSS stays capped - a
+  /// 2 GB body from a misbehaving upstream costs page cache, not heap.
+  /// Applies to the buffered convenience APIs (request(), get(), ...);
+  /// zero (the default) never spills. POSIX only - elsewhere the body
+  /// stays in memory.
+  std::size_t spill_threshold{0u};
+  /// Priority class for a saturated connection pool: waiters with a higher
+  /// priority get the next idle connection first. Only takes effect when the
+  /// pool's queue discipline parks waiters, see
+  /// basic_connection_pool::set_queue_discipline.
+  std::uint8_t priority{0u};
 };
 
 /// The default options used by sessions.
@@ -7,6 +7,7 @@
 
 #include <boost/beast/core/detail/base64.hpp>
 #include <boost/requests/cookie_jar.hpp>
+#include <boost/requests/detail/intern.hpp>
 #include <boost/requests/http.hpp>
 #include <boost/requests/request_options.hpp>
 #include <boost/requests/response.hpp>
@@ -48,6 +49,31 @@ inline field_entry bearer(core::string_view token)
   return fe;
 }
 
+/// A field whose value is interned in `tbl` (usually session.interner()):
+/// building the same header over and over hands out one stable stored copy
+/// instead of a fresh per-entry buffer. Values the table passes through
+/// (oversized, or a full table) get an owned copy, like before.
+inline field_entry interned(http::field key, core::string_view value,
+                            detail::intern_table & tbl)
+{
+  field_entry fe;
+  fe.key = key;
+  fe.value = tbl.intern(value);
+  if (!detail::intern_table::interned(value, fe.value))
+  {
+    fe.buffer.assign(value.begin(), value.end());
+    fe.value = fe.buffer;
+  }
+  return fe;
+}
+
+/// As bearer(), with the composed value interned in `tbl`, so a session's
+/// token header is built once instead of once per request.
+inline field_entry bearer(core::string_view token, detail::intern_table & tbl)
+{
+  return interned(http::field::authorization, "Bearer " + std::string(token), tbl);
+}
+
 inline auto headers(std::initializer_list<field_entry> fields,
                     boost::container::pmr::memory_resource * res = boost::container::pmr::get_default_resource())
   -> beast::http::basic_fields<boost::container::pmr::polymorphic_allocator<char>>
@@ -0,0 +1,127 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_RESOLVER_CACHE_HPP
+#define BOOST_REQUESTS_RESOLVER_CACHE_HPP
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/requests/detail/config.hpp>
+#include <boost/system/error_code.hpp>
+#include <boost/unordered_map.hpp>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace requests {
+
+/// A TTL-bound cache of resolver results, keyed by authority.
+/**
+ * The cache is owned by `basic_session` and shared with every pool it creates,
+ * so repeated lookups of the same authority do not hit getaddrinfo. Entries in
+ * the last quarter of their lifetime are still served, but the reading lookup
+ * op refreshes them in the background, keeping the steady state free of
+ * resolver latency.
+ */
+struct resolver_cache
+{
+  using endpoint_type = asio::ip::tcp::endpoint;
+  using clock_type    = std::chrono::steady_clock;
+
+  struct entry
+  {
+    std::string host_name;
+    std::vector<endpoint_type> endpoints;
+  };
+
+  resolver_cache(std::chrono::seconds ttl = std::chrono::seconds(60)) : ttl_(ttl) {}
+
+  std::chrono::seconds ttl() const {return ttl_;}
+
+  /// Look up a non-expired entry. Returns false on miss or expiry.
+  BOOST_REQUESTS_DECL bool get(core::string_view host, core::string_view service, entry & out);
+
+  /// Store or overwrite an entry, restarting its TTL.
+  BOOST_REQUESTS_DECL void put(core::string_view host, core::string_view service, entry e);
+
+  /// True if the entry is due for a background refresh; marks it as refreshing
+  /// so that only one caller performs the refresh.
+  BOOST_REQUESTS_DECL bool claim_refresh(core::string_view host, core::string_view service);
+
+  /// Single-flight coalescing for cache misses. Returns true when the caller
+  /// shall resolve (host, service) itself and later hand in the result
+  /// through publish(); otherwise another resolution is already in flight,
+  /// `cb` is queued and invoked - from the claimant's thread - when the
+  /// claimant publishes. Callers post themselves back onto their own
+  /// executor inside `cb`.
+  BOOST_REQUESTS_DECL bool claim_inflight(core::string_view host, core::string_view service,
+                                          std::function<void(system::error_code)> cb);
+
+  /// End a claimed resolution: stores the entry like put() if `ec` is clear
+  /// and wakes the queued callers with `ec` either way.
+  BOOST_REQUESTS_DECL void publish(core::string_view host, core::string_view service,
+                                   system::error_code ec, entry e);
+
+  /// Drop all entries.
+  BOOST_REQUESTS_DECL void clear();
+
+  /// One cached resolution together with what is left of its lifetime,
+  /// see snapshot().
+  struct stored_entry
+  {
+    std::string key; // "host:service", as the cache itself keys entries
+    entry data;
+    std::chrono::seconds remaining;
+  };
+
+  /// The entries that have not expired yet, each with its remaining TTL.
+  /// The cache runs on the steady clock, which does not survive the
+  /// process, so a snapshot carries relative lifetimes - see
+  /// basic_session::save_state for turning them into wall time.
+  BOOST_REQUESTS_DECL std::vector<stored_entry> snapshot();
+
+  /// Re-insert a snapshot entry with `remaining` of its lifetime left,
+  /// clamped to the cache's own TTL. An entry whose lifetime already ran
+  /// out is the caller's to drop; a non-positive `remaining` is ignored.
+  BOOST_REQUESTS_DECL void restore(core::string_view key, entry e, std::chrono::seconds remaining);
+
+ private:
+  struct entry_impl
+  {
+    entry data;
+    clock_type::time_point expiry;
+    bool refreshing = false;
+  };
+
+  static std::string make_key_(core::string_view host, core::string_view service)
+  {
+    std::string res;
+    res.reserve(host.size() + 1u + service.size());
+    res.assign(host.begin(), host.end());
+    res += ':';
+    res.append(service.begin(), service.end());
+    return res;
+  }
+
+  std::chrono::seconds ttl_;
+  std::mutex mtx_;
+  boost::unordered_map<std::string, entry_impl> entries_;
+  boost::unordered_map<std::string,
+                       std::vector<std::function<void(system::error_code)>>> inflight_;
+};
+
+}
+}
+
+#if defined(BOOST_REQUESTS_HEADER_ONLY)
+#include <boost/requests/impl/resolver_cache.ipp>
+#endif
+
+#endif // BOOST_REQUESTS_RESOLVER_CACHE_HPP
@@ -18,6 +18,9 @@
 #include <boost/config.hpp>
 #include <boost/container/pmr/polymorphic_allocator.hpp>
 #include <boost/core/span.hpp>
+#include <boost/requests/accounting_resource.hpp>
+#include <boost/requests/detail/sbo_buffer.hpp>
+#include <boost/requests/detail/segmented_buffer.hpp>
 #include <boost/requests/error.hpp>
 #include <boost/requests/fields/link.hpp>
 #include <boost/requests/http.hpp>
@@ -63,6 +66,16 @@ struct response_base
   response_base& operator=(const response_base & ) = default;
   response_base& operator=(response_base && ) noexcept = default;
 
+  /// The allocation counters of the request this response came from, when
+  /// it was given an allocator on an accounting_resource; all zero
+  /// otherwise. Everything this response owns allocates from the same
+  /// resource, so the numbers keep moving until it is destroyed.
+  requests::memory_report memory_report() const
+  {
+    auto * res = dynamic_cast<accounting_resource*>(headers.get_allocator().resource());
+    return res != nullptr ? res->report() : requests::memory_report{};
+  }
+
   bool ok () const
   {
     using namespace beast::http;
@@ -127,13 +140,16 @@ struct response_base
 
 struct response : response_base
 {
-  buffer_type buffer{headers.get_allocator()};
+  // small responses live in the buffer's inline storage, so the common
+  // GET-a-small-payload case never allocates for the body.
+  using body_buffer_type = requests::detail::sbo_buffer;
+  body_buffer_type buffer{headers.get_allocator()};
 
   response(allocator_type alloc = {}) : response_base(alloc), buffer(alloc) {}
-  response(http::response_header header, buffer_type buffer) : response_base(std::move(header)), buffer(std::move(buffer)) {}
-  response(response_base         header, buffer_type buffer) : response_base(std::move(header)), buffer(std::move(buffer)) {}
+  response(http::response_header header, body_buffer_type buffer) : response_base(std::move(header)), buffer(std::move(buffer)) {}
+  response(response_base         header, body_buffer_type buffer) : response_base(std::move(header)), buffer(std::move(buffer)) {}
 
-  response(http::response_header header, history_type history, buffer_type buffer) : response_base(std::move(header), std::move(history)), buffer(std::move(buffer)) {}
+  response(http::response_header header, history_type history, body_buffer_type buffer) : response_base(std::move(header), std::move(history)), buffer(std::move(buffer)) {}
 
   response(const response & ) = default;
   response(response && ) noexcept = default;
@@ -170,6 +186,46 @@ struct response : response_base
     const auto cd = buffer.cdata();
     return span<Byte>(static_cast<const Byte*>(cd.data()), cd.size() / sizeof(Byte));
   }
+
+  /// The body as one contiguous view, no copy - for a body that spilled
+  /// past request_options::spill_threshold this is the file mapping.
+  body_buffer_type::const_buffers_type body_view() const { return buffer.cdata(); }
+};
+
+// A response whose body lives in segmented (rope) storage: fixed-size
+// blocks appended as the download grows, so a large body is never
+// reallocated-and-copied while being received. Read it by passing
+// `buffer` to basic_stream::read / async_read like any dynamic buffer.
+// body_view() hands the blocks out as a buffer sequence for scatter
+// consumption (writes, hashing, parsing); string_view() coalesces into
+// one contiguous block first and is the only copy paid.
+struct segmented_response : response_base
+{
+  using body_buffer_type = requests::detail::segmented_buffer;
+  body_buffer_type buffer{headers.get_allocator()};
+
+  segmented_response(allocator_type alloc = {}) : response_base(alloc), buffer(alloc) {}
+  segmented_response(http::response_header header, body_buffer_type buffer)
+      : response_base(std::move(header)), buffer(std::move(buffer)) {}
+  segmented_response(http::response_header header, history_type history, body_buffer_type buffer)
+      : response_base(std::move(header), std::move(history)), buffer(std::move(buffer)) {}
+
+  segmented_response(segmented_response && ) noexcept = default;
+  segmented_response& operator=(segmented_response && ) noexcept = default;
+
+  /// The body as a sequence of const buffers, no copy.
+  body_buffer_type::const_buffers_type body_view() const { return buffer.cdata(); }
+
+  /// Flatten the body into one contiguous block, see segmented_buffer::coalesce.
+  core::string_view coalesce() { return buffer.coalesce(); }
+
+  template<typename Char = char,
+           typename CharTraits = std::char_traits<char>>
+  auto string_view() -> basic_string_view<Char, CharTraits>
+  {
+    const auto sv = buffer.coalesce();
+    return basic_string_view<Char, CharTraits>(sv.data(), sv.size());
+  }
 };
 
 }
@@ -10,6 +10,7 @@
 
 #include <boost/requests/rfc/dates.hpp>
 #include <boost/requests/grammar/fixed_token_rule.hpp>
+#include <cstdint>
 
 namespace boost
 {
@@ -145,6 +146,119 @@ inline auto interpret_result(const T raw)
   return std::chrono::system_clock::time_point{time_};
 }
 
+// Fields-to-time_point with the very same arithmetic as interpret_result
+// (cumulative month days, the same leap rules, the weekday consistency
+// check), so both paths agree to the second.
+inline auto compose_http_date(std::size_t wd, unsigned day, std::size_t month,
+                              unsigned year, unsigned hour, unsigned min, unsigned sec)
+    -> system::result<std::chrono::system_clock::time_point>
+{
+  if (year < 1970u)
+  {
+    BOOST_URL_RETURN_EC(urls::grammar::error::out_of_range);
+  }
+
+  std::chrono::seconds time_{};
+  time_ += std::chrono::seconds(sec);
+  time_ += std::chrono::minutes(min);
+  time_ += std::chrono::hours(hour);
+
+  static constexpr std::uint16_t cum_days[12] =
+      {0u, 31u, 59u, 90u, 120u, 151u, 181u, 212u, 243u, 273u, 304u, 334u};
+  time_ += std::chrono::hours(24u * cum_days[month]);
+  if (month >= 2u && year % 4u == 0u)
+    time_ += std::chrono::hours(24);
+
+  const auto yd = year - 1970u;
+  time_ += std::chrono::hours((yd * 365u * 24u) + ((yd + 2u) / 4u) * 24u);
+  time_ += std::chrono::hours((day - 1u) * 24u);
+
+  const auto days = (std::chrono::duration_cast<std::chrono::hours>(time_).count() / 24u) % 7u;
+  if (wd != days)
+  {
+    BOOST_URL_RETURN_EC(urls::grammar::error::mismatch);
+  }
+  return std::chrono::system_clock::time_point{time_};
+}
+
+constexpr std::uint32_t pack3(char a, char b, char c)
+{
+  return (static_cast<std::uint32_t>(static_cast<unsigned char>(a)) << 16)
+       | (static_cast<std::uint32_t>(static_cast<unsigned char>(b)) <<  8)
+       |  static_cast<std::uint32_t>(static_cast<unsigned char>(c));
+}
+
+// both digits validated with a single accumulated range check
+inline bool two_digits(const char * p, unsigned & v)
+{
+  const unsigned d0 = static_cast<unsigned char>(p[0]) - unsigned('0');
+  const unsigned d1 = static_cast<unsigned char>(p[1]) - unsigned('0');
+  v = d0 * 10u + d1;
+  return (d0 | d1) < 10u;
+}
+
+// Fast path for the fixed-width IMF-fixdate layout of virtually every
+// Date, Last-Modified and Expires header on the wire:
+//
+//   Sun, 06 Nov 1994 08:49:37 GMT
+//   0123456789012345678901234567 8
+//
+// Every separator sits at a known offset, so recognition is a block of
+// position checks, the six digit pairs come out branchlessly, and the
+// weekday/month names resolve over small tables of packed 24-bit keys -
+// no grammar machinery and no stoi. Returns false without consuming
+// anything when the input is not this exact layout; the caller then
+// falls back to the grammar for the odd formats.
+inline bool parse_imf_fixdate(char const *& it, char const * end,
+                              system::result<std::chrono::system_clock::time_point> & out)
+{
+  if (end - it < 29)
+    return false;
+  const char * p = it;
+  if (p[3] != ',' || p[4] != ' ' || p[7] != ' ' || p[11] != ' ' || p[16] != ' '
+   || p[19] != ':' || p[22] != ':' || p[25] != ' '
+   || p[26] != 'G' || p[27] != 'M' || p[28] != 'T')
+    return false;
+
+  unsigned day, year_hi, year_lo, hour, min, sec;
+  bool ok = two_digits(p +  5, day);
+  ok &= two_digits(p + 12, year_hi);
+  ok &= two_digits(p + 14, year_lo);
+  ok &= two_digits(p + 17, hour);
+  ok &= two_digits(p + 20, min);
+  ok &= two_digits(p + 23, sec);
+  if (!ok)
+    return false;
+
+  // epoch was a thursday, same order as the grammar's wkday rule
+  static constexpr std::uint32_t wkdays[7] =
+      {pack3('T','h','u'), pack3('F','r','i'), pack3('S','a','t'),
+       pack3('S','u','n'), pack3('M','o','n'), pack3('T','u','e'),
+       pack3('W','e','d')};
+  static constexpr std::uint32_t months[12] =
+      {pack3('J','a','n'), pack3('F','e','b'), pack3('M','a','r'),
+       pack3('A','p','r'), pack3('M','a','y'), pack3('J','u','n'),
+       pack3('J','u','l'), pack3('A','u','g'), pack3('S','e','p'),
+       pack3('O','c','t'), pack3('N','o','v'), pack3('D','e','c')};
+
+  const auto wkd = pack3(p[0], p[1], p[2]);
+  std::size_t wd = 0u;
+  while (wd < 7u && wkdays[wd] != wkd)
+    wd++;
+  if (wd == 7u)
+    return false;
+
+  const auto mon = pack3(p[8], p[9], p[10]);
+  std::size_t month = 0u;
+  while (month < 12u && months[month] != mon)
+    month++;
+  if (month == 12u)
+    return false;
+
+  it += 29;
+  out = compose_http_date(wd, day, month, year_hi * 100u + year_lo, hour, min, sec);
+  return true;
+}
 
 }
 
@@ -158,6 +272,13 @@ date_1123_t::parse(
 {
   namespace ug = boost::urls::grammar;
   using namespace detail;
+
+  {
+    system::result<value_type> fast{value_type{}};
+    if (detail::parse_imf_fixdate(it, end, fast))
+      return fast;
+  }
+
   constexpr auto sp = ug::squelch(ug::literal_rule(" "));
   // RFC 2616 only allows space, but `-` is sometimes in use, that's minor enough to tolerate
   constexpr auto dsp = ug::squelch(
@@ -53,6 +53,52 @@ inline auto default_session(asio::any_io_executor exec = asio::system_executor()
   return *so;
 }
 
+/// The read-mostly caches - DNS, TLS tickets, cookies - shared by a set of
+/// session replicas. One session across many io threads funnels every
+/// request through its mutexes and bounces the pool tables between cores;
+/// with one io_context per NUMA node (or per thread) and a replica each,
+/// the hot state - pools, counters, locks - stays local, while what is
+/// learned once is learned for everyone: a hostname resolved or a TLS
+/// ticket earned through one replica warms the others. The caches are
+/// internally synchronized and off the per-request hot path, so sharing
+/// them is cheap.
+///
+/// get() is default_session plus the wiring: it hands out the calling
+/// context's replica, attaching the shared caches when it creates one. A
+/// replica that already existed (someone called default_session first) is
+/// returned as it is, own caches and all - attach before traffic. The
+/// shards object must outlive every context it served.
+struct session_shards
+{
+  session_shards() = default;
+
+  /// The calling context's replica, created and wired on first use.
+  session & get(asio::any_io_executor exec = asio::system_executor())
+  {
+    auto & so = asio::use_service<session_service>(exec.context()).session_;
+    if (!so)
+    {
+      so.emplace(exec);
+      so->use_dns_cache(dns_cache_);
+      so->use_cookie_jar(jar_);
+      so->use_tls_sessions(tls_sessions_);
+    }
+    return *so;
+  }
+
+        resolver_cache & dns_cache()       {return dns_cache_;}
+  const resolver_cache & dns_cache() const {return dns_cache_;}
+
+        cookie_jar & jar()       {return jar_;}
+  const cookie_jar & jar() const {return jar_;}
+
+private:
+  resolver_cache dns_cache_;
+  boost::container::pmr::synchronized_pool_resource pmr_;
+  cookie_jar jar_{boost::container::pmr::polymorphic_allocator<char>(&pmr_)};
+  detail::ssl_session_cache tls_sessions_;
+};
+
 }
 }
 
@@ -8,10 +8,30 @@
 
 #include <boost/asio/any_io_executor.hpp>
 #include <boost/requests/connection_pool.hpp>
+#include <boost/requests/detail/arena.hpp>
+#include <boost/requests/detail/intern.hpp>
+#include <boost/requests/fields/alt_svc.hpp>
+#include <boost/requests/http_cache.hpp>
+#include <boost/requests/histogram.hpp>
+#include <boost/requests/resolver_cache.hpp>
+#include <boost/requests/trace.hpp>
+#include <boost/beast/core/file.hpp>
 #include <boost/beast/http/message.hpp>
 #include <boost/container/pmr/polymorphic_allocator.hpp>
 #include <boost/container/pmr/string.hpp>
 #include <boost/container/pmr/synchronized_pool_resource.hpp>
+#include <boost/url/authority_view.hpp>
+#include <boost/url/url.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
 
 
 namespace boost
@@ -19,6 +39,44 @@ namespace boost
 namespace requests
 {
 
+namespace detail
+{
+// buffers a claimed single-flight response off the io thread, see
+// basic_session::sf_finish_; defined in impl/session.hpp
+template<typename>
+struct async_sf_fill_op;
+}
+
+/// A prepared handle for a base URL that is requested repeatedly: the URL
+/// is parsed once at construction, and the session caches the resolved
+/// pool in the handle, so the steady-state request skips URL parsing, the
+/// pool-key build and the table walk entirely. The cache invalidates
+/// itself whenever the session publishes a new pool table (a pool was
+/// created, rebuilt or shut down), so a handle never pins a pool the
+/// session has since replaced - at worst it falls back to the regular
+/// lookup and re-caches. A handle is bound to whichever session used it
+/// last; it is not thread-safe, give each thread its own.
+template<typename Executor = asio::any_io_executor>
+struct basic_endpoint_ref
+{
+  explicit basic_endpoint_ref(urls::url_view url) : url_(url) {}
+
+  urls::url_view url() const { return url_; }
+
+private:
+  urls::url url_;
+
+  // which session's table the cached pool came out of, and at which epoch
+  const void * session_ = nullptr;
+  std::uint64_t epoch_ = 0u;
+  variant2::variant<std::weak_ptr<basic_http_connection_pool<Executor>>,
+                    std::weak_ptr<basic_https_connection_pool<Executor>>,
+                    std::weak_ptr<basic_unix_connection_pool<Executor>>> pool_;
+
+  template<typename>
+  friend struct basic_session;
+};
+
 template<typename Executor = asio::any_io_executor>
 struct basic_session
 {
@@ -71,11 +129,282 @@ struct basic_session
           struct request_options & options()       {return options_;}
     const struct request_options & options() const {return options_;}
 
+    /// Override options() towards `authority` - the host[:port] exactly as
+    /// it appears in the URL, like set_rate_limit. Resolved with a single
+    /// hash lookup when a request starts (and skipped entirely while no
+    /// overrides are installed); the resolved options ride the whole
+    /// request, redirects included, so a hop to another host keeps the
+    /// options of the authority the request started at.
+    void set_options(core::string_view authority, const struct request_options & opts)
+    {
+      std::lock_guard<std::mutex> lock{options_mtx_};
+      option_overrides_[std::string(authority)] = opts;
+      has_option_overrides_.store(true, std::memory_order_relaxed);
+    }
+
+    /// Remove a per-authority override again.
+    void reset_options(core::string_view authority)
+    {
+      std::lock_guard<std::mutex> lock{options_mtx_};
+      option_overrides_.erase(std::string(authority));
+      has_option_overrides_.store(!option_overrides_.empty(), std::memory_order_relaxed);
+    }
+
+    /// The options a request towards `authority` runs with.
+    struct request_options options_for(core::string_view authority) const
+    {
+      if (!has_option_overrides_.load(std::memory_order_relaxed))
+        return options_;
+      std::lock_guard<std::mutex> lock{options_mtx_};
+      const auto itr = option_overrides_.find(std::string(authority));
+      return itr == option_overrides_.end() ? options_ : itr->second;
+    }
+
+    /// The DNS cache shared by all pools of this session.
+          resolver_cache & dns_cache()       {return *dns_cache_ptr_;}
+    const resolver_cache & dns_cache() const {return *dns_cache_ptr_;}
+
+    /// Resolve through `cache` instead of the session's own DNS cache, so
+    /// several sessions - one per io_context, say - share what they learn,
+    /// see session_shards. `cache` must outlive the session; call before
+    /// any traffic, pools that already exist keep the cache they were
+    /// created with.
+    void use_dns_cache(resolver_cache & cache) {dns_cache_ptr_ = &cache;}
+
+    /// Keep cookies in `jar` instead of the session's own jar, under the
+    /// same lifetime and call-before-traffic rules as use_dns_cache.
+    void use_cookie_jar(cookie_jar & jar) {jar_ptr_ = &jar;}
+
+    /// Resume TLS from `cache` instead of each https pool's own per-origin
+    /// cache, so a ticket earned by one session resumes handshakes in
+    /// another; same rules as use_dns_cache. The cache is keyed by host,
+    /// so origins don't see each other's tickets.
+    void use_tls_sessions(detail::ssl_session_cache & cache) {shared_tls_ = &cache;}
+
+    /// Serve each request's allocations (headers, parser, response buffer)
+    /// from a recycled per-request arena instead of the default resource.
+    /// The arena returns to the session once the response is destroyed.
+    void use_arena(bool enable) {use_arena_ = enable;}
+    bool uses_arena() const {return use_arena_;}
+
+    /// Serve idempotent GETs from (and record them into) `cache`, which
+    /// must outlive the session. See http_cache.
+    void set_cache(http_cache * cache) {cache_ = cache;}
+
+    /// Coalesce identical concurrent GETs onto one wire request: while a
+    /// GET is in flight, further GETs for the same URL with the same
+    /// credentials and content negotiation (Authorization, Cookie, Accept,
+    /// Accept-Encoding, Accept-Language, Range) park on it, and the one
+    /// response is buffered and replayed to every caller - one origin
+    /// fetch instead of N under stampede load. Off by default. Responses
+    /// are captured store-and-forward like http_cache fills, so only
+    /// bodies with a known length up to
+    /// BOOST_REQUESTS_SINGLE_FLIGHT_MAX_SIZE coalesce; anything else ends
+    /// the flight empty-handed and the waiters dial out themselves. A
+    /// failure fans out like a response. The synchronous ropen blocks on
+    /// an in-flight request, so it must not share a thread with the
+    /// request it would park on.
+    void use_single_flight(bool enable) {use_single_flight_ = enable;}
+    bool uses_single_flight() const {return use_single_flight_;}
+
+    /// The session's header interning table: values that repeat across
+    /// requests - auth headers, content types - are stored once and handed
+    /// out as views that live as long as the session, see the interned()
+    /// and bearer() overloads in request_settings.hpp.
+    detail::intern_table & interner() {return intern_;}
+
+    /// Latency distributions collected while asynchronous requests run,
+    /// see latency_histogram: whole requests (entry to stream, including
+    /// redirects and retries), the wait for a pooled connection, and the
+    /// TLS handshake. A few relaxed atomic adds per request, snapshots
+    /// under traffic. Synchronous requests are not recorded - they have a
+    /// thread to themselves and can be timed at the call site.
+    latency_histogram::snapshot request_latency()   const {return request_latency_.snap();}
+    latency_histogram::snapshot pool_wait_latency() const {return pool_wait_latency_.snap();}
+    latency_histogram::snapshot handshake_latency() const {return handshake_latency_.snap();}
+
+    /// Install a span receiver handed down to every pool (and from there
+    /// every connection) this session creates; pools that already exist
+    /// keep theirs. Inert unless compiled with BOOST_REQUESTS_ENABLE_TRACE,
+    /// see trace_hook.
+    void set_trace_hook(trace_hook * hook) {trace_hook_ = hook;}
+
+    /// Route every connection through an HTTP CONNECT proxy, see
+    /// basic_connection_pool::set_proxy. Only pools created afterwards are
+    /// affected; since pools are keyed by (proxy, origin), existing direct
+    /// pools stay as they are instead of being reused for tunneled traffic.
+    void set_proxy(urls::url_view proxy) {proxy_ = proxy;}
+    urls::url_view proxy() const {return proxy_;}
+
+    /// Adopt an alternative service for `authority` - an https origin's
+    /// host[:port] exactly as it appears in the URL: until `expiry`, pools
+    /// for that origin dial `alternative` while Host, SNI and the
+    /// certificate check keep naming the origin, see
+    /// basic_connection_pool::set_alt_svc. Normally the session feeds this
+    /// itself from Alt-Svc response headers (RFC 7838); the setter exists
+    /// for pinning an alternative up front, and an empty `alternative`
+    /// forgets the entry. A pool already dialed for another alternative is
+    /// rebuilt by the next get_pool.
+    void set_alt_svc(core::string_view authority, core::string_view alternative,
+                     std::chrono::system_clock::time_point expiry
+                         = std::chrono::system_clock::time_point::max())
+    {
+      std::lock_guard<std::mutex> lock{alt_svc_mtx_};
+      if (alternative.empty())
+        alt_svcs_.erase(std::string(authority));
+      else
+        alt_svcs_[std::string(authority)] = alt_svc_{std::string(alternative), expiry};
+      has_alt_svc_.store(!alt_svcs_.empty(), std::memory_order_relaxed);
+    }
+
+    /// The alternative on file for `authority`, empty when there is none
+    /// or the advertisement expired.
+    std::string alt_svc_for(core::string_view authority) const
+    {
+      if (!has_alt_svc_.load(std::memory_order_relaxed))
+        return {};
+      std::lock_guard<std::mutex> lock{alt_svc_mtx_};
+      const auto itr = alt_svcs_.find(std::string(authority));
+      if (itr == alt_svcs_.end() || itr->second.expiry <= std::chrono::system_clock::now())
+        return {};
+      return itr->second.authority;
+    }
+
+    /// Bound the requests in flight across the whole session; zero (the
+    /// default) means unbounded. Once `limit` requests run, further
+    /// asynchronous requests wait their turn, at most `queue` of them -
+    /// anything beyond that fails fast with error::session_overloaded.
+    /// A slot is held until the response stream is done with the wire, so
+    /// body reads count as in-flight work. The synchronous paths cannot
+    /// park and shed as soon as the budget is exhausted. Like the other
+    /// setters this must precede handing out streams.
+    void set_concurrency_limit(std::size_t limit,
+                               std::size_t queue = (std::numeric_limits<std::size_t>::max)())
+    {
+      max_inflight_ = limit;
+      max_queued_ = queue;
+      if (limit > 0u)
+        budget_ = detail::basic_semaphore<executor_type>{get_executor(), static_cast<int>(limit)};
+    }
+    std::size_t concurrency_limit() const {return max_inflight_;}
+
+    /// Cap the open sockets across every pool of the session; zero (the
+    /// default) means uncapped. A pool that wants to dial past the cap
+    /// first has idle connections in the least recently used pools closed
+    /// to make room; only when nothing is idle anywhere does the dial
+    /// degrade to sharing a busy connection, as if the pool were at its
+    /// own limit. Each pool always gets its first socket, so a cap smaller
+    /// than the number of origins oversubscribes instead of starving one.
+    /// Like the other setters this must precede handing out streams.
+    void set_connection_budget(std::size_t limit)
+    {
+      if (!conn_budget_.reclaim)
+        conn_budget_.reclaim = [this](const void * requester){ return reclaim_idle_(requester); };
+      conn_budget_.limit.store(limit, std::memory_order_relaxed);
+    }
+    std::size_t connection_budget() const {return conn_budget_.limit.load(std::memory_order_relaxed);}
+
+    /// The sockets currently counted against the budget, capped or not.
+    std::size_t connections_open() const {return conn_budget_.in_use.load(std::memory_order_relaxed);}
+
+    /// Cap the request rate towards `authority` - the host[:port] exactly as
+    /// it appears in the URL - at `per_second` requests, with bursts of up
+    /// to `burst` requests passing back to back. async_ropen takes one
+    /// token before acquiring a connection and sleeps out the deficit when
+    /// the bucket is drained, so the smoothing happens here instead of as
+    /// 429-and-retry round trips on the wire. A `per_second` of zero
+    /// removes the limit. The synchronous paths cannot park and ignore the
+    /// buckets.
+    void set_rate_limit(core::string_view authority, double per_second, std::size_t burst = 1u)
+    {
+      std::lock_guard<std::mutex> lock{rate_mtx_};
+      if (per_second <= 0.)
+        rate_limits_.erase(std::string(authority));
+      else
+      {
+        auto & bp = rate_limits_[std::string(authority)];
+        const auto capacity = static_cast<double>((std::max)(burst, std::size_t(1u)));
+        if (bp == nullptr)
+          bp = std::make_shared<rate_bucket_>(per_second, capacity);
+        else
+        {
+          std::lock_guard<std::mutex> block{bp->mtx};
+          bp->per_second = per_second;
+          bp->capacity = capacity;
+          bp->tokens = (std::min)(bp->tokens, capacity);
+        }
+      }
+      has_rate_limits_.store(!rate_limits_.empty(), std::memory_order_relaxed);
+    }
+
+    /// Serialize what the session has learned about the network - the DNS
+    /// cache, the per-endpoint dial quality of every pool and the TLS
+    /// session tickets - into a compact binary snapshot, so the next
+    /// process starts warm instead of relearning all of it over its first
+    /// minute of traffic. Cookies are not included; the jar has its own
+    /// snapshot, see cookie_jar::save. Pools reached through a proxy and
+    /// unix-socket pools carry no state worth keeping and are skipped.
+    std::string save_state();
+
+    /// Restore a snapshot produced by save_state(): DNS entries re-enter
+    /// the cache with whatever lifetime they have left, endpoint quality
+    /// and TLS tickets are parked per origin and handed to the matching
+    /// pool when it is created. Dial scores are dropped wholesale once
+    /// the snapshot is older than BOOST_REQUESTS_WARM_SCORE_MAX_AGE;
+    /// tickets carry their own lifetime and are validated against it
+    /// instead. Returns false if the data is not a snapshot of a
+    /// supported version or is truncated.
+    bool restore_state(core::string_view data);
+
+    /// save_state()/restore_state() straight to and from a file.
+    bool save_state(const filesystem::path & file, system::error_code & ec)
+    {
+      const auto data = save_state();
+      beast::file f;
+      f.open(file.string().c_str(), beast::file_mode::write, ec);
+      if (ec)
+        return false;
+      f.write(data.data(), data.size(), ec);
+      return !ec;
+    }
+    bool restore_state(const filesystem::path & file, system::error_code & ec)
+    {
+      beast::file f;
+      f.open(file.string().c_str(), beast::file_mode::read, ec);
+      if (ec)
+        return false;
+      const auto size = f.size(ec);
+      if (ec)
+        return false;
+      std::string data;
+      data.resize(static_cast<std::size_t>(size));
+      if (!data.empty())
+        f.read(&data[0], data.size(), ec);
+      if (ec)
+        return false;
+      return restore_state(data);
+    }
+
+    /// Aggregate pool_stats over every pool of the session.
+    pool_stats stats()
+    {
+      pool_stats st;
+      auto pools = std::atomic_load(&pools_);
+      for (const auto & p : pools->http)
+        st += p.second->stats();
+      for (const auto & p : pools->https)
+        st += p.second->stats();
+      for (const auto & p : pools->local)
+        st += p.second->stats();
+      return st;
+    }
+
     using request_type = http::fields;
 
     // possibly make it a distinct return type.
     using pool_ptr = variant2::variant<std::shared_ptr<basic_http_connection_pool<Executor>>,
-                                       std::shared_ptr<basic_https_connection_pool<Executor>>>;
+                                       std::shared_ptr<basic_https_connection_pool<Executor>>,
+                                       std::shared_ptr<basic_unix_connection_pool<Executor>>>;
     pool_ptr get_pool(urls::url_view url, error_code & ec);
     pool_ptr get_pool(urls::url_view url)
     {
@@ -86,17 +415,71 @@ struct basic_session
       return res;
     }
 
+    /// Resolve the pool through a prepared handle, see basic_endpoint_ref:
+    /// while the handle's cache is current this is two relaxed loads and a
+    /// weak_ptr lock - no key build, no table walk.
+    pool_ptr get_pool(basic_endpoint_ref<Executor> & ep, error_code & ec)
+    {
+      pool_ptr p;
+      if (pool_from_(ep, p))
+        return p;
+      const auto epoch = pools_epoch_.load(std::memory_order_acquire);
+      p = get_pool(ep.url(), ec);
+      if (!ec)
+        cache_endpoint_(ep, p, epoch);
+      return p;
+    }
+    pool_ptr get_pool(basic_endpoint_ref<Executor> & ep)
+    {
+      boost::system::error_code ec;
+      auto res = get_pool(ep, ec);
+      if (ec)
+        throw_exception(system::system_error(ec, "get_pool"));
+      return res;
+    }
+
     template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, pool_ptr)) CompletionToken
                   BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
     BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code, pool_ptr))
     async_get_pool(urls::url_view path,
                    CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
 
+    /// Resolve the pool through a prepared handle, see basic_endpoint_ref;
+    /// a current cache completes through a post without touching the table.
+    template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, pool_ptr)) CompletionToken
+                  BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code, pool_ptr))
+    async_get_pool(basic_endpoint_ref<Executor> & ep,
+                   CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
+
+    /// Warm the pool for `url` up to n connections, see basic_connection_pool::async_prewarm.
+    template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code)) CompletionToken
+                  BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code))
+    async_prewarm(urls::url_view url, std::size_t n,
+                  CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
+
     void shutdown()
     {
-      http_pools_.clear();
-      https_pools_.clear();
+      publish_pools_(std::make_shared<pool_table_>());
     }
+
+    /// Wind the session down gracefully instead of the hard cut of
+    /// shutdown(): new requests are refused with error::session_draining
+    /// right away, requests already running keep their connections, and
+    /// every connection is closed the moment it goes idle. Completes once
+    /// nothing is left in flight - or with asio::error::timed_out when
+    /// `timeout` passes first, closing whatever still runs. Either way the
+    /// pools are gone afterwards. Draining is one-way; a session that
+    /// should take traffic again is a new session.
+    template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code)) CompletionToken
+                  BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (boost::system::error_code))
+    async_drain(std::chrono::steady_clock::duration timeout,
+                CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
+
+    /// Whether async_drain started; new requests shed once it did.
+    bool draining() const {return draining_.load(std::memory_order_relaxed);}
     using stream = basic_stream<Executor>;
 
 
@@ -105,7 +488,10 @@ struct basic_session
                urls::url_view path,
                RequestBody && body,
                http::fields req,
-               system::error_code & ec) -> stream;
+               system::error_code & ec) -> stream
+    {
+      return ropen_(method, path, std::forward<RequestBody>(body), std::move(req), nullptr, ec);
+    }
 
     template<typename RequestBody>
     auto ropen(beast::http::verb method,
@@ -120,10 +506,40 @@ struct basic_session
       return res;
     }
 
+    /// As ropen(method, url, ...), resolving the pool through a prepared
+    /// handle - the first hop skips parse and table walk while the
+    /// handle's cache is current; redirect hops go through the regular
+    /// lookup.
+    template<typename RequestBody>
+    auto ropen(beast::http::verb method,
+               basic_endpoint_ref<Executor> & ep,
+               RequestBody && body,
+               http::fields req,
+               system::error_code & ec) -> stream
+    {
+      return ropen_(method, ep.url(), std::forward<RequestBody>(body), std::move(req), &ep, ec);
+    }
+
+    template<typename RequestBody>
+    auto ropen(beast::http::verb method,
+               basic_endpoint_ref<Executor> & ep,
+               RequestBody && body,
+               http::fields req) -> stream
+    {
+      boost::system::error_code ec;
+      auto res = ropen(method, ep, std::move(body), std::move(req), ec);
+      if (ec)
+        throw_exception(system::system_error(ec, "ropen"));
+      return res;
+    }
+
     template<typename Body>
     auto ropen(urls::url_view url,
                http::request<Body>& req,
-               system::error_code & ec) -> stream;
+               system::error_code & ec) -> stream
+    {
+      return ropen_(url, req, nullptr, ec);
+    }
 
     template<typename Body>
     auto ropen(urls::url_view url,
@@ -136,6 +552,26 @@ struct basic_session
       return res;
     }
 
+    /// As ropen(url, req, ...), resolving the pool through a prepared handle.
+    template<typename Body>
+    auto ropen(basic_endpoint_ref<Executor> & ep,
+               http::request<Body>& req,
+               system::error_code & ec) -> stream
+    {
+      return ropen_(ep.url(), req, &ep, ec);
+    }
+
+    template<typename Body>
+    auto ropen(basic_endpoint_ref<Executor> & ep,
+               http::request<Body>& req) -> stream
+    {
+      boost::system::error_code ec;
+      auto res = ropen(ep, req, ec);
+      if (ec)
+        throw_exception(system::system_error(ec, "ropen"));
+      return res;
+    }
+
     template<typename RequestBody,
               BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, basic_stream<Executor>)) CompletionToken
                   BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
@@ -156,24 +592,546 @@ struct basic_session
                 http::request<RequestBody> & req,
                 CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
 
+    /// As async_ropen(method, url, ...), resolving the pool through a
+    /// prepared handle, see basic_endpoint_ref. The handle must stay alive
+    /// until completion.
+    template<typename RequestBody,
+              BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, basic_stream<Executor>)) CompletionToken
+                  BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken,
+                                       void (boost::system::error_code, basic_stream<Executor>))
+    async_ropen(beast::http::verb method,
+                basic_endpoint_ref<Executor> & ep,
+                RequestBody && body,
+                http::fields req,
+                CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
+
+    /// As async_ropen(url, req, ...), resolving the pool through a prepared
+    /// handle. The handle must stay alive until completion.
+    template<typename RequestBody,
+              BOOST_ASIO_COMPLETION_TOKEN_FOR(void (boost::system::error_code, basic_stream<Executor>)) CompletionToken
+                  BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+    BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken,
+                                       void (boost::system::error_code, basic_stream<Executor>))
+    async_ropen(basic_endpoint_ref<Executor> & ep,
+                http::request<RequestBody> & req,
+                CompletionToken && completion_token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
+
   private:
+    template<typename RequestBody>
+    auto ropen_(beast::http::verb method,
+                urls::url_view path,
+                RequestBody && body,
+                http::fields req,
+                basic_endpoint_ref<Executor> * ep,
+                system::error_code & ec) -> stream;
+
+    template<typename Body>
+    auto ropen_(urls::url_view url,
+                http::request<Body>& req,
+                basic_endpoint_ref<Executor> * ep,
+                system::error_code & ec) -> stream;
+
     asio::ssl::context sslctx_{asio::ssl::context_base::tls_client};
     detail::basic_mutex<executor_type> mutex_;
 
     struct request_options options_{default_options()};
 
-    using host_ = std::pair<
-        std::basic_string<char, std::char_traits<char>, container::pmr::polymorphic_allocator<char>>, unsigned short>;
+    // per-authority overrides, see set_options; the flag keeps the
+    // no-override steady state at a relaxed load, like the rate limits
+    mutable std::mutex options_mtx_;
+    std::atomic<bool> has_option_overrides_{false};
+    boost::unordered_map<std::string, struct request_options> option_overrides_;
+
+    // alternative services on file, keyed like the option overrides; the
+    // flag again keeps the steady state without one at a relaxed load
+    struct alt_svc_
+    {
+      std::string authority;
+      std::chrono::system_clock::time_point expiry;
+    };
+    mutable std::mutex alt_svc_mtx_;
+    std::atomic<bool> has_alt_svc_{false};
+    boost::unordered_map<std::string, alt_svc_> alt_svcs_;
+
+    // Record Alt-Svc advertisements from a response. Only https origins are
+    // honored - the alternative must authenticate as the origin, which the
+    // pools enforce by keeping SNI and the certificate check on it - and
+    // only http/1.1 alternatives, the one protocol spoken here.
+    void record_alt_svc_(urls::url_view url, const http::response_header & hd)
+    {
+      if ((url.scheme_id() != urls::scheme::https)
+       && (url.scheme_id() != urls::scheme::wss))
+        return;
+      const auto itr = hd.base().find(http::field::alt_svc);
+      if (itr == hd.base().end())
+        return;
+      const auto parsed = parse_alt_svc_field(itr->value());
+      if (parsed.has_error())
+        return; // a malformed hint is no reason to disturb the response
+      const auto origin = url.encoded_host_and_port();
+      if (parsed->empty()) // "clear"
+        return set_alt_svc(origin, "");
+      for (const auto & alt : *parsed)
+      {
+        if (alt.protocol != "http/1.1")
+          continue;
+        // an elided host means the origin's own host on another port
+        std::string authority = alt.authority.front() == ':'
+            ? std::string(url.encoded_host()) + alt.authority : alt.authority;
+        if (urls::parse_authority(authority).has_error())
+          continue;
+        return set_alt_svc(origin, authority, alt.expiry);
+      }
+    }
+
+    resolver_cache dns_cache_;
+    // the session's own cache unless use_dns_cache pointed it elsewhere
+    resolver_cache * dns_cache_ptr_{&dns_cache_};
+    // a cross-session ticket cache, see use_tls_sessions; nullptr means
+    // every https pool keeps its own.
+    detail::ssl_session_cache * shared_tls_{nullptr};
+    urls::url proxy_;
+
+    // Network knowledge restored by restore_state that waits for the pool
+    // that will use it, keyed like warm_key_ and consumed when get_pool
+    // creates the matching pool. The flag keeps the usual no-snapshot
+    // steady state at a relaxed load, like the alt-svc table.
+    struct warm_origin_
+    {
+      struct score_
+      {
+        std::string address;
+        std::uint16_t port;
+        double connect_ms, failure;
+      };
+      std::vector<score_> scores;
+      std::vector<std::pair<std::string, std::string>> tickets; // SNI host, DER
+    };
+    std::mutex warm_mtx_;
+    std::atomic<bool> has_warm_origins_{false};
+    boost::unordered_map<std::string, warm_origin_> warm_origins_;
+
+    static std::string warm_key_(bool is_https, core::string_view host, std::uint16_t port)
+    {
+      std::string res = is_https ? "https:" : "http:";
+      res.append(host.begin(), host.end());
+      res += ':';
+      res += std::to_string(port);
+      return res;
+    }
+
+    // hand over the warm entry for `key`, consuming it
+    bool take_warm_(const std::string & key, warm_origin_ & out)
+    {
+      if (!has_warm_origins_.load(std::memory_order_relaxed))
+        return false;
+      std::lock_guard<std::mutex> lock{warm_mtx_};
+      const auto itr = warm_origins_.find(key);
+      if (itr == warm_origins_.end())
+        return false;
+      out = std::move(itr->second);
+      warm_origins_.erase(itr);
+      has_warm_origins_.store(!warm_origins_.empty(), std::memory_order_relaxed);
+      return true;
+    }
+
+    // only an https pool has a ticket cache to fill; partial ordering
+    // picks this overload over the template below for one.
+    template<typename Executor2>
+    static void warm_tickets_(basic_https_connection_pool<Executor2> & pool, const warm_origin_ & w)
+    {
+      for (const auto & tk : w.tickets)
+        pool.ssl_sessions().import_session(tk.first, tk.second);
+    }
+    template<typename Pool>
+    static void warm_tickets_(Pool &, const warm_origin_ &) {}
+
+    // seed a freshly created pool with whatever a restored snapshot holds
+    // for its origin, see restore_state. A proxied pool dials the proxy,
+    // not the origin's addresses, so it gets nothing; an address that no
+    // longer parses is skipped.
+    template<typename Pool>
+    void warm_pool_(Pool & pool, const host_ & key, bool is_https)
+    {
+      if (!std::get<2>(key).empty())
+        return;
+      warm_origin_ w;
+      if (!take_warm_(warm_key_(is_https,
+                                core::string_view(std::get<0>(key).data(), std::get<0>(key).size()),
+                                std::get<1>(key)), w))
+        return;
+      for (const auto & sc : w.scores)
+      {
+        system::error_code aec;
+        const auto addr = asio::ip::make_address(sc.address, aec);
+        if (!aec)
+          pool.import_endpoint_quality(typename Pool::endpoint_type(addr, sc.port),
+                                       sc.connect_ms, sc.failure);
+      }
+      warm_tickets_(pool, w);
+    }
+
+    // session-wide admission, see set_concurrency_limit. The semaphore is
+    // only armed once a limit is set; queued_ counts parked acquisitions to
+    // bound the wait queue.
+    std::size_t max_inflight_{0u};
+    std::size_t max_queued_{(std::numeric_limits<std::size_t>::max)()};
+    std::atomic<std::size_t> queued_{0u};
+    detail::basic_semaphore<executor_type> budget_{mutex_.get_executor(), 0};
+
+    // One in-flight slot as RAII: the stream carries it over the response's
+    // lifetime and its release wakes one queued request. The session must
+    // outlive its streams, which the pools it hands out require anyway.
+    std::shared_ptr<void> make_budget_slot_()
+    {
+      auto * sem = &budget_;
+      return std::shared_ptr<void>(static_cast<void*>(sem),
+                                   [sem](void *) { sem->release(); });
+    }
+
+    // Token buckets pacing requests per authority, see set_rate_limit. All
+    // of them refill off the same steady clock, so the relative pacing of
+    // hosts stays consistent.
+    struct rate_bucket_
+    {
+      double per_second, capacity, tokens;
+      std::chrono::steady_clock::time_point last;
+      std::mutex mtx;
+
+      rate_bucket_(double per_second, double capacity)
+          : per_second(per_second), capacity(capacity), tokens(capacity),
+            last(std::chrono::steady_clock::now()) {}
+
+      // take one token, or say how long until one will be there
+      std::chrono::steady_clock::duration acquire_or_delay()
+      {
+        std::lock_guard<std::mutex> lock{mtx};
+        const auto now = std::chrono::steady_clock::now();
+        tokens = (std::min)(capacity,
+                            tokens + std::chrono::duration<double>(now - last).count() * per_second);
+        last = now;
+        if (tokens >= 1.)
+        {
+          tokens -= 1.;
+          return std::chrono::steady_clock::duration::zero();
+        }
+        return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>((1. - tokens) / per_second));
+      }
+    };
+
+    std::mutex rate_mtx_;
+    std::atomic<bool> has_rate_limits_{false};
+    boost::unordered_map<std::string, std::shared_ptr<rate_bucket_>> rate_limits_;
+
+    // the flag keeps the unlimited steady state at a relaxed load, no lock
+    std::shared_ptr<rate_bucket_> rate_bucket_for_(core::string_view authority)
+    {
+      if (!has_rate_limits_.load(std::memory_order_relaxed))
+        return nullptr;
+      std::lock_guard<std::mutex> lock{rate_mtx_};
+      const auto itr = rate_limits_.find(std::string(authority));
+      return itr == rate_limits_.end() ? nullptr : itr->second;
+    }
+
+    // buffers a claimed response asynchronously before the flight ends
+    template<typename>
+    friend struct detail::async_sf_fill_op;
+
+    // One coalesced GET in flight, see use_single_flight: the claimant
+    // buffers the response into `payload` and everyone parked on the
+    // flight replays it. All members are guarded by sf_mtx_.
+    struct sf_flight_
+    {
+      bool done = false;
+      system::error_code ec;
+      std::string payload, host; // the serialized response, replay form
+      std::condition_variable cv; // synchronous followers park here
+      std::vector<std::function<void(system::error_code)>> waiters; // asynchronous ones
+    };
+
+    bool use_single_flight_{false};
+    std::mutex sf_mtx_;
+    boost::unordered_map<std::string, std::shared_ptr<sf_flight_>> sf_flights_;
+
+    // the flight key: URL plus the headers a server may vary the response on
+    static std::string sf_key_(urls::url_view url, const http::fields & hd)
+    {
+      std::string res{url.buffer()};
+      for (auto f : {http::field::authorization, http::field::cookie,
+                     http::field::accept, http::field::accept_encoding,
+                     http::field::accept_language, http::field::range})
+      {
+        res += '\x1f';
+        const auto itr = hd.find(f);
+        if (itr != hd.end())
+          res.append(itr->value().begin(), itr->value().end());
+      }
+      return res;
+    }
+
+    // Claim the flight for `key` or park on it: true means the caller
+    // dials out and later hands in the outcome through sf_finish_;
+    // otherwise `cb` runs - on the claimant's thread, like the resolver
+    // cache's single-flight - once the flight ends. `flight` comes back
+    // filled either way.
+    bool sf_claim_(const std::string & key, std::shared_ptr<sf_flight_> & flight,
+                   std::function<void(system::error_code)> cb)
+    {
+      std::lock_guard<std::mutex> lock{sf_mtx_};
+      auto & slot = sf_flights_[key];
+      if (slot == nullptr)
+      {
+        slot = flight = std::make_shared<sf_flight_>();
+        return true;
+      }
+      flight = slot;
+      flight->waiters.push_back(std::move(cb));
+      return false;
+    }
+
+    // serve `payload` as a stream - the same replay mechanism a cache hit
+    // uses, one copy of the bytes per reader
+    stream sf_replay_(std::string payload, std::string host)
+    {
+      auto * src = new detail::cache_replay(asio::any_io_executor(get_executor()), std::move(host));
+      src->owned_ = std::move(payload);
+      src->base_  = src->owned_.data();
+      src->size_  = src->owned_.size();
+      stream str{get_executor(), src};
+      str.parser_ = detail::make_pmr<http::response_parser<http::buffer_body>>(
+          container::pmr::get_default_resource(), http::response_header{});
+      system::error_code ec;
+      src->do_read_header_(*str.parser_, ec); // cannot fail on bytes serialized here
+      return str;
+    }
+
+    // whether the response on `str` can be buffered for replay: known
+    // length within bounds, not content-decoded, not chunked
+    bool sf_bufferable_(stream & str) const
+    {
+      return str.parser_ != nullptr && !str.inflater_
+          && str.parser_->is_header_done() && !str.parser_->chunked()
+          && str.parser_->content_length()
+          && *str.parser_->content_length() <= BOOST_REQUESTS_SINGLE_FLIGHT_MAX_SIZE;
+    }
+
+    // end the flight: publish the outcome, wake the parked followers and
+    // run the asynchronous waiters (on this thread, like the resolver
+    // cache's single-flight)
+    void sf_publish_(const std::shared_ptr<sf_flight_> & flight, const std::string & key,
+                     std::string payload, std::string host, system::error_code ec)
+    {
+      std::vector<std::function<void(system::error_code)>> waiters;
+      {
+        std::lock_guard<std::mutex> lock{sf_mtx_};
+        flight->done = true;
+        flight->ec = ec;
+        flight->payload = std::move(payload);
+        flight->host = std::move(host);
+        waiters.swap(flight->waiters);
+        sf_flights_.erase(key);
+      }
+      flight->cv.notify_all();
+      for (auto & w : waiters)
+        w(ec);
+    }
+
+    // claimant's end once the body sits in `buf`: serialize it the way the
+    // http cache does, fan it out, and serve the claimant its own replay
+    stream sf_serve_(const std::shared_ptr<sf_flight_> & flight, const std::string & key,
+                     stream str, beast::flat_buffer & buf)
+    {
+      const auto hv = str.impl_->get_host_();
+      std::string host{hv.begin(), hv.end()};
+      auto payload = http_cache::make_payload_(
+          http::response_header(str.headers()),
+          core::string_view(static_cast<const char *>(buf.data().data()), buf.data().size()));
+      sf_publish_(flight, key, payload, host, system::error_code{});
+      auto res = sf_replay_(std::move(payload), std::move(host));
+      res.history_ = std::move(str.history_);
+      res.timings_ = str.timings_;
+      return res;
+    }
+
+    // Claimant's end of a flight, synchronous flavour: buffer the response
+    // if it can be replayed, fan the outcome out to everyone parked, and
+    // serve the claimant its own replay. A response that cannot be
+    // buffered ends the flight empty-handed and passes through untouched;
+    // a failed buffering read surfaces through `ec`. A nullptr flight -
+    // the caller never claimed one - passes everything through. The async
+    // ropen op buffers through detail::async_sf_fill_op instead, so this
+    // blocking read never runs on an io thread.
+    stream sf_finish_(const std::shared_ptr<sf_flight_> & flight, const std::string & key,
+                      stream str, system::error_code & ec)
+    {
+      if (flight == nullptr)
+        return str;
+      if (ec || !sf_bufferable_(str))
+      {
+        sf_publish_(flight, key, {}, {}, ec);
+        return str;
+      }
+      beast::flat_buffer buf;
+      str.read(buf, ec);
+      if (ec)
+      {
+        sf_publish_(flight, key, {}, {}, ec);
+        return str;
+      }
+      return sf_serve_(flight, key, std::move(str), buf);
+    }
+
+    // (host, port, proxy-authority) - a proxy change yields distinct pools.
+    using host_ = std::tuple<
+        std::basic_string<char, std::char_traits<char>, container::pmr::polymorphic_allocator<char>>, unsigned short,
+        std::basic_string<char, std::char_traits<char>, container::pmr::polymorphic_allocator<char>>>;
 
-    boost::unordered_map<host_, std::shared_ptr<basic_http_connection_pool<Executor>>> http_pools_;
-    boost::unordered_map<host_, std::shared_ptr<basic_https_connection_pool<Executor>>> https_pools_;
+    // The pools live in an immutable snapshot that gets swapped out under
+    // mutex_ when a pool is created, so the steady-state lookup of an
+    // existing pool is a plain atomic load plus a hash lookup - no lock.
+    struct pool_table_
+    {
+      boost::unordered_map<host_, std::shared_ptr<basic_http_connection_pool<Executor>>> http;
+      boost::unordered_map<host_, std::shared_ptr<basic_https_connection_pool<Executor>>> https;
+      // unix:// URLs, keyed by the socket path in place of the host.
+      boost::unordered_map<host_, std::shared_ptr<basic_unix_connection_pool<Executor>>> local;
+    };
+    std::shared_ptr<const pool_table_> pools_{std::make_shared<pool_table_>()};
+
+    // bumped with every snapshot swap; endpoint_ref caches carry the epoch
+    // they were filled at and fall back to the regular lookup once it moved.
+    std::atomic<std::uint64_t> pools_epoch_{1u};
+
+    void publish_pools_(std::shared_ptr<pool_table_> next)
+    {
+      std::atomic_store(&pools_, std::shared_ptr<const pool_table_>(std::move(next)));
+      pools_epoch_.fetch_add(1u, std::memory_order_release);
+    }
+
+    // the fast path of the prepared-handle lookup, see basic_endpoint_ref
+    bool pool_from_(basic_endpoint_ref<Executor> & ep, pool_ptr & out)
+    {
+      if (ep.session_ != this || ep.epoch_ != pools_epoch_.load(std::memory_order_acquire))
+        return false;
+      return variant2::visit([&](const auto & wp)
+          {
+            auto sp = wp.lock();
+            if (sp == nullptr)
+              return false;
+            out = std::move(sp);
+            return true;
+          }, ep.pool_);
+    }
+
+    void cache_endpoint_(basic_endpoint_ref<Executor> & ep, const pool_ptr & p, std::uint64_t epoch)
+    {
+      ep.session_ = this;
+      ep.epoch_ = epoch;
+      variant2::visit([&](const auto & sp)
+          {
+            ep.pool_ = typename std::decay_t<decltype(sp)>::weak_type(sp);
+          }, p);
+    }
 
     // this isn't great
     boost::container::pmr::synchronized_pool_resource pmr_;
     cookie_jar jar_{boost::container::pmr::polymorphic_allocator<char>(&pmr_)};
+    // the session's own jar unless use_cookie_jar pointed it elsewhere
+    cookie_jar * jar_ptr_{&jar_};
+
+    detail::arena_pool arena_pool_;
+    bool use_arena_{false};
+
+    detail::intern_table intern_;
+
+    trace_hook * trace_hook_{nullptr};
 
+    // see request_latency() et al; filled in by async_ropen_op from the
+    // timing stamps, which the op supplies itself when the caller did not.
+    latency_histogram request_latency_, pool_wait_latency_, handshake_latency_;
+
+    void record_latencies_(timing::duration total, const timing * tm)
+    {
+      request_latency_.record(total);
+      if (tm == nullptr)
+        return;
+      if (tm->connection_acquired != timing::time_point())
+        pool_wait_latency_.record(tm->connection_acquired - tm->pool_queued);
+      if (tm->handshake_done != timing::time_point())
+        handshake_latency_.record(tm->handshake_done - tm->connect_done);
+    }
+
+    http_cache * cache_{nullptr};
+
+
+    // see async_drain; checked on every request's way in
+    std::atomic<bool> draining_{false};
+
+    // one drain sweep over every pool, see basic_connection_pool::close_idle
+    std::size_t close_idle_()
+    {
+      std::size_t busy = 0u;
+      auto pools = std::atomic_load(&pools_);
+      for (const auto & p : pools->http)
+        busy += p.second->close_idle();
+      for (const auto & p : pools->https)
+        busy += p.second->close_idle();
+      for (const auto & p : pools->local)
+        busy += p.second->close_idle();
+      return busy;
+    }
+
+    // every pool created by this session counts its sockets here, see
+    // set_connection_budget; inert while the limit stays zero.
+    detail::conn_budget conn_budget_;
+
+    // the reclaim behind the budget: close one idle connection from the
+    // least recently used pool that has one. `requester` is the pool doing
+    // the asking - it holds its own mutex, so it is spared, and the pools
+    // polled use try_lock (see basic_connection_pool::reclaim_idle), so two
+    // pools reclaiming towards each other cannot deadlock.
+    std::size_t reclaim_idle_(const void * requester)
+    {
+      const auto pools = std::atomic_load(&pools_);
+      std::vector<pool_ptr> order;
+      order.reserve(pools->http.size() + pools->https.size() + pools->local.size());
+      for (const auto & p : pools->http)
+        order.emplace_back(p.second);
+      for (const auto & p : pools->https)
+        order.emplace_back(p.second);
+      for (const auto & p : pools->local)
+        order.emplace_back(p.second);
+
+      const auto last_use = [](const pool_ptr & p)
+      {
+        return variant2::visit([](const auto & sp) {return sp->last_use();}, p);
+      };
+      std::sort(order.begin(), order.end(),
+                [&](const pool_ptr & lhs, const pool_ptr & rhs)
+                {
+                  return last_use(lhs) < last_use(rhs);
+                });
+
+      for (const auto & p : order)
+      {
+        const auto freed = variant2::visit(
+            [&](const auto & sp) -> std::size_t
+            {
+              if (static_cast<const void *>(sp.get()) == requester)
+                return 0u;
+              return sp->reclaim_idle(1u);
+            }, p);
+        if (freed > 0u)
+          return freed;
+      }
+      return 0u;
+    }
 
     struct async_get_pool_op;
+    struct async_prewarm_op;
+    struct async_drain_op;
 
     template<typename RequestBody>
     struct async_ropen_op;
@@ -185,6 +1143,7 @@ struct basic_session
 };
 
 typedef basic_session<> session;
+typedef basic_endpoint_ref<> endpoint_ref;
 
 #if !defined(BOOST_REQUESTS_HEADER_ONLY)
 extern template struct basic_session<asio::any_io_executor>;
@@ -0,0 +1,102 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_SOCKET_OPTIONS_HPP
+#define BOOST_REQUESTS_SOCKET_OPTIONS_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/socket_base.hpp>
+#include <boost/system/error_code.hpp>
+#include <chrono>
+
+#if defined(__linux__)
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#endif
+
+namespace boost
+{
+namespace requests
+{
+
+/// Options applied to a freshly opened socket, between open and connect,
+/// so the very first request already benefits - setting TCP_NODELAY
+/// through next_layer() after the fact is too late for it. Attach to a
+/// connection or pool with set_socket_options; takes effect from the
+/// next dial.
+struct socket_options
+{
+  /// Disable Nagle's algorithm (TCP_NODELAY). Small requests otherwise
+  /// interact with delayed ACK into ~40ms stalls.
+  bool no_delay = true;
+  /// SO_SNDBUF / SO_RCVBUF; zero keeps the kernel default.
+  int send_buffer_size = 0;
+  int receive_buffer_size = 0;
+  /// SO_KEEPALIVE, with the probe knobs below where supported (Linux).
+  bool keep_alive = false;
+  /// TCP_KEEPIDLE / TCP_KEEPINTVL / TCP_KEEPCNT; zero keeps the default.
+  std::chrono::seconds keep_idle{0};
+  std::chrono::seconds keep_interval{0};
+  int keep_count = 0;
+  /// TCP_FASTOPEN_CONNECT (Linux): carry the request bytes in the SYN
+  /// once the server has handed out a fast-open cookie.
+  bool fast_open = false;
+};
+
+namespace detail
+{
+
+#if defined(__linux__)
+// raw IPPROTO_TCP options asio has no named wrapper for
+template<int Name>
+struct tcp_int_option
+{
+  int value_;
+  explicit tcp_int_option(int value) : value_(value) {}
+  template<typename Protocol> int level(const Protocol &) const {return IPPROTO_TCP;}
+  template<typename Protocol> int name (const Protocol &) const {return Name;}
+  template<typename Protocol> const void * data(const Protocol &) const {return &value_;}
+  template<typename Protocol> std::size_t size(const Protocol &) const {return sizeof(value_);}
+};
+#endif
+
+// Best effort on purpose: an option the platform or protocol rejects is
+// skipped; whether the dial succeeds is the connect's own business.
+template<typename Socket>
+void apply_socket_options(Socket & sock, const socket_options & opts)
+{
+  system::error_code ign;
+  if (opts.no_delay)
+    sock.set_option(asio::ip::tcp::no_delay(true), ign);
+  if (opts.send_buffer_size > 0)
+    sock.set_option(asio::socket_base::send_buffer_size(opts.send_buffer_size), ign);
+  if (opts.receive_buffer_size > 0)
+    sock.set_option(asio::socket_base::receive_buffer_size(opts.receive_buffer_size), ign);
+  if (opts.keep_alive)
+  {
+    sock.set_option(asio::socket_base::keep_alive(true), ign);
+#if defined(__linux__)
+    if (opts.keep_idle.count() > 0)
+      sock.set_option(tcp_int_option<TCP_KEEPIDLE>(static_cast<int>(opts.keep_idle.count())), ign);
+    if (opts.keep_interval.count() > 0)
+      sock.set_option(tcp_int_option<TCP_KEEPINTVL>(static_cast<int>(opts.keep_interval.count())), ign);
+    if (opts.keep_count > 0)
+      sock.set_option(tcp_int_option<TCP_KEEPCNT>(opts.keep_count), ign);
+#endif
+  }
+#if defined(__linux__) && defined(TCP_FASTOPEN_CONNECT)
+  if (opts.fast_open)
+    sock.set_option(tcp_int_option<TCP_FASTOPEN_CONNECT>(1), ign);
+#endif
+}
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_SOCKET_OPTIONS_HPP
@@ -0,0 +1,89 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_SOURCE_HPP
+#define BOOST_REQUESTS_SOURCE_HPP
+
+#include <boost/asio/buffer.hpp>
+#include <boost/beast/http/message.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/core/span.hpp>
+#include <boost/optional.hpp>
+#include <boost/requests/detail/config.hpp>
+#include <functional>
+#include <string>
+#include <utility>
+
+namespace boost {
+namespace requests {
+
+/// A pull-based request body: the payload is produced chunk by chunk while
+/// the request is being written, instead of being materialized up front
+/// like the string, span and file bodies in body_traits.hpp. That keeps an
+/// upload that is generated on the fly - compressed batches, serialized
+/// streams - at one staging buffer of memory, whatever its total size.
+///
+/// `read` fills the given buffer and returns the number of bytes written;
+/// zero means the body is complete, and a set error code aborts the
+/// request. It is called from whichever thread runs the serializer, one
+/// call at a time.
+struct source
+{
+  using read_fn = std::function<std::size_t(span<char>, system::error_code &)>;
+
+  read_fn read;
+  std::string content_type = "application/octet-stream";
+
+  source() = default;
+  source(read_fn fn) : read(std::move(fn)) {}
+  source(read_fn fn, core::string_view content_type)
+      : read(std::move(fn)), content_type(content_type)
+  {
+  }
+};
+
+/// The upload body for source. The producer is pulled through a staging
+/// buffer, like the file parts of multipart_body. There is no size(), so
+/// the request goes out chunked.
+struct source_body
+{
+  using value_type = source;
+
+  struct writer
+  {
+    using const_buffers_type = asio::const_buffer;
+
+    template<bool IsRequest, typename Fields>
+    writer(const beast::http::header<IsRequest, Fields> &, const value_type & body)
+        : body_(body)
+    {
+    }
+
+    void init(system::error_code & ec)
+    {
+      ec = {};
+    }
+
+    boost::optional<std::pair<const_buffers_type, bool>> get(system::error_code & ec)
+    {
+      ec = {};
+      const auto n = body_.read(span<char>(buffer_, sizeof(buffer_)), ec);
+      if (ec || n == 0u)
+        return boost::none;
+      return std::make_pair(const_buffers_type(buffer_, n), true);
+    }
+
+   private:
+    const value_type & body_;
+    char buffer_[BOOST_REQUESTS_CHUNK_SIZE];
+  };
+};
+
+}
+}
+
+#endif // BOOST_REQUESTS_SOURCE_HPP
@@ -15,7 +15,17 @@
 #define BOOST_REQUESTS_SOURCE
 #endif
 
+#include <boost/requests/detail/impl/alpn.ipp>
+#include <boost/requests/detail/impl/arena.ipp>
+#include <boost/requests/detail/impl/buffer_pool.ipp>
+#include <boost/requests/detail/impl/deflate.ipp>
+#include <boost/requests/detail/impl/inflate.ipp>
+#include <boost/requests/detail/impl/mmap_body.ipp>
+#include <boost/requests/detail/impl/parser_pool.ipp>
 #include <boost/requests/detail/impl/ssl.ipp>
+#include <boost/requests/detail/impl/timer_wheel.ipp>
+#include <boost/requests/detail/impl/ssl_session_cache.ipp>
+#include <boost/requests/fields/impl/alt_svc.ipp>
 #include <boost/requests/fields/impl/keep_alive.ipp>
 #include <boost/requests/fields/impl/link.ipp>
 #include <boost/requests/fields/impl/location.ipp>
@@ -23,14 +33,19 @@
 #include <boost/requests/impl/connection.ipp>
 #include <boost/requests/impl/connection_pool.ipp>
 #include <boost/requests/impl/cookie_jar.ipp>
+#include <boost/requests/impl/digest.ipp>
 #include <boost/requests/impl/error.ipp>
+#include <boost/requests/impl/flat_headers.ipp>
+#include <boost/requests/impl/http_cache.ipp>
 #include <boost/requests/impl/json.ipp>
 #include <boost/requests/impl/keep_alive.ipp>
 #include <boost/requests/impl/mime_types.ipp>
+#include <boost/requests/impl/prepared_request.ipp>
 #include <boost/requests/impl/public_suffix.ipp>
 #include <boost/requests/impl/redirect.ipp>
 #include <boost/requests/impl/request_options.ipp>
 #include <boost/requests/impl/request_settings.ipp>
+#include <boost/requests/impl/resolver_cache.ipp>
 #include <boost/requests/impl/response.ipp>
 #include <boost/requests/impl/session.ipp>
 #include <boost/requests/rfc/impl/dates.ipp>
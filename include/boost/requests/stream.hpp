@@ -8,16 +8,23 @@
 #ifndef BOOST_REQUESTS_STREAM_HPP
 #define BOOST_REQUESTS_STREAM_HPP
 
+#include <boost/requests/cookie_jar.hpp>
 #include <boost/requests/detail/config.hpp>
+#include <boost/requests/detail/inflate.hpp>
+#include <boost/requests/detail/sbo_buffer.hpp>
 #include <boost/requests/detail/tracker.hpp>
 #include <boost/requests/fields/keep_alive.hpp>
 #include <boost/requests/http.hpp>
+#include <boost/requests/redirect.hpp>
+#include <boost/requests/timing.hpp>
 #include <boost/requests/detail/async_coroutine.hpp>
 #include <boost/beast/http/basic_parser.hpp>
 #include <boost/asio/execution/bad_executor.hpp>
 #include <boost/asem/basic_mutex.hpp>
 #include <boost/asem/lock_guard.hpp>
 
+#include <functional>
+
 namespace boost
 {
 namespace requests
@@ -25,17 +32,73 @@ namespace requests
 namespace detail
 {
 
+// A type-erased MutableBufferSequence for the virtual read seam below:
+// the caller flattens its sequence into a small array it owns and one
+// do_read_body_direct_ call scatter-fills every region - one dispatch
+// and one readv regardless of the consumer's buffer topology, where a
+// ring buffer's split free space used to take two reads or a copy.
+struct buffer_span
+{
+  buffer_span(const asio::mutable_buffer * first, std::size_t count)
+      : first_(first), count_(count) {}
+  // a single region; the referenced buffer must outlive the read.
+  buffer_span(const asio::mutable_buffer & buffer)
+      : first_(&buffer), count_(1u) {}
+
+  const asio::mutable_buffer * begin() const {return first_;}
+  const asio::mutable_buffer * end()   const {return first_ + count_;}
+
+ private:
+  const asio::mutable_buffer * first_;
+  std::size_t count_;
+};
+
 struct stream_base
 {
   virtual std::size_t do_read_some_(beast::http::basic_parser<false> & parser) = 0;
   virtual std::size_t do_read_some_(beast::http::basic_parser<false> & parser, system::error_code & ec) = 0;
   virtual void  do_async_read_some_(beast::http::basic_parser<false> & parser, detail::co_token_t<void(system::error_code, std::size_t)>) = 0;
 
+  // raw reads past the parser, used once the body can be framed without it.
+  // These scatter-fill the span's regions in order with a single read.
+  virtual std::size_t do_buffered_input_() const = 0;
+  virtual std::size_t do_read_body_direct_(buffer_span buffers, system::error_code & ec) = 0;
+  virtual void  do_async_read_body_direct_(buffer_span buffers, detail::co_token_t<void(system::error_code, std::size_t)>) = 0;
+
+  // in-place access to staged body bytes, so a consumer can parse them
+  // where they already sit instead of copying them out first, see
+  // basic_stream::peek_some. Staging pulls more bytes off the socket.
+  virtual asio::const_buffer do_staged_input_() const = 0;
+  virtual void do_consume_staged_(std::size_t n) = 0;
+  virtual std::size_t do_stage_input_(system::error_code & ec) = 0;
+  virtual void do_async_stage_input_(detail::co_token_t<void(system::error_code, std::size_t)>) = 0;
+
   virtual void do_close_(system::error_code & ec) = 0;
   virtual void do_async_close_(detail::co_token_t<void(system::error_code)>) = 0;
 
+#if defined(__linux__)
+  // kernel-side body transfer into a file descriptor, see basic_stream::splice_some.
+  // only the plain tcp instantiation supports it; `block` selects waiting on the
+  // socket here versus returning would_block so an async op can wait instead.
+  virtual bool do_supports_splice_() const = 0;
+  virtual std::size_t do_splice_body_(int fd, std::size_t n, bool block, system::error_code & ec) = 0;
+  virtual void do_async_wait_readable_(detail::co_token_t<void(system::error_code)>) = 0;
+#endif
+
+  // deferred header read for pipelined requests, see request_options::pipeline.
+  virtual void do_read_header_(beast::http::basic_parser<false> & parser, system::error_code & ec) = 0;
+  virtual void do_async_read_header_(beast::http::basic_parser<false> & parser, detail::co_token_t<void(system::error_code, std::size_t)>) = 0;
+  virtual core::string_view get_host_() const = 0;
+
   virtual keep_alive & get_keep_alive_set_() = 0;
   virtual bool is_open() const = 0;
+
+  // request teardown: give the staging buffer back to a shared pool, if any.
+  virtual void do_release_buffer_() = 0;
+
+  // streaming backpressure, see basic_stream::set_read_watermark. Only
+  // implementations that stage socket bytes care; replays ignore it.
+  virtual void do_set_read_watermark_(std::size_t) {}
 };
 
 struct pmr_deleter
@@ -69,6 +132,11 @@ std::unique_ptr<T, pmr_deleter> make_pmr(container::pmr::memory_resource * res,
 
 }
 
+struct http_cache;
+
+template<typename Executor>
+struct basic_session;
+
 template<typename Executor = asio::any_io_executor>
 struct basic_stream
 {
@@ -87,22 +155,30 @@ struct basic_stream
     return impl_ && impl_->is_open() && !done();
   }
 
-  /// Read some data from the request body.
-  template<typename MutableBuffer>
-  std::size_t read_some(const MutableBuffer & buffer)
+  /// Read some data from the request body. A sequence of several regions
+  /// is scatter-filled in one call once the read goes direct (see
+  /// detail::buffer_span); before that beast's parser fills the first
+  /// non-empty region per call.
+  template<typename MutableBufferSequence>
+  std::size_t read_some(const MutableBufferSequence & buffers)
   {
     boost::system::error_code ec;
-    auto res = read_some(buffer, ec);
+    auto res = read_some(buffers, ec);
     if (ec)
       throw_exception(system::system_error(ec, "read_some"));
     return res;
   }
 
   /// Read some data from the request body.
-  template<typename MutableBuffer>
-  std::size_t read_some(const MutableBuffer & buffer, system::error_code & ec);
+  template<typename MutableBufferSequence>
+  std::size_t read_some(const MutableBufferSequence & buffers, system::error_code & ec);
 
   /// Read some data from the request body.
+  ///
+  /// The token's associated cancellation slot aborts the read without
+  /// touching the connection; dropping the stream afterwards drains a small
+  /// remainder so the connection goes back to the pool, and only closes it
+  /// when draining would be expensive (BOOST_REQUESTS_MAX_DRAIN_SIZE).
   template<
       typename MutableBufferSequence,
       BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code, std::size_t)) CompletionToken
@@ -112,7 +188,12 @@ struct basic_stream
       const MutableBufferSequence & buffers,
       CompletionToken && token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
 
-  /// Read all the data from the request body.
+  /// Read all the data from the request body. A response that announced
+  /// its size is read with a single prepare() of exactly that size, so a
+  /// fixed-size body costs one allocation and goes straight into the
+  /// buffer's final storage; one announcing more than the buffer's
+  /// max_size() fails with beast::http::error::buffer_overflow before
+  /// anything is allocated or read.
   template<typename DynamicBuffer>
   std::size_t read(DynamicBuffer & buffer)
   {
@@ -128,7 +209,8 @@ struct basic_stream
   template<typename DynamicBuffer>
   std::size_t read(DynamicBuffer & buffer, system::error_code & ec);
 
-  /// Read all the data from the request body.
+  /// Read all the data from the request body, with the same exact
+  /// preallocation and max_size() guard as the synchronous read.
   template<
       typename DynamicBuffer,
       BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code, std::size_t)) CompletionToken
@@ -138,6 +220,160 @@ struct basic_stream
       DynamicBuffer & buffers,
       CompletionToken && token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
 
+  /// Read all the data from the request body into a response body buffer,
+  /// arming its spill-to-disk threshold from the request's options first
+  /// (see request_options::spill_threshold).
+  std::size_t read(detail::sbo_buffer & buffer)
+  {
+    boost::system::error_code ec;
+    auto res = read(buffer, ec);
+    if (ec)
+      throw_exception(system::system_error(ec, "read"));
+    return res;
+  }
+
+  /// Read all the data from the request body into a response body buffer.
+  /// A failed write against the spill file surfaces here as its errno; the
+  /// bytes that did not fit stay staged in memory.
+  std::size_t read(detail::sbo_buffer & buffer, system::error_code & ec)
+  {
+    buffer.set_spill_threshold(spill_threshold_);
+    const auto n = read<detail::sbo_buffer>(buffer, ec);
+    if (!ec && buffer.spill_errno() != 0)
+      ec.assign(buffer.spill_errno(), system::generic_category());
+    return n;
+  }
+
+  /// Read all the data from the request body into a response body buffer,
+  /// arming its spill-to-disk threshold from the request's options first.
+  /// A spill-file write failure is recorded in the buffer
+  /// (sbo_buffer::spill_errno) rather than the completion's error_code.
+  template<
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code, std::size_t)) CompletionToken
+          BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code, std::size_t))
+  async_read(
+      detail::sbo_buffer & buffer,
+      CompletionToken && token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+  {
+    buffer.set_spill_threshold(spill_threshold_);
+    return async_read<detail::sbo_buffer>(buffer, std::forward<CompletionToken>(token));
+  }
+
+
+#if defined(__linux__)
+  /// True if the remaining body can be moved kernel-side into a file
+  /// descriptor: a plain tcp socket underneath, known framing, no
+  /// decompression stage, and the connection's staging buffer drained.
+  bool splice_ready()
+  {
+    return impl_ != nullptr && parser_ != nullptr && !inflater_ && !read_tap_
+        && parser_->is_header_done() && !parser_->is_done()
+        && maybe_enter_direct_() && impl_->do_supports_splice_();
+  }
+
+  /// Splice some of the body into fd (splice(2) through a pipe), skipping the
+  /// userspace copy. Only valid after splice_ready() returned true.
+  std::size_t splice_some(int fd, system::error_code & ec);
+
+  /// Splice some of the body into fd (splice(2) through a pipe), skipping the
+  /// userspace copy. Only valid after splice_ready() returned true.
+  template<
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code, std::size_t)) CompletionToken
+          BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code, std::size_t))
+  async_splice_some(int fd,
+                    CompletionToken && token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
+#endif
+
+  /// Cap the connection's staging buffer while this stream is being read:
+  /// once `bytes` are buffered ahead of the consumer, no further socket
+  /// reads are issued until the staged data drains, so a slow consumer
+  /// backpressures the peer through TCP instead of ballooning memory.
+  /// Zero (the default) removes the cap. The cap lasts for this response.
+  void set_read_watermark(std::size_t bytes)
+  {
+    if (impl_ != nullptr)
+      impl_->do_set_read_watermark_(bytes);
+  }
+
+  /// Bound the remainder the destructor will read-and-discard to keep the
+  /// connection reusable when this stream is dropped with body bytes
+  /// unread; a larger (or unframed) remainder closes the connection and
+  /// the pool redials. Defaults to BOOST_REQUESTS_MAX_DRAIN_SIZE.
+  void set_max_drain_size(std::size_t bytes) {max_drain_size_ = bytes;}
+
+  /// Observe every body byte as it is handed out: the tap runs with each
+  /// chunk read_some(), read() and consume() deliver, after any
+  /// decompression - i.e. with exactly the bytes the consumer gets, in
+  /// order. Meant for pipeline stages that ride the read loop, like
+  /// checksumming a download while it is written out (see digest.hpp)
+  /// instead of re-reading the file afterwards. Installing a tap disables
+  /// the splice fast path, since spliced bytes never enter userspace.
+  /// The tap lasts for this response and moves with the stream.
+  void set_read_tap(std::function<void(const void *, std::size_t)> tap)
+  {
+    read_tap_ = std::move(tap);
+  }
+
+  /// Bytes already read off the socket but not yet consumed by this stream.
+  std::size_t buffered() const
+  {
+    return impl_ != nullptr ? impl_->do_buffered_input_() : 0u;
+  }
+
+  /// The announced body length still to be read, when the response
+  /// carries one; none for chunked bodies or before the header is in.
+  /// The copy loops size their chunks off it, see detail::chunk_sizer.
+  boost::optional<std::uint64_t> content_length_remaining() const
+  {
+    if (direct_)
+      return direct_remaining_;
+    if (parser_ && parser_->is_header_done())
+      return parser_->content_length_remaining();
+    return boost::none;
+  }
+
+  /// True if the remaining body can be parsed in place out of the
+  /// implementation's staging buffer: known framing (a plain body with a
+  /// content-length) and no decompression stage. The copying reads keep
+  /// working either way; peek_some & consume just become available.
+  bool peek_ready()
+  {
+    return impl_ != nullptr && parser_ != nullptr && !inflater_
+        && parser_->is_header_done() && !parser_->is_done()
+        && maybe_enter_direct_(true);
+  }
+
+  /// A view of body bytes already staged by the implementation, clamped to
+  /// the end of this response; consume() advances past what a parser took.
+  /// An empty view means nothing is staged and stage_some (or
+  /// async_stage_some) needs to pull more off the socket. Only valid after
+  /// peek_ready() returned true; staging or reading invalidates the view.
+  asio::const_buffer peek_some() const;
+
+  /// Drop the first n bytes of peek_some()'s view, completing the response
+  /// when the end of the body is reached.
+  void consume(std::size_t n)
+  {
+    boost::system::error_code ec;
+    consume(n, ec);
+    if (ec)
+      throw_exception(system::system_error(ec, "consume"));
+  }
+  void consume(std::size_t n, system::error_code & ec);
+
+  /// Stage more body bytes without copying them out, growing peek_some()'s
+  /// view. Only valid after peek_ready() returned true.
+  std::size_t stage_some(system::error_code & ec);
+
+  /// Stage more body bytes without copying them out, growing peek_some()'s
+  /// view. Only valid after peek_ready() returned true.
+  template<
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code, std::size_t)) CompletionToken
+          BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code, std::size_t))
+  async_stage_some(CompletionToken && token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(executor_type));
 
   /// dump the rest of the data.
   void dump()
@@ -177,7 +413,7 @@ struct basic_stream
   const history_type          &history() const & { return history_; }
 
 
-  bool done() const {return !parser_ ||  parser_->is_done();}
+  bool done() const {return !parser_ ||  parser_->is_done() || (direct_ && direct_remaining_ == 0u);}
   explicit basic_stream(executor_type executor, std::nullptr_t ) : executor_{executor}, impl_(nullptr) {}
   explicit basic_stream(executor_type executor,
                         detail::stream_base * impl,
@@ -202,8 +438,18 @@ struct basic_stream
   void prepend_history(history_type && pre_history)
   {
     history_.insert(history_.begin(),
-                    std::make_move_iterator(history_.begin()),
-                    std::make_move_iterator(history_.end()));
+                    std::make_move_iterator(pre_history.begin()),
+                    std::make_move_iterator(pre_history.end()));
+  }
+
+  /// Apply the request's history policy once the chain is done, see
+  /// request_options::history. Dropping is oldest-first.
+  void trim_history(history_mode mode, std::size_t max_entries)
+  {
+    if (mode == history_mode::none)
+      history_.clear();
+    else if (max_entries > 0u && history_.size() > max_entries)
+      history_.erase(history_.begin(), history_.end() - max_entries);
   }
  private:
   executor_type executor_;
@@ -215,13 +461,134 @@ struct basic_stream
   history_type history_;
   detail::tracker t_;
 
+  // Once the header is parsed, the body is plain (not chunked), its length is
+  // known and the connection's staging buffer is drained, remaining body bytes
+  // are read from the socket straight into the caller's buffers, skipping the
+  // parser and the staging copy. The stream does the framing itself then.
+  // peek_some enters with staged bytes still pending (they get handed out in
+  // place, or drained first by the direct reads).
+  bool direct_ = false;
+  std::uint64_t direct_remaining_ = 0u;
+
+  bool maybe_enter_direct_(bool allow_staged = false)
+  {
+    if (!direct_ && parser_ && parser_->is_header_done() && !parser_->is_done()
+        && !parser_->chunked() && parser_->content_length_remaining()
+        && (allow_staged || impl_->do_buffered_input_() == 0u))
+    {
+      direct_ = true;
+      direct_remaining_ = *parser_->content_length_remaining();
+    }
+    return direct_;
+  }
+
+  template<typename MutableBufferSequence>
+  std::size_t read_some_direct_(const MutableBufferSequence & buffers, system::error_code & ec);
+
+  // Transparent content-decoding, installed by ropen when the request
+  // options ask for it and the response carries a supported Content-Encoding.
+  // The raw paths below keep feeding the parser; read_some then inflates.
+  std::unique_ptr<detail::inflater, detail::pmr_deleter> inflater_;
+
+  void init_decompression_()
+  {
+    if (!parser_ || !parser_->is_header_done())
+      return;
+    const auto itr = parser_->get().base().find(http::field::content_encoding);
+    if (itr == parser_->get().base().end())
+      return;
+    const auto cd = detail::inflater::select_coding(itr->value());
+    if (cd == detail::inflater::coding::identity)
+      return;
+    inflater_ = detail::make_pmr<detail::inflater>(parser_.get_deleter().res, cd);
+  }
+
+  // done, including any decoding stage still holding staged input
+  bool body_done_() const { return inflater_ ? inflater_->done() : done(); }
+
+  // Abandoning a response mid-body (a cancelled read, a dropped stream):
+  // draining the rest keeps the connection reusable, but an unframed or
+  // large remainder would stall teardown, so those hard-close instead and
+  // the pool redials. See ~basic_stream.
+  bool drain_is_cheap_() const
+  {
+    if (direct_)
+      return direct_remaining_ <= max_drain_size_;
+    if (!parser_ || !parser_->is_header_done() || parser_->chunked())
+      return false;
+    const auto remaining = parser_->content_length_remaining();
+    return remaining && *remaining <= max_drain_size_;
+  }
+
+  std::size_t max_drain_size_ = BOOST_REQUESTS_MAX_DRAIN_SIZE;
+  // set when the destructor re-homed this stream to drain detached
+  bool detached_drain_ = false;
+
+  // see set_read_tap - called with every chunk handed to the consumer
+  std::function<void(const void *, std::size_t)> read_tap_;
+
+  // A pipelined stream has not read its response header yet: the first use
+  // takes the connection's read mutex and reads it in, so the streams of a
+  // connection must be consumed in write order. See request_options::pipeline.
+  detail::basic_mutex<executor_type> * pipeline_mtx_ = nullptr;
+  cookie_jar * jar_ = nullptr;
+  bool decompress_ = false;
+  // armed on the response body buffer by the sbo_buffer read overloads,
+  // see request_options::spill_threshold.
+  std::size_t spill_threshold_ = 0u;
+
+  // checks parser_, too, so a moved-from stream is inert.
+  bool headers_pending_() const { return pipeline_mtx_ != nullptr && parser_ != nullptr; }
+  void ensure_headers_(system::error_code & ec);
+  void on_headers_(system::error_code & ec);
+
+  struct async_ensure_headers_op;
+  struct async_read_some_pipeline_op;
+  struct async_dump_pipeline_op;
+  struct async_stage_some_op;
+
+  template<BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code)) CompletionToken>
+  BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code))
+  async_ensure_headers_(CompletionToken && token);
+
+  // opt-in timing breakdown owned by the caller, see request_options::timings.
+  timing * timings_ = nullptr;
+
+  // Holds one slot of the owning session's concurrency budget while this
+  // response is alive, see basic_session::set_concurrency_limit.
+  std::shared_ptr<void> budget_slot_;
+
+  void mark_body_complete_()
+  {
+    if (timings_)
+      timings_->body_complete = timing::clock_type::now();
+  }
+
+  template<typename MutableBufferSequence>
+  std::size_t read_some_raw_(const MutableBufferSequence & buffers, system::error_code & ec);
+
+  template<
+      typename MutableBufferSequence,
+      BOOST_ASIO_COMPLETION_TOKEN_FOR(void (system::error_code, std::size_t)) CompletionToken>
+  BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void (system::error_code, std::size_t))
+  async_read_some_raw_(const MutableBufferSequence & buffers, CompletionToken && token);
+
   template<typename DynamicBuffer>
   struct async_read_op;
   struct async_dump_op;
   struct async_read_some_op;
+  struct async_read_some_inflate_op;
+#if defined(__linux__)
+  struct async_splice_some_op;
+#endif
 
   template<typename>
   friend struct basic_connection;
+  // attaches its concurrency-budget slot, see above
+  template<typename>
+  friend struct basic_session;
+  // the response cache records wire streams and builds replay streams
+  friend struct http_cache;
 };
 
 using stream = basic_stream<>;
@@ -0,0 +1,253 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_TEST_LOOPBACK_HPP
+#define BOOST_REQUESTS_TEST_LOOPBACK_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/append.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/socket_base.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/system/system_error.hpp>
+#include <boost/throw_exception.hpp>
+#include <string>
+
+namespace boost
+{
+namespace requests
+{
+namespace test
+{
+
+struct loopback_protocol;
+struct loopback_endpoint
+{
+  loopback_protocol protocol() const;
+};
+struct loopback_protocol
+{
+  using endpoint = loopback_endpoint;
+};
+inline loopback_protocol loopback_endpoint::protocol() const {return loopback_protocol{};}
+
+/// A deterministic in-memory transport: basic_connection<test::loopback>
+/// runs whole requests without touching the kernel, so what gets measured
+/// is the library itself - locking, allocation, parsing - request by
+/// request. There are no locks and no blocking; every operation completes
+/// immediately (asynchronous ones via a single post), off plain in-memory
+/// byte queues, which makes numbers stable enough to regress. Use from
+/// one thread, like a socket.
+///
+/// The peer is scripted: push_response() queues the bytes the next reads
+/// will see, written() hands back every byte the library sent. A read
+/// past the scripted bytes completes with eof, so a mis-scripted fixture
+/// fails loudly instead of hanging.
+struct loopback
+{
+  using endpoint = loopback_endpoint;
+  using protocol_type = loopback_protocol;
+  using lowest_layer_type = loopback;
+  using executor_type = asio::any_io_executor;
+
+  explicit loopback(asio::any_io_executor exec) : exec_(std::move(exec)) {}
+
+  template<typename ExecutionContext>
+  explicit loopback(ExecutionContext & context,
+                    typename asio::constraint<
+                        asio::is_convertible<ExecutionContext &, asio::execution_context &>::value
+                    >::type = 0)
+      : exec_(context.get_executor()) {}
+
+  executor_type get_executor() const {return exec_;}
+        lowest_layer_type & lowest_layer()       {return *this;}
+  const lowest_layer_type & lowest_layer() const {return *this;}
+
+  /// Append to the bytes the peer sends back, usually one canned response.
+  void push_response(core::string_view bytes)
+  {
+    rx_.append(bytes.data(), bytes.size());
+  }
+
+  /// Every byte the library wrote, i.e. the serialized requests.
+  const std::string & written() const {return tx_;}
+
+  /// Forget all scripted and captured bytes, keeping the open state.
+  void reset()
+  {
+    rx_.clear();
+    rx_pos_ = 0u;
+    tx_.clear();
+  }
+
+  // socket-shaped surface, what basic_connection needs of a lowest layer
+  void open(protocol_type, system::error_code & ec)
+  {
+    ec = {};
+    open_ = true;
+  }
+
+  template<typename Option>
+  void set_option(const Option &, system::error_code & ec) {ec = {};}
+
+  using native_handle_type = int;
+  /// There is no kernel object behind this; poll()-based readiness waits
+  /// see an ignored fd and report not-readable, which is the right answer
+  /// for a peer that only speaks when scripted.
+  native_handle_type native_handle() const {return -1;}
+
+  template<typename CompletionToken>
+  auto async_wait(asio::socket_base::wait_type, CompletionToken && token)
+  {
+    // whatever is scripted is readable right away
+    return asio::async_initiate<CompletionToken, void(system::error_code)>(
+        [this](auto handler)
+        {
+          asio::post(exec_, asio::append(std::move(handler), system::error_code{}));
+        }, token);
+  }
+
+  void connect(endpoint, system::error_code & ec)
+  {
+    ec = {};
+    open_ = true;
+  }
+
+  void connect(endpoint ep)
+  {
+    system::error_code ec;
+    connect(ep, ec);
+  }
+
+  template<typename CompletionToken>
+  auto async_connect(endpoint ep, CompletionToken && token)
+  {
+    return asio::async_initiate<CompletionToken, void(system::error_code)>(
+        [this](auto handler, endpoint ep)
+        {
+          system::error_code ec;
+          connect(ep, ec);
+          asio::post(exec_, asio::append(std::move(handler), ec));
+        }, token, ep);
+  }
+
+  bool is_open() const {return open_;}
+
+  void close(system::error_code & ec)
+  {
+    ec = {};
+    open_ = false;
+  }
+
+  void close()
+  {
+    system::error_code ec;
+    close(ec);
+  }
+
+  void cancel() {}
+  void cancel(system::error_code & ec) {ec = {};}
+
+  // SyncStream
+  template<typename MutableBufferSequence>
+  std::size_t read_some(const MutableBufferSequence & buffers, system::error_code & ec)
+  {
+    ec = {};
+    if (!open_)
+    {
+      ec = asio::error::bad_descriptor;
+      return 0u;
+    }
+    if (rx_pos_ == rx_.size())
+    {
+      ec = asio::error::eof;
+      return 0u;
+    }
+    const auto n = asio::buffer_copy(
+        buffers, asio::buffer(rx_.data() + rx_pos_, rx_.size() - rx_pos_));
+    rx_pos_ += n;
+    return n;
+  }
+
+  template<typename MutableBufferSequence>
+  std::size_t read_some(const MutableBufferSequence & buffers)
+  {
+    system::error_code ec;
+    const auto n = read_some(buffers, ec);
+    if (ec)
+      throw_exception(system::system_error(ec, "read_some"));
+    return n;
+  }
+
+  template<typename ConstBufferSequence>
+  std::size_t write_some(const ConstBufferSequence & buffers, system::error_code & ec)
+  {
+    ec = {};
+    if (!open_)
+    {
+      ec = asio::error::bad_descriptor;
+      return 0u;
+    }
+    const auto n = asio::buffer_size(buffers);
+    const auto pos = tx_.size();
+    tx_.resize(pos + n);
+    asio::buffer_copy(asio::buffer(&tx_[pos], n), buffers);
+    return n;
+  }
+
+  template<typename ConstBufferSequence>
+  std::size_t write_some(const ConstBufferSequence & buffers)
+  {
+    system::error_code ec;
+    const auto n = write_some(buffers, ec);
+    if (ec)
+      throw_exception(system::system_error(ec, "write_some"));
+    return n;
+  }
+
+  // AsyncStream
+  template<typename MutableBufferSequence, typename CompletionToken>
+  auto async_read_some(const MutableBufferSequence & buffers, CompletionToken && token)
+  {
+    return asio::async_initiate<CompletionToken, void(system::error_code, std::size_t)>(
+        [this](auto handler, const MutableBufferSequence & buffers)
+        {
+          system::error_code ec;
+          const auto n = read_some(buffers, ec);
+          asio::post(exec_, asio::append(std::move(handler), ec, n));
+        }, token, buffers);
+  }
+
+  template<typename ConstBufferSequence, typename CompletionToken>
+  auto async_write_some(const ConstBufferSequence & buffers, CompletionToken && token)
+  {
+    return asio::async_initiate<CompletionToken, void(system::error_code, std::size_t)>(
+        [this](auto handler, const ConstBufferSequence & buffers)
+        {
+          system::error_code ec;
+          const auto n = write_some(buffers, ec);
+          asio::post(exec_, asio::append(std::move(handler), ec, n));
+        }, token, buffers);
+  }
+
+ private:
+  asio::any_io_executor exec_;
+  bool open_{false};
+  std::string rx_;
+  std::size_t rx_pos_{0u};
+  std::string tx_;
+};
+
+}
+}
+}
+
+#endif // BOOST_REQUESTS_TEST_LOOPBACK_HPP
@@ -0,0 +1,54 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_REQUESTS_TIMING_HPP
+#define BOOST_REQUESTS_TIMING_HPP
+
+#include <chrono>
+
+namespace boost {
+namespace requests {
+
+/// An opt-in per-request timing breakdown.
+/**
+ * Point request_options::timings at one of these and the library stamps it
+ * while the request runs. Phases that did not happen (e.g. connect on a
+ * reused connection) keep their default value, so `phase.time_since_epoch()
+ * == duration::zero()` means "did not occur". On redirects every phase holds
+ * the stamp of the last hop. The object is written from the executor the
+ * request runs on and must outlive the request, including the returned
+ * stream.
+ */
+struct timing
+{
+  using clock_type = std::chrono::steady_clock;
+  using time_point = clock_type::time_point;
+  using duration   = clock_type::duration;
+
+  /// The request entered the library.
+  time_point started{};
+  /// Acquiring the pool for the host, including the DNS lookup on a miss.
+  /// Near-instant when the session already holds a pool for the host.
+  time_point resolve_start{}, resolve_done{};
+  /// Waiting for basic_connection_pool::async_get_connection, i.e. on the
+  /// connection limit.
+  time_point pool_queued{}, connection_acquired{};
+  /// Waiting for the connection's write mutex, i.e. on requests queued
+  /// before this one.
+  time_point write_queued{}, write_lock_acquired{};
+  /// TCP connect and TLS handshake; handshake_done stays unset on plain
+  /// connections, all three on a reused one.
+  time_point connect_start{}, connect_done{}, handshake_done{};
+  /// Waiting for the connection's read mutex after the request was written.
+  time_point read_queued{}, read_lock_acquired{};
+  /// The response header was received in full.
+  time_point headers_received{};
+  /// The last body byte was read off the socket.
+  time_point body_complete{};
+};
+
+}
+}
+
+#endif // BOOST_REQUESTS_TIMING_HPP
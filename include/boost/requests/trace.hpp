@@ -0,0 +1,87 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_REQUESTS_TRACE_HPP
+#define BOOST_REQUESTS_TRACE_HPP
+
+#include <boost/requests/detail/config.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/system/error_code.hpp>
+
+namespace boost
+{
+namespace requests
+{
+
+/// The internal stages a request passes through, in the order they
+/// usually happen. One enter/exit pair per stage makes a span.
+enum class trace_point
+{
+  /// name resolution, see basic_connection_pool::async_lookup
+  resolve,
+  /// waiting for / selecting a connection inside the pool
+  pool_acquire,
+  /// the TCP (or socks/tunnel) dial
+  connect,
+  /// the TLS handshake, where there is one
+  handshake,
+  /// one request on the wire: write until the response header is in
+  request
+};
+
+/// Receiver for trace spans along the asynchronous request path.
+///
+/// Tracing is compiled out unless BOOST_REQUESTS_ENABLE_TRACE is
+/// defined: without it every trace point is a no-op statement, with it
+/// each point costs one null check and one virtual call. That keeps the
+/// hot path clean when off, which is why this is a compile-time switch
+/// and not another runtime flag.
+///
+/// A hook is installed with set_trace_hook on a session, pool or
+/// connection and propagates downward the way the metrics block does;
+/// the installer keeps it alive and implementations must be safe to
+/// call from whatever threads run the objects' executors. The synchronous
+/// call paths do not trace - they have a thread to themselves and can be
+/// timed from the call site.
+struct trace_hook
+{
+  /// A stage begins; detail is stage-dependent context (the authority
+  /// for resolve, the host for connect) and only valid for the call.
+  virtual void on_enter(trace_point pt, core::string_view detail) noexcept = 0;
+  /// The matching stage ends, with its outcome.
+  virtual void on_exit (trace_point pt, system::error_code ec) noexcept = 0;
+
+ protected:
+  ~trace_hook() = default;
+};
+
+}
+}
+
+#if defined(BOOST_REQUESTS_ENABLE_TRACE)
+
+#define BOOST_REQUESTS_TRACE_ENTER(Hook, Point, Detail)                        \
+  do {                                                                         \
+    if ((Hook) != nullptr)                                                     \
+      (Hook)->on_enter(::boost::requests::trace_point::Point,                  \
+                       ::boost::core::string_view(Detail));                    \
+  } while (false)
+
+#define BOOST_REQUESTS_TRACE_EXIT(Hook, Point, Ec)                             \
+  do {                                                                         \
+    if ((Hook) != nullptr)                                                     \
+      (Hook)->on_exit(::boost::requests::trace_point::Point, (Ec));            \
+  } while (false)
+
+#else
+
+#define BOOST_REQUESTS_TRACE_ENTER(Hook, Point, Detail) static_cast<void>(0)
+#define BOOST_REQUESTS_TRACE_EXIT(Hook, Point, Ec)      static_cast<void>(0)
+
+#endif
+
+#endif // BOOST_REQUESTS_TRACE_HPP
@@ -0,0 +1,11 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// The single translation unit of the compiled library: all .ipp definitions
+// plus the explicit instantiations for the default executor, see src.hpp.
+
+#include <boost/requests/src.hpp>
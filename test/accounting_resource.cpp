@@ -0,0 +1,78 @@
+// Copyright (c) 2021 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/accounting_resource.hpp>
+#include <boost/requests/response.hpp>
+
+#include <boost/container/pmr/vector.hpp>
+
+#include "doctest.h"
+#include "string_maker.hpp"
+
+using namespace boost;
+
+TEST_SUITE_BEGIN("accounting_resource");
+
+TEST_CASE("counts through to the upstream")
+{
+  requests::accounting_resource mem;
+
+  void * p = mem.allocate(64u, 8u);
+  void * q = mem.allocate(192u, 8u);
+
+  auto rep = mem.report();
+  CHECK(rep.allocations     == 2u);
+  CHECK(rep.deallocations   == 0u);
+  CHECK(rep.bytes_allocated == 256u);
+  CHECK(rep.bytes_in_use    == 256u);
+  CHECK(rep.high_water      == 256u);
+
+  mem.deallocate(q, 192u, 8u);
+  rep = mem.report();
+  CHECK(rep.deallocations == 1u);
+  CHECK(rep.bytes_in_use  == 64u);
+  CHECK(rep.high_water    == 256u); // the peak stays
+
+  mem.deallocate(p, 64u, 8u);
+  CHECK(mem.report().bytes_in_use == 0u);
+}
+
+TEST_CASE("container growth shows up")
+{
+  requests::accounting_resource mem;
+  {
+    container::pmr::vector<char> v{container::pmr::polymorphic_allocator<char>(&mem)};
+    v.resize(1024u);
+
+    const auto rep = mem.report();
+    CHECK(rep.allocations >= 1u);
+    CHECK(rep.high_water  >= 1024u);
+  }
+  const auto rep = mem.report();
+  CHECK(rep.allocations == rep.deallocations);
+  CHECK(rep.bytes_in_use == 0u);
+}
+
+TEST_CASE("response::memory_report")
+{
+  requests::accounting_resource mem;
+  {
+    requests::response res{container::pmr::polymorphic_allocator<char>(&mem)};
+    res.headers.set(requests::http::field::content_type, "text/plain");
+    res.buffer.commit(asio::buffer_copy(res.buffer.prepare(5u), asio::buffer("hello", 5u)));
+
+    const auto rep = res.memory_report();
+    CHECK(rep.allocations  > 0u);
+    CHECK(rep.bytes_in_use > 0u);
+    CHECK(rep.high_water   >= rep.bytes_in_use);
+  }
+  CHECK(mem.report().bytes_in_use == 0u);
+
+  // without an accounting resource underneath there is nothing to report
+  requests::response plain{};
+  CHECK(plain.memory_report().allocations == 0u);
+}
+
+TEST_SUITE_END();
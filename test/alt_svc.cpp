@@ -0,0 +1,65 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "boost/requests/fields/alt_svc.hpp"
+#include <boost/requests/session.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include "doctest.h"
+#include "string_maker.hpp"
+
+TEST_SUITE_BEGIN("alt-svc");
+
+TEST_CASE("parse")
+{
+  namespace br = boost::requests;
+
+  const auto epoch = std::chrono::system_clock::time_point::min();
+
+  auto res = br::parse_alt_svc_field(
+      "h3=\":443\"; ma=3600, http/1.1=\"alt.example:8001\"", epoch).value();
+  REQUIRE(res.size() == 2u);
+  CHECK(res[0].protocol == "h3");
+  CHECK(res[0].authority == ":443");
+  CHECK(res[0].expiry == epoch + std::chrono::seconds(3600));
+  CHECK(res[1].protocol == "http/1.1");
+  CHECK(res[1].authority == "alt.example:8001");
+  // no ma means the 24 hours of RFC 7838
+  CHECK(res[1].expiry == epoch + std::chrono::hours(24));
+
+  // unknown parameters get skipped, quoted or not
+  res = br::parse_alt_svc_field("h2=\"alt.example:443\"; persist=1", epoch).value();
+  REQUIRE(res.size() == 1u);
+  CHECK(res[0].authority == "alt.example:443");
+
+  CHECK(br::parse_alt_svc_field("clear", epoch).value().empty());
+  CHECK(br::parse_alt_svc_field("h2=unquoted", epoch).has_error());
+}
+
+TEST_CASE("session cache")
+{
+  namespace br = boost::requests;
+  boost::asio::io_context ctx;
+  br::session sess{ctx};
+
+  CHECK(sess.alt_svc_for("example.com") == "");
+
+  sess.set_alt_svc("example.com", "alt.example:8001");
+  CHECK(sess.alt_svc_for("example.com") == "alt.example:8001");
+  CHECK(sess.alt_svc_for("other.example") == "");
+
+  // a lapsed advertisement is as good as none
+  sess.set_alt_svc("example.com", "alt.example:8001",
+                   std::chrono::system_clock::now() - std::chrono::seconds(1));
+  CHECK(sess.alt_svc_for("example.com") == "");
+
+  sess.set_alt_svc("example.com", "alt.example:8001");
+  sess.set_alt_svc("example.com", ""); // forget again
+  CHECK(sess.alt_svc_for("example.com") == "");
+}
+
+TEST_SUITE_END();
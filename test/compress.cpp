@@ -0,0 +1,138 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/compress.hpp>
+
+#include <boost/requests/connection.hpp>
+#include <boost/requests/detail/inflate.hpp>
+#include <boost/requests/test/loopback.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/beast/http/fields.hpp>
+#include <boost/beast/http/parser.hpp>
+#include <boost/beast/http/string_body.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "doctest.h"
+#include "string_maker.hpp"
+
+using namespace boost;
+
+TEST_SUITE_BEGIN("compress");
+
+namespace
+{
+
+std::string serialize(const std::string & value)
+{
+  using body = requests::gzip_body<beast::http::string_body>;
+  beast::http::header<true, beast::http::fields> hd;
+  auto copy = value;
+  body::writer wr{hd, copy};
+
+  system::error_code ec;
+  wr.init(ec);
+  REQUIRE(!ec);
+
+  std::string res;
+  for (;;)
+  {
+    auto buf = wr.get(ec);
+    REQUIRE(!ec);
+    if (!buf)
+      break;
+    res.append(static_cast<const char*>(buf->first.data()), buf->first.size());
+    if (!buf->second)
+      break;
+  }
+  return res;
+}
+
+std::string inflate_gzip(core::string_view data)
+{
+  requests::detail::inflater inf{requests::detail::inflater::coding::gzip};
+  std::string res;
+  std::size_t pos = 0u;
+  char buf[4096];
+  while (!inf.done())
+  {
+    if (inf.needs_input())
+    {
+      auto in = inf.input_buffer();
+      const auto n = (std::min)(in.size(), data.size() - pos);
+      REQUIRE(n > 0u);
+      std::memcpy(in.data(), data.data() + pos, n);
+      pos += n;
+      inf.commit(n);
+    }
+    system::error_code ec;
+    const auto n = inf.write_output(asio::buffer(buf), ec);
+    REQUIRE(!ec);
+    res.append(buf, n);
+  }
+  return res;
+}
+
+}
+
+TEST_CASE("gzip round trip")
+{
+  // repetitive payload, the kind upload compression is for
+  std::string value;
+  for (int i = 0; i < 4000; i++)
+    value += "{\"level\":\"info\",\"msg\":\"hello world\"}\n";
+
+  const auto wire = serialize(value);
+  CHECK(wire.size() < value.size() / 4u);
+  CHECK(inflate_gzip(wire) == value);
+
+  CHECK(inflate_gzip(serialize("")) == "");
+  CHECK(inflate_gzip(serialize("x")) == "x");
+}
+
+TEST_CASE("a gzipped body goes out marked and chunked")
+{
+  asio::io_context ctx;
+  requests::basic_connection<requests::test::loopback> hc{ctx.get_executor()};
+  hc.set_host("example.com");
+  hc.next_layer().push_response(
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Length: 0\r\n"
+      "Connection: keep-alive\r\n"
+      "\r\n");
+  hc.connect(requests::test::loopback::endpoint{});
+
+  std::string value;
+  for (int i = 0; i < 1000; i++)
+    value += "All work and no play makes Jack a dull boy. ";
+
+  auto str = hc.ropen(beast::http::verb::post, urls::url_view("/upload"),
+                      requests::gzipped(value), {requests::headers({}), {false}});
+  CHECK(str.headers().result() == beast::http::status::ok);
+
+  // re-parse what went over the wire: marked, chunked, and it decodes back
+  beast::http::request_parser<beast::http::string_body> rp;
+  rp.eager(true);
+  system::error_code ec;
+  const auto & wire = hc.next_layer().written();
+  std::size_t consumed = 0u;
+  while (consumed < wire.size() && !rp.is_done())
+  {
+    consumed += rp.put(asio::buffer(wire.data() + consumed, wire.size() - consumed), ec);
+    REQUIRE(!ec);
+  }
+  REQUIRE(rp.is_done());
+
+  auto req = rp.release();
+  CHECK(req[beast::http::field::content_encoding] == "gzip");
+  CHECK(req[beast::http::field::content_type] == "text/plain; charset=utf-8");
+  CHECK(req.chunked());
+  CHECK(req.body().size() < value.size() / 4u);
+  CHECK(inflate_gzip(req.body()) == value);
+}
+
+TEST_SUITE_END();
@@ -20,6 +20,8 @@
 #include "string_maker.hpp"
 #include "extern.hpp"
 
+#include <thread>
+
 using namespace boost;
 
 inline std::string httpbin()
@@ -58,6 +60,26 @@ TEST_CASE("ssl-detect")
   CHECK(requests::detail::get_ssl_layer(sconn) == &sconn.next_layer());
 }
 
+#if defined(__linux__)
+TEST_CASE("stale-detect")
+{
+  asio::io_context ctx;
+  asio::ip::tcp::acceptor acc{ctx, asio::ip::tcp::endpoint(asio::ip::make_address("127.0.0.1"), 0)};
+
+  requests::http_connection hc{ctx.get_executor()};
+  hc.connect(acc.local_endpoint());
+  auto server = acc.accept();
+
+  CHECK(!hc.appears_stale());
+
+  server.close();
+  // give the FIN a moment to cross the loopback
+  for (int i = 0; i < 100 && !hc.appears_stale(); i++)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  CHECK(hc.appears_stale());
+}
+#endif
+
 template<typename Stream, typename Exec>
 auto make_conn_impl(Exec && exec, asio::ssl::context & sslctx, std::false_type)
 {
@@ -46,6 +46,92 @@ TEST_CASE("cookie-jar")
 
 }
 
+TEST_CASE("append-to")
+{
+    namespace http = boost::requests::http;
+    rcp::cookie_jar j;
+    j.set(rcp::parse_set_cookie_field("userid=sup3r4n0m-us3r-1d3nt1f13r").value(), "boost.org");
+    j.set(rcp::parse_set_cookie_field("lib=requests").value(), "boost.org");
+
+    http::fields f;
+    CHECK(j.append_to(f, "boost.org"));
+    CHECK(f[boost::beast::http::field::cookie] == "lib=requests; userid=sup3r4n0m-us3r-1d3nt1f13r");
+
+    http::fields f2;
+    CHECK(!j.append_to(f2, "example.com"));
+    CHECK(f2.count(boost::beast::http::field::cookie) == 0u);
+}
+
+TEST_CASE("set-all")
+{
+    namespace http = boost::requests::http;
+    http::fields f;
+    f.insert(boost::beast::http::field::set_cookie, "userid=sup3r4n0m-us3r-1d3nt1f13r");
+    f.insert(boost::beast::http::field::set_cookie, "lib=requests; Max-Age=10");
+    f.insert(boost::beast::http::field::set_cookie, "doc=foobar; Max-Age=0");
+
+    rcp::cookie_jar j;
+    boost::system::error_code ec;
+    // the max-age=0 cookie parses but is not stored
+    CHECK(j.set_all(f, "Boost.org", ec) == 2u);
+    CHECK(!ec);
+    CHECK(j.get("boost.org") == "lib=requests; userid=sup3r4n0m-us3r-1d3nt1f13r");
+
+    f.insert(boost::beast::http::field::set_cookie, ";;;");
+    rcp::cookie_jar j2;
+    CHECK(j2.set_all(f, "boost.org", ec) == 0u);
+    CHECK(ec);
+    // the malformed field rejects the whole batch
+    CHECK(j2.content.empty());
+}
+
+TEST_CASE("purge-expired")
+{
+    rcp::cookie_jar j;
+    j.set(rcp::parse_set_cookie_field("session=temporary").value(), "boost.org");
+    j.set(rcp::parse_set_cookie_field("short=lived; Max-Age=1").value(), "boost.org");
+    j.set(rcp::parse_set_cookie_field("long=lived; Max-Age=3600").value(), "boost.org");
+    CHECK(j.content.size() == 3u);
+
+    // nothing is expired yet
+    j.purge_expired();
+    CHECK(j.content.size() == 3u);
+
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    j.purge_expired();
+    // only the short-lived cookie goes; the session cookie never expires
+    CHECK(j.content.size() == 2u);
+    CHECK(j.get("boost.org") == "long=lived; session=temporary");
+
+    // overwriting drops the old heap entry along with the cookie
+    j.set(rcp::parse_set_cookie_field("long=gone; Max-Age=0").value(), "boost.org");
+    j.purge_expired();
+    CHECK(j.content.size() == 1u);
+    CHECK(j.get("boost.org") == "session=temporary");
+}
+
+TEST_CASE("snapshot")
+{
+    rcp::cookie_jar j;
+    j.set(rcp::parse_set_cookie_field("userid=sup3r4n0m-us3r-1d3nt1f13r; Expires=Wed, 09 Jun 2038 10:18:14 GMT").value(), "boost.org");
+    j.set(rcp::parse_set_cookie_field("session=temporary").value(), "boost.org");
+
+    const auto data = j.save();
+
+    rcp::cookie_jar restored;
+    CHECK(restored.load(data));
+    // the session cookie must not survive the round trip
+    CHECK(restored.content.size() == 1u);
+    CHECK(restored.get("boost.org") == "userid=sup3r4n0m-us3r-1d3nt1f13r");
+
+    CHECK(!restored.load("not a snapshot"));
+
+    // a snapshot truncated mid-record is rejected before anything is ingested
+    rcp::cookie_jar partial;
+    CHECK(!partial.load(data.substr(0u, data.size() - 1u)));
+    CHECK(partial.content.empty());
+}
+
 
 
 
@@ -0,0 +1,82 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/detail/arena.hpp>
+
+#include "../doctest.h"
+
+using namespace boost;
+
+TEST_SUITE_BEGIN("arena");
+
+TEST_CASE("monotonic")
+{
+  requests::detail::arena_pool pool;
+  auto * res = pool.acquire();
+  requests::detail::arena_anchor anchor{res};
+
+  auto * p1 = static_cast<char*>(res->allocate(16u, 1u));
+  auto * p2 = static_cast<char*>(res->allocate(16u, 1u));
+  CHECK(p2 == p1 + 16); // bump allocation
+  res->deallocate(p1, 16u, 1u);
+
+  // a freed spot is not reused, the arena only moves forward
+  auto * p3 = static_cast<char*>(res->allocate(16u, 1u));
+  CHECK(p3 == p2 + 16);
+  res->deallocate(p2, 16u, 1u);
+  res->deallocate(p3, 16u, 1u);
+
+  // alignment is honoured
+  auto * p4 = res->allocate(1u, 1u);
+  auto * p5 = res->allocate(64u, 64u);
+  CHECK(reinterpret_cast<std::uintptr_t>(p5) % 64u == 0u);
+  res->deallocate(p4, 1u, 1u);
+  res->deallocate(p5, 64u, 64u);
+}
+
+TEST_CASE("recycle")
+{
+  requests::detail::arena_pool pool;
+
+  void * first = nullptr;
+  {
+    auto * res = pool.acquire();
+    requests::detail::arena_anchor anchor{res};
+    first = res->allocate(64u, 1u);
+    res->deallocate(first, 64u, 1u);
+    // the anchor pins the arena although no other allocation is live here
+    auto * p = res->allocate(64u, 1u);
+    CHECK(p != nullptr);
+    res->deallocate(p, 64u, 1u);
+  } // anchor released -> arena returns to the pool
+
+  // the next arena reuses the recycled block
+  auto * res = pool.acquire();
+  requests::detail::arena_anchor anchor{res};
+  CHECK(res->allocate(64u, 1u) == first);
+}
+
+TEST_CASE("spill-and-oversized")
+{
+  requests::detail::arena_pool pool;
+  auto * res = pool.acquire();
+  requests::detail::arena_anchor anchor{res};
+
+  // enough small allocations to spill over several blocks
+  for (std::size_t i = 0u; i < 64u; i++)
+  {
+    auto * p = res->allocate(1024u, 8u);
+    CHECK(p != nullptr);
+    res->deallocate(p, 1024u, 8u);
+  }
+
+  // oversized allocations fall back to the heap but die with the arena
+  auto * big = res->allocate(BOOST_REQUESTS_ARENA_BLOCK_SIZE, 64u);
+  CHECK(big != nullptr);
+  CHECK(reinterpret_cast<std::uintptr_t>(big) % 64u == 0u);
+  res->deallocate(big, BOOST_REQUESTS_ARENA_BLOCK_SIZE, 64u);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/requests/detail/buffer_pool.hpp>
+
+#include "../doctest.h"
+
+using boost::requests::detail::buffer_pool;
+
+TEST_SUITE_BEGIN("buffer_pool");
+
+TEST_CASE("checkout & checkin")
+{
+  buffer_pool pool;
+
+  auto b = pool.checkout();
+  CHECK(b.capacity() == 0u);
+
+  b.prepare(10000u);
+  b.commit(10000u);
+  const auto cap = b.capacity();
+  CHECK(cap >= 10000u);
+
+  pool.checkin(std::move(b));
+
+  auto r = pool.checkout();
+  CHECK(r.capacity() == cap);
+  CHECK(r.size() == 0u);
+}
+
+TEST_CASE("the biggest buffer comes back first")
+{
+  buffer_pool pool;
+
+  boost::beast::flat_buffer small, big;
+  small.prepare(100u);   small.commit(100u);
+  big.prepare(100000u);  big.commit(100000u);
+  const auto big_cap = big.capacity();
+
+  pool.checkin(std::move(small));
+  pool.checkin(std::move(big));
+
+  CHECK(pool.checkout().capacity() == big_cap);
+}
+
+TEST_CASE("oversized buffers are dropped")
+{
+  buffer_pool pool;
+
+  boost::beast::flat_buffer huge;
+  huge.prepare(2u * 1024u * 1024u);
+  huge.commit(2u * 1024u * 1024u);
+  pool.checkin(std::move(huge));
+
+  CHECK(pool.checkout().capacity() == 0u);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,63 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/requests/grammar/detail/charset_scan.hpp>
+#include <boost/requests/grammar/cookie_octet.hpp>
+#include <boost/url/grammar/alnum_chars.hpp>
+#include <boost/core/detail/string_view.hpp>
+
+#include <string>
+#include <type_traits>
+
+#include "../doctest.h"
+
+using namespace boost;
+
+namespace {
+
+// reference implementation to compare the (possibly vectorized) scan against
+template<typename CharSet>
+const char * naive_find_if_not(const char * first, const char * last, const CharSet & cs)
+{
+  while (first != last && cs(*first))
+    first++;
+  return first;
+}
+
+template<typename CharSet>
+void check_scan(core::string_view input)
+{
+  const CharSet cs{};
+  const char * first = input.begin(), * last = input.end();
+  CHECK(requests::grammar::detail::find_if_not(first, last, cs)
+        == naive_find_if_not(first, last, cs));
+}
+
+}
+
+TEST_SUITE_BEGIN("charset_scan");
+
+TEST_CASE("matches the scalar scan")
+{
+  // long enough runs to hit the vector path, mismatches at every offset
+  const std::string member(64u, 'a');
+  for (std::size_t i = 0u; i <= member.size(); i++)
+  {
+    std::string s = member;
+    s.insert(i, 1u, ';');
+    check_scan<requests::grammar::cookie_octets_t>(s);
+    check_scan<std::decay_t<decltype(urls::grammar::alnum_chars)>>(s);
+  }
+
+  check_scan<requests::grammar::cookie_octets_t>("");
+  check_scan<requests::grammar::cookie_octets_t>("short");
+  // bytes outside ascii must never match
+  check_scan<requests::grammar::cookie_octets_t>(std::string(40u, '\x80'));
+  check_scan<requests::grammar::cookie_octets_t>(std::string(40u, '\xff'));
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,47 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/requests/detail/chunk_sizer.hpp>
+
+#include "../doctest.h"
+
+using boost::requests::detail::chunk_sizer;
+
+TEST_SUITE_BEGIN("chunk_sizer");
+
+TEST_CASE("ramp")
+{
+  chunk_sizer cs;
+  CHECK(cs.size() == chunk_sizer::min_size);
+
+  // full reads double the chunk, a short read stops the growth
+  cs.update(cs.size());
+  CHECK(cs.size() == chunk_sizer::min_size * 2u);
+  cs.update(cs.size() / 2u);
+  CHECK(cs.size() == chunk_sizer::min_size * 2u);
+
+  // the cap holds no matter how many full reads come back
+  for (int i = 0; i < 64; i++)
+    cs.update(cs.size());
+  CHECK(cs.size() == chunk_sizer::max_size);
+  cs.update(cs.size());
+  CHECK(cs.size() == chunk_sizer::max_size);
+}
+
+TEST_CASE("content-length seed")
+{
+  // a small announced body doesn't over-allocate below the floor
+  CHECK(chunk_sizer{std::uint64_t(200u)}.size() == chunk_sizer::min_size);
+  // a mid-size one is taken as is
+  CHECK(chunk_sizer{std::uint64_t(65536u)}.size() == 65536u);
+  // a huge one starts at the cap instead of ramping
+  CHECK(chunk_sizer{std::uint64_t(1) << 33}.size() == chunk_sizer::max_size);
+  // unknown length (chunked) starts small
+  CHECK(chunk_sizer{boost::none}.size() == chunk_sizer::min_size);
+}
+
+TEST_SUITE_END();
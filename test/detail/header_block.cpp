@@ -0,0 +1,63 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/requests/detail/header_block.hpp>
+
+#include <boost/asio/buffer.hpp>
+
+#include "../doctest.h"
+
+using boost::requests::detail::header_block;
+using boost::requests::detail::header_block_parser;
+
+TEST_SUITE_BEGIN("header_block");
+
+TEST_CASE("parse and lookup")
+{
+  const boost::core::string_view raw =
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Type: text/plain\r\n"
+      "Set-Cookie: a=1\r\n"
+      "Set-Cookie: b=2\r\n"
+      "Content-Length: 5\r\n"
+      "\r\n"
+      "hello";
+
+  header_block hb;
+  header_block_parser p{hb};
+  boost::system::error_code ec;
+  const auto n = p.put(boost::asio::buffer(raw.data(), raw.size()), ec);
+  CHECK(!ec);
+  CHECK(n == raw.size()); // the body bytes are consumed and discarded
+  CHECK(p.is_done());
+
+  CHECK(hb.result() == boost::beast::http::status::ok);
+  CHECK(hb.result_int() == 200);
+  CHECK(hb.version() == 11);
+  CHECK(hb.reason() == "OK");
+
+  CHECK(hb.size() == 4u);
+  CHECK(hb.at(1).value == "a=1"); // wire order
+  CHECK(hb.at(2).value == "b=2");
+
+  // lookups are case-insensitive, missing fields come back empty
+  CHECK(hb["content-type"] == "text/plain");
+  CHECK(hb["CONTENT-LENGTH"] == "5");
+  CHECK(hb[boost::beast::http::field::content_type] == "text/plain");
+  CHECK(hb["x-missing"] == "");
+  CHECK(hb.count("set-cookie") == 2u);
+  CHECK(hb.count("x-missing") == 0u);
+
+  // the owning conversion for a caller that keeps the header
+  const auto h = hb.to_fields();
+  CHECK(h.result_int() == 200);
+  CHECK(h[boost::beast::http::field::content_type] == "text/plain");
+  CHECK(std::distance(h.equal_range(boost::beast::http::field::set_cookie).first,
+                      h.equal_range(boost::beast::http::field::set_cookie).second) == 2);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,50 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/requests/detail/intern.hpp>
+
+#include <string>
+
+#include "../doctest.h"
+
+using boost::requests::detail::intern_table;
+
+TEST_SUITE_BEGIN("intern");
+
+TEST_CASE("common values")
+{
+  intern_table tbl;
+  const std::string v = "application/json";
+  const auto a = tbl.intern(v);
+  const auto b = tbl.intern(std::string("application/json"));
+  CHECK(a == "application/json");
+  CHECK(a.data() == b.data());
+  CHECK(intern_table::interned(v, a));
+}
+
+TEST_CASE("dynamic values deduplicate")
+{
+  intern_table tbl;
+  const std::string v = "x-custom-value-1";
+  const auto a = tbl.intern(v);
+  CHECK(a == v);
+  CHECK(a.data() != v.data());
+  const std::string w = "x-custom-value-1";
+  const auto b = tbl.intern(w);
+  CHECK(b.data() == a.data());
+}
+
+TEST_CASE("oversized values pass through")
+{
+  intern_table tbl;
+  const std::string big(intern_table::max_length + 1u, 'x');
+  const auto r = tbl.intern(big);
+  CHECK(r.data() == big.data());
+  CHECK(!intern_table::interned(big, r));
+}
+
+TEST_SUITE_END();
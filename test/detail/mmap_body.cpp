@@ -0,0 +1,90 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/requests/detail/mmap_body.hpp>
+
+#include <boost/beast/http/message.hpp>
+#include <boost/beast/http/fields.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "../doctest.h"
+
+TEST_SUITE_BEGIN("mmap_body");
+
+namespace
+{
+
+std::string drain(boost::requests::detail::mmap_body::value_type & body)
+{
+  boost::beast::http::header<true, boost::beast::http::fields> h;
+  boost::requests::detail::mmap_body::writer w{h, body};
+
+  boost::system::error_code ec;
+  w.init(ec);
+  REQUIRE(!ec);
+
+  std::string res;
+  while (auto buf = w.get(ec))
+  {
+    REQUIRE(!ec);
+    res.append(static_cast<const char*>(buf->first.data()), buf->first.size());
+    if (!buf->second)
+      break;
+  }
+  REQUIRE(!ec);
+  return res;
+}
+
+}
+
+TEST_CASE("small file stays buffered")
+{
+  const std::string path = "./mmap_body_small.txt";
+  {
+    std::ofstream of{path, std::ios::binary};
+    of << "hello mmap";
+  }
+
+  boost::requests::detail::mmap_body::value_type body;
+  boost::system::error_code ec;
+  body.open(path.c_str(), ec);
+  REQUIRE(!ec);
+  CHECK(!body.is_mapped());
+  CHECK(body.size() == 10u);
+  CHECK(drain(body) == "hello mmap");
+
+  std::remove(path.c_str());
+}
+
+TEST_CASE("large file gets mapped")
+{
+  const std::string path = "./mmap_body_large.bin";
+  std::string content;
+  for (auto i = 0u; content.size() < BOOST_REQUESTS_MMAP_THRESHOLD + 512u; i++)
+    content += std::to_string(i) + ";";
+  {
+    std::ofstream of{path, std::ios::binary};
+    of << content;
+  }
+
+  boost::requests::detail::mmap_body::value_type body;
+  boost::system::error_code ec;
+  body.open(path.c_str(), ec);
+  REQUIRE(!ec);
+#if !defined(_WIN32)
+  CHECK(body.is_mapped());
+#endif
+  CHECK(body.size() == content.size());
+  CHECK(drain(body) == content);
+
+  std::remove(path.c_str());
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,46 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/requests/detail/null_mutex.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include "../doctest.h"
+
+using namespace boost;
+
+TEST_SUITE_BEGIN("null_mutex");
+
+TEST_CASE("sync lock")
+{
+  asio::io_context ctx;
+  requests::detail::basic_null_mutex<asio::io_context::executor_type> mtx{ctx.get_executor()};
+
+  system::error_code ec;
+  auto lock = asem::lock(mtx, ec);
+  CHECK(!ec);
+  CHECK(mtx.try_lock()); // never actually held
+}
+
+TEST_CASE("async lock completes through the executor")
+{
+  asio::io_context ctx;
+  requests::detail::basic_null_mutex<asio::io_context::executor_type> mtx{ctx.get_executor()};
+
+  bool done = false;
+  asem::async_lock(mtx,
+      [&](system::error_code ec,
+          asem::lock_guard<requests::detail::basic_null_mutex<asio::io_context::executor_type>>)
+      {
+        CHECK(!ec);
+        done = true;
+      });
+  CHECK(!done); // posted, not inline
+  ctx.run();
+  CHECK(done);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,50 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/requests/detail/parser_pool.hpp>
+
+#include "../doctest.h"
+
+TEST_SUITE_BEGIN("parser_pool");
+
+TEST_CASE("roundtrip")
+{
+  boost::requests::detail::parser_pool pool;
+
+  boost::system::error_code ec;
+  {
+    auto lease = pool.acquire({});
+    auto & p = lease.parser();
+    const char doc[] = R"({"foo": [1, 2, 3]})";
+    p.write(doc, sizeof(doc) - 1, ec);
+    CHECK(!ec);
+    p.finish(ec);
+    CHECK(!ec);
+    CHECK(p.release().at("foo").as_array().size() == 3u);
+  }
+
+  // the slot went back to the pool; a fresh lease must arrive reset.
+  auto lease = pool.acquire({});
+  CHECK(!lease.parser().done());
+}
+
+TEST_CASE("release is independent of the lease")
+{
+  boost::json::value v;
+  {
+    auto lease = boost::requests::detail::default_parser_pool().acquire({});
+    boost::system::error_code ec;
+    lease.parser().write("[42]", 4u, ec);
+    REQUIRE(!ec);
+    lease.parser().finish(ec);
+    REQUIRE(!ec);
+    v = lease.parser().release();
+  }
+  CHECK(v.as_array().at(0).as_int64() == 42);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/requests/detail/sbo_buffer.hpp>
+
+#include <cstring>
+#include <string>
+
+#include "../doctest.h"
+
+using boost::requests::detail::sbo_buffer;
+
+namespace {
+
+std::string to_string(const sbo_buffer & b)
+{
+  const auto cd = b.cdata();
+  return std::string(static_cast<const char*>(cd.data()), cd.size());
+}
+
+void append(sbo_buffer & b, const std::string & s)
+{
+  const auto mb = b.prepare(s.size());
+  std::memcpy(mb.data(), s.data(), s.size());
+  b.commit(s.size());
+}
+
+}
+
+TEST_SUITE_BEGIN("sbo_buffer");
+
+TEST_CASE("inline storage")
+{
+  sbo_buffer b;
+  append(b, "hello");
+  CHECK(b.size() == 5u);
+  CHECK(to_string(b) == "hello");
+  b.consume(2u);
+  CHECK(to_string(b) == "llo");
+  b.consume(100u);
+  CHECK(b.size() == 0u);
+}
+
+TEST_CASE("spill to the allocator")
+{
+  sbo_buffer b;
+  std::string ref;
+  for (int i = 0; i < 300; i++)
+  {
+    append(b, "0123456789");
+    ref += "0123456789";
+  }
+  CHECK(to_string(b) == ref);
+}
+
+TEST_CASE("spill to disk")
+{
+#if !defined(_WIN32)
+  sbo_buffer b;
+  b.set_spill_threshold(64u);
+  std::string ref;
+  for (int i = 0; i < 300; i++)
+  {
+    append(b, "0123456789");
+    ref += "0123456789";
+  }
+  CHECK(b.spilled());
+  CHECK(b.spill_errno() == 0);
+  CHECK(b.size() == ref.size());
+  CHECK(to_string(b) == ref);
+  b.consume(5u);
+  CHECK(to_string(b) == ref.substr(5u));
+
+  sbo_buffer m{std::move(b)};
+  CHECK(m.spilled());
+  CHECK(to_string(m) == ref.substr(5u));
+  CHECK(!b.spilled());
+  CHECK(b.size() == 0u);
+
+  sbo_buffer c{m}; // a copy lands back in memory
+  CHECK(!c.spilled());
+  CHECK(to_string(c) == ref.substr(5u));
+#endif
+}
+
+TEST_CASE("move & copy")
+{
+  sbo_buffer a;
+  append(a, "inline");
+  sbo_buffer m{std::move(a)};
+  CHECK(to_string(m) == "inline");
+  CHECK(a.size() == 0u);
+  append(a, "reusable");
+  CHECK(to_string(a) == "reusable");
+
+  sbo_buffer big;
+  const std::string payload(5000u, 'x');
+  append(big, payload);
+  sbo_buffer m2{std::move(big)};
+  CHECK(to_string(m2) == payload);
+  CHECK(big.size() == 0u);
+
+  sbo_buffer c{m2};
+  CHECK(to_string(c) == payload);
+  c = m;
+  CHECK(to_string(c) == "inline");
+}
+
+TEST_SUITE_END();
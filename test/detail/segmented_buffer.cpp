@@ -0,0 +1,118 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/requests/detail/segmented_buffer.hpp>
+
+#include <boost/asio/buffer.hpp>
+#include <cstring>
+#include <string>
+
+#include "../doctest.h"
+
+using boost::requests::detail::segmented_buffer;
+
+namespace {
+
+std::string to_string(const segmented_buffer & b)
+{
+  std::string res;
+  for (auto cb : b.cdata())
+    res.append(static_cast<const char*>(cb.data()), cb.size());
+  return res;
+}
+
+void append(segmented_buffer & b, const std::string & s)
+{
+  auto mb = b.prepare(s.size());
+  std::size_t off = 0u;
+  for (auto buf : mb)
+  {
+    const auto n = (std::min)(buf.size(), s.size() - off);
+    std::memcpy(buf.data(), s.data() + off, n);
+    off += n;
+  }
+  b.commit(s.size());
+}
+
+std::size_t block_count(const segmented_buffer & b)
+{
+  std::size_t n = 0u;
+  for (auto cb : b.cdata())
+  {
+    (void)cb;
+    n++;
+  }
+  return n;
+}
+
+}
+
+TEST_SUITE_BEGIN("segmented_buffer");
+
+TEST_CASE("grows by blocks, no copies")
+{
+  segmented_buffer b;
+  std::string ref;
+  const std::string chunk(10000, 'x');
+  for (int i = 0; i < 20; i++) // ~200 KB, several segments
+  {
+    append(b, chunk);
+    ref += chunk;
+  }
+  CHECK(b.size() == ref.size());
+  CHECK(block_count(b) > 1u);
+  CHECK(to_string(b) == ref);
+
+  // the first byte must still live where the first block put it
+  const auto first = *b.cdata().begin();
+  CHECK(static_cast<const char*>(first.data())[0] == 'x');
+}
+
+TEST_CASE("consume releases whole blocks from the front")
+{
+  segmented_buffer b;
+  append(b, std::string(3u * segmented_buffer::segment_size, 'a'));
+  const auto before = b.capacity();
+  b.consume(2u * segmented_buffer::segment_size);
+  CHECK(b.size() == segmented_buffer::segment_size);
+  CHECK(b.capacity() < before);
+  CHECK(to_string(b) == std::string(segmented_buffer::segment_size, 'a'));
+}
+
+TEST_CASE("coalesce")
+{
+  segmented_buffer b;
+  std::string ref;
+  for (int i = 0; i < 1000; i++)
+    ref += "0123456789";
+  append(b, std::string(2u * segmented_buffer::segment_size, 'b'));
+  append(b, ref);
+  const std::string expect = std::string(2u * segmented_buffer::segment_size, 'b') + ref;
+
+  const auto sv = b.coalesce();
+  CHECK(std::string(sv) == expect);
+  // flat now: a second coalesce is free and the sequence is one buffer
+  CHECK(block_count(b) == 1u);
+  CHECK(b.coalesce().data() == sv.data());
+
+  // still usable as a dynamic buffer afterwards
+  append(b, "tail");
+  CHECK(to_string(b) == expect + "tail");
+}
+
+TEST_CASE("small bodies stay in one block")
+{
+  segmented_buffer b;
+  append(b, "hello");
+  CHECK(block_count(b) == 1u);
+  const auto sv = b.coalesce();
+  CHECK(std::string(sv) == "hello");
+  b.consume(5u);
+  CHECK(b.size() == 0u);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,65 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/requests/detail/tracker.hpp>
+
+#include "../doctest.h"
+
+using namespace boost;
+
+TEST_SUITE_BEGIN("tracker");
+
+namespace
+{
+
+struct counting_listener final : requests::detail::idle_listener
+{
+  std::size_t idles = 0u;
+  void on_idle() override { idles++; }
+};
+
+}
+
+TEST_CASE("count and idle notification")
+{
+  std::atomic<std::size_t> cnt{0u};
+  counting_listener l;
+
+  {
+    requests::detail::tracker t1{cnt, &l};
+    CHECK(cnt.load(std::memory_order_acquire) == 1u);
+    {
+      requests::detail::tracker t2{cnt, &l};
+      CHECK(cnt.load(std::memory_order_acquire) == 2u);
+    }
+    // only the last request out fires on_idle
+    CHECK(l.idles == 0u);
+  }
+  CHECK(cnt.load(std::memory_order_acquire) == 0u);
+  CHECK(l.idles == 1u);
+}
+
+TEST_CASE("move")
+{
+  std::atomic<std::size_t> cnt{0u};
+  counting_listener l;
+
+  requests::detail::tracker t1{cnt, &l};
+  requests::detail::tracker t2{std::move(t1)};
+  CHECK(cnt.load(std::memory_order_acquire) == 1u);
+
+  // the moved-from tracker is inert
+  t1 = requests::detail::tracker{};
+  CHECK(cnt.load(std::memory_order_acquire) == 1u);
+  CHECK(l.idles == 0u);
+
+  t2 = requests::detail::tracker{};
+  CHECK(cnt.load(std::memory_order_acquire) == 0u);
+  CHECK(l.idles == 1u);
+}
+
+TEST_SUITE_END();
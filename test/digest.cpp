@@ -0,0 +1,82 @@
+// Copyright (c) 2021 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/digest.hpp>
+
+#include <boost/requests/connection.hpp>
+#include <boost/requests/test/loopback.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include <algorithm>
+#include <string>
+
+#include "doctest.h"
+#include "string_maker.hpp"
+
+using namespace boost;
+
+TEST_SUITE_BEGIN("digest");
+
+// FIPS 180-4 / NIST example vectors
+TEST_CASE("sha256 vectors")
+{
+  requests::sha256 h;
+  CHECK(requests::sha256::hex(h.finish())
+        == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+
+  h.reset();
+  h.update("abc", 3u);
+  CHECK(requests::sha256::hex(h.finish())
+        == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+  h.reset();
+  const std::string two_blocks = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+  // odd-sized updates, to cross the block boundary mid-chunk
+  for (std::size_t i = 0u; i < two_blocks.size(); i += 7u)
+    h.update(two_blocks.data() + i, (std::min)(std::size_t(7u), two_blocks.size() - i));
+  CHECK(requests::sha256::hex(h.finish())
+        == "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+
+  h.reset();
+  const std::string chunk(1000u, 'a');
+  for (int i = 0; i < 1000; i++)
+    h.update(chunk.data(), chunk.size());
+  CHECK(requests::sha256::hex(h.finish())
+        == "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+TEST_CASE("a tapped stream hashes the body as it is read")
+{
+  asio::io_context ctx;
+  requests::basic_connection<requests::test::loopback> hc{ctx.get_executor()};
+  hc.set_host("example.com");
+  hc.next_layer().push_response(
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Length: 3\r\n"
+      "Connection: keep-alive\r\n"
+      "\r\n"
+      "abc");
+  hc.connect(requests::test::loopback::endpoint{});
+
+  auto str = hc.ropen(beast::http::verb::get, urls::url_view("/get"),
+                      requests::empty{}, {requests::headers({}), {false}});
+
+  requests::sha256 hash;
+  requests::hash_body(str, hash);
+
+  std::string body;
+  char buf[2]; // force multiple read_some calls
+  system::error_code ec;
+  while (!str.done() && !ec)
+  {
+    auto sz = str.read_some(asio::buffer(buf), ec);
+    body.append(buf, sz);
+  }
+  CHECK(body == "abc");
+  CHECK(requests::sha256::hex(hash.finish())
+        == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,83 @@
+// Copyright (c) 2021 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/flat_headers.hpp>
+
+#include <string>
+
+#include "doctest.h"
+#include "string_maker.hpp"
+
+using namespace boost;
+
+TEST_SUITE_BEGIN("flat_headers");
+
+TEST_CASE("set and lookup")
+{
+  requests::flat_headers h;
+  h.set(requests::http::field::content_type, "application/json");
+  h.set("X-Custom", "1");
+
+  CHECK(h.size() == 2u);
+  CHECK(h[requests::http::field::content_type] == "application/json");
+  CHECK(h["content-type"] == "application/json"); // case-insensitive
+  CHECK(h["X-CUSTOM"] == "1");
+  CHECK(h["missing"] == "");
+  CHECK(h.contains("x-custom"));
+  CHECK(!h.contains("cookie"));
+}
+
+TEST_CASE("set replaces, insert keeps")
+{
+  requests::flat_headers h;
+  h.insert(requests::http::field::set_cookie, "a=1");
+  h.insert(requests::http::field::set_cookie, "b=2");
+  CHECK(h.count("set-cookie") == 2u);
+
+  h.set(requests::http::field::set_cookie, "c=3");
+  CHECK(h.count("set-cookie") == 1u);
+  CHECK(h[requests::http::field::set_cookie] == "c=3");
+}
+
+TEST_CASE("wire block")
+{
+  requests::flat_headers h;
+  h.set("Accept", "*/*");
+  h.set("Host", "example.com");
+  CHECK(h.wire() == "Accept: */*\r\nHost: example.com\r\n");
+
+  // replacing leaves a hole, wire() compacts it away
+  h.set("Accept", "application/json");
+  const auto w = h.wire();
+  CHECK(w == "Host: example.com\r\nAccept: application/json\r\n");
+}
+
+TEST_CASE("erase")
+{
+  requests::flat_headers h;
+  h.set("A", "1");
+  h.set("B", "2");
+  CHECK(h.erase("a"));
+  CHECK(!h.erase("a"));
+  CHECK(h.size() == 1u);
+  CHECK(h.wire() == "B: 2\r\n");
+}
+
+TEST_CASE("fields round trip")
+{
+  requests::http::fields f;
+  f.set(requests::http::field::accept, "*/*");
+  f.set("X-Trace", "abc");
+
+  requests::flat_headers h{f};
+  CHECK(h.size() == 2u);
+  CHECK(h["accept"] == "*/*");
+
+  const auto back = h.to_fields();
+  CHECK(back.at("x-trace") == "abc");
+  CHECK(std::distance(back.begin(), back.end()) == 2);
+}
+
+TEST_SUITE_END();
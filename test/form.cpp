@@ -0,0 +1,44 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/form.hpp>
+
+#include "doctest.h"
+#include "string_maker.hpp"
+
+using namespace boost;
+
+TEST_SUITE_BEGIN("form");
+
+TEST_CASE("pctencode")
+{
+  std::string out;
+  requests::detail::pctencode("foo", out);
+  CHECK(out == "foo");
+
+  out.clear();
+  requests::detail::pctencode("a&b=c d", out);
+  CHECK(out == "a%26b%3Dc%20d");
+
+  out.clear();
+  requests::detail::pctencode("k\xc3\xbc""che", out); // utf-8 passes through escaped
+  CHECK(out == "k%C3%BCche");
+
+  out.clear();
+  requests::detail::pctencode("", out);
+  CHECK(out == "");
+}
+
+TEST_CASE("form")
+{
+  requests::form f{{"foo", "42"}, {"foo bar", "a&b=c"}, {"flag", urls::no_value}};
+  CHECK(f.storage.encoded_query() == "foo=42&foo%20bar=a%26b%3Dc&flag");
+  // the params view must decode back to the inputs
+  auto itr = f.storage.params().find("foo bar");
+  REQUIRE(itr != f.storage.params().end());
+  CHECK((*itr).value == "a&b=c");
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,55 @@
+// Copyright (c) 2021 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/histogram.hpp>
+
+#include "doctest.h"
+#include "string_maker.hpp"
+
+using namespace boost;
+using namespace std::chrono;
+
+TEST_SUITE_BEGIN("histogram");
+
+TEST_CASE("buckets are log2 microseconds")
+{
+  requests::latency_histogram h;
+  h.record(microseconds(1));    // -> bucket 0
+  h.record(microseconds(3));    // -> bucket 1
+  h.record(microseconds(1000)); // -> bucket 9
+  h.record(hours(24));          // clamps into the last bucket
+
+  const auto s = h.snap();
+  CHECK(s.count == 4u);
+  CHECK(s.buckets[0] == 1u);
+  CHECK(s.buckets[1] == 1u);
+  CHECK(s.buckets[9] == 1u);
+  CHECK(s.buckets[requests::latency_histogram::bucket_count - 1u] == 1u);
+}
+
+TEST_CASE("quantile is the bucket's upper bound")
+{
+  requests::latency_histogram h;
+  for (int i = 0; i < 99; i++)
+    h.record(microseconds(10));    // bucket 3, upper bound 16us
+  h.record(milliseconds(100));     // one straggler in bucket 16
+
+  const auto s = h.snap();
+  CHECK(s.quantile(0.5)  == microseconds(16));
+  CHECK(s.quantile(0.98) == microseconds(16));
+  CHECK(s.quantile(1.0)  == microseconds(std::uint64_t(1u) << 17u));
+  CHECK(s.total_us == 99u * 10u + 100000u);
+}
+
+TEST_CASE("empty and negative")
+{
+  requests::latency_histogram h;
+  CHECK(h.snap().quantile(0.99) == microseconds(0));
+
+  h.record(microseconds(-5)); // clock skew lands in the first bucket
+  CHECK(h.snap().buckets[0] == 1u);
+}
+
+TEST_SUITE_END();
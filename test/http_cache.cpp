@@ -0,0 +1,48 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/requests/http_cache.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include "doctest.h"
+
+namespace br = boost::requests;
+
+TEST_SUITE_BEGIN("http_cache");
+
+TEST_CASE("cacheable")
+{
+  br::http::response_header h;
+  h.result(boost::beast::http::status::ok);
+  CHECK(!br::http_cache::cacheable(h)); // no explicit freshness
+
+  h.set(boost::beast::http::field::cache_control, "max-age=60");
+  CHECK(br::http_cache::cacheable(h));
+
+  h.set(boost::beast::http::field::cache_control, "no-store, max-age=60");
+  CHECK(!br::http_cache::cacheable(h));
+
+  h.set(boost::beast::http::field::cache_control, "max-age=0");
+  CHECK(!br::http_cache::cacheable(h));
+
+  h.set(boost::beast::http::field::cache_control, "max-age=60");
+  h.result(boost::beast::http::status::not_found);
+  CHECK(!br::http_cache::cacheable(h));
+}
+
+TEST_CASE("a cold cache misses")
+{
+  boost::asio::io_context ctx;
+  br::http_cache cache{"./http_cache_test"};
+  cache.clear();
+
+  auto m = cache.match(ctx.get_executor(),
+                       boost::urls::url_view("https://example.com/"));
+  CHECK(!m);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,119 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/requests/detail/inflate.hpp>
+#include <boost/beast/zlib/deflate_stream.hpp>
+
+#include "doctest.h"
+#include "string_maker.hpp"
+
+TEST_SUITE_BEGIN("inflate");
+
+namespace
+{
+
+std::string raw_deflate(const std::string & in)
+{
+  boost::beast::zlib::deflate_stream ds;
+  std::string out;
+  out.resize(in.size() + 128u);
+
+  boost::beast::zlib::z_params zs;
+  zs.next_in   = in.data();
+  zs.avail_in  = in.size();
+  zs.next_out  = &out[0];
+  zs.avail_out = out.size();
+
+  boost::system::error_code ec;
+  ds.write(zs, boost::beast::zlib::Flush::finish, ec);
+  REQUIRE(ec == boost::beast::zlib::error::end_of_stream);
+  out.resize(out.size() - zs.avail_out);
+  return out;
+}
+
+std::string inflate_in_slices(boost::requests::detail::inflater & inf,
+                              const std::string & encoded,
+                              std::size_t slice)
+{
+  std::string decoded;
+  char out[64];
+
+  std::size_t offset = 0u;
+  while (!inf.done())
+  {
+    if (inf.needs_input())
+    {
+      REQUIRE(offset < encoded.size());
+      auto ib = inf.input_buffer();
+      const auto n = (std::min)({slice, ib.size(), encoded.size() - offset});
+      std::memcpy(ib.data(), encoded.data() + offset, n);
+      inf.commit(n);
+      offset += n;
+    }
+    boost::system::error_code ec;
+    const auto n = inf.write_output(boost::asio::buffer(out), ec);
+    REQUIRE(!ec);
+    decoded.append(out, n);
+  }
+  CHECK(offset == encoded.size());
+  return decoded;
+}
+
+}
+
+TEST_CASE("select-coding")
+{
+  using inflater = boost::requests::detail::inflater;
+  CHECK(inflater::select_coding("gzip")    == inflater::coding::gzip);
+  CHECK(inflater::select_coding("x-gzip")  == inflater::coding::gzip);
+  CHECK(inflater::select_coding("deflate") == inflater::coding::deflate);
+  CHECK(inflater::select_coding("br")          == inflater::coding::identity);
+  CHECK(inflater::select_coding("gzip, br")    == inflater::coding::identity);
+  CHECK(inflater::select_coding("")            == inflater::coding::identity);
+}
+
+TEST_CASE("gzip")
+{
+  const std::string plain = "Hello decompression, hello decompression, hello decompression!";
+
+  // member header with FNAME, the raw stream and an (unchecked) trailer
+  std::string encoded{'\x1f', '\x8b', '\x08', '\x08', 0, 0, 0, 0, 0, '\x03'};
+  encoded += "file.txt";
+  encoded += '\0';
+  encoded += raw_deflate(plain);
+  encoded.append(8u, '\0');
+
+  for (std::size_t slice : {1u, 3u, 64u, 4096u})
+  {
+    boost::requests::detail::inflater inf{boost::requests::detail::inflater::coding::gzip};
+    CHECK(inflate_in_slices(inf, encoded, slice) == plain);
+  }
+}
+
+TEST_CASE("deflate")
+{
+  const std::string plain = "zlib wrapped payload";
+
+  std::string encoded{'\x78', '\x9c'};
+  encoded += raw_deflate(plain);
+  encoded.append(4u, '\0'); // adler32, unchecked
+
+  boost::requests::detail::inflater inf{boost::requests::detail::inflater::coding::deflate};
+  CHECK(inflate_in_slices(inf, encoded, 7u) == plain);
+}
+
+TEST_CASE("raw-deflate")
+{
+  // some servers send deflate without the zlib wrapper
+  const std::string plain = "raw deflate without a wrapper";
+  const std::string encoded = raw_deflate(plain);
+
+  boost::requests::detail::inflater inf{boost::requests::detail::inflater::coding::deflate};
+  CHECK(inflate_in_slices(inf, encoded, 11u) == plain);
+}
+
+TEST_SUITE_END();
@@ -8,6 +8,7 @@
 #include <boost/requests/json.hpp>
 #include <boost/requests/connection.hpp>
 
+#include <boost/asio/append.hpp>
 #include <boost/asio/awaitable.hpp>
 #include <boost/asio/co_spawn.hpp>
 #include <boost/asio/detached.hpp>
@@ -16,6 +17,8 @@
 #include <boost/asio/use_awaitable.hpp>
 #include <boost/optional/optional_io.hpp>
 
+#include <cstring>
+
 #include "doctest.h"
 #include "extern.hpp"
 #include "string_maker.hpp"
@@ -336,4 +339,119 @@ TEST_CASE_TEMPLATE("async-https-request", Conn, aw_http_connection, aw_https_con
   ctx.run();
 }
 
-TEST_SUITE_END();
\ No newline at end of file
+TEST_SUITE_END();
+TEST_SUITE_BEGIN("json-stream-reader");
+
+namespace
+{
+
+// enough of basic_stream to drive the reader from memory.
+struct memory_stream
+{
+  using executor_type = asio::io_context::executor_type;
+  executor_type get_executor() {return ctx.get_executor();}
+
+  asio::io_context & ctx;
+  std::string data;
+  std::size_t pos = 0u;
+  std::size_t chunk = 7u; // deliberately misaligned with document bounds
+
+  bool done() const {return pos == data.size();}
+
+  std::size_t read_some(asio::mutable_buffer buffer, boost::system::error_code & ec)
+  {
+    const auto n = (std::min)({buffer.size(), chunk, data.size() - pos});
+    std::memcpy(buffer.data(), data.data() + pos, n);
+    pos += n;
+    return n;
+  }
+
+  template<typename CompletionToken>
+  auto async_read_some(asio::mutable_buffer buffer, CompletionToken && token)
+  {
+    return asio::async_initiate<CompletionToken, void(boost::system::error_code, std::size_t)>(
+        [this](auto handler, asio::mutable_buffer buffer)
+        {
+          boost::system::error_code ec;
+          const auto n = read_some(buffer, ec);
+          asio::post(ctx, asio::append(std::move(handler), ec, n));
+        }, token, buffer);
+  }
+};
+
+}
+
+TEST_CASE("ndjson")
+{
+  asio::io_context ctx;
+  memory_stream ms{ctx, "{\"id\": 1}\n{\"id\": 2}\n\n[3, 4]\n"};
+
+  requests::json::stream_reader<memory_stream> rd{ms};
+
+  boost::system::error_code ec;
+  auto v = rd.read_next(ec);
+  REQUIRE(v);
+  CHECK(v->at("id") == 1);
+
+  v = rd.read_next(ec);
+  REQUIRE(v);
+  CHECK(v->at("id") == 2);
+
+  v = rd.read_next(ec);
+  REQUIRE(v);
+  CHECK(v->as_array().size() == 2u);
+
+  v = rd.read_next(ec);
+  CHECK(!ec);
+  CHECK(!v);
+  CHECK(rd.done());
+}
+
+TEST_CASE("ndjson-truncated")
+{
+  asio::io_context ctx;
+  memory_stream ms{ctx, "{\"id\": 1}\n{\"id\":"};
+
+  requests::json::stream_reader<memory_stream> rd{ms};
+
+  boost::system::error_code ec;
+  auto v = rd.read_next(ec);
+  REQUIRE(v);
+  CHECK(v->at("id") == 1);
+
+  v = rd.read_next(ec);
+  CHECK(ec);
+  CHECK(!v);
+}
+
+TEST_CASE("async-ndjson")
+{
+  asio::io_context ctx;
+  memory_stream ms{ctx, "1\n2\n"};
+
+  requests::json::stream_reader<memory_stream> rd{ms};
+
+  std::vector<boost::optional<json::value>> read;
+  rd.async_read_next([&](boost::system::error_code ec, boost::optional<json::value> v)
+                     {
+                       CHECK(!ec);
+                       read.push_back(std::move(v));
+                     });
+  ctx.run();
+  REQUIRE(read.size() == 1u);
+  REQUIRE(read.front());
+  CHECK(*read.front() == 1);
+
+  ctx.restart();
+  rd.async_read_next([&](boost::system::error_code ec, boost::optional<json::value> v)
+                     {
+                       CHECK(!ec);
+                       read.push_back(std::move(v));
+                     });
+  ctx.run();
+  REQUIRE(read.size() == 2u);
+  REQUIRE(read.back());
+  CHECK(*read.back() == 2);
+}
+
+TEST_SUITE_END();
@@ -6,6 +6,7 @@
 //
 
 #include "boost/requests/fields/keep_alive.hpp"
+#include <boost/requests/keep_alive.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
 #include "doctest.h"
@@ -38,4 +39,38 @@ TEST_CASE("parse")
 
 }
 
+TEST_CASE("budget")
+{
+  namespace br = boost::requests;
+  namespace http = br::http;
+  boost::system::error_code ec;
+
+  br::keep_alive ka;
+  http::fields res;
+  res.set(http::field::connection, "keep-alive");
+  // the parsed timeout is absolute seconds, so pick one far in the future
+  res.set(http::field::keep_alive, "timeout=4000000000, max=3");
+
+  // a fresh `max=` is the remaining budget as the server sees it
+  CHECK(!br::interpret_keep_alive_response(ka, res, ec));
+  CHECK(ka.max == 3u);
+
+  // without a fresh advertisement the tracked budget counts down
+  res.erase(http::field::keep_alive);
+  CHECK(!br::interpret_keep_alive_response(ka, res, ec));
+  CHECK(ka.max == 2u);
+  CHECK(!br::interpret_keep_alive_response(ka, res, ec));
+  CHECK(ka.max == 1u);
+
+  // spending the last request closes the connection
+  CHECK(br::interpret_keep_alive_response(ka, res, ec));
+  CHECK(ka.max == 0u);
+  CHECK(!ec);
+
+  // an untracked connection still resets to unlimited
+  br::keep_alive fresh;
+  CHECK(!br::interpret_keep_alive_response(fresh, res, ec));
+  CHECK(fresh.max == std::numeric_limits<std::size_t>::max());
+}
+
 TEST_SUITE_END();
\ No newline at end of file
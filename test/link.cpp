@@ -119,4 +119,57 @@ TEST_CASE("link")
 
 }
 
+TEST_CASE("link-view")
+{
+  using namespace boost;
+  namespace br = boost::requests;
+
+  SUBCASE("pagination")
+  {
+    auto txt =
+        R"(<https://api.example.com/items?page=3>; rel="next", )"
+        R"(<https://api.example.com/items?page=1>; rel="prev first", )"
+        R"(<https://api.example.com/items?page=12>; rel="last"; title="the, end")";
+
+    br::link_field_view lv{txt};
+    std::size_t n = 0u;
+    core::string_view next;
+    for (auto itr = lv.begin(); itr != lv.end(); itr++, n++)
+      if (itr->has_rel("NEXT")) // rel is case-insensitive
+        next = itr->target;
+    CHECK(n == 3u);
+    CHECK(next == "https://api.example.com/items?page=3");
+
+    auto itr = std::next(lv.begin());
+    CHECK(itr->has_rel("first"));
+    CHECK(itr->has_rel("prev"));
+    CHECK(!itr->has_rel("fir"));
+    CHECK(itr->url() == urls::parse_uri("https://api.example.com/items?page=1"));
+    CHECK(itr->attribute("nope").has_error());
+
+    // the quoted ',' must not split the element
+    itr++;
+    CHECK(itr->attribute("title") == core::string_view("the, end"));
+    CHECK(++itr == lv.end());
+  }
+
+  SUBCASE("unquoted and malformed")
+  {
+    br::link_field_view lv{"</a>; xyz=ctl; foobar, no-target"};
+    auto itr = lv.begin();
+    CHECK(itr->attribute("xyz") == core::string_view("ctl"));
+    CHECK(itr->attribute("foobar") == core::string_view(""));
+    ++itr;
+    CHECK(itr->target.empty());
+    CHECK(itr->attribute("no-target") == core::string_view(""));
+    CHECK(++itr == lv.end());
+  }
+
+  SUBCASE("empty")
+  {
+    br::link_field_view lv{""};
+    CHECK(lv.begin() == lv.end());
+  }
+}
+
 TEST_SUITE_END();
\ No newline at end of file
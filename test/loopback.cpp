@@ -0,0 +1,189 @@
+// Copyright (c) 2021 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/connection.hpp>
+#include <boost/requests/test/loopback.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/beast/core/buffers_to_string.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+
+#include <string>
+
+#include "doctest.h"
+#include "string_maker.hpp"
+
+using namespace boost;
+
+using loopback_connection = requests::basic_connection<requests::test::loopback>;
+
+TEST_SUITE_BEGIN("loopback");
+
+TEST_CASE("canned round trip")
+{
+  asio::io_context ctx;
+  loopback_connection hc{ctx.get_executor()};
+  hc.set_host("example.com");
+  hc.next_layer().push_response(
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Length: 5\r\n"
+      "Connection: keep-alive\r\n"
+      "\r\n"
+      "hello");
+  hc.connect(requests::test::loopback::endpoint{});
+  CHECK(hc.is_open());
+
+  auto str = hc.ropen(beast::http::verb::get, urls::url_view("/get"),
+                      requests::empty{}, {requests::headers({{"Test-Header", "it works"}}), {false}});
+  CHECK(str.headers().result() == beast::http::status::ok);
+
+  std::string body;
+  char buf[16];
+  system::error_code ec;
+  while (!str.done() && !ec)
+  {
+    auto sz = str.read_some(asio::buffer(buf), ec);
+    CHECK(ec == system::error_code{});
+    body.append(buf, sz);
+  }
+  CHECK(body == "hello");
+
+  const auto & wire = hc.next_layer().written();
+  CHECK(wire.compare(0u, 19u, "GET /get HTTP/1.1\r\n") == 0);
+  CHECK(wire.find("Host: example.com\r\n")      != std::string::npos);
+  CHECK(wire.find("Test-Header: it works\r\n")  != std::string::npos);
+}
+
+TEST_CASE("read caps at the buffer's max_size")
+{
+  asio::io_context ctx;
+  loopback_connection hc{ctx.get_executor()};
+  hc.set_host("example.com");
+  hc.next_layer().push_response(
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Length: 5\r\n"
+      "Connection: keep-alive\r\n"
+      "\r\n"
+      "hello");
+  hc.connect(requests::test::loopback::endpoint{});
+
+  auto str = hc.ropen(beast::http::verb::get, urls::url_view("/get"),
+                      requests::empty{}, {requests::headers({}), {false}});
+
+  // the announced size exceeds the cap, so nothing is allocated or read
+  beast::flat_buffer small{3u};
+  system::error_code ec;
+  CHECK(str.read(small, ec) == 0u);
+  CHECK(ec == beast::http::error::buffer_overflow);
+  CHECK(small.size() == 0u);
+
+  // a buffer that fits collects the body in one go
+  beast::flat_buffer big;
+  ec = {};
+  CHECK(str.read(big, ec) == 5u);
+  CHECK(ec == system::error_code{});
+  CHECK(beast::buffers_to_string(big.data()) == "hello");
+}
+
+TEST_CASE("a dropped stream drains a small remainder and keeps the connection")
+{
+  asio::io_context ctx;
+  loopback_connection hc{ctx.get_executor()};
+  hc.set_host("example.com");
+  hc.next_layer().push_response(
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Length: 5\r\n"
+      "Connection: keep-alive\r\n"
+      "\r\n"
+      "hello");
+  hc.next_layer().push_response(
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Length: 5\r\n"
+      "Connection: keep-alive\r\n"
+      "\r\n"
+      "world");
+  hc.connect(requests::test::loopback::endpoint{});
+
+  {
+    auto str = hc.ropen(beast::http::verb::get, urls::url_view("/one"),
+                        requests::empty{}, {requests::headers({}), {false}});
+    CHECK(str.headers().result() == beast::http::status::ok);
+    // only the headers were needed - the body is dropped unread
+  }
+  ctx.run(); // runs the detached drain
+  CHECK(hc.is_open());
+
+  auto str = hc.ropen(beast::http::verb::get, urls::url_view("/two"),
+                      requests::empty{}, {requests::headers({}), {false}});
+  beast::flat_buffer b;
+  system::error_code ec;
+  CHECK(str.read(b, ec) == 5u);
+  CHECK(beast::buffers_to_string(b.data()) == "world");
+}
+
+TEST_CASE("an over-budget remainder closes the connection instead")
+{
+  asio::io_context ctx;
+  loopback_connection hc{ctx.get_executor()};
+  hc.set_host("example.com");
+  hc.next_layer().push_response(
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Length: 5\r\n"
+      "Connection: keep-alive\r\n"
+      "\r\n"
+      "hello");
+  hc.connect(requests::test::loopback::endpoint{});
+
+  {
+    auto str = hc.ropen(beast::http::verb::get, urls::url_view("/one"),
+                        requests::empty{}, {requests::headers({}), {false}});
+    str.set_max_drain_size(2u);
+  }
+  ctx.run();
+  CHECK(!hc.is_open());
+}
+
+TEST_CASE("a leaving redirect hands back before its body is drained")
+{
+  asio::io_context ctx;
+  loopback_connection hc{ctx.get_executor()};
+  hc.set_host("example.com");
+  hc.next_layer().push_response(
+      "HTTP/1.1 302 Found\r\n"
+      "Location: http://elsewhere.test/next\r\n"
+      "Content-Length: 5\r\n"
+      "Connection: keep-alive\r\n"
+      "\r\n"
+      "moved");
+  hc.connect(requests::test::loopback::endpoint{});
+
+  system::error_code ec;
+  std::size_t hops = 0u;
+  hc.async_ropen(beast::http::verb::get, urls::url_view("/one"),
+                 requests::empty{}, {requests::headers({}), {false}},
+                 [&](system::error_code ec_, loopback_connection::stream str)
+                 {
+                   ec = ec_;
+                   hops = str.history().size();
+                 });
+  ctx.run();
+  CHECK(ec == requests::error::forbidden_redirect);
+  CHECK(hops == 1u);
+  // the hop's remainder drained detached and kept the connection warm
+  CHECK(hc.is_open());
+}
+
+TEST_CASE("reading past the script is an eof")
+{
+  asio::io_context ctx;
+  requests::test::loopback lb{ctx.get_executor()};
+  lb.connect(requests::test::loopback::endpoint{});
+
+  char buf[8];
+  system::error_code ec;
+  CHECK(lb.read_some(asio::buffer(buf), ec) == 0u);
+  CHECK(ec == asio::error::eof);
+}
+
+TEST_SUITE_END();
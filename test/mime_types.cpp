@@ -0,0 +1,33 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/mime_types.hpp>
+
+#include "doctest.h"
+#include "string_maker.hpp"
+
+using namespace boost;
+
+TEST_SUITE_BEGIN("mime-types");
+
+TEST_CASE("lookup")
+{
+  CHECK(requests::mime_type_for(".json") == "application/json");
+  CHECK(requests::mime_type_for(".html") == "text/html");
+  CHECK(requests::mime_type_for(".JSON") == "application/json"); // case-insensitive
+  CHECK(requests::mime_type_for(".nope").empty());
+  CHECK(requests::mime_type_for("json").empty()); // the dot is part of the key
+  CHECK(requests::mime_type_for("").empty());
+}
+
+TEST_CASE("map-matches-table")
+{
+  // the compatibility map is built from the same entries the static
+  // table serves, so every lookup must agree.
+  for (const auto & e : requests::default_mime_type_map())
+    CHECK(requests::mime_type_for(e.first) == e.second);
+}
+
+TEST_SUITE_END();
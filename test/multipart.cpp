@@ -0,0 +1,129 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/multipart.hpp>
+
+#include <boost/beast/http/fields.hpp>
+#include <cstdio>
+#include <fstream>
+
+#include "doctest.h"
+#include "string_maker.hpp"
+
+using namespace boost;
+
+TEST_SUITE_BEGIN("multipart");
+
+namespace
+{
+
+std::string serialize(const requests::multipart_form & mf)
+{
+  beast::http::header<true, beast::http::fields> hd;
+  requests::multipart_body::writer wr{hd, mf};
+
+  system::error_code ec;
+  wr.init(ec);
+  REQUIRE(!ec);
+
+  std::string res;
+  for (;;)
+  {
+    auto buf = wr.get(ec);
+    REQUIRE(!ec);
+    if (!buf)
+      break;
+    res.append(static_cast<const char*>(buf->first.data()), buf->first.size());
+    if (!buf->second)
+      break;
+  }
+  return res;
+}
+
+}
+
+TEST_CASE("form-data")
+{
+  const char * path = "multipart_body_test.txt";
+  {
+    std::ofstream ofs{path, std::ios::binary};
+    ofs << "file-content";
+  }
+
+  requests::multipart_form mf;
+  mf.append("title", "hello");
+  mf.append_file("file", path);
+
+  CHECK(mf.content_type() == "multipart/form-data; boundary=" + std::string(mf.boundary()));
+  REQUIRE(mf.parts().size() == 2u);
+  CHECK(mf.parts()[1].filename == path);
+  CHECK(mf.parts()[1].content_type == requests::mime_type_for(".txt"));
+
+  const auto bd = std::string(mf.boundary());
+  CHECK(serialize(mf) ==
+        "--" + bd + "\r\n"
+        "Content-Disposition: form-data; name=\"title\"\r\n"
+        "Content-Type: text/plain; charset=utf-8\r\n"
+        "\r\n"
+        "hello\r\n"
+        "--" + bd + "\r\n"
+        "Content-Disposition: form-data; name=\"file\"; filename=\"multipart_body_test.txt\"\r\n"
+        "Content-Type: " + mf.parts()[1].content_type + "\r\n"
+        "\r\n"
+        "file-content\r\n"
+        "--" + bd + "--\r\n");
+
+  std::remove(path);
+}
+
+TEST_CASE("empty-file")
+{
+  const char * path = "multipart_empty_test.bin";
+  {
+    std::ofstream ofs{path, std::ios::binary};
+  }
+
+  requests::multipart_form mf;
+  mf.append_file("blob", path, "application/octet-stream");
+
+  const auto bd = std::string(mf.boundary());
+  CHECK(serialize(mf) ==
+        "--" + bd + "\r\n"
+        "Content-Disposition: form-data; name=\"blob\"; filename=\"multipart_empty_test.bin\"\r\n"
+        "Content-Type: application/octet-stream\r\n"
+        "\r\n"
+        "\r\n"
+        "--" + bd + "--\r\n");
+
+  std::remove(path);
+}
+
+TEST_CASE("known-length")
+{
+  const char * path = "multipart_length_test.txt";
+  {
+    std::ofstream ofs{path, std::ios::binary};
+    ofs << "0123456789";
+  }
+
+  requests::multipart_form mf;
+  mf.append("title", "hello");
+  mf.append_file("file", path);
+
+  CHECK(mf.parts()[1].size == 10u);
+  // the boundary arithmetic matches the serializer byte for byte
+  CHECK(mf.content_size() == serialize(mf).size());
+
+  // with the size known the request carries a Content-Length, not chunked
+  beast::http::request<requests::multipart_body> req{beast::http::verb::post, "/upload", 11};
+  req.body() = mf;
+  req.prepare_payload();
+  CHECK(req[beast::http::field::content_length] == std::to_string(mf.content_size()));
+  CHECK(req[beast::http::field::transfer_encoding] == "");
+
+  std::remove(path);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,201 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/paginator.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+#include <thread>
+#include <vector>
+
+#include "doctest.h"
+#include "string_maker.hpp"
+
+using namespace boost;
+
+TEST_SUITE_BEGIN("paginator");
+
+TEST_CASE("next-link")
+{
+  namespace br = boost::requests;
+  const auto base = urls::parse_uri("https://api.example.com/items?page=2").value();
+
+  br::http::response_header hd;
+  CHECK(br::next_page_url(hd, base).empty());
+
+  hd.base().set(br::http::field::link,
+                R"(<https://api.example.com/items?page=3>; rel="next", )"
+                R"(<https://api.example.com/items?page=1>; rel="prev first")");
+  CHECK(br::next_page_url(hd, base).buffer() == "https://api.example.com/items?page=3");
+
+  // a relative link resolves against the page it came from
+  hd.base().set(br::http::field::link, R"(</items?page=3>; rel="next")");
+  CHECK(br::next_page_url(hd, base).buffer() == "https://api.example.com/items?page=3");
+
+  // no rel="next" entry means the walk is over
+  hd.base().set(br::http::field::link, R"(<https://api.example.com/items?page=1>; rel="prev")");
+  CHECK(br::next_page_url(hd, base).empty());
+
+  // and so does a field that does not parse
+  hd.base().set(br::http::field::link, "not a link field");
+  CHECK(br::next_page_url(hd, base).empty());
+}
+
+namespace
+{
+
+// a minimal loopback API serving /a -> /b -> /c chained by Link headers;
+// every accepted connection answers requests until its peer hangs up.
+struct page_server
+{
+  asio::io_context ctx;
+  asio::ip::tcp::acceptor acceptor{ctx, asio::ip::tcp::endpoint{asio::ip::make_address("127.0.0.1"), 0}};
+  std::uint16_t port{acceptor.local_endpoint().port()};
+  std::vector<std::thread> threads;
+  std::thread accept_thread;
+
+  page_server()
+  {
+    accept_thread = std::thread(
+        [this]
+        {
+          for (;;)
+          {
+            system::error_code ec;
+            asio::ip::tcp::socket sock{ctx};
+            acceptor.accept(sock, ec);
+            if (ec)
+              return;
+            threads.emplace_back(&page_server::serve_, this, std::move(sock));
+          }
+        });
+  }
+
+  ~page_server()
+  {
+    system::error_code ec;
+    acceptor.close(ec);
+    accept_thread.join();
+    for (auto & t : threads)
+      t.join();
+  }
+
+  void serve_(asio::ip::tcp::socket sock)
+  {
+    asio::streambuf buf;
+    for (;;)
+    {
+      system::error_code ec;
+      asio::read_until(sock, buf, "\r\n\r\n", ec);
+      if (ec)
+        return;
+      const std::string request{asio::buffers_begin(buf.data()), asio::buffers_end(buf.data())};
+      buf.consume(buf.size());
+
+      std::string link;
+      if (request.compare(0u, 6u, "GET /a") == 0)
+        link = "Link: </b>; rel=\"next\"\r\n"; // relative on purpose
+      else if (request.compare(0u, 6u, "GET /b") == 0)
+        link = "Link: <http://127.0.0.1:" + std::to_string(port) + "/c>; rel=\"next\"\r\n";
+
+      const std::string response =
+          "HTTP/1.1 200 OK\r\n"
+          "Content-Length: 4\r\n"
+          "Connection: keep-alive\r\n"
+          + link +
+          "\r\n"
+          "page";
+      asio::write(sock, asio::buffer(response), ec);
+      if (ec)
+        return;
+    }
+  }
+};
+
+std::string read_all(requests::session::stream & str)
+{
+  std::string body;
+  char buf[64];
+  system::error_code ec;
+  while (!str.done() && !ec)
+  {
+    const auto n = str.read_some(asio::buffer(buf), ec);
+    body.append(buf, n);
+  }
+  return body;
+}
+
+}
+
+TEST_CASE("walk")
+{
+  page_server server;
+
+  asio::io_context ctx;
+  requests::session sess{ctx};
+  sess.options().enforce_tls = false;
+
+  const auto first = urls::parse_uri("http://127.0.0.1:" + std::to_string(server.port) + "/a").value();
+  requests::paginator pg{sess, first};
+  CHECK(pg.next_url() == first);
+
+  std::size_t pages = 0u;
+  system::error_code ec;
+  while (!pg.done())
+  {
+    auto str = pg.next(ec);
+    REQUIRE(ec == system::error_code{});
+    CHECK(read_all(str) == "page");
+    pages++;
+  }
+  CHECK(pages == 3u);
+
+  // the chain is exhausted
+  pg.next(ec);
+  CHECK(ec == asio::error::eof);
+}
+
+TEST_CASE("async-walk")
+{
+  page_server server;
+
+  asio::io_context ctx;
+  requests::session sess{ctx};
+  sess.options().enforce_tls = false;
+
+  const auto first = urls::parse_uri("http://127.0.0.1:" + std::to_string(server.port) + "/a").value();
+  requests::paginator pg{sess, first};
+
+  std::size_t pages = 0u;
+  system::error_code last;
+
+  struct walker
+  {
+    requests::paginator & pg;
+    std::size_t & pages;
+    system::error_code & last;
+
+    void operator()(system::error_code ec, requests::session::stream str)
+    {
+      if (ec)
+      {
+        last = ec;
+        return;
+      }
+      CHECK(read_all(str) == "page");
+      pages++;
+      pg.async_next(walker{pg, pages, last});
+    }
+  };
+  pg.async_next(walker{pg, pages, last});
+  ctx.run();
+
+  CHECK(pages == 3u);
+  CHECK(last == asio::error::eof);
+}
+
+TEST_SUITE_END();
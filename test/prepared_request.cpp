@@ -0,0 +1,97 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/prepared_request.hpp>
+#include <boost/url/url_view.hpp>
+
+#include "doctest.h"
+
+namespace requests = boost::requests;
+namespace http = requests::http;
+namespace urls = boost::urls;
+
+using boost::core::string_view;
+
+TEST_SUITE_BEGIN("prepared-request");
+
+TEST_CASE("invariant-block")
+{
+  http::fields fld;
+  fld.set(http::field::authorization, "Bearer token");
+  fld.set(http::field::accept, "application/json");
+  // volatile fields are per-call and must not land in the block
+  fld.set(http::field::host, "ignored.example.com");
+  fld.set(http::field::content_length, "999");
+
+  requests::prepared_request pr{boost::beast::http::verb::get,
+                                urls::url_view("https://example.com/api/v1/items?x=1"),
+                                fld};
+
+  CHECK(pr.method() == boost::beast::http::verb::get);
+  CHECK(pr.target() == "/api/v1/items?x=1");
+
+  const auto hb = pr.header_block();
+  CHECK(hb.starts_with("GET /api/v1/items?x=1 HTTP/1.1\r\n"));
+  CHECK(hb.find("Authorization: Bearer token\r\n") != string_view::npos);
+  CHECK(hb.find("Accept: application/json\r\n")    != string_view::npos);
+  CHECK(hb.find("User-Agent: ")                    != string_view::npos);
+  CHECK(hb.find("Host:")           == string_view::npos);
+  CHECK(hb.find("Content-Length:") == string_view::npos);
+}
+
+TEST_CASE("prototype")
+{
+  http::fields fld;
+  fld.set(http::field::authorization, "Bearer token");
+  fld.set(http::field::host, "ignored.example.com");
+
+  const requests::header_prototype proto{fld};
+  CHECK(proto.field_block().find("Authorization: Bearer token\r\n") != string_view::npos);
+  CHECK(proto.field_block().find("Host:") == string_view::npos);
+
+  // one borrowed prototype, many targets - each request is just a line
+  // plus the block
+  requests::prepared_request a{boost::beast::http::verb::get,
+                               urls::url_view("https://example.com/one"), proto};
+  requests::prepared_request b{boost::beast::http::verb::post,
+                               urls::url_view("https://example.com/two"), proto};
+  CHECK(a.header_block() == "GET /one HTTP/1.1\r\n" + std::string(proto.field_block()));
+  CHECK(b.header_block() == "POST /two HTTP/1.1\r\n" + std::string(proto.field_block()));
+
+  // and matches what the fields constructor produces
+  requests::prepared_request c{boost::beast::http::verb::get,
+                               urls::url_view("https://example.com/one"), fld};
+  CHECK(a.header_block() == c.header_block());
+}
+
+TEST_CASE("assemble")
+{
+  http::fields fld;
+  fld.set(http::field::content_type, "application/json");
+
+  requests::prepared_request pr{boost::beast::http::verb::post,
+                                urls::url_view("https://example.com/api/v1/items"),
+                                fld};
+
+  std::string out;
+  pr.assemble(out, "example.com", "a=b", 5u);
+  CHECK(out == std::string(pr.header_block())
+               + "Host: example.com\r\n"
+                 "Cookie: a=b\r\n"
+                 "Content-Length: 5\r\n"
+                 "\r\n");
+
+  // a POST with an empty body still sends Content-Length, but no Cookie
+  pr.assemble(out, "example.com", "", 0u);
+  CHECK(out.find("Content-Length: 0\r\n") != std::string::npos);
+  CHECK(out.find("Cookie:") == std::string::npos);
+
+  // accept-encoding only gets appended on request
+  CHECK(out.find("Accept-Encoding:") == std::string::npos);
+  pr.assemble(out, "example.com", "", 0u, true);
+  CHECK(out.find("Accept-Encoding: gzip, deflate\r\n") != std::string::npos);
+}
+
+TEST_SUITE_END();
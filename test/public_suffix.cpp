@@ -0,0 +1,39 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/public_suffix.hpp>
+
+#include "doctest.h"
+
+using namespace boost;
+
+TEST_SUITE_BEGIN("public_suffix");
+
+TEST_CASE("builtin table")
+{
+  CHECK(requests::is_public_suffix("com"));
+  CHECK(requests::is_public_suffix("co.uk"));
+  CHECK(requests::is_public_suffix("github.io"));
+  CHECK(!requests::is_public_suffix("example.com"));
+  CHECK(requests::is_public_suffix("foo.ck"));   // *.ck
+  CHECK(!requests::is_public_suffix("www.ck"));  // !www.ck
+  CHECK(!requests::is_public_suffix(""));
+}
+
+TEST_CASE("matches the shipped list")
+{
+  // the compiled-in table is generated from public_suffix_list.dat,
+  // so both lookups must agree.
+  const auto parsed = requests::load_public_suffix_list(
+#include <boost/requests/impl/public_suffix_list.dat>
+      );
+
+  for (core::string_view sv : {"com", "co.uk", "github.io", "example.com",
+                               "www.ck", "foo.ck", "city.kawasaki.jp",
+                               "other.kawasaki.jp", "kawasaki.jp", "ac.at"})
+    CHECK(requests::is_public_suffix(sv) == requests::is_public_suffix(sv, parsed));
+}
+
+TEST_SUITE_END();
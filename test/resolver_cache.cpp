@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2022 Klemens Morgenstern (klemens.morgenstern@gmx.net)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <boost/requests/resolver_cache.hpp>
+
+#include "doctest.h"
+#include "string_maker.hpp"
+
+TEST_SUITE_BEGIN("resolver_cache");
+
+TEST_CASE("roundtrip")
+{
+  namespace br = boost::requests;
+
+  br::resolver_cache cache{std::chrono::seconds(60)};
+
+  br::resolver_cache::entry e;
+  CHECK(!cache.get("example.com", "https", e));
+
+  e.host_name = "example.com";
+  e.endpoints.emplace_back(boost::asio::ip::make_address("127.0.0.1"), 443);
+  cache.put("example.com", "https", e);
+
+  br::resolver_cache::entry out;
+  CHECK(cache.get("example.com", "https", out));
+  CHECK(out.host_name == "example.com");
+  REQUIRE(out.endpoints.size() == 1u);
+  CHECK(out.endpoints.front().port() == 443);
+
+  // same host, different service is a distinct key
+  CHECK(!cache.get("example.com", "http", out));
+
+  // fresh entries are not due for refresh
+  CHECK(!cache.claim_refresh("example.com", "https"));
+
+  cache.clear();
+  CHECK(!cache.get("example.com", "https", out));
+}
+
+TEST_CASE("single-flight")
+{
+  namespace br = boost::requests;
+
+  br::resolver_cache cache{std::chrono::seconds(60)};
+
+  // first caller wins the claim, the rest queue up
+  CHECK(cache.claim_inflight("example.com", "https", [](boost::system::error_code) {}));
+
+  int woken = 0;
+  boost::system::error_code seen;
+  auto waiter = [&](boost::system::error_code ec) { woken++; seen = ec; };
+  CHECK(!cache.claim_inflight("example.com", "https", waiter));
+  CHECK(!cache.claim_inflight("example.com", "https", waiter));
+
+  // a different key is an independent flight
+  CHECK(cache.claim_inflight("example.com", "http", [](boost::system::error_code) {}));
+
+  br::resolver_cache::entry e;
+  e.host_name = "example.com";
+  e.endpoints.emplace_back(boost::asio::ip::make_address("127.0.0.1"), 443);
+  cache.publish("example.com", "https", {}, e);
+
+  CHECK(woken == 2);
+  CHECK(!seen);
+  br::resolver_cache::entry out;
+  CHECK(cache.get("example.com", "https", out)); // the result got stored
+
+  // the flight is over: the next miss claims afresh
+  CHECK(cache.claim_inflight("example.com", "https", waiter));
+
+  // a failed flight wakes with the error and stores nothing
+  CHECK(!cache.claim_inflight("example.com", "https", waiter));
+  cache.publish("example.com", "https", boost::asio::error::not_found, {});
+  CHECK(woken == 3);
+  CHECK(seen == boost::asio::error::not_found);
+}
+
+TEST_CASE("expiry")
+{
+  namespace br = boost::requests;
+
+  br::resolver_cache cache{std::chrono::seconds(0)};
+
+  br::resolver_cache::entry e;
+  e.host_name = "example.com";
+  cache.put("example.com", "https", e);
+
+  br::resolver_cache::entry out;
+  CHECK(!cache.get("example.com", "https", out));
+}
+
+TEST_CASE("snapshot")
+{
+  namespace br = boost::requests;
+
+  br::resolver_cache cache{std::chrono::seconds(60)};
+  br::resolver_cache::entry e;
+  e.host_name = "example.com";
+  e.endpoints.emplace_back(boost::asio::ip::make_address("127.0.0.1"), 443);
+  cache.put("example.com", "https", e);
+
+  const auto snap = cache.snapshot();
+  REQUIRE(snap.size() == 1u);
+  CHECK(snap.front().key == "example.com:https");
+  CHECK(snap.front().remaining > std::chrono::seconds(0));
+  CHECK(snap.front().remaining <= std::chrono::seconds(60));
+
+  br::resolver_cache other{std::chrono::seconds(60)};
+  other.restore(snap.front().key, snap.front().data, snap.front().remaining);
+
+  br::resolver_cache::entry out;
+  CHECK(other.get("example.com", "https", out));
+  CHECK(out.host_name == "example.com");
+  REQUIRE(out.endpoints.size() == 1u);
+  CHECK(out.endpoints.front().port() == 443);
+
+  // an entry whose lifetime ran out on disk never enters the cache
+  other.restore("stale.example:https", e, std::chrono::seconds(-5));
+  CHECK(!other.get("stale.example", "https", out));
+}
+
+TEST_SUITE_END();
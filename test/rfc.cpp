@@ -34,6 +34,12 @@ TEST_CASE("date-1123")
   CHECK(std::chrono::system_clock::time_point(std::chrono::seconds(1)) ==
         urls::grammar::parse("Thu, 01 Jan 1970 00:00:01 GMT",  requests::rfc::date_1123));
 
+  // the tolerated '-' separators take the grammar path and must agree
+  // with the fixed-width fast path to the second
+  CHECK(std::chrono::system_clock::time_point(std::chrono::seconds(784111777)) ==
+        urls::grammar::parse("Sun, 06-Nov-1994 08:49:37 GMT", requests::rfc::date_1123));
+
+  CHECK(urls::grammar::parse("Sun, 0x Nov 1994 08:49:37 GMT", requests::rfc::date_1123).has_error());
 }
 
 TEST_CASE("date-850")
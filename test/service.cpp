@@ -30,4 +30,32 @@ TEST_CASE("session")
   requests::default_session(ctx.get_executor() );
 }
 
+TEST_CASE("shards")
+{
+  using namespace boost;
+
+  asio::io_context ctx1, ctx2;
+  requests::session_shards shards;
+
+  auto & s1 = shards.get(ctx1.get_executor());
+  auto & s2 = shards.get(ctx2.get_executor());
+
+  // one replica per context, stable across calls
+  CHECK(&s1 != &s2);
+  CHECK(&shards.get(ctx1.get_executor()) == &s1);
+  CHECK(&requests::default_session(ctx1.get_executor()) == &s1);
+
+  // both replicas resolve through the one shared cache
+  CHECK(&s1.dns_cache() == &shards.dns_cache());
+  CHECK(&s2.dns_cache() == &shards.dns_cache());
+
+  requests::resolver_cache::entry e;
+  e.host_name = "example.com";
+  e.endpoints.emplace_back(asio::ip::make_address("127.0.0.1"), 443);
+  s1.dns_cache().put("example.com", "https", e);
+
+  requests::resolver_cache::entry out;
+  CHECK(s2.dns_cache().get("example.com", "https", out));
+}
+
 TEST_SUITE_END();
\ No newline at end of file
@@ -14,6 +14,11 @@
 #include <boost/asio/detached.hpp>
 #include <boost/asio/redirect_error.hpp>
 #include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+#include <atomic>
+#include <thread>
 
 #include "doctest.h"
 #include "string_maker.hpp"
@@ -509,4 +514,287 @@ TEST_CASE_TEMPLATE("async-session-request", M, http_maker, https_maker)
   ctx.run();
 }
 
+TEST_CASE("per-host-options")
+{
+  asio::io_context ctx;
+  requests::session sess{ctx};
+  sess.options().max_redirects = 3;
+
+  auto ov = sess.options();
+  ov.max_redirects = 0;
+  ov.enforce_tls = true;
+  sess.set_options("api.example.com:8080", ov);
+
+  CHECK(sess.options_for("api.example.com:8080").max_redirects == 0);
+  CHECK(sess.options_for("api.example.com:8080").enforce_tls);
+  // other hosts keep the session-wide options
+  CHECK(sess.options_for("example.com").max_redirects == 3);
+
+  sess.reset_options("api.example.com:8080");
+  CHECK(sess.options_for("api.example.com:8080").max_redirects == 3);
+}
+
+TEST_CASE("unix-pool")
+{
+  // no lookup happens for unix:// urls, so this needs no live socket
+  asio::io_context ctx;
+  requests::session sess{ctx};
+
+  urls::url_view url{"unix:///var/run/requests-test.sock"};
+  auto p1 = sess.get_pool(url);
+  auto * up = variant2::get_if<std::shared_ptr<requests::unix_connection_pool>>(&p1);
+  REQUIRE(up != nullptr);
+  REQUIRE(*up != nullptr);
+
+  // the same path hands out the same pool again
+  auto p2 = sess.get_pool(url);
+  CHECK(variant2::get<std::shared_ptr<requests::unix_connection_pool>>(p2) == *up);
+
+  // a different socket gets its own pool
+  auto p3 = sess.get_pool(urls::url_view{"unix:///var/run/other.sock"});
+  CHECK(variant2::get<std::shared_ptr<requests::unix_connection_pool>>(p3) != *up);
+}
+
+TEST_CASE("endpoint-ref")
+{
+  // no lookup happens for unix:// urls, so this needs no live socket
+  asio::io_context ctx;
+  requests::session sess{ctx};
+
+  requests::endpoint_ref ep{urls::url_view{"unix:///var/run/requests-test.sock"}};
+
+  // first use goes through the regular lookup and fills the cache
+  auto p1 = sess.get_pool(ep);
+  auto * up = variant2::get_if<std::shared_ptr<requests::unix_connection_pool>>(&p1);
+  REQUIRE(up != nullptr);
+  REQUIRE(*up != nullptr);
+
+  // the cached handle resolves to the very same pool
+  auto p2 = sess.get_pool(ep);
+  CHECK(variant2::get<std::shared_ptr<requests::unix_connection_pool>>(p2) == *up);
+
+  // creating another pool swaps the snapshot, which lapses the cache -
+  // the handle falls back to the lookup and still finds its pool
+  sess.get_pool(urls::url_view{"unix:///var/run/other.sock"});
+  auto p3 = sess.get_pool(ep);
+  CHECK(variant2::get<std::shared_ptr<requests::unix_connection_pool>>(p3) == *up);
+
+  // the async path serves the cache through a post
+  bool done = false;
+  sess.async_get_pool(ep, [&](system::error_code ec, requests::session::pool_ptr p)
+  {
+    CHECK(!ec);
+    CHECK(variant2::get<std::shared_ptr<requests::unix_connection_pool>>(p) == *up);
+    done = true;
+  });
+  ctx.run();
+  CHECK(done);
+
+  // shutdown drops the pools; the handle notices and just re-creates one
+  sess.shutdown();
+  auto p4 = sess.get_pool(ep);
+  CHECK(variant2::get<std::shared_ptr<requests::unix_connection_pool>>(p4) != *up);
+}
+
+TEST_CASE("connection-budget")
+{
+  requests::detail::conn_budget b;
+
+  // uncapped: units count but nothing is refused
+  CHECK(b.try_once());
+  CHECK(b.in_use == 1u);
+
+  b.limit = 2u;
+  CHECK(b.try_once());
+  CHECK(!b.try_once()); // full, and no reclaim installed
+
+  // with a reclaim the retry succeeds once it made room
+  std::size_t asked = 0u;
+  b.reclaim = [&](const void *) { asked++; b.release(); return std::size_t(1u); };
+  CHECK(b.try_acquire(nullptr));
+  CHECK(asked == 1u);
+  CHECK(b.in_use == 2u);
+
+  // the unconditional acquire oversubscribes rather than refuse
+  b.acquire();
+  CHECK(b.in_use == 3u);
+  b.release(3u);
+  CHECK(b.in_use == 0u);
+
+  asio::io_context ctx;
+  requests::session sess{ctx};
+  sess.set_connection_budget(2u);
+  CHECK(sess.connection_budget() == 2u);
+  CHECK(sess.connections_open() == 0u);
+}
+
+TEST_CASE("drain")
+{
+  asio::io_context ctx;
+  requests::session sess{ctx};
+
+  // a pool with nothing in flight, so the drain finds an idle session
+  sess.get_pool(urls::url_view{"unix:///var/run/requests-test.sock"});
+
+  system::error_code drain_ec;
+  bool done = false;
+  sess.async_drain(std::chrono::seconds(5),
+                   [&](system::error_code ec) { drain_ec = ec; done = true; });
+  CHECK(sess.draining());
+  ctx.run();
+  CHECK(done);
+  CHECK(!drain_ec);
+
+  // new work is shed instead of being started on a dying session
+  system::error_code ec;
+  auto str = sess.ropen(beast::http::verb::get, urls::url_view{"http://example.com/"},
+                        requests::empty{}, {}, ec);
+  CHECK(ec == requests::error::session_draining);
+}
+
+TEST_CASE("warm-state")
+{
+  asio::io_context ctx;
+  requests::session sess{ctx};
+
+  requests::resolver_cache::entry e;
+  e.host_name = "example.com";
+  e.endpoints.emplace_back(asio::ip::make_address("127.0.0.1"), 443);
+  sess.dns_cache().put("example.com", "443", e);
+
+  const auto data = sess.save_state();
+
+  requests::session restored{ctx};
+  CHECK(restored.restore_state(data));
+  requests::resolver_cache::entry out;
+  CHECK(restored.dns_cache().get("example.com", "443", out));
+  CHECK(out.host_name == "example.com");
+  REQUIRE(out.endpoints.size() == 1u);
+  CHECK(out.endpoints.front().port() == 443);
+
+  CHECK(!restored.restore_state("not a snapshot"));
+
+  // and the same through a file
+  const auto file = std::filesystem::temp_directory_path() / "requests-warm-state-test.bin";
+  system::error_code ec;
+  CHECK(sess.save_state(file, ec));
+  CHECK(!ec);
+  requests::session from_file{ctx};
+  CHECK(from_file.restore_state(file, ec));
+  CHECK(!ec);
+  CHECK(from_file.dns_cache().get("example.com", "443", out));
+  std::filesystem::remove(file);
+}
+
+namespace
+{
+
+// counts the requests that actually reach the wire; every accepted
+// connection answers with keep-alive until its peer hangs up.
+struct counting_server
+{
+  asio::io_context ctx;
+  asio::ip::tcp::acceptor acceptor{ctx, asio::ip::tcp::endpoint{asio::ip::make_address("127.0.0.1"), 0}};
+  std::uint16_t port{acceptor.local_endpoint().port()};
+  std::atomic<std::size_t> requests{0u};
+  std::vector<std::thread> threads;
+  std::thread accept_thread;
+
+  counting_server()
+  {
+    accept_thread = std::thread(
+        [this]
+        {
+          for (;;)
+          {
+            system::error_code ec;
+            asio::ip::tcp::socket sock{ctx};
+            acceptor.accept(sock, ec);
+            if (ec)
+              return;
+            threads.emplace_back(&counting_server::serve_, this, std::move(sock));
+          }
+        });
+  }
+
+  ~counting_server()
+  {
+    system::error_code ec;
+    acceptor.close(ec);
+    accept_thread.join();
+    for (auto & t : threads)
+      t.join();
+  }
+
+  void serve_(asio::ip::tcp::socket sock)
+  {
+    asio::streambuf buf;
+    for (;;)
+    {
+      system::error_code ec;
+      asio::read_until(sock, buf, "\r\n\r\n", ec);
+      if (ec)
+        return;
+      buf.consume(buf.size());
+      requests.fetch_add(1u);
+      // slow enough for the other GETs to park on the flight
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      const std::string response =
+          "HTTP/1.1 200 OK\r\n"
+          "Content-Length: 4\r\n"
+          "Connection: keep-alive\r\n"
+          "\r\n"
+          "same";
+      asio::write(sock, asio::buffer(response), ec);
+      if (ec)
+        return;
+    }
+  }
+};
+
+}
+
+TEST_CASE("single-flight")
+{
+  counting_server server;
+
+  asio::io_context ctx;
+  requests::session sess{ctx};
+  sess.options().enforce_tls = false;
+  sess.use_single_flight(true);
+  CHECK(sess.uses_single_flight());
+
+  const auto url =
+      urls::parse_uri("http://127.0.0.1:" + std::to_string(server.port) + "/hot").value();
+
+  std::size_t done = 0u;
+  auto handler = [&](system::error_code ec, requests::session::stream str)
+  {
+    CHECK(ec == system::error_code{});
+    std::string body;
+    char buf[16];
+    system::error_code rec;
+    while (!str.done() && !rec)
+      body.append(buf, str.read_some(asio::buffer(buf), rec));
+    CHECK(body == "same");
+    done++;
+  };
+
+  for (int i = 0; i != 3; i++)
+    sess.async_ropen(beast::http::verb::get, url, requests::empty{}, {}, handler);
+  ctx.run();
+
+  CHECK(done == 3u);
+  CHECK(server.requests.load() == 1u); // one origin fetch served all three
+
+  // a different accept header is a different flight
+  ctx.restart();
+  requests::http::fields fields;
+  fields.set(beast::http::field::accept, "application/json");
+  sess.async_ropen(beast::http::verb::get, url, requests::empty{}, std::move(fields), handler);
+  ctx.run();
+  CHECK(done == 4u);
+  CHECK(server.requests.load() == 2u);
+}
+
 TEST_SUITE_END();
\ No newline at end of file
@@ -0,0 +1,41 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/socket_options.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include "doctest.h"
+
+using namespace boost;
+
+TEST_SUITE_BEGIN("socket-options");
+
+TEST_CASE("apply")
+{
+  asio::io_context ctx;
+  asio::ip::tcp::socket sock{ctx};
+  sock.open(asio::ip::tcp::v4());
+
+  requests::socket_options opts;
+  opts.no_delay = true;
+  opts.keep_alive = true;
+  opts.send_buffer_size = 64 * 1024;
+  requests::detail::apply_socket_options(sock, opts);
+
+  asio::ip::tcp::no_delay nd;
+  sock.get_option(nd);
+  CHECK(nd.value());
+
+  asio::socket_base::keep_alive ka;
+  sock.get_option(ka);
+  CHECK(ka.value());
+
+  asio::socket_base::send_buffer_size sb;
+  sock.get_option(sb);
+  CHECK(sb.value() >= 64 * 1024); // linux reports the doubled value
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,92 @@
+// Copyright (c) 2022 Klemens D. Morgenstern
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/requests/source.hpp>
+#include <boost/requests/body_traits.hpp>
+
+#include <boost/asio/error.hpp>
+#include <boost/beast/http/fields.hpp>
+
+#include "doctest.h"
+#include "string_maker.hpp"
+
+using namespace boost;
+
+TEST_SUITE_BEGIN("source");
+
+namespace
+{
+
+std::string serialize(const requests::source & src, system::error_code & ec)
+{
+  beast::http::header<true, beast::http::fields> hd;
+  requests::source_body::writer wr{hd, src};
+
+  wr.init(ec);
+  REQUIRE(!ec);
+
+  std::string res;
+  for (;;)
+  {
+    auto buf = wr.get(ec);
+    if (ec || !buf)
+      break;
+    res.append(static_cast<const char*>(buf->first.data()), buf->first.size());
+    if (!buf->second)
+      break;
+  }
+  return res;
+}
+
+}
+
+TEST_CASE("pulled in chunks")
+{
+  // a payload bigger than the staging buffer, produced on the fly
+  std::size_t produced = 0u, calls = 0u;
+  const std::size_t total = BOOST_REQUESTS_CHUNK_SIZE * 2u + 100u;
+
+  requests::source src{
+      [&](span<char> buffer, system::error_code &) -> std::size_t
+      {
+        calls++;
+        const auto n = (std::min)(buffer.size(), total - produced);
+        for (std::size_t i = 0u; i < n; i++)
+          buffer[i] = static_cast<char>('a' + (produced + i) % 26u);
+        produced += n;
+        return n;
+      }};
+
+  CHECK(requests::request_body_traits<requests::source>::default_content_type(src)
+        == "application/octet-stream");
+
+  system::error_code ec;
+  const auto body = serialize(src, ec);
+  CHECK(!ec);
+  CHECK(body.size() == total);
+  CHECK(body[0] == 'a');
+  CHECK(body[26] == 'a');
+  CHECK(calls == 4u); // three full-or-partial pulls plus the empty one
+}
+
+TEST_CASE("error aborts")
+{
+  requests::source src{
+      [](span<char>, system::error_code & ec) -> std::size_t
+      {
+        BOOST_REQUESTS_ASSIGN_EC(ec, asio::error::no_memory);
+        return 0u;
+      },
+      "application/x-batch"};
+
+  CHECK(requests::request_body_traits<requests::source>::default_content_type(src)
+        == "application/x-batch");
+
+  system::error_code ec;
+  serialize(src, ec);
+  CHECK(ec == asio::error::no_memory);
+}
+
+TEST_SUITE_END();